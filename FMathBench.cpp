@@ -0,0 +1,2287 @@
+//
+//  FMathBench.cpp
+//  MathLib
+//
+//  性能测试：对比新旧实现的耗时，并校验结果一致性.
+//
+
+#include "FMathBench.h"
+#include "Fix64.h"
+#include "Fix64Divisor.h"
+#include "Fix64Overflow.h"
+#include "Fixed.h"
+#include "FVector3.h"
+#include "FVector3Array.h"
+#include "FMatrix4.h"
+#include "FMatrix3x4.h"
+#include "FQuaternion.h"
+#include <chrono>
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <algorithm>
+using namespace FMath;
+
+namespace
+{
+    /// 防止被测代码被编译器优化掉
+    volatile int64_t benchSink = 0;
+
+    /// 固定种子，保证每次运行的输入一致
+    const uint64_t benchSeed = 20200708;
+
+    struct BenchTimer
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        int64_t ElapsedMicroseconds() const
+        {
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        }
+    };
+
+    void GenerateRaw(std::vector<int64_t>& out, int count, int64_t range, std::mt19937_64& rng)
+    {
+        std::uniform_int_distribution<int64_t> dist(-range, range);
+        out.resize(count);
+        for (int i = 0; i < count; ++i)
+        {
+            out[i] = dist(rng);
+        }
+    }
+}
+
+void FMath::BenchFix64Mul(int sampleCount)
+{
+    struct MulRange
+    {
+        const char* name;
+        int64_t range;
+    };
+
+    // 小数、常见的游戏数值、较大数值（乘积不溢出）
+    const MulRange ranges[] = {
+        { "fraction  (|x| < 1)", Fix64::fractionFactor },
+        { "gameplay  (|x| < 1024)", (int64_t)1024 << Fix64::fractionBits },
+        { "large     (|x| < 2^20)", (int64_t)1 << (20 + Fix64::fractionBits) },
+    };
+
+    std::mt19937_64 rng(benchSeed);
+    std::vector<int64_t> a, b;
+
+    std::cout << "Fix64 Mul, sample_count = " << sampleCount
+              << (FIX64_MUL_INT128 ? ", engine = int128" : ", engine = portable") << std::endl;
+
+    for (const MulRange& r : ranges)
+    {
+        GenerateRaw(a, sampleCount, r.range, rng);
+        GenerateRaw(b, sampleCount, r.range, rng);
+
+        int mismatch = 0;
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            if (Fix64::Mul(a[i], b[i]) != Fix64::MulSplit(a[i], b[i]))
+            {
+                ++mismatch;
+            }
+        }
+
+        int64_t acc = 0;
+        BenchTimer splitTimer;
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            acc += Fix64::MulSplit(a[i], b[i]);
+        }
+        int64_t splitTime = splitTimer.ElapsedMicroseconds();
+
+        BenchTimer mulTimer;
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            acc += Fix64::Mul(a[i], b[i]);
+        }
+        int64_t mulTime = mulTimer.ElapsedMicroseconds();
+        benchSink = acc;
+
+        std::cout << "  " << r.name
+                  << "  MulSplit elapsedTime = " << splitTime << "us"
+                  << "  Mul elapsedTime = " << mulTime << "us"
+                  << "  mismatch = " << mismatch << std::endl;
+    }
+}
+
+namespace
+{
+    /// root是否等于floor(sqrt(rawValue << fractionBits))，用Mul避免128位乘法
+    bool IsFloorSqrt(int64_t rawValue, int64_t root)
+    {
+        // ceil(root^2 / fractionFactor) <= rawValue
+        uint64_t low = ((uint64_t)root * (uint64_t)root) & (Fix64::fractionFactor - 1);
+        int64_t lower = Fix64::Mul(root, root) + (low != 0 ? 1 : 0);
+
+        // floor(((root + 1)^2 - 1) / fractionFactor) >= rawValue
+        int64_t next = root + 1;
+        uint64_t nextLow = ((uint64_t)next * (uint64_t)next) & (Fix64::fractionFactor - 1);
+        int64_t upper = Fix64::Mul(next, next) - (nextLow == 0 ? 1 : 0);
+
+        return lower <= rawValue && upper >= rawValue;
+    }
+}
+
+void FMath::BenchFix64Sqrt(int sampleCount)
+{
+    struct SqrtRange
+    {
+        const char* name;
+        int64_t range;
+    };
+
+    // SqrtNewton在rawValue >= 2^47时溢出，最大的区间只到2^46
+    const SqrtRange ranges[] = {
+        { "fraction  (x < 1)", Fix64::fractionFactor },
+        { "gameplay  (x < 2^20)", (int64_t)1 << (20 + Fix64::fractionBits) },
+        { "large     (x < 2^30)", (int64_t)1 << (30 + Fix64::fractionBits) },
+    };
+
+    std::mt19937_64 rng(benchSeed);
+    std::vector<int64_t> values(sampleCount);
+
+    std::cout << "Fix64 Sqrt, sample_count = " << sampleCount << std::endl;
+
+    for (const SqrtRange& r : ranges)
+    {
+        std::uniform_int_distribution<int64_t> dist(0, r.range);
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            values[i] = dist(rng);
+        }
+
+        int inexact = 0;
+        int newtonDiff = 0;
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            int64_t root = Fix64::Sqrt(values[i]);
+            if (!IsFloorSqrt(values[i], root))
+            {
+                ++inexact;
+            }
+            if (root != Fix64::SqrtNewton(values[i]))
+            {
+                ++newtonDiff;
+            }
+        }
+
+        int64_t acc = 0;
+        BenchTimer newtonTimer;
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            acc += Fix64::SqrtNewton(values[i]);
+        }
+        int64_t newtonTime = newtonTimer.ElapsedMicroseconds();
+
+        BenchTimer sqrtTimer;
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            acc += Fix64::Sqrt(values[i]);
+        }
+        int64_t sqrtTime = sqrtTimer.ElapsedMicroseconds();
+
+        double dacc = 0;
+        BenchTimer stdTimer;
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            dacc += std::sqrt((double)values[i]);
+        }
+        int64_t stdTime = stdTimer.ElapsedMicroseconds();
+        benchSink = acc + (int64_t)dacc;
+
+        std::cout << "  " << r.name
+                  << "  SqrtNewton elapsedTime = " << newtonTime << "us"
+                  << "  Sqrt elapsedTime = " << sqrtTime << "us"
+                  << "  std::sqrt elapsedTime = " << stdTime << "us"
+                  << "  inexact = " << inexact
+                  << "  diff_from_newton = " << newtonDiff << std::endl;
+    }
+}
+
+namespace
+{
+    /// 误差统计，单位ULP
+    struct UlpError
+    {
+        double maxError = 0;
+        double sumError = 0;
+        int64_t worstInput = 0;
+        int count = 0;
+
+        void Add(int64_t input, int64_t rawValue, double expected)
+        {
+            double error = std::fabs((double)rawValue - expected * Fix64::fractionFactor);
+            if (error > maxError)
+            {
+                maxError = error;
+                worstInput = input;
+            }
+            sumError += error;
+            ++count;
+        }
+
+        void Print(const char* name) const
+        {
+            std::cout << "  " << name << "  max_ulp = " << maxError
+                      << "  mean_ulp = " << (count > 0 ? sumError / count : 0)
+                      << "  worst_input = " << Fix64::FromRawValue(worstInput).ToString() << std::endl;
+        }
+    };
+}
+
+void FMath::BenchFix64Divisor(int sampleCount)
+{
+    const int maxFanOut = 16;
+    const int fanOuts[] = { 1, 3, 4, maxFanOut };
+
+    std::mt19937_64 rng(benchSeed);
+    std::vector<int64_t> divisors;
+    std::vector<int64_t> numerators;
+
+    // 除数和被除数都在[-1024, 1024]内，被除数左移16位不溢出
+    GenerateRaw(divisors, sampleCount, (int64_t)1024 << Fix64::fractionBits, rng);
+    GenerateRaw(numerators, sampleCount * maxFanOut, (int64_t)1024 << Fix64::fractionBits, rng);
+
+    std::cout << "Fix64 Divisor, sample_count = " << sampleCount
+              << (FIX64_MUL_INT128 ? ", engine = int128" : ", engine = portable") << std::endl;
+
+    for (int fanOut : fanOuts)
+    {
+        int mismatch = 0;
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            Fix64 d = Fix64::FromRawValue(divisors[i]);
+            Fix64Divisor divisor(d);
+            for (int j = 0; j < fanOut; ++j)
+            {
+                Fix64 n = Fix64::FromRawValue(numerators[i * maxFanOut + j]);
+                if ((n / d) != (n / divisor))
+                {
+                    ++mismatch;
+                }
+            }
+        }
+
+        int64_t acc = 0;
+        BenchTimer divTimer;
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            Fix64 d = Fix64::FromRawValue(divisors[i]);
+            for (int j = 0; j < fanOut; ++j)
+            {
+                acc += (Fix64::FromRawValue(numerators[i * maxFanOut + j]) / d).rawValue;
+            }
+        }
+        int64_t divTime = divTimer.ElapsedMicroseconds();
+
+        BenchTimer divisorTimer;
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            Fix64Divisor divisor(Fix64::FromRawValue(divisors[i]));
+            for (int j = 0; j < fanOut; ++j)
+            {
+                acc += (Fix64::FromRawValue(numerators[i * maxFanOut + j]) / divisor).rawValue;
+            }
+        }
+        int64_t divisorTime = divisorTimer.ElapsedMicroseconds();
+        benchSink = acc;
+
+        std::cout << "  fan_out = " << fanOut
+                  << "  operator / elapsedTime = " << divTime << "us"
+                  << "  Fix64Divisor elapsedTime = " << divisorTime << "us"
+                  << "  mismatch = " << mismatch << std::endl;
+    }
+}
+
+void FMath::BenchFix64Overflow(int sampleCount)
+{
+    std::mt19937_64 rng(benchSeed);
+    std::vector<int64_t> a, b;
+
+    // [-2^20, 2^20]，乘积有一部分超出MaxValue
+    GenerateRaw(a, sampleCount, (int64_t)1 << (20 + Fix64::fractionBits), rng);
+    GenerateRaw(b, sampleCount, (int64_t)1 << (20 + Fix64::fractionBits), rng);
+
+    std::cout << "Fix64 Overflow, sample_count = " << sampleCount << std::endl;
+
+    Fix64 wrapAcc = Fix64::Zero;
+    BenchTimer wrapMulTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        wrapAcc += Fix64::FromRawValue(a[i]) * Fix64::FromRawValue(b[i]);
+    }
+    int64_t wrapMulTime = wrapMulTimer.ElapsedMicroseconds();
+
+    SatFix64 satAcc = 0;
+    BenchTimer satMulTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        satAcc += SatFix64::FromRawValue(a[i]) * SatFix64::FromRawValue(b[i]);
+    }
+    int64_t satMulTime = satMulTimer.ElapsedMicroseconds();
+
+    BenchTimer wrapDivTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        wrapAcc += Fix64::FromRawValue(a[i]) / Fix64::FromRawValue(b[i]);
+    }
+    int64_t wrapDivTime = wrapDivTimer.ElapsedMicroseconds();
+
+    BenchTimer satDivTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        satAcc += SatFix64::FromRawValue(a[i]) / SatFix64::FromRawValue(b[i]);
+    }
+    int64_t satDivTime = satDivTimer.ElapsedMicroseconds();
+    benchSink = wrapAcc.rawValue + satAcc.rawValue;
+
+    std::cout << "  Fix64 mul+add elapsedTime = " << wrapMulTime << "us"
+              << "  SatFix64 mul+add elapsedTime = " << satMulTime << "us"
+              << "  Fix64 div elapsedTime = " << wrapDivTime << "us"
+              << "  SatFix64 div elapsedTime = " << satDivTime << "us" << std::endl;
+}
+
+namespace
+{
+    /// <summary>
+    /// 对同一组输入(|x| < 128)按T格式做乘加，输出耗时和数组占用的内存.
+    /// </summary>
+    template<typename T>
+    void BenchFixedFormat(const char* name, const std::vector<double>& a, const std::vector<double>& b)
+    {
+        const int sampleCount = (int)a.size();
+        std::vector<T> fa(sampleCount), fb(sampleCount);
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            fa[i] = T(a[i]);
+            fb[i] = T(b[i]);
+        }
+
+        T acc = T(0);
+        BenchTimer timer;
+        for (int repeat = 0; repeat < 8; ++repeat)
+        {
+            for (int i = 0; i < sampleCount; ++i)
+            {
+                acc += fa[i] * fb[i];
+            }
+        }
+        int64_t elapsedTime = timer.ElapsedMicroseconds();
+        benchSink = (int64_t)acc.rawValue;
+
+        std::cout << "  " << name << "  size = " << sizeof(T) * sampleCount * 2 << " bytes"
+                  << "  mul+add elapsedTime = " << elapsedTime << "us" << std::endl;
+    }
+}
+
+void FMath::BenchFixedFormats(int sampleCount)
+{
+    std::mt19937_64 rng(benchSeed);
+    std::uniform_real_distribution<double> dist(-128, 128);
+    std::vector<double> a(sampleCount), b(sampleCount);
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        a[i] = dist(rng);
+        b[i] = dist(rng);
+    }
+
+    std::cout << "Fixed formats, sample_count = " << sampleCount << ", repeat = 8" << std::endl;
+
+    BenchFixedFormat<Fix64>("Fix64   ", a, b);
+    BenchFixedFormat<Fix32>("Fix32   ", a, b);
+    BenchFixedFormat<Fix64Q32>("Fix64Q32", a, b);
+}
+
+namespace
+{
+    /// <summary>
+    /// 用当前的FVector3Array::Kernel跑一遍全部批量运算，与FVector3逐个计算的结果对比.
+    /// </summary>
+    int CheckFVector3Array(const std::vector<FVector3>& a, const std::vector<FVector3>& b,
+                           const FVector3Array& sa, const FVector3Array& sb, const Fix64& t)
+    {
+        const size_t n = a.size();
+        FVector3Array out;
+        std::vector<Fix64> scalars(n);
+        int mismatch = 0;
+
+        auto compare = [&](const FVector3Array& result, FVector3 (*expected)(const FVector3&, const FVector3&, const Fix64&))
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                if (result.Get(i) != expected(a[i], b[i], t))
+                {
+                    ++mismatch;
+                }
+            }
+        };
+
+        FVector3Array::Add(sa, sb, out);
+        compare(out, [](const FVector3& x, const FVector3& y, const Fix64&) { return x + y; });
+        FVector3Array::Sub(sa, sb, out);
+        compare(out, [](const FVector3& x, const FVector3& y, const Fix64&) { return x - y; });
+        FVector3Array::Scale(sa, t, out);
+        compare(out, [](const FVector3& x, const FVector3&, const Fix64& s) { return x * s; });
+        FVector3Array::Cross(sa, sb, out);
+        compare(out, [](const FVector3& x, const FVector3& y, const Fix64&) { return FVector3::Cross(x, y); });
+        FVector3Array::Lerp(sa, sb, t, out);
+        compare(out, [](const FVector3& x, const FVector3& y, const Fix64& s) { return FVector3::Lerp(x, y, s); });
+
+        FVector3Array::Dot(sa, sb, scalars.data());
+        for (size_t i = 0; i < n; ++i)
+        {
+            mismatch += scalars[i] != FVector3::Dot(a[i], b[i]);
+        }
+        FVector3Array::SqrMagnitude(sa, scalars.data());
+        for (size_t i = 0; i < n; ++i)
+        {
+            mismatch += scalars[i] != a[i].SqrMagnitude();
+        }
+
+        return mismatch;
+    }
+}
+
+void FMath::BenchFVector3Array(int sampleCount)
+{
+    std::mt19937_64 rng(benchSeed);
+    std::vector<int64_t> raw;
+
+    // 分量[-2^20, 2^20]，一部分乘积超出MaxValue，覆盖回绕的情况
+    GenerateRaw(raw, sampleCount * 6, (int64_t)1 << (20 + Fix64::fractionBits), rng);
+
+    std::vector<FVector3> a, b;
+    FVector3Array sa(sampleCount), sb(sampleCount);
+    a.reserve(sampleCount);
+    b.reserve(sampleCount);
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        const int64_t* r = &raw[i * 6];
+        a.push_back(FVector3(Fix64::FromRawValue(r[0]), Fix64::FromRawValue(r[1]), Fix64::FromRawValue(r[2])));
+        b.push_back(FVector3(Fix64::FromRawValue(r[3]), Fix64::FromRawValue(r[4]), Fix64::FromRawValue(r[5])));
+        sa.Set(i, a[i]);
+        sb.Set(i, b[i]);
+    }
+    const Fix64 t = Fix64::FromRawValue(raw[0] >> 8);
+
+    FVector3Array::Kernel defaultKernel = FVector3Array::GetKernel();
+    std::vector<Fix64> dots(sampleCount);
+
+    std::cout << "FVector3Array, sample_count = " << sampleCount
+              << ", avx2 = " << (FVector3Array::Avx2Supported() ? "yes" : "no") << std::endl;
+
+    int64_t acc = 0;
+    BenchTimer aosTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        dots[i] = FVector3::Dot(a[i], b[i]);
+    }
+    int64_t aosTime = aosTimer.ElapsedMicroseconds();
+    acc += dots[sampleCount - 1].rawValue;
+
+    FVector3Array::SetKernel(FVector3Array::Kernel::Scalar);
+    int scalarMismatch = CheckFVector3Array(a, b, sa, sb, t);
+    BenchTimer scalarTimer;
+    FVector3Array::Dot(sa, sb, dots.data());
+    int64_t scalarTime = scalarTimer.ElapsedMicroseconds();
+    acc += dots[sampleCount - 1].rawValue;
+
+    std::cout << "  FVector3::Dot loop elapsedTime = " << aosTime << "us"
+              << "  SoA scalar Dot elapsedTime = " << scalarTime << "us";
+
+    if (FVector3Array::Avx2Supported())
+    {
+        FVector3Array::SetKernel(FVector3Array::Kernel::Avx2);
+        int avx2Mismatch = CheckFVector3Array(a, b, sa, sb, t);
+        BenchTimer avx2Timer;
+        FVector3Array::Dot(sa, sb, dots.data());
+        int64_t avx2Time = avx2Timer.ElapsedMicroseconds();
+        acc += dots[sampleCount - 1].rawValue;
+
+        std::cout << "  SoA avx2 Dot elapsedTime = " << avx2Time << "us"
+                  << "  avx2 mismatch = " << avx2Mismatch;
+    }
+
+    std::cout << "  scalar mismatch = " << scalarMismatch << std::endl;
+
+    // 1M个向量时受内存带宽限制，再用能放进L1/L2的小数组重复计算，体现计算本身的差别
+    const int residentCount = 4096;
+    const int repeat = sampleCount / residentCount;
+    FVector3Array ra(residentCount), rb(residentCount), rc;
+    for (int i = 0; i < residentCount; ++i)
+    {
+        ra.Set(i, a[i]);
+        rb.Set(i, b[i]);
+    }
+
+    auto timeKernel = [&](FVector3Array::Kernel kernel, int64_t& dotTime, int64_t& crossTime)
+    {
+        FVector3Array::SetKernel(kernel);
+
+        BenchTimer dotTimer;
+        for (int r = 0; r < repeat; ++r)
+        {
+            FVector3Array::Dot(ra, rb, dots.data());
+            acc += dots[r % residentCount].rawValue;
+        }
+        dotTime = dotTimer.ElapsedMicroseconds();
+
+        BenchTimer crossTimer;
+        for (int r = 0; r < repeat; ++r)
+        {
+            FVector3Array::Cross(ra, rb, rc);
+            acc += rc.X()[r % residentCount];
+        }
+        crossTime = crossTimer.ElapsedMicroseconds();
+    };
+
+    int64_t scalarDotTime = 0, scalarCrossTime = 0;
+    timeKernel(FVector3Array::Kernel::Scalar, scalarDotTime, scalarCrossTime);
+    std::cout << "  resident " << residentCount << " x " << repeat
+              << "  scalar Dot elapsedTime = " << scalarDotTime << "us"
+              << "  scalar Cross elapsedTime = " << scalarCrossTime << "us";
+
+    if (FVector3Array::Avx2Supported())
+    {
+        int64_t avx2DotTime = 0, avx2CrossTime = 0;
+        timeKernel(FVector3Array::Kernel::Avx2, avx2DotTime, avx2CrossTime);
+        std::cout << "  avx2 Dot elapsedTime = " << avx2DotTime << "us"
+                  << "  avx2 Cross elapsedTime = " << avx2CrossTime << "us";
+    }
+    benchSink = acc;
+    std::cout << std::endl;
+
+    FVector3Array::SetKernel(defaultKernel);
+}
+
+namespace
+{
+    /// <summary>
+    /// 当前kernel下批量变换与逐个计算不一致的个数.
+    /// </summary>
+    int CheckFMatrix4Transform(const FMatrix4& m, const std::vector<FVector3>& points,
+                               const FVector3Array& soa, const std::vector<FVector4>& vectors)
+    {
+        const size_t n = points.size();
+        int mismatch = 0;
+
+        std::vector<FVector3> out(points);
+        FVector3Array soaOut;
+        std::vector<FVector4> out4(n);
+
+        m.TransformPoints(points.data(), out.data(), n);
+        m.TransformPoints(soa, soaOut);
+        for (size_t i = 0; i < n; ++i)
+        {
+            FVector3 expected = m.MultiplyPoint(points[i]);
+            mismatch += out[i] != expected;
+            mismatch += soaOut.Get(i) != expected;
+        }
+
+        m.TransformDirections(points.data(), out.data(), n);
+        m.TransformDirections(soa, soaOut);
+        for (size_t i = 0; i < n; ++i)
+        {
+            FVector3 expected = m.MultiplyVector(points[i]);
+            mismatch += out[i] != expected;
+            mismatch += soaOut.Get(i) != expected;
+        }
+
+        m.Transform(vectors.data(), out4.data(), n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            FVector4 expected = m * vectors[i];
+            mismatch += out4[i].x != expected.x || out4[i].y != expected.y
+                     || out4[i].z != expected.z || out4[i].w != expected.w;
+        }
+
+        return mismatch;
+    }
+}
+
+void FMath::BenchFMatrix4Transform(int sampleCount)
+{
+    std::mt19937_64 rng(benchSeed);
+    std::vector<int64_t> raw;
+
+    // 坐标[-2^15, 2^15]，矩阵为旋转+缩放+平移
+    GenerateRaw(raw, sampleCount * 4, (int64_t)1 << (15 + Fix64::fractionBits), rng);
+
+    FMatrix4 m = FMatrix4::RotateAxis(Fix64(0.7), FVector3(Fix64(0.6), Fix64(0.0), Fix64(0.8)))
+               * FMatrix4::TS(FVector3(Fix64(10), Fix64(-20), Fix64(30)), FVector3(Fix64(2), Fix64(2), Fix64(2)));
+
+    // 1M个点受内存带宽限制，计时用能放进L2的4096个点重复计算
+    const int residentCount = 4096;
+    const int repeat = sampleCount / residentCount;
+
+    std::vector<FVector3> points;
+    std::vector<FVector4> vectors;
+    FVector3Array soa(residentCount);
+    points.reserve(residentCount);
+    vectors.reserve(residentCount);
+    for (int i = 0; i < residentCount; ++i)
+    {
+        const int64_t* r = &raw[i * 4];
+        points.push_back(FVector3(Fix64::FromRawValue(r[0]), Fix64::FromRawValue(r[1]), Fix64::FromRawValue(r[2])));
+        vectors.push_back(FVector4(points[i].x, points[i].y, points[i].z, Fix64::FromRawValue(r[3])));
+        soa.Set(i, points[i]);
+    }
+
+    FVector3Array::Kernel defaultKernel = FVector3Array::GetKernel();
+    std::vector<FVector3> out(points);
+    std::vector<FVector4> out4(residentCount);
+    FVector3Array soaOut;
+    int64_t acc = 0;
+
+    std::cout << "FMatrix4 Transform, point_count = " << residentCount << " x " << repeat
+              << ", avx2 = " << (FVector3Array::Avx2Supported() ? "yes" : "no") << std::endl;
+
+    BenchTimer operatorTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        for (int i = 0; i < residentCount; ++i)
+        {
+            out4[i] = m * FVector4(points[i].x, points[i].y, points[i].z, Fix64::One);
+        }
+        acc += out4[r % residentCount].x.rawValue;
+    }
+    int64_t operatorTime = operatorTimer.ElapsedMicroseconds();
+
+    BenchTimer multiplyTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        for (int i = 0; i < residentCount; ++i)
+        {
+            out[i] = m.MultiplyPoint(points[i]);
+        }
+        acc += out[r % residentCount].x.rawValue;
+    }
+    int64_t multiplyTime = multiplyTimer.ElapsedMicroseconds();
+
+    std::cout << "  operator *(FMatrix4, FVector4) loop elapsedTime = " << operatorTime << "us"
+              << "  MultiplyPoint loop elapsedTime = " << multiplyTime << "us" << std::endl;
+
+    auto timeKernel = [&](FVector3Array::Kernel kernel, const char* name)
+    {
+        FVector3Array::SetKernel(kernel);
+        int mismatch = CheckFMatrix4Transform(m, points, soa, vectors);
+
+        BenchTimer aosTimer;
+        for (int r = 0; r < repeat; ++r)
+        {
+            m.TransformPoints(points.data(), out.data(), residentCount);
+            acc += out[r % residentCount].x.rawValue;
+        }
+        int64_t aosTime = aosTimer.ElapsedMicroseconds();
+
+        BenchTimer soaTimer;
+        for (int r = 0; r < repeat; ++r)
+        {
+            m.TransformPoints(soa, soaOut);
+            acc += soaOut.X()[r % residentCount];
+        }
+        int64_t soaTime = soaTimer.ElapsedMicroseconds();
+
+        BenchTimer vector4Timer;
+        for (int r = 0; r < repeat; ++r)
+        {
+            m.Transform(vectors.data(), out4.data(), residentCount);
+            acc += out4[r % residentCount].x.rawValue;
+        }
+        int64_t vector4Time = vector4Timer.ElapsedMicroseconds();
+
+        std::cout << "  " << name << " TransformPoints AoS elapsedTime = " << aosTime << "us"
+                  << "  SoA elapsedTime = " << soaTime << "us"
+                  << "  Transform FVector4 elapsedTime = " << vector4Time << "us"
+                  << "  mismatch = " << mismatch << std::endl;
+    };
+
+    timeKernel(FVector3Array::Kernel::Scalar, "scalar");
+    if (FVector3Array::Avx2Supported())
+    {
+        timeKernel(FVector3Array::Kernel::Avx2, "avx2");
+    }
+    benchSink = acc;
+
+    FVector3Array::SetKernel(defaultKernel);
+}
+
+void FMath::BenchFMatrix3x4(int sampleCount)
+{
+    std::mt19937_64 rng(benchSeed);
+
+    // 一组刚体变换，循环复合；旋转矩阵保证连乘不会发散
+    const int matrixCount = 64;
+    std::vector<FMatrix4> matrices;
+    std::vector<FMatrix3x4> affines;
+    for (int i = 0; i < matrixCount; ++i)
+    {
+        Fix64 angle = Fix64::FromRawValue((int64_t)(rng() % (6 * Fix64::fractionFactor)));
+        FVector3 axis = FVector3(Fix64::FromRawValue((int64_t)(rng() % Fix64::fractionFactor) + 1),
+                                 Fix64::FromRawValue((int64_t)(rng() % Fix64::fractionFactor)),
+                                 Fix64::FromRawValue((int64_t)(rng() % Fix64::fractionFactor))).Normalized();
+        FVector3 pos = FVector3(Fix64((int)(rng() % 200) - 100), Fix64((int)(rng() % 200) - 100), Fix64((int)(rng() % 200) - 100));
+
+        matrices.push_back(FMatrix4::RotateAxis(angle, axis) * FMatrix4::Translate(pos));
+        affines.push_back(FMatrix3x4(matrices[i]));
+    }
+
+    int mismatch = 0;
+    for (int i = 0; i < matrixCount; ++i)
+    {
+        const int j = (i + 1) % matrixCount;
+        mismatch += (affines[i] * affines[j]).ToMatrix4() != matrices[i] * matrices[j];
+    }
+
+    int64_t acc = 0;
+
+    BenchTimer matrix4Timer;
+    FMatrix4 m = FMatrix4::Identity;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        m = matrices[i % matrixCount] * m;
+    }
+    int64_t matrix4Time = matrix4Timer.ElapsedMicroseconds();
+    acc += m.m00.rawValue;
+
+    BenchTimer affineTimer;
+    FMatrix3x4 a = FMatrix3x4::Identity;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        a = affines[i % matrixCount] * a;
+    }
+    int64_t affineTime = affineTimer.ElapsedMicroseconds();
+    acc += a.m00.rawValue;
+    benchSink = acc;
+
+    // 整条复合链也应逐位一致
+    mismatch += a.ToMatrix4() != m;
+
+    std::cout << "FMatrix3x4 compose, sample_count = " << sampleCount
+              << "  FMatrix4 elapsedTime = " << matrix4Time << "us"
+              << "  FMatrix3x4 elapsedTime = " << affineTime << "us"
+              << "  sizeof = " << sizeof(FMatrix4) << " / " << sizeof(FMatrix3x4)
+              << "  mismatch = " << mismatch << std::endl;
+}
+
+namespace
+{
+    /// <summary>
+    /// lhs * rhs与单位矩阵的最大误差.
+    /// </summary>
+    double IdentityError(const FMatrix4& lhs, const FMatrix4& rhs)
+    {
+        FMatrix4 product = lhs * rhs;
+        const Fix64* p = &product.m00;
+        const Fix64* e = &FMatrix4::Identity.m00;
+
+        double maxError = 0;
+        for (int i = 0; i < 16; ++i)
+        {
+            maxError = std::max(maxError, std::abs((p[i] - e[i]).ToDouble()));
+        }
+        return maxError;
+    }
+}
+
+void FMath::BenchFMatrix4Inverse(int sampleCount)
+{
+    std::mt19937_64 rng(benchSeed);
+
+    // 刚体变换：三种求逆都适用
+    const int matrixCount = 1024;
+    std::vector<FMatrix4> matrices;
+    for (int i = 0; i < matrixCount; ++i)
+    {
+        Fix64 angle = Fix64::FromRawValue((int64_t)(rng() % (6 * Fix64::fractionFactor)));
+        FVector3 axis = FVector3(Fix64::FromRawValue((int64_t)(rng() % Fix64::fractionFactor) + 1),
+                                 Fix64::FromRawValue((int64_t)(rng() % Fix64::fractionFactor)),
+                                 Fix64::FromRawValue((int64_t)(rng() % Fix64::fractionFactor))).Normalized();
+        FVector3 pos = FVector3(Fix64((int)(rng() % 200) - 100), Fix64((int)(rng() % 200) - 100), Fix64((int)(rng() % 200) - 100));
+
+        matrices.push_back(FMatrix4::RotateAxis(angle, axis) * FMatrix4::Translate(pos));
+    }
+
+    const int repeat = std::max(1, sampleCount / matrixCount);
+    std::vector<FMatrix4> inverses(matrixCount);
+    int64_t acc = 0;
+    size_t singular = 0;
+
+    BenchTimer generalTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        singular += FMatrix4::Inverse(matrices.data(), inverses.data(), matrixCount);
+        acc += inverses[r % matrixCount].m00.rawValue;
+    }
+    int64_t generalTime = generalTimer.ElapsedMicroseconds();
+
+    double generalError = 0, affineError = 0, rigidError = 0;
+    for (int i = 0; i < matrixCount; ++i)
+    {
+        generalError = std::max(generalError, IdentityError(matrices[i], inverses[i]));
+        affineError = std::max(affineError, IdentityError(matrices[i], matrices[i].InverseAffine()));
+        rigidError = std::max(rigidError, IdentityError(matrices[i], matrices[i].InverseRigid()));
+    }
+
+    BenchTimer affineTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        for (int i = 0; i < matrixCount; ++i)
+        {
+            inverses[i] = matrices[i].InverseAffine();
+        }
+        acc += inverses[r % matrixCount].m00.rawValue;
+    }
+    int64_t affineTime = affineTimer.ElapsedMicroseconds();
+
+    BenchTimer rigidTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        for (int i = 0; i < matrixCount; ++i)
+        {
+            inverses[i] = matrices[i].InverseRigid();
+        }
+        acc += inverses[r % matrixCount].m00.rawValue;
+    }
+    int64_t rigidTime = rigidTimer.ElapsedMicroseconds();
+    benchSink = acc;
+
+    std::cout << "FMatrix4 Inverse, sample_count = " << matrixCount * repeat
+              << "  Inverse elapsedTime = " << generalTime << "us"
+              << "  InverseAffine elapsedTime = " << affineTime << "us"
+              << "  InverseRigid elapsedTime = " << rigidTime << "us" << std::endl
+              << "  max |M * M^-1 - I|: Inverse = " << generalError
+              << "  InverseAffine = " << affineError
+              << "  InverseRigid = " << rigidError
+              << "  singular = " << singular << std::endl;
+}
+
+namespace
+{
+    /// 旧接口按值传递两个参数，每次调用复制2 * 128字节的矩阵
+    FMatrix4 MultiplyByValue(FMatrix4 lhs, FMatrix4 rhs)
+    {
+        return lhs * rhs;
+    }
+
+    /// 旧接口按值传递两个四元数
+    FQuaternion MultiplyByValue(FQuaternion a, FQuaternion b)
+    {
+        return a * b;
+    }
+}
+
+void FMath::BenchTransformChain(int sampleCount)
+{
+    std::mt19937_64 rng(benchSeed);
+
+    // 旋转矩阵/单位四元数，连乘不会发散
+    const int count = 64;
+    std::vector<FMatrix4> matrices;
+    std::vector<FQuaternion> rotations;
+    for (int i = 0; i < count; ++i)
+    {
+        Fix64 angle = Fix64::FromRawValue((int64_t)(rng() % (6 * Fix64::fractionFactor)));
+        FVector3 axis = FVector3(Fix64::FromRawValue((int64_t)(rng() % Fix64::fractionFactor) + 1),
+                                 Fix64::FromRawValue((int64_t)(rng() % Fix64::fractionFactor)),
+                                 Fix64::FromRawValue((int64_t)(rng() % Fix64::fractionFactor))).Normalized();
+
+        matrices.push_back(FMatrix4::RotateAxis(angle, axis));
+        rotations.push_back(FQuaternion::AngleAxis(angle, axis));
+    }
+
+    BenchTimer matrixValueTimer;
+    FMatrix4 mv = FMatrix4::Identity;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        mv = MultiplyByValue(mv, matrices[i % count]);
+    }
+    int64_t matrixValueTime = matrixValueTimer.ElapsedMicroseconds();
+
+    BenchTimer matrixRefTimer;
+    FMatrix4 mr = FMatrix4::Identity;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        mr = mr * matrices[i % count];
+    }
+    int64_t matrixRefTime = matrixRefTimer.ElapsedMicroseconds();
+
+    BenchTimer matrixInPlaceTimer;
+    FMatrix4 mi = FMatrix4::Identity;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        mi *= matrices[i % count];
+    }
+    int64_t matrixInPlaceTime = matrixInPlaceTimer.ElapsedMicroseconds();
+
+    BenchTimer quatValueTimer;
+    FQuaternion qv = FQuaternion::Identity;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        qv = MultiplyByValue(qv, rotations[i % count]);
+    }
+    int64_t quatValueTime = quatValueTimer.ElapsedMicroseconds();
+
+    BenchTimer quatRefTimer;
+    FQuaternion qr = FQuaternion::Identity;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        qr = qr * rotations[i % count];
+    }
+    int64_t quatRefTime = quatRefTimer.ElapsedMicroseconds();
+
+    BenchTimer quatInPlaceTimer;
+    FQuaternion qi = FQuaternion::Identity;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        qi *= rotations[i % count];
+    }
+    int64_t quatInPlaceTime = quatInPlaceTimer.ElapsedMicroseconds();
+
+    int mismatch = (mv != mr) + (mv != mi) + (qv != qr) + (qv != qi);
+    benchSink = mi.m00.rawValue + qi.w.rawValue;
+
+    std::cout << "Transform chain, sample_count = " << sampleCount << std::endl
+              << "  FMatrix4 by value elapsedTime = " << matrixValueTime << "us"
+              << "  const ref elapsedTime = " << matrixRefTime << "us"
+              << "  *= elapsedTime = " << matrixInPlaceTime << "us" << std::endl
+              << "  FQuaternion by value elapsedTime = " << quatValueTime << "us"
+              << "  const ref elapsedTime = " << quatRefTime << "us"
+              << "  *= elapsedTime = " << quatInPlaceTime << "us"
+              << "  mismatch = " << mismatch << std::endl;
+}
+
+namespace
+{
+    /// <summary>
+    /// 当前kernel下批量旋转与逐个Rotate不一致的个数.
+    /// </summary>
+    int CheckFQuaternionRotate(const FQuaternion& q, const std::vector<FQuaternion>& rotations,
+                               const std::vector<FVector3>& vectors, const FVector3Array& soa)
+    {
+        const size_t n = vectors.size();
+        int mismatch = 0;
+
+        std::vector<FVector3> out(vectors);
+        FVector3Array soaOut;
+
+        q.Rotate(vectors.data(), out.data(), n);
+        q.Rotate(soa, soaOut);
+        for (size_t i = 0; i < n; ++i)
+        {
+            FVector3 expected = q.Rotate(vectors[i]);
+            mismatch += out[i] != expected;
+            mismatch += soaOut.Get(i) != expected;
+        }
+
+        FQuaternion::Rotate(rotations.data(), vectors.data(), out.data(), n);
+        FQuaternion::Rotate(rotations.data(), soa, soaOut);
+        for (size_t i = 0; i < n; ++i)
+        {
+            FVector3 expected = rotations[i].Rotate(vectors[i]);
+            mismatch += out[i] != expected;
+            mismatch += soaOut.Get(i) != expected;
+        }
+
+        return mismatch;
+    }
+}
+
+void FMath::BenchFQuaternionRotate(int sampleCount)
+{
+    std::mt19937_64 rng(benchSeed);
+    std::vector<int64_t> raw;
+
+    // 分量[-2^15, 2^15]
+    GenerateRaw(raw, sampleCount * 3, (int64_t)1 << (15 + Fix64::fractionBits), rng);
+
+    // 1M个向量受内存带宽限制，计时用能放进L2的4096个向量重复计算
+    const int residentCount = 4096;
+    const int repeat = sampleCount / residentCount;
+
+    std::vector<FVector3> vectors;
+    std::vector<FQuaternion> rotations;
+    FVector3Array soa(residentCount);
+    vectors.reserve(residentCount);
+    rotations.reserve(residentCount);
+    for (int i = 0; i < residentCount; ++i)
+    {
+        const int64_t* r = &raw[i * 3];
+        vectors.push_back(FVector3(Fix64::FromRawValue(r[0]), Fix64::FromRawValue(r[1]), Fix64::FromRawValue(r[2])));
+        soa.Set(i, vectors[i]);
+
+        Fix64 angle = Fix64::FromRawValue((int64_t)(rng() % (6 * Fix64::fractionFactor)));
+        FVector3 axis = FVector3(Fix64::FromRawValue((int64_t)(rng() % Fix64::fractionFactor) + 1),
+                                 Fix64::FromRawValue((int64_t)(rng() % Fix64::fractionFactor)),
+                                 Fix64::FromRawValue((int64_t)(rng() % Fix64::fractionFactor)));
+        rotations.push_back(FQuaternion::AngleAxis(angle, axis));
+    }
+    const FQuaternion q = rotations[0];
+
+    FVector3Array::Kernel defaultKernel = FVector3Array::GetKernel();
+    std::vector<FVector3> out(vectors);
+    FVector3Array soaOut;
+    int64_t acc = 0;
+
+    std::cout << "FQuaternion Rotate, vector_count = " << residentCount << " x " << repeat
+              << ", avx2 = " << (FVector3Array::Avx2Supported() ? "yes" : "no") << std::endl;
+
+    BenchTimer productTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        for (int i = 0; i < residentCount; ++i)
+        {
+            FQuaternion t = q * FQuaternion(vectors[i].x, vectors[i].y, vectors[i].z, Fix64::Zero) * q.Conjugate();
+            out[i] = FVector3(t.x, t.y, t.z);
+        }
+        acc += out[r % residentCount].x.rawValue;
+    }
+    int64_t productTime = productTimer.ElapsedMicroseconds();
+
+    BenchTimer rotateTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        for (int i = 0; i < residentCount; ++i)
+        {
+            out[i] = q.Rotate(vectors[i]);
+        }
+        acc += out[r % residentCount].x.rawValue;
+    }
+    int64_t rotateTime = rotateTimer.ElapsedMicroseconds();
+
+    std::cout << "  q * v * q^-1 loop elapsedTime = " << productTime << "us"
+              << "  Rotate loop elapsedTime = " << rotateTime << "us" << std::endl;
+
+    auto timeKernel = [&](FVector3Array::Kernel kernel, const char* name)
+    {
+        FVector3Array::SetKernel(kernel);
+        int mismatch = CheckFQuaternionRotate(q, rotations, vectors, soa);
+
+        BenchTimer aosTimer;
+        for (int r = 0; r < repeat; ++r)
+        {
+            q.Rotate(vectors.data(), out.data(), residentCount);
+            acc += out[r % residentCount].x.rawValue;
+        }
+        int64_t aosTime = aosTimer.ElapsedMicroseconds();
+
+        BenchTimer soaTimer;
+        for (int r = 0; r < repeat; ++r)
+        {
+            q.Rotate(soa, soaOut);
+            acc += soaOut.X()[r % residentCount];
+        }
+        int64_t soaTime = soaTimer.ElapsedMicroseconds();
+
+        BenchTimer perElementTimer;
+        for (int r = 0; r < repeat; ++r)
+        {
+            FQuaternion::Rotate(rotations.data(), vectors.data(), out.data(), residentCount);
+            acc += out[r % residentCount].x.rawValue;
+        }
+        int64_t perElementTime = perElementTimer.ElapsedMicroseconds();
+
+        std::cout << "  " << name << " Rotate AoS elapsedTime = " << aosTime << "us"
+                  << "  SoA elapsedTime = " << soaTime << "us"
+                  << "  per-element AoS elapsedTime = " << perElementTime << "us"
+                  << "  mismatch = " << mismatch << std::endl;
+    };
+
+    timeKernel(FVector3Array::Kernel::Scalar, "scalar");
+    if (FVector3Array::Avx2Supported())
+    {
+        timeKernel(FVector3Array::Kernel::Avx2, "avx2");
+    }
+    benchSink = acc;
+
+    FVector3Array::SetKernel(defaultKernel);
+}
+
+void FMath::BenchFix64InvSqrt(int sampleCount)
+{
+    std::mt19937_64 rng(benchSeed);
+    std::vector<int64_t> values;
+    std::vector<int64_t> xs, ys, zs;
+
+    // 1/sqrt的输入(0, 2^20]，向量分量[-1024, 1024]
+    GenerateRaw(values, sampleCount, (int64_t)1 << (20 + Fix64::fractionBits), rng);
+    for (int64_t& v : values)
+    {
+        v = Fix64::Abs(v) + 1;
+    }
+    GenerateRaw(xs, sampleCount, (int64_t)1024 << Fix64::fractionBits, rng);
+    GenerateRaw(ys, sampleCount, (int64_t)1024 << Fix64::fractionBits, rng);
+    GenerateRaw(zs, sampleCount, (int64_t)1024 << Fix64::fractionBits, rng);
+
+    std::cout << "Fix64 InvSqrt, sample_count = " << sampleCount << std::endl;
+
+    int64_t acc = 0;
+    BenchTimer divTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        acc += (Fix64::One / Fix64::FromRawValue(values[i]).Sqrt()).rawValue;
+    }
+    int64_t divTime = divTimer.ElapsedMicroseconds();
+
+    BenchTimer invTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        acc += Fix64::InvSqrt(values[i]);
+    }
+    int64_t invTime = invTimer.ElapsedMicroseconds();
+
+    BenchTimer normalizedTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        FVector3 v(Fix64::FromRawValue(xs[i]), Fix64::FromRawValue(ys[i]), Fix64::FromRawValue(zs[i]));
+        acc += v.Normalized().x.rawValue;
+    }
+    int64_t normalizedTime = normalizedTimer.ElapsedMicroseconds();
+
+    BenchTimer fastTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        FVector3 v(Fix64::FromRawValue(xs[i]), Fix64::FromRawValue(ys[i]), Fix64::FromRawValue(zs[i]));
+        acc += v.NormalizedFast().x.rawValue;
+    }
+    int64_t fastTime = fastTimer.ElapsedMicroseconds();
+    benchSink = acc;
+
+    std::cout << "  One / Sqrt elapsedTime = " << divTime << "us"
+              << "  InvSqrt elapsedTime = " << invTime << "us"
+              << "  Normalized elapsedTime = " << normalizedTime << "us"
+              << "  NormalizedFast elapsedTime = " << fastTime << "us" << std::endl;
+
+    UlpError divError, invError, normalizedError, fastError;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        Fix64 value = Fix64::FromRawValue(values[i]);
+        double expected = 1.0 / std::sqrt(value.ToDouble());
+        divError.Add(values[i], (Fix64::One / value.Sqrt()).rawValue, expected);
+        invError.Add(values[i], Fix64::InvSqrt(values[i]), expected);
+
+        FVector3 v(Fix64::FromRawValue(xs[i]), Fix64::FromRawValue(ys[i]), Fix64::FromRawValue(zs[i]));
+        double x = v.x.ToDouble(), y = v.y.ToDouble(), z = v.z.ToDouble();
+        double nx = x / std::sqrt(x * x + y * y + z * z);
+        normalizedError.Add(xs[i], v.Normalized().x.rawValue, nx);
+        fastError.Add(xs[i], v.NormalizedFast().x.rawValue, nx);
+    }
+
+    divError.Print("One / Sqrt    ");
+    invError.Print("InvSqrt       ");
+    normalizedError.Print("Normalized    ");
+    fastError.Print("NormalizedFast");
+}
+
+namespace
+{
+    /// <summary>
+    /// 旧的atan2写法：Atan(y / x)再按象限修正，Q16的除法会丢失比值的有效位.
+    /// </summary>
+    Fix64 Atan2ByDivision(Fix64 y, Fix64 x)
+    {
+        if (x == Fix64::Zero)
+        {
+            return y > Fix64::Zero ? Fix64::PI / 2 : (y < Fix64::Zero ? -Fix64::PI / 2 : Fix64::Zero);
+        }
+
+        Fix64 angle = Fix64::Atan(y / x);
+        if (x < Fix64::Zero)
+        {
+            angle = y < Fix64::Zero ? angle - Fix64::PI : angle + Fix64::PI;
+        }
+
+        return angle;
+    }
+
+    /// <summary>
+    /// 旧的FVector3::Angle：两次开平方和一次除法后求Acos.
+    /// </summary>
+    Fix64 AngleByAcos(const FVector3& from, const FVector3& to)
+    {
+        Fix64 dot = FVector3::Dot(from, to);
+        Fix64 len2 = from.Magnitude() * to.Magnitude();
+
+        return Fix64::Acos(dot / len2);
+    }
+
+    /// <summary>
+    /// 误差直方图：[0, 0.5)、[0.5, 1)、[1, 2)、[2, 4)、[4, 16)、>= 16 ULP.
+    /// </summary>
+    struct UlpHistogram
+    {
+        static const int bucketCount = 6;
+        int buckets[bucketCount] = {};
+
+        void Add(double error)
+        {
+            const double bounds[] = { 0.5, 1, 2, 4, 16 };
+            int i = 0;
+            while (i < bucketCount - 1 && error >= bounds[i])
+            {
+                ++i;
+            }
+            ++buckets[i];
+        }
+
+        void Print(const char* name) const
+        {
+            const char* labels[] = { "<0.5", "<1", "<2", "<4", "<16", ">=16" };
+            std::cout << "  " << name << " ulp histogram:";
+            for (int i = 0; i < bucketCount; ++i)
+            {
+                std::cout << "  " << labels[i] << " = " << buckets[i];
+            }
+            std::cout << std::endl;
+        }
+    };
+}
+
+void FMath::BenchFix64Atan2(int sampleCount)
+{
+    std::mt19937_64 rng(benchSeed);
+    std::vector<int64_t> ys, xs;
+
+    // 分量[-2^15, 2^15]，再随机右移0~23位，覆盖大小悬殊和很小的输入
+    GenerateRaw(ys, sampleCount, (int64_t)1 << (15 + Fix64::fractionBits), rng);
+    GenerateRaw(xs, sampleCount, (int64_t)1 << (15 + Fix64::fractionBits), rng);
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        ys[i] >>= rng() % 24;
+        xs[i] >>= rng() % 24;
+    }
+
+    std::cout << "Fix64 Atan2, sample_count = " << sampleCount << std::endl;
+
+    int64_t acc = 0;
+    BenchTimer atan2Timer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        acc += Fix64::Atan2(Fix64::FromRawValue(ys[i]), Fix64::FromRawValue(xs[i])).rawValue;
+    }
+    int64_t atan2Time = atan2Timer.ElapsedMicroseconds();
+
+    BenchTimer divisionTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        acc += Atan2ByDivision(Fix64::FromRawValue(ys[i]), Fix64::FromRawValue(xs[i])).rawValue;
+    }
+    int64_t divisionTime = divisionTimer.ElapsedMicroseconds();
+
+    double dacc = 0;
+    BenchTimer stdTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        dacc += std::atan2(Fix64::FromRawValue(ys[i]).ToDouble(), Fix64::FromRawValue(xs[i]).ToDouble());
+    }
+    int64_t stdTime = stdTimer.ElapsedMicroseconds();
+
+    std::cout << "  Atan2 elapsedTime = " << atan2Time << "us"
+              << "  Atan(y / x) elapsedTime = " << divisionTime << "us"
+              << "  std::atan2 elapsedTime = " << stdTime << "us" << std::endl;
+
+    UlpHistogram atan2Histogram, divisionHistogram;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        Fix64 y = Fix64::FromRawValue(ys[i]);
+        Fix64 x = Fix64::FromRawValue(xs[i]);
+        double expected = std::atan2(y.ToDouble(), x.ToDouble()) * Fix64::fractionFactor;
+
+        // ±π两侧视为相同
+        auto error = [expected](int64_t rawValue)
+        {
+            double e = std::fabs((double)rawValue - expected);
+            return std::min(e, std::fabs(e - 2 * M_PI * Fix64::fractionFactor));
+        };
+
+        atan2Histogram.Add(error(Fix64::Atan2(y, x).rawValue));
+        divisionHistogram.Add(error(Atan2ByDivision(y, x).rawValue));
+    }
+    atan2Histogram.Print("Atan2     ");
+    divisionHistogram.Print("Atan(y/x) ");
+
+    // FVector3::Angle，单位长度附近的向量
+    const int vectorCount = sampleCount / 3;
+    std::vector<FVector3> vectors;
+    vectors.reserve(vectorCount);
+    for (int i = 0; i < vectorCount; ++i)
+    {
+        vectors.push_back(FVector3(Fix64::FromRawValue(xs[i] >> 12), Fix64::FromRawValue(ys[i] >> 12),
+                                   Fix64::FromRawValue(xs[vectorCount + i] >> 12)));
+    }
+
+    BenchTimer acosTimer;
+    for (int i = 1; i < vectorCount; ++i)
+    {
+        acc += AngleByAcos(vectors[i - 1], vectors[i]).rawValue;
+    }
+    int64_t acosTime = acosTimer.ElapsedMicroseconds();
+
+    BenchTimer angleTimer;
+    for (int i = 1; i < vectorCount; ++i)
+    {
+        acc += FVector3::Angle(vectors[i - 1], vectors[i]).rawValue;
+    }
+    int64_t angleTime = angleTimer.ElapsedMicroseconds();
+    benchSink = acc + (int64_t)dacc;
+
+    UlpError acosError, angleError;
+    for (int i = 1; i < vectorCount; ++i)
+    {
+        const FVector3& a = vectors[i - 1];
+        const FVector3& b = vectors[i];
+        if (a == FVector3::Zero || b == FVector3::Zero)
+        {
+            continue;
+        }
+
+        double ax = a.x.ToDouble(), ay = a.y.ToDouble(), az = a.z.ToDouble();
+        double bx = b.x.ToDouble(), by = b.y.ToDouble(), bz = b.z.ToDouble();
+        double cx = ay * bz - az * by, cy = az * bx - ax * bz, cz = ax * by - ay * bx;
+        double expected = std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz), ax * bx + ay * by + az * bz);
+
+        acosError.Add(a.x.rawValue, AngleByAcos(a, b).rawValue, expected);
+        angleError.Add(a.x.rawValue, FVector3::Angle(a, b).rawValue, expected);
+    }
+
+    std::cout << "  FVector3 Acos(dot / len) elapsedTime = " << acosTime << "us"
+              << "  Angle elapsedTime = " << angleTime << "us" << std::endl;
+    acosError.Print("Acos(dot / len)");
+    angleError.Print("Angle          ");
+}
+
+namespace
+{
+    /// <summary>
+    /// 两个四元数表示的旋转之间的夹角(弧度)，q与-q视为相同.
+    /// </summary>
+    double RotationAngle(const double* a, const double* b)
+    {
+        double d = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+        double sign = d < 0 ? -1 : 1;
+
+        double diff = 0, sum = 0;
+        for (int k = 0; k < 4; ++k)
+        {
+            diff += (a[k] - sign * b[k]) * (a[k] - sign * b[k]);
+            sum += (a[k] + sign * b[k]) * (a[k] + sign * b[k]);
+        }
+
+        return 4 * std::atan2(std::sqrt(diff), std::sqrt(sum));
+    }
+
+    /// <summary>
+    /// Interpolate(mode)的结果与double球面插值相比的最大角度误差，t取0.25、0.5、0.75.
+    /// </summary>
+    double SlerpMaxError(const std::vector<FQuaternion>& a, const std::vector<FQuaternion>& b,
+                         FQuaternion::Interpolation mode)
+    {
+        const size_t n = a.size();
+        std::vector<FQuaternion> out(n);
+        double maxError = 0;
+
+        for (int step = 1; step <= 3; ++step)
+        {
+            double t = step * 0.25;
+            FQuaternion::Interpolate(a.data(), b.data(), Fix64(t), out.data(), n, mode);
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                double qa[] = { a[i].w.ToDouble(), a[i].x.ToDouble(), a[i].y.ToDouble(), a[i].z.ToDouble() };
+                double qb[] = { b[i].w.ToDouble(), b[i].x.ToDouble(), b[i].y.ToDouble(), b[i].z.ToDouble() };
+                double qo[] = { out[i].w.ToDouble(), out[i].x.ToDouble(), out[i].y.ToDouble(), out[i].z.ToDouble() };
+
+                double d = qa[0] * qb[0] + qa[1] * qb[1] + qa[2] * qb[2] + qa[3] * qb[3];
+                double sign = d < 0 ? -1 : 1;
+                double theta = std::acos(std::min(1.0, std::fabs(d)));
+                double s = std::sin(theta);
+
+                double expected[4];
+                for (int k = 0; k < 4; ++k)
+                {
+                    expected[k] = s == 0 ? qa[k] : (std::sin((1 - t) * theta) * qa[k] + std::sin(t * theta) * sign * qb[k]) / s;
+                }
+
+                maxError = std::max(maxError, RotationAngle(qo, expected));
+            }
+        }
+
+        return maxError;
+    }
+}
+
+void FMath::BenchFQuaternionSlerp(int sampleCount)
+{
+    std::mt19937_64 rng(benchSeed);
+
+    // 计时用能放进L2的4096对四元数重复计算
+    const int residentCount = 4096;
+    const int repeat = sampleCount / residentCount;
+
+    // 随机单位四元数，一半取反以覆盖最短路径的分支
+    auto randomRotation = [&rng]()
+    {
+        Fix64 angle = Fix64::FromRawValue((int64_t)(rng() % (7 * Fix64::fractionFactor)));
+        FVector3 axis = FVector3(Fix64::FromRawValue((int64_t)(rng() % Fix64::fractionFactor) + 1),
+                                 Fix64::FromRawValue((int64_t)(rng() % (2 * Fix64::fractionFactor)) - Fix64::fractionFactor),
+                                 Fix64::FromRawValue((int64_t)(rng() % (2 * Fix64::fractionFactor)) - Fix64::fractionFactor));
+        FQuaternion q = FQuaternion::AngleAxis(angle, axis).NormalizedFast();
+
+        return rng() % 2 ? -q : q;
+    };
+
+    std::vector<FQuaternion> from, to;
+    from.reserve(residentCount);
+    to.reserve(residentCount);
+    for (int i = 0; i < residentCount; ++i)
+    {
+        from.push_back(randomRotation());
+        to.push_back(randomRotation());
+    }
+
+    std::vector<FQuaternion> out(residentCount);
+    int64_t acc = 0;
+
+    std::cout << "FQuaternion Slerp, pair_count = " << residentCount << " x " << repeat << std::endl;
+
+    auto timeMode = [&](FQuaternion::Interpolation mode, const char* name)
+    {
+        BenchTimer timer;
+        for (int r = 0; r < repeat; ++r)
+        {
+            Fix64 t = Fix64::FromRawValue((r % 64 + 1) * Fix64::fractionFactor / 65);
+            FQuaternion::Interpolate(from.data(), to.data(), t, out.data(), residentCount, mode);
+            acc += out[r % residentCount].w.rawValue;
+        }
+        int64_t elapsed = timer.ElapsedMicroseconds();
+
+        std::cout << "  " << name << " elapsedTime = " << elapsed << "us"
+                  << "  max angle error = " << SlerpMaxError(from, to, mode) << "rad" << std::endl;
+    };
+
+    timeMode(FQuaternion::Interpolation::Nlerp, "Nlerp    ");
+    timeMode(FQuaternion::Interpolation::SlerpFast, "SlerpFast");
+    timeMode(FQuaternion::Interpolation::Slerp, "Slerp    ");
+    benchSink = acc;
+}
+
+void FMath::BenchFMatrix4TRS(int sampleCount)
+{
+    std::mt19937_64 rng(benchSeed);
+
+    // 一套骨骼的局部姿态，重复转换
+    const int residentCount = 4096;
+    const int repeat = sampleCount / residentCount;
+
+    auto randomUnit = [&rng]()
+    {
+        return Fix64::FromRawValue((int64_t)(rng() % (2 * Fix64::fractionFactor)) - Fix64::fractionFactor);
+    };
+
+    std::vector<FVector3> positions, scales, axes;
+    std::vector<Fix64> angles;
+    std::vector<FQuaternion> rotations;
+    for (int i = 0; i < residentCount; ++i)
+    {
+        positions.push_back(FVector3(randomUnit() * 8, randomUnit() * 8, randomUnit() * 8));
+        scales.push_back(FVector3(randomUnit() / 2 + Fix64::One, randomUnit() / 2 + Fix64::One, randomUnit() / 2 + Fix64::One));
+        axes.push_back(FVector3(randomUnit() + Fix64::One + Fix64::One, randomUnit(), randomUnit()).Normalized());
+        angles.push_back(randomUnit() * 3);
+        rotations.push_back(FQuaternion::AngleAxis(angles[i], axes[i]));
+    }
+
+    std::vector<FMatrix4> matrices(residentCount);
+    std::vector<FMatrix3x4> affines(residentCount);
+    std::vector<FQuaternion> quaternions(residentCount);
+    std::vector<FVector3> eulers(positions);
+    int64_t acc = 0;
+
+    std::cout << "FMatrix4 TRS, pose_count = " << residentCount << " x " << repeat << std::endl;
+
+    BenchTimer axisTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        for (int i = 0; i < residentCount; ++i)
+        {
+            matrices[i] = FMatrix4::Scale(scales[i]) * FMatrix4::RotateAxis(angles[i], axes[i]) * FMatrix4::Translate(positions[i]);
+        }
+        acc += matrices[r % residentCount].m00.rawValue;
+    }
+    int64_t axisTime = axisTimer.ElapsedMicroseconds();
+
+    BenchTimer trs4Timer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        FMatrix4::TRS(positions.data(), rotations.data(), scales.data(), matrices.data(), residentCount);
+        acc += matrices[r % residentCount].m00.rawValue;
+    }
+    int64_t trs4Time = trs4Timer.ElapsedMicroseconds();
+
+    BenchTimer trs3x4Timer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        FMatrix3x4::TRS(positions.data(), rotations.data(), scales.data(), affines.data(), residentCount);
+        acc += affines[r % residentCount].m00.rawValue;
+    }
+    int64_t trs3x4Time = trs3x4Timer.ElapsedMicroseconds();
+
+    std::cout << "  Scale * RotateAxis * Translate elapsedTime = " << axisTime << "us"
+              << "  FMatrix4::TRS elapsedTime = " << trs4Time << "us"
+              << "  FMatrix3x4::TRS elapsedTime = " << trs3x4Time << "us" << std::endl;
+
+    // 往返转换用不带缩放的旋转矩阵
+    for (int i = 0; i < residentCount; ++i)
+    {
+        affines[i] = FMatrix3x4::FromQuaternion(rotations[i]);
+    }
+
+    BenchTimer fromMatrixTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        FQuaternion::FromMatrix(affines.data(), quaternions.data(), residentCount);
+        acc += quaternions[r % residentCount].w.rawValue;
+    }
+    int64_t fromMatrixTime = fromMatrixTimer.ElapsedMicroseconds();
+
+    BenchTimer toEulerTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        FQuaternion::ToEuler(rotations.data(), eulers.data(), residentCount);
+        acc += eulers[r % residentCount].x.rawValue;
+    }
+    int64_t toEulerTime = toEulerTimer.ElapsedMicroseconds();
+
+    BenchTimer fromEulerTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        FQuaternion::FromEuler(eulers.data(), quaternions.data(), residentCount);
+        acc += quaternions[r % residentCount].w.rawValue;
+    }
+    int64_t fromEulerTime = fromEulerTimer.ElapsedMicroseconds();
+    benchSink = acc;
+
+    // 四元数分量的最大误差，q与-q视为相同
+    auto maxError = [&](const std::vector<FQuaternion>& result)
+    {
+        int64_t error = 0;
+        for (int i = 0; i < residentCount; ++i)
+        {
+            const FQuaternion& q = rotations[i];
+            FQuaternion p = FQuaternion::Dot(q, result[i]) < Fix64::Zero ? -result[i] : result[i];
+            error = std::max({ error, Fix64::Abs(p.w.rawValue - q.w.rawValue), Fix64::Abs(p.x.rawValue - q.x.rawValue),
+                               Fix64::Abs(p.y.rawValue - q.y.rawValue), Fix64::Abs(p.z.rawValue - q.z.rawValue) });
+        }
+        return error;
+    };
+
+    FQuaternion::FromMatrix(affines.data(), quaternions.data(), residentCount);
+    int64_t matrixError = maxError(quaternions);
+    FQuaternion::FromEuler(eulers.data(), quaternions.data(), residentCount);
+    int64_t eulerError = maxError(quaternions);
+
+    std::cout << "  FromMatrix elapsedTime = " << fromMatrixTime << "us"
+              << "  ToEuler elapsedTime = " << toEulerTime << "us"
+              << "  FromEuler elapsedTime = " << fromEulerTime << "us" << std::endl;
+    std::cout << "  round trip max error: matrix = " << matrixError << " ULP"
+              << "  euler = " << eulerError << " ULP" << std::endl;
+}
+
+namespace
+{
+    /// <summary>
+    /// 相对误差统计：|result - expected| / expected，只统计expected >= 1的样本.
+    /// 指数函数的结果可以很大，ULP不能反映精度，与Epsilon相比很小的结果仍用UlpError统计.
+    /// </summary>
+    struct RelativeError
+    {
+        double maxError = 0;
+        double sumError = 0;
+        int64_t worstInput = 0;
+        int count = 0;
+
+        void Add(int64_t input, int64_t rawValue, double expected)
+        {
+            if (expected < 1)
+            {
+                return;
+            }
+
+            double error = std::fabs((double)rawValue / Fix64::fractionFactor - expected) / expected;
+            if (error > maxError)
+            {
+                maxError = error;
+                worstInput = input;
+            }
+            sumError += error;
+            ++count;
+        }
+
+        void Print(const char* name) const
+        {
+            std::cout << "  " << name << "  max_rel = " << maxError
+                      << "  mean_rel = " << (count > 0 ? sumError / count : 0)
+                      << "  worst_input = " << Fix64::FromRawValue(worstInput).ToString() << std::endl;
+        }
+    };
+
+    /// <summary>
+    /// 逐个调用、批量调用、转double调用std函数的耗时.
+    /// </summary>
+    template<typename FixFunc, typename BatchFunc, typename StdFunc>
+    void BenchUnary(const char* name, const std::vector<int64_t>& inputs,
+                    FixFunc fixFunc, BatchFunc batchFunc, StdFunc stdFunc)
+    {
+        const size_t count = inputs.size();
+        std::vector<Fix64> in(count), out(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            in[i] = Fix64::FromRawValue(inputs[i]);
+        }
+
+        int64_t acc = 0;
+        BenchTimer fixTimer;
+        for (size_t i = 0; i < count; ++i)
+        {
+            acc += fixFunc(in[i]).rawValue;
+        }
+        int64_t fixTime = fixTimer.ElapsedMicroseconds();
+
+        BenchTimer batchTimer;
+        batchFunc(in.data(), out.data(), count);
+        int64_t batchTime = batchTimer.ElapsedMicroseconds();
+
+        int mismatchCount = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (out[i] != fixFunc(in[i]))
+            {
+                ++mismatchCount;
+            }
+        }
+
+        double dacc = 0;
+        BenchTimer stdTimer;
+        for (size_t i = 0; i < count; ++i)
+        {
+            dacc += stdFunc(in[i].ToDouble());
+        }
+        int64_t stdTime = stdTimer.ElapsedMicroseconds();
+        benchSink = acc + (int64_t)dacc + out[count / 2].rawValue;
+
+        std::cout << "  " << name << " elapsedTime = " << fixTime << "us"
+                  << "  batch elapsedTime = " << batchTime << "us"
+                  << "  std elapsedTime = " << stdTime << "us"
+                  << "  batch_mismatch = " << mismatchCount << std::endl;
+    }
+}
+
+void FMath::BenchFix64Exp(int sampleCount)
+{
+    std::mt19937_64 rng(benchSeed);
+    std::vector<int64_t> expInputs, exp2Inputs, logInputs, bases, exponents;
+
+    // Exp：[-12, 22]，Exp2：[-17, 31]，覆盖从下溢为0到接近MaxValue
+    GenerateRaw(expInputs, sampleCount, (int64_t)17 << Fix64::fractionBits, rng);
+    GenerateRaw(exp2Inputs, sampleCount, (int64_t)24 << Fix64::fractionBits, rng);
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        expInputs[i] += (int64_t)5 << Fix64::fractionBits;
+        exp2Inputs[i] += (int64_t)7 << Fix64::fractionBits;
+    }
+
+    // Log：[Epsilon, 2^31)，随机右移让每个数量级的样本数相近
+    logInputs.resize(sampleCount);
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        logInputs[i] = std::max<int64_t>(1, (int64_t)(rng() >> (17 + rng() % 47)));
+    }
+
+    // Pow：底数(0, 16]，指数[-4, 4]
+    GenerateRaw(bases, sampleCount, (int64_t)8 << Fix64::fractionBits, rng);
+    GenerateRaw(exponents, sampleCount, (int64_t)4 << Fix64::fractionBits, rng);
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        bases[i] += ((int64_t)8 << Fix64::fractionBits) + 1;
+    }
+
+    std::cout << "Fix64 Exp/Log/Pow, sample_count = " << sampleCount
+              << ", lut_bits = " << FIX64_EXP_LUT_BITS << std::endl;
+
+    BenchUnary("Exp ", expInputs, [](Fix64 x) { return Fix64::Exp(x); },
+               [](const Fix64* in, Fix64* out, size_t count) { Fix64::Exp(in, out, count); },
+               [](double x) { return std::exp(x); });
+    BenchUnary("Exp2", exp2Inputs, [](Fix64 x) { return Fix64::Exp2(x); },
+               [](const Fix64* in, Fix64* out, size_t count) { Fix64::Exp2(in, out, count); },
+               [](double x) { return std::exp2(x); });
+    BenchUnary("Log ", logInputs, [](Fix64 x) { return Fix64::Log(x); },
+               [](const Fix64* in, Fix64* out, size_t count) { Fix64::Log(in, out, count); },
+               [](double x) { return std::log(x); });
+    BenchUnary("Log2", logInputs, [](Fix64 x) { return Fix64::Log2(x); },
+               [](const Fix64* in, Fix64* out, size_t count) { Fix64::Log2(in, out, count); },
+               [](double x) { return std::log2(x); });
+
+    int64_t acc = 0;
+    BenchTimer powTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        acc += Fix64::Pow(Fix64::FromRawValue(bases[i]), Fix64::FromRawValue(exponents[i])).rawValue;
+    }
+    int64_t powTime = powTimer.ElapsedMicroseconds();
+
+    double dacc = 0;
+    BenchTimer stdPowTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        dacc += std::pow(Fix64::FromRawValue(bases[i]).ToDouble(), Fix64::FromRawValue(exponents[i]).ToDouble());
+    }
+    int64_t stdPowTime = stdPowTimer.ElapsedMicroseconds();
+    benchSink = acc + (int64_t)dacc;
+
+    std::cout << "  Pow  elapsedTime = " << powTime << "us"
+              << "  std elapsedTime = " << stdPowTime << "us" << std::endl;
+
+    // 结果小于1时按ULP统计，大于等于1时按相对误差统计
+    const double maxResult = Fix64::MaxValue.ToDouble();
+    UlpError expUlp, exp2Ulp, powUlp, logError, log2Error;
+    RelativeError expRel, exp2Rel, powRel;
+    UlpHistogram logHistogram;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        Fix64 x = Fix64::FromRawValue(expInputs[i]);
+        double expected = std::exp(x.ToDouble());
+        if (expected < maxResult)
+        {
+            int64_t rawValue = Fix64::Exp(x).rawValue;
+            if (expected < 1)
+            {
+                expUlp.Add(x.rawValue, rawValue, expected);
+            }
+            else
+            {
+                expRel.Add(x.rawValue, rawValue, expected);
+            }
+        }
+
+        x = Fix64::FromRawValue(exp2Inputs[i]);
+        expected = std::exp2(x.ToDouble());
+        if (expected < maxResult)
+        {
+            int64_t rawValue = Fix64::Exp2(x).rawValue;
+            if (expected < 1)
+            {
+                exp2Ulp.Add(x.rawValue, rawValue, expected);
+            }
+            else
+            {
+                exp2Rel.Add(x.rawValue, rawValue, expected);
+            }
+        }
+
+        x = Fix64::FromRawValue(logInputs[i]);
+        logError.Add(x.rawValue, Fix64::Log(x).rawValue, std::log(x.ToDouble()));
+        log2Error.Add(x.rawValue, Fix64::Log2(x).rawValue, std::log2(x.ToDouble()));
+        logHistogram.Add(std::fabs((double)Fix64::Log(x).rawValue - std::log(x.ToDouble()) * Fix64::fractionFactor));
+
+        Fix64 base = Fix64::FromRawValue(bases[i]);
+        Fix64 exponent = Fix64::FromRawValue(exponents[i]);
+        expected = std::pow(base.ToDouble(), exponent.ToDouble());
+        if (expected < maxResult)
+        {
+            int64_t rawValue = Fix64::Pow(base, exponent).rawValue;
+            if (expected < 1)
+            {
+                powUlp.Add(base.rawValue, rawValue, expected);
+            }
+            else
+            {
+                powRel.Add(base.rawValue, rawValue, expected);
+            }
+        }
+    }
+
+    expUlp.Print("Exp  (< 1) ");
+    expRel.Print("Exp  (>= 1)");
+    exp2Ulp.Print("Exp2 (< 1) ");
+    exp2Rel.Print("Exp2 (>= 1)");
+    powUlp.Print("Pow  (< 1) ");
+    powRel.Print("Pow  (>= 1)");
+    logError.Print("Log        ");
+    log2Error.Print("Log2       ");
+    logHistogram.Print("Log        ");
+}
+
+void FMath::BenchFix64Trig(int sampleCount)
+{
+    std::mt19937_64 rng(benchSeed);
+    std::vector<int64_t> angles;
+    std::vector<int64_t> ratios;
+
+    // 角度[-4π, 4π]，反三角函数的输入[-1, 1]
+    GenerateRaw(angles, sampleCount, Fix64::PI.rawValue * 4, rng);
+    GenerateRaw(ratios, sampleCount, Fix64::fractionFactor, rng);
+
+    std::cout << "Fix64 Trig, sample_count = " << sampleCount
+              << ", lut_bits = " << FIX64_TRIG_LUT_BITS << std::endl;
+
+    int64_t acc = 0;
+    BenchTimer sinTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        acc += Fix64::Sin(Fix64::FromRawValue(angles[i])).rawValue;
+    }
+    int64_t sinTime = sinTimer.ElapsedMicroseconds();
+
+    BenchTimer cosTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        acc += Fix64::Cos(Fix64::FromRawValue(angles[i])).rawValue;
+    }
+    int64_t cosTime = cosTimer.ElapsedMicroseconds();
+
+    double dacc = 0;
+    BenchTimer stdSinTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        dacc += std::sin(Fix64::FromRawValue(angles[i]).ToDouble());
+    }
+    int64_t stdSinTime = stdSinTimer.ElapsedMicroseconds();
+
+    BenchTimer asinTimer;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        acc += Fix64::Asin(Fix64::FromRawValue(ratios[i])).rawValue;
+    }
+    int64_t asinTime = asinTimer.ElapsedMicroseconds();
+    benchSink = acc + (int64_t)dacc;
+
+    std::cout << "  Sin elapsedTime = " << sinTime << "us"
+              << "  Cos elapsedTime = " << cosTime << "us"
+              << "  std::sin elapsedTime = " << stdSinTime << "us"
+              << "  Asin elapsedTime = " << asinTime << "us" << std::endl;
+
+    UlpError sinError, cosError, tanError, asinError, acosError, atanError;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        Fix64 angle = Fix64::FromRawValue(angles[i]);
+        double x = angle.ToDouble();
+        sinError.Add(angles[i], Fix64::Sin(angle).rawValue, std::sin(x));
+        cosError.Add(angles[i], Fix64::Cos(angle).rawValue, std::cos(x));
+
+        // 只统计|tan| <= 8的区间，靠近π/2时定点数本身已无法表达
+        if (std::fabs(std::tan(x)) <= 8)
+        {
+            tanError.Add(angles[i], Fix64::Tan(angle).rawValue, std::tan(x));
+        }
+
+        Fix64 ratio = Fix64::FromRawValue(ratios[i]);
+        double r = ratio.ToDouble();
+        asinError.Add(ratios[i], Fix64::Asin(ratio).rawValue, std::asin(r));
+        acosError.Add(ratios[i], Fix64::Acos(ratio).rawValue, std::acos(r));
+
+        // atan的输入放大到[-8, 8]
+        Fix64 t = ratio * 8;
+        atanError.Add(t.rawValue, Fix64::Atan(t).rawValue, std::atan(t.ToDouble()));
+    }
+
+    sinError.Print("Sin ");
+    cosError.Print("Cos ");
+    tanError.Print("Tan ");
+    asinError.Print("Asin");
+    acosError.Print("Acos");
+    atanError.Print("Atan");
+}
+
+namespace
+{
+    /// <summary>
+    /// 编译期生成2^Bits段的正弦表，测试查表耗时和误差.
+    /// </summary>
+    template<int Bits>
+    void BenchSinLutBits(const std::vector<int64_t>& randomPhases, const std::vector<int64_t>& sequentialPhases)
+    {
+        static constexpr FixedLut<int32_t, Bits, 30> lut = MakeSinLut<int32_t, Bits, 30>();
+
+        const int64_t phaseQuarter = (int64_t)1 << 30;
+        const int sampleCount = (int)randomPhases.size();
+
+        // Q30 -> rawValue
+        auto lookup = [](int64_t quarter) { return (lut.Lerp(quarter) + (1 << 13)) >> 14; };
+
+        int64_t acc = 0;
+        BenchTimer randomTimer;
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            acc += lookup(randomPhases[i]);
+        }
+        int64_t randomTime = randomTimer.ElapsedMicroseconds();
+
+        BenchTimer sequentialTimer;
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            acc += lookup(sequentialPhases[i]);
+        }
+        int64_t sequentialTime = sequentialTimer.ElapsedMicroseconds();
+
+        // 下一次查表的输入依赖上一次的结果
+        int64_t phase = 0;
+        BenchTimer latencyTimer;
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            phase = (phase * 2654435761LL + lookup(phase)) & (phaseQuarter - 1);
+        }
+        int64_t latencyTime = latencyTimer.ElapsedMicroseconds();
+        benchSink = acc + phase;
+
+        std::cout << "  bits = " << Bits << "  size = " << sizeof(lut.values) << " bytes"
+                  << "  random elapsedTime = " << randomTime << "us"
+                  << "  sequential elapsedTime = " << sequentialTime << "us"
+                  << "  latency elapsedTime = " << latencyTime << "us" << std::endl;
+
+        // 在[0, π/2]上均匀取样，与double参考值对比
+        const double halfPi = 1.5707963267948966;
+        UlpError error;
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            int64_t quarter = sequentialPhases[i];
+            double angle = halfPi * quarter / phaseQuarter;
+            error.Add(Fix64(angle).rawValue, lookup(quarter), std::sin(angle));
+        }
+        error.Print("       ");
+    }
+}
+
+void FMath::BenchFix64SinLut(int sampleCount)
+{
+    const int64_t phaseQuarter = (int64_t)1 << 30;
+
+    std::mt19937_64 rng(benchSeed);
+    std::uniform_int_distribution<int64_t> dist(0, phaseQuarter);
+    std::vector<int64_t> randomPhases(sampleCount);
+    std::vector<int64_t> sequentialPhases(sampleCount);
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        randomPhases[i] = dist(rng);
+        sequentialPhases[i] = phaseQuarter * i / sampleCount;
+    }
+
+    std::cout << "Fix64 SinLut, sample_count = " << sampleCount << std::endl;
+
+    BenchSinLutBits<8>(randomPhases, sequentialPhases);
+    BenchSinLutBits<10>(randomPhases, sequentialPhases);
+    BenchSinLutBits<12>(randomPhases, sequentialPhases);
+    BenchSinLutBits<14>(randomPhases, sequentialPhases);
+}
+
+namespace
+{
+    /// 旧的转换：拆分整数和小数部分(有符号除法和取模)，构造时向0截断
+    float LegacyToSingle(Fix64 x)
+    {
+        return x.integer() + x.fraction() / (float)Fix64::fractionFactor;
+    }
+
+    Fix64 LegacyFromSingle(float value)
+    {
+        return Fix64::FromRawValue((int64_t)(value * Fix64::fractionFactor));
+    }
+}
+
+void FMath::BenchFix64Conversion(int sampleCount)
+{
+    std::mt19937_64 rng(benchSeed);
+    std::vector<int64_t> raw;
+
+    // 渲染用的坐标：分量[-2^14, 2^14]
+    GenerateRaw(raw, sampleCount * 3, (int64_t)1 << (14 + Fix64::fractionBits), rng);
+
+    std::vector<FVector3> positions;
+    positions.reserve(sampleCount);
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        positions.push_back(FVector3(Fix64::FromRawValue(raw[i * 3]), Fix64::FromRawValue(raw[i * 3 + 1]), Fix64::FromRawValue(raw[i * 3 + 2])));
+    }
+
+    const size_t floatCount = (size_t)sampleCount * 3;
+    std::vector<float> floats(floatCount), batchFloats(floatCount);
+    std::vector<FVector3> back(sampleCount, FVector3::Zero), batchBack(sampleCount, FVector3::Zero);
+    for (size_t i = 0; i < floatCount; ++i)
+    {
+        floats[i] = Fix64::FromRawValue(raw[i]).ToSingle();
+    }
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        back[i] = FVector3(Fix64(floats[i * 3]), Fix64(floats[i * 3 + 1]), Fix64(floats[i * 3 + 2]));
+    }
+
+    // 新旧实现的差别：ToSingle的结果不同(旧实现两次舍入)、构造的结果不同(截断/四舍五入)的个数
+    int toChanged = 0, fromChanged = 0;
+    for (size_t i = 0; i < floatCount; ++i)
+    {
+        Fix64 x = Fix64::FromRawValue(raw[i]);
+        toChanged += LegacyToSingle(x) != floats[i] ? 1 : 0;
+        fromChanged += LegacyFromSingle(floats[i] + 1e-3f).rawValue != Fix64(floats[i] + 1e-3f).rawValue ? 1 : 0;
+    }
+
+    FVector3Array::Kernel defaultKernel = FVector3Array::GetKernel();
+
+    std::cout << "Fix64 float conversion, FVector3 count = " << sampleCount
+              << ", avx2 = " << (FVector3Array::Avx2Supported() ? "yes" : "no")
+              << ", ToSingle changed = " << toChanged << ", FromSingle changed = " << fromChanged << std::endl;
+
+    // 整个数组受内存带宽限制，用能放进L1/L2的前residentCount个向量重复计算，体现转换本身的差别
+    const int residentCount = 4096;
+    const int repeat = sampleCount / residentCount;
+    const int residentFloats = residentCount * 3;
+    float facc = 0;
+    int64_t acc = 0;
+
+    BenchTimer legacyToTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        for (int i = 0; i < residentFloats; ++i)
+        {
+            batchFloats[i] = LegacyToSingle(Fix64::FromRawValue(raw[i]));
+        }
+        facc += batchFloats[r % residentFloats];
+    }
+    int64_t legacyToTime = legacyToTimer.ElapsedMicroseconds();
+
+    BenchTimer toTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        for (int i = 0; i < residentFloats; ++i)
+        {
+            batchFloats[i] = Fix64::FromRawValue(raw[i]).ToSingle();
+        }
+        facc += batchFloats[r % residentFloats];
+    }
+    int64_t toTime = toTimer.ElapsedMicroseconds();
+
+    BenchTimer legacyFromTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        for (int i = 0; i < residentCount; ++i)
+        {
+            batchBack[i] = FVector3(LegacyFromSingle(floats[i * 3]), LegacyFromSingle(floats[i * 3 + 1]), LegacyFromSingle(floats[i * 3 + 2]));
+        }
+        acc += batchBack[r % residentCount].x.rawValue;
+    }
+    int64_t legacyFromTime = legacyFromTimer.ElapsedMicroseconds();
+
+    BenchTimer fromTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        for (int i = 0; i < residentCount; ++i)
+        {
+            batchBack[i] = FVector3(Fix64(floats[i * 3]), Fix64(floats[i * 3 + 1]), Fix64(floats[i * 3 + 2]));
+        }
+        acc += batchBack[r % residentCount].x.rawValue;
+    }
+    int64_t fromTime = fromTimer.ElapsedMicroseconds();
+
+    std::cout << "  ToSingle legacy elapsedTime = " << legacyToTime << "us"
+              << "  multiply elapsedTime = " << toTime << "us"
+              << "  FromSingle legacy(truncate) elapsedTime = " << legacyFromTime << "us"
+              << "  round elapsedTime = " << fromTime << "us" << std::endl;
+
+    auto timeKernel = [&](FVector3Array::Kernel kernel, const char* name)
+    {
+        FVector3Array::SetKernel(kernel);
+
+        FVector3::ToFloatArray(positions.data(), batchFloats.data(), sampleCount);
+        FVector3::FromFloatArray(floats.data(), batchBack.data(), sampleCount);
+        int mismatchCount = 0;
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            if (batchBack[i] != back[i] || batchFloats[i * 3] != floats[i * 3]
+                || batchFloats[i * 3 + 1] != floats[i * 3 + 1] || batchFloats[i * 3 + 2] != floats[i * 3 + 2])
+            {
+                ++mismatchCount;
+            }
+        }
+
+        BenchTimer toBatchTimer;
+        for (int r = 0; r < repeat; ++r)
+        {
+            FVector3::ToFloatArray(positions.data(), batchFloats.data(), residentCount);
+            facc += batchFloats[r % residentFloats];
+        }
+        int64_t toBatchTime = toBatchTimer.ElapsedMicroseconds();
+
+        BenchTimer fromBatchTimer;
+        for (int r = 0; r < repeat; ++r)
+        {
+            FVector3::FromFloatArray(floats.data(), batchBack.data(), residentCount);
+            acc += batchBack[r % residentCount].x.rawValue;
+        }
+        int64_t fromBatchTime = fromBatchTimer.ElapsedMicroseconds();
+
+        std::cout << "  " << name << " ToFloatArray elapsedTime = " << toBatchTime << "us"
+                  << "  FromFloatArray elapsedTime = " << fromBatchTime << "us"
+                  << "  mismatch = " << mismatchCount << std::endl;
+    };
+
+    timeKernel(FVector3Array::Kernel::Scalar, "scalar");
+    if (FVector3Array::Avx2Supported())
+    {
+        timeKernel(FVector3Array::Kernel::Avx2, "avx2");
+    }
+    FVector3Array::SetKernel(defaultKernel);
+
+    benchSink = acc + (int64_t)facc;
+}
+
+namespace
+{
+    /// 旧的ToString：to_string(double)固定6位小数，每个分量分配一次再拼接
+    std::string LegacyToString(const FVector3& v)
+    {
+        return std::to_string(v.x.ToDouble()) + "," + std::to_string(v.y.ToDouble()) + "," + std::to_string(v.z.ToDouble());
+    }
+
+    /// 旧的解析方式：strtod后构造
+    const char* LegacyFromString(const char* text, FVector3& value)
+    {
+        char* end;
+        double x = strtod(text, &end);
+        double y = strtod(end + 1, &end);
+        double z = strtod(end + 1, &end);
+        value = FVector3(Fix64(x), Fix64(y), Fix64(z));
+        return end;
+    }
+}
+
+void FMath::BenchFix64Format(int sampleCount)
+{
+    std::mt19937_64 rng(benchSeed);
+    std::vector<int64_t> raw;
+
+    // 场景坐标：分量[-2^14, 2^14]
+    const int residentCount = 4096;
+    GenerateRaw(raw, residentCount * 3, (int64_t)1 << (14 + Fix64::fractionBits), rng);
+
+    std::vector<FVector3> positions;
+    positions.reserve(residentCount);
+    for (int i = 0; i < residentCount; ++i)
+    {
+        positions.push_back(FVector3(Fix64::FromRawValue(raw[i * 3]), Fix64::FromRawValue(raw[i * 3 + 1]), Fix64::FromRawValue(raw[i * 3 + 2])));
+    }
+
+    // 写出再读回后与原值不同的个数
+    std::vector<std::string> legacyText(residentCount);
+    std::vector<FVector3> back(residentCount, FVector3::Zero);
+    int legacyMismatch = 0;
+    size_t legacyBytes = 0;
+    for (int i = 0; i < residentCount; ++i)
+    {
+        legacyText[i] = LegacyToString(positions[i]);
+        legacyBytes += legacyText[i].size();
+        LegacyFromString(legacyText[i].c_str(), back[i]);
+        legacyMismatch += back[i] != positions[i] ? 1 : 0;
+    }
+
+    std::vector<char> text((size_t)residentCount * (3 * Fix64::maxCharsLength + 3));
+    char* textEnd = FVector3::ToChars(positions.data(), residentCount, text.data(), text.data() + text.size());
+    FVector3::FromChars(text.data(), textEnd, back.data(), residentCount);
+    int mismatch = 0;
+    for (int i = 0; i < residentCount; ++i)
+    {
+        mismatch += back[i] != positions[i] ? 1 : 0;
+    }
+
+    std::cout << "Fix64 format, FVector3 count = " << sampleCount
+              << ", bytes per vector legacy = " << legacyBytes / residentCount
+              << ", shortest = " << (textEnd - text.data()) / residentCount
+              << ", round trip mismatch legacy = " << legacyMismatch << ", ToChars = " << mismatch << std::endl;
+
+    const int repeat = sampleCount / residentCount;
+    int64_t acc = 0;
+
+    BenchTimer legacyToTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        for (int i = 0; i < residentCount; ++i)
+        {
+            legacyText[i] = LegacyToString(positions[i]);
+        }
+        acc += (int64_t)legacyText[r % residentCount].size();
+    }
+    int64_t legacyToTime = legacyToTimer.ElapsedMicroseconds();
+
+    BenchTimer toStringTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        for (int i = 0; i < residentCount; ++i)
+        {
+            legacyText[i] = positions[i].ToString();
+        }
+        acc += (int64_t)legacyText[r % residentCount].size();
+    }
+    int64_t toStringTime = toStringTimer.ElapsedMicroseconds();
+
+    BenchTimer toCharsTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        textEnd = FVector3::ToChars(positions.data(), residentCount, text.data(), text.data() + text.size());
+        acc += textEnd - text.data();
+    }
+    int64_t toCharsTime = toCharsTimer.ElapsedMicroseconds();
+
+    BenchTimer legacyFromTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        const char* p = text.data();
+        for (int i = 0; i < residentCount; ++i)
+        {
+            p = LegacyFromString(p, back[i]) + 1;
+        }
+        acc += back[r % residentCount].x.rawValue;
+    }
+    int64_t legacyFromTime = legacyFromTimer.ElapsedMicroseconds();
+
+    BenchTimer fromCharsTimer;
+    for (int r = 0; r < repeat; ++r)
+    {
+        FVector3::FromChars(text.data(), textEnd, back.data(), residentCount);
+        acc += back[r % residentCount].x.rawValue;
+    }
+    int64_t fromCharsTime = fromCharsTimer.ElapsedMicroseconds();
+
+    std::cout << "  format legacy(to_string) elapsedTime = " << legacyToTime << "us"
+              << "  ToString elapsedTime = " << toStringTime << "us"
+              << "  ToChars(bulk) elapsedTime = " << toCharsTime << "us" << std::endl;
+    std::cout << "  parse legacy(strtod) elapsedTime = " << legacyFromTime << "us"
+              << "  FromChars(bulk) elapsedTime = " << fromCharsTime << "us" << std::endl;
+
+    benchSink = acc;
+}
+
+void FMath::RunBenchmarks()
+{
+    BenchFix64Mul(1000000);
+    BenchFix64Sqrt(1000000);
+    BenchFix64Divisor(1000000);
+    BenchFix64Overflow(1000000);
+    BenchFix64InvSqrt(1000000);
+    BenchFixedFormats(1000000);
+    BenchFVector3Array(1000000);
+    BenchFMatrix4Transform(1000000);
+    BenchFMatrix3x4(1000000);
+    BenchFMatrix4Inverse(1000000);
+    BenchTransformChain(1000000);
+    BenchFQuaternionRotate(1000000);
+    BenchFQuaternionSlerp(1000000);
+    BenchFMatrix4TRS(1000000);
+    BenchFix64Trig(1000000);
+    BenchFix64Atan2(1000000);
+    BenchFix64Exp(1000000);
+    BenchFix64SinLut(1000000);
+    BenchFix64Conversion(1000000);
+    BenchFix64Format(1000000);
+}
@@ -0,0 +1,157 @@
+//
+//  FMathBench.h
+//  MathLib
+//
+//  性能测试：对比新旧实现的耗时，并校验结果一致性.
+//
+
+#ifndef FMathBench_h
+#define FMathBench_h
+
+#include <stdint.h>
+
+namespace FMath
+{
+    /// <summary>
+    /// 运行全部性能测试.
+    /// </summary>
+    void RunBenchmarks();
+
+    /// <summary>
+    /// Fix64乘法：MulSplit(旧) vs Mul(新)
+    /// 在多个随机数值区间上对比耗时，并逐位校验结果.
+    /// </summary>
+    /// <param name="sampleCount">每个区间的样本数</param>
+    void BenchFix64Mul(int sampleCount);
+
+    /// <summary>
+    /// Fix64开平方：SqrtNewton(旧) vs Sqrt(新) vs std::sqrt
+    /// 在多个随机数值区间上对比耗时，校验Sqrt是精确的floor(sqrt(x))，并统计与旧实现不同的结果数.
+    /// </summary>
+    /// <param name="sampleCount">每个区间的样本数</param>
+    void BenchFix64Sqrt(int sampleCount);
+
+    /// <summary>
+    /// 除法：operator /(旧) vs Fix64Divisor(新)
+    /// 每个除数分别除1、3、4、16个数，对比耗时(包括构造Fix64Divisor的开销)，并逐位校验结果.
+    /// </summary>
+    /// <param name="sampleCount">除数的个数</param>
+    void BenchFix64Divisor(int sampleCount);
+
+    /// <summary>
+    /// 溢出处理：Fix64(回绕) vs SatFix64(饱和) 的乘加、除法耗时.
+    /// </summary>
+    /// <param name="sampleCount">样本数</param>
+    void BenchFix64Overflow(int sampleCount);
+
+    /// <summary>
+    /// Q格式：Fix64 / Fix32(Q16.16) / Fix64Q32(Q32.32) 数组的乘加耗时和内存占用.
+    /// </summary>
+    /// <param name="sampleCount">数组长度</param>
+    void BenchFixedFormats(int sampleCount);
+
+    /// <summary>
+    /// FVector3Array：逐个调用FVector3::Dot(AoS) vs SoA标量实现 vs SoA AVX2实现的耗时，
+    /// 并逐位校验Add/Sub/Scale/Dot/Cross/SqrMagnitude/Lerp与FVector3的结果.
+    /// </summary>
+    /// <param name="sampleCount">向量个数</param>
+    void BenchFVector3Array(int sampleCount);
+
+    /// <summary>
+    /// FMatrix4批量变换：逐个operator *(FMatrix4, FVector4) vs 逐个MultiplyPoint vs TransformPoints(AoS/SoA，标量/AVX2)的耗时，
+    /// 并逐位校验TransformPoints/TransformDirections/Transform与逐个计算的结果.
+    /// </summary>
+    /// <param name="sampleCount">变换的点数</param>
+    void BenchFMatrix4Transform(int sampleCount);
+
+    /// <summary>
+    /// FMatrix3x4复合 vs FMatrix4复合的耗时，并逐位校验两者的结果.
+    /// </summary>
+    /// <param name="sampleCount">复合次数</param>
+    void BenchFMatrix3x4(int sampleCount);
+
+    /// <summary>
+    /// FMatrix4求逆：一般Inverse(批量) vs InverseAffine vs InverseRigid的耗时，
+    /// 以及 M * M^-1 与单位矩阵的最大误差和不可逆的个数.
+    /// </summary>
+    /// <param name="sampleCount">矩阵个数</param>
+    void BenchFMatrix4Inverse(int sampleCount);
+
+    /// <summary>
+    /// 变换链 m = m * a / q = q * r：按值传参(旧接口) vs const引用 vs 原地 *= 的耗时，并逐位校验三者一致.
+    /// </summary>
+    /// <param name="sampleCount">复合次数</param>
+    void BenchTransformChain(int sampleCount);
+
+    /// <summary>
+    /// 四元数旋转向量：q*v*q^-1(两次四元数乘法) vs Rotate vs 批量Rotate(AoS/SoA，单个/逐个四元数，标量/AVX2)的耗时，
+    /// 并逐位校验批量结果与Rotate一致.
+    /// </summary>
+    /// <param name="sampleCount">旋转的向量数</param>
+    void BenchFQuaternionRotate(int sampleCount);
+
+    /// <summary>
+    /// 批量四元数插值：Nlerp vs Slerp vs SlerpFast的耗时，以及与double球面插值相比的最大角度误差(弧度).
+    /// </summary>
+    /// <param name="sampleCount">插值的四元数对数</param>
+    void BenchFQuaternionSlerp(int sampleCount);
+
+    /// <summary>
+    /// 骨骼姿态转矩阵：Scale * RotateAxis * Translate(旧) vs FMatrix4::TRS vs FMatrix3x4::TRS批量的耗时，
+    /// 以及FromMatrix、FromEuler、ToEuler的耗时，并统计往返转换的最大误差.
+    /// </summary>
+    /// <param name="sampleCount">转换的姿态数</param>
+    void BenchFMatrix4TRS(int sampleCount);
+
+    /// <summary>
+    /// 1/sqrt：One / Sqrt(旧) vs InvSqrt(新)，FVector3::Normalized vs NormalizedFast
+    /// 的耗时，以及与double参考值相比的最大误差(ULP).
+    /// </summary>
+    /// <param name="sampleCount">样本数</param>
+    void BenchFix64InvSqrt(int sampleCount);
+
+    /// <summary>
+    /// 三角函数：查表实现 vs std::sin/std::cos 的耗时，
+    /// 以及与double参考值相比的最大误差(ULP，1 ULP = 1/65536).
+    /// </summary>
+    /// <param name="sampleCount">样本数</param>
+    void BenchFix64Trig(int sampleCount);
+
+    /// <summary>
+    /// Atan2 vs std::atan2 vs Atan(y / x)加象限修正的耗时，以及与std::atan2相比的误差直方图(ULP)；
+    /// FVector3::Angle：Acos(dot / (|a| * |b|))(旧) vs atan2(|a×b|, a·b)的耗时和最大误差.
+    /// </summary>
+    /// <param name="sampleCount">样本数</param>
+    void BenchFix64Atan2(int sampleCount);
+
+    /// <summary>
+    /// Exp/Exp2/Log/Log2/Pow：逐个调用 vs 批量调用 vs 转double调用std函数的耗时，并校验批量结果一致.
+    /// 精度：结果小于1时统计ULP，大于等于1时统计相对误差，Log/Log2统计ULP.
+    /// </summary>
+    /// <param name="sampleCount">样本数</param>
+    void BenchFix64Exp(int sampleCount);
+
+    /// <summary>
+    /// 正弦表：不同分段数(2^bits)的编译期表格.
+    /// 随机访问/顺序访问的耗时差体现缓存未命中的代价，依赖链的耗时体现单次查表的延迟.
+    /// 同时统计每张表与double参考值相比的最大误差(ULP).
+    /// </summary>
+    /// <param name="sampleCount">样本数</param>
+    void BenchFix64SinLut(int sampleCount);
+
+    /// <summary>
+    /// Fix64与float的转换：旧的拆分整数/小数部分 vs 乘以常数，截断 vs 四舍五入，
+    /// 以及FVector3::ToFloatArray/FromFloatArray的标量和AVX2实现，并校验批量结果一致.
+    /// </summary>
+    /// <param name="sampleCount">FVector3的个数</param>
+    void BenchFix64Conversion(int sampleCount);
+
+    /// <summary>
+    /// 十进制格式化和解析：旧的to_string拼接、ToString、批量ToChars，strtod与批量FromChars，
+    /// 并统计写出再读回后与原值不同的个数.
+    /// </summary>
+    /// <param name="sampleCount">FVector3的个数</param>
+    void BenchFix64Format(int sampleCount);
+}
+
+#endif /* FMathBench_h */
@@ -0,0 +1,112 @@
+//
+//  FMathBenchMain.cpp
+//  MathLib
+//
+//  基准测试程序FMathBench的入口.
+//
+//  FMathBench [--samples N] [--warmup N] [--repeat N] [--seed N] [--filter NAME] [--json PATH] [--compare]
+//    --filter   只运行名字包含NAME的用例，如 --filter FVector3
+//    --json     把结果写入PATH，用于回归对比
+//    --compare  之后再运行FMathBench.h中新旧实现的对比测试(原来的 FMath bench)
+//
+
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include "FMathBench.h"
+#include "FMathBenchSuite.h"
+using namespace FMath;
+
+namespace
+{
+    void PrintUsage(const char* program)
+    {
+        std::cout << "usage: " << program
+                  << " [--samples N] [--warmup N] [--repeat N] [--seed N] [--filter NAME] [--json PATH] [--compare]" << std::endl;
+    }
+}
+
+int main(int argc, const char * argv[])
+{
+    BenchSuiteOptions options;
+    const char* jsonPath = nullptr;
+    bool compare = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool needValue = true;
+
+        if (strcmp(arg, "--compare") == 0)
+        {
+            compare = true;
+            needValue = false;
+        }
+        else if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0)
+        {
+            PrintUsage(argv[0]);
+            return 0;
+        }
+        else if (value == nullptr)
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+        else if (strcmp(arg, "--samples") == 0)
+        {
+            options.sampleCount = atoi(value);
+        }
+        else if (strcmp(arg, "--warmup") == 0)
+        {
+            options.warmupCount = atoi(value);
+        }
+        else if (strcmp(arg, "--repeat") == 0)
+        {
+            options.repeatCount = atoi(value);
+        }
+        else if (strcmp(arg, "--seed") == 0)
+        {
+            options.seed = strtoull(value, nullptr, 10);
+        }
+        else if (strcmp(arg, "--filter") == 0)
+        {
+            options.filter = value;
+        }
+        else if (strcmp(arg, "--json") == 0)
+        {
+            jsonPath = value;
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+
+        if (needValue)
+        {
+            ++i;
+        }
+    }
+
+    if (options.sampleCount <= 0 || options.warmupCount < 0 || options.repeatCount <= 0)
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::vector<BenchSuiteResult> results = RunBenchSuite(options);
+
+    if (jsonPath != nullptr && !WriteBenchSuiteJson(jsonPath, options, results))
+    {
+        std::cerr << "failed to write " << jsonPath << std::endl;
+        return 1;
+    }
+
+    if (compare)
+    {
+        RunBenchmarks();
+    }
+
+    return 0;
+}
@@ -0,0 +1,437 @@
+//
+//  FMathBenchSuite.cpp
+//  MathLib
+//
+//  基准测试套件：逐个运算的吞吐量和延迟，结果可以输出为JSON用于回归对比.
+//
+
+#include "FMathBenchSuite.h"
+#include "Fix64.h"
+#include "FVector2.h"
+#include "FVector3.h"
+#include "FVector4.h"
+#include "FMatrix4.h"
+#include "FQuaternion.h"
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <algorithm>
+using namespace FMath;
+
+namespace
+{
+    /// 防止被测代码被编译器优化掉
+    volatile int64_t suiteSink = 0;
+
+    /// 运行时才读出的0：延迟测试用它把上一次的结果接到下一次的输入上，而不改变输入的值
+    volatile int64_t chainMask = 0;
+
+    typedef std::chrono::steady_clock SuiteClock;
+
+    /// 取结果的一个分量，用于接回输入和防止优化
+    inline int64_t Raw(const Fix64& v) { return v.rawValue; }
+    inline int64_t Raw(double v) { return (int64_t)v; }
+    inline int64_t Raw(const FVector2& v) { return v.x.rawValue; }
+    inline int64_t Raw(const FVector3& v) { return v.x.rawValue; }
+    inline int64_t Raw(const FVector4& v) { return v.x.rawValue; }
+    inline int64_t Raw(const FQuaternion& q) { return q.w.rawValue; }
+    inline int64_t Raw(const FMatrix4& m) { return m.m00.rawValue; }
+
+    /// 把d加到输入的第一个分量上，d总是0
+    inline void Perturb(Fix64& v, int64_t d) { v.rawValue += d; }
+    inline void Perturb(double& v, int64_t d) { v += d; }
+    inline void Perturb(FVector2& v, int64_t d) { v.x.rawValue += d; }
+    inline void Perturb(FVector3& v, int64_t d) { v.x.rawValue += d; }
+    inline void Perturb(FVector4& v, int64_t d) { v.x.rawValue += d; }
+    inline void Perturb(FQuaternion& q, int64_t d) { q.w.rawValue += d; }
+    inline void Perturb(FMatrix4& m, int64_t d) { m.m00.rawValue += d; }
+
+    /// 多个参数的输入
+    template<typename A, typename B>
+    struct BenchPair
+    {
+        A a;
+        B b;
+    };
+
+    template<typename A, typename B>
+    inline void Perturb(BenchPair<A, B>& p, int64_t d)
+    {
+        Perturb(p.a, d);
+    }
+
+    template<typename A, typename B>
+    BenchPair<A, B> MakePair(const A& a, const B& b)
+    {
+        return BenchPair<A, B>{ a, b };
+    }
+
+    /// 用例名的FNV-1a哈希，与种子一起决定用例的输入
+    uint64_t HashName(const char* name)
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        for (const char* p = name; *p != '\0'; ++p)
+        {
+            hash = (hash ^ (uint8_t)*p) * 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    Fix64 RandomFix64(std::mt19937_64& rng, double lo, double hi)
+    {
+        std::uniform_int_distribution<int64_t> dist((int64_t)(lo * Fix64::fractionFactor), (int64_t)(hi * Fix64::fractionFactor));
+        return Fix64::FromRawValue(dist(rng));
+    }
+
+    /// 绝对值在[lo, hi]，符号随机
+    Fix64 RandomNonZero(std::mt19937_64& rng, double lo, double hi)
+    {
+        Fix64 v = RandomFix64(rng, lo, hi);
+        return (rng() & 1) != 0 ? -v : v;
+    }
+
+    FVector2 RandomVector2(std::mt19937_64& rng, double range)
+    {
+        return FVector2(RandomNonZero(rng, 0.5, range), RandomFix64(rng, -range, range));
+    }
+
+    FVector3 RandomVector3(std::mt19937_64& rng, double range)
+    {
+        return FVector3(RandomNonZero(rng, 0.5, range), RandomFix64(rng, -range, range), RandomFix64(rng, -range, range));
+    }
+
+    FVector4 RandomVector4(std::mt19937_64& rng, double range)
+    {
+        return FVector4(RandomNonZero(rng, 0.5, range), RandomFix64(rng, -range, range),
+                        RandomFix64(rng, -range, range), RandomFix64(rng, -range, range));
+    }
+
+    FQuaternion RandomRotation(std::mt19937_64& rng)
+    {
+        const double pi = 3.14159265358979;
+        return FQuaternion::FromEuler(FVector3(RandomFix64(rng, -pi / 2, pi / 2), RandomFix64(rng, -pi, pi), RandomFix64(rng, -pi, pi)));
+    }
+
+    FMatrix4 RandomTransform(std::mt19937_64& rng)
+    {
+        FVector3 scale(RandomFix64(rng, 0.5, 2), RandomFix64(rng, 0.5, 2), RandomFix64(rng, 0.5, 2));
+        return FMatrix4::TRS(RandomVector3(rng, 100), RandomRotation(rng), scale);
+    }
+
+    /// 对多轮的ns/op求统计量
+    BenchStats Summarize(std::vector<double> samples)
+    {
+        BenchStats stats;
+        if (samples.empty())
+        {
+            return stats;
+        }
+
+        std::sort(samples.begin(), samples.end());
+        size_t n = samples.size();
+        stats.min = samples[0];
+        stats.median = (n % 2 == 1) ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2;
+
+        double sum = 0;
+        for (double s : samples)
+        {
+            sum += s;
+        }
+        stats.mean = sum / n;
+
+        double squareSum = 0;
+        for (double s : samples)
+        {
+            squareSum += (s - stats.mean) * (s - stats.mean);
+        }
+        stats.stddev = n > 1 ? std::sqrt(squareSum / (n - 1)) : 0;
+
+        return stats;
+    }
+
+    double NanosecondsPerOp(SuiteClock::time_point start, SuiteClock::time_point end, size_t count)
+    {
+        return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / count;
+    }
+
+    class BenchSuite
+    {
+    public:
+        explicit BenchSuite(const BenchSuiteOptions& options): options(options)
+        {
+        }
+
+        /// <summary>
+        /// 用generate(rng)生成sampleCount个输入，分别测op的吞吐量和延迟.
+        /// </summary>
+        template<typename Generate, typename Op>
+        void Run(const char* name, Generate generate, Op op)
+        {
+            if (options.filter != nullptr && strstr(name, options.filter) == nullptr)
+            {
+                return;
+            }
+
+            std::mt19937_64 rng(options.seed ^ HashName(name));
+            typedef decltype(generate(rng)) Input;
+            std::vector<Input> inputs;
+            inputs.reserve(options.sampleCount);
+            for (int i = 0; i < options.sampleCount; ++i)
+            {
+                inputs.push_back(generate(rng));
+            }
+
+            typedef decltype(op(inputs[0])) Output;
+            std::vector<Output> outputs(inputs.size(), op(inputs[0]));
+
+            std::vector<double> throughput, latency;
+            for (int round = 0; round < options.warmupCount + options.repeatCount; ++round)
+            {
+                double t = Throughput(inputs, outputs, op);
+                double l = Latency(inputs, op);
+                if (round >= options.warmupCount)
+                {
+                    throughput.push_back(t);
+                    latency.push_back(l);
+                }
+            }
+
+            BenchSuiteResult result;
+            result.name = name;
+            result.throughput = Summarize(throughput);
+            result.latency = Summarize(latency);
+            Print(result);
+            results.push_back(result);
+        }
+
+        std::vector<BenchSuiteResult> results;
+
+    private:
+        template<typename Input, typename Output, typename Op>
+        static double Throughput(const std::vector<Input>& inputs, std::vector<Output>& outputs, Op op)
+        {
+            const size_t count = inputs.size();
+            SuiteClock::time_point start = SuiteClock::now();
+            for (size_t i = 0; i < count; ++i)
+            {
+                outputs[i] = op(inputs[i]);
+            }
+            SuiteClock::time_point end = SuiteClock::now();
+            suiteSink = Raw(outputs[count / 2]);
+
+            return NanosecondsPerOp(start, end, count);
+        }
+
+        template<typename Input, typename Op>
+        static double Latency(const std::vector<Input>& inputs, Op op)
+        {
+            const size_t count = inputs.size();
+            const int64_t mask = chainMask;
+            int64_t carry = 0;
+            SuiteClock::time_point start = SuiteClock::now();
+            for (size_t i = 0; i < count; ++i)
+            {
+                Input input = inputs[i];
+                Perturb(input, carry & mask);
+                carry = Raw(op(input));
+            }
+            SuiteClock::time_point end = SuiteClock::now();
+            suiteSink = carry;
+
+            return NanosecondsPerOp(start, end, count);
+        }
+
+        static void Print(const BenchSuiteResult& result)
+        {
+            const BenchStats& t = result.throughput;
+            std::cout << "  " << std::left << std::setw(26) << result.name << std::right << std::fixed << std::setprecision(2)
+                      << "  throughput = " << std::setw(8) << t.median << " ns/op"
+                      << " (" << std::setw(8) << (t.median > 0 ? 1000 / t.median : 0) << " Mops/s"
+                      << ", stddev = " << std::setw(5) << (t.mean > 0 ? 100 * t.stddev / t.mean : 0) << "%)"
+                      << "  latency = " << std::setw(8) << result.latency.median << " ns/op" << std::endl;
+            std::cout.unsetf(std::ios::floatfield);
+        }
+
+        const BenchSuiteOptions& options;
+    };
+
+    void WriteStats(std::ostream& out, const char* name, const BenchStats& stats)
+    {
+        out << "\"" << name << "\": {\"min\": " << stats.min << ", \"median\": " << stats.median
+            << ", \"mean\": " << stats.mean << ", \"stddev\": " << stats.stddev << "}";
+    }
+}
+
+std::vector<BenchSuiteResult> FMath::RunBenchSuite(const BenchSuiteOptions& options)
+{
+    std::cout << "FMath bench suite, sample_count = " << options.sampleCount
+              << ", warmup = " << options.warmupCount << ", repeat = " << options.repeatCount
+              << ", seed = " << options.seed << " (median of repeats)" << std::endl;
+
+    BenchSuite suite(options);
+    const double pi = 3.14159265358979;
+    const Fix64 t = Fix64(0.3);
+
+    /************ Fix64 ***********/
+
+    auto fix64 = [](double lo, double hi)
+    {
+        return [lo, hi](std::mt19937_64& rng) { return RandomFix64(rng, lo, hi); };
+    };
+    auto fix64Pair = [](double lo, double hi)
+    {
+        return [lo, hi](std::mt19937_64& rng) { return MakePair(RandomFix64(rng, lo, hi), RandomFix64(rng, lo, hi)); };
+    };
+
+    suite.Run("Fix64 +", fix64Pair(-10000, 10000), [](const BenchPair<Fix64, Fix64>& p) { return p.a + p.b; });
+    suite.Run("Fix64 -", fix64Pair(-10000, 10000), [](const BenchPair<Fix64, Fix64>& p) { return p.a - p.b; });
+    suite.Run("Fix64 *", fix64Pair(-1000, 1000), [](const BenchPair<Fix64, Fix64>& p) { return p.a * p.b; });
+    suite.Run("Fix64 /",
+              [](std::mt19937_64& rng) { return MakePair(RandomFix64(rng, -1000, 1000), RandomNonZero(rng, 0.5, 1000)); },
+              [](const BenchPair<Fix64, Fix64>& p) { return p.a / p.b; });
+    suite.Run("Fix64 ToDouble", fix64(-1000000, 1000000), [](Fix64 x) { return x.ToDouble(); });
+    suite.Run("Fix64 ToSingle", fix64(-1000000, 1000000), [](Fix64 x) { return (double)x.ToSingle(); });
+    suite.Run("Fix64 FromDouble", [](std::mt19937_64& rng) { return RandomFix64(rng, -1000000, 1000000).ToDouble() + 1e-6; },
+              [](double x) { return Fix64(x); });
+    suite.Run("Fix64 Sqrt", fix64(0, 1000000), [](Fix64 x) { return x.Sqrt(); });
+    suite.Run("Fix64 InvSqrt", fix64(0.001, 1000000), [](Fix64 x) { return x.InvSqrt(); });
+    suite.Run("Fix64 Sin", fix64(-4 * pi, 4 * pi), [](Fix64 x) { return Fix64::Sin(x); });
+    suite.Run("Fix64 Cos", fix64(-4 * pi, 4 * pi), [](Fix64 x) { return Fix64::Cos(x); });
+    suite.Run("Fix64 Tan", fix64(-4 * pi, 4 * pi), [](Fix64 x) { return Fix64::Tan(x); });
+    suite.Run("Fix64 Asin", fix64(-1, 1), [](Fix64 x) { return Fix64::Asin(x); });
+    suite.Run("Fix64 Acos", fix64(-1, 1), [](Fix64 x) { return Fix64::Acos(x); });
+    suite.Run("Fix64 Atan", fix64(-8, 8), [](Fix64 x) { return Fix64::Atan(x); });
+    suite.Run("Fix64 Atan2", fix64Pair(-100, 100), [](const BenchPair<Fix64, Fix64>& p) { return Fix64::Atan2(p.a, p.b); });
+    suite.Run("Fix64 Exp", fix64(-12, 21), [](Fix64 x) { return Fix64::Exp(x); });
+    suite.Run("Fix64 Log", fix64(0.001, 1000000), [](Fix64 x) { return Fix64::Log(x); });
+    suite.Run("Fix64 Pow",
+              [](std::mt19937_64& rng) { return MakePair(RandomFix64(rng, 0.001, 16), RandomFix64(rng, -4, 4)); },
+              [](const BenchPair<Fix64, Fix64>& p) { return Fix64::Pow(p.a, p.b); });
+
+    /************ FVector2 ***********/
+
+    auto vector2Pair = [](std::mt19937_64& rng) { return MakePair(RandomVector2(rng, 100), RandomVector2(rng, 100)); };
+    typedef BenchPair<FVector2, FVector2> Vector2Pair;
+
+    suite.Run("FVector2 +", vector2Pair, [](const Vector2Pair& p) { return p.a + p.b; });
+    suite.Run("FVector2 Dot", vector2Pair, [](const Vector2Pair& p) { return FVector2::Dot(p.a, p.b); });
+    suite.Run("FVector2 Magnitude", [](std::mt19937_64& rng) { return RandomVector2(rng, 100); },
+              [](FVector2 v) { return v.Magnitude(); });
+    suite.Run("FVector2 Normalized", [](std::mt19937_64& rng) { return RandomVector2(rng, 100); },
+              [](FVector2 v) { return v.Normalized(); });
+    suite.Run("FVector2 Angle", vector2Pair, [](const Vector2Pair& p) { return FVector2::Angle(p.a, p.b); });
+
+    /************ FVector3 ***********/
+
+    auto vector3 = [](std::mt19937_64& rng) { return RandomVector3(rng, 100); };
+    auto vector3Pair = [](std::mt19937_64& rng) { return MakePair(RandomVector3(rng, 100), RandomVector3(rng, 100)); };
+    typedef BenchPair<FVector3, FVector3> Vector3Pair;
+
+    suite.Run("FVector3 +", vector3Pair, [](const Vector3Pair& p) { return p.a + p.b; });
+    suite.Run("FVector3 Dot", vector3Pair, [](const Vector3Pair& p) { return FVector3::Dot(p.a, p.b); });
+    suite.Run("FVector3 Cross", vector3Pair, [](const Vector3Pair& p) { return FVector3::Cross(p.a, p.b); });
+    suite.Run("FVector3 Magnitude", vector3, [](const FVector3& v) { return v.Magnitude(); });
+    suite.Run("FVector3 Normalized", vector3, [](const FVector3& v) { return v.Normalized(); });
+    suite.Run("FVector3 NormalizedFast", vector3, [](const FVector3& v) { return v.NormalizedFast(); });
+    suite.Run("FVector3 Lerp", vector3Pair, [t](const Vector3Pair& p) { return FVector3::Lerp(p.a, p.b, t); });
+    suite.Run("FVector3 Angle", vector3Pair, [](const Vector3Pair& p) { return FVector3::Angle(p.a, p.b); });
+
+    /************ FVector4 ***********/
+
+    auto vector4Pair = [](std::mt19937_64& rng) { return MakePair(RandomVector4(rng, 100), RandomVector4(rng, 100)); };
+    typedef BenchPair<FVector4, FVector4> Vector4Pair;
+
+    suite.Run("FVector4 +", vector4Pair, [](const Vector4Pair& p) { return p.a + p.b; });
+    suite.Run("FVector4 Dot", vector4Pair, [](const Vector4Pair& p) { return FVector4::Dot(p.a, p.b); });
+    suite.Run("FVector4 Magnitude", [](std::mt19937_64& rng) { return RandomVector4(rng, 100); },
+              [](const FVector4& v) { return v.Magnitude(); });
+    suite.Run("FVector4 Normalized", [](std::mt19937_64& rng) { return RandomVector4(rng, 100); },
+              [](const FVector4& v) { return v.Normalized(); });
+
+    /************ FMatrix4 ***********/
+
+    auto transform = [](std::mt19937_64& rng) { return RandomTransform(rng); };
+    typedef BenchPair<FMatrix4, FMatrix4> MatrixPair;
+    typedef BenchPair<FMatrix4, FVector4> MatrixVector4;
+    typedef BenchPair<FMatrix4, FVector3> MatrixVector3;
+    typedef BenchPair<FVector3, BenchPair<FQuaternion, FVector3>> TRSInput;
+
+    suite.Run("FMatrix4 * FMatrix4", [](std::mt19937_64& rng) { return MakePair(RandomTransform(rng), RandomTransform(rng)); },
+              [](const MatrixPair& p) { return p.a * p.b; });
+    suite.Run("FMatrix4 * FVector4", [](std::mt19937_64& rng) { return MakePair(RandomTransform(rng), RandomVector4(rng, 100)); },
+              [](const MatrixVector4& p) { return p.a * p.b; });
+    suite.Run("FMatrix4 MultiplyPoint", [](std::mt19937_64& rng) { return MakePair(RandomTransform(rng), RandomVector3(rng, 100)); },
+              [](const MatrixVector3& p) { return p.a.MultiplyPoint(p.b); });
+    suite.Run("FMatrix4 Inverse", transform, [](const FMatrix4& m) { return m.Inverse(); });
+    suite.Run("FMatrix4 InverseAffine", transform, [](const FMatrix4& m) { return m.InverseAffine(); });
+    suite.Run("FMatrix4 TRS",
+              [](std::mt19937_64& rng)
+              {
+                  FVector3 scale(RandomFix64(rng, 0.5, 2), RandomFix64(rng, 0.5, 2), RandomFix64(rng, 0.5, 2));
+                  return MakePair(RandomVector3(rng, 100), MakePair(RandomRotation(rng), scale));
+              },
+              [](const TRSInput& p) { return FMatrix4::TRS(p.a, p.b.a, p.b.b); });
+
+    /************ FQuaternion ***********/
+
+    auto rotationPair = [](std::mt19937_64& rng) { return MakePair(RandomRotation(rng), RandomRotation(rng)); };
+    typedef BenchPair<FQuaternion, FQuaternion> QuaternionPair;
+    typedef BenchPair<FQuaternion, FVector3> QuaternionVector3;
+
+    suite.Run("FQuaternion *", rotationPair, [](const QuaternionPair& p) { return p.a * p.b; });
+    suite.Run("FQuaternion Rotate", [](std::mt19937_64& rng) { return MakePair(RandomRotation(rng), RandomVector3(rng, 100)); },
+              [](const QuaternionVector3& p) { return p.a.Rotate(p.b); });
+    suite.Run("FQuaternion Normalized", [](std::mt19937_64& rng) { return RandomRotation(rng) * Fix64(3); },
+              [](const FQuaternion& q) { return q.Normalized(); });
+    suite.Run("FQuaternion Nlerp", rotationPair, [t](const QuaternionPair& p) { return FQuaternion::Nlerp(p.a, p.b, t); });
+    suite.Run("FQuaternion Slerp", rotationPair, [t](const QuaternionPair& p) { return FQuaternion::Slerp(p.a, p.b, t); });
+    suite.Run("FQuaternion FromEuler", vector3, [](const FVector3& v) { return FQuaternion::FromEuler(v * Fix64(0.01)); });
+    suite.Run("FQuaternion ToEuler", [](std::mt19937_64& rng) { return RandomRotation(rng); },
+              [](const FQuaternion& q) { return q.ToEuler(); });
+
+    return suite.results;
+}
+
+bool FMath::WriteBenchSuiteJson(const char* path, const BenchSuiteOptions& options,
+                                const std::vector<BenchSuiteResult>& results)
+{
+    std::ofstream out(path);
+    if (!out)
+    {
+        return false;
+    }
+
+#ifdef NDEBUG
+    const char* build = "release";
+#else
+    const char* build = "debug";
+#endif
+
+    out << std::setprecision(6);
+    out << "{\n";
+    out << "  \"unit\": \"ns/op\",\n";
+    out << "  \"build\": \"" << build << "\",\n";
+    out << "  \"sample_count\": " << options.sampleCount << ",\n";
+    out << "  \"warmup\": " << options.warmupCount << ",\n";
+    out << "  \"repeat\": " << options.repeatCount << ",\n";
+    out << "  \"seed\": " << options.seed << ",\n";
+    out << "  \"trig_lut_bits\": " << FIX64_TRIG_LUT_BITS << ",\n";
+    out << "  \"exp_lut_bits\": " << FIX64_EXP_LUT_BITS << ",\n";
+    out << "  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        out << "    {\"name\": \"" << results[i].name << "\", ";
+        WriteStats(out, "throughput", results[i].throughput);
+        out << ", ";
+        WriteStats(out, "latency", results[i].latency);
+        out << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n";
+    out << "}\n";
+
+    return (bool)out;
+}
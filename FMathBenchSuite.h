@@ -0,0 +1,73 @@
+//
+//  FMathBenchSuite.h
+//  MathLib
+//
+//  基准测试套件：逐个运算的吞吐量和延迟，结果可以输出为JSON用于回归对比.
+//
+
+#ifndef FMathBenchSuite_h
+#define FMathBenchSuite_h
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace FMath
+{
+    /// <summary>
+    /// 套件参数.
+    /// </summary>
+    struct BenchSuiteOptions
+    {
+        /// 每轮计时调用的次数，也是输入数组的长度
+        int sampleCount = 16384;
+
+        /// 每个用例先不计时运行warmupCount轮，再计时repeatCount轮
+        int warmupCount = 3;
+        int repeatCount = 15;
+
+        /// 输入的随机种子，每个用例的输入只由种子和用例名决定
+        uint64_t seed = 20200708;
+
+        /// 只运行名字包含filter的用例，nullptr时全部运行
+        const char* filter = nullptr;
+    };
+
+    /// <summary>
+    /// 多轮计时的统计，单位ns/op.
+    /// </summary>
+    struct BenchStats
+    {
+        double min = 0;
+        double median = 0;
+        double mean = 0;
+        double stddev = 0;
+    };
+
+    /// <summary>
+    /// 单个用例的结果.
+    /// throughput：输入互相独立，编译器和CPU可以流水线/向量化执行，反映批量处理的速度.
+    /// latency：每次的输入依赖上一次的结果，反映单次调用在依赖链上的耗时(含把结果接回输入的一次与、加).
+    /// </summary>
+    struct BenchSuiteResult
+    {
+        std::string name;
+        BenchStats throughput;
+        BenchStats latency;
+    };
+
+    /// <summary>
+    /// 运行Fix64的+ - * /、Sqrt、三角/指数函数，以及FVector2/3/4、FMatrix4、FQuaternion常用运算的用例.
+    /// 每个用例打印一行结果.
+    /// </summary>
+    std::vector<BenchSuiteResult> RunBenchSuite(const BenchSuiteOptions& options);
+
+    /// <summary>
+    /// 把结果写成JSON，包括参数和编译配置.
+    /// </summary>
+    /// <returns>文件无法写入时返回false</returns>
+    bool WriteBenchSuiteJson(const char* path, const BenchSuiteOptions& options,
+                             const std::vector<BenchSuiteResult>& results);
+}
+
+#endif /* FMathBenchSuite_h */
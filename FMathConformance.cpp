@@ -0,0 +1,1768 @@
+//
+//  FMathConformance.cpp
+//  MathLib
+//
+//  一致性测试：对Fix64、向量、矩阵、四元数的每个运算生成输入/输出rawValue的黄金数据，
+//  并校验当前编译的结果与之逐位相同，用于确认不同编译器、优化级别、SIMD实现的结果一致.
+//
+
+#include "FMathConformance.h"
+#include "Fix64.h"
+#include "Fixed.h"
+#include "FVector2.h"
+#include "FVector3.h"
+#include "FVector3Array.h"
+#include "FVector4.h"
+#include "FMatrix3x4.h"
+#include "FMatrix4.h"
+#include "FQuaternion.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+using namespace FMath;
+
+namespace
+{
+    /************ inputs ***********/
+
+    /// <summary>
+    /// SplitMix64：输出只由状态决定，与标准库的分布实现无关.
+    /// </summary>
+    class ConformanceRng
+    {
+    public:
+        explicit ConformanceRng(uint64_t seed): state(seed)
+        {
+        }
+
+        uint64_t Next()
+        {
+            uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+        /// [lo, hi]
+        int64_t Range(int64_t lo, int64_t hi)
+        {
+            return lo + (int64_t)(Next() % (uint64_t)(hi - lo + 1));
+        }
+
+    private:
+        uint64_t state;
+    };
+
+    const int64_t one = Fix64::fractionFactor;
+    const int64_t maxRaw = Fix64::MaxValue.rawValue;
+
+    /// 向量分量的范围，点积、叉积不会超出Fix64的范围
+    const int64_t vectorRange = 1024 * one;
+
+    /// 矩阵元素的范围
+    const int64_t matrixRange = 16 * one;
+
+    const int64_t specialValues[] =
+    {
+        0, 1, -1, 2, -2, one / 2, -one / 2, one - 1, -(one - 1), one, -one, one + 1, -(one + 1),
+        2 * one, -2 * one, 0x7fff, 0x8000, 0x8001,
+        Fix64::PI.rawValue, -Fix64::PI.rawValue, Fix64::PI.rawValue / 2, -Fix64::PI.rawValue / 2, 2 * Fix64::PI.rawValue,
+        (int64_t)1 << 31, -((int64_t)1 << 31), (int64_t)1 << 32, maxRaw, -maxRaw, maxRaw - 1, -maxRaw + 1,
+    };
+    const int specialCount = sizeof(specialValues) / sizeof(specialValues[0]);
+
+    /// 位数随机的数：各个数量级的样本数相近，符号随机
+    int64_t MagnitudeRaw(ConformanceRng& rng, int bits)
+    {
+        int b = (int)(rng.Next() % (uint64_t)(bits + 1));
+        int64_t v = b == 0 ? 0 : (int64_t)(rng.Next() >> (64 - b));
+        return (rng.Next() & 1) != 0 ? -v : v;
+    }
+
+    /// 全范围：特殊值、均匀分布、按数量级分布分别占1/8、3/8、1/2
+    int64_t AnyRaw(ConformanceRng& rng)
+    {
+        uint64_t kind = rng.Next() & 7;
+        if (kind == 0)
+        {
+            return specialValues[rng.Next() % specialCount];
+        }
+        if (kind < 4)
+        {
+            return rng.Range(-maxRaw, maxRaw);
+        }
+        return MagnitudeRaw(rng, 47);
+    }
+
+    /// [-maxAbs, maxAbs]：1/16为0、±1等特殊值，1/4按数量级分布，其余均匀分布
+    int64_t RangeRaw(ConformanceRng& rng, int64_t maxAbs)
+    {
+        uint64_t kind = rng.Next() & 15;
+        if (kind == 0)
+        {
+            const int64_t small[] = { 0, 1, -1, one, -one, one / 2, -one / 2 };
+            int64_t v = small[rng.Next() % 7];
+            return (v > maxAbs || v < -maxAbs) ? 0 : v;
+        }
+        if (kind < 5)
+        {
+            int bits = 64 - Fix64::CountLeadingZeros((uint64_t)maxAbs);
+            return MagnitudeRaw(rng, bits) % (maxAbs + 1);
+        }
+        return rng.Range(-maxAbs, maxAbs);
+    }
+
+    /// 角度：一半在[-8π, 8π]，一半取全范围，覆盖周期的化简
+    int64_t AngleRaw(ConformanceRng& rng)
+    {
+        return (rng.Next() & 1) != 0 ? RangeRaw(rng, 8 * Fix64::PI.rawValue) : AnyRaw(rng);
+    }
+
+    uint64_t SqrtFloor(uint64_t x)
+    {
+        uint64_t result = 0;
+        uint64_t bit = (uint64_t)1 << 62;
+        while (bit > x)
+        {
+            bit >>= 2;
+        }
+        while (bit != 0)
+        {
+            if (x >= result + bit)
+            {
+                x -= result + bit;
+                result = (result >> 1) + bit;
+            }
+            else
+            {
+                result >>= 1;
+            }
+            bit >>= 2;
+        }
+        return result;
+    }
+
+    /// 只用整数运算单位化Q16的分量，全为0时令c[last]为1
+    void NormalizeRaw(int64_t* c, int n)
+    {
+        uint64_t sum = 0;
+        for (int i = 0; i < n; ++i)
+        {
+            sum += (uint64_t)(c[i] * c[i]);
+        }
+        if (sum == 0)
+        {
+            c[n - 1] = one;
+            return;
+        }
+
+        int64_t length = (int64_t)SqrtFloor(sum);
+        for (int i = 0; i < n; ++i)
+        {
+            c[i] = c[i] * one / length;
+        }
+    }
+
+    /// 单位四元数(x, y, z, w)
+    void UnitQuaternionRaw(ConformanceRng& rng, int64_t* q)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            q[i] = rng.Range(-one, one);
+        }
+        NormalizeRaw(q, 4);
+    }
+
+    /// 单位四元数(x, y, z, w)对应的旋转矩阵，行向量为旋转后的坐标轴
+    void RotationRaw(const int64_t* q, int64_t* r)
+    {
+        auto mul = [](int64_t a, int64_t b) { return a * b / one; };
+        int64_t x = q[0], y = q[1], z = q[2], w = q[3];
+        int64_t xx = mul(x, x), yy = mul(y, y), zz = mul(z, z);
+        int64_t xy = mul(x, y), xz = mul(x, z), yz = mul(y, z);
+        int64_t wx = mul(w, x), wy = mul(w, y), wz = mul(w, z);
+
+        r[0] = one - 2 * (yy + zz); r[1] = 2 * (xy + wz);       r[2] = 2 * (xz - wy);
+        r[3] = 2 * (xy - wz);       r[4] = one - 2 * (xx + zz); r[5] = 2 * (yz + wx);
+        r[6] = 2 * (xz + wy);       r[7] = 2 * (yz - wx);       r[8] = one - 2 * (xx + yy);
+    }
+
+    /************ records ***********/
+
+    Fix64 FMatrix4::* const matrix4Members[16] =
+    {
+        &FMatrix4::m00, &FMatrix4::m01, &FMatrix4::m02, &FMatrix4::m03,
+        &FMatrix4::m10, &FMatrix4::m11, &FMatrix4::m12, &FMatrix4::m13,
+        &FMatrix4::m20, &FMatrix4::m21, &FMatrix4::m22, &FMatrix4::m23,
+        &FMatrix4::m30, &FMatrix4::m31, &FMatrix4::m32, &FMatrix4::m33,
+    };
+
+    Fix64 FMatrix3x4::* const matrix3x4Members[12] =
+    {
+        &FMatrix3x4::m00, &FMatrix3x4::m01, &FMatrix3x4::m02,
+        &FMatrix3x4::m10, &FMatrix3x4::m11, &FMatrix3x4::m12,
+        &FMatrix3x4::m20, &FMatrix3x4::m21, &FMatrix3x4::m22,
+        &FMatrix3x4::m30, &FMatrix3x4::m31, &FMatrix3x4::m32,
+    };
+
+    /// <summary>
+    /// 按顺序读出一条记录中的rawValue.
+    /// 四元数按(x, y, z, w)，矩阵按行存储.
+    /// </summary>
+    struct RecordReader
+    {
+        const int64_t* p;
+
+        int64_t Raw() { return *p++; }
+
+        Fix64 Fix() { return Fix64::FromRawValue(*p++); }
+
+        FVector2 Vector2()
+        {
+            Fix64 x = Fix();
+            Fix64 y = Fix();
+            return FVector2(x, y);
+        }
+
+        FVector3 Vector3()
+        {
+            Fix64 x = Fix();
+            Fix64 y = Fix();
+            Fix64 z = Fix();
+            return FVector3(x, y, z);
+        }
+
+        FVector4 Vector4()
+        {
+            Fix64 x = Fix();
+            Fix64 y = Fix();
+            Fix64 z = Fix();
+            Fix64 w = Fix();
+            return FVector4(x, y, z, w);
+        }
+
+        FQuaternion Quaternion()
+        {
+            Fix64 x = Fix();
+            Fix64 y = Fix();
+            Fix64 z = Fix();
+            Fix64 w = Fix();
+            return FQuaternion(x, y, z, w);
+        }
+
+        FMatrix4 Matrix4()
+        {
+            FMatrix4 m;
+            for (int i = 0; i < 16; ++i)
+            {
+                m.*matrix4Members[i] = Fix();
+            }
+            return m;
+        }
+
+        FMatrix3x4 Matrix3x4()
+        {
+            FMatrix3x4 m;
+            for (int i = 0; i < 12; ++i)
+            {
+                m.*matrix3x4Members[i] = Fix();
+            }
+            return m;
+        }
+    };
+
+    /// <summary>
+    /// 按顺序写入一条记录，顺序与RecordReader相同.
+    /// </summary>
+    struct RecordWriter
+    {
+        int64_t* p;
+
+        void Raw(int64_t v) { *p++ = v; }
+
+        void Put(Fix64 v) { *p++ = v.rawValue; }
+
+        void Put(const FVector2& v) { Put(v.x); Put(v.y); }
+
+        void Put(const FVector3& v) { Put(v.x); Put(v.y); Put(v.z); }
+
+        void Put(const FVector4& v) { Put(v.x); Put(v.y); Put(v.z); Put(v.w); }
+
+        void Put(const FQuaternion& q) { Put(q.x); Put(q.y); Put(q.z); Put(q.w); }
+
+        void Put(const FMatrix4& m)
+        {
+            for (int i = 0; i < 16; ++i)
+            {
+                Put(m.*matrix4Members[i]);
+            }
+        }
+
+        void Put(const FMatrix3x4& m)
+        {
+            for (int i = 0; i < 12; ++i)
+            {
+                Put(m.*matrix3x4Members[i]);
+            }
+        }
+    };
+
+    /************ generators ***********/
+
+    void PutRange(RecordWriter& w, ConformanceRng& rng, int64_t maxAbs, int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            w.Raw(RangeRaw(rng, maxAbs));
+        }
+    }
+
+    void PutUnitVector3(RecordWriter& w, ConformanceRng& rng)
+    {
+        int64_t c[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            c[i] = rng.Range(-one, one);
+        }
+        NormalizeRaw(c, 3);
+        for (int i = 0; i < 3; ++i)
+        {
+            w.Raw(c[i]);
+        }
+    }
+
+    void PutUnitQuaternion(RecordWriter& w, ConformanceRng& rng)
+    {
+        int64_t q[4];
+        UnitQuaternionRaw(rng, q);
+        for (int i = 0; i < 4; ++i)
+        {
+            w.Raw(q[i]);
+        }
+    }
+
+    /// 旋转、每行缩放scale倍、平移；columns为4时按FMatrix4写入，最后一列为(0, 0, 0, 1)
+    void PutTransform(RecordWriter& w, ConformanceRng& rng, int columns, bool scaled)
+    {
+        int64_t q[4], r[9];
+        UnitQuaternionRaw(rng, q);
+        RotationRaw(q, r);
+        for (int row = 0; row < 3; ++row)
+        {
+            int64_t scale = scaled ? rng.Range(one / 4, 4 * one) : one;
+            for (int col = 0; col < 3; ++col)
+            {
+                w.Raw(r[row * 3 + col] * scale / one);
+            }
+            if (columns == 4)
+            {
+                w.Raw(0);
+            }
+        }
+        PutRange(w, rng, vectorRange, 3);
+        if (columns == 4)
+        {
+            w.Raw(one);
+        }
+    }
+
+    /// m * 2^-k，|m| < 2^53且k >= 22：double精确表示且不超出Fix64的范围，位模式作为rawValue
+    int64_t DoubleBits(ConformanceRng& rng)
+    {
+        double d = std::ldexp((double)rng.Range(-((int64_t)1 << 53), (int64_t)1 << 53), -(int)rng.Range(22, 80));
+        int64_t bits;
+        memcpy(&bits, &d, sizeof(bits));
+        return bits;
+    }
+
+    /// m * 2^-k，|m| < 2^24且k >= -7
+    int64_t FloatBits(ConformanceRng& rng)
+    {
+        float f = std::ldexp((float)rng.Range(-((int64_t)1 << 24), (int64_t)1 << 24), -(int)rng.Range(-7, 40));
+        uint32_t bits;
+        memcpy(&bits, &f, sizeof(bits));
+        return bits;
+    }
+
+    double BitsToDouble(int64_t bits)
+    {
+        double d;
+        memcpy(&d, &bits, sizeof(d));
+        return d;
+    }
+
+    float BitsToFloat(int64_t bits)
+    {
+        uint32_t u = (uint32_t)bits;
+        float f;
+        memcpy(&f, &u, sizeof(f));
+        return f;
+    }
+
+    int64_t DoubleToBits(double d)
+    {
+        int64_t bits;
+        memcpy(&bits, &d, sizeof(bits));
+        return bits;
+    }
+
+    int64_t FloatToBits(float f)
+    {
+        uint32_t bits;
+        memcpy(&bits, &f, sizeof(bits));
+        return bits;
+    }
+
+    /// 文本每8个字符按小端打包为一个rawValue，不足的补0
+    void PutChars(RecordWriter& w, const char* first, const char* last, int words)
+    {
+        for (int i = 0; i < words; ++i)
+        {
+            uint64_t packed = 0;
+            for (int j = 0; j < 8 && first != last; ++j)
+            {
+                packed |= (uint64_t)(unsigned char)*first++ << (8 * j);
+            }
+            w.Raw((int64_t)packed);
+        }
+    }
+
+    /// 2^-17 = 762939453125 * 10^-17，(2k + 1)倍即两个相邻rawValue的中点
+    const uint64_t halfUnit = 762939453125ULL;
+
+    /// <summary>
+    /// 十进制文本的组成：符号、整数部分(-1时省略)、小数部分的数字、小数位数(0时没有小数点).
+    /// 1/4为恰好在两个rawValue中点的17位小数，检验0.5的进位.
+    /// </summary>
+    void GenDecimal(ConformanceRng& rng, RecordWriter& w)
+    {
+        w.Raw((int64_t)(rng.Next() & 1));
+
+        uint64_t kind = rng.Next() & 15;
+        if (kind == 0)
+        {
+            w.Raw(-1);
+        }
+        else if (kind == 1)
+        {
+            // MaxValue、int64_t的上限附近
+            const int64_t limits[] = { maxRaw >> Fix64::fractionBits, INT64_MAX >> Fix64::fractionBits, (INT64_MAX >> Fix64::fractionBits) + 1 };
+            w.Raw(limits[rng.Next() % 3]);
+        }
+        else
+        {
+            int64_t integer = MagnitudeRaw(rng, 49);
+            w.Raw(integer < 0 ? -integer : integer);
+        }
+
+        if ((rng.Next() & 3) == 0)
+        {
+            w.Raw((int64_t)((2 * (rng.Next() % (uint64_t)one) + 1) * halfUnit));
+            w.Raw(17);
+        }
+        else
+        {
+            int count = (int)rng.Range(kind == 0 ? 1 : 0, 19);
+            uint64_t p = 1;
+            for (int i = 0; i < count; ++i)
+            {
+                p *= 10;
+            }
+            w.Raw((int64_t)(rng.Next() % p));
+            w.Raw(count);
+        }
+    }
+
+    /// 按GenDecimal的组成写出文本，返回文本的末尾
+    char* WriteDecimal(RecordReader& r, char* buffer, size_t size)
+    {
+        bool negative = r.Raw() != 0;
+        int64_t integer = r.Raw();
+        uint64_t digits = (uint64_t)r.Raw();
+        int count = (int)r.Raw();
+
+        int length = snprintf(buffer, size, "%s", negative ? "-" : "");
+        if (integer >= 0)
+        {
+            length += snprintf(buffer + length, size - length, "%llu", (unsigned long long)integer);
+        }
+        if (count > 0)
+        {
+            length += snprintf(buffer + length, size - length, ".%0*llu", count, (unsigned long long)digits);
+        }
+        return buffer + length;
+    }
+
+    void GenAny(ConformanceRng& rng, RecordWriter& w) { w.Raw(AnyRaw(rng)); }
+
+    void GenDouble(ConformanceRng& rng, RecordWriter& w) { w.Raw(DoubleBits(rng)); }
+
+    void GenFloat(ConformanceRng& rng, RecordWriter& w) { w.Raw(FloatBits(rng)); }
+
+    void GenFloat3(ConformanceRng& rng, RecordWriter& w) { w.Raw(FloatBits(rng)); w.Raw(FloatBits(rng)); w.Raw(FloatBits(rng)); }
+
+    void GenAny2(ConformanceRng& rng, RecordWriter& w) { w.Raw(AnyRaw(rng)); w.Raw(AnyRaw(rng)); }
+
+    void GenAngle(ConformanceRng& rng, RecordWriter& w) { w.Raw(AngleRaw(rng)); }
+
+    void GenVector2(ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, vectorRange, 2); }
+
+    void GenVector2Pair(ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, vectorRange, 4); }
+
+    void GenVector3(ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, vectorRange, 3); }
+
+    void GenVector3Pair(ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, vectorRange, 6); }
+
+    void GenVector4(ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, vectorRange, 4); }
+
+    void GenVector4Pair(ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, vectorRange, 8); }
+
+    /// 两个向量和插值参数t，t在[-0.25, 1.25]
+    void GenVector3PairT(ConformanceRng& rng, RecordWriter& w)
+    {
+        PutRange(w, rng, vectorRange, 6);
+        w.Raw(rng.Range(-one / 4, one + one / 4));
+    }
+
+    void GenQuaternion(ConformanceRng& rng, RecordWriter& w) { PutUnitQuaternion(w, rng); }
+
+    /// 两个单位四元数和插值参数t，t在[-0.25, 1.25]
+    void GenQuaternionPairT(ConformanceRng& rng, RecordWriter& w)
+    {
+        PutUnitQuaternion(w, rng);
+        PutUnitQuaternion(w, rng);
+        w.Raw(rng.Range(-one / 4, one + one / 4));
+    }
+
+    void GenQuaternionPair(ConformanceRng& rng, RecordWriter& w)
+    {
+        PutUnitQuaternion(w, rng);
+        PutUnitQuaternion(w, rng);
+    }
+
+    void GenMatrix4(ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, matrixRange, 16); }
+
+    void GenMatrix4Pair(ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, matrixRange, 32); }
+
+    void GenMatrix3x4(ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, matrixRange, 12); }
+
+    void GenMatrix3x4Pair(ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, matrixRange, 24); }
+
+    /// 位置、单位四元数、缩放
+    void GenTRS(ConformanceRng& rng, RecordWriter& w)
+    {
+        PutRange(w, rng, vectorRange, 3);
+        PutUnitQuaternion(w, rng);
+        PutRange(w, rng, 4 * one, 3);
+    }
+
+    /************ batch kernels ***********/
+
+    /// 批量运算共用的变换：整数运算构造，不依赖被测代码
+    FMatrix4 FixedTransform()
+    {
+        int64_t q[4] = { 19661, -32768, 45875, 26214 };
+        int64_t r[9];
+        NormalizeRaw(q, 4);
+        RotationRaw(q, r);
+
+        const int64_t scales[3] = { 3 * one / 2, 3 * one / 4, 2 * one };
+        FMatrix4 m = FMatrix4::Identity;
+        for (int row = 0; row < 3; ++row)
+        {
+            for (int col = 0; col < 3; ++col)
+            {
+                m.*matrix4Members[row * 4 + col] = Fix64::FromRawValue(r[row * 3 + col] * scales[row] / one);
+            }
+        }
+        m.m30 = Fix64::FromRawValue(25 * one / 2);
+        m.m31 = Fix64::FromRawValue(-13 * one / 4);
+        m.m32 = Fix64::FromRawValue(100 * one);
+        return m;
+    }
+
+    FMatrix3x4 FixedTransform3x4()
+    {
+        return FMatrix3x4(FixedTransform());
+    }
+
+    FQuaternion FixedRotation()
+    {
+        int64_t q[4] = { -22938, 9830, 39321, 52428 };
+        NormalizeRaw(q, 4);
+        return FQuaternion(Fix64::FromRawValue(q[0]), Fix64::FromRawValue(q[1]), Fix64::FromRawValue(q[2]), Fix64::FromRawValue(q[3]));
+    }
+
+    const Fix64 fixedT = Fix64::FromRawValue(24576);
+
+    void LoadArray(const int64_t* in, size_t stride, size_t offset, size_t count, FVector3Array& a)
+    {
+        a.Resize(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const int64_t* p = in + i * stride + offset;
+            a.X()[i] = p[0];
+            a.Y()[i] = p[1];
+            a.Z()[i] = p[2];
+        }
+    }
+
+    void StoreArray(const FVector3Array& a, int64_t* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            out[i * 3] = a.X()[i];
+            out[i * 3 + 1] = a.Y()[i];
+            out[i * 3 + 2] = a.Z()[i];
+        }
+    }
+
+    std::vector<FVector3> LoadVectors(const int64_t* in, size_t count)
+    {
+        std::vector<FVector3> v;
+        v.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            v.push_back(FVector3(Fix64::FromRawValue(in[i * 3]), Fix64::FromRawValue(in[i * 3 + 1]), Fix64::FromRawValue(in[i * 3 + 2])));
+        }
+        return v;
+    }
+
+    void StoreVectors(const std::vector<FVector3>& v, int64_t* out)
+    {
+        RecordWriter w{ out };
+        for (const FVector3& p : v)
+        {
+            w.Put(p);
+        }
+    }
+
+    void BatchArrayAdd(const int64_t* in, int64_t* out, size_t count)
+    {
+        FVector3Array a, b, c(count);
+        LoadArray(in, 6, 0, count, a);
+        LoadArray(in, 6, 3, count, b);
+        FVector3Array::Add(a, b, c);
+        StoreArray(c, out, count);
+    }
+
+    void BatchArrayDot(const int64_t* in, int64_t* out, size_t count)
+    {
+        FVector3Array a, b;
+        LoadArray(in, 6, 0, count, a);
+        LoadArray(in, 6, 3, count, b);
+        std::vector<Fix64> dots(count);
+        FVector3Array::Dot(a, b, dots.data());
+        for (size_t i = 0; i < count; ++i)
+        {
+            out[i] = dots[i].rawValue;
+        }
+    }
+
+    void BatchArrayCross(const int64_t* in, int64_t* out, size_t count)
+    {
+        FVector3Array a, b, c(count);
+        LoadArray(in, 6, 0, count, a);
+        LoadArray(in, 6, 3, count, b);
+        FVector3Array::Cross(a, b, c);
+        StoreArray(c, out, count);
+    }
+
+    void BatchArrayLerp(const int64_t* in, int64_t* out, size_t count)
+    {
+        FVector3Array a, b, c(count);
+        LoadArray(in, 6, 0, count, a);
+        LoadArray(in, 6, 3, count, b);
+        FVector3Array::Lerp(a, b, fixedT, c);
+        StoreArray(c, out, count);
+    }
+
+    void BatchTransformPoints(const int64_t* in, int64_t* out, size_t count)
+    {
+        static const FMatrix4 m = FixedTransform();
+        std::vector<FVector3> v = LoadVectors(in, count);
+        m.TransformPoints(v.data(), v.data(), count);
+        StoreVectors(v, out);
+    }
+
+    void BatchTransformDirections(const int64_t* in, int64_t* out, size_t count)
+    {
+        static const FMatrix4 m = FixedTransform();
+        std::vector<FVector3> v = LoadVectors(in, count);
+        m.TransformDirections(v.data(), v.data(), count);
+        StoreVectors(v, out);
+    }
+
+    void BatchTransform(const int64_t* in, int64_t* out, size_t count)
+    {
+        static const FMatrix4 m = FixedTransform();
+        std::vector<FVector4> v(count);
+        RecordReader r{ in };
+        for (size_t i = 0; i < count; ++i)
+        {
+            v[i] = r.Vector4();
+        }
+        m.Transform(v.data(), v.data(), count);
+        RecordWriter w{ out };
+        for (size_t i = 0; i < count; ++i)
+        {
+            w.Put(v[i]);
+        }
+    }
+
+    void BatchTransformPoints3x4(const int64_t* in, int64_t* out, size_t count)
+    {
+        static const FMatrix3x4 m = FixedTransform3x4();
+        std::vector<FVector3> v = LoadVectors(in, count);
+        m.TransformPoints(v.data(), v.data(), count);
+        StoreVectors(v, out);
+    }
+
+    void BatchRotate(const int64_t* in, int64_t* out, size_t count)
+    {
+        static const FQuaternion q = FixedRotation();
+        std::vector<FVector3> v = LoadVectors(in, count);
+        q.Rotate(v.data(), v.data(), count);
+        StoreVectors(v, out);
+    }
+
+    void BatchFromDouble(const int64_t* in, int64_t* out, size_t count)
+    {
+        std::vector<double> values(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            values[i] = BitsToDouble(in[i]);
+        }
+        std::vector<Fix64> result(count);
+        Fix64::FromDoubleArray(values.data(), result.data(), count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            out[i] = result[i].rawValue;
+        }
+    }
+
+    void BatchToDouble(const int64_t* in, int64_t* out, size_t count)
+    {
+        std::vector<Fix64> fixes(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            fixes[i] = Fix64::FromRawValue(in[i]);
+        }
+        std::vector<double> values(count);
+        Fix64::ToDoubleArray(fixes.data(), values.data(), count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            out[i] = DoubleToBits(values[i]);
+        }
+    }
+
+    void BatchFromFloat3(const int64_t* in, int64_t* out, size_t count)
+    {
+        std::vector<float> values(count * 3);
+        for (size_t i = 0; i < count * 3; ++i)
+        {
+            values[i] = BitsToFloat(in[i]);
+        }
+        std::vector<FVector3> v(count, FVector3::Zero);
+        FVector3::FromFloatArray(values.data(), v.data(), count);
+        StoreVectors(v, out);
+    }
+
+    void BatchToFloat3(const int64_t* in, int64_t* out, size_t count)
+    {
+        std::vector<FVector3> v = LoadVectors(in, count);
+        std::vector<float> values(count * 3);
+        FVector3::ToFloatArray(v.data(), values.data(), count);
+        for (size_t i = 0; i < count * 3; ++i)
+        {
+            out[i] = FloatToBits(values[i]);
+        }
+    }
+
+    /// 整批写成文本再读回，结果应与输入相同
+    void BatchCharsRoundTrip3(const int64_t* in, int64_t* out, size_t count)
+    {
+        std::vector<FVector3> v = LoadVectors(in, count);
+        std::vector<char> text(count * (3 * Fix64::maxCharsLength + 3));
+        char* last = FVector3::ToChars(v.data(), count, text.data(), text.data() + text.size());
+        std::vector<FVector3> parsed(count, FVector3::Zero);
+        if (last != nullptr)
+        {
+            FVector3::FromChars(text.data(), last, parsed.data(), count);
+        }
+        StoreVectors(parsed, out);
+    }
+
+    void BatchInverse(const int64_t* in, int64_t* out, size_t count)
+    {
+        std::vector<FMatrix4> m(count);
+        RecordReader r{ in };
+        for (size_t i = 0; i < count; ++i)
+        {
+            m[i] = r.Matrix4();
+        }
+        FMatrix4::Inverse(m.data(), m.data(), count);
+        RecordWriter w{ out };
+        for (size_t i = 0; i < count; ++i)
+        {
+            w.Put(m[i]);
+        }
+    }
+
+    /************ registry ***********/
+
+    typedef void (*GenerateFunc)(ConformanceRng& rng, RecordWriter& in);
+    typedef void (*EvaluateFunc)(RecordReader& in, RecordWriter& out);
+    typedef void (*EvaluateBatchFunc)(const int64_t* in, int64_t* out, size_t count);
+
+    /// <summary>
+    /// 一个被测运算：每条记录inputCount个输入rawValue，outputCount个输出rawValue.
+    /// 有evaluateBatch时整段记录一起计算(批量/SIMD实现)，否则逐条调用evaluate.
+    /// </summary>
+    struct ConformanceOp
+    {
+        const char* name;
+        int inputCount;
+        int outputCount;
+        GenerateFunc generate;
+        EvaluateFunc evaluate;
+        EvaluateBatchFunc evaluateBatch;
+    };
+
+    ConformanceOp Op(const char* name, int inputCount, int outputCount, GenerateFunc generate, EvaluateFunc evaluate)
+    {
+        return ConformanceOp{ name, inputCount, outputCount, generate, evaluate, nullptr };
+    }
+
+    ConformanceOp BatchOp(const char* name, int inputCount, int outputCount, GenerateFunc generate, EvaluateBatchFunc evaluate)
+    {
+        return ConformanceOp{ name, inputCount, outputCount, generate, nullptr, evaluate };
+    }
+
+    std::vector<ConformanceOp> CreateOps()
+    {
+        std::vector<ConformanceOp> ops;
+
+        /************ Fix64 ***********/
+
+        ops.push_back(Op("fix64.add", 2, 1, GenAny2, [](RecordReader& r, RecordWriter& w) { Fix64 a = r.Fix(); Fix64 b = r.Fix(); w.Put(a + b); }));
+        ops.push_back(Op("fix64.sub", 2, 1, GenAny2, [](RecordReader& r, RecordWriter& w) { Fix64 a = r.Fix(); Fix64 b = r.Fix(); w.Put(a - b); }));
+        ops.push_back(Op("fix64.mul", 2, 1, GenAny2, [](RecordReader& r, RecordWriter& w) { Fix64 a = r.Fix(); Fix64 b = r.Fix(); w.Put(a * b); }));
+        ops.push_back(Op("fix64.div", 2, 1, GenAny2, [](RecordReader& r, RecordWriter& w) { Fix64 a = r.Fix(); Fix64 b = r.Fix(); w.Put(a / b); }));
+        ops.push_back(Op("fix64.neg", 1, 1, GenAny, [](RecordReader& r, RecordWriter& w) { w.Put(-r.Fix()); }));
+        ops.push_back(Op("fix64.abs", 1, 1, GenAny, [](RecordReader& r, RecordWriter& w) { w.Put(r.Fix().Abs()); }));
+        ops.push_back(Op("fix64.sign", 1, 1, GenAny, [](RecordReader& r, RecordWriter& w) { w.Raw(r.Fix().Sign()); }));
+        ops.push_back(Op("fix64.floor", 1, 1, GenAny, [](RecordReader& r, RecordWriter& w) { w.Raw(r.Fix().Floor()); }));
+        ops.push_back(Op("fix64.lerp", 3, 1,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, vectorRange, 2); w.Raw(RangeRaw(rng, 2 * one)); },
+                         [](RecordReader& r, RecordWriter& w) { Fix64 a = r.Fix(); Fix64 b = r.Fix(); Fix64 t = r.Fix(); w.Put(Fix64::Lerp(a, b, t)); }));
+        ops.push_back(Op("fix64.from_double", 1, 1, GenDouble, [](RecordReader& r, RecordWriter& w) { w.Put(Fix64(BitsToDouble(r.Raw()))); }));
+        ops.push_back(Op("fix64.from_float", 1, 1, GenFloat, [](RecordReader& r, RecordWriter& w) { w.Put(Fix64(BitsToFloat(r.Raw()))); }));
+        // Fix64Q16与Fix64逐位一致：输出Fix64Q16的rawValue和与Fix64的差，差应当总是0
+        ops.push_back(Op("fix64q16.from_double", 1, 2, GenDouble,
+                         [](RecordReader& r, RecordWriter& w)
+                         {
+                             double d = BitsToDouble(r.Raw());
+                             int64_t raw = Fix64Q16(d).rawValue;
+                             w.Raw(raw);
+                             w.Raw(raw - Fix64(d).rawValue);
+                         }));
+        ops.push_back(Op("fix64q16.from_float", 1, 2, GenFloat,
+                         [](RecordReader& r, RecordWriter& w)
+                         {
+                             float f = BitsToFloat(r.Raw());
+                             int64_t raw = Fix64Q16(f).rawValue;
+                             w.Raw(raw);
+                             w.Raw(raw - Fix64(f).rawValue);
+                         }));
+        ops.push_back(Op("fix64.to_double", 1, 1, GenAny, [](RecordReader& r, RecordWriter& w) { w.Raw(DoubleToBits(r.Fix().ToDouble())); }));
+        ops.push_back(Op("fix64.to_float", 1, 1, GenAny, [](RecordReader& r, RecordWriter& w) { w.Raw(FloatToBits(r.Fix().ToSingle())); }));
+        ops.push_back(Op("fix64.to_chars", 1, 3, GenAny,
+                         [](RecordReader& r, RecordWriter& w)
+                         {
+                             char buffer[Fix64::maxCharsLength];
+                             PutChars(w, buffer, r.Fix().ToChars(buffer, buffer + sizeof(buffer)), 3);
+                         }));
+        ops.push_back(Op("fix64.to_chars_exact", 1, 4, GenAny,
+                         [](RecordReader& r, RecordWriter& w)
+                         {
+                             char buffer[Fix64::maxCharsLength];
+                             PutChars(w, buffer, r.Fix().ToCharsExact(buffer, buffer + sizeof(buffer)), 4);
+                         }));
+        ops.push_back(Op("fix64.chars_round_trip", 1, 2,
+                         [](ConformanceRng& rng, RecordWriter& w)
+                         {
+                             // 运算回绕后的值也要能读回：取整个int64_t的范围
+                             uint64_t kind = rng.Next() & 7;
+                             w.Raw(kind == 0 ? ((rng.Next() & 1) != 0 ? INT64_MIN : INT64_MAX) : (int64_t)rng.Next());
+                         },
+                         [](RecordReader& r, RecordWriter& w)
+                         {
+                             Fix64 x = r.Fix();
+                             char buffer[Fix64::maxCharsLength];
+                             Fix64 shortest = Fix64::FromRawValue(0);
+                             Fix64 exact = Fix64::FromRawValue(0);
+                             Fix64::FromChars(buffer, x.ToChars(buffer, buffer + sizeof(buffer)), shortest);
+                             Fix64::FromChars(buffer, x.ToCharsExact(buffer, buffer + sizeof(buffer)), exact);
+                             w.Put(shortest);
+                             w.Put(exact);
+                         }));
+        ops.push_back(Op("fix64.from_chars", 4, 3, GenDecimal,
+                         [](RecordReader& r, RecordWriter& w)
+                         {
+                             // 输出是否成功、读到的位置和结果，失败时value不变
+                             char buffer[48];
+                             const char* last = WriteDecimal(r, buffer, sizeof(buffer));
+                             Fix64 value = Fix64::FromRawValue(0);
+                             const char* end = Fix64::FromChars(buffer, last, value);
+                             w.Raw(end != nullptr ? 1 : 0);
+                             w.Raw(end != nullptr ? end - buffer : 0);
+                             w.Put(value);
+                         }));
+        ops.push_back(Op("fix64.sqrt", 1, 1, GenAny, [](RecordReader& r, RecordWriter& w) { Fix64 x = r.Fix(); w.Put(x.Sqrt()); }));
+        ops.push_back(Op("fix64.inv_sqrt", 1, 1, GenAny, [](RecordReader& r, RecordWriter& w) { Fix64 x = r.Fix(); w.Put(x.InvSqrt()); }));
+        ops.push_back(Op("fix64.sin", 1, 1, GenAngle, [](RecordReader& r, RecordWriter& w) { w.Put(Fix64::Sin(r.Fix())); }));
+        ops.push_back(Op("fix64.cos", 1, 1, GenAngle, [](RecordReader& r, RecordWriter& w) { w.Put(Fix64::Cos(r.Fix())); }));
+        ops.push_back(Op("fix64.tan", 1, 1, GenAngle, [](RecordReader& r, RecordWriter& w) { w.Put(Fix64::Tan(r.Fix())); }));
+        ops.push_back(Op("fix64.asin", 1, 1,
+                         [](ConformanceRng& rng, RecordWriter& w) { w.Raw(RangeRaw(rng, one + one / 4)); },
+                         [](RecordReader& r, RecordWriter& w) { w.Put(Fix64::Asin(r.Fix())); }));
+        ops.push_back(Op("fix64.acos", 1, 1,
+                         [](ConformanceRng& rng, RecordWriter& w) { w.Raw(RangeRaw(rng, one + one / 4)); },
+                         [](RecordReader& r, RecordWriter& w) { w.Put(Fix64::Acos(r.Fix())); }));
+        ops.push_back(Op("fix64.atan", 1, 1, GenAny, [](RecordReader& r, RecordWriter& w) { w.Put(Fix64::Atan(r.Fix())); }));
+        ops.push_back(Op("fix64.atan2", 2, 1, GenAny2, [](RecordReader& r, RecordWriter& w) { Fix64 y = r.Fix(); Fix64 x = r.Fix(); w.Put(Fix64::Atan2(y, x)); }));
+        ops.push_back(Op("fix64.exp", 1, 1,
+                         [](ConformanceRng& rng, RecordWriter& w) { w.Raw(RangeRaw(rng, 32 * one)); },
+                         [](RecordReader& r, RecordWriter& w) { w.Put(Fix64::Exp(r.Fix())); }));
+        ops.push_back(Op("fix64.exp2", 1, 1,
+                         [](ConformanceRng& rng, RecordWriter& w) { w.Raw(RangeRaw(rng, 40 * one)); },
+                         [](RecordReader& r, RecordWriter& w) { w.Put(Fix64::Exp2(r.Fix())); }));
+        ops.push_back(Op("fix64.log", 1, 1, GenAny, [](RecordReader& r, RecordWriter& w) { w.Put(Fix64::Log(r.Fix())); }));
+        ops.push_back(Op("fix64.log2", 1, 1, GenAny, [](RecordReader& r, RecordWriter& w) { w.Put(Fix64::Log2(r.Fix())); }));
+        ops.push_back(Op("fix64.pow", 2, 1,
+                         [](ConformanceRng& rng, RecordWriter& w)
+                         {
+                             // 一半为整数次幂(包括负底数)
+                             w.Raw(RangeRaw(rng, 256 * one));
+                             int64_t y = RangeRaw(rng, 8 * one);
+                             w.Raw((rng.Next() & 1) != 0 ? y & ~(one - 1) : y);
+                         },
+                         [](RecordReader& r, RecordWriter& w) { Fix64 x = r.Fix(); Fix64 y = r.Fix(); w.Put(Fix64::Pow(x, y)); }));
+
+        /************ FVector2 ***********/
+
+        ops.push_back(Op("fvector2.add", 4, 2, GenVector2Pair, [](RecordReader& r, RecordWriter& w) { FVector2 a = r.Vector2(); FVector2 b = r.Vector2(); w.Put(a + b); }));
+        ops.push_back(Op("fvector2.sub", 4, 2, GenVector2Pair, [](RecordReader& r, RecordWriter& w) { FVector2 a = r.Vector2(); FVector2 b = r.Vector2(); w.Put(a - b); }));
+        ops.push_back(Op("fvector2.scale", 3, 2,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, vectorRange, 2); w.Raw(RangeRaw(rng, 16 * one)); },
+                         [](RecordReader& r, RecordWriter& w) { FVector2 a = r.Vector2(); Fix64 s = r.Fix(); w.Put(a * s); }));
+        ops.push_back(Op("fvector2.dot", 4, 1, GenVector2Pair, [](RecordReader& r, RecordWriter& w) { FVector2 a = r.Vector2(); FVector2 b = r.Vector2(); w.Put(FVector2::Dot(a, b)); }));
+        ops.push_back(Op("fvector2.magnitude", 2, 1, GenVector2, [](RecordReader& r, RecordWriter& w) { FVector2 a = r.Vector2(); w.Put(a.Magnitude()); }));
+        ops.push_back(Op("fvector2.normalized", 2, 2, GenVector2, [](RecordReader& r, RecordWriter& w) { FVector2 a = r.Vector2(); w.Put(a.Normalized()); }));
+        ops.push_back(Op("fvector2.angle", 4, 1, GenVector2Pair, [](RecordReader& r, RecordWriter& w) { FVector2 a = r.Vector2(); FVector2 b = r.Vector2(); w.Put(FVector2::Angle(a, b)); }));
+        ops.push_back(Op("fvector2.signed_angle", 4, 1, GenVector2Pair, [](RecordReader& r, RecordWriter& w) { FVector2 a = r.Vector2(); FVector2 b = r.Vector2(); w.Put(FVector2::SignedAngle(a, b)); }));
+        ops.push_back(Op("fvector2.lerp", 5, 2,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, vectorRange, 4); w.Raw(rng.Range(-one / 4, one + one / 4)); },
+                         [](RecordReader& r, RecordWriter& w) { FVector2 a = r.Vector2(); FVector2 b = r.Vector2(); Fix64 t = r.Fix(); w.Put(FVector2::Lerp(a, b, t)); }));
+
+        /************ FVector3 ***********/
+
+        ops.push_back(Op("fvector3.add", 6, 3, GenVector3Pair, [](RecordReader& r, RecordWriter& w) { FVector3 a = r.Vector3(); FVector3 b = r.Vector3(); w.Put(a + b); }));
+        ops.push_back(Op("fvector3.sub", 6, 3, GenVector3Pair, [](RecordReader& r, RecordWriter& w) { FVector3 a = r.Vector3(); FVector3 b = r.Vector3(); w.Put(a - b); }));
+        ops.push_back(Op("fvector3.scale", 4, 3,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, vectorRange, 3); w.Raw(RangeRaw(rng, 16 * one)); },
+                         [](RecordReader& r, RecordWriter& w) { FVector3 a = r.Vector3(); Fix64 s = r.Fix(); w.Put(a * s); }));
+        ops.push_back(Op("fvector3.dot", 6, 1, GenVector3Pair, [](RecordReader& r, RecordWriter& w) { FVector3 a = r.Vector3(); FVector3 b = r.Vector3(); w.Put(FVector3::Dot(a, b)); }));
+        ops.push_back(Op("fvector3.cross", 6, 3, GenVector3Pair, [](RecordReader& r, RecordWriter& w) { FVector3 a = r.Vector3(); FVector3 b = r.Vector3(); w.Put(FVector3::Cross(a, b)); }));
+        ops.push_back(Op("fvector3.magnitude", 3, 1, GenVector3, [](RecordReader& r, RecordWriter& w) { w.Put(r.Vector3().Magnitude()); }));
+        ops.push_back(Op("fvector3.normalized", 3, 3, GenVector3, [](RecordReader& r, RecordWriter& w) { w.Put(r.Vector3().Normalized()); }));
+        ops.push_back(Op("fvector3.normalized_fast", 3, 3, GenVector3, [](RecordReader& r, RecordWriter& w) { w.Put(r.Vector3().NormalizedFast()); }));
+        ops.push_back(Op("fvector3.lerp", 7, 3, GenVector3PairT,
+                         [](RecordReader& r, RecordWriter& w) { FVector3 a = r.Vector3(); FVector3 b = r.Vector3(); Fix64 t = r.Fix(); w.Put(FVector3::Lerp(a, b, t)); }));
+        ops.push_back(Op("fvector3.angle", 6, 1, GenVector3Pair, [](RecordReader& r, RecordWriter& w) { FVector3 a = r.Vector3(); FVector3 b = r.Vector3(); w.Put(FVector3::Angle(a, b)); }));
+        ops.push_back(Op("fvector3.signed_angle", 9, 1,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, vectorRange, 6); PutUnitVector3(w, rng); },
+                         [](RecordReader& r, RecordWriter& w)
+                         {
+                             FVector3 a = r.Vector3();
+                             FVector3 b = r.Vector3();
+                             FVector3 axis = r.Vector3();
+                             w.Put(FVector3::SignedAngle(a, b, axis));
+                         }));
+        ops.push_back(Op("fvector3.slerp", 7, 3,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutUnitVector3(w, rng); PutUnitVector3(w, rng); w.Raw(rng.Range(0, one)); },
+                         [](RecordReader& r, RecordWriter& w) { FVector3 a = r.Vector3(); FVector3 b = r.Vector3(); Fix64 t = r.Fix(); w.Put(FVector3::Slerp(a, b, t)); }));
+        ops.push_back(Op("fvector3.reflect", 6, 3,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, vectorRange, 3); PutUnitVector3(w, rng); },
+                         [](RecordReader& r, RecordWriter& w) { FVector3 a = r.Vector3(); FVector3 n = r.Vector3(); w.Put(FVector3::Reflect(a, n)); }));
+        ops.push_back(Op("fvector3.project", 6, 3, GenVector3Pair,
+                         [](RecordReader& r, RecordWriter& w) { FVector3 a = r.Vector3(); FVector3 n = r.Vector3(); w.Put(FVector3::Project(a, n)); }));
+
+        /************ FVector4 ***********/
+
+        ops.push_back(Op("fvector4.add", 8, 4, GenVector4Pair, [](RecordReader& r, RecordWriter& w) { FVector4 a = r.Vector4(); FVector4 b = r.Vector4(); w.Put(a + b); }));
+        ops.push_back(Op("fvector4.dot", 8, 1, GenVector4Pair, [](RecordReader& r, RecordWriter& w) { FVector4 a = r.Vector4(); FVector4 b = r.Vector4(); w.Put(FVector4::Dot(a, b)); }));
+        ops.push_back(Op("fvector4.magnitude", 4, 1, GenVector4, [](RecordReader& r, RecordWriter& w) { w.Put(r.Vector4().Magnitude()); }));
+        ops.push_back(Op("fvector4.normalized", 4, 4, GenVector4, [](RecordReader& r, RecordWriter& w) { w.Put(r.Vector4().Normalized()); }));
+        ops.push_back(Op("fvector4.lerp", 9, 4,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, vectorRange, 8); w.Raw(rng.Range(0, one)); },
+                         [](RecordReader& r, RecordWriter& w) { FVector4 a = r.Vector4(); FVector4 b = r.Vector4(); Fix64 t = r.Fix(); w.Put(FVector4::Lerp(a, b, t)); }));
+
+        /************ FMatrix4 ***********/
+
+        ops.push_back(Op("fmatrix4.mul", 32, 16, GenMatrix4Pair, [](RecordReader& r, RecordWriter& w) { FMatrix4 a = r.Matrix4(); FMatrix4 b = r.Matrix4(); w.Put(a * b); }));
+        ops.push_back(Op("fmatrix4.mul_vector4", 20, 4,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, matrixRange, 16); PutRange(w, rng, vectorRange, 4); },
+                         [](RecordReader& r, RecordWriter& w) { FMatrix4 m = r.Matrix4(); FVector4 v = r.Vector4(); w.Put(m * v); }));
+        ops.push_back(Op("fmatrix4.multiply_point", 19, 3,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutTransform(w, rng, 4, true); PutRange(w, rng, vectorRange, 3); },
+                         [](RecordReader& r, RecordWriter& w) { FMatrix4 m = r.Matrix4(); FVector3 p = r.Vector3(); w.Put(m.MultiplyPoint(p)); }));
+        ops.push_back(Op("fmatrix4.multiply_vector", 19, 3,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutTransform(w, rng, 4, true); PutRange(w, rng, vectorRange, 3); },
+                         [](RecordReader& r, RecordWriter& w) { FMatrix4 m = r.Matrix4(); FVector3 v = r.Vector3(); w.Put(m.MultiplyVector(v)); }));
+        ops.push_back(Op("fmatrix4.determinant", 16, 1, GenMatrix4, [](RecordReader& r, RecordWriter& w) { w.Put(r.Matrix4().Determinant()); }));
+        ops.push_back(Op("fmatrix4.inverse", 16, 16, GenMatrix4, [](RecordReader& r, RecordWriter& w) { w.Put(r.Matrix4().Inverse()); }));
+        ops.push_back(Op("fmatrix4.inverse_affine", 16, 16,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutTransform(w, rng, 4, true); },
+                         [](RecordReader& r, RecordWriter& w) { w.Put(r.Matrix4().InverseAffine()); }));
+        ops.push_back(Op("fmatrix4.inverse_rigid", 16, 16,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutTransform(w, rng, 4, false); },
+                         [](RecordReader& r, RecordWriter& w) { w.Put(r.Matrix4().InverseRigid()); }));
+        ops.push_back(Op("fmatrix4.from_quaternion", 4, 16, GenQuaternion, [](RecordReader& r, RecordWriter& w) { w.Put(FMatrix4::FromQuaternion(r.Quaternion())); }));
+        ops.push_back(Op("fmatrix4.trs", 10, 16, GenTRS,
+                         [](RecordReader& r, RecordWriter& w)
+                         {
+                             FVector3 pos = r.Vector3();
+                             FQuaternion q = r.Quaternion();
+                             FVector3 scale = r.Vector3();
+                             w.Put(FMatrix4::TRS(pos, q, scale));
+                         }));
+
+        /************ FMatrix3x4 ***********/
+
+        ops.push_back(Op("fmatrix3x4.mul", 24, 12, GenMatrix3x4Pair, [](RecordReader& r, RecordWriter& w) { FMatrix3x4 a = r.Matrix3x4(); FMatrix3x4 b = r.Matrix3x4(); w.Put(a * b); }));
+        ops.push_back(Op("fmatrix3x4.multiply_point", 15, 3,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutTransform(w, rng, 3, true); PutRange(w, rng, vectorRange, 3); },
+                         [](RecordReader& r, RecordWriter& w) { FMatrix3x4 m = r.Matrix3x4(); FVector3 p = r.Vector3(); w.Put(m.MultiplyPoint(p)); }));
+        ops.push_back(Op("fmatrix3x4.determinant", 12, 1, GenMatrix3x4, [](RecordReader& r, RecordWriter& w) { w.Put(r.Matrix3x4().Determinant()); }));
+        ops.push_back(Op("fmatrix3x4.inverse", 12, 12, GenMatrix3x4, [](RecordReader& r, RecordWriter& w) { w.Put(r.Matrix3x4().Inverse()); }));
+        ops.push_back(Op("fmatrix3x4.inverse_rigid", 12, 12,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutTransform(w, rng, 3, false); },
+                         [](RecordReader& r, RecordWriter& w) { w.Put(r.Matrix3x4().InverseRigid()); }));
+        ops.push_back(Op("fmatrix3x4.inverse_scaled", 12, 12,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutTransform(w, rng, 3, true); },
+                         [](RecordReader& r, RecordWriter& w) { w.Put(r.Matrix3x4().InverseScaled()); }));
+        ops.push_back(Op("fmatrix3x4.trs", 10, 12, GenTRS,
+                         [](RecordReader& r, RecordWriter& w)
+                         {
+                             FVector3 pos = r.Vector3();
+                             FQuaternion q = r.Quaternion();
+                             FVector3 scale = r.Vector3();
+                             w.Put(FMatrix3x4::TRS(pos, q, scale));
+                         }));
+
+        /************ FQuaternion ***********/
+
+        ops.push_back(Op("fquaternion.mul", 8, 4, GenQuaternionPair, [](RecordReader& r, RecordWriter& w) { FQuaternion a = r.Quaternion(); FQuaternion b = r.Quaternion(); w.Put(a * b); }));
+        ops.push_back(Op("fquaternion.rotate", 7, 3,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutUnitQuaternion(w, rng); PutRange(w, rng, vectorRange, 3); },
+                         [](RecordReader& r, RecordWriter& w) { FQuaternion q = r.Quaternion(); FVector3 v = r.Vector3(); w.Put(q.Rotate(v)); }));
+        ops.push_back(Op("fquaternion.dot", 8, 1, GenQuaternionPair, [](RecordReader& r, RecordWriter& w) { FQuaternion a = r.Quaternion(); FQuaternion b = r.Quaternion(); w.Put(FQuaternion::Dot(a, b)); }));
+        ops.push_back(Op("fquaternion.normalized", 4, 4,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, 4 * one, 4); },
+                         [](RecordReader& r, RecordWriter& w) { w.Put(r.Quaternion().Normalized()); }));
+        ops.push_back(Op("fquaternion.normalized_fast", 4, 4,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, 4 * one, 4); },
+                         [](RecordReader& r, RecordWriter& w) { w.Put(r.Quaternion().NormalizedFast()); }));
+        ops.push_back(Op("fquaternion.inverse", 4, 4,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, 4 * one, 4); },
+                         [](RecordReader& r, RecordWriter& w) { w.Put(FQuaternion::Inverse(r.Quaternion())); }));
+        ops.push_back(Op("fquaternion.angle", 8, 1, GenQuaternionPair, [](RecordReader& r, RecordWriter& w) { FQuaternion a = r.Quaternion(); FQuaternion b = r.Quaternion(); w.Put(FQuaternion::Angle(a, b)); }));
+        ops.push_back(Op("fquaternion.angle_axis", 4, 4,
+                         [](ConformanceRng& rng, RecordWriter& w) { w.Raw(AngleRaw(rng)); PutUnitVector3(w, rng); },
+                         [](RecordReader& r, RecordWriter& w) { Fix64 angle = r.Fix(); FVector3 axis = r.Vector3(); w.Put(FQuaternion::AngleAxis(angle, axis)); }));
+        ops.push_back(Op("fquaternion.from_to_rotation", 6, 4,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutUnitVector3(w, rng); PutUnitVector3(w, rng); },
+                         [](RecordReader& r, RecordWriter& w) { FVector3 a = r.Vector3(); FVector3 b = r.Vector3(); w.Put(FQuaternion::FromToRotation(a, b)); }));
+        ops.push_back(Op("fquaternion.from_euler", 3, 4,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, 4 * Fix64::PI.rawValue, 3); },
+                         [](RecordReader& r, RecordWriter& w) { w.Put(FQuaternion::FromEuler(r.Vector3())); }));
+        ops.push_back(Op("fquaternion.to_euler", 4, 3, GenQuaternion, [](RecordReader& r, RecordWriter& w) { w.Put(r.Quaternion().ToEuler()); }));
+        ops.push_back(Op("fquaternion.from_matrix", 12, 4,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutTransform(w, rng, 3, false); },
+                         [](RecordReader& r, RecordWriter& w) { w.Put(FQuaternion::FromMatrix(r.Matrix3x4())); }));
+        ops.push_back(Op("fquaternion.nlerp", 9, 4, GenQuaternionPairT,
+                         [](RecordReader& r, RecordWriter& w) { FQuaternion a = r.Quaternion(); FQuaternion b = r.Quaternion(); Fix64 t = r.Fix(); w.Put(FQuaternion::Nlerp(a, b, t)); }));
+        ops.push_back(Op("fquaternion.slerp", 9, 4, GenQuaternionPairT,
+                         [](RecordReader& r, RecordWriter& w) { FQuaternion a = r.Quaternion(); FQuaternion b = r.Quaternion(); Fix64 t = r.Fix(); w.Put(FQuaternion::Slerp(a, b, t)); }));
+        ops.push_back(Op("fquaternion.slerp_fast", 9, 4,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutUnitQuaternion(w, rng); PutUnitQuaternion(w, rng); w.Raw(rng.Range(0, one)); },
+                         [](RecordReader& r, RecordWriter& w) { FQuaternion a = r.Quaternion(); FQuaternion b = r.Quaternion(); Fix64 t = r.Fix(); w.Put(FQuaternion::SlerpFast(a, b, t)); }));
+        ops.push_back(Op("fquaternion.log", 4, 4, GenQuaternion, [](RecordReader& r, RecordWriter& w) { w.Put(FQuaternion::Log(r.Quaternion())); }));
+        ops.push_back(Op("fquaternion.exp", 4, 4,
+                         [](ConformanceRng& rng, RecordWriter& w) { PutRange(w, rng, 4 * one, 3); w.Raw(0); },
+                         [](RecordReader& r, RecordWriter& w) { w.Put(FQuaternion::Exp(r.Quaternion())); }));
+
+        /************ batch ***********/
+
+        ops.push_back(BatchOp("fix64.from_double_array", 1, 1, GenDouble, BatchFromDouble));
+        ops.push_back(BatchOp("fix64.to_double_array", 1, 1, GenAny, BatchToDouble));
+        ops.push_back(BatchOp("fvector3.from_float_array", 3, 3, GenFloat3, BatchFromFloat3));
+        ops.push_back(BatchOp("fvector3.to_float_array", 3, 3, GenVector3, BatchToFloat3));
+        ops.push_back(BatchOp("fvector3.chars_round_trip", 3, 3, GenVector3, BatchCharsRoundTrip3));
+        ops.push_back(BatchOp("fvector3array.add", 6, 3, GenVector3Pair, BatchArrayAdd));
+        ops.push_back(BatchOp("fvector3array.dot", 6, 1, GenVector3Pair, BatchArrayDot));
+        ops.push_back(BatchOp("fvector3array.cross", 6, 3, GenVector3Pair, BatchArrayCross));
+        ops.push_back(BatchOp("fvector3array.lerp", 6, 3, GenVector3Pair, BatchArrayLerp));
+        ops.push_back(BatchOp("fmatrix4.transform_points", 3, 3, GenVector3, BatchTransformPoints));
+        ops.push_back(BatchOp("fmatrix4.transform_directions", 3, 3, GenVector3, BatchTransformDirections));
+        ops.push_back(BatchOp("fmatrix4.transform", 4, 4, GenVector4, BatchTransform));
+        ops.push_back(BatchOp("fmatrix4.inverse_batch", 16, 16, GenMatrix4, BatchInverse));
+        ops.push_back(BatchOp("fmatrix3x4.transform_points", 3, 3, GenVector3, BatchTransformPoints3x4));
+        ops.push_back(BatchOp("fquaternion.rotate_batch", 3, 3, GenVector3, BatchRotate));
+
+        return ops;
+    }
+
+    const std::vector<ConformanceOp>& Ops()
+    {
+        static const std::vector<ConformanceOp> ops = CreateOps();
+        return ops;
+    }
+
+    bool Selected(const ConformanceOp& op, const ConformanceOptions& options)
+    {
+        return options.filter == nullptr || strstr(op.name, options.filter) != nullptr;
+    }
+
+    const ConformanceOp* FindOp(const std::string& name)
+    {
+        for (const ConformanceOp& op : Ops())
+        {
+            if (name == op.name)
+            {
+                return &op;
+            }
+        }
+        return nullptr;
+    }
+
+    /************ evaluation ***********/
+
+    /// 运算名的FNV-1a哈希，与种子一起决定运算的输入
+    uint64_t HashName(const char* name)
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        for (const char* p = name; *p != '\0'; ++p)
+        {
+            hash = (hash ^ (uint8_t)*p) * 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    /// 生成count条记录的输入，生成的个数与inputCount不符时终止(注册表写错)
+    void GenerateInputs(const ConformanceOp& op, ConformanceRng& rng, int64_t* in, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            RecordWriter w{ in + i * op.inputCount };
+            op.generate(rng, w);
+            if (w.p != in + (i + 1) * op.inputCount)
+            {
+                fprintf(stderr, "conformance op %s: generator wrote %d values, expected %d\n",
+                        op.name, (int)(w.p - in - i * op.inputCount), op.inputCount);
+                abort();
+            }
+        }
+    }
+
+    void Evaluate(const ConformanceOp& op, const int64_t* in, int64_t* out, size_t count)
+    {
+        if (op.evaluateBatch != nullptr)
+        {
+            op.evaluateBatch(in, out, count);
+            return;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            RecordReader r{ in + i * op.inputCount };
+            RecordWriter w{ out + i * op.outputCount };
+            op.evaluate(r, w);
+            if (r.p != in + (i + 1) * op.inputCount || w.p != out + (i + 1) * op.outputCount)
+            {
+                fprintf(stderr, "conformance op %s: record size does not match %d -> %d\n", op.name, op.inputCount, op.outputCount);
+                abort();
+            }
+        }
+    }
+
+    /// 逐个rawValue累积的64位摘要
+    struct Digest
+    {
+        uint64_t hash = 0xCBF29CE484222325ULL;
+
+        void Add(const int64_t* values, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                hash = (hash ^ (uint64_t)values[i]) * 0x100000001B3ULL;
+                hash ^= hash >> 29;
+            }
+        }
+    };
+
+    /// <summary>
+    /// 按段计算op前recordCount条记录的摘要.
+    /// </summary>
+    std::vector<uint64_t> ComputeDigests(const ConformanceOp& op, uint64_t seed, size_t recordCount, size_t chunkSize)
+    {
+        ConformanceRng rng(seed ^ HashName(op.name));
+        std::vector<int64_t> in(chunkSize * op.inputCount), out(chunkSize * op.outputCount);
+        std::vector<uint64_t> digests;
+        for (size_t start = 0; start < recordCount; start += chunkSize)
+        {
+            size_t count = std::min(chunkSize, recordCount - start);
+            GenerateInputs(op, rng, in.data(), count);
+            Evaluate(op, in.data(), out.data(), count);
+
+            Digest digest;
+            digest.Add(in.data(), count * op.inputCount);
+            digest.Add(out.data(), count * op.outputCount);
+            digests.push_back(digest.hash);
+        }
+        return digests;
+    }
+
+    /************ corpus file ***********/
+
+    const char corpusMagic[8] = { 'F', 'X', 'C', 'O', 'R', 'P', 'U', 'S' };
+    const uint32_t corpusVersion = 1;
+    const size_t corpusHeaderSize = 40;
+
+    void EncodeLE(uint64_t v, uint8_t* p, int bytes)
+    {
+        for (int i = 0; i < bytes; ++i)
+        {
+            p[i] = (uint8_t)(v >> (8 * i));
+        }
+    }
+
+    uint64_t DecodeLE(const uint8_t* p, int bytes)
+    {
+        uint64_t v = 0;
+        for (int i = 0; i < bytes; ++i)
+        {
+            v |= (uint64_t)p[i] << (8 * i);
+        }
+        return v;
+    }
+
+    std::string CorpusPath(const char* dir, const ConformanceOp& op)
+    {
+        return std::string(dir) + "/" + op.name + ".fxc";
+    }
+
+    /// 文件头：magic、version、inputCount、outputCount、保留、recordCount、seed
+    void EncodeHeader(const ConformanceOp& op, uint64_t recordCount, uint64_t seed, uint8_t* p)
+    {
+        memcpy(p, corpusMagic, 8);
+        EncodeLE(corpusVersion, p + 8, 4);
+        EncodeLE((uint64_t)op.inputCount, p + 12, 4);
+        EncodeLE((uint64_t)op.outputCount, p + 16, 4);
+        EncodeLE(0, p + 20, 4);
+        EncodeLE(recordCount, p + 24, 8);
+        EncodeLE(seed, p + 32, 8);
+    }
+
+    std::string FormatRecord(const int64_t* values, int count)
+    {
+        std::ostringstream s;
+        for (int i = 0; i < count; ++i)
+        {
+            s << (i > 0 ? " " : "") << values[i];
+        }
+        return s.str();
+    }
+
+    /// <summary>
+    /// 流式校验一个语料文件.
+    /// </summary>
+    /// <returns>是否完全一致</returns>
+    bool CheckCorpusFile(const ConformanceOp& op, const char* dir, const ConformanceOptions& options)
+    {
+        std::string path = CorpusPath(dir, op);
+        FILE* file = fopen(path.c_str(), "rb");
+        if (file == nullptr)
+        {
+            std::cout << "  " << op.name << "  missing " << path << std::endl;
+            return false;
+        }
+
+        uint8_t header[corpusHeaderSize];
+        if (fread(header, 1, corpusHeaderSize, file) != corpusHeaderSize || memcmp(header, corpusMagic, 8) != 0
+            || DecodeLE(header + 8, 4) != corpusVersion
+            || DecodeLE(header + 12, 4) != (uint64_t)op.inputCount || DecodeLE(header + 16, 4) != (uint64_t)op.outputCount)
+        {
+            std::cout << "  " << op.name << "  bad header in " << path << std::endl;
+            fclose(file);
+            return false;
+        }
+
+        uint64_t recordCount = DecodeLE(header + 24, 8);
+        const size_t recordSize = op.inputCount + op.outputCount;
+        std::vector<uint8_t> bytes(options.chunkSize * recordSize * 8);
+        std::vector<int64_t> in(options.chunkSize * op.inputCount);
+        std::vector<int64_t> expected(options.chunkSize * op.outputCount), actual(options.chunkSize * op.outputCount);
+
+        uint64_t mismatchCount = 0;
+        for (uint64_t start = 0; start < recordCount; start += options.chunkSize)
+        {
+            size_t count = (size_t)std::min<uint64_t>(options.chunkSize, recordCount - start);
+            if (fread(bytes.data(), 1, count * recordSize * 8, file) != count * recordSize * 8)
+            {
+                std::cout << "  " << op.name << "  truncated at record " << start << std::endl;
+                fclose(file);
+                return false;
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint8_t* p = bytes.data() + i * recordSize * 8;
+                for (int k = 0; k < op.inputCount; ++k)
+                {
+                    in[i * op.inputCount + k] = (int64_t)DecodeLE(p + k * 8, 8);
+                }
+                for (int k = 0; k < op.outputCount; ++k)
+                {
+                    expected[i * op.outputCount + k] = (int64_t)DecodeLE(p + (op.inputCount + k) * 8, 8);
+                }
+            }
+
+            Evaluate(op, in.data(), actual.data(), count);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (memcmp(&expected[i * op.outputCount], &actual[i * op.outputCount], op.outputCount * sizeof(int64_t)) == 0)
+                {
+                    continue;
+                }
+                if (mismatchCount < (uint64_t)options.maxReports)
+                {
+                    std::cout << "  " << op.name << "  record " << (start + i)
+                              << "  input = [" << FormatRecord(&in[i * op.inputCount], op.inputCount) << "]"
+                              << "  expected = [" << FormatRecord(&expected[i * op.outputCount], op.outputCount) << "]"
+                              << "  actual = [" << FormatRecord(&actual[i * op.outputCount], op.outputCount) << "]" << std::endl;
+                }
+                ++mismatchCount;
+            }
+        }
+        fclose(file);
+
+        if (mismatchCount > 0)
+        {
+            std::cout << "  " << op.name << "  FAILED  mismatch = " << mismatchCount << " / " << recordCount << std::endl;
+        }
+        return mismatchCount == 0;
+    }
+
+    /************ cases ***********/
+
+    // 手写期望值的用例：期望值按定义推算，不由被测代码生成，用于校验奇异矩阵和范围边界的处理
+
+    const int64_t e = 1;
+
+    /// 一个rawValue的ulp之内的2^15，两个矩阵元素相乘恰好差1个rawValue
+    const int64_t nearSingular = (int64_t)32768 << Fix64::fractionBits;
+
+    struct Matrix4Case
+    {
+        const char* name;
+        int64_t input[16];
+        bool ok;
+        int64_t expected[16];
+    };
+
+    const Matrix4Case matrix4Cases[] =
+    {
+        { "identity",
+          { one, 0, 0, 0,  0, one, 0, 0,  0, 0, one, 0,  0, 0, 0, one }, true,
+          { one, 0, 0, 0,  0, one, 0, 0,  0, 0, one, 0,  0, 0, 0, one } },
+        { "diag(2, 4, 0.5, 1)",
+          { 2 * one, 0, 0, 0,  0, 4 * one, 0, 0,  0, 0, one / 2, 0,  0, 0, 0, one }, true,
+          { one / 2, 0, 0, 0,  0, one / 4, 0, 0,  0, 0, 2 * one, 0,  0, 0, 0, one } },
+        { "translate(1, 2, 3)",
+          { one, 0, 0, 0,  0, one, 0, 0,  0, 0, one, 0,  one, 2 * one, 3 * one, one }, true,
+          { one, 0, 0, 0,  0, one, 0, 0,  0, 0, one, 0,  -one, -2 * one, -3 * one, one } },
+        // 伴随矩阵的元素为2048^2 = 2^22，左移16位超出64位
+        { "scale(2048)",
+          { 2048 * one, 0, 0, 0,  0, 2048 * one, 0, 0,  0, 0, 2048 * one, 0,  0, 0, 0, one }, true,
+          { 32, 0, 0, 0,  0, 32, 0, 0,  0, 0, 32, 0,  0, 0, 0, one } },
+        // 1 / 60000 = 1.09个rawValue，向0截断为1
+        { "diag(60000, 60000, 1, 1)",
+          { 60000 * one, 0, 0, 0,  0, 60000 * one, 0, 0,  0, 0, one, 0,  0, 0, 0, one }, true,
+          { 1, 0, 0, 0,  0, 1, 0, 0,  0, 0, one, 0,  0, 0, 0, one } },
+        { "zero",
+          { 0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0 }, false,
+          { 0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0 } },
+        { "equal rows",
+          { one, 2 * one, 3 * one, 0,  one, 2 * one, 3 * one, 0,  0, 0, one, 0,  0, 0, 0, one }, false,
+          { 0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0 } },
+        // 行列式为1个rawValue，逆矩阵的元素约为2^31，超出MaxValue
+        { "near singular",
+          { nearSingular, nearSingular - e, 0, 0,  nearSingular + e, nearSingular, 0, 0,  0, 0, one, 0,  0, 0, 0, one }, false,
+          { 0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0 } },
+    };
+
+    struct Matrix3x4Case
+    {
+        const char* name;
+        int64_t input[12];
+        bool ok;
+        int64_t expected[12];
+    };
+
+    const Matrix3x4Case matrix3x4Cases[] =
+    {
+        { "identity",
+          { one, 0, 0,  0, one, 0,  0, 0, one,  0, 0, 0 }, true,
+          { one, 0, 0,  0, one, 0,  0, 0, one,  0, 0, 0 } },
+        // 平移 -(3, 4, 5) * diag(1, 1, 65536)个rawValue
+        { "diag(60000, 60000, 1) translate(3, 4, 5)",
+          { 60000 * one, 0, 0,  0, 60000 * one, 0,  0, 0, one,  3 * one, 4 * one, 5 * one }, true,
+          { 1, 0, 0,  0, 1, 0,  0, 0, one,  -3, -4, -5 * one } },
+        { "scale(2048)",
+          { 2048 * one, 0, 0,  0, 2048 * one, 0,  0, 0, 2048 * one,  0, 0, 0 }, true,
+          { 32, 0, 0,  0, 32, 0,  0, 0, 32,  0, 0, 0 } },
+        { "zero row",
+          { one, 0, 0,  0, 0, 0,  0, 0, one,  one, one, one }, false,
+          { 0, 0, 0,  0, 0, 0,  0, 0, 0,  0, 0, 0 } },
+        { "near singular",
+          { nearSingular, nearSingular - e, 0,  nearSingular + e, nearSingular, 0,  0, 0, one,  0, 0, 0 }, false,
+          { 0, 0, 0,  0, 0, 0,  0, 0, 0,  0, 0, 0 } },
+    };
+
+    bool CheckCase(const char* op, const char* name, bool ok, bool expectedOk, const int64_t* actual, const int64_t* expected, int count)
+    {
+        if (ok == expectedOk && std::equal(actual, actual + count, expected))
+        {
+            return true;
+        }
+        std::cout << "  " << op << "  " << name << "  FAILED  ok = " << ok << " (expected " << expectedOk << ")" << std::endl
+                  << "    actual   " << FormatRecord(actual, count) << std::endl
+                  << "    expected " << FormatRecord(expected, count) << std::endl;
+        return false;
+    }
+
+    int RunMatrix4Cases()
+    {
+        int failed = 0;
+        std::vector<FMatrix4> batch;
+        for (const Matrix4Case& c : matrix4Cases)
+        {
+            FMatrix4 m;
+            for (int i = 0; i < 16; ++i)
+            {
+                m.*matrix4Members[i] = Fix64::FromRawValue(c.input[i]);
+            }
+            batch.push_back(m);
+
+            FMatrix4 inv;
+            bool ok = m.TryInverse(inv);
+            int64_t actual[16];
+            RecordWriter w{ actual };
+            w.Put(inv);
+            failed += !CheckCase("fmatrix4.try_inverse", c.name, ok, c.ok, actual, c.expected, 16);
+
+            // 可逆的仿射矩阵(最后一列为(0, 0, 0, 1))走快速路径，结果相同
+            if (c.ok && c.input[3] == 0 && c.input[7] == 0 && c.input[11] == 0 && c.input[15] == one)
+            {
+                RecordWriter wa{ actual };
+                wa.Put(m.InverseAffine());
+                failed += !CheckCase("fmatrix4.inverse_affine", c.name, true, true, actual, c.expected, 16);
+            }
+        }
+
+        // 批量求逆：不可逆的个数和逐个求逆相同
+        size_t expectedSingular = 0;
+        for (const Matrix4Case& c : matrix4Cases)
+        {
+            expectedSingular += c.ok ? 0 : 1;
+        }
+        size_t singular = FMatrix4::Inverse(batch.data(), batch.data(), batch.size());
+        for (size_t k = 0; k < batch.size(); ++k)
+        {
+            int64_t actual[16];
+            RecordWriter w{ actual };
+            w.Put(batch[k]);
+            failed += !CheckCase("fmatrix4.inverse_batch", matrix4Cases[k].name, true, true, actual, matrix4Cases[k].expected, 16);
+        }
+        if (singular != expectedSingular)
+        {
+            std::cout << "  fmatrix4.inverse_batch  FAILED  singular = " << singular << " (expected " << expectedSingular << ")" << std::endl;
+            ++failed;
+        }
+        return failed;
+    }
+
+    int RunMatrix3x4Cases()
+    {
+        int failed = 0;
+        for (const Matrix3x4Case& c : matrix3x4Cases)
+        {
+            FMatrix3x4 m;
+            for (int i = 0; i < 12; ++i)
+            {
+                m.*matrix3x4Members[i] = Fix64::FromRawValue(c.input[i]);
+            }
+
+            FMatrix3x4 inv;
+            bool ok = m.TryInverse(inv);
+            int64_t actual[12];
+            RecordWriter w{ actual };
+            w.Put(inv);
+            failed += !CheckCase("fmatrix3x4.try_inverse", c.name, ok, c.ok, actual, c.expected, 12);
+        }
+        return failed;
+    }
+}
+
+int FMath::RunConformanceCases(const ConformanceOptions& options)
+{
+    struct CaseGroup
+    {
+        const char* name;
+        int (*run)();
+    };
+    const CaseGroup groups[] =
+    {
+        { "fmatrix4.inverse", RunMatrix4Cases },
+        { "fmatrix3x4.inverse", RunMatrix3x4Cases },
+    };
+
+    int failed = 0;
+    int checked = 0;
+    for (const CaseGroup& group : groups)
+    {
+        if (options.filter != nullptr && strstr(group.name, options.filter) == nullptr)
+        {
+            continue;
+        }
+        ++checked;
+        failed += group.run();
+    }
+
+    std::cout << "checked " << checked << " case groups, failed " << failed << std::endl;
+    return failed;
+}
+
+std::vector<std::string> FMath::ConformanceOpNames()
+{
+    std::vector<std::string> names;
+    for (const ConformanceOp& op : Ops())
+    {
+        names.push_back(op.name);
+    }
+    return names;
+}
+
+bool FMath::GenerateConformanceCorpus(const char* dir, const ConformanceOptions& options)
+{
+    uint64_t totalBytes = 0;
+    for (const ConformanceOp& op : Ops())
+    {
+        if (!Selected(op, options))
+        {
+            continue;
+        }
+
+        std::string path = CorpusPath(dir, op);
+        FILE* file = fopen(path.c_str(), "wb");
+        if (file == nullptr)
+        {
+            std::cerr << "failed to write " << path << std::endl;
+            return false;
+        }
+
+        uint8_t header[corpusHeaderSize];
+        EncodeHeader(op, options.recordCount, options.seed, header);
+        bool ok = fwrite(header, 1, corpusHeaderSize, file) == corpusHeaderSize;
+
+        ConformanceRng rng(options.seed ^ HashName(op.name));
+        const size_t recordSize = op.inputCount + op.outputCount;
+        std::vector<int64_t> in(options.chunkSize * op.inputCount), out(options.chunkSize * op.outputCount);
+        std::vector<uint8_t> bytes(options.chunkSize * recordSize * 8);
+        for (size_t start = 0; ok && start < options.recordCount; start += options.chunkSize)
+        {
+            size_t count = std::min(options.chunkSize, options.recordCount - start);
+            GenerateInputs(op, rng, in.data(), count);
+            Evaluate(op, in.data(), out.data(), count);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                uint8_t* p = bytes.data() + i * recordSize * 8;
+                for (int k = 0; k < op.inputCount; ++k)
+                {
+                    EncodeLE((uint64_t)in[i * op.inputCount + k], p + k * 8, 8);
+                }
+                for (int k = 0; k < op.outputCount; ++k)
+                {
+                    EncodeLE((uint64_t)out[i * op.outputCount + k], p + (op.inputCount + k) * 8, 8);
+                }
+            }
+            ok = fwrite(bytes.data(), 1, count * recordSize * 8, file) == count * recordSize * 8;
+        }
+
+        if (fclose(file) != 0 || !ok)
+        {
+            std::cerr << "failed to write " << path << std::endl;
+            return false;
+        }
+
+        totalBytes += corpusHeaderSize + options.recordCount * recordSize * 8;
+        std::cout << "  " << op.name << "  records = " << options.recordCount << std::endl;
+    }
+
+    std::cout << "corpus size = " << (totalBytes >> 20) << "MB" << std::endl;
+    return true;
+}
+
+int FMath::CheckConformanceCorpus(const char* dir, const ConformanceOptions& options)
+{
+    int failed = 0;
+    int checked = 0;
+    for (const ConformanceOp& op : Ops())
+    {
+        if (!Selected(op, options))
+        {
+            continue;
+        }
+
+        ++checked;
+        if (!CheckCorpusFile(op, dir, options))
+        {
+            ++failed;
+        }
+    }
+
+    std::cout << "checked " << checked << " ops, failed " << failed << std::endl;
+    return failed;
+}
+
+void FMath::WriteConformanceDigests(std::ostream& out, const ConformanceOptions& options)
+{
+    out << "# FMath conformance digests: op record_count digest_per_chunk...\n";
+    out << "# regenerate with FMathConformance digest --records " << options.recordCount << " only when a result change is intended\n";
+    out << "seed " << options.seed << "\n";
+    out << "chunk " << options.chunkSize << "\n";
+
+    for (const ConformanceOp& op : Ops())
+    {
+        if (!Selected(op, options))
+        {
+            continue;
+        }
+
+        out << op.name << " " << options.recordCount;
+        for (uint64_t digest : ComputeDigests(op, options.seed, options.recordCount, options.chunkSize))
+        {
+            out << " " << std::hex << std::setw(16) << std::setfill('0') << digest << std::dec << std::setfill(' ');
+        }
+        out << "\n";
+    }
+}
+
+int FMath::VerifyConformanceDigests(const char* path, const ConformanceOptions& options)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        std::cerr << "failed to read " << path << std::endl;
+        return -1;
+    }
+
+    uint64_t seed = options.seed;
+    size_t chunkSize = options.chunkSize;
+    std::vector<std::string> seen;
+    int failed = 0;
+    int checked = 0;
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        std::istringstream s(line);
+        std::string name;
+        s >> name;
+        if (name == "seed")
+        {
+            s >> seed;
+            continue;
+        }
+        if (name == "chunk")
+        {
+            s >> chunkSize;
+            continue;
+        }
+
+        seen.push_back(name);
+        const ConformanceOp* op = FindOp(name);
+        if (op == nullptr)
+        {
+            std::cout << "  " << name << "  unknown op" << std::endl;
+            ++failed;
+            continue;
+        }
+        if (!Selected(*op, options))
+        {
+            continue;
+        }
+
+        size_t recordCount = 0;
+        s >> recordCount;
+        std::vector<uint64_t> expected;
+        std::string digest;
+        while (s >> digest)
+        {
+            expected.push_back(strtoull(digest.c_str(), nullptr, 16));
+        }
+
+        // 只校验前面的段时按段对齐
+        size_t limit = std::min(recordCount, (options.recordCount + chunkSize - 1) / chunkSize * chunkSize);
+        std::vector<uint64_t> actual = ComputeDigests(*op, seed, limit, chunkSize);
+
+        ++checked;
+        for (size_t i = 0; i < actual.size(); ++i)
+        {
+            if (i >= expected.size() || actual[i] != expected[i])
+            {
+                std::cout << "  " << name << "  FAILED  first mismatch in records [" << i * chunkSize << ", "
+                          << std::min(limit, (i + 1) * chunkSize) << ")" << std::endl;
+                ++failed;
+                break;
+            }
+        }
+    }
+
+    for (const ConformanceOp& op : Ops())
+    {
+        if (Selected(op, options) && std::find(seen.begin(), seen.end(), op.name) == seen.end())
+        {
+            std::cout << "  " << op.name << "  missing from " << path << std::endl;
+            ++failed;
+        }
+    }
+
+    std::cout << "checked " << checked << " ops, failed " << failed << std::endl;
+    return failed;
+}
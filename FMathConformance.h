@@ -0,0 +1,78 @@
+//
+//  FMathConformance.h
+//  MathLib
+//
+//  一致性测试：对Fix64、向量、矩阵、四元数的每个运算生成输入/输出rawValue的黄金数据，
+//  并校验当前编译的结果与之逐位相同，用于确认不同编译器、优化级别、SIMD实现的结果一致.
+//
+
+#ifndef FMathConformance_h
+#define FMathConformance_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace FMath
+{
+    /// <summary>
+    /// 一致性测试的参数.
+    /// 输入只由seed和运算名决定，用整数随机数生成，不依赖被测代码和浮点数.
+    /// </summary>
+    struct ConformanceOptions
+    {
+        uint64_t seed = 20200708;
+
+        /// 每个运算的记录数
+        size_t recordCount = 1 << 20;
+
+        /// 摘要按chunkSize条记录分段计算，出错时可以定位到段
+        size_t chunkSize = 1 << 16;
+
+        /// 只处理名字包含filter的运算，nullptr时全部处理
+        const char* filter = nullptr;
+
+        /// 每个运算最多打印的不一致记录数
+        int maxReports = 5;
+    };
+
+    /// <summary>
+    /// 所有运算的名字，如 fix64.mul、fvector3.cross、fmatrix4.inverse.
+    /// </summary>
+    std::vector<std::string> ConformanceOpNames();
+
+    /// <summary>
+    /// 生成语料：每个运算一个文件dir/name.fxc，文件头后依次为每条记录的输入和输出rawValue(小端int64).
+    /// </summary>
+    /// <returns>目录无法写入时返回false</returns>
+    bool GenerateConformanceCorpus(const char* dir, const ConformanceOptions& options);
+
+    /// <summary>
+    /// 流式读取dir下的语料，用当前编译重新计算输出并逐位比较，打印不一致的记录.
+    /// </summary>
+    /// <returns>结果不一致或文件缺失的运算数</returns>
+    int CheckConformanceCorpus(const char* dir, const ConformanceOptions& options);
+
+    /// <summary>
+    /// 计算每个运算每段记录(输入和输出)的摘要，按黄金文件的格式输出.
+    /// </summary>
+    void WriteConformanceDigests(std::ostream& out, const ConformanceOptions& options);
+
+    /// <summary>
+    /// 重新计算摘要并与黄金文件比较，seed和chunkSize取文件中的值；
+    /// options.recordCount小于文件中的记录数时只校验前面的段.
+    /// </summary>
+    /// <returns>摘要不一致的运算数，文件无法读取时返回-1</returns>
+    int VerifyConformanceDigests(const char* path, const ConformanceOptions& options);
+
+    /// <summary>
+    /// 运行手写期望值的用例(奇异矩阵、范围边界等)：期望值按定义推算，不依赖黄金文件，
+    /// 黄金文件只能保证结果不变，不能保证结果正确. 只用到options.filter.
+    /// </summary>
+    /// <returns>失败的用例数</returns>
+    int RunConformanceCases(const ConformanceOptions& options);
+}
+
+#endif /* FMathConformance_h */
@@ -0,0 +1,138 @@
+//
+//  FMathConformanceMain.cpp
+//  MathLib
+//
+//  一致性测试程序FMathConformance的入口.
+//
+//  FMathConformance <command> [--records N] [--seed N] [--filter NAME] [--kernel auto|scalar|avx2]
+//    generate DIR   生成语料到DIR(每个运算一个.fxc文件)
+//    check DIR      用当前编译校验DIR下的语料
+//    digest         输出摘要，即 conformance/golden.txt 的内容
+//    verify FILE    重新计算摘要并与FILE比较，ctest运行的就是这个命令
+//    cases          运行手写期望值的用例(奇异矩阵、范围边界等)
+//    list           列出所有运算
+//
+
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include "FMathConformance.h"
+#include "FVector3Array.h"
+using namespace FMath;
+
+namespace
+{
+    void PrintUsage(const char* program)
+    {
+        std::cout << "usage: " << program
+                  << " generate DIR | check DIR | digest | verify FILE | cases | list"
+                  << " [--records N] [--seed N] [--filter NAME] [--kernel auto|scalar|avx2]" << std::endl;
+    }
+}
+
+int main(int argc, const char * argv[])
+{
+    if (argc < 2)
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    const char* command = argv[1];
+    const char* path = nullptr;
+    int first = 2;
+    if (strcmp(command, "generate") == 0 || strcmp(command, "check") == 0 || strcmp(command, "verify") == 0)
+    {
+        if (argc < 3)
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+        path = argv[2];
+        first = 3;
+    }
+
+    ConformanceOptions options;
+    for (int i = first; i < argc; i += 2)
+    {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (value == nullptr)
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+        else if (strcmp(arg, "--records") == 0)
+        {
+            options.recordCount = strtoull(value, nullptr, 10);
+        }
+        else if (strcmp(arg, "--seed") == 0)
+        {
+            options.seed = strtoull(value, nullptr, 10);
+        }
+        else if (strcmp(arg, "--filter") == 0)
+        {
+            options.filter = value;
+        }
+        else if (strcmp(arg, "--kernel") == 0)
+        {
+            if (strcmp(value, "scalar") == 0)
+            {
+                FVector3Array::SetKernel(FVector3Array::Kernel::Scalar);
+            }
+            else if (strcmp(value, "avx2") == 0)
+            {
+                FVector3Array::SetKernel(FVector3Array::Kernel::Avx2);
+            }
+            else if (strcmp(value, "auto") != 0)
+            {
+                PrintUsage(argv[0]);
+                return 1;
+            }
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (options.recordCount == 0)
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    if (strcmp(command, "generate") == 0)
+    {
+        return GenerateConformanceCorpus(path, options) ? 0 : 1;
+    }
+    if (strcmp(command, "check") == 0)
+    {
+        return CheckConformanceCorpus(path, options) == 0 ? 0 : 1;
+    }
+    if (strcmp(command, "verify") == 0)
+    {
+        return VerifyConformanceDigests(path, options) == 0 ? 0 : 1;
+    }
+    if (strcmp(command, "cases") == 0)
+    {
+        return RunConformanceCases(options) == 0 ? 0 : 1;
+    }
+    if (strcmp(command, "digest") == 0)
+    {
+        WriteConformanceDigests(std::cout, options);
+        return 0;
+    }
+    if (strcmp(command, "list") == 0)
+    {
+        for (const std::string& name : ConformanceOpNames())
+        {
+            std::cout << name << std::endl;
+        }
+        return 0;
+    }
+
+    PrintUsage(argv[0]);
+    return 1;
+}
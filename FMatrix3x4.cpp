@@ -0,0 +1,310 @@
+//
+//  FMatrix3x4.cpp
+//  MathLib
+//
+//  仿射变换矩阵.
+//
+
+#include "FMatrix3x4.h"
+#include "FQuaternion.h"
+#include "Fix64Divisor.h"
+#include "Fix64Overflow.h"
+
+using namespace FMath;
+
+const FMatrix3x4 FMatrix3x4::Identity = FMatrix3x4(
+                                            Fix64::One, Fix64::Zero, Fix64::Zero,
+                                            Fix64::Zero, Fix64::One, Fix64::Zero,
+                                            Fix64::Zero, Fix64::Zero, Fix64::One,
+                                            Fix64::Zero, Fix64::Zero, Fix64::Zero);
+
+FMatrix3x4::FMatrix3x4(const FMatrix4& m)
+{
+    m00 = m.m00; m01 = m.m01; m02 = m.m02;
+    m10 = m.m10; m11 = m.m11; m12 = m.m12;
+    m20 = m.m20; m21 = m.m21; m22 = m.m22;
+    m30 = m.m30; m31 = m.m31; m32 = m.m32;
+}
+
+FMatrix4 FMatrix3x4::ToMatrix4() const
+{
+    return FMatrix4(m00, m01, m02, Fix64::Zero,
+                    m10, m11, m12, Fix64::Zero,
+                    m20, m21, m22, Fix64::Zero,
+                    m30, m31, m32, Fix64::One);
+}
+
+FMatrix3x4 FMatrix3x4::FromQuaternion(const FQuaternion& q)
+{
+    Fix64 x2 = q.x + q.x;
+    Fix64 y2 = q.y + q.y;
+    Fix64 z2 = q.z + q.z;
+
+    Fix64 xx = q.x * x2, yy = q.y * y2, zz = q.z * z2;
+    Fix64 xy = q.x * y2, xz = q.x * z2, yz = q.y * z2;
+    Fix64 wx = q.w * x2, wy = q.w * y2, wz = q.w * z2;
+
+    return FMatrix3x4(Fix64::One - (yy + zz), xy + wz, xz - wy,
+                      xy - wz, Fix64::One - (xx + zz), yz + wx,
+                      xz + wy, yz - wx, Fix64::One - (xx + yy),
+                      Fix64::Zero, Fix64::Zero, Fix64::Zero);
+}
+
+FMatrix3x4 FMatrix3x4::TRS(const FVector3& pos, const FQuaternion& q, const FVector3& scale)
+{
+    FMatrix3x4 m = FromQuaternion(q);
+
+    m.m00 *= scale.x; m.m01 *= scale.x; m.m02 *= scale.x;
+    m.m10 *= scale.y; m.m11 *= scale.y; m.m12 *= scale.y;
+    m.m20 *= scale.z; m.m21 *= scale.z; m.m22 *= scale.z;
+
+    m.m30 = pos.x;
+    m.m31 = pos.y;
+    m.m32 = pos.z;
+
+    return m;
+}
+
+void FMatrix3x4::TRS(const FVector3* pos, const FQuaternion* rotations, const FVector3* scales,
+                     FMatrix3x4* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = TRS(pos[i], rotations[i], scales[i]);
+    }
+}
+
+FVector3 FMatrix3x4::GetAxisX() const
+{
+    return FVector3(m00, m01, m02);
+}
+
+FVector3 FMatrix3x4::GetAxisY() const
+{
+    return FVector3(m10, m11, m12);
+}
+
+FVector3 FMatrix3x4::GetAxisZ() const
+{
+    return FVector3(m20, m21, m22);
+}
+
+FVector3 FMatrix3x4::GetOrigin() const
+{
+    return FVector3(m30, m31, m32);
+}
+
+Fix64 FMatrix3x4::Determinant() const
+{
+    return m00 * (m11 * m22 - m12 * m21)
+         - m01 * (m10 * m22 - m12 * m20)
+         + m02 * (m10 * m21 - m11 * m20);
+}
+
+bool FMatrix3x4::TryInverse(FMatrix3x4& result) const
+{
+    // 3x3伴随矩阵，第0列同时用于展开行列式
+    Fix64 a00 = m11 * m22 - m12 * m21;
+    Fix64 a10 = m12 * m20 - m10 * m22;
+    Fix64 a20 = m10 * m21 - m11 * m20;
+
+    Fix64 det = m00 * a00 + m01 * a10 + m02 * a20;
+    if (det == Fix64::Zero)
+    {
+        result = FMatrix3x4(Fix64::Zero, Fix64::Zero, Fix64::Zero,
+                            Fix64::Zero, Fix64::Zero, Fix64::Zero,
+                            Fix64::Zero, Fix64::Zero, Fix64::Zero,
+                            Fix64::Zero, Fix64::Zero, Fix64::Zero);
+        return false;
+    }
+
+    Fix64 a01 = m02 * m21 - m01 * m22;
+    Fix64 a11 = m00 * m22 - m02 * m20;
+    Fix64 a21 = m01 * m20 - m00 * m21;
+    Fix64 a02 = m01 * m12 - m02 * m11;
+    Fix64 a12 = m02 * m10 - m00 * m12;
+    Fix64 a22 = m00 * m11 - m01 * m10;
+
+    // 有元素超出Fix64的范围(接近奇异)
+    const Fix64 adj[] = { a00, a01, a02, a10, a11, a12, a20, a21, a22 };
+    bool numeratorsFit = true;
+    for (const Fix64& a : adj)
+    {
+        numeratorsFit = numeratorsFit && Fix64Divisor::NumeratorFits(a);
+        if (Fix64Overflow::DivOverflows(a.rawValue, det.rawValue))
+        {
+            result = FMatrix3x4(Fix64::Zero, Fix64::Zero, Fix64::Zero,
+                                Fix64::Zero, Fix64::Zero, Fix64::Zero,
+                                Fix64::Zero, Fix64::Zero, Fix64::Zero,
+                                Fix64::Zero, Fix64::Zero, Fix64::Zero);
+            return false;
+        }
+    }
+
+    FMatrix3x4 inv = FMatrix3x4();
+
+    if (numeratorsFit)
+    {
+        Fix64Divisor d(det);
+
+        inv.m00 = a00 / d; inv.m01 = a01 / d; inv.m02 = a02 / d;
+        inv.m10 = a10 / d; inv.m11 = a11 / d; inv.m12 = a12 / d;
+        inv.m20 = a20 / d; inv.m21 = a21 / d; inv.m22 = a22 / d;
+    }
+    else
+    {
+        // 元素 >= 2^47时左移16位会回绕，改用128位被除数的除法；不回绕时两者结果相同
+        Fix64* r[] = { &inv.m00, &inv.m01, &inv.m02, &inv.m10, &inv.m11, &inv.m12, &inv.m20, &inv.m21, &inv.m22 };
+        for (int i = 0; i < 9; ++i)
+        {
+            Fix64Overflow::Div(adj[i].rawValue, det.rawValue, r[i]->rawValue);
+        }
+    }
+
+    inv.m30 = -(m30 * inv.m00 + m31 * inv.m10 + m32 * inv.m20);
+    inv.m31 = -(m30 * inv.m01 + m31 * inv.m11 + m32 * inv.m21);
+    inv.m32 = -(m30 * inv.m02 + m31 * inv.m12 + m32 * inv.m22);
+
+    result = inv;
+    return true;
+}
+
+FMatrix3x4 FMatrix3x4::Inverse() const
+{
+    FMatrix3x4 inv;
+    TryInverse(inv);
+    return inv;
+}
+
+FMatrix3x4 FMatrix3x4::InverseRigid() const
+{
+    FMatrix3x4 inv = FMatrix3x4();
+
+    inv.m00 = m00; inv.m01 = m10; inv.m02 = m20;
+    inv.m10 = m01; inv.m11 = m11; inv.m12 = m21;
+    inv.m20 = m02; inv.m21 = m12; inv.m22 = m22;
+
+    // t' = -t * R^T，第j个分量是t与R第j行的点积
+    inv.m30 = -(m30 * m00 + m31 * m01 + m32 * m02);
+    inv.m31 = -(m30 * m10 + m31 * m11 + m32 * m12);
+    inv.m32 = -(m30 * m20 + m31 * m21 + m32 * m22);
+
+    return inv;
+}
+
+FMatrix3x4 FMatrix3x4::InverseScaled() const
+{
+    Fix64Divisor d0(GetAxisX().SqrMagnitude());
+    Fix64Divisor d1(GetAxisY().SqrMagnitude());
+    Fix64Divisor d2(GetAxisZ().SqrMagnitude());
+
+    FMatrix3x4 inv = FMatrix3x4();
+
+    inv.m00 = m00 / d0; inv.m01 = m10 / d1; inv.m02 = m20 / d2;
+    inv.m10 = m01 / d0; inv.m11 = m11 / d1; inv.m12 = m21 / d2;
+    inv.m20 = m02 / d0; inv.m21 = m12 / d1; inv.m22 = m22 / d2;
+
+    inv.m30 = -(m30 * inv.m00 + m31 * inv.m10 + m32 * inv.m20);
+    inv.m31 = -(m30 * inv.m01 + m31 * inv.m11 + m32 * inv.m21);
+    inv.m32 = -(m30 * inv.m02 + m31 * inv.m12 + m32 * inv.m22);
+
+    return inv;
+}
+
+FVector3 FMatrix3x4::MultiplyPoint(const FVector3& p) const
+{
+    return FVector3(p.x * m00 + p.y * m10 + p.z * m20 + m30,
+                    p.x * m01 + p.y * m11 + p.z * m21 + m31,
+                    p.x * m02 + p.y * m12 + p.z * m22 + m32);
+}
+
+FVector3 FMatrix3x4::MultiplyVector(const FVector3& v) const
+{
+    return FVector3(v.x * m00 + v.y * m10 + v.z * m20,
+                    v.x * m01 + v.y * m11 + v.z * m21,
+                    v.x * m02 + v.y * m12 + v.z * m22);
+}
+
+void FMatrix3x4::TransformPoints(const FVector3* in, FVector3* out, size_t count) const
+{
+    ToMatrix4().TransformPoints(in, out, count);
+}
+
+void FMatrix3x4::TransformPoints(const FVector3Array& in, FVector3Array& out) const
+{
+    ToMatrix4().TransformPoints(in, out);
+}
+
+void FMatrix3x4::TransformDirections(const FVector3* in, FVector3* out, size_t count) const
+{
+    ToMatrix4().TransformDirections(in, out, count);
+}
+
+void FMatrix3x4::TransformDirections(const FVector3Array& in, FVector3Array& out) const
+{
+    ToMatrix4().TransformDirections(in, out);
+}
+
+FMatrix3x4 FMath::operator *(const FMatrix3x4& lhs, const FMatrix3x4& rhs)
+{
+    FMatrix3x4 mat;
+    FMatrix3x4::Multiply(mat, lhs, rhs);
+
+    return mat;
+}
+
+FMatrix3x4& FMath::operator *=(FMatrix3x4& lhs, const FMatrix3x4& rhs)
+{
+    FMatrix3x4::Multiply(lhs, lhs, rhs);
+
+    return lhs;
+}
+
+FMatrix3x4 FMatrix3x4::Multiply(const FMatrix3x4& lhs, const FMatrix3x4& rhs)
+{
+    return lhs * rhs;
+}
+
+void FMatrix3x4::Multiply(FMatrix3x4& out, const FMatrix3x4& lhs, const FMatrix3x4& rhs)
+{
+    if (&out == &rhs)
+    {
+        FMatrix3x4 copy = rhs;
+        Multiply(out, lhs, copy);
+        return;
+    }
+
+    // 最后一列为(0, 0, 0, 1)：前三行省去与rhs第3行的乘积，第3行直接加上rhs的平移
+    Fix64 a0 = lhs.m00, a1 = lhs.m01, a2 = lhs.m02;
+    out.m00 = a0 * rhs.m00 + a1 * rhs.m10 + a2 * rhs.m20;
+    out.m01 = a0 * rhs.m01 + a1 * rhs.m11 + a2 * rhs.m21;
+    out.m02 = a0 * rhs.m02 + a1 * rhs.m12 + a2 * rhs.m22;
+
+    a0 = lhs.m10; a1 = lhs.m11; a2 = lhs.m12;
+    out.m10 = a0 * rhs.m00 + a1 * rhs.m10 + a2 * rhs.m20;
+    out.m11 = a0 * rhs.m01 + a1 * rhs.m11 + a2 * rhs.m21;
+    out.m12 = a0 * rhs.m02 + a1 * rhs.m12 + a2 * rhs.m22;
+
+    a0 = lhs.m20; a1 = lhs.m21; a2 = lhs.m22;
+    out.m20 = a0 * rhs.m00 + a1 * rhs.m10 + a2 * rhs.m20;
+    out.m21 = a0 * rhs.m01 + a1 * rhs.m11 + a2 * rhs.m21;
+    out.m22 = a0 * rhs.m02 + a1 * rhs.m12 + a2 * rhs.m22;
+
+    a0 = lhs.m30; a1 = lhs.m31; a2 = lhs.m32;
+    out.m30 = a0 * rhs.m00 + a1 * rhs.m10 + a2 * rhs.m20 + rhs.m30;
+    out.m31 = a0 * rhs.m01 + a1 * rhs.m11 + a2 * rhs.m21 + rhs.m31;
+    out.m32 = a0 * rhs.m02 + a1 * rhs.m12 + a2 * rhs.m22 + rhs.m32;
+}
+
+bool FMath::operator ==(const FMatrix3x4& lhs, const FMatrix3x4& rhs)
+{
+    return lhs.m00 == rhs.m00 && lhs.m01 == rhs.m01 && lhs.m02 == rhs.m02 &&
+           lhs.m10 == rhs.m10 && lhs.m11 == rhs.m11 && lhs.m12 == rhs.m12 &&
+           lhs.m20 == rhs.m20 && lhs.m21 == rhs.m21 && lhs.m22 == rhs.m22 &&
+           lhs.m30 == rhs.m30 && lhs.m31 == rhs.m31 && lhs.m32 == rhs.m32;
+}
+
+bool FMath::operator !=(const FMatrix3x4& lhs, const FMatrix3x4& rhs)
+{
+    return !(lhs == rhs);
+}
@@ -0,0 +1,157 @@
+//
+//  FMatrix3x4.h
+//  MathLib
+//
+//  仿射变换矩阵.
+//
+
+#ifndef FMatrix3x4_h
+#define FMatrix3x4_h
+
+#include <stddef.h>
+#include "Fix64.h"
+#include "FVector3.h"
+#include "FMatrix4.h"
+
+namespace FMath
+{
+    class FVector3Array;
+    struct FQuaternion;
+
+    /// <summary>
+    /// 仿射矩阵：FMatrix4去掉恒为(0, 0, 0, 1)的最后一列，元素名与FMatrix4相同.
+    /// 行向量约定，m00~m22为旋转缩放，m30~m32为平移，与FMatrix4::TS、Translate、RotateAxis等一致.
+    /// 12个元素(96字节)，复合只需36次乘法(FMatrix4为64次)，结果与对应的FMatrix4运算逐位一致.
+    /// </summary>
+    struct FMatrix3x4
+    {
+        Fix64 m00, m01, m02;
+        Fix64 m10, m11, m12;
+        Fix64 m20, m21, m22;
+        Fix64 m30, m31, m32;
+
+        FMatrix3x4()
+        {
+
+        }
+
+        FMatrix3x4(Fix64 m00, Fix64 m01, Fix64 m02,
+                   Fix64 m10, Fix64 m11, Fix64 m12,
+                   Fix64 m20, Fix64 m21, Fix64 m22,
+                   Fix64 m30, Fix64 m31, Fix64 m32)
+        {
+            this->m00 = m00; this->m01 = m01; this->m02 = m02;
+            this->m10 = m10; this->m11 = m11; this->m12 = m12;
+            this->m20 = m20; this->m21 = m21; this->m22 = m22;
+            this->m30 = m30; this->m31 = m31; this->m32 = m32;
+        }
+
+        /// <summary>
+        /// 从FMatrix4截取，忽略最后一列；只有最后一列为(0, 0, 0, 1)时才是等价的.
+        /// </summary>
+        explicit FMatrix3x4(const FMatrix4& m);
+
+        const static FMatrix3x4 Identity;
+
+        FMatrix4 ToMatrix4() const;
+
+        /// <summary>
+        /// 单位四元数对应的旋转矩阵，没有三角函数，只需9次乘法.
+        /// 第i行为q旋转后的第i个坐标轴，MultiplyVector(v)与q.Rotate(v)一致.
+        /// </summary>
+        static FMatrix3x4 FromQuaternion(const FQuaternion& q);
+
+        /// <summary>
+        /// 先缩放、再旋转、最后平移：MultiplyPoint(v) = q.Rotate(v * scale) + pos.
+        /// </summary>
+        static FMatrix3x4 TRS(const FVector3& pos, const FQuaternion& q, const FVector3& scale);
+
+        /// <summary>
+        /// 批量TRS，如每帧把整个骨骼的局部姿态转成矩阵：out[i] = TRS(pos[i], rotations[i], scales[i]).
+        /// </summary>
+        static void TRS(const FVector3* pos, const FQuaternion* rotations, const FVector3* scales,
+                        FMatrix3x4* out, size_t count);
+
+        FVector3 GetAxisX() const;
+
+        FVector3 GetAxisY() const;
+
+        FVector3 GetAxisZ() const;
+
+        FVector3 GetOrigin() const;
+
+        /// <summary>
+        /// 左上3x3的行列式.
+        /// </summary>
+        Fix64 Determinant() const;
+
+        /// <summary>
+        /// 一般仿射变换的逆：左上3x3用伴随矩阵除以行列式(共用一个Fix64Divisor，伴随矩阵有元素 >= 2^47时
+        /// 改用128位被除数的Fix64Overflow::Div)，平移为 -t * R^-1.
+        /// 行列式为0或逆矩阵有元素超出Fix64的范围时返回false，result的元素全为0.
+        /// </summary>
+        bool TryInverse(FMatrix3x4& result) const;
+
+        /// <summary>
+        /// 一般仿射变换的逆，不可逆时元素全为0.
+        /// </summary>
+        FMatrix3x4 Inverse() const;
+
+        /// <summary>
+        /// 刚体变换(旋转+平移)的逆：旋转部分转置，平移为 -t * R^T.
+        /// 只做乘加，不做除法；有缩放时结果不正确，用InverseScaled.
+        /// </summary>
+        FMatrix3x4 InverseRigid() const;
+
+        /// <summary>
+        /// 三行互相正交(先缩放再旋转，如 TS * RotateAxis)时的逆：
+        /// M = D * Q，D为对角缩放，Q正交，则 M^-1 = M^T * D^-2，即第j列除以第j行长度的平方.
+        /// 每行的除数只算一次(Fix64Divisor). 某行为0时结果无意义.
+        /// </summary>
+        FMatrix3x4 InverseScaled() const;
+
+        /// <summary>
+        /// 与FMatrix4::MultiplyPoint一致.
+        /// </summary>
+        FVector3 MultiplyPoint(const FVector3& p) const;
+
+        /// <summary>
+        /// 与FMatrix4::MultiplyVector一致.
+        /// </summary>
+        FVector3 MultiplyVector(const FVector3& v) const;
+
+        /// <summary>
+        /// 批量变换，与FMatrix4的同名函数一致.
+        /// </summary>
+        void TransformPoints(const FVector3* in, FVector3* out, size_t count) const;
+
+        void TransformPoints(const FVector3Array& in, FVector3Array& out) const;
+
+        void TransformDirections(const FVector3* in, FVector3* out, size_t count) const;
+
+        void TransformDirections(const FVector3Array& in, FVector3Array& out) const;
+
+        /// <summary>
+        /// 复合：先lhs再rhs，与lhs.ToMatrix4() * rhs.ToMatrix4()逐位一致.
+        /// </summary>
+        friend FMatrix3x4 operator *(const FMatrix3x4& lhs, const FMatrix3x4& rhs);
+
+        /// <summary>
+        /// lhs = lhs * rhs，不产生临时矩阵.
+        /// </summary>
+        friend FMatrix3x4& operator *=(FMatrix3x4& lhs, const FMatrix3x4& rhs);
+
+        static FMatrix3x4 Multiply(const FMatrix3x4& lhs, const FMatrix3x4& rhs);
+
+        /// <summary>
+        /// out = lhs * rhs，直接写入out，out可以是lhs或rhs，见FMatrix4::Multiply.
+        /// </summary>
+        static void Multiply(FMatrix3x4& out, const FMatrix3x4& lhs, const FMatrix3x4& rhs);
+
+        friend bool operator ==(const FMatrix3x4& lhs, const FMatrix3x4& rhs);
+
+        friend bool operator !=(const FMatrix3x4& lhs, const FMatrix3x4& rhs);
+    };
+}
+
+#endif /* FMatrix3x4_h */
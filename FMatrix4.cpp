@@ -7,9 +7,273 @@
 //
 
 #include "FMatrix4.h"
+#include "FMatrix3x4.h"
+#include "FQuaternion.h"
+#include "FVector3Array.h"
+#include "Fix64Divisor.h"
+#include "Fix64Overflow.h"
+#include "Fix64Simd.h"
 
 using namespace FMath;
 
+namespace
+{
+    static_assert(sizeof(FVector3) == 3 * sizeof(int64_t), "FVector3 must be three packed rawValues");
+    static_assert(sizeof(FVector4) == 4 * sizeof(int64_t), "FVector4 must be four packed rawValues");
+    static_assert(sizeof(FMatrix4) == 16 * sizeof(int64_t), "FMatrix4 must be sixteen packed rawValues");
+
+    /// <summary>
+    /// 4x4矩阵的12个2x2子式：s取自第0、1行，c取自第2、3行，下标为所取的两列.
+    /// 行列式和伴随矩阵都由它们组合，避免重复计算.
+    /// </summary>
+    struct Minors2x2
+    {
+        Fix64 s01, s02, s03, s12, s13, s23;
+        Fix64 c01, c02, c03, c12, c13, c23;
+
+        explicit Minors2x2(const FMatrix4& m)
+        {
+            s01 = m.m00 * m.m11 - m.m10 * m.m01;
+            s02 = m.m00 * m.m12 - m.m10 * m.m02;
+            s03 = m.m00 * m.m13 - m.m10 * m.m03;
+            s12 = m.m01 * m.m12 - m.m11 * m.m02;
+            s13 = m.m01 * m.m13 - m.m11 * m.m03;
+            s23 = m.m02 * m.m13 - m.m12 * m.m03;
+
+            c01 = m.m20 * m.m31 - m.m30 * m.m21;
+            c02 = m.m20 * m.m32 - m.m30 * m.m22;
+            c03 = m.m20 * m.m33 - m.m30 * m.m23;
+            c12 = m.m21 * m.m32 - m.m31 * m.m22;
+            c13 = m.m21 * m.m33 - m.m31 * m.m23;
+            c23 = m.m22 * m.m33 - m.m32 * m.m23;
+        }
+
+        /// 按前两行展开：每个s与取剩余两列的c相乘
+        Fix64 Determinant() const
+        {
+            return s01 * c23 - s02 * c13 + s03 * c12 + s12 * c03 - s13 * c02 + s23 * c01;
+        }
+
+        FMatrix4 Adjugate(const FMatrix4& m) const
+        {
+            FMatrix4 adj = FMatrix4();
+
+            adj.m00 =  m.m11 * c23 - m.m12 * c13 + m.m13 * c12;
+            adj.m01 = -m.m01 * c23 + m.m02 * c13 - m.m03 * c12;
+            adj.m02 =  m.m31 * s23 - m.m32 * s13 + m.m33 * s12;
+            adj.m03 = -m.m21 * s23 + m.m22 * s13 - m.m23 * s12;
+
+            adj.m10 = -m.m10 * c23 + m.m12 * c03 - m.m13 * c02;
+            adj.m11 =  m.m00 * c23 - m.m02 * c03 + m.m03 * c02;
+            adj.m12 = -m.m30 * s23 + m.m32 * s03 - m.m33 * s02;
+            adj.m13 =  m.m20 * s23 - m.m22 * s03 + m.m23 * s02;
+
+            adj.m20 =  m.m10 * c13 - m.m11 * c03 + m.m13 * c01;
+            adj.m21 = -m.m00 * c13 + m.m01 * c03 - m.m03 * c01;
+            adj.m22 =  m.m30 * s13 - m.m31 * s03 + m.m33 * s01;
+            adj.m23 = -m.m20 * s13 + m.m21 * s03 - m.m23 * s01;
+
+            adj.m30 = -m.m10 * c12 + m.m11 * c02 - m.m12 * c01;
+            adj.m31 =  m.m00 * c12 - m.m01 * c02 + m.m02 * c01;
+            adj.m32 = -m.m30 * s12 + m.m31 * s02 - m.m32 * s01;
+            adj.m33 =  m.m20 * s12 - m.m21 * s02 + m.m22 * s01;
+
+            return adj;
+        }
+    };
+
+    /************ scalar ***********/
+
+    /// <summary>
+    /// 变换[begin, n)的点或方向，第i项的x、y、z分别位于ix[i * stride]、iy[i * stride]、iz[i * stride]，
+    /// AoS传stride = 3，SoA传stride = 1. 方向不加平移，等价于平移为0.
+    /// </summary>
+    void TransformScalar(const FMatrix4& m, bool point,
+                         const int64_t* ix, const int64_t* iy, const int64_t* iz,
+                         int64_t* ox, int64_t* oy, int64_t* oz,
+                         size_t stride, size_t begin, size_t n)
+    {
+        const int64_t m00 = m.m00.rawValue, m01 = m.m01.rawValue, m02 = m.m02.rawValue;
+        const int64_t m10 = m.m10.rawValue, m11 = m.m11.rawValue, m12 = m.m12.rawValue;
+        const int64_t m20 = m.m20.rawValue, m21 = m.m21.rawValue, m22 = m.m22.rawValue;
+        const int64_t tx = point ? m.m30.rawValue : 0;
+        const int64_t ty = point ? m.m31.rawValue : 0;
+        const int64_t tz = point ? m.m32.rawValue : 0;
+
+        for (size_t i = begin; i < n; ++i)
+        {
+            size_t j = i * stride;
+            int64_t x = ix[j], y = iy[j], z = iz[j];
+
+            ox[j] = Fix64::Mul(x, m00) + Fix64::Mul(y, m10) + Fix64::Mul(z, m20) + tx;
+            oy[j] = Fix64::Mul(x, m01) + Fix64::Mul(y, m11) + Fix64::Mul(z, m21) + ty;
+            oz[j] = Fix64::Mul(x, m02) + Fix64::Mul(y, m12) + Fix64::Mul(z, m22) + tz;
+        }
+    }
+
+    void TransformVector4Scalar(const FMatrix4& m, const int64_t* in, int64_t* out, size_t begin, size_t n)
+    {
+        const int64_t m00 = m.m00.rawValue, m01 = m.m01.rawValue, m02 = m.m02.rawValue, m03 = m.m03.rawValue;
+        const int64_t m10 = m.m10.rawValue, m11 = m.m11.rawValue, m12 = m.m12.rawValue, m13 = m.m13.rawValue;
+        const int64_t m20 = m.m20.rawValue, m21 = m.m21.rawValue, m22 = m.m22.rawValue, m23 = m.m23.rawValue;
+        const int64_t m30 = m.m30.rawValue, m31 = m.m31.rawValue, m32 = m.m32.rawValue, m33 = m.m33.rawValue;
+
+        for (size_t i = begin; i < n; ++i)
+        {
+            const int64_t* v = in + i * 4;
+            int64_t x = v[0], y = v[1], z = v[2], w = v[3];
+            int64_t* o = out + i * 4;
+
+            o[0] = Fix64::Mul(m00, x) + Fix64::Mul(m01, y) + Fix64::Mul(m02, z) + Fix64::Mul(m03, w);
+            o[1] = Fix64::Mul(m10, x) + Fix64::Mul(m11, y) + Fix64::Mul(m12, z) + Fix64::Mul(m13, w);
+            o[2] = Fix64::Mul(m20, x) + Fix64::Mul(m21, y) + Fix64::Mul(m22, z) + Fix64::Mul(m23, w);
+            o[3] = Fix64::Mul(m30, x) + Fix64::Mul(m31, y) + Fix64::Mul(m32, z) + Fix64::Mul(m33, w);
+        }
+    }
+
+#if FIX64_SIMD_AVX2
+    /************ avx2 ***********/
+
+    using namespace FMath::Simd;
+
+    /// <summary>
+    /// 广播到寄存器的矩阵，每批构造一次.
+    /// </summary>
+    struct AffineAvx2
+    {
+        __m256i m00, m01, m02;
+        __m256i m10, m11, m12;
+        __m256i m20, m21, m22;
+        __m256i tx, ty, tz;
+
+        FIX64_TARGET_AVX2 AffineAvx2(const FMatrix4& m, bool point)
+        {
+            m00 = _mm256_set1_epi64x(m.m00.rawValue); m01 = _mm256_set1_epi64x(m.m01.rawValue); m02 = _mm256_set1_epi64x(m.m02.rawValue);
+            m10 = _mm256_set1_epi64x(m.m10.rawValue); m11 = _mm256_set1_epi64x(m.m11.rawValue); m12 = _mm256_set1_epi64x(m.m12.rawValue);
+            m20 = _mm256_set1_epi64x(m.m20.rawValue); m21 = _mm256_set1_epi64x(m.m21.rawValue); m22 = _mm256_set1_epi64x(m.m22.rawValue);
+            tx = _mm256_set1_epi64x(point ? m.m30.rawValue : 0);
+            ty = _mm256_set1_epi64x(point ? m.m31.rawValue : 0);
+            tz = _mm256_set1_epi64x(point ? m.m32.rawValue : 0);
+        }
+
+        FIX64_TARGET_AVX2 void Apply(__m256i x, __m256i y, __m256i z, __m256i& ox, __m256i& oy, __m256i& oz) const
+        {
+            ox = _mm256_add_epi64(_mm256_add_epi64(Mul4(x, m00), Mul4(y, m10)), _mm256_add_epi64(Mul4(z, m20), tx));
+            oy = _mm256_add_epi64(_mm256_add_epi64(Mul4(x, m01), Mul4(y, m11)), _mm256_add_epi64(Mul4(z, m21), ty));
+            oz = _mm256_add_epi64(_mm256_add_epi64(Mul4(x, m02), Mul4(y, m12)), _mm256_add_epi64(Mul4(z, m22), tz));
+        }
+    };
+
+    FIX64_TARGET_AVX2 void TransformAoSAvx2(const FMatrix4& m, bool point, const int64_t* in, int64_t* out, size_t n)
+    {
+        const AffineAvx2 affine(m, point);
+
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            __m256i x, y, z;
+            LoadTranspose3x4(in + i * 3, x, y, z);
+            affine.Apply(x, y, z, x, y, z);
+            StoreTranspose3x4(out + i * 3, x, y, z);
+        }
+        TransformScalar(m, point, in, in + 1, in + 2, out, out + 1, out + 2, 3, i, n);
+    }
+
+    FIX64_TARGET_AVX2 void TransformSoAAvx2(const FMatrix4& m, bool point,
+                                            const int64_t* ix, const int64_t* iy, const int64_t* iz,
+                                            int64_t* ox, int64_t* oy, int64_t* oz, size_t n)
+    {
+        const AffineAvx2 affine(m, point);
+
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            __m256i x, y, z;
+            affine.Apply(Load4(ix + i), Load4(iy + i), Load4(iz + i), x, y, z);
+            Store4(ox + i, x);
+            Store4(oy + i, y);
+            Store4(oz + i, z);
+        }
+        TransformScalar(m, point, ix, iy, iz, ox, oy, oz, 1, i, n);
+    }
+
+    FIX64_TARGET_AVX2 inline __m256i Dot4(__m256i a0, __m256i a1, __m256i a2, __m256i a3,
+                                          __m256i x, __m256i y, __m256i z, __m256i w)
+    {
+        return _mm256_add_epi64(_mm256_add_epi64(Mul4(a0, x), Mul4(a1, y)), _mm256_add_epi64(Mul4(a2, z), Mul4(a3, w)));
+    }
+
+    FIX64_TARGET_AVX2 void TransformVector4Avx2(const FMatrix4& m, const int64_t* in, int64_t* out, size_t n)
+    {
+        const __m256i m00 = _mm256_set1_epi64x(m.m00.rawValue), m01 = _mm256_set1_epi64x(m.m01.rawValue);
+        const __m256i m02 = _mm256_set1_epi64x(m.m02.rawValue), m03 = _mm256_set1_epi64x(m.m03.rawValue);
+        const __m256i m10 = _mm256_set1_epi64x(m.m10.rawValue), m11 = _mm256_set1_epi64x(m.m11.rawValue);
+        const __m256i m12 = _mm256_set1_epi64x(m.m12.rawValue), m13 = _mm256_set1_epi64x(m.m13.rawValue);
+        const __m256i m20 = _mm256_set1_epi64x(m.m20.rawValue), m21 = _mm256_set1_epi64x(m.m21.rawValue);
+        const __m256i m22 = _mm256_set1_epi64x(m.m22.rawValue), m23 = _mm256_set1_epi64x(m.m23.rawValue);
+        const __m256i m30 = _mm256_set1_epi64x(m.m30.rawValue), m31 = _mm256_set1_epi64x(m.m31.rawValue);
+        const __m256i m32 = _mm256_set1_epi64x(m.m32.rawValue), m33 = _mm256_set1_epi64x(m.m33.rawValue);
+
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            // 4个向量转置成x、y、z、w，算完再转置回去
+            __m256i x = Load4(in + i * 4), y = Load4(in + i * 4 + 4), z = Load4(in + i * 4 + 8), w = Load4(in + i * 4 + 12);
+            Transpose4x4(x, y, z, w);
+
+            __m256i rx = Dot4(m00, m01, m02, m03, x, y, z, w);
+            __m256i ry = Dot4(m10, m11, m12, m13, x, y, z, w);
+            __m256i rz = Dot4(m20, m21, m22, m23, x, y, z, w);
+            __m256i rw = Dot4(m30, m31, m32, m33, x, y, z, w);
+
+            Transpose4x4(rx, ry, rz, rw);
+            Store4(out + i * 4, rx);
+            Store4(out + i * 4 + 4, ry);
+            Store4(out + i * 4 + 8, rz);
+            Store4(out + i * 4 + 12, rw);
+        }
+        TransformVector4Scalar(m, in, out, i, n);
+    }
+#endif
+
+    bool UseAvx2()
+    {
+        return FVector3Array::GetKernel() == FVector3Array::Kernel::Avx2;
+    }
+
+    void TransformAoS(const FMatrix4& m, bool point, const FVector3* in, FVector3* out, size_t count)
+    {
+        const int64_t* rawIn = &in->x.rawValue;
+        int64_t* rawOut = &out->x.rawValue;
+
+#if FIX64_SIMD_AVX2
+        if (UseAvx2())
+        {
+            TransformAoSAvx2(m, point, rawIn, rawOut, count);
+            return;
+        }
+#endif
+
+        TransformScalar(m, point, rawIn, rawIn + 1, rawIn + 2, rawOut, rawOut + 1, rawOut + 2, 3, 0, count);
+    }
+
+    void TransformSoA(const FMatrix4& m, bool point, const FVector3Array& in, FVector3Array& out)
+    {
+        size_t n = in.Size();
+        out.Resize(n);
+
+#if FIX64_SIMD_AVX2
+        if (UseAvx2())
+        {
+            TransformSoAAvx2(m, point, in.X(), in.Y(), in.Z(), out.X(), out.Y(), out.Z(), n);
+            return;
+        }
+#endif
+
+        TransformScalar(m, point, in.X(), in.Y(), in.Z(), out.X(), out.Y(), out.Z(), 1, 0, n);
+    }
+}
+
 const FMatrix4 FMatrix4::Identity = FMatrix4(
                                             Fix64::One, Fix64::Zero, Fix64::Zero, Fix64::Zero,
                                             Fix64::Zero, Fix64::One, Fix64::Zero, Fix64::Zero,
@@ -24,33 +288,96 @@ const FMatrix4 FMatrix4::Zero = FMatrix4(
 
 Fix64 FMatrix4::Determinant() const
 {
-    Fix64 m00_22 = m00 * m22;
-    Fix64 m01_23 = m01 * m23;
-    Fix64 m02_20 = m02 * m20;
-    Fix64 m03_21 = m03 * m21;
-    Fix64 m10_32 = m10 * m32;
-    Fix64 m11_33 = m11 * m33;
-    Fix64 m12_30 = m12 * m30;
-    Fix64 m13_31 = m13 * m31;
+    Minors2x2 minors(*this);
+    return minors.Determinant();
+}
+
+FMatrix4 FMatrix4::Adjugate() const
+{
+    return Minors2x2(*this).Adjugate(*this);
+}
+
+bool FMatrix4::TryInverse(FMatrix4& result) const
+{
+    Minors2x2 minors(*this);
+    Fix64 det = minors.Determinant();
+    if (det == Fix64::Zero)
+    {
+        result = Zero;
+        return false;
+    }
+
+    FMatrix4 adj = minors.Adjugate(*this);
+
+    // 有元素超出Fix64的范围(接近奇异)
+    const Fix64* a = &adj.m00;
+    bool numeratorsFit = true;
+    for (int i = 0; i < 16; ++i)
+    {
+        if (Fix64Overflow::DivOverflows(a[i].rawValue, det.rawValue))
+        {
+            result = Zero;
+            return false;
+        }
+        numeratorsFit = numeratorsFit && Fix64Divisor::NumeratorFits(a[i]);
+    }
+
+    if (!numeratorsFit)
+    {
+        // 元素 >= 2^47时左移16位会回绕，改用128位被除数的除法；不回绕时两者结果相同
+        Fix64* r = &result.m00;
+        for (int i = 0; i < 16; ++i)
+        {
+            Fix64Overflow::Div(a[i].rawValue, det.rawValue, r[i].rawValue);
+        }
+        return true;
+    }
+
+    Fix64Divisor d(det);
+
+    result.m00 = adj.m00 / d; result.m01 = adj.m01 / d; result.m02 = adj.m02 / d; result.m03 = adj.m03 / d;
+    result.m10 = adj.m10 / d; result.m11 = adj.m11 / d; result.m12 = adj.m12 / d; result.m13 = adj.m13 / d;
+    result.m20 = adj.m20 / d; result.m21 = adj.m21 / d; result.m22 = adj.m22 / d; result.m23 = adj.m23 / d;
+    result.m30 = adj.m30 / d; result.m31 = adj.m31 / d; result.m32 = adj.m32 / d; result.m33 = adj.m33 / d;
+
+    return true;
+}
+
+FMatrix4 FMatrix4::Inverse() const
+{
+    FMatrix4 inv;
+    TryInverse(inv);
+    return inv;
+}
+
+size_t FMatrix4::Inverse(const FMatrix4* in, FMatrix4* out, size_t count)
+{
+    size_t singular = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        FMatrix4 inv;
+        singular += !in[i].TryInverse(inv);
+        out[i] = inv;
+    }
+    return singular;
+}
 
-    Fix64 d1 = m00_22 * m11_33;
-    Fix64 d2 = m01_23 * m12_30;
-    Fix64 d3 = m02_20 * m13_31;
-    Fix64 d4 = m03_21 * m10_32;
-    Fix64 d5 = m00_22 * m13_31;
-    Fix64 d6 = m01_23 * m10_32;
-    Fix64 d7 = m02_20 * m11_33;
-    Fix64 d8 = m03_21 * m12_30;
+FMatrix4 FMatrix4::InverseRigid() const
+{
+    return FMatrix3x4(*this).InverseRigid().ToMatrix4();
+}
 
-    return d1 + d2 + d3 + d4 - (d5 + d6 + d7 + d8);
+FMatrix4 FMatrix4::InverseAffine() const
+{
+    return FMatrix3x4(*this).Inverse().ToMatrix4();
 }
 
-bool FMatrix4::IsIdentity()
+bool FMatrix4::IsIdentity() const
 {
     return *this == Identity;
 }
 
-FMatrix4 FMatrix4::Transpose()
+FMatrix4 FMatrix4::Transpose() const
 {
     FMatrix4 tmat = FMatrix4();
 
@@ -62,12 +389,12 @@ FMatrix4 FMatrix4::Transpose()
     return tmat;
 }
 
-Fix64 FMatrix4::Determinant(FMatrix4 m)
+Fix64 FMatrix4::Determinant(const FMatrix4& m)
 {
     return m.Determinant();
 }
 
-FVector4 FMatrix4::GetRow(int i)
+FVector4 FMatrix4::GetRow(int i) const
 {
     FVector4 row = FVector4();
     
@@ -92,7 +419,7 @@ FVector4 FMatrix4::GetRow(int i)
     return row;
 }
 
-void FMatrix4::SetRow(int i, FVector4 v)
+void FMatrix4::SetRow(int i, const FVector4& v)
 {
     if (i == 0)
     {
@@ -112,7 +439,7 @@ void FMatrix4::SetRow(int i, FVector4 v)
     }
 }
 
-FVector4 FMatrix4::GetColumn(int i)
+FVector4 FMatrix4::GetColumn(int i) const
 {
     FVector4 col = FVector4();
 
@@ -137,7 +464,7 @@ FVector4 FMatrix4::GetColumn(int i)
     return col;
 }
 
-void FMatrix4::SetColumn(int i, FVector4 v)
+void FMatrix4::SetColumn(int i, const FVector4& v)
 {
     if (i == 0)
     {
@@ -157,7 +484,7 @@ void FMatrix4::SetColumn(int i, FVector4 v)
     }
 }
 
-FMatrix4 FMatrix4::Scale(FVector3 v)
+FMatrix4 FMatrix4::Scale(const FVector3& v)
 {
     FMatrix4 mat = Identity;
 
@@ -179,27 +506,27 @@ FMatrix4 FMatrix4::Scale(Fix64 s)
     return mat;
 }
 
-FVector3 FMatrix4::GetAxisX()
+FVector3 FMatrix4::GetAxisX() const
 {
     return FVector3(m00, m01, m02);
 }
 
-FVector3 FMatrix4::GetAxisY()
+FVector3 FMatrix4::GetAxisY() const
 {
     return FVector3(m10, m11, m12);
 }
 
-FVector3 FMatrix4::GetAxisZ()
+FVector3 FMatrix4::GetAxisZ() const
 {
     return FVector3(m20, m21, m22);
 }
 
-FVector3 FMatrix4::GetOrigin()
+FVector3 FMatrix4::GetOrigin() const
 {
     return FVector3(m30, m31, m32);
 }
 
-FMatrix4 FMatrix4::TS(FVector3 pos, FVector3 scale)
+FMatrix4 FMatrix4::TS(const FVector3& pos, const FVector3& scale)
 {
     FMatrix4 mat = Identity;
 
@@ -214,7 +541,31 @@ FMatrix4 FMatrix4::TS(FVector3 pos, FVector3 scale)
     return mat;
 }
 
-FMatrix4 FMatrix4::Translate(FVector3 v)
+FMatrix4 FMatrix4::FromQuaternion(const FQuaternion& q)
+{
+    return FMatrix3x4::FromQuaternion(q).ToMatrix4();
+}
+
+FMatrix4 FMatrix4::TRS(const FVector3& pos, const FQuaternion& q, const FVector3& s)
+{
+    return FMatrix3x4::TRS(pos, q, s).ToMatrix4();
+}
+
+void FMatrix4::TRS(const FVector3* pos, const FQuaternion* rotations, const FVector3* scales,
+                   FMatrix4* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = TRS(pos[i], rotations[i], scales[i]);
+    }
+}
+
+void FMatrix4::SetTRS(const FVector3& pos, const FQuaternion& q, const FVector3& s)
+{
+    *this = TRS(pos, q, s);
+}
+
+FMatrix4 FMatrix4::Translate(const FVector3& v)
 {
     FMatrix4 mat = Identity;
 
@@ -279,7 +630,7 @@ FMatrix4 FMatrix4::RotateZ(Fix64 rad)
     return m;
 }
 
-FMatrix4 FMatrix4::RotateAxis(Fix64 theta, FVector3 n)
+FMatrix4 FMatrix4::RotateAxis(Fix64 theta, const FVector3& n)
 {
     Fix64 cos_theta = Fix64::Cos(theta);
     Fix64 sin_theta = Fix64::Sin(theta);
@@ -312,7 +663,57 @@ FMatrix4 FMatrix4::RotateAxis(Fix64 theta, FVector3 n)
     return m;
 }
 
-FVector4 FMath::operator *(FMatrix4 lhs, FVector4 v)
+FVector3 FMatrix4::MultiplyPoint(const FVector3& p) const
+{
+    return FVector3(p.x * m00 + p.y * m10 + p.z * m20 + m30,
+                    p.x * m01 + p.y * m11 + p.z * m21 + m31,
+                    p.x * m02 + p.y * m12 + p.z * m22 + m32);
+}
+
+FVector3 FMatrix4::MultiplyVector(const FVector3& v) const
+{
+    return FVector3(v.x * m00 + v.y * m10 + v.z * m20,
+                    v.x * m01 + v.y * m11 + v.z * m21,
+                    v.x * m02 + v.y * m12 + v.z * m22);
+}
+
+void FMatrix4::TransformPoints(const FVector3* in, FVector3* out, size_t count) const
+{
+    TransformAoS(*this, true, in, out, count);
+}
+
+void FMatrix4::TransformPoints(const FVector3Array& in, FVector3Array& out) const
+{
+    TransformSoA(*this, true, in, out);
+}
+
+void FMatrix4::TransformDirections(const FVector3* in, FVector3* out, size_t count) const
+{
+    TransformAoS(*this, false, in, out, count);
+}
+
+void FMatrix4::TransformDirections(const FVector3Array& in, FVector3Array& out) const
+{
+    TransformSoA(*this, false, in, out);
+}
+
+void FMatrix4::Transform(const FVector4* in, FVector4* out, size_t count) const
+{
+    const int64_t* rawIn = &in->x.rawValue;
+    int64_t* rawOut = &out->x.rawValue;
+
+#if FIX64_SIMD_AVX2
+    if (UseAvx2())
+    {
+        TransformVector4Avx2(*this, rawIn, rawOut, count);
+        return;
+    }
+#endif
+
+    TransformVector4Scalar(*this, rawIn, rawOut, 0, count);
+}
+
+FVector4 FMath::operator *(const FMatrix4& lhs, const FVector4& v)
 {
     FVector4 vec = FVector4();
 
@@ -329,61 +730,62 @@ FVector4 FMath::operator *(FMatrix4 lhs, FVector4 v)
     return vec;
 }
 
-FMatrix4 FMath::operator *(FMatrix4 lhs, FMatrix4 rhs)
+FMatrix4 FMath::operator *(const FMatrix4& lhs, const FMatrix4& rhs)
 {
-    FMatrix4 mat = FMatrix4();
-
-    mat.m00 = lhs.m00 * rhs.m00 + lhs.m01 * rhs.m10 + lhs.m02 * rhs.m20 + lhs.m03 * rhs.m30;
-    mat.m01 = lhs.m00 * rhs.m01 + lhs.m01 * rhs.m11 + lhs.m02 * rhs.m21 + lhs.m03 * rhs.m31;
-    mat.m02 = lhs.m00 * rhs.m02 + lhs.m01 * rhs.m12 + lhs.m02 * rhs.m22 + lhs.m03 * rhs.m32;
-    mat.m03 = lhs.m00 * rhs.m03 + lhs.m01 * rhs.m13 + lhs.m02 * rhs.m23 + lhs.m03 * rhs.m33;
-
-    mat.m10 = lhs.m10 * rhs.m00 + lhs.m11 * rhs.m10 + lhs.m12 * rhs.m20 + lhs.m13 * rhs.m30;
-    mat.m11 = lhs.m10 * rhs.m01 + lhs.m11 * rhs.m11 + lhs.m12 * rhs.m21 + lhs.m13 * rhs.m31;
-    mat.m12 = lhs.m10 * rhs.m02 + lhs.m11 * rhs.m12 + lhs.m12 * rhs.m22 + lhs.m13 * rhs.m32;
-    mat.m13 = lhs.m10 * rhs.m03 + lhs.m11 * rhs.m13 + lhs.m12 * rhs.m23 + lhs.m13 * rhs.m33;
-
-    mat.m20 = lhs.m20 * rhs.m00 + lhs.m21 * rhs.m10 + lhs.m22 * rhs.m20 + lhs.m23 * rhs.m30;
-    mat.m21 = lhs.m20 * rhs.m01 + lhs.m21 * rhs.m11 + lhs.m22 * rhs.m21 + lhs.m23 * rhs.m31;
-    mat.m22 = lhs.m20 * rhs.m02 + lhs.m21 * rhs.m12 + lhs.m22 * rhs.m22 + lhs.m23 * rhs.m32;
-    mat.m23 = lhs.m20 * rhs.m03 + lhs.m21 * rhs.m13 + lhs.m22 * rhs.m23 + lhs.m23 * rhs.m33;
-
-    mat.m30 = lhs.m30 * rhs.m00 + lhs.m31 * rhs.m10 + lhs.m32 * rhs.m20 + lhs.m33 * rhs.m30;
-    mat.m31 = lhs.m30 * rhs.m01 + lhs.m31 * rhs.m11 + lhs.m32 * rhs.m21 + lhs.m33 * rhs.m31;
-    mat.m32 = lhs.m30 * rhs.m02 + lhs.m31 * rhs.m12 + lhs.m32 * rhs.m22 + lhs.m33 * rhs.m32;
-    mat.m33 = lhs.m30 * rhs.m03 + lhs.m31 * rhs.m13 + lhs.m32 * rhs.m23 + lhs.m33 * rhs.m33;
+    FMatrix4 mat;
+    FMatrix4::Multiply(mat, lhs, rhs);
 
     return mat;
 }
 
-FMatrix4 FMatrix4::Multiply(FMatrix4& lhs, FMatrix4& rhs)
+FMatrix4& FMath::operator *=(FMatrix4& lhs, const FMatrix4& rhs)
 {
-    FMatrix4 mat = FMatrix4();
-
-    mat.m00 = lhs.m00 * rhs.m00 + lhs.m01 * rhs.m10 + lhs.m02 * rhs.m20 + lhs.m03 * rhs.m30;
-    mat.m01 = lhs.m00 * rhs.m01 + lhs.m01 * rhs.m11 + lhs.m02 * rhs.m21 + lhs.m03 * rhs.m31;
-    mat.m02 = lhs.m00 * rhs.m02 + lhs.m01 * rhs.m12 + lhs.m02 * rhs.m22 + lhs.m03 * rhs.m32;
-    mat.m03 = lhs.m00 * rhs.m03 + lhs.m01 * rhs.m13 + lhs.m02 * rhs.m23 + lhs.m03 * rhs.m33;
+    FMatrix4::Multiply(lhs, lhs, rhs);
 
-    mat.m10 = lhs.m10 * rhs.m00 + lhs.m11 * rhs.m10 + lhs.m12 * rhs.m20 + lhs.m13 * rhs.m30;
-    mat.m11 = lhs.m10 * rhs.m01 + lhs.m11 * rhs.m11 + lhs.m12 * rhs.m21 + lhs.m13 * rhs.m31;
-    mat.m12 = lhs.m10 * rhs.m02 + lhs.m11 * rhs.m12 + lhs.m12 * rhs.m22 + lhs.m13 * rhs.m32;
-    mat.m13 = lhs.m10 * rhs.m03 + lhs.m11 * rhs.m13 + lhs.m12 * rhs.m23 + lhs.m13 * rhs.m33;
+    return lhs;
+}
 
-    mat.m20 = lhs.m20 * rhs.m00 + lhs.m21 * rhs.m10 + lhs.m22 * rhs.m20 + lhs.m23 * rhs.m30;
-    mat.m21 = lhs.m20 * rhs.m01 + lhs.m21 * rhs.m11 + lhs.m22 * rhs.m21 + lhs.m23 * rhs.m31;
-    mat.m22 = lhs.m20 * rhs.m02 + lhs.m21 * rhs.m12 + lhs.m22 * rhs.m22 + lhs.m23 * rhs.m32;
-    mat.m23 = lhs.m20 * rhs.m03 + lhs.m21 * rhs.m13 + lhs.m22 * rhs.m23 + lhs.m23 * rhs.m33;
+FMatrix4 FMatrix4::Multiply(const FMatrix4& lhs, const FMatrix4& rhs)
+{
+    return lhs * rhs;
+}
 
-    mat.m30 = lhs.m30 * rhs.m00 + lhs.m31 * rhs.m10 + lhs.m32 * rhs.m20 + lhs.m33 * rhs.m30;
-    mat.m31 = lhs.m30 * rhs.m01 + lhs.m31 * rhs.m11 + lhs.m32 * rhs.m21 + lhs.m33 * rhs.m31;
-    mat.m32 = lhs.m30 * rhs.m02 + lhs.m31 * rhs.m12 + lhs.m32 * rhs.m22 + lhs.m33 * rhs.m32;
-    mat.m33 = lhs.m30 * rhs.m03 + lhs.m31 * rhs.m13 + lhs.m32 * rhs.m23 + lhs.m33 * rhs.m33;
+void FMatrix4::Multiply(FMatrix4& out, const FMatrix4& lhs, const FMatrix4& rhs)
+{
+    if (&out == &rhs)
+    {
+        FMatrix4 copy = rhs;
+        Multiply(out, lhs, copy);
+        return;
+    }
 
-    return mat;
+    // out的第i行只依赖lhs的第i行，先读出这一行，out与lhs相同时也正确
+    Fix64 a0 = lhs.m00, a1 = lhs.m01, a2 = lhs.m02, a3 = lhs.m03;
+    out.m00 = a0 * rhs.m00 + a1 * rhs.m10 + a2 * rhs.m20 + a3 * rhs.m30;
+    out.m01 = a0 * rhs.m01 + a1 * rhs.m11 + a2 * rhs.m21 + a3 * rhs.m31;
+    out.m02 = a0 * rhs.m02 + a1 * rhs.m12 + a2 * rhs.m22 + a3 * rhs.m32;
+    out.m03 = a0 * rhs.m03 + a1 * rhs.m13 + a2 * rhs.m23 + a3 * rhs.m33;
+
+    a0 = lhs.m10; a1 = lhs.m11; a2 = lhs.m12; a3 = lhs.m13;
+    out.m10 = a0 * rhs.m00 + a1 * rhs.m10 + a2 * rhs.m20 + a3 * rhs.m30;
+    out.m11 = a0 * rhs.m01 + a1 * rhs.m11 + a2 * rhs.m21 + a3 * rhs.m31;
+    out.m12 = a0 * rhs.m02 + a1 * rhs.m12 + a2 * rhs.m22 + a3 * rhs.m32;
+    out.m13 = a0 * rhs.m03 + a1 * rhs.m13 + a2 * rhs.m23 + a3 * rhs.m33;
+
+    a0 = lhs.m20; a1 = lhs.m21; a2 = lhs.m22; a3 = lhs.m23;
+    out.m20 = a0 * rhs.m00 + a1 * rhs.m10 + a2 * rhs.m20 + a3 * rhs.m30;
+    out.m21 = a0 * rhs.m01 + a1 * rhs.m11 + a2 * rhs.m21 + a3 * rhs.m31;
+    out.m22 = a0 * rhs.m02 + a1 * rhs.m12 + a2 * rhs.m22 + a3 * rhs.m32;
+    out.m23 = a0 * rhs.m03 + a1 * rhs.m13 + a2 * rhs.m23 + a3 * rhs.m33;
+
+    a0 = lhs.m30; a1 = lhs.m31; a2 = lhs.m32; a3 = lhs.m33;
+    out.m30 = a0 * rhs.m00 + a1 * rhs.m10 + a2 * rhs.m20 + a3 * rhs.m30;
+    out.m31 = a0 * rhs.m01 + a1 * rhs.m11 + a2 * rhs.m21 + a3 * rhs.m31;
+    out.m32 = a0 * rhs.m02 + a1 * rhs.m12 + a2 * rhs.m22 + a3 * rhs.m32;
+    out.m33 = a0 * rhs.m03 + a1 * rhs.m13 + a2 * rhs.m23 + a3 * rhs.m33;
 }
 
-bool FMath::operator ==(FMatrix4 lhs, FMatrix4 rhs)
+bool FMath::operator ==(const FMatrix4& lhs, const FMatrix4& rhs)
 {
     return lhs.m00 == rhs.m00 && lhs.m01 == rhs.m01 && lhs.m02 == rhs.m02 && lhs.m03 == rhs.m03 &&
            lhs.m10 == rhs.m10 && lhs.m11 == rhs.m11 && lhs.m12 == rhs.m12 && lhs.m13 == rhs.m13 &&
@@ -392,7 +794,7 @@ bool FMath::operator ==(FMatrix4 lhs, FMatrix4 rhs)
 
 }
 
-bool FMath::operator !=(FMatrix4 lhs, FMatrix4 rhs)
+bool FMath::operator !=(const FMatrix4& lhs, const FMatrix4& rhs)
 {
     return lhs.m00 != rhs.m00 || lhs.m01 != rhs.m01 || lhs.m02 != rhs.m02 || lhs.m03 != rhs.m03 ||
            lhs.m10 != rhs.m10 || lhs.m11 != rhs.m11 || lhs.m12 != rhs.m12 || lhs.m13 != rhs.m13 ||
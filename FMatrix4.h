@@ -9,12 +9,16 @@
 #ifndef FMatrix4_h
 #define FMatrix4_h
 
+#include <stddef.h>
 #include "Fix64.h"
 #include "FVector4.h"
 #include "FVector3.h"
 
 namespace FMath
 {
+    class FVector3Array;
+    struct FQuaternion;
+
     struct FMatrix4
     {
         Fix64 m00, m01, m02, m03;
@@ -42,51 +46,82 @@ namespace FMath
 
         const static FMatrix4 Zero;
 
+        /// <summary>
+        /// 按前两行、后两行各6个2x2子式做Laplace展开，共30次乘法.
+        /// </summary>
         Fix64 Determinant() const;
 
-            
         /// <summary>
-        /// 求逆矩阵
+        /// 伴随矩阵(余子式矩阵的转置)，与Determinant共用2x2子式.
+        /// </summary>
+        FMatrix4 Adjugate() const;
+
+        /// <summary>
+        /// 求逆矩阵：Adjugate() / Determinant()，16次除法共用一个Fix64Divisor；
+        /// 伴随矩阵有元素 >= 2^47(左移16位会回绕)时改用128位被除数的Fix64Overflow::Div.
+        /// 行列式为0或逆矩阵有元素超出Fix64的范围时返回false，result为Zero.
+        /// 定点数的子式有截断误差，数值上奇异(如两行相等)的矩阵行列式不一定恰好为0，需要时由调用方按Determinant()判断.
+        /// </summary>
+        bool TryInverse(FMatrix4& result) const;
+
+        /// <summary>
+        /// 求逆矩阵，不可逆时返回Zero.
+        /// </summary>
+        FMatrix4 Inverse() const;
+
+        /// <summary>
+        /// 批量求逆，out[i] = in[i].Inverse()，out可以与in相同.
         /// </summary>
-        //Fix64 inverse { get; }
+        /// <returns>不可逆(结果为Zero)的个数</returns>
+        static size_t Inverse(const FMatrix4* in, FMatrix4* out, size_t count);
 
-        bool IsIdentity();
+        /// <summary>
+        /// 刚体变换(最后一列为(0, 0, 0, 1)，左上3x3正交)的逆，只做转置和乘加，见FMatrix3x4::InverseRigid.
+        /// </summary>
+        FMatrix4 InverseRigid() const;
+
+        /// <summary>
+        /// 仿射变换(最后一列为(0, 0, 0, 1))的逆，只求3x3的逆，见FMatrix3x4::Inverse.
+        /// </summary>
+        FMatrix4 InverseAffine() const;
+
+        bool IsIdentity() const;
         
         /// <summary>
         /// 转置矩阵
         /// </summary>
-        FMatrix4 Transpose();
+        FMatrix4 Transpose() const;
 
-        static Fix64 Determinant(FMatrix4 m);
+        static Fix64 Determinant(const FMatrix4& m);
 
-        FVector4 GetRow(int i);
+        FVector4 GetRow(int i) const;
 
-        void SetRow(int i, FVector4 v);
+        void SetRow(int i, const FVector4& v);
 
-        FVector4 GetColumn(int i);
+        FVector4 GetColumn(int i) const;
 
-        void SetColumn(int i, FVector4 v);
+        void SetColumn(int i, const FVector4& v);
 
-        static FMatrix4 Scale(FVector3 v);
+        static FMatrix4 Scale(const FVector3& v);
         
         static FMatrix4 Scale(Fix64 s);
 
-        //
-        // 摘要:
-        //     ///
-        //     Creates a translation, rotation and scaling matrix.
-        //     ///
-        //
-        // 参数:
-        //   pos:
-        //
-        //   q:
-        //
-        //   s:
-        //static FMatrix4 TRS(FVector3 pos, FQuaternion q, FVector3 s)
-        //{
-          //  UnityEngine.Matrix4x4
-       // }
+        /// <summary>
+        /// 单位四元数对应的旋转矩阵，见FMatrix3x4::FromQuaternion.
+        /// </summary>
+        static FMatrix4 FromQuaternion(const FQuaternion& q);
+
+        /// <summary>
+        /// Creates a translation, rotation and scaling matrix.
+        /// 先缩放、再旋转、最后平移，没有三角函数，见FMatrix3x4::TRS.
+        /// </summary>
+        static FMatrix4 TRS(const FVector3& pos, const FQuaternion& q, const FVector3& s);
+
+        /// <summary>
+        /// 批量TRS：out[i] = TRS(pos[i], rotations[i], scales[i]).
+        /// </summary>
+        static void TRS(const FVector3* pos, const FQuaternion* rotations, const FVector3* scales,
+                        FMatrix4* out, size_t count);
 
         /// <summary>
         /// builds matrix4 from quaternion.
@@ -98,17 +133,17 @@ namespace FMath
             // theta =
         //}
 
-        FVector3 GetAxisX();
+        FVector3 GetAxisX() const;
 
-        FVector3 GetAxisY();
+        FVector3 GetAxisY() const;
 
-        FVector3 GetAxisZ();
+        FVector3 GetAxisZ() const;
 
-        FVector3 GetOrigin();
+        FVector3 GetOrigin() const;
 
-        static FMatrix4 TS(FVector3 pos, FVector3 scale);
+        static FMatrix4 TS(const FVector3& pos, const FVector3& scale);
         
-        static FMatrix4 Translate(FVector3 v);
+        static FMatrix4 Translate(const FVector3& v);
 
         static FMatrix4 RotateX(Fix64 rad);
         
@@ -126,11 +161,40 @@ namespace FMath
         /// <param name="theta">rotate angle in rad.</param>
         /// <param name="n"></param>
         /// <returns></returns>
-        static FMatrix4 RotateAxis(Fix64 theta, FVector3 n);
+        static FMatrix4 RotateAxis(Fix64 theta, const FVector3& n);
+
+        void SetTRS(const FVector3& pos, const FQuaternion& q, const FVector3& s);
+
+        /// <summary>
+        /// 变换点：p' = p.x * AxisX + p.y * AxisY + p.z * AxisZ + Origin.
+        /// 与TS、Translate、RotateX等构造的矩阵一致(行向量，平移在第3行).
+        /// </summary>
+        FVector3 MultiplyPoint(const FVector3& p) const;
+
+        /// <summary>
+        /// 变换方向：与MultiplyPoint相同，但不加平移.
+        /// </summary>
+        FVector3 MultiplyVector(const FVector3& v) const;
+
+        /// <summary>
+        /// 批量变换点，结果与逐个调用MultiplyPoint逐位一致，out可以与in相同.
+        /// 矩阵每批只读取一次；AVX2实现每次处理4个点，实现的选择见FVector3Array::SetKernel.
+        /// </summary>
+        void TransformPoints(const FVector3* in, FVector3* out, size_t count) const;
+
+        void TransformPoints(const FVector3Array& in, FVector3Array& out) const;
 
-        //void SetTRS(FVector3 pos, FQuaternion q, FVector3 s);
+        /// <summary>
+        /// 批量变换方向，结果与逐个调用MultiplyVector逐位一致，out可以与in相同.
+        /// </summary>
+        void TransformDirections(const FVector3* in, FVector3* out, size_t count) const;
 
-        //static FVector3 MultiplyVector
+        void TransformDirections(const FVector3Array& in, FVector3Array& out) const;
+
+        /// <summary>
+        /// 批量4x4 * 4x1列向量，结果与逐个调用operator *(const FMatrix4&, const FVector4&)逐位一致，out可以与in相同.
+        /// </summary>
+        void Transform(const FVector4* in, FVector4* out, size_t count) const;
 
         /// <summary>
         /// 4x4 * 4x1 列向量
@@ -138,15 +202,26 @@ namespace FMath
         /// <param name="lhs"></param>
         /// <param name="v"></param>
         /// <returns></returns>
-        friend FVector4 operator *(FMatrix4 lhs, FVector4 v);
+        friend FVector4 operator *(const FMatrix4& lhs, const FVector4& v);
 
-        friend FMatrix4 operator *(FMatrix4 lhs, FMatrix4 rhs);
+        friend FMatrix4 operator *(const FMatrix4& lhs, const FMatrix4& rhs);
 
-        static FMatrix4 Multiply(FMatrix4& lhs, FMatrix4& rhs);
-        
-        friend bool operator ==(FMatrix4 lhs, FMatrix4 rhs);
+        /// <summary>
+        /// lhs = lhs * rhs，不产生临时矩阵.
+        /// </summary>
+        friend FMatrix4& operator *=(FMatrix4& lhs, const FMatrix4& rhs);
+
+        static FMatrix4 Multiply(const FMatrix4& lhs, const FMatrix4& rhs);
+
+        /// <summary>
+        /// out = lhs * rhs，直接写入out. out可以是lhs(按行计算，先读出lhs的一行)；
+        /// out是rhs时需要先复制rhs.
+        /// </summary>
+        static void Multiply(FMatrix4& out, const FMatrix4& lhs, const FMatrix4& rhs);
+
+        friend bool operator ==(const FMatrix4& lhs, const FMatrix4& rhs);
 
-        friend bool operator !=(FMatrix4 lhs, FMatrix4 rhs);
+        friend bool operator !=(const FMatrix4& lhs, const FMatrix4& rhs);
     };
 }
 
@@ -7,10 +7,344 @@
 //
 
 #include "FQuaternion.h"
+#include "Fix64Divisor.h"
+#include "Fix64Simd.h"
+#include "FVector3Array.h"
+#include "FMatrix3x4.h"
+#include <algorithm>
 
 using namespace FMath;
 
-const FQuaternion FQuaternion::Identity = FQuaternion(Fix64::One, Fix64::Zero, Fix64::Zero, Fix64::Zero);
+namespace
+{
+    static_assert(sizeof(FQuaternion) == 4 * sizeof(int64_t), "FQuaternion must be four packed rawValues");
+
+    /// 按w、x、y、z存放的分量按x、y、z、w的顺序格式化
+    const int xyzwOrder[4] = { 1, 2, 3, 0 };
+
+    /************ scalar ***********/
+
+    /// <summary>
+    /// 旋转[begin, n)的向量. 第i个四元数的w、x、y、z位于q[i * qStride]起，qStride为0时所有向量用同一个四元数；
+    /// 第i个向量的分量位于ix[i * stride]、iy[i * stride]、iz[i * stride]，AoS传stride = 3，SoA传stride = 1.
+    /// </summary>
+    void RotateScalar(const int64_t* q, size_t qStride,
+                      const int64_t* ix, const int64_t* iy, const int64_t* iz,
+                      int64_t* ox, int64_t* oy, int64_t* oz,
+                      size_t stride, size_t begin, size_t n)
+    {
+        for (size_t i = begin; i < n; ++i)
+        {
+            const int64_t* r = q + i * qStride;
+            const int64_t w = r[0], ux = r[1], uy = r[2], uz = r[3];
+
+            size_t j = i * stride;
+            int64_t x = ix[j], y = iy[j], z = iz[j];
+
+            // t = 2(u×v)
+            int64_t tx = Fix64::Mul(uy, z) - Fix64::Mul(uz, y);
+            int64_t ty = Fix64::Mul(uz, x) - Fix64::Mul(ux, z);
+            int64_t tz = Fix64::Mul(ux, y) - Fix64::Mul(uy, x);
+            tx += tx;
+            ty += ty;
+            tz += tz;
+
+            // v' = v + w*t + u×t
+            ox[j] = x + Fix64::Mul(w, tx) + Fix64::Mul(uy, tz) - Fix64::Mul(uz, ty);
+            oy[j] = y + Fix64::Mul(w, ty) + Fix64::Mul(uz, tx) - Fix64::Mul(ux, tz);
+            oz[j] = z + Fix64::Mul(w, tz) + Fix64::Mul(ux, ty) - Fix64::Mul(uy, tx);
+        }
+    }
+
+#if FIX64_SIMD_AVX2
+    /************ avx2 ***********/
+
+    using namespace FMath::Simd;
+
+    FIX64_TARGET_AVX2 inline void Rotate4(__m256i w, __m256i ux, __m256i uy, __m256i uz,
+                                          __m256i& x, __m256i& y, __m256i& z)
+    {
+        __m256i tx = _mm256_sub_epi64(Mul4(uy, z), Mul4(uz, y));
+        __m256i ty = _mm256_sub_epi64(Mul4(uz, x), Mul4(ux, z));
+        __m256i tz = _mm256_sub_epi64(Mul4(ux, y), Mul4(uy, x));
+        tx = _mm256_add_epi64(tx, tx);
+        ty = _mm256_add_epi64(ty, ty);
+        tz = _mm256_add_epi64(tz, tz);
+
+        x = _mm256_add_epi64(_mm256_add_epi64(x, Mul4(w, tx)), _mm256_sub_epi64(Mul4(uy, tz), Mul4(uz, ty)));
+        y = _mm256_add_epi64(_mm256_add_epi64(y, Mul4(w, ty)), _mm256_sub_epi64(Mul4(uz, tx), Mul4(ux, tz)));
+        z = _mm256_add_epi64(_mm256_add_epi64(z, Mul4(w, tz)), _mm256_sub_epi64(Mul4(ux, ty), Mul4(uy, tx)));
+    }
+
+    /// <summary>
+    /// PerElement：每个向量有自己的四元数(4个一组转置成w、x、y、z)，否则广播同一个四元数.
+    /// AoS：向量为连续的FVector3，否则为SoA的三个数组.
+    /// </summary>
+    template<bool PerElement, bool AoS>
+    FIX64_TARGET_AVX2 void RotateAvx2(const int64_t* q,
+                                      const int64_t* ix, const int64_t* iy, const int64_t* iz,
+                                      int64_t* ox, int64_t* oy, int64_t* oz, size_t n)
+    {
+        __m256i w = _mm256_set1_epi64x(q[0]);
+        __m256i ux = _mm256_set1_epi64x(q[1]);
+        __m256i uy = _mm256_set1_epi64x(q[2]);
+        __m256i uz = _mm256_set1_epi64x(q[3]);
+
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            if (PerElement)
+            {
+                const int64_t* r = q + i * 4;
+                w = Load4(r);
+                ux = Load4(r + 4);
+                uy = Load4(r + 8);
+                uz = Load4(r + 12);
+                Transpose4x4(w, ux, uy, uz);
+            }
+
+            __m256i x, y, z;
+            if (AoS)
+            {
+                LoadTranspose3x4(ix + i * 3, x, y, z);
+            }
+            else
+            {
+                x = Load4(ix + i);
+                y = Load4(iy + i);
+                z = Load4(iz + i);
+            }
+
+            Rotate4(w, ux, uy, uz, x, y, z);
+
+            if (AoS)
+            {
+                StoreTranspose3x4(ox + i * 3, x, y, z);
+            }
+            else
+            {
+                Store4(ox + i, x);
+                Store4(oy + i, y);
+                Store4(oz + i, z);
+            }
+        }
+
+        const size_t stride = AoS ? 3 : 1;
+        RotateScalar(q, PerElement ? 4 : 0, ix, iy, iz, ox, oy, oz, stride, i, n);
+    }
+#endif
+
+    bool UseAvx2()
+    {
+        return FVector3Array::GetKernel() == FVector3Array::Kernel::Avx2;
+    }
+
+    void RotateAoS(const int64_t* q, bool perElement, const FVector3* in, FVector3* out, size_t count)
+    {
+        const int64_t* rawIn = &in->x.rawValue;
+        int64_t* rawOut = &out->x.rawValue;
+
+#if FIX64_SIMD_AVX2
+        if (UseAvx2())
+        {
+            if (perElement)
+            {
+                RotateAvx2<true, true>(q, rawIn, rawIn + 1, rawIn + 2, rawOut, rawOut + 1, rawOut + 2, count);
+            }
+            else
+            {
+                RotateAvx2<false, true>(q, rawIn, rawIn + 1, rawIn + 2, rawOut, rawOut + 1, rawOut + 2, count);
+            }
+            return;
+        }
+#endif
+
+        RotateScalar(q, perElement ? 4 : 0, rawIn, rawIn + 1, rawIn + 2, rawOut, rawOut + 1, rawOut + 2, 3, 0, count);
+    }
+
+    void RotateSoA(const int64_t* q, bool perElement, const FVector3Array& in, FVector3Array& out)
+    {
+        size_t n = in.Size();
+        out.Resize(n);
+
+#if FIX64_SIMD_AVX2
+        if (UseAvx2())
+        {
+            if (perElement)
+            {
+                RotateAvx2<true, false>(q, in.X(), in.Y(), in.Z(), out.X(), out.Y(), out.Z(), n);
+            }
+            else
+            {
+                RotateAvx2<false, false>(q, in.X(), in.Y(), in.Z(), out.X(), out.Y(), out.Z(), n);
+            }
+            return;
+        }
+#endif
+
+        RotateScalar(q, perElement ? 4 : 0, in.X(), in.Y(), in.Z(), out.X(), out.Y(), out.Z(), 1, 0, n);
+    }
+
+    /************ interpolation ***********/
+
+    FQuaternion Lerp(const FQuaternion& a, const FQuaternion& b, Fix64 t)
+    {
+        return FQuaternion(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t,
+                           a.z + (b.z - a.z) * t, a.w + (b.w - a.w) * t);
+    }
+
+    Fix64 Scale(Fix64 v, int shift)
+    {
+        return Fix64::FromRawValue(Fix64::ScaleRaw(v.rawValue, shift));
+    }
+
+    /// <summary>
+    /// 把q的各分量放大2^shift倍，使最大分量的绝对值不小于0.5，再求长度和方向.
+    /// 分量很小(夹角很小)时直接求平方和会在Q16下丢掉大部分有效位，放大后长度的相对误差与分量大小无关.
+    /// </summary>
+    /// <returns>q为0时返回false</returns>
+    bool Decompose(const FQuaternion& q, FQuaternion& dir, Fix64& scaledLength, int& shift)
+    {
+        int64_t m = Fix64::Abs(q.w.rawValue) | Fix64::Abs(q.x.rawValue) | Fix64::Abs(q.y.rawValue) | Fix64::Abs(q.z.rawValue);
+        if (m == 0)
+        {
+            return false;
+        }
+
+        shift = std::max(Fix64::NormalizeShift(m, Fix64::fractionBits), 0);
+
+        FQuaternion scaled = FQuaternion(Scale(q.x, shift), Scale(q.y, shift), Scale(q.z, shift), Scale(q.w, shift));
+        scaledLength = scaled.Magnitude();
+        dir = scaled.NormalizedFast();
+
+        return true;
+    }
+
+    /// <summary>
+    /// 旋转矩阵(行向量约定)转四元数. 先求出绝对值最大的分量v = sqrt(s) / 2，
+    /// 其余分量为两个非对角元素之和或差除以4v，即乘以1/(2sqrt(s))，共用一次InvSqrtMantissa.
+    /// </summary>
+    FQuaternion FromRotation(Fix64 m00, Fix64 m01, Fix64 m02,
+                             Fix64 m10, Fix64 m11, Fix64 m12,
+                             Fix64 m20, Fix64 m21, Fix64 m22)
+    {
+        Fix64 trace = m00 + m11 + m22;
+
+        Fix64 s;
+        Fix64 a, b, c;
+        int largest;
+        if (trace > Fix64::Zero)
+        {
+            largest = 3;
+            s = Fix64::One + trace;
+            a = m12 - m21;
+            b = m20 - m02;
+            c = m01 - m10;
+        }
+        else if (m00 >= m11 && m00 >= m22)
+        {
+            largest = 0;
+            s = Fix64::One + m00 - m11 - m22;
+            a = m12 - m21;
+            b = m01 + m10;
+            c = m02 + m20;
+        }
+        else if (m11 >= m22)
+        {
+            largest = 1;
+            s = Fix64::One - m00 + m11 - m22;
+            a = m20 - m02;
+            b = m01 + m10;
+            c = m12 + m21;
+        }
+        else
+        {
+            largest = 2;
+            s = Fix64::One - m00 - m11 + m22;
+            a = m01 - m10;
+            b = m02 + m20;
+            c = m12 + m21;
+        }
+
+        // 多乘一个1/2：v = s / (2sqrt(s))
+        int shift = 0;
+        int64_t inv = Fix64::InvSqrtMantissa(s.rawValue, shift);
+        ++shift;
+
+        Fix64 v = Fix64::FromRawValue(Fix64::MulShift(s.rawValue, inv, shift));
+        a = Fix64::FromRawValue(Fix64::MulShift(a.rawValue, inv, shift));
+        b = Fix64::FromRawValue(Fix64::MulShift(b.rawValue, inv, shift));
+        c = Fix64::FromRawValue(Fix64::MulShift(c.rawValue, inv, shift));
+
+        FQuaternion q;
+        switch (largest)
+        {
+        case 0:
+            q = FQuaternion(v, b, c, a);
+            break;
+        case 1:
+            q = FQuaternion(b, v, c, a);
+            break;
+        case 2:
+            q = FQuaternion(b, c, v, a);
+            break;
+        default:
+            q = FQuaternion(a, b, c, v);
+            break;
+        }
+
+        return q.w < Fix64::Zero ? -q : q;
+    }
+
+    /// 万向节锁的阈值：|sin(x)|超过它时x视为±π/2，此时cos(x)不超过0.008，再小的cos(x)下atan2的输入只剩几个有效位
+    constexpr Fix64 gimbalLockSin = Fix64::FromRawValue(Fix64::fractionFactor - 2);
+
+    FQuaternion SlerpPath(const FQuaternion& a, const FQuaternion& b, Fix64 t, bool shortest)
+    {
+        Fix64 cosTheta = FQuaternion::Dot(a, b);
+        FQuaternion end = b;
+
+        if (shortest && cosTheta < Fix64::Zero)
+        {
+            end = -b;
+            cosTheta = -cosTheta;
+        }
+
+        // c为b中与a正交的部分，b = a*cos(theta) + c*sin(theta)
+        FQuaternion c;
+        Fix64 sinTheta;
+        int shift;
+        if (!Decompose(end - a * cosTheta, c, sinTheta, shift))
+        {
+            return Lerp(a, end, t).NormalizedFast();
+        }
+
+        Fix64 theta = Fix64::Atan2(sinTheta, Scale(cosTheta, shift));
+        Fix64 angle = theta * t;
+
+        return a * Fix64::Cos(angle) + c * Fix64::Sin(angle);
+    }
+
+    // |Dot(a, b)|的多项式，拟合slerp与nlerp的t之差
+    constexpr Fix64 slerpFastA0 = Fix64::FromDouble(1.0904);
+    constexpr Fix64 slerpFastA1 = Fix64::FromDouble(-3.2452);
+    constexpr Fix64 slerpFastA2 = Fix64::FromDouble(3.55645);
+    constexpr Fix64 slerpFastA3 = Fix64::FromDouble(-1.43519);
+    constexpr Fix64 slerpFastB0 = Fix64::FromDouble(0.848013);
+    constexpr Fix64 slerpFastB1 = Fix64::FromDouble(-1.06021);
+    constexpr Fix64 slerpFastB2 = Fix64::FromDouble(0.215638);
+
+    template<FQuaternion (*Interpolate)(const FQuaternion&, const FQuaternion&, Fix64)>
+    void InterpolateBatch(const FQuaternion* a, const FQuaternion* b, Fix64 t, FQuaternion* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            out[i] = Interpolate(a[i], b[i], t);
+        }
+    }
+}
+
+const FQuaternion FQuaternion::Identity = FQuaternion(Fix64::Zero, Fix64::Zero, Fix64::Zero, Fix64::One);
 
 Fix64 FQuaternion::Magnitude() const
 {
@@ -29,12 +363,24 @@ FQuaternion FQuaternion::Conjugate() const
 
 FQuaternion FQuaternion::Normalized() const
 {
-    Fix64 len = Magnitude();
+    Fix64Divisor len(Magnitude());
     //return new FQuaternion(Fix64.Div(x, len), Fix64.Div(y, len), Fix64.Div(z, len), Fix64.Div(w, len));
     return FQuaternion(x / len, y / len, z / len, w / len);
 }
 
-FQuaternion FQuaternion::Inverse(FQuaternion q)
+FQuaternion FQuaternion::NormalizedFast() const
+{
+    int shift = 0;
+    int64_t inv = Fix64::InvSqrtMantissa(SqrMagnitude().rawValue, shift);
+
+    return FQuaternion(
+        Fix64::FromRawValue(Fix64::MulShift(x.rawValue, inv, shift)),
+        Fix64::FromRawValue(Fix64::MulShift(y.rawValue, inv, shift)),
+        Fix64::FromRawValue(Fix64::MulShift(z.rawValue, inv, shift)),
+        Fix64::FromRawValue(Fix64::MulShift(w.rawValue, inv, shift)));
+}
+
+FQuaternion FQuaternion::Inverse(const FQuaternion& q)
 {
     Fix64 sqrLen = q.SqrMagnitude();
 
@@ -47,86 +393,130 @@ FQuaternion FQuaternion::Inverse(FQuaternion q)
         //return new FQuaternion(Fix64.Div(-q.x, sqrLen), Fix64.Div(-q.y, sqrLen),
         //Fix64.Div(-q.z, sqrLen), Fix64.Div(q.w, sqrLen));
 
-        return FQuaternion(-q.x / sqrLen, -q.y / sqrLen,
-           -q.z / sqrLen, q.w /sqrLen);
+        Fix64Divisor d(sqrLen);
+        return FQuaternion(-q.x / d, -q.y / d,
+           -q.z / d, q.w / d);
     }
 }
 
-FQuaternion FQuaternion::AngleAxis(Fix64 angle, FVector3 axis)
+FQuaternion FQuaternion::AngleAxis(Fix64 angle, const FVector3& axis)
 {
     Fix64 angle_over_2 = angle / 2;
 
     Fix64 sin_theta = Fix64::Sin(angle_over_2);
-    Fix64 cos_theta = Fix64::Sin(angle_over_2);
+    Fix64 cos_theta = Fix64::Cos(angle_over_2);
 
     FVector3 v = axis.Normalized() * sin_theta;
 
     return FQuaternion(v.x, v.y, v.z, cos_theta);
 }
 
-FQuaternion FQuaternion::Conjugate(FQuaternion q)
+FQuaternion FQuaternion::Conjugate(const FQuaternion& q)
 {
     return FQuaternion(-q.x, -q.y, -q.z, q.w);
 }
 
-FQuaternion FMath::operator +(FQuaternion a, FQuaternion b)
+FQuaternion FMath::operator +(const FQuaternion& a, const FQuaternion& b)
 {
     return FQuaternion(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
 }
 
-FQuaternion FMath::operator -(FQuaternion a, FQuaternion b)
+FQuaternion FMath::operator -(const FQuaternion& a, const FQuaternion& b)
 {
     return FQuaternion(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
 }
 
-Fix64 FQuaternion::Dot(FQuaternion a, FQuaternion b)
+Fix64 FQuaternion::Dot(const FQuaternion& a, const FQuaternion& b)
 {
-    return a.w * b.w - (a.x * b.x + a.y * b.y + a.z * b.z);
-    //return Fix64.Mul(a.w, b.w) - (Fix64.Mul(a.x, b.x) + Fix64.Mul(a.y, b.y) + Fix64.Mul(a.z, b.z));
+    return a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z;
 }
 
-FQuaternion FMath::operator *(FQuaternion a, FQuaternion b)
+FQuaternion FMath::operator *(const FQuaternion& a, const FQuaternion& b)
 {
-    FQuaternion q = FQuaternion();
-
-    q.w = a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z;
-    q.x = a.w * b.x + b.w * a.x + a.y * b.z - b.y * a.z;
-    q.y = a.w * b.y + b.w * a.y + a.z * b.x - b.z * a.x;
-    q.z = a.w * b.z + b.w * a.z + a.x * b.y - b.x * a.y;
+    FQuaternion q;
+    FQuaternion::Multiply(q, a, b);
 
     return q;
 }
 
-FVector3 FMath::operator *(FQuaternion q, FVector3 v)
+FQuaternion& FMath::operator *=(FQuaternion& a, const FQuaternion& b)
+{
+    FQuaternion::Multiply(a, a, b);
+
+    return a;
+}
+
+void FQuaternion::Multiply(FQuaternion& out, const FQuaternion& a, const FQuaternion& b)
 {
-    FQuaternion pq = FQuaternion(v.x, v.y, v.z, Fix64::Zero);
-    FQuaternion tq = q * pq * FQuaternion::Conjugate(q);
+    // 先算完再写，out可以是a或b
+    Fix64 w = a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z;
+    Fix64 x = a.w * b.x + b.w * a.x + a.y * b.z - b.y * a.z;
+    Fix64 y = a.w * b.y + b.w * a.y + a.z * b.x - b.z * a.x;
+    Fix64 z = a.w * b.z + b.w * a.z + a.x * b.y - b.x * a.y;
+
+    out.w = w;
+    out.x = x;
+    out.y = y;
+    out.z = z;
+}
 
-    return FVector3(tq.x, tq.y, tq.z);
+FVector3 FMath::operator *(const FQuaternion& q, const FVector3& v)
+{
+    return q.Rotate(v);
 }
 
-FQuaternion FMath::operator *(FQuaternion q, Fix64 a)
+FVector3 FQuaternion::Rotate(const FVector3& v) const
+{
+    FVector3 t = FVector3::Cross(FVector3(x, y, z), v);
+    t = t + t;
+
+    FVector3 c = FVector3::Cross(FVector3(x, y, z), t);
+
+    return FVector3(v.x + w * t.x + c.x, v.y + w * t.y + c.y, v.z + w * t.z + c.z);
+}
+
+void FQuaternion::Rotate(const FVector3* in, FVector3* out, size_t count) const
+{
+    RotateAoS(&w.rawValue, false, in, out, count);
+}
+
+void FQuaternion::Rotate(const FVector3Array& in, FVector3Array& out) const
+{
+    RotateSoA(&w.rawValue, false, in, out);
+}
+
+void FQuaternion::Rotate(const FQuaternion* rotations, const FVector3* in, FVector3* out, size_t count)
+{
+    RotateAoS(&rotations->w.rawValue, true, in, out, count);
+}
+
+void FQuaternion::Rotate(const FQuaternion* rotations, const FVector3Array& in, FVector3Array& out)
+{
+    RotateSoA(&rotations->w.rawValue, true, in, out);
+}
+
+FQuaternion FMath::operator *(const FQuaternion& q, Fix64 a)
 {
     //return new FQuaternion(Fix64.Mul(a, q.x), Fix64.Mul(a, q.y), Fix64.Mul(a, q.z), Fix64.Mul(a, q.w));
-    return FQuaternion(a*q.w, a*q.x, a*q.y, a*q.z);
+    return FQuaternion(a*q.x, a*q.y, a*q.z, a*q.w);
 }
 
-bool FMath::operator ==(FQuaternion a, FQuaternion b)
+bool FMath::operator ==(const FQuaternion& a, const FQuaternion& b)
 {
     return a.w == b.w && a.x == b.x && a.y == b.y && a.z == b.z;
 }
 
-bool FMath::operator !=(FQuaternion a, FQuaternion b)
+bool FMath::operator !=(const FQuaternion& a, const FQuaternion& b)
 {
     return a.w != b.w || a.x != b.x || a.y != b.y || a.z != b.z;
 }
 
-FQuaternion FMath::operator -(FQuaternion q)
+FQuaternion FMath::operator -(const FQuaternion& q)
 {
     return FQuaternion(-q.x, -q.y, -q.z, -q.w);
 }
 
-void FQuaternion::SetAngleAxis(Fix64 angle, FVector3 axis)
+void FQuaternion::SetAngleAxis(Fix64 angle, const FVector3& axis)
 {
     Fix64 angle_over_2 = angle / 2;
 
@@ -141,14 +531,14 @@ void FQuaternion::SetAngleAxis(Fix64 angle, FVector3 axis)
     z = v.z;
 }
 
-void FQuaternion::ToAngleAxis(Fix64& angle, FVector3 axis)
+void FQuaternion::ToAngleAxis(Fix64& angle, FVector3& axis) const
 {
     angle = Fix64::Acos(w) * 2;
     axis = FVector3(x, y, z);
     axis.Normalize();
 }
 
-Fix64 FQuaternion::Angle(FQuaternion a, FQuaternion b)
+Fix64 FQuaternion::Angle(const FQuaternion& a, const FQuaternion& b)
 {
     FQuaternion ia = Inverse(a);
     FQuaternion d = ia * b;
@@ -156,7 +546,7 @@ Fix64 FQuaternion::Angle(FQuaternion a, FQuaternion b)
     return Fix64::Acos(d.w) * 2;
 }
 
-FQuaternion FQuaternion::FromToRotation(FVector3 fromDir, FVector3 toDir)
+FQuaternion FQuaternion::FromToRotation(const FVector3& fromDir, const FVector3& toDir)
 {
     FQuaternion q = FQuaternion();
     q.SetFromToRotation(fromDir, toDir);
@@ -164,7 +554,7 @@ FQuaternion FQuaternion::FromToRotation(FVector3 fromDir, FVector3 toDir)
     return q;
 }
 
-void FQuaternion::SetFromToRotation(FVector3 fromDir, FVector3 toDir)
+void FQuaternion::SetFromToRotation(const FVector3& fromDir, const FVector3& toDir)
 {
 //            Debug.Assert(Fix64.one - fromDir.magnitude < Fix64.epsilon ||
 //              Fix64.one - fromDir.magnitude > Fix64.epsilon,
@@ -180,7 +570,216 @@ void FQuaternion::SetFromToRotation(FVector3 fromDir, FVector3 toDir)
     SetAngleAxis(angle, axis);
 }
 
+FQuaternion FQuaternion::Nlerp(const FQuaternion& a, const FQuaternion& b, Fix64 t)
+{
+    FQuaternion end = Dot(a, b) < Fix64::Zero ? -b : b;
+
+    return Lerp(a, end, t).NormalizedFast();
+}
+
+FQuaternion FQuaternion::Slerp(const FQuaternion& a, const FQuaternion& b, Fix64 t)
+{
+    return SlerpPath(a, b, t, true);
+}
+
+FQuaternion FQuaternion::SlerpFast(const FQuaternion& a, const FQuaternion& b, Fix64 t)
+{
+    Fix64 d = Dot(a, b);
+    FQuaternion end = d < Fix64::Zero ? -b : b;
+    d = d.Abs();
+
+    Fix64 ka = slerpFastA0 + d * (slerpFastA1 + d * (slerpFastA2 + d * slerpFastA3));
+    Fix64 kb = slerpFastB0 + d * (slerpFastB1 + d * slerpFastB2);
+
+    Fix64 h = t - Fix64::One / 2;
+    Fix64 k = ka * h * h + kb;
+    Fix64 ot = t + t * h * (t - Fix64::One) * k;
+
+    return Lerp(a, end, ot).NormalizedFast();
+}
+
+FQuaternion FQuaternion::Squad(const FQuaternion& q1, const FQuaternion& q2,
+                               const FQuaternion& s1, const FQuaternion& s2, Fix64 t)
+{
+    FQuaternion c = SlerpPath(q1, q2, t, false);
+    FQuaternion d = SlerpPath(s1, s2, t, false);
+
+    return SlerpPath(c, d, 2 * t * (Fix64::One - t), false);
+}
+
+FQuaternion FQuaternion::SquadControlPoint(const FQuaternion& prev, const FQuaternion& q, const FQuaternion& next)
+{
+    FQuaternion inv = q.Conjugate();
+
+    FQuaternion p = Dot(q, prev) < Fix64::Zero ? -prev : prev;
+    FQuaternion n = Dot(q, next) < Fix64::Zero ? -next : next;
+
+    FQuaternion l = Log(inv * n) + Log(inv * p);
+
+    return q * Exp(l * Fix64::FromRawValue(-Fix64::fractionFactor / 4));
+}
+
+FQuaternion FQuaternion::Log(const FQuaternion& q)
+{
+    FQuaternion n;
+    Fix64 sinTheta;
+    int shift;
+    if (!Decompose(FQuaternion(q.x, q.y, q.z, Fix64::Zero), n, sinTheta, shift))
+    {
+        return FQuaternion();
+    }
+
+    Fix64 theta = Fix64::Atan2(sinTheta, Scale(q.w, shift));
+
+    return n * theta;
+}
+
+FQuaternion FQuaternion::Exp(const FQuaternion& q)
+{
+    FQuaternion n;
+    Fix64 scaledTheta;
+    int shift;
+    if (!Decompose(FQuaternion(q.x, q.y, q.z, Fix64::Zero), n, scaledTheta, shift))
+    {
+        return Identity;
+    }
+
+    Fix64 theta = Fix64::FromRawValue(scaledTheta.rawValue >> shift);
+    FQuaternion r = n * Fix64::Sin(theta);
+    r.w = Fix64::Cos(theta);
+
+    return r;
+}
+
+void FQuaternion::Interpolate(const FQuaternion* a, const FQuaternion* b, Fix64 t,
+                              FQuaternion* out, size_t count, Interpolation mode)
+{
+    switch (mode)
+    {
+    case Interpolation::Nlerp:
+        InterpolateBatch<Nlerp>(a, b, t, out, count);
+        break;
+    case Interpolation::Slerp:
+        InterpolateBatch<Slerp>(a, b, t, out, count);
+        break;
+    case Interpolation::SlerpFast:
+        InterpolateBatch<SlerpFast>(a, b, t, out, count);
+        break;
+    }
+}
+
+FQuaternion FQuaternion::FromMatrix(const FMatrix3x4& m)
+{
+    return FromRotation(m.m00, m.m01, m.m02, m.m10, m.m11, m.m12, m.m20, m.m21, m.m22);
+}
+
+FQuaternion FQuaternion::FromMatrix(const FMatrix4& m)
+{
+    return FromRotation(m.m00, m.m01, m.m02, m.m10, m.m11, m.m12, m.m20, m.m21, m.m22);
+}
+
+void FQuaternion::FromMatrix(const FMatrix3x4* in, FQuaternion* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = FromMatrix(in[i]);
+    }
+}
+
+void FQuaternion::FromMatrix(const FMatrix4* in, FQuaternion* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = FromMatrix(in[i]);
+    }
+}
+
+FQuaternion FQuaternion::FromEuler(const FVector3& euler)
+{
+    Fix64 hx = euler.x / 2, hy = euler.y / 2, hz = euler.z / 2;
+
+    Fix64 sx = Fix64::Sin(hx), cx = Fix64::Cos(hx);
+    Fix64 sy = Fix64::Sin(hy), cy = Fix64::Cos(hy);
+    Fix64 sz = Fix64::Sin(hz), cz = Fix64::Cos(hz);
+
+    // qy * qx * qz展开
+    Fix64 cycx = cy * cx, sysx = sy * sx;
+    Fix64 cysx = cy * sx, sycx = sy * cx;
+
+    return FQuaternion(cysx * cz + sycx * sz,
+                       sycx * cz - cysx * sz,
+                       cycx * sz - sysx * cz,
+                       cycx * cz + sysx * sz);
+}
+
+FVector3 FQuaternion::ToEuler() const
+{
+    // 对应旋转矩阵(列向量约定) R = Ry * Rx * Rz 的元素：
+    // R12 = -sin(x)，R02 / R22 = tan(y)，R10 / R11 = tan(z)
+    Fix64 x2 = x + x, y2 = y + y, z2 = z + z;
+
+    Fix64 sinX = w * x2 - y * z2;
+    if (sinX.Abs() >= gimbalLockSin)
+    {
+        // cos(x) = 0，只能求出y与z的组合，令z = 0：R20 = -sin(y)，R00 = cos(y)
+        Fix64 ex = sinX > Fix64::Zero ? Fix64::PI / 2 : -Fix64::PI / 2;
+        Fix64 ey = Fix64::Atan2(w * y2 - x * z2, Fix64::One - (y * y2 + z * z2));
+
+        return FVector3(ex, ey, Fix64::Zero);
+    }
+
+    Fix64 ex = Fix64::Asin(sinX);
+    Fix64 ey = Fix64::Atan2(x * z2 + w * y2, Fix64::One - (x * x2 + y * y2));
+    Fix64 ez = Fix64::Atan2(x * y2 + w * z2, Fix64::One - (x * x2 + z * z2));
+
+    return FVector3(ex, ey, ez);
+}
+
+void FQuaternion::FromEuler(const FVector3* in, FQuaternion* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = FromEuler(in[i]);
+    }
+}
+
+void FQuaternion::ToEuler(const FQuaternion* in, FVector3* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = in[i].ToEuler();
+    }
+}
+
 string FQuaternion::ToString()
 {
-    return x.ToString() + "," + y.ToString() + "," + z.ToString() + "," + w.ToString();
+    char buffer[4 * Fix64::maxCharsLength + 3];
+    return string(buffer, ToChars(buffer, buffer + sizeof(buffer)));
+}
+
+char* FQuaternion::ToChars(char* first, char* last) const
+{
+    const Fix64 components[4] = { x, y, z, w };
+    return Fix64::ToChars(components, 4, first, last);
+}
+
+const char* FQuaternion::FromChars(const char* first, const char* last, FQuaternion& value)
+{
+    Fix64 components[4];
+    first = Fix64::FromChars(first, last, components, 4);
+    if (first != nullptr)
+    {
+        value = FQuaternion(components[0], components[1], components[2], components[3]);
+    }
+    return first;
+}
+
+char* FQuaternion::ToChars(const FQuaternion* values, size_t count, char* first, char* last)
+{
+    return Fix64::ToCharsLines(&values->w, count, 4, first, last, xyzwOrder);
+}
+
+const char* FQuaternion::FromChars(const char* first, const char* last, FQuaternion* values, size_t count)
+{
+    return Fix64::FromCharsLines(first, last, &values->w, count, 4, xyzwOrder);
 }
@@ -9,12 +9,17 @@
 #ifndef FQuaternion_h
 #define FQuaternion_h
 
+#include <stddef.h>
 #include "Fix64.h"
 #include "FVector3.h"
 using namespace FMath;
 
 namespace FMath
 {
+    class FVector3Array;
+    struct FMatrix4;
+    struct FMatrix3x4;
+
     /// <summary>
     /// q=[w,v]=[w,xi+yj+zk]
     /// The general form to express quaternions is:
@@ -49,6 +54,11 @@ namespace FMath
 
         FQuaternion Normalized() const;
 
+        /// <summary>
+        /// 单位化：求一次1/sqrt，再乘到4个分量上，没有开平方和除法.
+        /// </summary>
+        FQuaternion NormalizedFast() const;
+
         //static Fix64 Angle(FQuaternion a, FQuaternion b)
         //{
         //    FQuaternion na = a.normalized;
@@ -64,7 +74,7 @@ namespace FMath
         /// </summary>
         /// <param name="q"></param>
         /// <returns></returns>
-        static FQuaternion Inverse(FQuaternion q);
+        static FQuaternion Inverse(const FQuaternion& q);
 
         /// <summary>
         /// builds a Quaternion by rotate axis and angle.
@@ -72,22 +82,22 @@ namespace FMath
         /// <param name="axis">rotate axis.</param>
         /// <param name="angle"></param>
         /// <returns></returns>
-        static FQuaternion AngleAxis(Fix64 angle, FVector3 axis);
+        static FQuaternion AngleAxis(Fix64 angle, const FVector3& axis);
         
-        static FQuaternion Conjugate(FQuaternion q);
+        static FQuaternion Conjugate(const FQuaternion& q);
 
-        friend FQuaternion operator +(FQuaternion a, FQuaternion b);
+        friend FQuaternion operator +(const FQuaternion& a, const FQuaternion& b);
 
-        friend FQuaternion operator -(FQuaternion a, FQuaternion b);
+        friend FQuaternion operator -(const FQuaternion& a, const FQuaternion& b);
 
         /// <summary>
-        /// a.b = [a.w*b.w + a.xi * b.xi + a.yi * b.yi + a.zi * b.zi]
-        /// a.b = a.w*b.w - (ax*bx + ay*by + az*bz)
+        /// 四维点积：a.b = a.w*b.w + a.x*b.x + a.y*b.y + a.z*b.z.
+        /// 单位四元数的点积为两者夹角一半的余弦，小于0时-b与b表示同一个旋转且离a更近.
         /// </summary>
         /// <param name="a"></param>
         /// <param name="b"></param>
         /// <returns></returns>
-        static Fix64 Dot(FQuaternion a, FQuaternion b);
+        static Fix64 Dot(const FQuaternion& a, const FQuaternion& b);
         /// <summary>
         /// [wa,va]*[wb,vb] = [wa*wb - va.vb, wa * vb + wb*va + vaxvb]
         /// 四元数乘法满足结合律，不满足交换律.
@@ -95,15 +105,46 @@ namespace FMath
         /// <param name="a"></param>
         /// <param name="b"></param>
         /// <returns></returns>
-        friend FQuaternion operator *(FQuaternion a, FQuaternion b);
+        friend FQuaternion operator *(const FQuaternion& a, const FQuaternion& b);
+
+        /// <summary>
+        /// a = a * b，不产生临时四元数.
+        /// </summary>
+        friend FQuaternion& operator *=(FQuaternion& a, const FQuaternion& b);
+
+        /// <summary>
+        /// out = a * b，直接写入out，out可以是a或b.
+        /// </summary>
+        static void Multiply(FQuaternion& out, const FQuaternion& a, const FQuaternion& b);
 
         /// <summary>
-        /// 四元数乘向量=四元数表达的旋转应用到向量v上(v'=q*v*q^-1)
+        /// 四元数乘向量=四元数表达的旋转应用到向量v上(v'=q*v*q^-1)，即Rotate(v).
         /// </summary>
         /// <param name="q">q为单位四元数</param>
         /// <param name="v"></param>
         /// <returns></returns>
-        friend FVector3 operator *(FQuaternion q, FVector3 v);
+        friend FVector3 operator *(const FQuaternion& q, const FVector3& v);
+
+        /// <summary>
+        /// 用单位四元数旋转向量：q=[w,u]，t = 2(u×v)，v' = v + w*t + u×t.
+        /// 与q*v*q^-1展开后相同，但只需15次乘法(两次四元数乘法需要32次).
+        /// </summary>
+        FVector3 Rotate(const FVector3& v) const;
+
+        /// <summary>
+        /// 批量旋转，结果与逐个调用Rotate逐位一致，out可以与in相同.
+        /// AVX2实现每次处理4个向量，实现的选择见FVector3Array::SetKernel.
+        /// </summary>
+        void Rotate(const FVector3* in, FVector3* out, size_t count) const;
+
+        void Rotate(const FVector3Array& in, FVector3Array& out) const;
+
+        /// <summary>
+        /// 逐个旋转：out[i] = rotations[i].Rotate(in[i])，rotations至少有count(或in.Size())项.
+        /// </summary>
+        static void Rotate(const FQuaternion* rotations, const FVector3* in, FVector3* out, size_t count);
+
+        static void Rotate(const FQuaternion* rotations, const FVector3Array& in, FVector3Array& out);
 
         /// <summary>
         /// q=[w,v]
@@ -112,17 +153,17 @@ namespace FMath
         /// <param name="q"></param>
         /// <param name="a"></param>
         /// <returns></returns>
-        friend FQuaternion operator *(FQuaternion q, Fix64 a);
+        friend FQuaternion operator *(const FQuaternion& q, Fix64 a);
 
-        friend bool operator ==(FQuaternion a, FQuaternion b);
+        friend bool operator ==(const FQuaternion& a, const FQuaternion& b);
 
-        friend bool operator !=(FQuaternion a, FQuaternion b);
+        friend bool operator !=(const FQuaternion& a, const FQuaternion& b);
 
-        friend FQuaternion operator -(FQuaternion q);
+        friend FQuaternion operator -(const FQuaternion& q);
 
-        void SetAngleAxis(Fix64 angle, FVector3 axis);
+        void SetAngleAxis(Fix64 angle, const FVector3& axis);
 
-        void ToAngleAxis(Fix64& angle, FVector3 axis);
+        void ToAngleAxis(Fix64& angle, FVector3& axis) const;
 
         /// <summary>
         /// caculates angle betweens a and b.
@@ -130,7 +171,7 @@ namespace FMath
         /// <param name="a"></param>
         /// <param name="b"></param>
         /// <returns></returns>
-        static Fix64 Angle(FQuaternion a, FQuaternion b);
+        static Fix64 Angle(const FQuaternion& a, const FQuaternion& b);
 
         /// <summary>
         /// 在两个朝向之间构造一个四元数.
@@ -138,11 +179,122 @@ namespace FMath
         /// <param name="fromDir">单位向量</param>
         /// <param name="toDir">单位向量</param>
         /// <returns></returns>
-        static FQuaternion FromToRotation(FVector3 fromDir, FVector3 toDir);
+        static FQuaternion FromToRotation(const FVector3& fromDir, const FVector3& toDir);
+
+        void SetFromToRotation(const FVector3& fromDir, const FVector3& toDir);
+
+        /// <summary>
+        /// 旋转矩阵转单位四元数，FMatrix3x4::FromQuaternion的逆，w >= 0.
+        /// 按迹和对角线元素选最大的分量先求出来(Shepperd)，只用一次1/sqrt，没有三角函数和除法.
+        /// 左上3x3需为旋转矩阵，有缩放时先把每行单位化.
+        /// </summary>
+        static FQuaternion FromMatrix(const FMatrix3x4& m);
+
+        static FQuaternion FromMatrix(const FMatrix4& m);
+
+        /// <summary>
+        /// 批量FromMatrix：out[i] = FromMatrix(in[i]).
+        /// </summary>
+        static void FromMatrix(const FMatrix3x4* in, FQuaternion* out, size_t count);
 
-        void SetFromToRotation(FVector3 fromDir, FVector3 toDir);
+        static void FromMatrix(const FMatrix4* in, FQuaternion* out, size_t count);
+
+        /// <summary>
+        /// 欧拉角(弧度)转四元数：先绕z轴、再绕x轴、最后绕y轴旋转(与Unity一致)，即 qy * qx * qz.
+        /// 三个半角各一次Sin、Cos.
+        /// </summary>
+        static FQuaternion FromEuler(const FVector3& euler);
+
+        /// <summary>
+        /// 单位四元数转欧拉角(弧度)，FromEuler的逆：x在[-π/2, π/2]，y、z在[-π, π].
+        /// x接近±π/2(万向节锁)时y、z不唯一，令z为0.
+        /// </summary>
+        FVector3 ToEuler() const;
+
+        /// <summary>
+        /// 批量欧拉角转换：out[i] = FromEuler(in[i])、out[i] = in[i].ToEuler().
+        /// </summary>
+        static void FromEuler(const FVector3* in, FQuaternion* out, size_t count);
+
+        static void ToEuler(const FQuaternion* in, FVector3* out, size_t count);
         
+        /// <summary>
+        /// 批量插值使用的方式.
+        /// </summary>
+        enum class Interpolation
+        {
+            Nlerp,
+            Slerp,
+            SlerpFast,
+        };
+
+        /// <summary>
+        /// 线性插值后单位化(NormalizedFast)，走最短路径.
+        /// 最便宜，但角速度不均匀，两端夹角越大中间偏差越大.
+        /// </summary>
+        static FQuaternion Nlerp(const FQuaternion& a, const FQuaternion& b, Fix64 t);
+
+        /// <summary>
+        /// 球面插值，走最短路径，t不限制在[0, 1].
+        /// 把b分解为a和与a正交的单位四元数c：b = a*cos(theta) + c*sin(theta)，结果为a*cos(t*theta) + c*sin(t*theta).
+        /// 不除以sin(theta)，夹角很小时也不会放大误差；a和b需为单位四元数.
+        /// </summary>
+        static FQuaternion Slerp(const FQuaternion& a, const FQuaternion& b, Fix64 t);
+
+        /// <summary>
+        /// 近似球面插值：用关于t和|Dot(a, b)|的多项式修正t后做Nlerp，没有三角函数，
+        /// 与Slerp的角度误差在1e-4弧度量级，t需在[0, 1].
+        /// </summary>
+        static FQuaternion SlerpFast(const FQuaternion& a, const FQuaternion& b, Fix64 t);
+
+        /// <summary>
+        /// 球面四边形插值：Slerp(Slerp(q1, q2, t), Slerp(s1, s2, t), 2t(1-t))，
+        /// s1、s2为SquadControlPoint求出的控制点，经过q1、q2时角速度连续.
+        /// 内部的Slerp不取最短路径，q1、q2需事先调整到同一半球.
+        /// </summary>
+        static FQuaternion Squad(const FQuaternion& q1, const FQuaternion& q2,
+                                 const FQuaternion& s1, const FQuaternion& s2, Fix64 t);
+
+        /// <summary>
+        /// 关键帧序列prev、q、next在q处的Squad控制点：q * Exp(-(Log(q^-1*next) + Log(q^-1*prev)) / 4).
+        /// prev、next会先调整到q所在的半球.
+        /// </summary>
+        static FQuaternion SquadControlPoint(const FQuaternion& prev, const FQuaternion& q, const FQuaternion& next);
+
+        /// <summary>
+        /// 单位四元数的对数：[cos(theta), n*sin(theta)] -> [0, n*theta]，theta在[0, π].
+        /// </summary>
+        static FQuaternion Log(const FQuaternion& q);
+
+        /// <summary>
+        /// 纯四元数(w为0)的指数：[0, n*theta] -> [cos(theta), n*sin(theta)]，q.w被忽略.
+        /// </summary>
+        static FQuaternion Exp(const FQuaternion& q);
+
+        /// <summary>
+        /// 批量插值：out[i] = Nlerp/Slerp/SlerpFast(a[i], b[i], t)，用于两组姿态整体混合，out可以与a或b相同.
+        /// </summary>
+        static void Interpolate(const FQuaternion* a, const FQuaternion* b, Fix64 t,
+                                FQuaternion* out, size_t count, Interpolation mode);
+
         string ToString();
+
+        /// <summary>
+        /// 不分配内存的格式化，格式与ToString相同("x,y,z,w")，各分量见Fix64::ToChars.
+        /// </summary>
+        /// <returns>写入的最后一个字符之后的位置，空间不足时返回nullptr</returns>
+        char* ToChars(char* first, char* last) const;
+
+        /// <summary>
+        /// 解析ToChars的输出，','两侧可以有空格.
+        /// </summary>
+        /// <returns>解析结束的位置，格式错误时返回nullptr，value不变</returns>
+        static const char* FromChars(const char* first, const char* last, FQuaternion& value);
+
+        /// 批量格式化和解析，每个值一行，见Fix64::ToCharsLines
+        static char* ToChars(const FQuaternion* values, size_t count, char* first, char* last);
+
+        static const char* FromChars(const char* first, const char* last, FQuaternion* values, size_t count);
     };
 }
 
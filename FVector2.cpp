@@ -7,8 +7,24 @@
 //
 
 #include "FVector2.h"
+#include "Fix64Divisor.h"
 using namespace FMath;
 
+namespace
+{
+    /// <summary>
+    /// 乘以2的整数次幂，使分量绝对值的最大值落在[128, 256)，方向不变；0向量原样返回.
+    /// 保留约23位有效位，叉积和点积不会溢出.
+    /// </summary>
+    FVector2 ScaleForAngle(const FVector2& v)
+    {
+        Fix64 values[2] = { v.x, v.y };
+        Fix64::NormalizePow2(values, 2, Fix64::fractionBits + 8);
+
+        return FVector2(values[0], values[1]);
+    }
+}
+
 const FVector2 FVector2::Down = FVector2(Fix64::Zero, -Fix64::One);
 
 const FVector2 FVector2::Left = FVector2(-Fix64::One, Fix64::Zero);;
@@ -33,13 +49,23 @@ Fix64 FVector2::SqrMagnitude()
 
 FVector2 FVector2::Normalized()
 {
-   Fix64 len = Magnitude();
+   Fix64Divisor len(Magnitude());
    return FVector2(x / len, y / len);
 }
 
+FVector2 FVector2::NormalizedFast() const
+{
+    int shift = 0;
+    int64_t inv = Fix64::InvSqrtMantissa((x * x + y * y).rawValue, shift);
+
+    return FVector2(
+        Fix64::FromRawValue(Fix64::MulShift(x.rawValue, inv, shift)),
+        Fix64::FromRawValue(Fix64::MulShift(y.rawValue, inv, shift)));
+}
+
 void FVector2::Normalize()
 {
-   Fix64 len = Magnitude();
+   Fix64Divisor len(Magnitude());
    x = x / len;
    y = y / len;
 }
@@ -111,7 +137,8 @@ FVector2 FMath::operator *(const FVector2& a, const Fix64& d)
 FVector2 FMath::operator /(const FVector2& a, const Fix64& d)
 {
     //return new FVector2(Fix64.Div(a.x, d), Fix64.Div(a.y, d));
-    return FVector2(a.x / d, a.y / d);
+    Fix64Divisor divisor(d);
+    return FVector2(a.x / divisor, a.y / divisor);
 }
 
 bool FMath::operator ==(const FVector2& lhs, const FVector2& rhs)
@@ -126,7 +153,34 @@ bool FMath::operator !=(const FVector2& lhs, const FVector2& rhs)
 
 string FVector2::ToString()
 {
-    return x.ToString() + "," + y.ToString();
+    char buffer[2 * Fix64::maxCharsLength + 1];
+    return string(buffer, ToChars(buffer, buffer + sizeof(buffer)));
+}
+
+char* FVector2::ToChars(char* first, char* last) const
+{
+    return Fix64::ToChars(&x, 2, first, last);
+}
+
+const char* FVector2::FromChars(const char* first, const char* last, FVector2& value)
+{
+    Fix64 components[2];
+    first = Fix64::FromChars(first, last, components, 2);
+    if (first != nullptr)
+    {
+        value = FVector2(components[0], components[1]);
+    }
+    return first;
+}
+
+char* FVector2::ToChars(const FVector2* values, size_t count, char* first, char* last)
+{
+    return Fix64::ToCharsLines(&values->x, count, 2, first, last);
+}
+
+const char* FVector2::FromChars(const char* first, const char* last, FVector2* values, size_t count)
+{
+    return Fix64::FromCharsLines(first, last, &values->x, count, 2);
 }
 
 Fix64 FVector2::Distance(const FVector2& a, const FVector2& b)
@@ -186,6 +240,20 @@ FVector2 FVector2::Min(const FVector2& a, const FVector2& b)
     return FVector2(Fix64::Min(a.x, b.x), Fix64::Min(a.y, b.y));
 }
 
+Fix64 FVector2::Angle(const FVector2& from, const FVector2& to)
+{
+    return SignedAngle(from, to).Abs();
+}
+
+Fix64 FVector2::SignedAngle(const FVector2& from, const FVector2& to)
+{
+    // 夹角与长度无关，先规格化：大向量的乘积不溢出，小向量的乘积不丢失有效位
+    FVector2 a = ScaleForAngle(from);
+    FVector2 b = ScaleForAngle(to);
+
+    return Fix64::Atan2(a.x * b.y - a.y * b.x, Dot(a, b));
+}
+
 FVector2 FVector2::Reflect(const FVector2& inDirection, const FVector2& inNormal)
 {
     Fix64 projectionLen2 = Dot(inDirection, inNormal) * 2;
@@ -198,3 +266,6 @@ FVector2 FVector2::Project(const FVector2& v, const FVector2& n)
 {
     return n * Dot(v, n);
 }
+
+// 分量按x、y...连续存放，可以当作2个Fix64格式化
+static_assert(sizeof(FVector2) == 2 * sizeof(Fix64), "FVector2 must be 2 packed Fix64");
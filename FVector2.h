@@ -45,6 +45,12 @@ namespace FMath
 
         FVector2 Normalized();
 
+        /// <summary>
+        /// 单位化：求一次1/sqrt，再乘到各分量上，没有开平方和除法.
+        /// 长度为0时返回Zero.
+        /// </summary>
+        FVector2 NormalizedFast() const;
+
         void Normalize();
 
         void Scale(const FVector2& scale);
@@ -75,6 +81,23 @@ namespace FMath
 
         string ToString();
 
+        /// <summary>
+        /// 不分配内存的格式化，格式与ToString相同("x,y")，各分量见Fix64::ToChars.
+        /// </summary>
+        /// <returns>写入的最后一个字符之后的位置，空间不足时返回nullptr</returns>
+        char* ToChars(char* first, char* last) const;
+
+        /// <summary>
+        /// 解析ToChars的输出，','两侧可以有空格.
+        /// </summary>
+        /// <returns>解析结束的位置，格式错误时返回nullptr，value不变</returns>
+        static const char* FromChars(const char* first, const char* last, FVector2& value);
+
+        /// 批量格式化和解析，每个值一行，见Fix64::ToCharsLines
+        static char* ToChars(const FVector2* values, size_t count, char* first, char* last);
+
+        static const char* FromChars(const char* first, const char* last, FVector2* values, size_t count);
+
         /// <summary>
         /// 求两个向量的欧几里得距离.
         /// </summary>
@@ -100,18 +123,18 @@ namespace FMath
         static FVector2 Min(const FVector2& a, const FVector2& b);
 
         /// <summary>
-        /// 求两个向量的夹角.(依赖于反三角函数的实现)
+        /// 求两个向量的夹角(弧度)，值域[0, π]，即|SignedAngle(from, to)|.
         /// </summary>
         /// <param name="from"></param>
         /// <param name="to"></param>
         /// <returns></returns>
-        //public static Fix64 Angle(FVector2 from, FVector2 to)
-        //{
-        //    Fix64 dot = Dot(from, to);
-        //    Fix64 scale = Fix64.Mul(from.magnitude, to.magnitude);
+        static Fix64 Angle(const FVector2& from, const FVector2& to);
 
-        //    return Fix64.ACos(Fix64.Div(scale));
-        //}
+        /// <summary>
+        /// 带符号的夹角(弧度)，值域(-π, π]，从from逆时针转到to为正：atan2(from×to, from·to).
+        /// 不需要单位向量，没有开平方和除法；有一个为0向量时返回0.
+        /// </summary>
+        static Fix64 SignedAngle(const FVector2& from, const FVector2& to);
 
 
         /// <summary>
@@ -7,8 +7,44 @@
 //
 
 #include "FVector3.h"
+#include "FQuaternion.h"
+#include "Fix64Divisor.h"
 using namespace FMath;
 
+namespace
+{
+    /// <summary>
+    /// 乘以2^shift，使分量绝对值最大值的rawValue落在[2^(bits - 1), 2^bits)，方向不变；0向量原样返回.
+    /// </summary>
+    FVector3 ScalePow2(const FVector3& v, int bits, int& shift)
+    {
+        Fix64 values[3] = { v.x, v.y, v.z };
+        shift = Fix64::NormalizePow2(values, 3, bits);
+
+        return FVector3(values[0], values[1], values[2]);
+    }
+
+    /// 夹角的输入规格化到[128, 256)：保留约23位有效位，叉积和点积不会溢出
+    const int angleInputBits = Fix64::fractionBits + 8;
+
+    /// <summary>
+    /// atan2(|a×b|, a·b). 夹角与长度无关，a、b先各自规格化；叉积与点积再同乘一个2的整数次幂，
+    /// 使叉积的分量落在[1, 2)后求长度，夹角很小时叉积的平方和也不会在Q16下丢失有效位.
+    /// </summary>
+    /// <param name="cross">输出，与a×b同向</param>
+    Fix64 AngleBetween(const FVector3& from, const FVector3& to, FVector3& cross)
+    {
+        int shift;
+        FVector3 a = ScalePow2(from, angleInputBits, shift);
+        FVector3 b = ScalePow2(to, angleInputBits, shift);
+
+        cross = ScalePow2(FVector3::Cross(a, b), Fix64::fractionBits + 1, shift);
+        Fix64 dot = Fix64::FromRawValue(Fix64::ScaleRaw(FVector3::Dot(a, b).rawValue, shift));
+
+        return Fix64::Atan2(cross.Magnitude(), dot);
+    }
+}
+
 const FVector3 FVector3::Back = FVector3(Fix64::Zero, Fix64::Zero, -Fix64::One);
 
 const FVector3 FVector3::Forward = FVector3(Fix64::Zero, Fix64::Zero, Fix64::One);
@@ -47,12 +83,51 @@ FVector3 FVector3::Normalized() const
         return FVector3::Zero;
     }
 
-    return FVector3(x / len, y / len, z / len);
+    Fix64Divisor d(len);
+    return FVector3(x / d, y / d, z / d);
+}
+
+FVector3 FVector3::NormalizedFast() const
+{
+    int shift = 0;
+    int64_t inv = Fix64::InvSqrtMantissa(SqrMagnitude().rawValue, shift);
+
+    return FVector3(
+        Fix64::FromRawValue(Fix64::MulShift(x.rawValue, inv, shift)),
+        Fix64::FromRawValue(Fix64::MulShift(y.rawValue, inv, shift)),
+        Fix64::FromRawValue(Fix64::MulShift(z.rawValue, inv, shift)));
 }
 
 string FVector3::ToString()
 {
-    return x.ToString() + "," + y.ToString() + "," + z.ToString();
+    char buffer[3 * Fix64::maxCharsLength + 2];
+    return string(buffer, ToChars(buffer, buffer + sizeof(buffer)));
+}
+
+char* FVector3::ToChars(char* first, char* last) const
+{
+    return Fix64::ToChars(&x, 3, first, last);
+}
+
+const char* FVector3::FromChars(const char* first, const char* last, FVector3& value)
+{
+    Fix64 components[3];
+    first = Fix64::FromChars(first, last, components, 3);
+    if (first != nullptr)
+    {
+        value = FVector3(components[0], components[1], components[2]);
+    }
+    return first;
+}
+
+char* FVector3::ToChars(const FVector3* values, size_t count, char* first, char* last)
+{
+    return Fix64::ToCharsLines(&values->x, count, 3, first, last);
+}
+
+const char* FVector3::FromChars(const char* first, const char* last, FVector3* values, size_t count)
+{
+    return Fix64::FromCharsLines(first, last, &values->x, count, 3);
 }
 
 bool FVector3::Equals(const FVector3& obj)
@@ -69,11 +144,11 @@ int FVector3::GetHashCode()
 
 void FVector3::Normalize()
 {
-    Fix64 len = Magnitude();
+    Fix64Divisor d(Magnitude());
 
-    x = x / len;
-    y = y / len;
-    z = z / len;
+    x = x / d;
+    y = y / d;
+    z = z / d;
 }
 
 void FVector3::Scale(const FVector3& scale)
@@ -120,7 +195,8 @@ FVector3 FMath::operator *(const FVector3& a, const Fix64& d)
 FVector3 FMath::operator /(const FVector3& a, const Fix64& d)
 {
     //return new FVector3(Fix64.Div(a.x, d), Fix64.Div(a.y, d), Fix64.Div(a.z, d));
-    return FVector3(a.x / d, a.y / d, a.z / d);
+    Fix64Divisor divisor(d);
+    return FVector3(a.x / divisor, a.y / divisor, a.z / divisor);
 }
 
 bool FMath::operator ==(const FVector3& lhs, const FVector3& rhs)
@@ -142,7 +218,7 @@ void FVector3::ClampMagnitude(const Fix64& maxLength)
         // x / magnitude * maxLength, y / magnitude * maxLength
         // x * (maxLength / magnitude), y * (maxLength / magnitude)
         //Fix64 scaleFactor = Fix64.Div(maxLength, len);
-        Fix64 invScaleFactor = len / maxLength;
+        Fix64Divisor invScaleFactor(len / maxLength);
 
         //x = Fix64.Mul(x, scaleFactor);
         //y = Fix64.Mul(y, scaleFactor);
@@ -233,10 +309,19 @@ FVector3 FVector3::Min(const FVector3& a, const FVector3& b)
 
 Fix64 FVector3::Angle(const FVector3& from, const FVector3& to)
 {
-    Fix64 dot = Dot(from, to);
-    Fix64 len2 = from.Magnitude() * to.Magnitude();
+    FVector3 cross = Zero;
+
+    return AngleBetween(from, to, cross);
+}
+
+Fix64 FVector3::SignedAngle(const FVector3& from, const FVector3& to, const FVector3& axis)
+{
+    FVector3 cross = Zero;
+    Fix64 angle = AngleBetween(from, to, cross);
+
+    int shift;
 
-    return Fix64::Acos(dot / len2);
+    return Dot(ScalePow2(axis, Fix64::fractionBits + 1, shift), cross) < Fix64::Zero ? -angle : angle;
 }
 
 FVector3 FVector3::Reflect(const FVector3& inDirection, const FVector3& inNormal)
@@ -273,14 +358,33 @@ FVector3 FVector3::Slerp(const FVector3& a, const FVector3& b, const Fix64& t)
     }
 
     Fix64 angle = Fix64::Acos(cos_theta);
-    FVector3 axis = Cross(a, b);
-    
-    return FVector3((Fix64)0, (Fix64)0, (Fix64)0);
+    FVector3 axis = Cross(v1, v2);
 
-//            FQuaternion q = FQuaternion.AngleAxis(angle * t, axis);
-//            FVector3 vt = q * v1;
-//
-//            return (lenA + (lenB - lenA) * t) * vt;
+    // 方向相反时转轴不唯一，任取一个与v1垂直的轴
+    if (axis == FVector3::Zero)
+    {
+        axis = Cross(v1, FVector3::Right);
+
+        if (axis == FVector3::Zero)
+        {
+            axis = Cross(v1, FVector3::Up);
+        }
+    }
+
+    FVector3 vt = FQuaternion::AngleAxis(angle * t, axis).Rotate(v1);
+
+    return vt * (lenA + (lenB - lenA) * t);
 }
-  
 
+// FVector3按x、y、z连续存放，可以当作3 * count个Fix64转换和格式化
+static_assert(sizeof(FVector3) == 3 * sizeof(Fix64), "FVector3 must be three packed Fix64");
+
+void FVector3::ToFloatArray(const FVector3* in, float* out, size_t count)
+{
+    Fix64::ToFloatArray(&in->x, out, count * 3);
+}
+
+void FVector3::FromFloatArray(const float* in, FVector3* out, size_t count)
+{
+    Fix64::FromFloatArray(in, &out->x, count * 3);
+}
@@ -55,8 +55,31 @@ namespace FMath
 
         FVector3 Normalized() const;
 
+        /// <summary>
+        /// 单位化：求一次1/sqrt，再乘到各分量上，没有开平方和除法.
+        /// 长度为0时返回Zero.
+        /// </summary>
+        FVector3 NormalizedFast() const;
+
         string ToString();
 
+        /// <summary>
+        /// 不分配内存的格式化，格式与ToString相同("x,y,z")，各分量见Fix64::ToChars.
+        /// </summary>
+        /// <returns>写入的最后一个字符之后的位置，空间不足时返回nullptr</returns>
+        char* ToChars(char* first, char* last) const;
+
+        /// <summary>
+        /// 解析ToChars的输出，','两侧可以有空格.
+        /// </summary>
+        /// <returns>解析结束的位置，格式错误时返回nullptr，value不变</returns>
+        static const char* FromChars(const char* first, const char* last, FVector3& value);
+
+        /// 批量格式化和解析，每个值一行，见Fix64::ToCharsLines
+        static char* ToChars(const FVector3* values, size_t count, char* first, char* last);
+
+        static const char* FromChars(const char* first, const char* last, FVector3* values, size_t count);
+
         bool Equals(const FVector3& obj);
 
         int GetHashCode();
@@ -120,13 +143,19 @@ namespace FMath
         static FVector3 Min(const FVector3& a, const FVector3& b);
 
         /// <summary>
-        /// 求两个向量的夹角.(依赖于反三角函数的实现)
+        /// 求两个向量的夹角(弧度)，值域[0, π]：atan2(|from×to|, from·to).
+        /// 不需要单位向量，只开一次平方，没有除法；有一个为0向量时返回0.
         /// </summary>
         /// <param name="from"></param>
         /// <param name="to"></param>
         /// <returns></returns>
         static Fix64 Angle(const FVector3& from, const FVector3& to);
 
+        /// <summary>
+        /// 带符号的夹角(弧度)，值域[-π, π]：绕axis从from转到to为逆时针(右手)时为正.
+        /// </summary>
+        static Fix64 SignedAngle(const FVector3& from, const FVector3& to, const FVector3& axis);
+
 
         /// <summary>
         /// 求反射向量.
@@ -147,6 +176,17 @@ namespace FMath
         static FVector3 ProjectOnPlane(const FVector3& v, const FVector3& n);
 
         static FVector3 Slerp(const FVector3& a, const FVector3& b, const Fix64& t);
+
+        /// <summary>
+        /// 批量转换为float：out为3 * count个float，按x、y、z交错排列(顶点缓冲的格式).
+        /// 结果与逐个调用ToSingle()逐位一致，AVX2实现按FVector3Array::SetKernel选择.
+        /// </summary>
+        static void ToFloatArray(const FVector3* in, float* out, size_t count);
+
+        /// <summary>
+        /// ToFloatArray的逆操作：in为3 * count个交错的float，四舍五入到Fix64.
+        /// </summary>
+        static void FromFloatArray(const float* in, FVector3* out, size_t count);
     };
 }
 
@@ -0,0 +1,314 @@
+//
+//  FVector3Array.cpp
+//  MathLib
+//
+//  FVector3的SoA批量容器.
+//
+
+#include "FVector3Array.h"
+#include "Fix64Simd.h"
+#include <algorithm>
+
+using namespace FMath;
+
+namespace
+{
+    /************ scalar ***********/
+
+    // 以下标量实现处理[begin, n)，AVX2实现用它处理不足4项的尾部
+
+    void AddScalar(const int64_t* a, const int64_t* b, int64_t* out, size_t begin, size_t n)
+    {
+        for (size_t i = begin; i < n; ++i)
+        {
+            out[i] = a[i] + b[i];
+        }
+    }
+
+    void SubScalar(const int64_t* a, const int64_t* b, int64_t* out, size_t begin, size_t n)
+    {
+        for (size_t i = begin; i < n; ++i)
+        {
+            out[i] = a[i] - b[i];
+        }
+    }
+
+    void ScaleScalar(const int64_t* a, int64_t s, int64_t* out, size_t begin, size_t n)
+    {
+        for (size_t i = begin; i < n; ++i)
+        {
+            out[i] = Fix64::Mul(a[i], s);
+        }
+    }
+
+    void LerpScalar(const int64_t* a, const int64_t* b, int64_t t, int64_t* out, size_t begin, size_t n)
+    {
+        for (size_t i = begin; i < n; ++i)
+        {
+            out[i] = a[i] + Fix64::Mul(b[i] - a[i], t);
+        }
+    }
+
+    void DotScalar(const int64_t* ax, const int64_t* ay, const int64_t* az,
+                   const int64_t* bx, const int64_t* by, const int64_t* bz,
+                   int64_t* out, size_t begin, size_t n)
+    {
+        for (size_t i = begin; i < n; ++i)
+        {
+            out[i] = Fix64::Mul(ax[i], bx[i]) + Fix64::Mul(ay[i], by[i]) + Fix64::Mul(az[i], bz[i]);
+        }
+    }
+
+    void CrossScalar(const int64_t* ax, const int64_t* ay, const int64_t* az,
+                     const int64_t* bx, const int64_t* by, const int64_t* bz,
+                     int64_t* ox, int64_t* oy, int64_t* oz, size_t begin, size_t n)
+    {
+        for (size_t i = begin; i < n; ++i)
+        {
+            int64_t cx = Fix64::Mul(ay[i], bz[i]) - Fix64::Mul(az[i], by[i]);
+            int64_t cy = Fix64::Mul(az[i], bx[i]) - Fix64::Mul(ax[i], bz[i]);
+            int64_t cz = Fix64::Mul(ax[i], by[i]) - Fix64::Mul(ay[i], bx[i]);
+
+            ox[i] = cx;
+            oy[i] = cy;
+            oz[i] = cz;
+        }
+    }
+
+#if FIX64_SIMD_AVX2
+    /************ avx2 ***********/
+
+    using namespace FMath::Simd;
+
+    FIX64_TARGET_AVX2 void AddAvx2(const int64_t* a, const int64_t* b, int64_t* out, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            Store4(out + i, _mm256_add_epi64(Load4(a + i), Load4(b + i)));
+        }
+        AddScalar(a, b, out, i, n);
+    }
+
+    FIX64_TARGET_AVX2 void SubAvx2(const int64_t* a, const int64_t* b, int64_t* out, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            Store4(out + i, _mm256_sub_epi64(Load4(a + i), Load4(b + i)));
+        }
+        SubScalar(a, b, out, i, n);
+    }
+
+    FIX64_TARGET_AVX2 void ScaleAvx2(const int64_t* a, int64_t s, int64_t* out, size_t n)
+    {
+        __m256i vs = _mm256_set1_epi64x(s);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            Store4(out + i, Mul4(Load4(a + i), vs));
+        }
+        ScaleScalar(a, s, out, i, n);
+    }
+
+    FIX64_TARGET_AVX2 void LerpAvx2(const int64_t* a, const int64_t* b, int64_t t, int64_t* out, size_t n)
+    {
+        __m256i vt = _mm256_set1_epi64x(t);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            __m256i va = Load4(a + i);
+            Store4(out + i, _mm256_add_epi64(va, Mul4(_mm256_sub_epi64(Load4(b + i), va), vt)));
+        }
+        LerpScalar(a, b, t, out, i, n);
+    }
+
+    FIX64_TARGET_AVX2 void DotAvx2(const int64_t* ax, const int64_t* ay, const int64_t* az,
+                                      const int64_t* bx, const int64_t* by, const int64_t* bz,
+                                      int64_t* out, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            __m256i dot = _mm256_add_epi64(
+                _mm256_add_epi64(Mul4(Load4(ax + i), Load4(bx + i)), Mul4(Load4(ay + i), Load4(by + i))),
+                Mul4(Load4(az + i), Load4(bz + i)));
+            Store4(out + i, dot);
+        }
+        DotScalar(ax, ay, az, bx, by, bz, out, i, n);
+    }
+
+    FIX64_TARGET_AVX2 void CrossAvx2(const int64_t* ax, const int64_t* ay, const int64_t* az,
+                                        const int64_t* bx, const int64_t* by, const int64_t* bz,
+                                        int64_t* ox, int64_t* oy, int64_t* oz, size_t n)
+    {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            __m256i vax = Load4(ax + i), vay = Load4(ay + i), vaz = Load4(az + i);
+            __m256i vbx = Load4(bx + i), vby = Load4(by + i), vbz = Load4(bz + i);
+
+            Store4(ox + i, _mm256_sub_epi64(Mul4(vay, vbz), Mul4(vaz, vby)));
+            Store4(oy + i, _mm256_sub_epi64(Mul4(vaz, vbx), Mul4(vax, vbz)));
+            Store4(oz + i, _mm256_sub_epi64(Mul4(vax, vby), Mul4(vay, vbx)));
+        }
+        CrossScalar(ax, ay, az, bx, by, bz, ox, oy, oz, i, n);
+    }
+
+#endif
+
+    FVector3Array::Kernel DetectKernel()
+    {
+        return FVector3Array::Avx2Supported() ? FVector3Array::Kernel::Avx2 : FVector3Array::Kernel::Scalar;
+    }
+
+    FVector3Array::Kernel currentKernel = DetectKernel();
+
+    bool UseAvx2()
+    {
+        return currentKernel == FVector3Array::Kernel::Avx2;
+    }
+}
+
+bool FVector3Array::Avx2Supported()
+{
+    return Simd::Avx2Supported();
+}
+
+void FVector3Array::SetKernel(Kernel kernel)
+{
+    currentKernel = (kernel == Kernel::Avx2 && !Avx2Supported()) ? Kernel::Scalar : kernel;
+}
+
+FVector3Array::Kernel FVector3Array::GetKernel()
+{
+    return currentKernel;
+}
+
+void FVector3Array::Add(const FVector3Array& a, const FVector3Array& b, FVector3Array& out)
+{
+    size_t n = std::min(a.Size(), b.Size());
+    out.Resize(n);
+
+#if FIX64_SIMD_AVX2
+    if (UseAvx2())
+    {
+        AddAvx2(a.X(), b.X(), out.X(), n);
+        AddAvx2(a.Y(), b.Y(), out.Y(), n);
+        AddAvx2(a.Z(), b.Z(), out.Z(), n);
+        return;
+    }
+#endif
+
+    AddScalar(a.X(), b.X(), out.X(), 0, n);
+    AddScalar(a.Y(), b.Y(), out.Y(), 0, n);
+    AddScalar(a.Z(), b.Z(), out.Z(), 0, n);
+}
+
+void FVector3Array::Sub(const FVector3Array& a, const FVector3Array& b, FVector3Array& out)
+{
+    size_t n = std::min(a.Size(), b.Size());
+    out.Resize(n);
+
+#if FIX64_SIMD_AVX2
+    if (UseAvx2())
+    {
+        SubAvx2(a.X(), b.X(), out.X(), n);
+        SubAvx2(a.Y(), b.Y(), out.Y(), n);
+        SubAvx2(a.Z(), b.Z(), out.Z(), n);
+        return;
+    }
+#endif
+
+    SubScalar(a.X(), b.X(), out.X(), 0, n);
+    SubScalar(a.Y(), b.Y(), out.Y(), 0, n);
+    SubScalar(a.Z(), b.Z(), out.Z(), 0, n);
+}
+
+void FVector3Array::Scale(const FVector3Array& a, const Fix64& s, FVector3Array& out)
+{
+    size_t n = a.Size();
+    out.Resize(n);
+
+#if FIX64_SIMD_AVX2
+    if (UseAvx2())
+    {
+        ScaleAvx2(a.X(), s.rawValue, out.X(), n);
+        ScaleAvx2(a.Y(), s.rawValue, out.Y(), n);
+        ScaleAvx2(a.Z(), s.rawValue, out.Z(), n);
+        return;
+    }
+#endif
+
+    ScaleScalar(a.X(), s.rawValue, out.X(), 0, n);
+    ScaleScalar(a.Y(), s.rawValue, out.Y(), 0, n);
+    ScaleScalar(a.Z(), s.rawValue, out.Z(), 0, n);
+}
+
+void FVector3Array::Dot(const FVector3Array& a, const FVector3Array& b, Fix64* out)
+{
+    size_t n = std::min(a.Size(), b.Size());
+    int64_t* rawOut = &out->rawValue;
+
+#if FIX64_SIMD_AVX2
+    if (UseAvx2())
+    {
+        DotAvx2(a.X(), a.Y(), a.Z(), b.X(), b.Y(), b.Z(), rawOut, n);
+        return;
+    }
+#endif
+
+    DotScalar(a.X(), a.Y(), a.Z(), b.X(), b.Y(), b.Z(), rawOut, 0, n);
+}
+
+void FVector3Array::Cross(const FVector3Array& a, const FVector3Array& b, FVector3Array& out)
+{
+    size_t n = std::min(a.Size(), b.Size());
+    out.Resize(n);
+
+#if FIX64_SIMD_AVX2
+    if (UseAvx2())
+    {
+        CrossAvx2(a.X(), a.Y(), a.Z(), b.X(), b.Y(), b.Z(), out.X(), out.Y(), out.Z(), n);
+        return;
+    }
+#endif
+
+    CrossScalar(a.X(), a.Y(), a.Z(), b.X(), b.Y(), b.Z(), out.X(), out.Y(), out.Z(), 0, n);
+}
+
+void FVector3Array::SqrMagnitude(const FVector3Array& a, Fix64* out)
+{
+    size_t n = a.Size();
+    int64_t* rawOut = &out->rawValue;
+
+#if FIX64_SIMD_AVX2
+    if (UseAvx2())
+    {
+        DotAvx2(a.X(), a.Y(), a.Z(), a.X(), a.Y(), a.Z(), rawOut, n);
+        return;
+    }
+#endif
+
+    DotScalar(a.X(), a.Y(), a.Z(), a.X(), a.Y(), a.Z(), rawOut, 0, n);
+}
+
+void FVector3Array::Lerp(const FVector3Array& a, const FVector3Array& b, const Fix64& t, FVector3Array& out)
+{
+    size_t n = std::min(a.Size(), b.Size());
+    out.Resize(n);
+
+#if FIX64_SIMD_AVX2
+    if (UseAvx2())
+    {
+        LerpAvx2(a.X(), b.X(), t.rawValue, out.X(), n);
+        LerpAvx2(a.Y(), b.Y(), t.rawValue, out.Y(), n);
+        LerpAvx2(a.Z(), b.Z(), t.rawValue, out.Z(), n);
+        return;
+    }
+#endif
+
+    LerpScalar(a.X(), b.X(), t.rawValue, out.X(), 0, n);
+    LerpScalar(a.Y(), b.Y(), t.rawValue, out.Y(), 0, n);
+    LerpScalar(a.Z(), b.Z(), t.rawValue, out.Z(), 0, n);
+}
@@ -0,0 +1,159 @@
+//
+//  FVector3Array.h
+//  MathLib
+//
+//  FVector3的SoA批量容器.
+//
+
+#ifndef FVector3Array_h
+#define FVector3Array_h
+
+#include <stddef.h>
+#include <new>
+#include <vector>
+#include "Fix64.h"
+#include "FVector3.h"
+
+namespace FMath
+{
+    /// <summary>
+    /// 按Alignment字节对齐的分配器，用于SIMD按对齐地址加载.
+    /// </summary>
+    template<typename T, size_t Alignment>
+    struct AlignedAllocator
+    {
+        typedef T value_type;
+
+        template<typename U>
+        struct rebind
+        {
+            typedef AlignedAllocator<U, Alignment> other;
+        };
+
+        AlignedAllocator() = default;
+
+        template<typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment>&)
+        {
+        }
+
+        T* allocate(size_t n)
+        {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+        }
+
+        void deallocate(T* p, size_t)
+        {
+            ::operator delete(p, std::align_val_t(Alignment));
+        }
+
+        template<typename U>
+        bool operator ==(const AlignedAllocator<U, Alignment>&) const
+        {
+            return true;
+        }
+
+        template<typename U>
+        bool operator !=(const AlignedAllocator<U, Alignment>&) const
+        {
+            return false;
+        }
+    };
+
+    /// <summary>
+    /// FVector3的SoA(structure of arrays)容器：x、y、z分别存放在32字节对齐的rawValue数组中.
+    /// 批量运算在运行时选择AVX2或标量实现，两种实现的结果与逐个调用FVector3的运算逐位一致.
+    /// 输出数组可以与输入相同.
+    /// </summary>
+    class FVector3Array
+    {
+    public:
+        typedef std::vector<int64_t, AlignedAllocator<int64_t, 32> > Stream;
+
+        enum class Kernel
+        {
+            Scalar,
+            Avx2,
+        };
+
+        FVector3Array()
+        {
+        }
+
+        explicit FVector3Array(size_t count) : xs(count), ys(count), zs(count)
+        {
+        }
+
+        size_t Size() const
+        {
+            return xs.size();
+        }
+
+        void Resize(size_t count)
+        {
+            xs.resize(count);
+            ys.resize(count);
+            zs.resize(count);
+        }
+
+        FVector3 Get(size_t index) const
+        {
+            return FVector3(Fix64::FromRawValue(xs[index]), Fix64::FromRawValue(ys[index]), Fix64::FromRawValue(zs[index]));
+        }
+
+        void Set(size_t index, const FVector3& v)
+        {
+            xs[index] = v.x.rawValue;
+            ys[index] = v.y.rawValue;
+            zs[index] = v.z.rawValue;
+        }
+
+        int64_t* X() { return xs.data(); }
+        int64_t* Y() { return ys.data(); }
+        int64_t* Z() { return zs.data(); }
+        const int64_t* X() const { return xs.data(); }
+        const int64_t* Y() const { return ys.data(); }
+        const int64_t* Z() const { return zs.data(); }
+
+        /// <summary>
+        /// 当前CPU是否支持AVX2.
+        /// </summary>
+        static bool Avx2Supported();
+
+        /// <summary>
+        /// 指定批量运算(包括FMatrix4的批量变换)的实现，CPU不支持时Avx2退回Scalar.
+        /// 默认在启动时按CPU选择.
+        /// </summary>
+        static void SetKernel(Kernel kernel);
+
+        static Kernel GetKernel();
+
+        /// out[i] = a[i] + b[i]，只处理前min(a.Size(), b.Size())项，out的项数调整为该值
+        static void Add(const FVector3Array& a, const FVector3Array& b, FVector3Array& out);
+
+        /// out[i] = a[i] - b[i]，只处理前min(a.Size(), b.Size())项，out的项数调整为该值
+        static void Sub(const FVector3Array& a, const FVector3Array& b, FVector3Array& out);
+
+        /// out[i] = a[i] * s
+        static void Scale(const FVector3Array& a, const Fix64& s, FVector3Array& out);
+
+        /// out[i] = FVector3::Dot(a[i], b[i])，只处理前min(a.Size(), b.Size())项，out至少有这么多项
+        static void Dot(const FVector3Array& a, const FVector3Array& b, Fix64* out);
+
+        /// out[i] = FVector3::Cross(a[i], b[i])，只处理前min(a.Size(), b.Size())项，out的项数调整为该值
+        static void Cross(const FVector3Array& a, const FVector3Array& b, FVector3Array& out);
+
+        /// out[i] = a[i].SqrMagnitude()，out至少有a.Size()项
+        static void SqrMagnitude(const FVector3Array& a, Fix64* out);
+
+        /// out[i] = FVector3::Lerp(a[i], b[i], t)，只处理前min(a.Size(), b.Size())项，out的项数调整为该值
+        static void Lerp(const FVector3Array& a, const FVector3Array& b, const Fix64& t, FVector3Array& out);
+
+    private:
+        Stream xs;
+        Stream ys;
+        Stream zs;
+    };
+}
+
+#endif /* FVector3Array_h */
@@ -7,6 +7,7 @@
 //
 
 #include "FVector4.h"
+#include "Fix64Divisor.h"
 using namespace FMath;
 
 const FVector4 Zero = FVector4(Fix64::Zero, Fix64::Zero, Fix64::Zero, Fix64::Zero);
@@ -25,13 +26,40 @@ Fix64 FVector4::SqrMagnitude() const
 
 FVector4 FVector4::Normalized() const
 {
-    Fix64 len = Magnitude();
+    Fix64Divisor len(Magnitude());
     return FVector4(x / len, y / len, z / len, w / len);
 }
 
 string FVector4::ToString()
 {
-    return x.ToString() + "," + y.ToString() + "," + z.ToString() + "," + w.ToString();
+    char buffer[4 * Fix64::maxCharsLength + 3];
+    return string(buffer, ToChars(buffer, buffer + sizeof(buffer)));
+}
+
+char* FVector4::ToChars(char* first, char* last) const
+{
+    return Fix64::ToChars(&x, 4, first, last);
+}
+
+const char* FVector4::FromChars(const char* first, const char* last, FVector4& value)
+{
+    Fix64 components[4];
+    first = Fix64::FromChars(first, last, components, 4);
+    if (first != nullptr)
+    {
+        value = FVector4(components[0], components[1], components[2], components[3]);
+    }
+    return first;
+}
+
+char* FVector4::ToChars(const FVector4* values, size_t count, char* first, char* last)
+{
+    return Fix64::ToCharsLines(&values->x, count, 4, first, last);
+}
+
+const char* FVector4::FromChars(const char* first, const char* last, FVector4* values, size_t count)
+{
+    return Fix64::FromCharsLines(first, last, &values->x, count, 4);
 }
 
 bool FVector4::Equals(const FVector4& obj)
@@ -49,7 +77,7 @@ int FVector4::GetHashCode()
 
 void FVector4::Normalize()
 {
-    Fix64 len = Magnitude();
+    Fix64Divisor len(Magnitude());
     x = x / len;
     y = y / len;
     z = z / len;
@@ -99,7 +127,8 @@ FVector4 FMath::operator *(const FVector4& a, const Fix64& d)
 
 FVector4 FMath::operator /(const FVector4& a, const Fix64& d)
 {
-    return FVector4(a.x / d, a.y / d, a.z / d, a.w / d);
+    Fix64Divisor divisor(d);
+    return FVector4(a.x / divisor, a.y / divisor, a.z / divisor, a.w / divisor);
 }
 
 bool FMath::operator ==(const FVector4& lhs, const FVector4& rhs)
@@ -191,3 +220,6 @@ FVector4 FVector4::Min(FVector4 a, FVector4 b)
 {
     return FVector4(Fix64::Min(a.x, b.x), Fix64::Min(a.y, b.y), Fix64::Min(a.z, b.z), Fix64::Min(a.w, b.w));
 }
+
+// 分量按x、y...连续存放，可以当作4个Fix64格式化
+static_assert(sizeof(FVector4) == 4 * sizeof(Fix64), "FVector4 must be 4 packed Fix64");
@@ -51,6 +51,23 @@ namespace FMath
 
         string ToString();
 
+        /// <summary>
+        /// 不分配内存的格式化，格式与ToString相同("x,y,z,w")，各分量见Fix64::ToChars.
+        /// </summary>
+        /// <returns>写入的最后一个字符之后的位置，空间不足时返回nullptr</returns>
+        char* ToChars(char* first, char* last) const;
+
+        /// <summary>
+        /// 解析ToChars的输出，','两侧可以有空格.
+        /// </summary>
+        /// <returns>解析结束的位置，格式错误时返回nullptr，value不变</returns>
+        static const char* FromChars(const char* first, const char* last, FVector4& value);
+
+        /// 批量格式化和解析，每个值一行，见Fix64::ToCharsLines
+        static char* ToChars(const FVector4* values, size_t count, char* first, char* last);
+
+        static const char* FromChars(const char* first, const char* last, FVector4* values, size_t count);
+
         bool Equals(const FVector4& obj);
 
         int GetHashCode();
@@ -7,307 +7,232 @@
 //
 
 #include "Fix64.h"
-#include <climits>
 using namespace FMath;
 
-const Fix64 Fix64::Zero = Fix64::FromInt(0);
-const Fix64 Fix64::One = Fix64::FromInt(1);
-const Fix64 Fix64::Half = Fix64::One / 2;
-const Fix64 Fix64::MaxValue = Fix64::FromRawValue(0x00007fffffffffff);
-const Fix64 Fix64::MinValue = Fix64::FromRawValue(-Fix64::MaxValue.rawValue);
-const Fix64 Fix64::E = Fix64::FromRawValue(0x000000000002b7e1);;
-const Fix64 Fix64::PI = Fix64::FromRawValue(0x000000000003243f);
-const Fix64 Fix64::Epsilon = Fix64::FromRawValue(1);
-const Fix64 Fix64::PositiveInfinity = Fix64::FromRawValue(LLONG_MAX);
-const Fix64 Fix64::NegativeInfinity = Fix64::FromRawValue(LLONG_MIN);
-
-const Fix64 Fix64::_degToRad = Fix64::FromRawValue(0x0000000000000477);
-const Fix64 Fix64::_radToDeg = Fix64::FromRawValue(0x0000000000394bbf);
-
-const Fix64 Fix64::EN1 = Fix64::One / 10;
-const Fix64 Fix64::EN2 = Fix64::One / 100;
-const Fix64 Fix64::EN3 = Fix64::One / 1000;
-const Fix64 Fix64::EN4 = Fix64::One / 10000;
-const Fix64 Fix64::EN5 = Fix64::One / 100000;
-
-Fix64::Fix64(int value)
+namespace
 {
-    rawValue = value * fractionFactor;
-}
-
-Fix64::Fix64(double value)
-{
-    rawValue = (int64_t)(value * fractionFactor);
-}
-
-Fix64::Fix64(float value)
-{
-    rawValue = (int64_t)(value * fractionFactor);
-}
-
-Fix64::Fix64(const Fix64& other)
-{
-    rawValue = other.rawValue;
-}
-Fix64::Fix64()
-{
-    rawValue = 0;
-}
-    
-Fix64 Fix64::FromInt(int val)
-{
-    return Fix64(val);
-}
-
-Fix64 Fix64::FromSingle(float val)
-{
-    return Fix64(val);
-}
-
-Fix64 Fix64::FromDouble(double val)
-{
-    return Fix64(val);
-}
-
-Fix64 Fix64::DegToRad(const Fix64& angle)
-{
-    return angle / _radToDeg;
-}
-
-Fix64 Fix64::RadToDeg(const Fix64& rad)
-{
-    return rad / _degToRad;
-}
-
-int64_t Fix64::integer() const
-{
-    return rawValue / fractionFactor;
-}
-
-int64_t Fix64::fraction() const
-{
-    return rawValue % fractionFactor;
-}
-
-double Fix64::ToDouble() const
-{
-    return (integer() + fraction() / (double)(fractionFactor));
-}
-
-float Fix64::ToSingle() const
-{
-    return (integer() + fraction() / (float)(fractionFactor));
-}
-
-bool Fix64::IsInfinity() const
-{
-    return rawValue == PositiveInfinity.rawValue || rawValue == NegativeInfinity.rawValue;
-}
-
-bool Fix64::IsPositiveInfinity() const
-{
-    return rawValue == PositiveInfinity.rawValue;
-}
+    /// 开平方的初始值表：下标i对应y的最高8位(已规格化到[64, 256))，值为ceil(sqrt((i + sqrtSeedFirst + 1) * 256))，
+    /// 保证初始值不小于真实值，牛顿迭代从上方单调收敛.
+    const int sqrtSeedFirst = 64;
+    const int sqrtSeedCount = 256 - sqrtSeedFirst;
 
-bool Fix64::IsNegativeInfinity() const
-{
-    return rawValue == NegativeInfinity.rawValue;
-}
-
-Fix64 Fix64::FromRawValue(int64_t rawValue)
-{
-    struct Fix64 ret(0);
-    ret.rawValue = rawValue;
-    return ret;
-}
+    struct SqrtSeedTable
+    {
+        uint16_t values[sqrtSeedCount];
 
-Fix64 Fix64::FromComponents(int64_t i, int64_t f)
-{
-    return FromRawValue(i * fractionFactor + f);
-}
+        constexpr SqrtSeedTable() : values()
+        {
+            uint32_t root = 0;
+            for (int i = 0; i < sqrtSeedCount; ++i)
+            {
+                uint32_t square = (uint32_t)(i + sqrtSeedFirst + 1) * 256;
+                while (root * root < square)
+                {
+                    ++root;
+                }
+                values[i] = (uint16_t)root;
+            }
+        }
 
-void Fix64::GetIntegerAndFraction(int64_t& integer, int64_t& fraction) const
-{
-    fraction = rawValue % fractionFactor;
-    integer = (rawValue - fraction) >> fractionBits;
-}
+        constexpr uint16_t operator[](uint64_t index) const
+        {
+            return values[index];
+        }
+    };
 
-//Fix64::operator char()
-//{
-//    return integer();
-//}
+    constexpr SqrtSeedTable sqrtSeeds;
 
-Fix64 Fix64::operator -() const
-{
-    return Fix64::FromRawValue(-rawValue);
-}
+    /// 1/sqrt的初始值表：下标i对应x的最高8位(已规格化到[64, 256))，
+    /// 值为1/sqrt((i + invSqrtSeedFirst + 0.5) / 256)，Q15.
+    const int invSqrtSeedFirst = 64;
+    const int invSqrtSeedCount = 256 - invSqrtSeedFirst;
 
-Fix64 FMath::operator +(const Fix64& a, const Fix64& b)
-{
-    return Fix64::FromRawValue(a.rawValue + b.rawValue);
-}
+    constexpr uint64_t ISqrt(uint64_t value)
+    {
+        uint64_t root = 0;
+        for (uint64_t bit = (uint64_t)1 << 31; bit != 0; bit >>= 1)
+        {
+            uint64_t trial = root | bit;
+            if (trial * trial <= value)
+            {
+                root = trial;
+            }
+        }
+        return root;
+    }
 
-const Fix64& FMath::operator+=(Fix64& a, const Fix64& b)
-{
-    a = a + b;
-    return a;
-}
+    struct InvSqrtSeedTable
+    {
+        uint16_t values[invSqrtSeedCount];
 
-Fix64 FMath::operator -(const Fix64& a, const Fix64& b)
-{
-    return Fix64::FromRawValue(a.rawValue - b.rawValue);
-}
+        constexpr InvSqrtSeedTable() : values()
+        {
+            for (int i = 0; i < invSqrtSeedCount; ++i)
+            {
+                // 2^15 * 16 / sqrt(t + 0.5) = sqrt(2^39 / (2t + 1))
+                values[i] = (uint16_t)ISqrt(((uint64_t)1 << 39) / (uint64_t)(2 * (i + invSqrtSeedFirst) + 1));
+            }
+        }
 
-bool FMath::operator ==(const Fix64& a, const Fix64& b)
-{
-    return a.rawValue == b.rawValue;
-}
+        constexpr uint16_t operator[](uint64_t index) const
+        {
+            return values[index];
+        }
+    };
 
-bool FMath::operator !=(const Fix64& a, const Fix64& b)
-{
-    return a.rawValue != b.rawValue;
-}
+    constexpr InvSqrtSeedTable invSqrtSeeds;
 
-bool FMath::operator >(const Fix64& a, const Fix64& b)
-{
-    return a.rawValue > b.rawValue;
-}
+    /// <summary>
+    /// 逐位(每次2位)求floor(sqrt(value << fractionBits))，只做移位、比较和减法.
+    /// </summary>
+    int64_t SqrtDigits(uint64_t value)
+    {
+        uint64_t root = 0;
+        uint64_t rem = 0;
 
-bool FMath::operator >=(const Fix64& a, const Fix64& b)
-{
-    return a.rawValue >= b.rawValue;
-}
+        // 从最高的非0位开始，每次移入2位；rem <= 2 * root，root < 2^40，不会溢出
+        int shift = (64 - Fix64::CountLeadingZeros(value) + 1) & ~1;
+        for (shift -= 2; shift >= 0; shift -= 2)
+        {
+            rem = (rem << 2) | ((value >> shift) & 3);
+            uint64_t trial = (root << 2) | 1;
+            uint64_t mask = (uint64_t)0 - (uint64_t)(rem >= trial);
+            rem -= trial & mask;
+            root = (root << 1) | (mask & 1);
+        }
 
-bool FMath::operator <(const Fix64& a, const Fix64& b)
-{
-    return a.rawValue < b.rawValue;
-}
+        // 小数部分：value << fractionBits移入的全是0
+        for (int i = 0; i < Fix64::fractionBits / 2; ++i)
+        {
+            rem <<= 2;
+            uint64_t trial = (root << 2) | 1;
+            uint64_t mask = (uint64_t)0 - (uint64_t)(rem >= trial);
+            rem -= trial & mask;
+            root = (root << 1) | (mask & 1);
+        }
 
-bool FMath::operator <=(const Fix64& a, const Fix64& b)
-{
-    return a.rawValue <= b.rawValue;
+        return (int64_t)root;
+    }
 }
 
-Fix64 FMath::operator *(const Fix64& a, const Fix64& b)
+int64_t Fix64::MulSplit(int64_t a, int64_t b)
 {
-    int64_t f1 = a.rawValue % Fix64::fractionFactor;
-    int64_t f2 = b.rawValue % Fix64::fractionFactor;
+    int64_t f1 = a % Fix64::fractionFactor;
+    int64_t f2 = b % Fix64::fractionFactor;
 
-    int64_t i1 = (a.rawValue - f1) >> Fix64::fractionBits;
-    int64_t i2 = (b.rawValue - f2) >> Fix64::fractionBits;
+    int64_t i1 = (a - f1) >> Fix64::fractionBits;
+    int64_t i2 = (b - f2) >> Fix64::fractionBits;
 
     // 推导过程
     // i1*i2*fractionFactor + i1*f2 + i2*f1 + (f1*f2)/fractionFactor
     // (i1*fractionFactor + f1)*i2 + i1*f2 + (f1*f2)/fractionFactor
     // a.rawValue*i2 + i1*f2 + (f1*f2)/fractionFactor
-    int64_t r1 = ((a.rawValue * i2)) + i1 * f2 + ((f1 * f2) / Fix64::fractionFactor);
-
-    return Fix64::FromRawValue(r1);
+    // 各项符号与乘积的符号一致，所以结果等价于(a*b)/fractionFactor向0截断
+    return (a * i2) + i1 * f2 + ((f1 * f2) / Fix64::fractionFactor);
 }
 
-Fix64 FMath::operator*(const float a, const Fix64& b)
+std::string Fix64::ToString() const
 {
-    return Fix64(a) * b;
+    char buffer[maxCharsLength];
+    return std::string(buffer, ToChars(buffer, buffer + maxCharsLength));
 }
 
-Fix64 FMath::operator*(const Fix64& a, const float b)
+Fix64 Fix64::Sqrt()
 {
-    return a * Fix64(b);
+    return FromRawValue(Sqrt(rawValue));
 }
 
-Fix64 FMath::operator *(const Fix64& a, int b)
+/// <summary>
+/// 1/sqrt(x)
+/// </summary>
+/// <returns></returns>
+Fix64 Fix64::InvSqrt()
 {
-    return Fix64::FromRawValue(a.rawValue * b);
+    return FromRawValue(InvSqrt(rawValue));
 }
 
-Fix64 FMath::operator *(int a, const Fix64& b)
+int64_t Fix64::InvSqrt(int64_t rawValue)
 {
-    return Fix64::FromRawValue(a * b.rawValue);
-}
+    if (rawValue <= 0)
+    {
+        return MaxValue.rawValue;
+    }
 
-const Fix64& FMath::operator*=(Fix64& a, const Fix64& b)
-{
-    a = a * b;
-    return a;
+    int shift = 0;
+    int64_t mantissa = InvSqrtMantissa(rawValue, shift);
+
+    return MulShift(fractionFactor, mantissa, shift);
 }
 
-Fix64 FMath::operator /(Fix64 a, Fix64 b)
+int64_t Fix64::InvSqrtMantissa(int64_t rawValue, int& shift)
 {
-    if (b.rawValue == 0)
+    if (rawValue <= 0)
     {
-        b.rawValue = 1;
+        shift = fractionBits;
+        return 0;
     }
 
-    return Fix64::FromRawValue((a.rawValue << Fix64::fractionBits) / b.rawValue);
-}
+    // rawValue = m * 2^k，k取偶数，m(Q30)落在[2^28, 2^30)，即[1/4, 1)
+    int k = (64 - CountLeadingZeros((uint64_t)rawValue) - 29) & ~1;
+    uint64_t m = k >= 0 ? (uint64_t)rawValue >> k : (uint64_t)rawValue << -k;
 
-Fix64 FMath::operator /(const Fix64& a, int b)
-{
-    return Fix64::FromRawValue(a.rawValue / b);
-}
+    const uint64_t three = (uint64_t)3 << 30;
+    uint64_t y = (uint64_t)invSqrtSeeds[(m >> 22) - invSqrtSeedFirst] << 15;
 
-Fix64 FMath::operator/(const Fix64& a, float b)
-{
-    return a / Fix64(b);
-}
+    // 初始值相对误差不超过2^-8，2次迭代后达到Q30的精度；y <= 2^31，各乘积都小于2^63
+    for (int i = 0; i < 2; ++i)
+    {
+        uint64_t y2 = (y * y) >> 30;
+        uint64_t my2 = (m * y2) >> 30;
+        y = (y * (three - my2)) >> 31;
+    }
 
-const Fix64& FMath::operator /=(Fix64& a, const Fix64 b)
-{
-    a = a / b;
-    return a;
-}
+    // x = m * 2^(k + 14) / 2^30，1/sqrt(x) = y / 2^30 * 2^(-(k + 14) / 2)
+    shift = 30 + (k + 14) / 2;
 
-std::string Fix64::ToString() const
-{
-    return to_string(integer() + fraction() / (double)(fractionFactor));
+    return (int64_t)y;
 }
 
-int32_t Fix64::Sign()
+
+int64_t Fix64::Sqrt(int64_t rawValue)
 {
-    return Sign(rawValue);
-}
+    if (rawValue <= 0)
+    {
+        return 0;
+    }
 
-typedef uint32_t u_int32_t;
-typedef uint64_t u_int64_t;
+    if (rawValue >= ((int64_t)1 << (64 - fractionBits)))
+    {
+        // rawValue << fractionBits超过64位，逐位计算
+        return SqrtDigits((uint64_t)rawValue);
+    }
 
-int32_t Fix64::Sign(int64_t rawValue)
-{
-    if (rawValue == 0) return 0;
-    else if (rawValue < 0) return -1;
-    else return 1;
-    
-//    u_int32_t k = (u_int32_t)(((u_int64_t)(rawValue)) >> 63);
-//    k ^= 1;
-//
-//    return (int)(k << 1) - 1;
-}
+    uint64_t y = (uint64_t)rawValue << fractionBits;
 
-Fix64 Fix64::Abs()
-{
-    return FromRawValue(Abs(rawValue));
-}
+    // rawValue >= 1，所以y至少有17位；k取偶数，使y >> k落在[2^14, 2^16)
+    int k = (64 - CountLeadingZeros(y) - 15) & ~1;
+    uint64_t x = (uint64_t)sqrtSeeds[(y >> (k + 8)) - sqrtSeedFirst] << (k >> 1);
 
-inline int64_t Fix64::Abs(int64_t rawValue)
-{
-    return rawValue >= 0 ? rawValue : -rawValue;
-}
+    // 初始值不小于真实值，相对误差不超过2^-7，每次迭代精度翻倍，3次后与floor(sqrt(y))最多差1
+    x = (x + y / x) >> 1;
+    x = (x + y / x) >> 1;
+    x = (x + y / x) >> 1;
 
-Fix64 Fix64::Sqrt()
-{
-    return FromRawValue(Sqrt(rawValue));
-}
+    // y < 2^64，结果不超过2^32 - 1
+    if (x > 0xFFFFFFFFULL)
+    {
+        x = 0xFFFFFFFFULL;
+    }
+    if (x * x > y)
+    {
+        --x;
+    }
 
-/// <summary>
-/// 1/sqrt(x)
-/// </summary>
-/// <returns></returns>
-Fix64 Fix64::InvSqrt()
-{
-    return One / Sqrt();
+    return (int64_t)x;
 }
 
 
-int64_t Fix64::Sqrt(int64_t rawValue)
+int64_t Fix64::SqrtNewton(int64_t rawValue)
 {
     if (rawValue > 0)
     {
@@ -390,39 +315,3 @@ int64_t Fix64::Sqrt(int64_t rawValue, int64_t x0, int& counter)
         return 0;
     }
 }
-
-Fix64 Fix64::Repeat(const Fix64& t, const Fix64& length)
-{
-    return t - length * (t / length).Floor();
-}
-
-int Fix64::Floor()
-{
-    // positive
-    if (rawValue >= 0)
-    {
-        return (int)integer();
-    }
-    else // negative
-    {
-        int64_t i, f;
-        GetIntegerAndFraction(i, f);
-
-        if (f != 0) // f < 0
-        {
-            return (int)(i - 1);
-        }
-        else
-        {
-            return (int)i;
-        }
-    }
-    return 0;
-}
-
-
-
-
-
-
-
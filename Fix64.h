@@ -10,10 +10,36 @@
 #define Fix64_hpp
 
 #include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <climits>
 #include <string>
 #include <vector>
+#include <type_traits>
+#include "Fix64Lut.h"
 using namespace std;
 
+/// 乘法实现在编译期选择：
+/// 编译器支持__int128时使用128位乘法，否则使用可移植的mulhi(32位分段相乘)实现.
+/// 定义FIX64_MUL_PORTABLE可以强制使用可移植实现.
+#if !defined(FIX64_MUL_PORTABLE) && defined(__SIZEOF_INT128__)
+#define FIX64_MUL_INT128 1
+#else
+#define FIX64_MUL_INT128 0
+#endif
+
+/// 三角函数表的分段数(2^FIX64_TRIG_LUT_BITS)，表格在编译期生成，每张表2^FIX64_TRIG_LUT_BITS + 1项int32_t.
+/// 默认12：每张表约16KB，查表后线性插值，sin/cos误差不超过1 ULP.
+#ifndef FIX64_TRIG_LUT_BITS
+#define FIX64_TRIG_LUT_BITS 12
+#endif
+
+/// 指数、对数表的分段数(2^FIX64_EXP_LUT_BITS)，与三角函数表相同的方式生成.
+/// 默认12：每张表约16KB，线性插值的相对误差约1e-8；结果很大时误差按相对值计，Pow会把log2的误差放大y倍.
+#ifndef FIX64_EXP_LUT_BITS
+#define FIX64_EXP_LUT_BITS 12
+#endif
+
 namespace FMath
 {
     /// <summary>
@@ -22,13 +48,15 @@ namespace FMath
     /// 2.位布局：第63位为符号位(1位)，第47-16位为整数位(32位)，第15-0位为小数位（16位）
     /// 3.小数精度：1/65536 = 0.0000152587890625
     /// 4.可以考虑的优化方式，提供一组针对rawvalue的计算函数，用户可以保存中间值，用于后续的计算。
+    /// 5.构造函数、运算符和常量全部在头文件中以constexpr内联实现，Fix64是平凡可复制类型，
+    ///   常量在编译期初始化，不存在静态初始化顺序问题.
     /// </summary>
 
 
     struct Fix64
     {
-        static const int fractionBits = 16;
-        static const int64_t fractionFactor = ((int64_t)1 << fractionBits);
+        static constexpr int fractionBits = 16;
+        static constexpr int64_t fractionFactor = ((int64_t)1 << fractionBits);
 
         static const Fix64 Zero;
         static const Fix64 One;
@@ -40,7 +68,7 @@ namespace FMath
         static const Fix64 Epsilon;
         static const Fix64 PositiveInfinity;
         static const Fix64 NegativeInfinity;
-        
+
         static const Fix64 _degToRad;
         static const Fix64 _radToDeg;
 
@@ -51,138 +79,337 @@ namespace FMath
         static const Fix64 EN5;
 
         int64_t rawValue;
-        
-        
-        
-        Fix64(int value);
-        explicit Fix64(double value);
-        Fix64(float value);
-        Fix64(const Fix64& other);
-        Fix64();
-        
-        static Fix64 FromInt(int val);
-
-        static Fix64 FromSingle(float val);
-
-        static Fix64 FromDouble(double val);
-        
+
+
+
+        constexpr Fix64(int value) : rawValue(value * fractionFactor)
+        {
+        }
+
+        /// <summary>
+        /// 四舍五入到最近的rawValue，0.5个rawValue时远离0.
+        /// value * fractionFactor只改变指数，没有舍入误差.
+        /// </summary>
+        explicit constexpr Fix64(double value) : rawValue(RoundToRaw<fractionBits>(value))
+        {
+        }
+
+        /// <summary>
+        /// 与Fix64((double)value)相同，float转double没有误差.
+        /// </summary>
+        constexpr Fix64(float value) : rawValue(RoundToRaw<fractionBits>((double)value))
+        {
+        }
+
+        constexpr Fix64() : rawValue(0)
+        {
+        }
+
+        static constexpr Fix64 FromInt(int val)
+        {
+            return Fix64(val);
+        }
+
+        static constexpr Fix64 FromSingle(float val)
+        {
+            return Fix64(val);
+        }
+
+        static constexpr Fix64 FromDouble(double val)
+        {
+            return Fix64(val);
+        }
+
         //整数部分
-        int64_t integer() const;
-        
+        constexpr int64_t integer() const
+        {
+            return rawValue / fractionFactor;
+        }
+
         //小数部分
-        int64_t fraction() const;
+        constexpr int64_t fraction() const
+        {
+            return rawValue % fractionFactor;
+        }
 
-        double ToDouble() const;
+        /// <summary>
+        /// 乘以2^-fractionBits：|rawValue| < 2^53时结果精确，不需要拆分整数和小数部分.
+        /// </summary>
+        constexpr double ToDouble() const
+        {
+            return (double)rawValue * (1.0 / fractionFactor);
+        }
+
+        /// <summary>
+        /// rawValue转float时舍入一次，再乘以2^-fractionBits(精确)，结果为最接近的float.
+        /// </summary>
+        constexpr float ToSingle() const
+        {
+            return (float)rawValue * (1.0f / fractionFactor);
+        }
 
-        float ToSingle() const;
-        
-        bool IsInfinity() const;
-        bool IsPositiveInfinity() const;
-        bool IsNegativeInfinity() const;
+        /// <summary>
+        /// 批量转换：out[i] = in[i].ToDouble()/ToSingle()，结果与逐个转换逐位一致.
+        /// 按FVector3Array::SetKernel选择AVX2或标量实现.
+        /// </summary>
+        static void ToDoubleArray(const Fix64* in, double* out, size_t count);
+
+        static void ToFloatArray(const Fix64* in, float* out, size_t count);
 
-        static Fix64 FromRawValue(int64_t rawValue);
-        
-        static Fix64 DegToRad(const Fix64& angle);
+        /// <summary>
+        /// 批量转换：out[i] = Fix64(in[i])，四舍五入，结果与逐个转换逐位一致.
+        /// </summary>
+        static void FromDoubleArray(const double* in, Fix64* out, size_t count);
 
-        static Fix64 RadToDeg(const Fix64& angle);
+        static void FromFloatArray(const float* in, Fix64* out, size_t count);
+
+        constexpr bool IsInfinity() const;
+        constexpr bool IsPositiveInfinity() const;
+        constexpr bool IsNegativeInfinity() const;
+
+        static constexpr Fix64 FromRawValue(int64_t rawValue)
+        {
+            Fix64 ret;
+            ret.rawValue = rawValue;
+            return ret;
+        }
 
-        static Fix64 FromComponents(int64_t i, int64_t f);
+        static constexpr Fix64 DegToRad(const Fix64& angle);
+
+        static constexpr Fix64 RadToDeg(const Fix64& angle);
+
+        static constexpr Fix64 FromComponents(int64_t i, int64_t f)
+        {
+            return FromRawValue(i * fractionFactor + f);
+        }
+
+        constexpr void GetIntegerAndFraction(int64_t& integer, int64_t& fraction) const
+        {
+            fraction = rawValue % fractionFactor;
+            integer = (rawValue - fraction) >> fractionBits;
+        }
+
+        /// <summary>
+        /// value * 2^FracBits四舍五入到整数，0.5时远离0(与llround相同，但可以在编译期求值).
+        /// 乘以2^FracBits只改变指数；scaled - 截断值在double中精确，不会出现先加0.5再截断时的双重舍入.
+        /// Fix64和Fixed<Storage, FracBits>的浮点构造都用它，保证Fixed<int64_t, 16>与Fix64逐位一致.
+        /// </summary>
+        template<int FracBits>
+        static constexpr int64_t RoundToRaw(double value)
+        {
+            double scaled = value * (double)((int64_t)1 << FracBits);
+            int64_t truncated = (int64_t)scaled;
+            double remainder = scaled - (double)truncated;
+            return truncated + (remainder >= 0.5 ? 1 : 0) - (remainder <= -0.5 ? 1 : 0);
+        }
+
+        /// <summary>
+        /// rawValue乘法：(a * b) / fractionFactor，结果向0截断.
+        /// 无分支实现，与MulSplit的舍入方式逐位一致（包括溢出时的回绕结果）.
+        /// </summary>
+        /// <param name="a">rawValue</param>
+        /// <param name="b">rawValue</param>
+        /// <returns>rawValue</returns>
+        static constexpr int64_t Mul(int64_t a, int64_t b);
+
+        /// <summary>
+        /// 旧的乘法实现：拆分为整数和小数部分后分别相乘.
+        /// 仅用于性能对比和一致性校验.
+        /// </summary>
+        static int64_t MulSplit(int64_t a, int64_t b);
 
-        void GetIntegerAndFraction(int64_t& integer, int64_t& fraction) const;
-        
         //operator char();
 
-        Fix64 operator -() const;
+        constexpr Fix64 operator -() const
+        {
+            return Fix64::FromRawValue(-rawValue);
+        }
+
+        friend constexpr Fix64 operator +(const Fix64& a, const Fix64& b);
+
+        friend constexpr const Fix64& operator +=(Fix64& a, const Fix64& b);
 
-        friend Fix64 operator +(const Fix64& a, const Fix64& b);
+        friend constexpr Fix64 operator -(const Fix64& a, const Fix64& b);
 
-        friend const Fix64& operator +=(Fix64& a, const Fix64& b);
-        
-        friend Fix64 operator -(const Fix64& a, const Fix64& b);
+        friend constexpr bool operator ==(const Fix64& a, const Fix64& b);
 
-        friend bool operator ==(const Fix64& a, const Fix64& b);
+        friend constexpr bool operator !=(const Fix64& a, const Fix64& b);
 
-        friend bool operator !=(const Fix64& a, const Fix64& b);
+        friend constexpr bool operator >(const Fix64& a, const Fix64& b);
 
-        friend bool operator >(const Fix64& a, const Fix64& b);
+        friend constexpr bool operator >=(const Fix64& a, const Fix64& b);
 
-        friend bool operator >=(const Fix64& a, const Fix64& b);
+        friend constexpr bool operator <(const Fix64& a, const Fix64& b);
 
-        friend bool operator <(const Fix64& a, const Fix64& b);
+        friend constexpr bool operator <=(const Fix64& a, const Fix64& b);
 
-        friend bool operator <=(const Fix64& a, const Fix64& b);
+        friend constexpr Fix64 operator *(const Fix64& a, const Fix64& b);
 
-        friend Fix64 operator *(const Fix64& a, const Fix64& b);
+        friend constexpr Fix64 operator *(const float a, const Fix64& b);
+        friend constexpr Fix64 operator *(const Fix64& a, const float b);
 
-        friend Fix64 operator *(const float a, const Fix64& b);
-        friend Fix64 operator *(const Fix64& a, const float b);
+        friend constexpr Fix64 operator *(const Fix64& a, int b);
+        friend constexpr Fix64 operator *(int a, const Fix64& b);
+        friend constexpr const Fix64& operator *=(Fix64& a, const Fix64& b);
 
-        friend Fix64 operator *(const Fix64& a, int b);
-        friend Fix64 operator *(int a, const Fix64& b);
-        friend const Fix64& operator *=(Fix64& a, const Fix64& b);
-        
 
-        friend Fix64 operator /(Fix64 a, Fix64 b);
-        friend Fix64 operator /(const Fix64& a, int b);
-        friend Fix64 operator /(const Fix64& a, float b);
-        friend const Fix64& operator /=(Fix64& a, const Fix64 b);
-        
+        friend constexpr Fix64 operator /(Fix64 a, Fix64 b);
+        friend constexpr Fix64 operator /(const Fix64& a, int b);
+        friend constexpr Fix64 operator /(const Fix64& a, float b);
+        friend constexpr const Fix64& operator /=(Fix64& a, const Fix64 b);
 
+
+        /// <summary>
+        /// 最短的十进制表示，见ToChars.
+        /// </summary>
         string ToString() const;
 
+        /// <summary>
+        /// 格式化一个值最多写入的字符数：符号、15位整数(任意rawValue)、小数点、16位小数(ToCharsExact).
+        /// </summary>
+        static constexpr size_t maxCharsLength = 33;
+
+        /// <summary>
+        /// 写入FromChars能读回相同rawValue的最短十进制表示(最多5位小数)，如0.1、-2.5、3.
+        /// 与std::to_chars一样不分配内存，不写入结尾的'\0'.
+        /// </summary>
+        /// <returns>写入的最后一个字符之后的位置，空间不足时返回nullptr</returns>
+        char* ToChars(char* first, char* last) const;
+
+        /// <summary>
+        /// 写入rawValue / 2^16的精确十进制值(最多16位小数)，如0.100006103515625.
+        /// </summary>
+        char* ToCharsExact(char* first, char* last) const;
+
+        /// <summary>
+        /// 解析[+-]digits[.digits]，四舍五入到最近的rawValue，0.5个rawValue时远离0(与Fix64(double)相同)，
+        /// 小数位数不限，结果精确. 与std::from_chars一样不跳过前导空白.
+        /// 接受任意int64_t的rawValue(包括运算回绕后超出MaxValue的值)，ToChars写出的值都能读回.
+        /// </summary>
+        /// <returns>解析结束的位置；没有数字或超出int64_t的rawValue范围时返回nullptr，value不变</returns>
+        static const char* FromChars(const char* first, const char* last, Fix64& value);
+
+        /// <summary>
+        /// 格式化count个值，用separator分隔(FVector3等的格式)，不分配内存.
+        /// </summary>
+        /// <returns>写入的最后一个字符之后的位置，空间不足时返回nullptr</returns>
+        static char* ToChars(const Fix64* values, size_t count, char* first, char* last, char separator = ',');
+
+        /// <summary>
+        /// 解析separator分隔的count个值，separator两侧可以有空格或制表符.
+        /// </summary>
+        /// <returns>最后一个值之后的位置，格式错误或不足count个值时返回nullptr</returns>
+        static const char* FromChars(const char* first, const char* last, Fix64* values, size_t count, char separator = ',');
+
+        /// <summary>
+        /// 批量格式化count个向量，每个向量components个连续存放的分量：一行一个向量，分量用','分隔，以'\n'结尾.
+        /// order不为nullptr时每行第j个分量为order[j]号分量(FQuaternion按w, x, y, z存放，按x, y, z, w写出).
+        /// FVector2/3/4、FQuaternion的批量ToChars/FromChars都转到这里.
+        /// </summary>
+        /// <returns>写入的最后一个字符之后的位置，空间不足时返回nullptr</returns>
+        static char* ToCharsLines(const Fix64* values, size_t count, int components, char* first, char* last, const int* order = nullptr);
+
+        /// <summary>
+        /// 解析ToCharsLines的输出，各行之间可以有任意空白.
+        /// </summary>
+        /// <returns>最后一个值之后的位置，格式错误或不足count行时返回nullptr</returns>
+        static const char* FromCharsLines(const char* first, const char* last, Fix64* values, size_t count, int components, const int* order = nullptr);
+
         inline int GetHashCode()
         {
             return (int)rawValue;
         }
 
-        inline static Fix64 Max(Fix64 a, Fix64 b)
+        inline static constexpr Fix64 Max(Fix64 a, Fix64 b)
         {
-            return a > b ? a : b;
+            return a.rawValue > b.rawValue ? a : b;
         }
 
-        inline static Fix64 Min(Fix64 a, Fix64 b)
+        inline static constexpr Fix64 Min(Fix64 a, Fix64 b)
         {
-            return a <= b ? a : b;
+            return a.rawValue <= b.rawValue ? a : b;
         }
 
 
-        inline static Fix64 Lerp(Fix64 a, Fix64 b, Fix64 t)
+        inline static constexpr Fix64 Lerp(Fix64 a, Fix64 b, Fix64 t);
+
+        constexpr int32_t Sign() const
         {
-            return a + (b - a) * t;
+            return Sign(rawValue);
         }
 
-        int32_t Sign();
+        static constexpr int32_t Sign(int64_t rawValue)
+        {
+            return rawValue == 0 ? 0 : (rawValue < 0 ? -1 : 1);
 
-        static int32_t Sign(int64_t rawValue);
+        //    uint32_t k = (uint32_t)(((uint64_t)(rawValue)) >> 63);
+        //    k ^= 1;
+        //
+        //    return (int)(k << 1) - 1;
+        }
 
-        Fix64 Abs();
+        constexpr Fix64 Abs() const
+        {
+            return FromRawValue(Abs(rawValue));
+        }
 
-        inline static int64_t Abs(int64_t rawValue);
+        inline static constexpr int64_t Abs(int64_t rawValue)
+        {
+            return rawValue >= 0 ? rawValue : -rawValue;
+        }
 
         Fix64 Sqrt();
 
         /// <summary>
-        /// 1/sqrt(x)
+        /// 1/sqrt(x)，直接迭代1/sqrt，不做开平方和除法.
         /// </summary>
         /// <returns></returns>
         Fix64 InvSqrt();
 
         /// <summary>
-        /// 64位定点数开平方——用牛顿迭代法实现.
+        /// rawValue的1/sqrt，结果向0截断；rawValue <= 0时返回MaxValue.
+        /// </summary>
+        static int64_t InvSqrt(int64_t rawValue);
+
+        /// <summary>
+        /// 1/sqrt的规格化结果，用于一次求值后乘到多个分量上：
+        /// v / sqrt(x)的rawValue = MulShift(v.rawValue, mantissa, shift).
+        /// 规格化到[1/4, 1)后查初始值表，再在Q30下做2次牛顿迭代 y = y * (3 - x * y^2) / 2，
+        /// 只用64位整数乘法；mantissa在(2^30, 2^31]内，相对误差约2^-28.
+        /// rawValue <= 0时mantissa为0.
+        /// </summary>
+        /// <param name="rawValue">x的rawValue</param>
+        /// <param name="shift">输出，不小于fractionBits</param>
+        /// <returns>Q30的mantissa</returns>
+        static int64_t InvSqrtMantissa(int64_t rawValue, int& shift);
+
+        /// <summary>
+        /// (a * b) >> shift，结果向0截断，shift >= fractionBits.
+        /// 中间结果用Mul的128位乘法，不会溢出.
+        /// </summary>
+        static constexpr int64_t MulShift(int64_t a, int64_t b, int shift);
+
+        /// <summary>
+        /// 64位定点数开平方：求floor(sqrt(rawValue << fractionBits)).
+        /// 用CountLeadingZeros规格化后按最高8位(规格化到[64, 256))查192项的初始值表，再做固定3次牛顿迭代和1次修正；
+        /// rawValue << fractionBits超过64位时改为逐位(每次2位)计算.
+        /// 结果是精确的向下取整，只用整数运算，与编译器和平台无关；rawValue <= 0时返回0.
         /// </summary>
         /// <param name="rawValue"></param>
         /// <returns></returns>
         /// <remarks>
-        /// sample_count = 1000000
-        /// TestNewtonSqrt_Pref elapsedTime = 106471
-        /// TestSqrt_Pref elapsedTime = 8140
-        /// TestNewtonSqrtLong_Pref elapsedTime = 231810
-        /// TestFastSqrt_Pref elapsedTime = 50450
+        /// 旧的牛顿迭代实现见SqrtNewton，每次迭代都要做一次64位除法.
+        ///
+        /// 与SqrtNewton(旧的Sqrt)的结果并不逐位相同，差别都出现在较小的输入上：
+        /// rawValue为1时旧实现的初始值rawValue >> 1为0，直接返回0(正确值为256)；
+        /// 旧实现在相邻两次迭代相差不超过1时就停止，在完全平方数附近可能比floor多1，
+        /// 如rawValue为262140、262148、589818、589830. 新实现返回的是正确的floor，
+        /// 帧同步中新旧版本不能混用.
         ///
-        /// 结论：
-        ///  1.系统库sqrt性能是NewtonSqrtLong的25倍左右
-        ///  2.系统库sqrt性能是fastsqrt的5倍
-        ///  3.浮点数由于其存储结构，可以迅速找到数量级上的平方数.
+        /// 耗时由FMathBench --filter Sqrt测量(Release，吞吐量 / 延迟)：
+        /// Fix64 Sqrt 11.9ns / 27.2ns，InvSqrt 7.8ns / 19.3ns.
+        /// 与SqrtNewton、std::sqrt的对比见BenchFix64Sqrt(FMathBench --compare).
+        /// 浮点数由于其存储结构，可以迅速找到数量级上的平方数；定点数用CountLeadingZeros得到同样的信息.
         ///
         /// double / double
         /// 00FB4414  movsd       xmm0,mmword ptr [eax+0FBE168h]
@@ -197,9 +424,37 @@ namespace FMath
         /// int64/int64
         /// 000544CD  call        __alldiv (051352h)
         /// </remarks>
-        
+
         static int64_t Sqrt(int64_t rawValue);
 
+        /// <summary>
+        /// 旧的开平方实现：牛顿迭代，初始值取rawValue / 2.
+        /// rawValue >= 2^47时rawValue << fractionBits溢出.
+        /// 仅用于性能对比和一致性校验.
+        /// </summary>
+        static int64_t SqrtNewton(int64_t rawValue);
+
+        /// <summary>
+        /// 前导0的个数，value为0时返回64.
+        /// </summary>
+        static constexpr int CountLeadingZeros(uint64_t value);
+
+        /// <summary>
+        /// 使maxAbs * 2^shift落在[2^(bits - 1), 2^bits)的shift，maxAbs为0时返回0.
+        /// 求比值、方向或夹角时各分量同乘2的整数次幂不改变结果，先规格化可以避免小量的乘积丢失有效位、大量的乘积溢出.
+        /// </summary>
+        static constexpr int NormalizeShift(uint64_t maxAbs, int bits);
+
+        /// <summary>
+        /// rawValue * 2^shift，shift < 0时右移(向负无穷取整).
+        /// </summary>
+        static constexpr int64_t ScaleRaw(int64_t rawValue, int shift);
+
+        /// <summary>
+        /// 把values的count个分量同乘2^shift，使绝对值最大的分量落在[2^(bits - 1), 2^bits)，返回shift；全为0时不变并返回0.
+        /// </summary>
+        static constexpr int NormalizePow2(Fix64* values, int count, int bits);
+
         /// <summary>
         /// 指定初始进行运算
         /// </summary>
@@ -218,47 +473,417 @@ namespace FMath
         /// <param name="rawValue"></param>
         /// <param name="counter"></param>
         /// <returns></returns>
-        /// 
+        ///
         //static int64_t Sqrt(long rawValue, int& counter);
 
         static int64_t Sqrt(int64_t rawValue, int64_t x0, int& counter);
 
-        static Fix64 Repeat(const Fix64& t, const Fix64& length);
+        static constexpr Fix64 Repeat(const Fix64& t, const Fix64& length);
+
+        constexpr int Floor() const
+        {
+            // positive
+            if (rawValue >= 0)
+            {
+                return (int)integer();
+            }
+            else // negative
+            {
+                int64_t i = 0, f = 0;
+                GetIntegerAndFraction(i, f);
+
+                if (f != 0) // f < 0
+                {
+                    return (int)(i - 1);
+                }
+                else
+                {
+                    return (int)i;
+                }
+            }
+        }
+
 
-        int Floor();
-        
-        
         /************ trigonometry ***********/
-        static int64_t sintable[];
-        static int sintableLen;
-        
-        
+/// <summary>
+        /// 三角函数表：值按Q30存储，查表位置按Q30等分定义域.
+        /// sinLut：sin，[0, π/2]
+        /// tanLut：tan，[0, π/4]
+        /// asinLut：asin，[0, 1/2]
+        /// atanLut：atan，[0, 1]
+        /// </summary>
+        typedef FixedLut<int32_t, FIX64_TRIG_LUT_BITS, 30> TrigLut;
+
+        static const TrigLut sinLut;
+        static const TrigLut tanLut;
+        static const TrigLut asinLut;
+        static const TrigLut atanLut;
+
+        /// <summary>
+        /// 查表求[0, π/2]内的正弦值.
+        /// </summary>
+        /// <param name="quarter">四分之一圈内的相位，2^30对应π/2</param>
+        /// <returns>rawValue</returns>
+        static int64_t SinQuarter(int64_t quarter);
+
+
+        /// <summary>
+        /// 查正弦表实现，先用ClampSinValue折叠到[0, π/2]，再O(1)查表.
+        /// </summary>
         static Fix64 Sin(Fix64 angle);
-        
+
         static int64_t ClampSinValue(int64_t radian, int64_t& flipHorizontal, bool& flipVertical);
-        
+
         static Fix64 Cos(Fix64 angle);
-        
+
         static Fix64 Tan(Fix64 angle);
-        
+
         static Fix64 Cot(Fix64 val);
-        
+
+        /// <summary>
+        /// 查asin表，|val| > 1/2时用asin(v) = π/2 - 2 * asin(sqrt((1 - v) / 2))折回表格范围.
+        /// </summary>
         static Fix64 Asin(Fix64 val);
-        
+
         static Fix64 Acos(Fix64 val);
-        
+
         static Fix64 Atan(Fix64 val);
-        
+
+        /// <summary>
+        /// atan2(y, x)，值域(-π, π]，x、y都为0时返回0.
+        /// 按八分圆折叠：min(|x|, |y|) / max(|x|, |y|)在[0, 1]内，直接查atan表(Q30的比值，不经过Q16的除法)，
+        /// 再按|y| > |x|、x < 0、y < 0依次展开，没有开平方和Fix64除法.
+        /// </summary>
+        static Fix64 Atan2(Fix64 y, Fix64 x);
+
         static Fix64 Acot(Fix64 val);
-        
+
+        /// <summary>
+        /// 把编译期生成的表格导出为C数组文本，便于核对或移植到其他平台.
+        /// </summary>
         static void __GenerateSinLut();
-        
+
         static void __GenerateTanLut();
-        
+
         static void __GenerateAsinLut();
-        
+
         static void __GenerateAtanLut();
+
+
+        /************ exponential ***********/
+
+        typedef FixedLut<int32_t, FIX64_EXP_LUT_BITS, 30> ExpLut;
+
+        /// 2^x - 1，x取值[0, 1]
+        static const ExpLut exp2Lut;
+
+        /// log2(1 + x)，x取值[0, 1]
+        static const ExpLut log2Lut;
+
+        /// <summary>
+        /// 2^x：x拆成整数n和小数f，2^f查表，再移位n位. 结果超出MaxValue时返回MaxValue，小于Epsilon的一半时返回0.
+        /// </summary>
+        static Fix64 Exp2(Fix64 x);
+
+        /// <summary>
+        /// e^x = 2^(x * log2(e))，x * log2(e)按Q46计算，不损失x的小数位.
+        /// </summary>
+        static Fix64 Exp(Fix64 x);
+
+        /// <summary>
+        /// log2(x)：按最高位规格化到[1, 2)后查表. x <= 0时返回MinValue.
+        /// </summary>
+        static Fix64 Log2(Fix64 x);
+
+        /// <summary>
+        /// ln(x) = log2(x) * ln(2)，log2(x)保留Q30. x <= 0时返回MinValue.
+        /// </summary>
+        static Fix64 Log(Fix64 x);
+
+        /// <summary>
+        /// x^y = 2^(y * log2(x))，log2(x)保留Q30.
+        /// x < 0时只有y为整数才有定义，按y的奇偶决定符号，否则返回0；0^y在y > 0时为0，y <= 0时为MaxValue，0^0为1.
+        /// </summary>
+        static Fix64 Pow(Fix64 x, Fix64 y);
+
+        /// <summary>
+        /// 批量求值：out[i] = Exp/Exp2/Log/Log2(in[i])，out可以与in相同.
+        /// </summary>
+        static void Exp(const Fix64* in, Fix64* out, size_t count);
+
+        static void Exp2(const Fix64* in, Fix64* out, size_t count);
+
+        static void Log(const Fix64* in, Fix64* out, size_t count);
+
+        static void Log2(const Fix64* in, Fix64* out, size_t count);
+
+        /// <summary>
+        /// 批量求幂：out[i] = Pow(in[i], y)，out可以与in相同.
+        /// </summary>
+        static void Pow(const Fix64* in, Fix64 y, Fix64* out, size_t count);
     };
+
+    static_assert(std::is_trivially_copyable<Fix64>::value, "Fix64 must be trivially copyable");
+    static_assert(sizeof(Fix64) == sizeof(int64_t), "Fix64 must have the same layout as int64_t");
+
+    /************ constants ***********/
+
+    inline constexpr Fix64 Fix64::Zero = Fix64::FromRawValue(0);
+    inline constexpr Fix64 Fix64::One = Fix64::FromRawValue(Fix64::fractionFactor);
+    inline constexpr Fix64 Fix64::Half = Fix64::FromRawValue(Fix64::fractionFactor / 2);
+    inline constexpr Fix64 Fix64::MaxValue = Fix64::FromRawValue(0x00007fffffffffff);
+    inline constexpr Fix64 Fix64::MinValue = Fix64::FromRawValue(-0x00007fffffffffff);
+    inline constexpr Fix64 Fix64::E = Fix64::FromRawValue(0x000000000002b7e1);
+    inline constexpr Fix64 Fix64::PI = Fix64::FromRawValue(0x000000000003243f);
+    inline constexpr Fix64 Fix64::Epsilon = Fix64::FromRawValue(1);
+    inline constexpr Fix64 Fix64::PositiveInfinity = Fix64::FromRawValue(LLONG_MAX);
+    inline constexpr Fix64 Fix64::NegativeInfinity = Fix64::FromRawValue(LLONG_MIN);
+
+    inline constexpr Fix64 Fix64::_degToRad = Fix64::FromRawValue(0x0000000000000477);
+    inline constexpr Fix64 Fix64::_radToDeg = Fix64::FromRawValue(0x0000000000394bbf);
+
+    // One / 10^n
+    inline constexpr Fix64 Fix64::EN1 = Fix64::FromRawValue(Fix64::fractionFactor / 10);
+    inline constexpr Fix64 Fix64::EN2 = Fix64::FromRawValue(Fix64::fractionFactor / 100);
+    inline constexpr Fix64 Fix64::EN3 = Fix64::FromRawValue(Fix64::fractionFactor / 1000);
+    inline constexpr Fix64 Fix64::EN4 = Fix64::FromRawValue(Fix64::fractionFactor / 10000);
+    inline constexpr Fix64 Fix64::EN5 = Fix64::FromRawValue(Fix64::fractionFactor / 100000);
+
+    /************ inline implementation ***********/
+
+    constexpr bool Fix64::IsInfinity() const
+    {
+        return rawValue == PositiveInfinity.rawValue || rawValue == NegativeInfinity.rawValue;
+    }
+
+    constexpr bool Fix64::IsPositiveInfinity() const
+    {
+        return rawValue == PositiveInfinity.rawValue;
+    }
+
+    constexpr bool Fix64::IsNegativeInfinity() const
+    {
+        return rawValue == NegativeInfinity.rawValue;
+    }
+
+    constexpr int Fix64::CountLeadingZeros(uint64_t value)
+    {
+        if (value == 0)
+        {
+            return 64;
+        }
+
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_clzll(value);
+#else
+        int count = 0;
+        for (int shift = 32; shift > 0; shift >>= 1)
+        {
+            if ((value >> (64 - shift)) == 0)
+            {
+                count += shift;
+                value <<= shift;
+            }
+        }
+        return count;
+#endif
+    }
+
+    constexpr int Fix64::NormalizeShift(uint64_t maxAbs, int bits)
+    {
+        return maxAbs == 0 ? 0 : CountLeadingZeros(maxAbs) - (64 - bits);
+    }
+
+    constexpr int64_t Fix64::ScaleRaw(int64_t rawValue, int shift)
+    {
+        return shift >= 0 ? (int64_t)((uint64_t)rawValue << shift) : rawValue >> -shift;
+    }
+
+    constexpr int Fix64::NormalizePow2(Fix64* values, int count, int bits)
+    {
+        uint64_t maxAbs = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            maxAbs |= (uint64_t)Abs(values[i].rawValue);
+        }
+
+        int shift = NormalizeShift(maxAbs, bits);
+        for (int i = 0; i < count; ++i)
+        {
+            values[i].rawValue = ScaleRaw(values[i].rawValue, shift);
+        }
+        return shift;
+    }
+
+    constexpr int64_t Fix64::Mul(int64_t a, int64_t b)
+    {
+#if FIX64_MUL_INT128
+        __int128 product = (__int128)a * b;
+
+        // 负数加上(fractionFactor - 1)后再算术右移，等价于向0截断的除法
+        product += (int64_t)(product >> 127) & (fractionFactor - 1);
+
+        return (int64_t)(product >> fractionBits);
+#else
+        // 取绝对值：sign为0或-1
+        uint64_t signA = (uint64_t)(a >> 63);
+        uint64_t signB = (uint64_t)(b >> 63);
+        uint64_t ua = ((uint64_t)a ^ signA) - signA;
+        uint64_t ub = ((uint64_t)b ^ signB) - signB;
+        uint64_t sign = signA ^ signB;
+
+        // 128位无符号乘法：ua * ub = hi:lo
+        uint64_t aLo = (uint32_t)ua, aHi = ua >> 32;
+        uint64_t bLo = (uint32_t)ub, bHi = ub >> 32;
+
+        uint64_t ll = aLo * bLo;
+        uint64_t lh = aLo * bHi;
+        uint64_t hl = aHi * bLo;
+        uint64_t hh = aHi * bHi;
+
+        uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+        uint64_t lo = (mid << 32) | (uint32_t)ll;
+        uint64_t hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+
+        // 绝对值右移即向0截断，再恢复符号
+        uint64_t magnitude = (hi << (64 - fractionBits)) | (lo >> fractionBits);
+
+        return (int64_t)((magnitude ^ sign) - sign);
+#endif
+    }
+
+    constexpr int64_t Fix64::MulShift(int64_t a, int64_t b, int shift)
+    {
+        // 两次向0截断的除法等价于一次：trunc(trunc(a * b / 2^16) / 2^(shift - 16))
+        int64_t product = Mul(a, b);
+        int rest = shift - fractionBits;
+        product += (product >> 63) & (((int64_t)1 << rest) - 1);
+
+        return product >> rest;
+    }
+
+    constexpr Fix64 operator +(const Fix64& a, const Fix64& b)
+    {
+        return Fix64::FromRawValue(a.rawValue + b.rawValue);
+    }
+
+    constexpr const Fix64& operator +=(Fix64& a, const Fix64& b)
+    {
+        a.rawValue += b.rawValue;
+        return a;
+    }
+
+    constexpr Fix64 operator -(const Fix64& a, const Fix64& b)
+    {
+        return Fix64::FromRawValue(a.rawValue - b.rawValue);
+    }
+
+    constexpr bool operator ==(const Fix64& a, const Fix64& b)
+    {
+        return a.rawValue == b.rawValue;
+    }
+
+    constexpr bool operator !=(const Fix64& a, const Fix64& b)
+    {
+        return a.rawValue != b.rawValue;
+    }
+
+    constexpr bool operator >(const Fix64& a, const Fix64& b)
+    {
+        return a.rawValue > b.rawValue;
+    }
+
+    constexpr bool operator >=(const Fix64& a, const Fix64& b)
+    {
+        return a.rawValue >= b.rawValue;
+    }
+
+    constexpr bool operator <(const Fix64& a, const Fix64& b)
+    {
+        return a.rawValue < b.rawValue;
+    }
+
+    constexpr bool operator <=(const Fix64& a, const Fix64& b)
+    {
+        return a.rawValue <= b.rawValue;
+    }
+
+    constexpr Fix64 operator *(const Fix64& a, const Fix64& b)
+    {
+        return Fix64::FromRawValue(Fix64::Mul(a.rawValue, b.rawValue));
+    }
+
+    constexpr Fix64 operator *(const float a, const Fix64& b)
+    {
+        return Fix64(a) * b;
+    }
+
+    constexpr Fix64 operator *(const Fix64& a, const float b)
+    {
+        return a * Fix64(b);
+    }
+
+    constexpr Fix64 operator *(const Fix64& a, int b)
+    {
+        return Fix64::FromRawValue(a.rawValue * b);
+    }
+
+    constexpr Fix64 operator *(int a, const Fix64& b)
+    {
+        return Fix64::FromRawValue(a * b.rawValue);
+    }
+
+    constexpr const Fix64& operator *=(Fix64& a, const Fix64& b)
+    {
+        a.rawValue = Fix64::Mul(a.rawValue, b.rawValue);
+        return a;
+    }
+
+    constexpr Fix64 operator /(Fix64 a, Fix64 b)
+    {
+        if (b.rawValue == 0)
+        {
+            b.rawValue = 1;
+        }
+
+        return Fix64::FromRawValue((a.rawValue * Fix64::fractionFactor) / b.rawValue);
+    }
+
+    constexpr Fix64 operator /(const Fix64& a, int b)
+    {
+        return Fix64::FromRawValue(a.rawValue / b);
+    }
+
+    constexpr Fix64 operator /(const Fix64& a, float b)
+    {
+        return a / Fix64(b);
+    }
+
+    constexpr const Fix64& operator /=(Fix64& a, const Fix64 b)
+    {
+        a = a / b;
+        return a;
+    }
+
+    constexpr Fix64 Fix64::DegToRad(const Fix64& angle)
+    {
+        return angle / _radToDeg;
+    }
+
+    constexpr Fix64 Fix64::RadToDeg(const Fix64& rad)
+    {
+        return rad / _degToRad;
+    }
+
+    inline constexpr Fix64 Fix64::Lerp(Fix64 a, Fix64 b, Fix64 t)
+    {
+        return a + (b - a) * t;
+    }
+
+    constexpr Fix64 Fix64::Repeat(const Fix64& t, const Fix64& length)
+    {
+        return t - length * (t / length).Floor();
+    }
 }
 
 #endif /* Fix64_hpp */
@@ -0,0 +1,150 @@
+//
+//  Fix64Divisor.h
+//  MathLib
+//
+//  预计算倒数的定点数除法.
+//
+
+#ifndef Fix64Divisor_h
+#define Fix64Divisor_h
+
+#include <stddef.h>
+#include "Fix64.h"
+
+namespace FMath
+{
+    /// <summary>
+    /// 同一个除数要除多个数时使用：构造时算一次魔数(magic)和移位量，
+    /// 之后每次除法只需要一次64位高位乘法、几次移位和加减，不再做64位idiv.
+    /// 结果与operator /(Fix64, Fix64)逐位一致（包括除数为0时按1个ulp处理、被除数左移溢出时的回绕）.
+    ///
+    /// 算法(Granlund-Montgomery)：对|d|取 l = ceil(log2|d|)，m = floor(2^64 * (2^l - |d|) / |d|) + 1，
+    /// 则对任意64位无符号n：t = mulhi(m, n)，floor(n / |d|) = (t + ((n - t) >> 1)) >> (l - 1).
+    /// 有符号除法按向0截断，先对绝对值做无符号除法再恢复符号.
+    /// </summary>
+    struct Fix64Divisor
+    {
+        uint64_t magic;
+        int shift1;
+        int shift2;
+
+        /// 除数的符号，0或-1
+        uint64_t sign;
+
+        constexpr explicit Fix64Divisor(const Fix64& divisor) : magic(0), shift1(0), shift2(0), sign(0)
+        {
+            int64_t rawValue = divisor.rawValue;
+            if (rawValue == 0)
+            {
+                rawValue = 1;
+            }
+
+            sign = (uint64_t)(rawValue >> 63);
+            uint64_t d = ((uint64_t)rawValue ^ sign) - sign;
+
+            if (d == 1)
+            {
+                // t = 0，q = n
+                return;
+            }
+
+            int l = 64 - Fix64::CountLeadingZeros(d - 1);
+            magic = DivideHigh(((uint64_t)1 << l) - d, d) + 1;
+            shift1 = 1;
+            shift2 = l - 1;
+        }
+
+        /// <summary>
+        /// trunc((numerator << fractionBits) / divisor)，与a / divisor一致.
+        /// </summary>
+        constexpr Fix64 Divide(const Fix64& numerator) const
+        {
+            return Fix64::FromRawValue(DivideRaw((int64_t)((uint64_t)numerator.rawValue << Fix64::fractionBits)));
+        }
+
+        /// <summary>
+        /// numerator << fractionBits不超出64位(|rawValue| < 2^47)，此时Divide的结果精确；
+        /// 否则与operator /一样回绕，需要精确结果时用Fix64Overflow::Div(128位被除数).
+        /// </summary>
+        static constexpr bool NumeratorFits(const Fix64& numerator)
+        {
+            const uint64_t limit = (uint64_t)1 << (63 - Fix64::fractionBits);
+            return (uint64_t)numerator.rawValue + limit < 2 * limit;
+        }
+
+        /// <summary>
+        /// trunc(numerator / divisor.rawValue)，即对rawValue做整数除法.
+        /// </summary>
+        constexpr int64_t DivideRaw(int64_t numerator) const
+        {
+            uint64_t signN = (uint64_t)(numerator >> 63);
+            uint64_t n = ((uint64_t)numerator ^ signN) - signN;
+
+            uint64_t t = MulHigh(magic, n);
+            uint64_t q = (t + ((n - t) >> shift1)) >> shift2;
+
+            uint64_t s = signN ^ sign;
+            return (int64_t)((q ^ s) - s);
+        }
+
+        /// <summary>
+        /// 批量除法：out[i] = numerators[i] / divisor，out可以与numerators相同.
+        /// </summary>
+        void Divide(const Fix64* numerators, Fix64* out, size_t count) const
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                out[i] = Divide(numerators[i]);
+            }
+        }
+
+        friend constexpr Fix64 operator /(const Fix64& a, const Fix64Divisor& d)
+        {
+            return d.Divide(a);
+        }
+
+    private:
+        /// (high << 64) / d，high < d，商不超过64位
+        static constexpr uint64_t DivideHigh(uint64_t high, uint64_t d)
+        {
+#if FIX64_MUL_INT128
+            return (uint64_t)(((unsigned __int128)high << 64) / d);
+#else
+            // 逐位长除法；high < d <= 2^63，high * 2不会溢出
+            uint64_t quotient = 0;
+            for (int i = 0; i < 64; ++i)
+            {
+                high <<= 1;
+                quotient <<= 1;
+                if (high >= d)
+                {
+                    high -= d;
+                    quotient |= 1;
+                }
+            }
+            return quotient;
+#endif
+        }
+
+        /// 无符号64位乘法的高64位
+        static constexpr uint64_t MulHigh(uint64_t a, uint64_t b)
+        {
+#if FIX64_MUL_INT128
+            return (uint64_t)(((unsigned __int128)a * b) >> 64);
+#else
+            uint64_t aLo = (uint32_t)a, aHi = a >> 32;
+            uint64_t bLo = (uint32_t)b, bHi = b >> 32;
+
+            uint64_t ll = aLo * bLo;
+            uint64_t lh = aLo * bHi;
+            uint64_t hl = aHi * bLo;
+            uint64_t hh = aHi * bHi;
+
+            uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+            return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+        }
+    };
+}
+
+#endif /* Fix64Divisor_h */
@@ -0,0 +1,244 @@
+//
+//  Fix64Lut.h
+//  MathLib
+//
+//  编译期生成的三角函数、指数和对数表.
+//
+
+#ifndef Fix64Lut_h
+#define Fix64Lut_h
+
+#include <stdint.h>
+
+namespace FMath
+{
+    /// <summary>
+    /// 编译期使用的double数学函数，只用于生成查表数据.
+    /// 全部由加减乘除构成，不依赖平台的libm，任何编译器生成的表格都完全一致.
+    /// </summary>
+    struct LutMath
+    {
+        static constexpr double PI = 3.14159265358979323846;
+
+        /// x取值[0, π/2]
+        static constexpr double Sin(double x)
+        {
+            double x2 = x * x;
+            double term = x;
+            double sum = x;
+            for (int k = 1; k < 16; ++k)
+            {
+                term = -term * x2 / ((2 * k) * (2 * k + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        /// x取值[0, π/2]
+        static constexpr double Cos(double x)
+        {
+            double x2 = x * x;
+            double term = 1;
+            double sum = 1;
+            for (int k = 1; k < 16; ++k)
+            {
+                term = -term * x2 / ((2 * k - 1) * (2 * k));
+                sum += term;
+            }
+            return sum;
+        }
+
+        /// x取值[0, π/4]
+        static constexpr double Tan(double x)
+        {
+            return Sin(x) / Cos(x);
+        }
+
+        static constexpr double Sqrt(double x)
+        {
+            if (x <= 0)
+            {
+                return 0;
+            }
+
+            double res = x > 1 ? x : 1;
+            for (int i = 0; i < 128; ++i)
+            {
+                double next = (res + x / res) / 2;
+                if (next >= res)
+                {
+                    break;
+                }
+                res = next;
+            }
+            return res;
+        }
+
+        /// x取值[0, 1]
+        /// x > tan(π/8)时：atan(x) = π/4 + atan((x - 1) / (x + 1))，级数的参数不超过tan(π/8)
+        static constexpr double Atan(double x)
+        {
+            double offset = 0;
+            if (x > 0.41421356237309503)
+            {
+                offset = PI / 4;
+                x = (x - 1) / (x + 1);
+            }
+
+            double x2 = x * x;
+            double power = x;
+            double sum = 0;
+            for (int k = 0; k < 40; ++k)
+            {
+                sum += (k % 2 == 0 ? power : -power) / (2 * k + 1);
+                power *= x2;
+            }
+            return offset + sum;
+        }
+
+        /// x取值[0, 1/2]
+        static constexpr double Asin(double x)
+        {
+            return Atan(x / Sqrt(1 - x * x));
+        }
+
+        static constexpr double Ln2 = 0.69314718055994530942;
+
+        /// x取值[0, 1]：2^x = e^(x * ln2)的级数
+        static constexpr double Exp2(double x)
+        {
+            double y = x * Ln2;
+            double term = 1;
+            double sum = 1;
+            for (int k = 1; k < 24; ++k)
+            {
+                term = term * y / k;
+                sum += term;
+            }
+            return sum;
+        }
+
+        /// x取值[0, 1]：ln(1 + x) = 2 * atanh(z)，z = x / (2 + x)不超过1/3
+        static constexpr double Log2OnePlus(double x)
+        {
+            double z = x / (2 + x);
+            double z2 = z * z;
+            double power = z;
+            double sum = 0;
+            for (int k = 0; k < 24; ++k)
+            {
+                sum += power / (2 * k + 1);
+                power *= z2;
+            }
+            return 2 * sum / Ln2;
+        }
+
+        static constexpr int64_t Round(double x)
+        {
+            return x >= 0 ? (int64_t)(x + 0.5) : -(int64_t)(-x + 0.5);
+        }
+    };
+
+    /// <summary>
+    /// 等分查找表：把定义域等分为2^Bits段，存储2^Bits + 1个端点的函数值，
+    /// 函数值按Precision位小数的定点数存储在Storage中.
+    /// 查表位置统一用Q30表示，[0, 2^30]对应整个定义域，相邻两项之间线性插值.
+    /// </summary>
+    template<typename Storage, int Bits, int Precision>
+    struct FixedLut
+    {
+        static constexpr int bits = Bits;
+        static constexpr int precision = Precision;
+        static constexpr int positionBits = 30;
+        static constexpr int size = (1 << Bits) + 1;
+
+        static_assert(Bits > 0 && Bits < positionBits, "FixedLut: Bits must be in (0, 30)");
+
+        Storage values[size];
+
+        /// <summary>
+        /// 线性插值查表.
+        /// </summary>
+        /// <param name="position">Q30，[0, 2^30]</param>
+        /// <returns>Q(Precision)</returns>
+        constexpr int64_t Lerp(int64_t position) const
+        {
+            const int shift = positionBits - Bits;
+
+            // position == 2^30时落在最后一段的末端
+            int64_t index = position >> shift;
+            if (index > size - 2)
+            {
+                index = size - 2;
+            }
+
+            int64_t frac = position - (index << shift);
+            int64_t v0 = values[index];
+            int64_t v1 = values[index + 1];
+
+            return v0 + (((v1 - v0) * frac + ((int64_t)1 << (shift - 1))) >> shift);
+        }
+    };
+
+    /// <summary>
+    /// 在[0, domain]上等分取样生成查找表.
+    /// </summary>
+    template<typename Storage, int Bits, int Precision, typename Func>
+    constexpr FixedLut<Storage, Bits, Precision> MakeLut(Func func, double domain)
+    {
+        FixedLut<Storage, Bits, Precision> lut = {};
+        const double scale = (double)((int64_t)1 << Precision);
+
+        for (int i = 0; i < lut.size; ++i)
+        {
+            double x = domain * i / (lut.size - 1);
+            lut.values[i] = (Storage)LutMath::Round(func(x) * scale);
+        }
+
+        return lut;
+    }
+
+    /// sin(x)，x取值[0, π/2]
+    template<typename Storage, int Bits, int Precision>
+    constexpr FixedLut<Storage, Bits, Precision> MakeSinLut()
+    {
+        return MakeLut<Storage, Bits, Precision>([](double x) { return LutMath::Sin(x); }, LutMath::PI / 2);
+    }
+
+    /// tan(x)，x取值[0, π/4]
+    template<typename Storage, int Bits, int Precision>
+    constexpr FixedLut<Storage, Bits, Precision> MakeTanLut()
+    {
+        return MakeLut<Storage, Bits, Precision>([](double x) { return LutMath::Tan(x); }, LutMath::PI / 4);
+    }
+
+    /// asin(x)，x取值[0, 1/2]
+    template<typename Storage, int Bits, int Precision>
+    constexpr FixedLut<Storage, Bits, Precision> MakeAsinLut()
+    {
+        return MakeLut<Storage, Bits, Precision>([](double x) { return LutMath::Asin(x); }, 0.5);
+    }
+
+    /// atan(x)，x取值[0, 1]
+    template<typename Storage, int Bits, int Precision>
+    constexpr FixedLut<Storage, Bits, Precision> MakeAtanLut()
+    {
+        return MakeLut<Storage, Bits, Precision>([](double x) { return LutMath::Atan(x); }, 1.0);
+    }
+
+    /// 2^x - 1，x取值[0, 1]；减1后值域为[0, 1]，Q30可以存进int32_t
+    template<typename Storage, int Bits, int Precision>
+    constexpr FixedLut<Storage, Bits, Precision> MakeExp2Lut()
+    {
+        return MakeLut<Storage, Bits, Precision>([](double x) { return LutMath::Exp2(x) - 1; }, 1.0);
+    }
+
+    /// log2(1 + x)，x取值[0, 1]
+    template<typename Storage, int Bits, int Precision>
+    constexpr FixedLut<Storage, Bits, Precision> MakeLog2Lut()
+    {
+        return MakeLut<Storage, Bits, Precision>([](double x) { return LutMath::Log2OnePlus(x); }, 1.0);
+    }
+}
+
+#endif /* Fix64Lut_h */
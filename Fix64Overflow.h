@@ -0,0 +1,365 @@
+//
+//  Fix64Overflow.h
+//  MathLib
+//
+//  带溢出处理的定点数：饱和(SatFix64)与检查(CheckedFix64).
+//
+
+#ifndef Fix64Overflow_h
+#define Fix64Overflow_h
+
+#include <cassert>
+#include "Fix64.h"
+
+namespace FMath
+{
+    /// <summary>
+    /// 检测溢出的rawValue运算：结果超出[MinValue, MaxValue]时返回true，
+    /// 否则返回false并通过result输出精确结果(向0截断).
+    /// 乘除法的中间结果按128位计算，不会像Fix64的运算符那样在64位上回绕.
+    /// </summary>
+    struct Fix64Overflow
+    {
+        static constexpr bool Add(int64_t a, int64_t b, int64_t& result)
+        {
+            // 在uint64上计算，避免有符号溢出
+            result = (int64_t)((uint64_t)a + (uint64_t)b);
+            bool wrapped = ((a ^ result) & (b ^ result)) < 0;
+
+            return wrapped || OutOfRange(result);
+        }
+
+        static constexpr bool Sub(int64_t a, int64_t b, int64_t& result)
+        {
+            result = (int64_t)((uint64_t)a - (uint64_t)b);
+            bool wrapped = ((a ^ b) & (a ^ result)) < 0;
+
+            return wrapped || OutOfRange(result);
+        }
+
+        static constexpr bool Mul(int64_t a, int64_t b, int64_t& result)
+        {
+            uint64_t sign = (uint64_t)((a ^ b) >> 63);
+            uint64_t ua = Magnitude(a);
+            uint64_t ub = Magnitude(b);
+
+#if FIX64_MUL_INT128
+            unsigned __int128 product = ((unsigned __int128)ua * ub) >> Fix64::fractionBits;
+            if (product > (unsigned __int128)Fix64::MaxValue.rawValue)
+            {
+                return true;
+            }
+            uint64_t magnitude = (uint64_t)product;
+#else
+            uint64_t aLo = (uint32_t)ua, aHi = ua >> 32;
+            uint64_t bLo = (uint32_t)ub, bHi = ub >> 32;
+
+            uint64_t ll = aLo * bLo;
+            uint64_t lh = aLo * bHi;
+            uint64_t hl = aHi * bLo;
+            uint64_t hh = aHi * bHi;
+
+            uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+            uint64_t lo = (mid << 32) | (uint32_t)ll;
+            uint64_t hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+
+            if ((hi >> Fix64::fractionBits) != 0)
+            {
+                return true;
+            }
+            uint64_t magnitude = (hi << (64 - Fix64::fractionBits)) | (lo >> Fix64::fractionBits);
+            if (magnitude > (uint64_t)Fix64::MaxValue.rawValue)
+            {
+                return true;
+            }
+#endif
+
+            result = (int64_t)((magnitude ^ sign) - sign);
+            return false;
+        }
+
+        /// <summary>
+        /// b为0时也算溢出(0 / 0除外，结果为0).
+        /// </summary>
+        static constexpr bool Div(int64_t a, int64_t b, int64_t& result)
+        {
+            if (b == 0)
+            {
+                result = 0;
+                return a != 0;
+            }
+
+            if (DivOverflows(a, b))
+            {
+                return true;
+            }
+
+            uint64_t sign = (uint64_t)((a ^ b) >> 63);
+            uint64_t ua = Magnitude(a);
+            uint64_t ub = Magnitude(b);
+
+#if FIX64_MUL_INT128
+            uint64_t magnitude = (uint64_t)(((unsigned __int128)ua << Fix64::fractionBits) / ub);
+#else
+            // 整数部分直接除，小数部分逐位长除；remainder < ub <= 2^63，左移1位不会溢出
+            uint64_t magnitude = ua / ub;
+            uint64_t remainder = ua % ub;
+            for (int i = 0; i < Fix64::fractionBits; ++i)
+            {
+                remainder <<= 1;
+                magnitude <<= 1;
+                if (remainder >= ub)
+                {
+                    remainder -= ub;
+                    magnitude |= 1;
+                }
+            }
+#endif
+
+            result = (int64_t)((magnitude ^ sign) - sign);
+            return false;
+        }
+
+        /// <summary>
+        /// 只判断a / b是否溢出，与Div的返回值一致，不做除法.
+        /// </summary>
+        static constexpr bool DivOverflows(int64_t a, int64_t b)
+        {
+            if (b == 0)
+            {
+                return a != 0;
+            }
+
+            uint64_t ua = Magnitude(a);
+            uint64_t ub = Magnitude(b);
+
+            // floor(ua * 2^16 / ub) > MaxValue 等价于 ua >= ub * 2^31
+            const int maxBits = 64 - Fix64::CountLeadingZeros((uint64_t)Fix64::MaxValue.rawValue) - Fix64::fractionBits;
+            return ub < ((uint64_t)1 << (64 - maxBits)) && ua >= (ub << maxBits);
+        }
+
+        static constexpr bool OutOfRange(int64_t rawValue)
+        {
+            return rawValue > Fix64::MaxValue.rawValue || rawValue < Fix64::MinValue.rawValue;
+        }
+
+        static constexpr int64_t Clamp(int64_t rawValue)
+        {
+            return rawValue > Fix64::MaxValue.rawValue ? Fix64::MaxValue.rawValue
+                : (rawValue < Fix64::MinValue.rawValue ? Fix64::MinValue.rawValue : rawValue);
+        }
+
+    private:
+        static constexpr uint64_t Magnitude(int64_t rawValue)
+        {
+            uint64_t sign = (uint64_t)(rawValue >> 63);
+            return ((uint64_t)rawValue ^ sign) - sign;
+        }
+    };
+
+    /// <summary>
+    /// 饱和：溢出时取MaxValue或MinValue.
+    /// </summary>
+    struct SaturatePolicy
+    {
+        static constexpr int64_t OnOverflow(bool negative)
+        {
+            return negative ? Fix64::MinValue.rawValue : Fix64::MaxValue.rawValue;
+        }
+    };
+
+    /// <summary>
+    /// 检查：Debug下溢出时断言失败，Release下与SaturatePolicy一致.
+    /// 含assert，不能在常量表达式中溢出.
+    /// </summary>
+    struct CheckedPolicy
+    {
+        static int64_t OnOverflow(bool negative)
+        {
+            assert(!"Fix64 overflow");
+            return SaturatePolicy::OnOverflow(negative);
+        }
+    };
+
+    /// <summary>
+    /// 按OverflowPolicy处理溢出的定点数，布局与Fix64相同.
+    /// 1.rawValue始终在[MinValue, MaxValue]内，从Fix64构造时截断到这个区间.
+    /// 2.乘除法的中间结果不回绕，结果在区间内时是精确的向0截断.
+    /// 3.除数为0按溢出处理，符号取被除数的符号；0 / 0 = 0.
+    /// 需要回绕(零开销)语义时直接使用Fix64.
+    /// </summary>
+    template<typename OverflowPolicy>
+    struct SafeFix64
+    {
+        int64_t rawValue;
+
+        constexpr SafeFix64() : rawValue(0)
+        {
+        }
+
+        constexpr SafeFix64(int value) : rawValue(Fix64Overflow::Clamp((int64_t)value * Fix64::fractionFactor))
+        {
+        }
+
+        explicit constexpr SafeFix64(const Fix64& value) : rawValue(Fix64Overflow::Clamp(value.rawValue))
+        {
+        }
+
+        explicit constexpr SafeFix64(double value) : SafeFix64(FromDouble(value))
+        {
+        }
+
+        static constexpr SafeFix64 FromRawValue(int64_t rawValue)
+        {
+            return SafeFix64(Fix64::FromRawValue(rawValue));
+        }
+
+        constexpr Fix64 ToFix64() const
+        {
+            return Fix64::FromRawValue(rawValue);
+        }
+
+        explicit constexpr operator Fix64() const
+        {
+            return ToFix64();
+        }
+
+        constexpr double ToDouble() const
+        {
+            return ToFix64().ToDouble();
+        }
+
+        constexpr SafeFix64 operator -() const
+        {
+            // 区间是对称的，取反不会溢出
+            return Raw(-rawValue);
+        }
+
+        friend constexpr SafeFix64 operator +(const SafeFix64& a, const SafeFix64& b)
+        {
+            int64_t result = 0;
+            if (Fix64Overflow::Add(a.rawValue, b.rawValue, result))
+            {
+                // 操作数都在区间内，和不会在64位上回绕，符号就是溢出的方向
+                return Raw(OverflowPolicy::OnOverflow(result < 0));
+            }
+            return Raw(result);
+        }
+
+        friend constexpr SafeFix64 operator -(const SafeFix64& a, const SafeFix64& b)
+        {
+            int64_t result = 0;
+            if (Fix64Overflow::Sub(a.rawValue, b.rawValue, result))
+            {
+                return Raw(OverflowPolicy::OnOverflow(result < 0));
+            }
+            return Raw(result);
+        }
+
+        friend constexpr SafeFix64 operator *(const SafeFix64& a, const SafeFix64& b)
+        {
+            int64_t result = 0;
+            if (Fix64Overflow::Mul(a.rawValue, b.rawValue, result))
+            {
+                return Raw(OverflowPolicy::OnOverflow((a.rawValue < 0) != (b.rawValue < 0)));
+            }
+            return Raw(result);
+        }
+
+        friend constexpr SafeFix64 operator /(const SafeFix64& a, const SafeFix64& b)
+        {
+            int64_t result = 0;
+            if (Fix64Overflow::Div(a.rawValue, b.rawValue, result))
+            {
+                return Raw(OverflowPolicy::OnOverflow((a.rawValue < 0) != (b.rawValue < 0)));
+            }
+            return Raw(result);
+        }
+
+        friend constexpr const SafeFix64& operator +=(SafeFix64& a, const SafeFix64& b)
+        {
+            a = a + b;
+            return a;
+        }
+
+        friend constexpr const SafeFix64& operator -=(SafeFix64& a, const SafeFix64& b)
+        {
+            a = a - b;
+            return a;
+        }
+
+        friend constexpr const SafeFix64& operator *=(SafeFix64& a, const SafeFix64& b)
+        {
+            a = a * b;
+            return a;
+        }
+
+        friend constexpr const SafeFix64& operator /=(SafeFix64& a, const SafeFix64& b)
+        {
+            a = a / b;
+            return a;
+        }
+
+        friend constexpr bool operator ==(const SafeFix64& a, const SafeFix64& b)
+        {
+            return a.rawValue == b.rawValue;
+        }
+
+        friend constexpr bool operator !=(const SafeFix64& a, const SafeFix64& b)
+        {
+            return a.rawValue != b.rawValue;
+        }
+
+        friend constexpr bool operator >(const SafeFix64& a, const SafeFix64& b)
+        {
+            return a.rawValue > b.rawValue;
+        }
+
+        friend constexpr bool operator >=(const SafeFix64& a, const SafeFix64& b)
+        {
+            return a.rawValue >= b.rawValue;
+        }
+
+        friend constexpr bool operator <(const SafeFix64& a, const SafeFix64& b)
+        {
+            return a.rawValue < b.rawValue;
+        }
+
+        friend constexpr bool operator <=(const SafeFix64& a, const SafeFix64& b)
+        {
+            return a.rawValue <= b.rawValue;
+        }
+
+    private:
+        /// 不做截断，调用方保证rawValue在区间内
+        static constexpr SafeFix64 Raw(int64_t rawValue)
+        {
+            SafeFix64 ret;
+            ret.rawValue = rawValue;
+            return ret;
+        }
+
+        static constexpr SafeFix64 FromDouble(double value)
+        {
+            // 先在double上比较，避免超出int64的转换
+            const double limit = (double)Fix64::MaxValue.rawValue / Fix64::fractionFactor;
+            if (value >= limit)
+            {
+                return Raw(Fix64::MaxValue.rawValue);
+            }
+            if (value <= -limit)
+            {
+                return Raw(Fix64::MinValue.rawValue);
+            }
+            return Raw(Fix64(value).rawValue);
+        }
+    };
+
+    typedef SafeFix64<SaturatePolicy> SatFix64;
+    typedef SafeFix64<CheckedPolicy> CheckedFix64;
+
+    static_assert(std::is_trivially_copyable<SatFix64>::value, "SatFix64 must be trivially copyable");
+    static_assert(sizeof(SatFix64) == sizeof(Fix64), "SatFix64 must have the same layout as Fix64");
+}
+
+#endif /* Fix64Overflow_h */
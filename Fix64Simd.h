@@ -0,0 +1,138 @@
+//
+//  Fix64Simd.h
+//  MathLib
+//
+//  批量运算共用的AVX2工具函数，只在.cpp中包含.
+//
+
+#ifndef Fix64Simd_h
+#define Fix64Simd_h
+
+#include "Fix64.h"
+
+/// GCC/Clang的x86目标上用target属性单独编译AVX2函数，运行时再按CPU选择，
+/// 其他编译器和平台只使用标量实现.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define FIX64_SIMD_AVX2 1
+#include <immintrin.h>
+#define FIX64_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define FIX64_SIMD_AVX2 0
+#endif
+
+namespace FMath
+{
+    namespace Simd
+    {
+        /// <summary>
+        /// 当前CPU是否支持AVX2.
+        /// </summary>
+        inline bool Avx2Supported()
+        {
+#if FIX64_SIMD_AVX2
+            // 静态初始化阶段也会调用，需要先初始化CPU信息
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+#else
+            return false;
+#endif
+        }
+
+#if FIX64_SIMD_AVX2
+        /// <summary>
+        /// 4路Fix64::Mul：AVX2没有64位乘法，按可移植实现的方式用4次32x32->64位乘法拼出128位乘积，
+        /// 对绝对值右移(向0截断)后恢复符号，结果与Fix64::Mul逐位一致.
+        /// </summary>
+        FIX64_TARGET_AVX2 inline __m256i Mul4(__m256i a, __m256i b)
+        {
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i mask32 = _mm256_set1_epi64x(0xFFFFFFFFLL);
+
+            __m256i signA = _mm256_cmpgt_epi64(zero, a);
+            __m256i signB = _mm256_cmpgt_epi64(zero, b);
+            __m256i ua = _mm256_sub_epi64(_mm256_xor_si256(a, signA), signA);
+            __m256i ub = _mm256_sub_epi64(_mm256_xor_si256(b, signB), signB);
+            __m256i sign = _mm256_xor_si256(signA, signB);
+
+            __m256i aHi = _mm256_srli_epi64(ua, 32);
+            __m256i bHi = _mm256_srli_epi64(ub, 32);
+
+            // _mm256_mul_epu32只取每个64位元素的低32位
+            __m256i ll = _mm256_mul_epu32(ua, ub);
+            __m256i lh = _mm256_mul_epu32(ua, bHi);
+            __m256i hl = _mm256_mul_epu32(aHi, ub);
+            __m256i hh = _mm256_mul_epu32(aHi, bHi);
+
+            __m256i mid = _mm256_add_epi64(_mm256_srli_epi64(ll, 32),
+                          _mm256_add_epi64(_mm256_and_si256(lh, mask32), _mm256_and_si256(hl, mask32)));
+            __m256i lo = _mm256_or_si256(_mm256_slli_epi64(mid, 32), _mm256_and_si256(ll, mask32));
+            __m256i hi = _mm256_add_epi64(_mm256_add_epi64(hh, _mm256_srli_epi64(lh, 32)),
+                         _mm256_add_epi64(_mm256_srli_epi64(hl, 32), _mm256_srli_epi64(mid, 32)));
+
+            __m256i magnitude = _mm256_or_si256(_mm256_slli_epi64(hi, 64 - Fix64::fractionBits),
+                                                _mm256_srli_epi64(lo, Fix64::fractionBits));
+
+            return _mm256_sub_epi64(_mm256_xor_si256(magnitude, sign), sign);
+        }
+
+        FIX64_TARGET_AVX2 inline __m256i Load4(const int64_t* p)
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        }
+
+        FIX64_TARGET_AVX2 inline void Store4(int64_t* p, __m256i v)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+        }
+
+        /// <summary>
+        /// 4个连续的FVector3(12个int64_t，AoS)转成x、y、z三个向量.
+        /// </summary>
+        FIX64_TARGET_AVX2 inline void LoadTranspose3x4(const int64_t* p, __m256i& x, __m256i& y, __m256i& z)
+        {
+            // v0 = [x0 y0 z0 x1], v1 = [y1 z1 x2 y2], v2 = [z2 x3 y3 z3]
+            __m256i v0 = Load4(p);
+            __m256i v1 = Load4(p + 4);
+            __m256i v2 = Load4(p + 8);
+
+            // 先按元素所在的位置混合，再重排；三次重排都是对合(自逆)的
+            x = _mm256_permute4x64_epi64(_mm256_blend_epi32(_mm256_blend_epi32(v0, v1, 0x30), v2, 0x0C), 0x6C);
+            y = _mm256_permute4x64_epi64(_mm256_blend_epi32(_mm256_blend_epi32(v0, v1, 0xC3), v2, 0x30), 0xB1);
+            z = _mm256_permute4x64_epi64(_mm256_blend_epi32(_mm256_blend_epi32(v0, v1, 0x0C), v2, 0xC3), 0xC6);
+        }
+
+        /// <summary>
+        /// LoadTranspose3x4的逆操作.
+        /// </summary>
+        FIX64_TARGET_AVX2 inline void StoreTranspose3x4(int64_t* p, __m256i x, __m256i y, __m256i z)
+        {
+            // a = [x0 x3 x2 x1], b = [y1 y0 y3 y2], c = [z2 z1 z0 z3]
+            __m256i a = _mm256_permute4x64_epi64(x, 0x6C);
+            __m256i b = _mm256_permute4x64_epi64(y, 0xB1);
+            __m256i c = _mm256_permute4x64_epi64(z, 0xC6);
+
+            Store4(p, _mm256_blend_epi32(_mm256_blend_epi32(a, b, 0x0C), c, 0x30));
+            Store4(p + 4, _mm256_blend_epi32(_mm256_blend_epi32(b, c, 0x0C), a, 0x30));
+            Store4(p + 8, _mm256_blend_epi32(_mm256_blend_epi32(c, a, 0x0C), b, 0x30));
+        }
+
+        /// <summary>
+        /// 4x4的int64_t矩阵转置：4个连续的FVector4与x、y、z、w四个向量互转.
+        /// </summary>
+        FIX64_TARGET_AVX2 inline void Transpose4x4(__m256i& r0, __m256i& r1, __m256i& r2, __m256i& r3)
+        {
+            __m256i t0 = _mm256_unpacklo_epi64(r0, r1);
+            __m256i t1 = _mm256_unpackhi_epi64(r0, r1);
+            __m256i t2 = _mm256_unpacklo_epi64(r2, r3);
+            __m256i t3 = _mm256_unpackhi_epi64(r2, r3);
+
+            r0 = _mm256_permute2x128_si256(t0, t2, 0x20);
+            r1 = _mm256_permute2x128_si256(t1, t3, 0x20);
+            r2 = _mm256_permute2x128_si256(t0, t2, 0x31);
+            r3 = _mm256_permute2x128_si256(t1, t3, 0x31);
+        }
+#endif
+    }
+}
+
+#endif /* Fix64Simd_h */
@@ -1,12873 +0,0 @@
-#include "Fix64.h"
-using namespace FMath;
-int64_t Fix64::sintable[] = {
-     0L,1L,2L,3L,4L,5L,6L,7L,
-     8L,9L,10L,11L,12L,13L,14L,15L,
-     16L,17L,18L,19L,20L,21L,22L,23L,
-     24L,25L,26L,27L,28L,29L,30L,31L,
-     32L,33L,34L,35L,36L,37L,38L,39L,
-     40L,41L,42L,43L,44L,45L,46L,47L,
-     48L,49L,50L,51L,52L,53L,54L,55L,
-     56L,57L,58L,59L,60L,61L,62L,63L,
-     64L,65L,66L,67L,68L,69L,70L,71L,
-     72L,73L,74L,75L,76L,77L,78L,79L,
-     80L,81L,82L,83L,84L,85L,86L,87L,
-     88L,89L,90L,91L,92L,93L,94L,95L,
-     96L,97L,98L,99L,100L,101L,102L,103L,
-     104L,105L,106L,107L,108L,109L,110L,111L,
-     112L,113L,114L,115L,116L,117L,118L,119L,
-     120L,121L,122L,123L,124L,125L,126L,127L,
-     128L,129L,130L,131L,132L,133L,134L,135L,
-     136L,137L,138L,139L,140L,141L,142L,143L,
-     144L,145L,146L,147L,148L,149L,150L,151L,
-     152L,153L,154L,155L,156L,157L,158L,159L,
-     160L,161L,162L,163L,164L,165L,166L,167L,
-     168L,169L,170L,171L,172L,173L,174L,175L,
-     176L,177L,178L,179L,180L,181L,182L,183L,
-     184L,185L,186L,187L,188L,189L,190L,191L,
-     192L,193L,194L,195L,196L,197L,198L,199L,
-     200L,201L,202L,203L,204L,205L,206L,207L,
-     208L,209L,210L,211L,212L,213L,214L,215L,
-     216L,217L,218L,219L,220L,221L,222L,223L,
-     224L,225L,226L,227L,228L,229L,230L,231L,
-     232L,233L,234L,235L,236L,237L,238L,239L,
-     240L,241L,242L,243L,244L,245L,246L,247L,
-     248L,249L,250L,251L,252L,253L,254L,255L,
-     256L,257L,258L,259L,260L,261L,262L,263L,
-     264L,265L,266L,267L,268L,269L,270L,271L,
-     272L,273L,274L,275L,276L,277L,278L,279L,
-     280L,281L,282L,283L,284L,285L,286L,287L,
-     288L,289L,290L,291L,292L,293L,294L,295L,
-     296L,297L,298L,299L,300L,301L,302L,303L,
-     304L,305L,306L,307L,308L,309L,310L,311L,
-     312L,313L,314L,315L,316L,317L,318L,319L,
-     320L,321L,322L,323L,324L,325L,326L,327L,
-     328L,329L,330L,331L,332L,333L,334L,335L,
-     336L,337L,338L,339L,340L,341L,342L,343L,
-     344L,345L,346L,347L,348L,349L,350L,351L,
-     352L,353L,354L,355L,356L,357L,358L,359L,
-     360L,361L,362L,363L,364L,365L,366L,367L,
-     368L,369L,370L,371L,372L,373L,374L,375L,
-     376L,377L,378L,379L,380L,381L,382L,383L,
-     384L,385L,386L,387L,388L,389L,390L,391L,
-     392L,393L,394L,395L,396L,397L,398L,399L,
-     400L,401L,402L,403L,404L,405L,406L,407L,
-     408L,409L,410L,411L,412L,413L,414L,415L,
-     416L,417L,418L,419L,420L,421L,421L,422L,
-     423L,424L,425L,426L,427L,428L,429L,430L,
-     431L,432L,433L,434L,435L,436L,437L,438L,
-     439L,440L,441L,442L,443L,444L,445L,446L,
-     447L,448L,449L,450L,451L,452L,453L,454L,
-     455L,456L,457L,458L,459L,460L,461L,462L,
-     463L,464L,465L,466L,467L,468L,469L,470L,
-     471L,472L,473L,474L,475L,476L,477L,478L,
-     479L,480L,481L,482L,483L,484L,485L,486L,
-     487L,488L,489L,490L,491L,492L,493L,494L,
-     495L,496L,497L,498L,499L,500L,501L,502L,
-     503L,504L,505L,506L,507L,508L,509L,510L,
-     511L,512L,513L,514L,515L,516L,517L,518L,
-     519L,520L,521L,522L,523L,524L,525L,526L,
-     527L,528L,529L,530L,531L,532L,533L,534L,
-     535L,536L,537L,538L,539L,540L,541L,542L,
-     543L,544L,545L,546L,547L,548L,549L,550L,
-     551L,552L,553L,554L,555L,556L,557L,558L,
-     559L,560L,561L,562L,563L,564L,565L,566L,
-     567L,568L,569L,570L,571L,572L,573L,574L,
-     575L,576L,577L,578L,579L,580L,581L,582L,
-     583L,584L,585L,586L,587L,588L,589L,590L,
-     591L,592L,593L,594L,595L,596L,597L,598L,
-     599L,600L,601L,602L,603L,604L,605L,606L,
-     607L,608L,609L,610L,611L,612L,613L,614L,
-     615L,616L,617L,618L,619L,620L,621L,622L,
-     623L,624L,625L,626L,627L,628L,629L,630L,
-     631L,632L,633L,634L,635L,636L,637L,638L,
-     639L,640L,641L,642L,643L,644L,645L,646L,
-     647L,648L,649L,650L,651L,652L,653L,654L,
-     655L,656L,657L,658L,659L,660L,661L,662L,
-     663L,664L,665L,666L,667L,668L,669L,670L,
-     671L,672L,673L,674L,675L,676L,677L,678L,
-     679L,680L,681L,682L,683L,684L,685L,686L,
-     687L,688L,689L,690L,691L,692L,693L,694L,
-     695L,696L,697L,698L,699L,700L,701L,702L,
-     703L,704L,705L,706L,707L,708L,709L,710L,
-     711L,712L,713L,714L,715L,716L,717L,718L,
-     719L,720L,721L,722L,723L,724L,725L,726L,
-     727L,728L,729L,730L,731L,732L,733L,734L,
-     735L,736L,737L,738L,739L,740L,741L,742L,
-     743L,744L,745L,746L,747L,748L,749L,750L,
-     751L,752L,753L,754L,755L,756L,757L,758L,
-     759L,760L,761L,762L,763L,764L,765L,766L,
-     767L,768L,769L,770L,771L,772L,773L,774L,
-     775L,776L,777L,778L,779L,780L,781L,782L,
-     783L,784L,785L,786L,787L,788L,789L,790L,
-     791L,792L,793L,794L,795L,796L,797L,798L,
-     799L,800L,801L,802L,803L,804L,805L,806L,
-     807L,808L,809L,810L,811L,812L,813L,814L,
-     815L,816L,817L,818L,819L,820L,821L,822L,
-     823L,824L,825L,826L,827L,828L,829L,830L,
-     831L,832L,833L,834L,835L,836L,837L,838L,
-     839L,840L,841L,842L,843L,844L,845L,846L,
-     847L,848L,849L,850L,851L,852L,853L,854L,
-     855L,856L,857L,858L,859L,860L,861L,862L,
-     863L,864L,865L,866L,867L,868L,869L,870L,
-     871L,872L,873L,874L,875L,876L,877L,878L,
-     879L,880L,881L,882L,883L,884L,885L,886L,
-     887L,888L,889L,890L,891L,892L,893L,894L,
-     895L,896L,897L,898L,899L,900L,901L,902L,
-     903L,904L,905L,906L,907L,908L,909L,910L,
-     911L,912L,913L,914L,915L,916L,917L,918L,
-     919L,920L,921L,922L,923L,924L,925L,926L,
-     927L,928L,929L,930L,931L,932L,933L,934L,
-     935L,936L,937L,938L,939L,940L,941L,942L,
-     943L,944L,945L,946L,947L,948L,949L,950L,
-     951L,952L,953L,954L,955L,956L,957L,958L,
-     959L,960L,961L,962L,963L,964L,965L,966L,
-     967L,968L,969L,970L,971L,972L,973L,974L,
-     975L,976L,977L,978L,979L,980L,981L,982L,
-     983L,984L,985L,986L,987L,988L,989L,990L,
-     991L,992L,993L,994L,995L,996L,997L,998L,
-     999L,1000L,1001L,1002L,1003L,1004L,1005L,1006L,
-     1007L,1008L,1009L,1010L,1011L,1012L,1013L,1014L,
-     1015L,1016L,1017L,1018L,1019L,1020L,1021L,1022L,
-     1023L,1024L,1025L,1026L,1027L,1028L,1029L,1030L,
-     1031L,1032L,1033L,1034L,1035L,1036L,1037L,1038L,
-     1039L,1040L,1041L,1042L,1043L,1044L,1045L,1046L,
-     1047L,1048L,1049L,1050L,1051L,1052L,1053L,1054L,
-     1055L,1056L,1057L,1058L,1059L,1060L,1061L,1062L,
-     1063L,1064L,1065L,1066L,1067L,1068L,1069L,1070L,
-     1071L,1072L,1073L,1074L,1075L,1076L,1077L,1078L,
-     1079L,1080L,1081L,1082L,1083L,1084L,1085L,1086L,
-     1087L,1088L,1089L,1090L,1091L,1092L,1093L,1094L,
-     1095L,1096L,1097L,1098L,1099L,1100L,1101L,1102L,
-     1103L,1104L,1105L,1106L,1107L,1108L,1109L,1110L,
-     1111L,1112L,1113L,1114L,1115L,1116L,1117L,1118L,
-     1119L,1120L,1121L,1122L,1123L,1124L,1125L,1126L,
-     1127L,1128L,1129L,1130L,1131L,1132L,1133L,1134L,
-     1135L,1136L,1137L,1138L,1139L,1140L,1141L,1142L,
-     1143L,1144L,1145L,1146L,1147L,1148L,1149L,1150L,
-     1151L,1152L,1153L,1154L,1155L,1156L,1157L,1158L,
-     1159L,1160L,1161L,1162L,1163L,1164L,1165L,1166L,
-     1167L,1168L,1169L,1170L,1171L,1172L,1173L,1174L,
-     1175L,1176L,1177L,1178L,1179L,1180L,1181L,1182L,
-     1183L,1184L,1185L,1186L,1187L,1188L,1189L,1190L,
-     1191L,1192L,1193L,1194L,1195L,1196L,1197L,1198L,
-     1199L,1200L,1201L,1202L,1203L,1204L,1205L,1206L,
-     1207L,1208L,1209L,1210L,1211L,1212L,1213L,1214L,
-     1215L,1216L,1217L,1218L,1219L,1220L,1221L,1222L,
-     1223L,1224L,1225L,1226L,1227L,1228L,1229L,1230L,
-     1231L,1232L,1233L,1234L,1235L,1236L,1237L,1238L,
-     1239L,1240L,1241L,1242L,1243L,1244L,1245L,1246L,
-     1247L,1248L,1249L,1250L,1251L,1252L,1253L,1254L,
-     1255L,1256L,1257L,1258L,1259L,1260L,1261L,1262L,
-     1263L,1264L,1265L,1266L,1267L,1268L,1269L,1270L,
-     1271L,1272L,1273L,1274L,1275L,1276L,1277L,1278L,
-     1279L,1280L,1281L,1282L,1283L,1284L,1285L,1286L,
-     1287L,1288L,1289L,1290L,1291L,1292L,1293L,1294L,
-     1295L,1296L,1297L,1298L,1299L,1300L,1301L,1302L,
-     1303L,1304L,1305L,1306L,1307L,1308L,1309L,1310L,
-     1311L,1312L,1313L,1314L,1315L,1316L,1317L,1318L,
-     1319L,1320L,1321L,1322L,1323L,1324L,1325L,1326L,
-     1327L,1328L,1329L,1330L,1331L,1332L,1333L,1334L,
-     1335L,1336L,1337L,1338L,1339L,1340L,1341L,1342L,
-     1343L,1344L,1345L,1346L,1347L,1348L,1349L,1350L,
-     1351L,1352L,1353L,1354L,1355L,1356L,1357L,1358L,
-     1359L,1360L,1361L,1362L,1363L,1364L,1365L,1366L,
-     1367L,1368L,1369L,1370L,1371L,1372L,1373L,1374L,
-     1375L,1376L,1377L,1378L,1379L,1380L,1381L,1382L,
-     1383L,1384L,1385L,1386L,1387L,1388L,1389L,1390L,
-     1391L,1392L,1393L,1394L,1395L,1396L,1397L,1398L,
-     1399L,1400L,1401L,1402L,1403L,1404L,1405L,1406L,
-     1407L,1408L,1409L,1410L,1411L,1412L,1413L,1414L,
-     1415L,1416L,1417L,1418L,1419L,1420L,1421L,1422L,
-     1423L,1424L,1425L,1426L,1427L,1428L,1429L,1430L,
-     1431L,1432L,1433L,1434L,1435L,1436L,1437L,1438L,
-     1439L,1440L,1441L,1442L,1443L,1444L,1445L,1446L,
-     1447L,1448L,1449L,1450L,1451L,1452L,1453L,1454L,
-     1455L,1456L,1457L,1458L,1459L,1460L,1461L,1462L,
-     1463L,1464L,1465L,1466L,1467L,1468L,1469L,1470L,
-     1471L,1472L,1473L,1474L,1475L,1476L,1477L,1478L,
-     1479L,1480L,1481L,1482L,1483L,1484L,1485L,1486L,
-     1487L,1488L,1489L,1490L,1491L,1492L,1493L,1494L,
-     1495L,1496L,1497L,1498L,1499L,1500L,1501L,1502L,
-     1503L,1504L,1505L,1506L,1507L,1508L,1509L,1510L,
-     1511L,1512L,1513L,1514L,1515L,1516L,1517L,1518L,
-     1519L,1520L,1521L,1522L,1523L,1524L,1525L,1526L,
-     1527L,1528L,1529L,1530L,1531L,1532L,1533L,1534L,
-     1535L,1536L,1537L,1538L,1539L,1540L,1541L,1542L,
-     1543L,1544L,1545L,1546L,1547L,1548L,1549L,1550L,
-     1551L,1552L,1553L,1554L,1555L,1556L,1557L,1558L,
-     1559L,1560L,1561L,1562L,1563L,1564L,1565L,1566L,
-     1567L,1568L,1569L,1570L,1571L,1572L,1573L,1574L,
-     1575L,1576L,1577L,1578L,1579L,1580L,1581L,1582L,
-     1583L,1584L,1585L,1586L,1587L,1588L,1589L,1590L,
-     1591L,1592L,1593L,1594L,1595L,1596L,1597L,1598L,
-     1599L,1600L,1601L,1602L,1603L,1604L,1605L,1606L,
-     1607L,1608L,1609L,1610L,1611L,1612L,1613L,1614L,
-     1615L,1616L,1617L,1618L,1619L,1620L,1621L,1622L,
-     1623L,1624L,1625L,1626L,1627L,1628L,1629L,1630L,
-     1631L,1632L,1633L,1634L,1635L,1636L,1637L,1638L,
-     1639L,1640L,1641L,1642L,1643L,1644L,1645L,1646L,
-     1647L,1648L,1649L,1650L,1651L,1652L,1653L,1654L,
-     1655L,1656L,1657L,1658L,1659L,1660L,1661L,1662L,
-     1663L,1664L,1665L,1666L,1667L,1668L,1669L,1670L,
-     1671L,1672L,1673L,1674L,1675L,1676L,1677L,1678L,
-     1679L,1680L,1681L,1682L,1683L,1684L,1685L,1686L,
-     1687L,1688L,1689L,1690L,1691L,1692L,1693L,1694L,
-     1695L,1696L,1697L,1698L,1699L,1700L,1701L,1702L,
-     1703L,1704L,1705L,1706L,1707L,1708L,1709L,1710L,
-     1711L,1712L,1713L,1714L,1715L,1716L,1717L,1718L,
-     1719L,1720L,1721L,1722L,1723L,1724L,1725L,1726L,
-     1727L,1728L,1729L,1730L,1731L,1732L,1733L,1734L,
-     1735L,1736L,1737L,1738L,1739L,1740L,1741L,1742L,
-     1743L,1744L,1745L,1746L,1747L,1748L,1749L,1750L,
-     1751L,1752L,1753L,1754L,1755L,1756L,1757L,1758L,
-     1759L,1760L,1761L,1762L,1763L,1764L,1765L,1766L,
-     1767L,1768L,1769L,1770L,1771L,1772L,1773L,1774L,
-     1775L,1776L,1777L,1778L,1779L,1780L,1781L,1782L,
-     1783L,1784L,1785L,1786L,1787L,1788L,1789L,1790L,
-     1791L,1792L,1793L,1794L,1795L,1796L,1797L,1798L,
-     1799L,1800L,1801L,1802L,1803L,1804L,1805L,1806L,
-     1807L,1808L,1809L,1810L,1811L,1812L,1813L,1814L,
-     1815L,1816L,1817L,1818L,1819L,1820L,1821L,1822L,
-     1823L,1824L,1825L,1826L,1827L,1828L,1829L,1830L,
-     1831L,1832L,1833L,1834L,1835L,1836L,1837L,1838L,
-     1839L,1840L,1841L,1842L,1843L,1844L,1845L,1846L,
-     1847L,1848L,1849L,1850L,1851L,1852L,1853L,1854L,
-     1855L,1856L,1857L,1858L,1859L,1860L,1861L,1862L,
-     1863L,1864L,1865L,1866L,1867L,1868L,1869L,1870L,
-     1871L,1872L,1873L,1874L,1875L,1876L,1877L,1878L,
-     1879L,1880L,1881L,1882L,1883L,1884L,1885L,1886L,
-     1887L,1888L,1889L,1890L,1891L,1892L,1893L,1894L,
-     1895L,1896L,1897L,1898L,1899L,1900L,1901L,1902L,
-     1903L,1904L,1905L,1906L,1907L,1908L,1909L,1910L,
-     1911L,1912L,1913L,1914L,1915L,1916L,1917L,1918L,
-     1919L,1920L,1921L,1922L,1923L,1924L,1925L,1926L,
-     1927L,1928L,1929L,1930L,1931L,1932L,1933L,1934L,
-     1935L,1936L,1937L,1938L,1939L,1940L,1941L,1942L,
-     1943L,1944L,1945L,1946L,1947L,1948L,1949L,1950L,
-     1951L,1952L,1953L,1954L,1955L,1956L,1957L,1958L,
-     1959L,1960L,1961L,1962L,1963L,1964L,1965L,1966L,
-     1967L,1968L,1969L,1970L,1971L,1972L,1973L,1974L,
-     1975L,1976L,1977L,1978L,1979L,1980L,1981L,1982L,
-     1983L,1984L,1985L,1986L,1987L,1988L,1989L,1990L,
-     1991L,1992L,1993L,1994L,1995L,1996L,1997L,1998L,
-     1999L,2000L,2001L,2002L,2003L,2004L,2005L,2006L,
-     2007L,2008L,2009L,2010L,2011L,2012L,2013L,2014L,
-     2015L,2016L,2017L,2018L,2019L,2020L,2021L,2022L,
-     2023L,2024L,2025L,2026L,2027L,2028L,2029L,2030L,
-     2031L,2032L,2033L,2034L,2035L,2036L,2037L,2038L,
-     2039L,2040L,2041L,2042L,2043L,2044L,2045L,2046L,
-     2047L,2048L,2049L,2050L,2051L,2052L,2053L,2054L,
-     2055L,2056L,2057L,2058L,2059L,2060L,2061L,2062L,
-     2063L,2064L,2065L,2066L,2067L,2068L,2069L,2070L,
-     2071L,2072L,2073L,2074L,2075L,2076L,2077L,2078L,
-     2079L,2080L,2081L,2082L,2083L,2084L,2085L,2086L,
-     2087L,2088L,2089L,2090L,2091L,2092L,2093L,2094L,
-     2095L,2096L,2097L,2098L,2099L,2100L,2101L,2102L,
-     2103L,2104L,2105L,2106L,2107L,2108L,2109L,2110L,
-     2111L,2112L,2113L,2114L,2115L,2116L,2117L,2118L,
-     2119L,2120L,2121L,2122L,2123L,2124L,2125L,2126L,
-     2127L,2128L,2129L,2130L,2131L,2132L,2133L,2134L,
-     2135L,2136L,2137L,2138L,2139L,2140L,2141L,2142L,
-     2143L,2144L,2145L,2146L,2147L,2148L,2149L,2150L,
-     2151L,2152L,2153L,2154L,2155L,2156L,2157L,2158L,
-     2159L,2160L,2161L,2162L,2163L,2164L,2165L,2166L,
-     2167L,2168L,2169L,2170L,2171L,2172L,2173L,2174L,
-     2175L,2176L,2177L,2178L,2179L,2180L,2181L,2182L,
-     2183L,2184L,2185L,2186L,2187L,2188L,2189L,2190L,
-     2191L,2192L,2193L,2194L,2195L,2196L,2197L,2198L,
-     2199L,2200L,2201L,2202L,2203L,2204L,2205L,2206L,
-     2207L,2208L,2209L,2210L,2211L,2212L,2213L,2214L,
-     2215L,2216L,2217L,2218L,2219L,2220L,2221L,2222L,
-     2223L,2224L,2225L,2226L,2227L,2228L,2229L,2230L,
-     2231L,2232L,2233L,2234L,2235L,2236L,2237L,2238L,
-     2239L,2240L,2241L,2242L,2243L,2244L,2245L,2246L,
-     2247L,2248L,2249L,2250L,2251L,2252L,2253L,2254L,
-     2255L,2256L,2257L,2258L,2259L,2260L,2261L,2262L,
-     2263L,2264L,2265L,2266L,2267L,2268L,2269L,2270L,
-     2271L,2272L,2273L,2274L,2275L,2276L,2277L,2278L,
-     2279L,2280L,2281L,2282L,2283L,2284L,2285L,2286L,
-     2287L,2288L,2289L,2290L,2291L,2292L,2293L,2294L,
-     2295L,2296L,2297L,2298L,2299L,2300L,2301L,2302L,
-     2303L,2304L,2305L,2306L,2307L,2308L,2309L,2310L,
-     2311L,2312L,2313L,2314L,2315L,2316L,2317L,2318L,
-     2319L,2320L,2321L,2322L,2323L,2324L,2325L,2326L,
-     2327L,2328L,2329L,2330L,2331L,2332L,2333L,2334L,
-     2335L,2336L,2337L,2338L,2339L,2340L,2341L,2342L,
-     2343L,2344L,2345L,2346L,2347L,2348L,2349L,2350L,
-     2351L,2352L,2353L,2354L,2355L,2356L,2357L,2358L,
-     2359L,2360L,2361L,2362L,2363L,2364L,2365L,2366L,
-     2367L,2368L,2369L,2370L,2371L,2372L,2373L,2374L,
-     2375L,2376L,2377L,2378L,2379L,2380L,2381L,2382L,
-     2383L,2384L,2385L,2386L,2387L,2388L,2389L,2390L,
-     2391L,2392L,2393L,2394L,2395L,2396L,2397L,2398L,
-     2399L,2400L,2401L,2402L,2403L,2404L,2405L,2406L,
-     2407L,2408L,2409L,2410L,2411L,2412L,2413L,2414L,
-     2415L,2416L,2417L,2418L,2419L,2420L,2421L,2422L,
-     2423L,2424L,2425L,2426L,2427L,2428L,2429L,2430L,
-     2431L,2432L,2433L,2434L,2435L,2436L,2437L,2438L,
-     2439L,2440L,2441L,2442L,2443L,2444L,2445L,2446L,
-     2447L,2448L,2449L,2450L,2451L,2452L,2453L,2454L,
-     2455L,2456L,2457L,2458L,2459L,2460L,2461L,2462L,
-     2463L,2464L,2465L,2466L,2467L,2468L,2469L,2470L,
-     2471L,2472L,2473L,2474L,2475L,2476L,2477L,2478L,
-     2479L,2480L,2481L,2482L,2483L,2484L,2485L,2486L,
-     2487L,2488L,2489L,2490L,2491L,2492L,2493L,2494L,
-     2495L,2496L,2497L,2498L,2499L,2500L,2501L,2502L,
-     2503L,2504L,2505L,2506L,2507L,2508L,2509L,2510L,
-     2511L,2512L,2513L,2514L,2515L,2516L,2517L,2518L,
-     2519L,2520L,2521L,2522L,2523L,2524L,2525L,2526L,
-     2527L,2528L,2529L,2530L,2531L,2532L,2533L,2534L,
-     2535L,2536L,2537L,2538L,2539L,2540L,2541L,2542L,
-     2543L,2544L,2545L,2546L,2547L,2548L,2549L,2550L,
-     2551L,2552L,2553L,2554L,2555L,2556L,2557L,2558L,
-     2559L,2560L,2561L,2562L,2563L,2564L,2565L,2566L,
-     2567L,2568L,2569L,2570L,2571L,2572L,2573L,2574L,
-     2575L,2576L,2577L,2578L,2579L,2580L,2581L,2582L,
-     2583L,2584L,2585L,2586L,2587L,2588L,2589L,2590L,
-     2591L,2592L,2593L,2594L,2595L,2596L,2597L,2598L,
-     2599L,2600L,2601L,2602L,2603L,2604L,2605L,2606L,
-     2607L,2608L,2609L,2610L,2611L,2612L,2613L,2614L,
-     2615L,2616L,2617L,2618L,2619L,2620L,2621L,2622L,
-     2623L,2624L,2625L,2626L,2627L,2628L,2629L,2630L,
-     2631L,2632L,2633L,2634L,2635L,2636L,2637L,2638L,
-     2639L,2640L,2641L,2642L,2643L,2644L,2645L,2646L,
-     2647L,2648L,2649L,2650L,2651L,2652L,2653L,2654L,
-     2655L,2656L,2657L,2658L,2659L,2660L,2661L,2662L,
-     2663L,2664L,2665L,2666L,2667L,2668L,2669L,2670L,
-     2671L,2672L,2673L,2674L,2675L,2676L,2677L,2678L,
-     2679L,2680L,2681L,2682L,2683L,2684L,2685L,2686L,
-     2687L,2688L,2689L,2690L,2691L,2692L,2693L,2694L,
-     2695L,2696L,2697L,2698L,2699L,2700L,2701L,2702L,
-     2703L,2704L,2705L,2706L,2707L,2708L,2709L,2710L,
-     2711L,2712L,2713L,2714L,2715L,2716L,2717L,2718L,
-     2719L,2720L,2721L,2722L,2723L,2724L,2725L,2726L,
-     2727L,2728L,2729L,2730L,2731L,2732L,2733L,2734L,
-     2735L,2736L,2737L,2738L,2739L,2740L,2741L,2742L,
-     2743L,2744L,2745L,2746L,2747L,2748L,2749L,2750L,
-     2751L,2752L,2753L,2754L,2755L,2756L,2757L,2758L,
-     2759L,2760L,2761L,2762L,2763L,2764L,2765L,2766L,
-     2767L,2768L,2769L,2770L,2771L,2772L,2773L,2774L,
-     2775L,2776L,2777L,2778L,2779L,2780L,2781L,2782L,
-     2783L,2784L,2785L,2786L,2787L,2788L,2789L,2790L,
-     2791L,2792L,2793L,2794L,2795L,2796L,2797L,2798L,
-     2799L,2800L,2801L,2802L,2803L,2804L,2805L,2806L,
-     2807L,2808L,2809L,2810L,2811L,2812L,2813L,2814L,
-     2815L,2816L,2817L,2818L,2819L,2820L,2821L,2822L,
-     2823L,2824L,2825L,2826L,2827L,2828L,2829L,2830L,
-     2831L,2832L,2833L,2834L,2835L,2836L,2837L,2838L,
-     2839L,2840L,2841L,2842L,2843L,2844L,2845L,2846L,
-     2847L,2848L,2849L,2850L,2851L,2852L,2853L,2854L,
-     2855L,2856L,2857L,2858L,2859L,2860L,2861L,2862L,
-     2863L,2864L,2865L,2866L,2867L,2868L,2869L,2870L,
-     2871L,2872L,2873L,2874L,2875L,2876L,2877L,2878L,
-     2879L,2880L,2881L,2882L,2883L,2884L,2885L,2886L,
-     2887L,2888L,2889L,2890L,2891L,2892L,2893L,2894L,
-     2895L,2896L,2897L,2898L,2899L,2900L,2901L,2902L,
-     2903L,2904L,2905L,2906L,2907L,2908L,2909L,2910L,
-     2911L,2912L,2913L,2914L,2915L,2916L,2917L,2918L,
-     2919L,2920L,2921L,2922L,2923L,2924L,2925L,2926L,
-     2927L,2928L,2929L,2930L,2931L,2932L,2933L,2934L,
-     2935L,2936L,2937L,2938L,2939L,2940L,2941L,2942L,
-     2943L,2944L,2945L,2946L,2947L,2948L,2949L,2950L,
-     2951L,2952L,2953L,2954L,2955L,2956L,2957L,2958L,
-     2959L,2960L,2961L,2962L,2963L,2964L,2965L,2966L,
-     2967L,2968L,2969L,2970L,2971L,2972L,2972L,2973L,
-     2974L,2975L,2976L,2977L,2978L,2979L,2980L,2981L,
-     2982L,2983L,2984L,2985L,2986L,2987L,2988L,2989L,
-     2990L,2991L,2992L,2993L,2994L,2995L,2996L,2997L,
-     2998L,2999L,3000L,3001L,3002L,3003L,3004L,3005L,
-     3006L,3007L,3008L,3009L,3010L,3011L,3012L,3013L,
-     3014L,3015L,3016L,3017L,3018L,3019L,3020L,3021L,
-     3022L,3023L,3024L,3025L,3026L,3027L,3028L,3029L,
-     3030L,3031L,3032L,3033L,3034L,3035L,3036L,3037L,
-     3038L,3039L,3040L,3041L,3042L,3043L,3044L,3045L,
-     3046L,3047L,3048L,3049L,3050L,3051L,3052L,3053L,
-     3054L,3055L,3056L,3057L,3058L,3059L,3060L,3061L,
-     3062L,3063L,3064L,3065L,3066L,3067L,3068L,3069L,
-     3070L,3071L,3072L,3073L,3074L,3075L,3076L,3077L,
-     3078L,3079L,3080L,3081L,3082L,3083L,3084L,3085L,
-     3086L,3087L,3088L,3089L,3090L,3091L,3092L,3093L,
-     3094L,3095L,3096L,3097L,3098L,3099L,3100L,3101L,
-     3102L,3103L,3104L,3105L,3106L,3107L,3108L,3109L,
-     3110L,3111L,3112L,3113L,3114L,3115L,3116L,3117L,
-     3118L,3119L,3120L,3121L,3122L,3123L,3124L,3125L,
-     3126L,3127L,3128L,3129L,3130L,3131L,3132L,3133L,
-     3134L,3135L,3136L,3137L,3138L,3139L,3140L,3141L,
-     3142L,3143L,3144L,3145L,3146L,3147L,3148L,3149L,
-     3150L,3151L,3152L,3153L,3154L,3155L,3156L,3157L,
-     3158L,3159L,3160L,3161L,3162L,3163L,3164L,3165L,
-     3166L,3167L,3168L,3169L,3170L,3171L,3172L,3173L,
-     3174L,3175L,3176L,3177L,3178L,3179L,3180L,3181L,
-     3182L,3183L,3184L,3185L,3186L,3187L,3188L,3189L,
-     3190L,3191L,3192L,3193L,3194L,3195L,3196L,3197L,
-     3198L,3199L,3200L,3201L,3202L,3203L,3204L,3205L,
-     3206L,3207L,3208L,3209L,3210L,3211L,3212L,3213L,
-     3214L,3215L,3216L,3217L,3218L,3219L,3220L,3221L,
-     3222L,3223L,3224L,3225L,3226L,3227L,3228L,3229L,
-     3230L,3231L,3232L,3233L,3234L,3235L,3236L,3237L,
-     3238L,3239L,3240L,3241L,3242L,3243L,3244L,3245L,
-     3246L,3247L,3248L,3249L,3250L,3251L,3252L,3253L,
-     3254L,3255L,3256L,3257L,3258L,3259L,3260L,3261L,
-     3262L,3263L,3264L,3265L,3266L,3267L,3268L,3269L,
-     3270L,3271L,3272L,3273L,3274L,3275L,3276L,3277L,
-     3278L,3279L,3280L,3281L,3282L,3283L,3284L,3285L,
-     3286L,3287L,3288L,3289L,3290L,3291L,3292L,3293L,
-     3294L,3295L,3296L,3297L,3298L,3299L,3300L,3301L,
-     3302L,3303L,3304L,3305L,3306L,3307L,3308L,3309L,
-     3310L,3311L,3312L,3313L,3314L,3315L,3316L,3317L,
-     3318L,3319L,3320L,3321L,3322L,3323L,3324L,3325L,
-     3326L,3327L,3328L,3329L,3330L,3331L,3332L,3333L,
-     3334L,3335L,3336L,3337L,3338L,3339L,3340L,3341L,
-     3342L,3343L,3344L,3345L,3346L,3347L,3348L,3349L,
-     3350L,3351L,3352L,3353L,3354L,3355L,3356L,3357L,
-     3358L,3359L,3360L,3361L,3362L,3363L,3364L,3365L,
-     3366L,3367L,3368L,3369L,3370L,3371L,3372L,3373L,
-     3374L,3375L,3376L,3377L,3378L,3379L,3380L,3381L,
-     3382L,3383L,3384L,3385L,3386L,3387L,3388L,3389L,
-     3390L,3391L,3392L,3393L,3394L,3395L,3396L,3397L,
-     3398L,3399L,3400L,3401L,3402L,3403L,3404L,3405L,
-     3406L,3407L,3408L,3409L,3410L,3411L,3412L,3413L,
-     3414L,3415L,3416L,3417L,3418L,3419L,3420L,3421L,
-     3422L,3423L,3424L,3425L,3426L,3427L,3428L,3429L,
-     3430L,3431L,3432L,3433L,3434L,3435L,3436L,3437L,
-     3438L,3439L,3440L,3441L,3442L,3443L,3444L,3445L,
-     3446L,3447L,3448L,3449L,3450L,3451L,3452L,3453L,
-     3454L,3455L,3456L,3457L,3458L,3459L,3460L,3461L,
-     3462L,3463L,3464L,3465L,3466L,3467L,3468L,3469L,
-     3470L,3471L,3472L,3473L,3474L,3475L,3476L,3477L,
-     3478L,3479L,3480L,3481L,3482L,3483L,3484L,3485L,
-     3486L,3487L,3488L,3489L,3490L,3491L,3492L,3493L,
-     3494L,3495L,3496L,3497L,3498L,3499L,3500L,3501L,
-     3502L,3503L,3504L,3505L,3506L,3507L,3508L,3509L,
-     3510L,3511L,3512L,3513L,3514L,3515L,3516L,3517L,
-     3518L,3519L,3520L,3521L,3522L,3523L,3524L,3525L,
-     3526L,3527L,3528L,3529L,3530L,3531L,3532L,3533L,
-     3534L,3535L,3536L,3537L,3538L,3539L,3540L,3541L,
-     3542L,3543L,3544L,3545L,3546L,3547L,3548L,3549L,
-     3550L,3551L,3552L,3553L,3554L,3555L,3556L,3557L,
-     3558L,3559L,3560L,3561L,3562L,3563L,3564L,3565L,
-     3566L,3567L,3568L,3569L,3570L,3571L,3572L,3573L,
-     3574L,3575L,3576L,3577L,3578L,3579L,3580L,3581L,
-     3582L,3583L,3584L,3585L,3586L,3587L,3588L,3589L,
-     3590L,3591L,3592L,3593L,3594L,3595L,3596L,3597L,
-     3598L,3599L,3600L,3601L,3602L,3603L,3604L,3605L,
-     3606L,3607L,3608L,3609L,3610L,3611L,3612L,3613L,
-     3614L,3615L,3616L,3617L,3618L,3619L,3620L,3621L,
-     3622L,3623L,3624L,3625L,3626L,3627L,3628L,3629L,
-     3630L,3631L,3632L,3633L,3634L,3635L,3636L,3637L,
-     3638L,3639L,3640L,3641L,3642L,3643L,3644L,3645L,
-     3646L,3647L,3648L,3649L,3650L,3651L,3652L,3653L,
-     3654L,3655L,3656L,3657L,3658L,3659L,3660L,3661L,
-     3662L,3663L,3664L,3665L,3666L,3667L,3668L,3669L,
-     3670L,3671L,3672L,3673L,3674L,3675L,3676L,3677L,
-     3678L,3679L,3680L,3681L,3682L,3683L,3684L,3685L,
-     3686L,3687L,3688L,3689L,3690L,3691L,3692L,3693L,
-     3694L,3695L,3696L,3697L,3698L,3699L,3700L,3701L,
-     3702L,3703L,3704L,3705L,3706L,3707L,3708L,3709L,
-     3710L,3711L,3712L,3713L,3714L,3715L,3716L,3717L,
-     3718L,3719L,3720L,3721L,3722L,3723L,3724L,3725L,
-     3726L,3727L,3728L,3729L,3730L,3731L,3732L,3733L,
-     3734L,3735L,3735L,3736L,3737L,3738L,3739L,3740L,
-     3741L,3742L,3743L,3744L,3745L,3746L,3747L,3748L,
-     3749L,3750L,3751L,3752L,3753L,3754L,3755L,3756L,
-     3757L,3758L,3759L,3760L,3761L,3762L,3763L,3764L,
-     3765L,3766L,3767L,3768L,3769L,3770L,3771L,3772L,
-     3773L,3774L,3775L,3776L,3777L,3778L,3779L,3780L,
-     3781L,3782L,3783L,3784L,3785L,3786L,3787L,3788L,
-     3789L,3790L,3791L,3792L,3793L,3794L,3795L,3796L,
-     3797L,3798L,3799L,3800L,3801L,3802L,3803L,3804L,
-     3805L,3806L,3807L,3808L,3809L,3810L,3811L,3812L,
-     3813L,3814L,3815L,3816L,3817L,3818L,3819L,3820L,
-     3821L,3822L,3823L,3824L,3825L,3826L,3827L,3828L,
-     3829L,3830L,3831L,3832L,3833L,3834L,3835L,3836L,
-     3837L,3838L,3839L,3840L,3841L,3842L,3843L,3844L,
-     3845L,3846L,3847L,3848L,3849L,3850L,3851L,3852L,
-     3853L,3854L,3855L,3856L,3857L,3858L,3859L,3860L,
-     3861L,3862L,3863L,3864L,3865L,3866L,3867L,3868L,
-     3869L,3870L,3871L,3872L,3873L,3874L,3875L,3876L,
-     3877L,3878L,3879L,3880L,3881L,3882L,3883L,3884L,
-     3885L,3886L,3887L,3888L,3889L,3890L,3891L,3892L,
-     3893L,3894L,3895L,3896L,3897L,3898L,3899L,3900L,
-     3901L,3902L,3903L,3904L,3905L,3906L,3907L,3908L,
-     3909L,3910L,3911L,3912L,3913L,3914L,3915L,3916L,
-     3917L,3918L,3919L,3920L,3921L,3922L,3923L,3924L,
-     3925L,3926L,3927L,3928L,3929L,3930L,3931L,3932L,
-     3933L,3934L,3935L,3936L,3937L,3938L,3939L,3940L,
-     3941L,3942L,3943L,3944L,3945L,3946L,3947L,3948L,
-     3949L,3950L,3951L,3952L,3953L,3954L,3955L,3956L,
-     3957L,3958L,3959L,3960L,3961L,3962L,3963L,3964L,
-     3965L,3966L,3967L,3968L,3969L,3970L,3971L,3972L,
-     3973L,3974L,3975L,3976L,3977L,3978L,3979L,3980L,
-     3981L,3982L,3983L,3984L,3985L,3986L,3987L,3988L,
-     3989L,3990L,3991L,3992L,3993L,3994L,3995L,3996L,
-     3997L,3998L,3999L,4000L,4001L,4002L,4003L,4004L,
-     4005L,4006L,4007L,4008L,4009L,4010L,4011L,4012L,
-     4013L,4014L,4015L,4016L,4017L,4018L,4019L,4020L,
-     4021L,4022L,4023L,4024L,4025L,4026L,4027L,4028L,
-     4029L,4030L,4031L,4032L,4033L,4034L,4035L,4036L,
-     4037L,4038L,4039L,4040L,4041L,4042L,4043L,4044L,
-     4045L,4046L,4047L,4048L,4049L,4050L,4051L,4052L,
-     4053L,4054L,4055L,4056L,4057L,4058L,4059L,4060L,
-     4061L,4062L,4063L,4064L,4065L,4066L,4067L,4068L,
-     4069L,4070L,4071L,4072L,4073L,4074L,4075L,4076L,
-     4077L,4078L,4079L,4080L,4081L,4082L,4083L,4084L,
-     4085L,4086L,4087L,4088L,4089L,4090L,4091L,4092L,
-     4093L,4094L,4095L,4096L,4097L,4098L,4099L,4100L,
-     4101L,4102L,4103L,4104L,4105L,4106L,4107L,4108L,
-     4109L,4110L,4111L,4112L,4113L,4114L,4115L,4116L,
-     4117L,4118L,4119L,4120L,4121L,4122L,4123L,4124L,
-     4125L,4126L,4127L,4128L,4129L,4130L,4131L,4132L,
-     4133L,4134L,4135L,4136L,4137L,4138L,4139L,4140L,
-     4141L,4142L,4143L,4144L,4145L,4146L,4147L,4148L,
-     4149L,4150L,4151L,4152L,4153L,4154L,4155L,4156L,
-     4157L,4158L,4159L,4160L,4161L,4162L,4163L,4164L,
-     4165L,4166L,4167L,4168L,4169L,4170L,4171L,4172L,
-     4173L,4174L,4175L,4176L,4177L,4178L,4179L,4180L,
-     4181L,4182L,4183L,4184L,4185L,4186L,4187L,4188L,
-     4189L,4190L,4191L,4192L,4193L,4194L,4195L,4196L,
-     4197L,4198L,4199L,4200L,4201L,4202L,4203L,4204L,
-     4205L,4206L,4207L,4208L,4209L,4210L,4211L,4212L,
-     4213L,4214L,4215L,4216L,4217L,4218L,4219L,4220L,
-     4221L,4222L,4223L,4224L,4225L,4226L,4227L,4228L,
-     4229L,4230L,4231L,4232L,4233L,4234L,4235L,4236L,
-     4237L,4238L,4239L,4240L,4241L,4242L,4243L,4244L,
-     4245L,4246L,4247L,4248L,4249L,4250L,4251L,4252L,
-     4253L,4254L,4255L,4256L,4257L,4258L,4259L,4260L,
-     4261L,4262L,4263L,4264L,4265L,4266L,4267L,4268L,
-     4269L,4270L,4271L,4271L,4272L,4273L,4274L,4275L,
-     4276L,4277L,4278L,4279L,4280L,4281L,4282L,4283L,
-     4284L,4285L,4286L,4287L,4288L,4289L,4290L,4291L,
-     4292L,4293L,4294L,4295L,4296L,4297L,4298L,4299L,
-     4300L,4301L,4302L,4303L,4304L,4305L,4306L,4307L,
-     4308L,4309L,4310L,4311L,4312L,4313L,4314L,4315L,
-     4316L,4317L,4318L,4319L,4320L,4321L,4322L,4323L,
-     4324L,4325L,4326L,4327L,4328L,4329L,4330L,4331L,
-     4332L,4333L,4334L,4335L,4336L,4337L,4338L,4339L,
-     4340L,4341L,4342L,4343L,4344L,4345L,4346L,4347L,
-     4348L,4349L,4350L,4351L,4352L,4353L,4354L,4355L,
-     4356L,4357L,4358L,4359L,4360L,4361L,4362L,4363L,
-     4364L,4365L,4366L,4367L,4368L,4369L,4370L,4371L,
-     4372L,4373L,4374L,4375L,4376L,4377L,4378L,4379L,
-     4380L,4381L,4382L,4383L,4384L,4385L,4386L,4387L,
-     4388L,4389L,4390L,4391L,4392L,4393L,4394L,4395L,
-     4396L,4397L,4398L,4399L,4400L,4401L,4402L,4403L,
-     4404L,4405L,4406L,4407L,4408L,4409L,4410L,4411L,
-     4412L,4413L,4414L,4415L,4416L,4417L,4418L,4419L,
-     4420L,4421L,4422L,4423L,4424L,4425L,4426L,4427L,
-     4428L,4429L,4430L,4431L,4432L,4433L,4434L,4435L,
-     4436L,4437L,4438L,4439L,4440L,4441L,4442L,4443L,
-     4444L,4445L,4446L,4447L,4448L,4449L,4450L,4451L,
-     4452L,4453L,4454L,4455L,4456L,4457L,4458L,4459L,
-     4460L,4461L,4462L,4463L,4464L,4465L,4466L,4467L,
-     4468L,4469L,4470L,4471L,4472L,4473L,4474L,4475L,
-     4476L,4477L,4478L,4479L,4480L,4481L,4482L,4483L,
-     4484L,4485L,4486L,4487L,4488L,4489L,4490L,4491L,
-     4492L,4493L,4494L,4495L,4496L,4497L,4498L,4499L,
-     4500L,4501L,4502L,4503L,4504L,4505L,4506L,4507L,
-     4508L,4509L,4510L,4511L,4512L,4513L,4514L,4515L,
-     4516L,4517L,4518L,4519L,4520L,4521L,4522L,4523L,
-     4524L,4525L,4526L,4527L,4528L,4529L,4530L,4531L,
-     4532L,4533L,4534L,4535L,4536L,4537L,4538L,4539L,
-     4540L,4541L,4542L,4543L,4544L,4545L,4546L,4547L,
-     4548L,4549L,4550L,4551L,4552L,4553L,4554L,4555L,
-     4556L,4557L,4558L,4559L,4560L,4561L,4562L,4563L,
-     4564L,4565L,4566L,4567L,4568L,4569L,4570L,4571L,
-     4572L,4573L,4574L,4575L,4576L,4577L,4578L,4579L,
-     4580L,4581L,4582L,4583L,4584L,4585L,4586L,4587L,
-     4588L,4589L,4590L,4591L,4592L,4593L,4594L,4595L,
-     4596L,4597L,4598L,4599L,4600L,4601L,4602L,4603L,
-     4604L,4605L,4606L,4607L,4608L,4609L,4610L,4611L,
-     4612L,4613L,4614L,4615L,4616L,4617L,4618L,4619L,
-     4620L,4621L,4622L,4623L,4624L,4625L,4626L,4627L,
-     4628L,4629L,4630L,4631L,4632L,4633L,4634L,4635L,
-     4636L,4637L,4638L,4639L,4640L,4641L,4642L,4643L,
-     4644L,4645L,4646L,4647L,4648L,4649L,4650L,4651L,
-     4652L,4653L,4654L,4655L,4656L,4657L,4658L,4659L,
-     4660L,4661L,4662L,4663L,4664L,4665L,4666L,4667L,
-     4668L,4669L,4670L,4671L,4672L,4673L,4674L,4675L,
-     4676L,4677L,4678L,4679L,4680L,4681L,4682L,4683L,
-     4684L,4685L,4686L,4687L,4688L,4689L,4690L,4691L,
-     4692L,4693L,4694L,4695L,4696L,4697L,4697L,4698L,
-     4699L,4700L,4701L,4702L,4703L,4704L,4705L,4706L,
-     4707L,4708L,4709L,4710L,4711L,4712L,4713L,4714L,
-     4715L,4716L,4717L,4718L,4719L,4720L,4721L,4722L,
-     4723L,4724L,4725L,4726L,4727L,4728L,4729L,4730L,
-     4731L,4732L,4733L,4734L,4735L,4736L,4737L,4738L,
-     4739L,4740L,4741L,4742L,4743L,4744L,4745L,4746L,
-     4747L,4748L,4749L,4750L,4751L,4752L,4753L,4754L,
-     4755L,4756L,4757L,4758L,4759L,4760L,4761L,4762L,
-     4763L,4764L,4765L,4766L,4767L,4768L,4769L,4770L,
-     4771L,4772L,4773L,4774L,4775L,4776L,4777L,4778L,
-     4779L,4780L,4781L,4782L,4783L,4784L,4785L,4786L,
-     4787L,4788L,4789L,4790L,4791L,4792L,4793L,4794L,
-     4795L,4796L,4797L,4798L,4799L,4800L,4801L,4802L,
-     4803L,4804L,4805L,4806L,4807L,4808L,4809L,4810L,
-     4811L,4812L,4813L,4814L,4815L,4816L,4817L,4818L,
-     4819L,4820L,4821L,4822L,4823L,4824L,4825L,4826L,
-     4827L,4828L,4829L,4830L,4831L,4832L,4833L,4834L,
-     4835L,4836L,4837L,4838L,4839L,4840L,4841L,4842L,
-     4843L,4844L,4845L,4846L,4847L,4848L,4849L,4850L,
-     4851L,4852L,4853L,4854L,4855L,4856L,4857L,4858L,
-     4859L,4860L,4861L,4862L,4863L,4864L,4865L,4866L,
-     4867L,4868L,4869L,4870L,4871L,4872L,4873L,4874L,
-     4875L,4876L,4877L,4878L,4879L,4880L,4881L,4882L,
-     4883L,4884L,4885L,4886L,4887L,4888L,4889L,4890L,
-     4891L,4892L,4893L,4894L,4895L,4896L,4897L,4898L,
-     4899L,4900L,4901L,4902L,4903L,4904L,4905L,4906L,
-     4907L,4908L,4909L,4910L,4911L,4912L,4913L,4914L,
-     4915L,4916L,4917L,4918L,4919L,4920L,4921L,4922L,
-     4923L,4924L,4925L,4926L,4927L,4928L,4929L,4930L,
-     4931L,4932L,4933L,4934L,4935L,4936L,4937L,4938L,
-     4939L,4940L,4941L,4942L,4943L,4944L,4945L,4946L,
-     4947L,4948L,4949L,4950L,4951L,4952L,4953L,4954L,
-     4955L,4956L,4957L,4958L,4959L,4960L,4961L,4962L,
-     4963L,4964L,4965L,4966L,4967L,4968L,4969L,4970L,
-     4971L,4972L,4973L,4974L,4975L,4976L,4977L,4978L,
-     4979L,4980L,4981L,4982L,4983L,4984L,4985L,4986L,
-     4987L,4988L,4989L,4990L,4991L,4992L,4993L,4994L,
-     4995L,4996L,4997L,4998L,4999L,5000L,5001L,5002L,
-     5003L,5004L,5005L,5006L,5007L,5008L,5009L,5010L,
-     5011L,5012L,5013L,5014L,5015L,5016L,5017L,5018L,
-     5019L,5020L,5021L,5022L,5023L,5024L,5025L,5026L,
-     5027L,5028L,5029L,5030L,5031L,5032L,5033L,5034L,
-     5035L,5036L,5037L,5038L,5039L,5040L,5041L,5042L,
-     5043L,5044L,5045L,5046L,5047L,5048L,5049L,5050L,
-     5051L,5052L,5053L,5054L,5055L,5056L,5057L,5057L,
-     5058L,5059L,5060L,5061L,5062L,5063L,5064L,5065L,
-     5066L,5067L,5068L,5069L,5070L,5071L,5072L,5073L,
-     5074L,5075L,5076L,5077L,5078L,5079L,5080L,5081L,
-     5082L,5083L,5084L,5085L,5086L,5087L,5088L,5089L,
-     5090L,5091L,5092L,5093L,5094L,5095L,5096L,5097L,
-     5098L,5099L,5100L,5101L,5102L,5103L,5104L,5105L,
-     5106L,5107L,5108L,5109L,5110L,5111L,5112L,5113L,
-     5114L,5115L,5116L,5117L,5118L,5119L,5120L,5121L,
-     5122L,5123L,5124L,5125L,5126L,5127L,5128L,5129L,
-     5130L,5131L,5132L,5133L,5134L,5135L,5136L,5137L,
-     5138L,5139L,5140L,5141L,5142L,5143L,5144L,5145L,
-     5146L,5147L,5148L,5149L,5150L,5151L,5152L,5153L,
-     5154L,5155L,5156L,5157L,5158L,5159L,5160L,5161L,
-     5162L,5163L,5164L,5165L,5166L,5167L,5168L,5169L,
-     5170L,5171L,5172L,5173L,5174L,5175L,5176L,5177L,
-     5178L,5179L,5180L,5181L,5182L,5183L,5184L,5185L,
-     5186L,5187L,5188L,5189L,5190L,5191L,5192L,5193L,
-     5194L,5195L,5196L,5197L,5198L,5199L,5200L,5201L,
-     5202L,5203L,5204L,5205L,5206L,5207L,5208L,5209L,
-     5210L,5211L,5212L,5213L,5214L,5215L,5216L,5217L,
-     5218L,5219L,5220L,5221L,5222L,5223L,5224L,5225L,
-     5226L,5227L,5228L,5229L,5230L,5231L,5232L,5233L,
-     5234L,5235L,5236L,5237L,5238L,5239L,5240L,5241L,
-     5242L,5243L,5244L,5245L,5246L,5247L,5248L,5249L,
-     5250L,5251L,5252L,5253L,5254L,5255L,5256L,5257L,
-     5258L,5259L,5260L,5261L,5262L,5263L,5264L,5265L,
-     5266L,5267L,5268L,5269L,5270L,5271L,5272L,5273L,
-     5274L,5275L,5276L,5277L,5278L,5279L,5280L,5281L,
-     5282L,5283L,5284L,5285L,5286L,5287L,5288L,5289L,
-     5290L,5291L,5292L,5293L,5294L,5295L,5296L,5297L,
-     5298L,5299L,5300L,5301L,5302L,5303L,5304L,5305L,
-     5306L,5307L,5308L,5309L,5310L,5311L,5312L,5313L,
-     5314L,5315L,5316L,5317L,5318L,5319L,5320L,5321L,
-     5322L,5323L,5324L,5325L,5326L,5327L,5328L,5329L,
-     5330L,5331L,5332L,5333L,5334L,5335L,5336L,5337L,
-     5338L,5339L,5340L,5341L,5342L,5343L,5344L,5345L,
-     5346L,5347L,5348L,5349L,5350L,5351L,5352L,5353L,
-     5354L,5355L,5356L,5357L,5358L,5359L,5360L,5361L,
-     5362L,5363L,5364L,5365L,5366L,5367L,5368L,5369L,
-     5370L,5371L,5372L,5372L,5373L,5374L,5375L,5376L,
-     5377L,5378L,5379L,5380L,5381L,5382L,5383L,5384L,
-     5385L,5386L,5387L,5388L,5389L,5390L,5391L,5392L,
-     5393L,5394L,5395L,5396L,5397L,5398L,5399L,5400L,
-     5401L,5402L,5403L,5404L,5405L,5406L,5407L,5408L,
-     5409L,5410L,5411L,5412L,5413L,5414L,5415L,5416L,
-     5417L,5418L,5419L,5420L,5421L,5422L,5423L,5424L,
-     5425L,5426L,5427L,5428L,5429L,5430L,5431L,5432L,
-     5433L,5434L,5435L,5436L,5437L,5438L,5439L,5440L,
-     5441L,5442L,5443L,5444L,5445L,5446L,5447L,5448L,
-     5449L,5450L,5451L,5452L,5453L,5454L,5455L,5456L,
-     5457L,5458L,5459L,5460L,5461L,5462L,5463L,5464L,
-     5465L,5466L,5467L,5468L,5469L,5470L,5471L,5472L,
-     5473L,5474L,5475L,5476L,5477L,5478L,5479L,5480L,
-     5481L,5482L,5483L,5484L,5485L,5486L,5487L,5488L,
-     5489L,5490L,5491L,5492L,5493L,5494L,5495L,5496L,
-     5497L,5498L,5499L,5500L,5501L,5502L,5503L,5504L,
-     5505L,5506L,5507L,5508L,5509L,5510L,5511L,5512L,
-     5513L,5514L,5515L,5516L,5517L,5518L,5519L,5520L,
-     5521L,5522L,5523L,5524L,5525L,5526L,5527L,5528L,
-     5529L,5530L,5531L,5532L,5533L,5534L,5535L,5536L,
-     5537L,5538L,5539L,5540L,5541L,5542L,5543L,5544L,
-     5545L,5546L,5547L,5548L,5549L,5550L,5551L,5552L,
-     5553L,5554L,5555L,5556L,5557L,5558L,5559L,5560L,
-     5561L,5562L,5563L,5564L,5565L,5566L,5567L,5568L,
-     5569L,5570L,5571L,5572L,5573L,5574L,5575L,5576L,
-     5577L,5578L,5579L,5580L,5581L,5582L,5583L,5584L,
-     5585L,5586L,5587L,5588L,5589L,5590L,5591L,5592L,
-     5593L,5594L,5595L,5596L,5597L,5598L,5599L,5600L,
-     5601L,5602L,5603L,5604L,5605L,5606L,5607L,5608L,
-     5609L,5610L,5611L,5612L,5613L,5614L,5615L,5616L,
-     5617L,5618L,5619L,5620L,5621L,5622L,5623L,5624L,
-     5625L,5626L,5627L,5628L,5629L,5630L,5631L,5632L,
-     5633L,5634L,5635L,5636L,5637L,5638L,5639L,5640L,
-     5641L,5642L,5643L,5644L,5645L,5646L,5647L,5648L,
-     5649L,5650L,5651L,5652L,5653L,5654L,5654L,5655L,
-     5656L,5657L,5658L,5659L,5660L,5661L,5662L,5663L,
-     5664L,5665L,5666L,5667L,5668L,5669L,5670L,5671L,
-     5672L,5673L,5674L,5675L,5676L,5677L,5678L,5679L,
-     5680L,5681L,5682L,5683L,5684L,5685L,5686L,5687L,
-     5688L,5689L,5690L,5691L,5692L,5693L,5694L,5695L,
-     5696L,5697L,5698L,5699L,5700L,5701L,5702L,5703L,
-     5704L,5705L,5706L,5707L,5708L,5709L,5710L,5711L,
-     5712L,5713L,5714L,5715L,5716L,5717L,5718L,5719L,
-     5720L,5721L,5722L,5723L,5724L,5725L,5726L,5727L,
-     5728L,5729L,5730L,5731L,5732L,5733L,5734L,5735L,
-     5736L,5737L,5738L,5739L,5740L,5741L,5742L,5743L,
-     5744L,5745L,5746L,5747L,5748L,5749L,5750L,5751L,
-     5752L,5753L,5754L,5755L,5756L,5757L,5758L,5759L,
-     5760L,5761L,5762L,5763L,5764L,5765L,5766L,5767L,
-     5768L,5769L,5770L,5771L,5772L,5773L,5774L,5775L,
-     5776L,5777L,5778L,5779L,5780L,5781L,5782L,5783L,
-     5784L,5785L,5786L,5787L,5788L,5789L,5790L,5791L,
-     5792L,5793L,5794L,5795L,5796L,5797L,5798L,5799L,
-     5800L,5801L,5802L,5803L,5804L,5805L,5806L,5807L,
-     5808L,5809L,5810L,5811L,5812L,5813L,5814L,5815L,
-     5816L,5817L,5818L,5819L,5820L,5821L,5822L,5823L,
-     5824L,5825L,5826L,5827L,5828L,5829L,5830L,5831L,
-     5832L,5833L,5834L,5835L,5836L,5837L,5838L,5839L,
-     5840L,5841L,5842L,5843L,5844L,5845L,5846L,5847L,
-     5848L,5849L,5850L,5851L,5852L,5853L,5854L,5855L,
-     5856L,5857L,5858L,5859L,5860L,5861L,5862L,5863L,
-     5864L,5865L,5866L,5867L,5868L,5869L,5870L,5871L,
-     5872L,5873L,5874L,5875L,5876L,5877L,5878L,5879L,
-     5880L,5881L,5882L,5883L,5884L,5885L,5886L,5887L,
-     5888L,5889L,5890L,5891L,5892L,5893L,5894L,5895L,
-     5896L,5897L,5898L,5899L,5900L,5901L,5902L,5903L,
-     5904L,5905L,5906L,5907L,5908L,5909L,5910L,5910L,
-     5911L,5912L,5913L,5914L,5915L,5916L,5917L,5918L,
-     5919L,5920L,5921L,5922L,5923L,5924L,5925L,5926L,
-     5927L,5928L,5929L,5930L,5931L,5932L,5933L,5934L,
-     5935L,5936L,5937L,5938L,5939L,5940L,5941L,5942L,
-     5943L,5944L,5945L,5946L,5947L,5948L,5949L,5950L,
-     5951L,5952L,5953L,5954L,5955L,5956L,5957L,5958L,
-     5959L,5960L,5961L,5962L,5963L,5964L,5965L,5966L,
-     5967L,5968L,5969L,5970L,5971L,5972L,5973L,5974L,
-     5975L,5976L,5977L,5978L,5979L,5980L,5981L,5982L,
-     5983L,5984L,5985L,5986L,5987L,5988L,5989L,5990L,
-     5991L,5992L,5993L,5994L,5995L,5996L,5997L,5998L,
-     5999L,6000L,6001L,6002L,6003L,6004L,6005L,6006L,
-     6007L,6008L,6009L,6010L,6011L,6012L,6013L,6014L,
-     6015L,6016L,6017L,6018L,6019L,6020L,6021L,6022L,
-     6023L,6024L,6025L,6026L,6027L,6028L,6029L,6030L,
-     6031L,6032L,6033L,6034L,6035L,6036L,6037L,6038L,
-     6039L,6040L,6041L,6042L,6043L,6044L,6045L,6046L,
-     6047L,6048L,6049L,6050L,6051L,6052L,6053L,6054L,
-     6055L,6056L,6057L,6058L,6059L,6060L,6061L,6062L,
-     6063L,6064L,6065L,6066L,6067L,6068L,6069L,6070L,
-     6071L,6072L,6073L,6074L,6075L,6076L,6077L,6078L,
-     6079L,6080L,6081L,6082L,6083L,6084L,6085L,6086L,
-     6087L,6088L,6089L,6090L,6091L,6092L,6093L,6094L,
-     6095L,6096L,6097L,6098L,6099L,6100L,6101L,6102L,
-     6103L,6104L,6105L,6106L,6107L,6108L,6109L,6110L,
-     6111L,6112L,6113L,6114L,6115L,6116L,6117L,6118L,
-     6119L,6120L,6121L,6122L,6123L,6124L,6125L,6126L,
-     6127L,6128L,6129L,6130L,6131L,6132L,6133L,6134L,
-     6135L,6136L,6137L,6138L,6139L,6140L,6141L,6142L,
-     6143L,6144L,6145L,6145L,6146L,6147L,6148L,6149L,
-     6150L,6151L,6152L,6153L,6154L,6155L,6156L,6157L,
-     6158L,6159L,6160L,6161L,6162L,6163L,6164L,6165L,
-     6166L,6167L,6168L,6169L,6170L,6171L,6172L,6173L,
-     6174L,6175L,6176L,6177L,6178L,6179L,6180L,6181L,
-     6182L,6183L,6184L,6185L,6186L,6187L,6188L,6189L,
-     6190L,6191L,6192L,6193L,6194L,6195L,6196L,6197L,
-     6198L,6199L,6200L,6201L,6202L,6203L,6204L,6205L,
-     6206L,6207L,6208L,6209L,6210L,6211L,6212L,6213L,
-     6214L,6215L,6216L,6217L,6218L,6219L,6220L,6221L,
-     6222L,6223L,6224L,6225L,6226L,6227L,6228L,6229L,
-     6230L,6231L,6232L,6233L,6234L,6235L,6236L,6237L,
-     6238L,6239L,6240L,6241L,6242L,6243L,6244L,6245L,
-     6246L,6247L,6248L,6249L,6250L,6251L,6252L,6253L,
-     6254L,6255L,6256L,6257L,6258L,6259L,6260L,6261L,
-     6262L,6263L,6264L,6265L,6266L,6267L,6268L,6269L,
-     6270L,6271L,6272L,6273L,6274L,6275L,6276L,6277L,
-     6278L,6279L,6280L,6281L,6282L,6283L,6284L,6285L,
-     6286L,6287L,6288L,6289L,6290L,6291L,6292L,6293L,
-     6294L,6295L,6296L,6297L,6298L,6299L,6300L,6301L,
-     6302L,6303L,6304L,6305L,6306L,6307L,6308L,6309L,
-     6310L,6311L,6312L,6313L,6314L,6315L,6316L,6317L,
-     6318L,6319L,6320L,6321L,6322L,6323L,6324L,6325L,
-     6326L,6327L,6328L,6329L,6330L,6331L,6332L,6333L,
-     6334L,6335L,6336L,6337L,6338L,6339L,6340L,6341L,
-     6342L,6343L,6344L,6345L,6346L,6347L,6348L,6349L,
-     6350L,6351L,6352L,6353L,6354L,6355L,6356L,6357L,
-     6358L,6359L,6360L,6361L,6362L,6363L,6363L,6364L,
-     6365L,6366L,6367L,6368L,6369L,6370L,6371L,6372L,
-     6373L,6374L,6375L,6376L,6377L,6378L,6379L,6380L,
-     6381L,6382L,6383L,6384L,6385L,6386L,6387L,6388L,
-     6389L,6390L,6391L,6392L,6393L,6394L,6395L,6396L,
-     6397L,6398L,6399L,6400L,6401L,6402L,6403L,6404L,
-     6405L,6406L,6407L,6408L,6409L,6410L,6411L,6412L,
-     6413L,6414L,6415L,6416L,6417L,6418L,6419L,6420L,
-     6421L,6422L,6423L,6424L,6425L,6426L,6427L,6428L,
-     6429L,6430L,6431L,6432L,6433L,6434L,6435L,6436L,
-     6437L,6438L,6439L,6440L,6441L,6442L,6443L,6444L,
-     6445L,6446L,6447L,6448L,6449L,6450L,6451L,6452L,
-     6453L,6454L,6455L,6456L,6457L,6458L,6459L,6460L,
-     6461L,6462L,6463L,6464L,6465L,6466L,6467L,6468L,
-     6469L,6470L,6471L,6472L,6473L,6474L,6475L,6476L,
-     6477L,6478L,6479L,6480L,6481L,6482L,6483L,6484L,
-     6485L,6486L,6487L,6488L,6489L,6490L,6491L,6492L,
-     6493L,6494L,6495L,6496L,6497L,6498L,6499L,6500L,
-     6501L,6502L,6503L,6504L,6505L,6506L,6507L,6508L,
-     6509L,6510L,6511L,6512L,6513L,6514L,6515L,6516L,
-     6517L,6518L,6519L,6520L,6521L,6522L,6523L,6524L,
-     6525L,6526L,6527L,6528L,6529L,6530L,6531L,6532L,
-     6533L,6534L,6535L,6536L,6537L,6538L,6539L,6540L,
-     6541L,6542L,6543L,6544L,6545L,6546L,6547L,6548L,
-     6549L,6550L,6551L,6552L,6553L,6554L,6555L,6556L,
-     6557L,6558L,6559L,6560L,6561L,6562L,6563L,6564L,
-     6565L,6566L,6567L,6568L,6568L,6569L,6570L,6571L,
-     6572L,6573L,6574L,6575L,6576L,6577L,6578L,6579L,
-     6580L,6581L,6582L,6583L,6584L,6585L,6586L,6587L,
-     6588L,6589L,6590L,6591L,6592L,6593L,6594L,6595L,
-     6596L,6597L,6598L,6599L,6600L,6601L,6602L,6603L,
-     6604L,6605L,6606L,6607L,6608L,6609L,6610L,6611L,
-     6612L,6613L,6614L,6615L,6616L,6617L,6618L,6619L,
-     6620L,6621L,6622L,6623L,6624L,6625L,6626L,6627L,
-     6628L,6629L,6630L,6631L,6632L,6633L,6634L,6635L,
-     6636L,6637L,6638L,6639L,6640L,6641L,6642L,6643L,
-     6644L,6645L,6646L,6647L,6648L,6649L,6650L,6651L,
-     6652L,6653L,6654L,6655L,6656L,6657L,6658L,6659L,
-     6660L,6661L,6662L,6663L,6664L,6665L,6666L,6667L,
-     6668L,6669L,6670L,6671L,6672L,6673L,6674L,6675L,
-     6676L,6677L,6678L,6679L,6680L,6681L,6682L,6683L,
-     6684L,6685L,6686L,6687L,6688L,6689L,6690L,6691L,
-     6692L,6693L,6694L,6695L,6696L,6697L,6698L,6699L,
-     6700L,6701L,6702L,6703L,6704L,6705L,6706L,6707L,
-     6708L,6709L,6710L,6711L,6712L,6713L,6714L,6715L,
-     6716L,6717L,6718L,6719L,6720L,6721L,6722L,6723L,
-     6724L,6725L,6726L,6727L,6728L,6729L,6730L,6731L,
-     6732L,6733L,6734L,6735L,6736L,6737L,6738L,6739L,
-     6740L,6741L,6742L,6743L,6744L,6745L,6746L,6747L,
-     6748L,6749L,6750L,6751L,6752L,6753L,6754L,6755L,
-     6756L,6757L,6758L,6759L,6760L,6760L,6761L,6762L,
-     6763L,6764L,6765L,6766L,6767L,6768L,6769L,6770L,
-     6771L,6772L,6773L,6774L,6775L,6776L,6777L,6778L,
-     6779L,6780L,6781L,6782L,6783L,6784L,6785L,6786L,
-     6787L,6788L,6789L,6790L,6791L,6792L,6793L,6794L,
-     6795L,6796L,6797L,6798L,6799L,6800L,6801L,6802L,
-     6803L,6804L,6805L,6806L,6807L,6808L,6809L,6810L,
-     6811L,6812L,6813L,6814L,6815L,6816L,6817L,6818L,
-     6819L,6820L,6821L,6822L,6823L,6824L,6825L,6826L,
-     6827L,6828L,6829L,6830L,6831L,6832L,6833L,6834L,
-     6835L,6836L,6837L,6838L,6839L,6840L,6841L,6842L,
-     6843L,6844L,6845L,6846L,6847L,6848L,6849L,6850L,
-     6851L,6852L,6853L,6854L,6855L,6856L,6857L,6858L,
-     6859L,6860L,6861L,6862L,6863L,6864L,6865L,6866L,
-     6867L,6868L,6869L,6870L,6871L,6872L,6873L,6874L,
-     6875L,6876L,6877L,6878L,6879L,6880L,6881L,6882L,
-     6883L,6884L,6885L,6886L,6887L,6888L,6889L,6890L,
-     6891L,6892L,6893L,6894L,6895L,6896L,6897L,6898L,
-     6899L,6900L,6901L,6902L,6903L,6904L,6905L,6906L,
-     6907L,6908L,6909L,6910L,6911L,6912L,6913L,6914L,
-     6915L,6916L,6917L,6918L,6919L,6920L,6921L,6922L,
-     6923L,6924L,6925L,6926L,6927L,6928L,6929L,6930L,
-     6931L,6932L,6933L,6934L,6935L,6936L,6937L,6938L,
-     6939L,6940L,6941L,6941L,6942L,6943L,6944L,6945L,
-     6946L,6947L,6948L,6949L,6950L,6951L,6952L,6953L,
-     6954L,6955L,6956L,6957L,6958L,6959L,6960L,6961L,
-     6962L,6963L,6964L,6965L,6966L,6967L,6968L,6969L,
-     6970L,6971L,6972L,6973L,6974L,6975L,6976L,6977L,
-     6978L,6979L,6980L,6981L,6982L,6983L,6984L,6985L,
-     6986L,6987L,6988L,6989L,6990L,6991L,6992L,6993L,
-     6994L,6995L,6996L,6997L,6998L,6999L,7000L,7001L,
-     7002L,7003L,7004L,7005L,7006L,7007L,7008L,7009L,
-     7010L,7011L,7012L,7013L,7014L,7015L,7016L,7017L,
-     7018L,7019L,7020L,7021L,7022L,7023L,7024L,7025L,
-     7026L,7027L,7028L,7029L,7030L,7031L,7032L,7033L,
-     7034L,7035L,7036L,7037L,7038L,7039L,7040L,7041L,
-     7042L,7043L,7044L,7045L,7046L,7047L,7048L,7049L,
-     7050L,7051L,7052L,7053L,7054L,7055L,7056L,7057L,
-     7058L,7059L,7060L,7061L,7062L,7063L,7064L,7065L,
-     7066L,7067L,7068L,7069L,7070L,7071L,7072L,7073L,
-     7074L,7075L,7076L,7077L,7078L,7079L,7080L,7081L,
-     7082L,7083L,7084L,7085L,7086L,7087L,7088L,7089L,
-     7090L,7091L,7092L,7093L,7094L,7095L,7096L,7097L,
-     7098L,7099L,7100L,7101L,7102L,7103L,7104L,7105L,
-     7106L,7107L,7108L,7109L,7110L,7111L,7112L,7113L,
-     7114L,7114L,7115L,7116L,7117L,7118L,7119L,7120L,
-     7121L,7122L,7123L,7124L,7125L,7126L,7127L,7128L,
-     7129L,7130L,7131L,7132L,7133L,7134L,7135L,7136L,
-     7137L,7138L,7139L,7140L,7141L,7142L,7143L,7144L,
-     7145L,7146L,7147L,7148L,7149L,7150L,7151L,7152L,
-     7153L,7154L,7155L,7156L,7157L,7158L,7159L,7160L,
-     7161L,7162L,7163L,7164L,7165L,7166L,7167L,7168L,
-     7169L,7170L,7171L,7172L,7173L,7174L,7175L,7176L,
-     7177L,7178L,7179L,7180L,7181L,7182L,7183L,7184L,
-     7185L,7186L,7187L,7188L,7189L,7190L,7191L,7192L,
-     7193L,7194L,7195L,7196L,7197L,7198L,7199L,7200L,
-     7201L,7202L,7203L,7204L,7205L,7206L,7207L,7208L,
-     7209L,7210L,7211L,7212L,7213L,7214L,7215L,7216L,
-     7217L,7218L,7219L,7220L,7221L,7222L,7223L,7224L,
-     7225L,7226L,7227L,7228L,7229L,7230L,7231L,7232L,
-     7233L,7234L,7235L,7236L,7237L,7238L,7239L,7240L,
-     7241L,7242L,7243L,7244L,7245L,7246L,7247L,7248L,
-     7249L,7250L,7251L,7252L,7253L,7254L,7255L,7256L,
-     7257L,7258L,7259L,7260L,7261L,7262L,7263L,7264L,
-     7265L,7266L,7267L,7268L,7269L,7270L,7271L,7272L,
-     7273L,7274L,7275L,7276L,7277L,7278L,7279L,7279L,
-     7280L,7281L,7282L,7283L,7284L,7285L,7286L,7287L,
-     7288L,7289L,7290L,7291L,7292L,7293L,7294L,7295L,
-     7296L,7297L,7298L,7299L,7300L,7301L,7302L,7303L,
-     7304L,7305L,7306L,7307L,7308L,7309L,7310L,7311L,
-     7312L,7313L,7314L,7315L,7316L,7317L,7318L,7319L,
-     7320L,7321L,7322L,7323L,7324L,7325L,7326L,7327L,
-     7328L,7329L,7330L,7331L,7332L,7333L,7334L,7335L,
-     7336L,7337L,7338L,7339L,7340L,7341L,7342L,7343L,
-     7344L,7345L,7346L,7347L,7348L,7349L,7350L,7351L,
-     7352L,7353L,7354L,7355L,7356L,7357L,7358L,7359L,
-     7360L,7361L,7362L,7363L,7364L,7365L,7366L,7367L,
-     7368L,7369L,7370L,7371L,7372L,7373L,7374L,7375L,
-     7376L,7377L,7378L,7379L,7380L,7381L,7382L,7383L,
-     7384L,7385L,7386L,7387L,7388L,7389L,7390L,7391L,
-     7392L,7393L,7394L,7395L,7396L,7397L,7398L,7399L,
-     7400L,7401L,7402L,7403L,7404L,7405L,7406L,7407L,
-     7408L,7409L,7410L,7411L,7412L,7413L,7414L,7415L,
-     7416L,7417L,7418L,7419L,7420L,7421L,7422L,7423L,
-     7424L,7425L,7426L,7427L,7428L,7429L,7430L,7431L,
-     7432L,7433L,7434L,7435L,7436L,7436L,7437L,7438L,
-     7439L,7440L,7441L,7442L,7443L,7444L,7445L,7446L,
-     7447L,7448L,7449L,7450L,7451L,7452L,7453L,7454L,
-     7455L,7456L,7457L,7458L,7459L,7460L,7461L,7462L,
-     7463L,7464L,7465L,7466L,7467L,7468L,7469L,7470L,
-     7471L,7472L,7473L,7474L,7475L,7476L,7477L,7478L,
-     7479L,7480L,7481L,7482L,7483L,7484L,7485L,7486L,
-     7487L,7488L,7489L,7490L,7491L,7492L,7493L,7494L,
-     7495L,7496L,7497L,7498L,7499L,7500L,7501L,7502L,
-     7503L,7504L,7505L,7506L,7507L,7508L,7509L,7510L,
-     7511L,7512L,7513L,7514L,7515L,7516L,7517L,7518L,
-     7519L,7520L,7521L,7522L,7523L,7524L,7525L,7526L,
-     7527L,7528L,7529L,7530L,7531L,7532L,7533L,7534L,
-     7535L,7536L,7537L,7538L,7539L,7540L,7541L,7542L,
-     7543L,7544L,7545L,7546L,7547L,7548L,7549L,7550L,
-     7551L,7552L,7553L,7554L,7555L,7556L,7557L,7558L,
-     7559L,7560L,7561L,7562L,7563L,7564L,7565L,7566L,
-     7567L,7568L,7569L,7570L,7571L,7572L,7573L,7574L,
-     7575L,7576L,7577L,7578L,7579L,7580L,7581L,7582L,
-     7583L,7584L,7585L,7586L,7587L,7587L,7588L,7589L,
-     7590L,7591L,7592L,7593L,7594L,7595L,7596L,7597L,
-     7598L,7599L,7600L,7601L,7602L,7603L,7604L,7605L,
-     7606L,7607L,7608L,7609L,7610L,7611L,7612L,7613L,
-     7614L,7615L,7616L,7617L,7618L,7619L,7620L,7621L,
-     7622L,7623L,7624L,7625L,7626L,7627L,7628L,7629L,
-     7630L,7631L,7632L,7633L,7634L,7635L,7636L,7637L,
-     7638L,7639L,7640L,7641L,7642L,7643L,7644L,7645L,
-     7646L,7647L,7648L,7649L,7650L,7651L,7652L,7653L,
-     7654L,7655L,7656L,7657L,7658L,7659L,7660L,7661L,
-     7662L,7663L,7664L,7665L,7666L,7667L,7668L,7669L,
-     7670L,7671L,7672L,7673L,7674L,7675L,7676L,7677L,
-     7678L,7679L,7680L,7681L,7682L,7683L,7684L,7685L,
-     7686L,7687L,7688L,7689L,7690L,7691L,7692L,7693L,
-     7694L,7695L,7696L,7697L,7698L,7699L,7700L,7701L,
-     7702L,7703L,7704L,7705L,7706L,7707L,7708L,7709L,
-     7710L,7711L,7712L,7713L,7714L,7715L,7716L,7717L,
-     7718L,7719L,7720L,7721L,7722L,7723L,7724L,7725L,
-     7726L,7727L,7728L,7729L,7730L,7731L,7732L,7732L,
-     7733L,7734L,7735L,7736L,7737L,7738L,7739L,7740L,
-     7741L,7742L,7743L,7744L,7745L,7746L,7747L,7748L,
-     7749L,7750L,7751L,7752L,7753L,7754L,7755L,7756L,
-     7757L,7758L,7759L,7760L,7761L,7762L,7763L,7764L,
-     7765L,7766L,7767L,7768L,7769L,7770L,7771L,7772L,
-     7773L,7774L,7775L,7776L,7777L,7778L,7779L,7780L,
-     7781L,7782L,7783L,7784L,7785L,7786L,7787L,7788L,
-     7789L,7790L,7791L,7792L,7793L,7794L,7795L,7796L,
-     7797L,7798L,7799L,7800L,7801L,7802L,7803L,7804L,
-     7805L,7806L,7807L,7808L,7809L,7810L,7811L,7812L,
-     7813L,7814L,7815L,7816L,7817L,7818L,7819L,7820L,
-     7821L,7822L,7823L,7824L,7825L,7826L,7827L,7828L,
-     7829L,7830L,7831L,7832L,7833L,7834L,7835L,7836L,
-     7837L,7838L,7839L,7840L,7841L,7842L,7843L,7844L,
-     7845L,7846L,7847L,7848L,7849L,7850L,7851L,7852L,
-     7853L,7854L,7855L,7856L,7857L,7858L,7859L,7860L,
-     7861L,7862L,7863L,7864L,7865L,7866L,7867L,7868L,
-     7869L,7870L,7871L,7872L,7872L,7873L,7874L,7875L,
-     7876L,7877L,7878L,7879L,7880L,7881L,7882L,7883L,
-     7884L,7885L,7886L,7887L,7888L,7889L,7890L,7891L,
-     7892L,7893L,7894L,7895L,7896L,7897L,7898L,7899L,
-     7900L,7901L,7902L,7903L,7904L,7905L,7906L,7907L,
-     7908L,7909L,7910L,7911L,7912L,7913L,7914L,7915L,
-     7916L,7917L,7918L,7919L,7920L,7921L,7922L,7923L,
-     7924L,7925L,7926L,7927L,7928L,7929L,7930L,7931L,
-     7932L,7933L,7934L,7935L,7936L,7937L,7938L,7939L,
-     7940L,7941L,7942L,7943L,7944L,7945L,7946L,7947L,
-     7948L,7949L,7950L,7951L,7952L,7953L,7954L,7955L,
-     7956L,7957L,7958L,7959L,7960L,7961L,7962L,7963L,
-     7964L,7965L,7966L,7967L,7968L,7969L,7970L,7971L,
-     7972L,7973L,7974L,7975L,7976L,7977L,7978L,7979L,
-     7980L,7981L,7982L,7983L,7984L,7985L,7986L,7987L,
-     7988L,7989L,7990L,7991L,7992L,7993L,7994L,7995L,
-     7996L,7997L,7998L,7999L,8000L,8001L,8002L,8003L,
-     8004L,8005L,8006L,8006L,8007L,8008L,8009L,8010L,
-     8011L,8012L,8013L,8014L,8015L,8016L,8017L,8018L,
-     8019L,8020L,8021L,8022L,8023L,8024L,8025L,8026L,
-     8027L,8028L,8029L,8030L,8031L,8032L,8033L,8034L,
-     8035L,8036L,8037L,8038L,8039L,8040L,8041L,8042L,
-     8043L,8044L,8045L,8046L,8047L,8048L,8049L,8050L,
-     8051L,8052L,8053L,8054L,8055L,8056L,8057L,8058L,
-     8059L,8060L,8061L,8062L,8063L,8064L,8065L,8066L,
-     8067L,8068L,8069L,8070L,8071L,8072L,8073L,8074L,
-     8075L,8076L,8077L,8078L,8079L,8080L,8081L,8082L,
-     8083L,8084L,8085L,8086L,8087L,8088L,8089L,8090L,
-     8091L,8092L,8093L,8094L,8095L,8096L,8097L,8098L,
-     8099L,8100L,8101L,8102L,8103L,8104L,8105L,8106L,
-     8107L,8108L,8109L,8110L,8111L,8112L,8113L,8114L,
-     8115L,8116L,8117L,8118L,8119L,8120L,8121L,8122L,
-     8123L,8124L,8125L,8126L,8127L,8128L,8129L,8130L,
-     8131L,8132L,8133L,8134L,8135L,8136L,8137L,8137L,
-     8138L,8139L,8140L,8141L,8142L,8143L,8144L,8145L,
-     8146L,8147L,8148L,8149L,8150L,8151L,8152L,8153L,
-     8154L,8155L,8156L,8157L,8158L,8159L,8160L,8161L,
-     8162L,8163L,8164L,8165L,8166L,8167L,8168L,8169L,
-     8170L,8171L,8172L,8173L,8174L,8175L,8176L,8177L,
-     8178L,8179L,8180L,8181L,8182L,8183L,8184L,8185L,
-     8186L,8187L,8188L,8189L,8190L,8191L,8192L,8193L,
-     8194L,8195L,8196L,8197L,8198L,8199L,8200L,8201L,
-     8202L,8203L,8204L,8205L,8206L,8207L,8208L,8209L,
-     8210L,8211L,8212L,8213L,8214L,8215L,8216L,8217L,
-     8218L,8219L,8220L,8221L,8222L,8223L,8224L,8225L,
-     8226L,8227L,8228L,8229L,8230L,8231L,8232L,8233L,
-     8234L,8235L,8236L,8237L,8238L,8239L,8240L,8241L,
-     8242L,8243L,8244L,8245L,8246L,8247L,8248L,8249L,
-     8250L,8251L,8252L,8253L,8254L,8255L,8256L,8257L,
-     8258L,8259L,8260L,8261L,8262L,8263L,8263L,8264L,
-     8265L,8266L,8267L,8268L,8269L,8270L,8271L,8272L,
-     8273L,8274L,8275L,8276L,8277L,8278L,8279L,8280L,
-     8281L,8282L,8283L,8284L,8285L,8286L,8287L,8288L,
-     8289L,8290L,8291L,8292L,8293L,8294L,8295L,8296L,
-     8297L,8298L,8299L,8300L,8301L,8302L,8303L,8304L,
-     8305L,8306L,8307L,8308L,8309L,8310L,8311L,8312L,
-     8313L,8314L,8315L,8316L,8317L,8318L,8319L,8320L,
-     8321L,8322L,8323L,8324L,8325L,8326L,8327L,8328L,
-     8329L,8330L,8331L,8332L,8333L,8334L,8335L,8336L,
-     8337L,8338L,8339L,8340L,8341L,8342L,8343L,8344L,
-     8345L,8346L,8347L,8348L,8349L,8350L,8351L,8352L,
-     8353L,8354L,8355L,8356L,8357L,8358L,8359L,8360L,
-     8361L,8362L,8363L,8364L,8365L,8366L,8367L,8368L,
-     8369L,8370L,8371L,8372L,8373L,8374L,8375L,8376L,
-     8377L,8378L,8379L,8380L,8381L,8382L,8383L,8384L,
-     8385L,8386L,8386L,8387L,8388L,8389L,8390L,8391L,
-     8392L,8393L,8394L,8395L,8396L,8397L,8398L,8399L,
-     8400L,8401L,8402L,8403L,8404L,8405L,8406L,8407L,
-     8408L,8409L,8410L,8411L,8412L,8413L,8414L,8415L,
-     8416L,8417L,8418L,8419L,8420L,8421L,8422L,8423L,
-     8424L,8425L,8426L,8427L,8428L,8429L,8430L,8431L,
-     8432L,8433L,8434L,8435L,8436L,8437L,8438L,8439L,
-     8440L,8441L,8442L,8443L,8444L,8445L,8446L,8447L,
-     8448L,8449L,8450L,8451L,8452L,8453L,8454L,8455L,
-     8456L,8457L,8458L,8459L,8460L,8461L,8462L,8463L,
-     8464L,8465L,8466L,8467L,8468L,8469L,8470L,8471L,
-     8472L,8473L,8474L,8475L,8476L,8477L,8478L,8479L,
-     8480L,8481L,8482L,8483L,8484L,8485L,8486L,8487L,
-     8488L,8489L,8490L,8491L,8492L,8493L,8494L,8495L,
-     8496L,8497L,8498L,8499L,8500L,8501L,8502L,8503L,
-     8504L,8505L,8505L,8506L,8507L,8508L,8509L,8510L,
-     8511L,8512L,8513L,8514L,8515L,8516L,8517L,8518L,
-     8519L,8520L,8521L,8522L,8523L,8524L,8525L,8526L,
-     8527L,8528L,8529L,8530L,8531L,8532L,8533L,8534L,
-     8535L,8536L,8537L,8538L,8539L,8540L,8541L,8542L,
-     8543L,8544L,8545L,8546L,8547L,8548L,8549L,8550L,
-     8551L,8552L,8553L,8554L,8555L,8556L,8557L,8558L,
-     8559L,8560L,8561L,8562L,8563L,8564L,8565L,8566L,
-     8567L,8568L,8569L,8570L,8571L,8572L,8573L,8574L,
-     8575L,8576L,8577L,8578L,8579L,8580L,8581L,8582L,
-     8583L,8584L,8585L,8586L,8587L,8588L,8589L,8590L,
-     8591L,8592L,8593L,8594L,8595L,8596L,8597L,8598L,
-     8599L,8600L,8601L,8602L,8603L,8604L,8605L,8606L,
-     8607L,8608L,8609L,8610L,8611L,8612L,8613L,8614L,
-     8615L,8616L,8617L,8618L,8619L,8620L,8621L,8621L,
-     8622L,8623L,8624L,8625L,8626L,8627L,8628L,8629L,
-     8630L,8631L,8632L,8633L,8634L,8635L,8636L,8637L,
-     8638L,8639L,8640L,8641L,8642L,8643L,8644L,8645L,
-     8646L,8647L,8648L,8649L,8650L,8651L,8652L,8653L,
-     8654L,8655L,8656L,8657L,8658L,8659L,8660L,8661L,
-     8662L,8663L,8664L,8665L,8666L,8667L,8668L,8669L,
-     8670L,8671L,8672L,8673L,8674L,8675L,8676L,8677L,
-     8678L,8679L,8680L,8681L,8682L,8683L,8684L,8685L,
-     8686L,8687L,8688L,8689L,8690L,8691L,8692L,8693L,
-     8694L,8695L,8696L,8697L,8698L,8699L,8700L,8701L,
-     8702L,8703L,8704L,8705L,8706L,8707L,8708L,8709L,
-     8710L,8711L,8712L,8713L,8714L,8715L,8716L,8717L,
-     8718L,8719L,8720L,8721L,8722L,8723L,8724L,8725L,
-     8726L,8727L,8728L,8729L,8730L,8731L,8732L,8733L,
-     8733L,8734L,8735L,8736L,8737L,8738L,8739L,8740L,
-     8741L,8742L,8743L,8744L,8745L,8746L,8747L,8748L,
-     8749L,8750L,8751L,8752L,8753L,8754L,8755L,8756L,
-     8757L,8758L,8759L,8760L,8761L,8762L,8763L,8764L,
-     8765L,8766L,8767L,8768L,8769L,8770L,8771L,8772L,
-     8773L,8774L,8775L,8776L,8777L,8778L,8779L,8780L,
-     8781L,8782L,8783L,8784L,8785L,8786L,8787L,8788L,
-     8789L,8790L,8791L,8792L,8793L,8794L,8795L,8796L,
-     8797L,8798L,8799L,8800L,8801L,8802L,8803L,8804L,
-     8805L,8806L,8807L,8808L,8809L,8810L,8811L,8812L,
-     8813L,8814L,8815L,8816L,8817L,8818L,8819L,8820L,
-     8821L,8822L,8823L,8824L,8825L,8826L,8827L,8828L,
-     8829L,8830L,8831L,8832L,8833L,8834L,8835L,8836L,
-     8837L,8838L,8839L,8840L,8841L,8842L,8843L,8843L,
-     8844L,8845L,8846L,8847L,8848L,8849L,8850L,8851L,
-     8852L,8853L,8854L,8855L,8856L,8857L,8858L,8859L,
-     8860L,8861L,8862L,8863L,8864L,8865L,8866L,8867L,
-     8868L,8869L,8870L,8871L,8872L,8873L,8874L,8875L,
-     8876L,8877L,8878L,8879L,8880L,8881L,8882L,8883L,
-     8884L,8885L,8886L,8887L,8888L,8889L,8890L,8891L,
-     8892L,8893L,8894L,8895L,8896L,8897L,8898L,8899L,
-     8900L,8901L,8902L,8903L,8904L,8905L,8906L,8907L,
-     8908L,8909L,8910L,8911L,8912L,8913L,8914L,8915L,
-     8916L,8917L,8918L,8919L,8920L,8921L,8922L,8923L,
-     8924L,8925L,8926L,8927L,8928L,8929L,8930L,8931L,
-     8932L,8933L,8934L,8935L,8936L,8937L,8938L,8939L,
-     8940L,8941L,8942L,8943L,8944L,8945L,8946L,8947L,
-     8948L,8949L,8950L,8950L,8951L,8952L,8953L,8954L,
-     8955L,8956L,8957L,8958L,8959L,8960L,8961L,8962L,
-     8963L,8964L,8965L,8966L,8967L,8968L,8969L,8970L,
-     8971L,8972L,8973L,8974L,8975L,8976L,8977L,8978L,
-     8979L,8980L,8981L,8982L,8983L,8984L,8985L,8986L,
-     8987L,8988L,8989L,8990L,8991L,8992L,8993L,8994L,
-     8995L,8996L,8997L,8998L,8999L,9000L,9001L,9002L,
-     9003L,9004L,9005L,9006L,9007L,9008L,9009L,9010L,
-     9011L,9012L,9013L,9014L,9015L,9016L,9017L,9018L,
-     9019L,9020L,9021L,9022L,9023L,9024L,9025L,9026L,
-     9027L,9028L,9029L,9030L,9031L,9032L,9033L,9034L,
-     9035L,9036L,9037L,9038L,9039L,9040L,9041L,9042L,
-     9043L,9044L,9045L,9046L,9047L,9048L,9049L,9050L,
-     9051L,9052L,9053L,9054L,9055L,9055L,9056L,9057L,
-     9058L,9059L,9060L,9061L,9062L,9063L,9064L,9065L,
-     9066L,9067L,9068L,9069L,9070L,9071L,9072L,9073L,
-     9074L,9075L,9076L,9077L,9078L,9079L,9080L,9081L,
-     9082L,9083L,9084L,9085L,9086L,9087L,9088L,9089L,
-     9090L,9091L,9092L,9093L,9094L,9095L,9096L,9097L,
-     9098L,9099L,9100L,9101L,9102L,9103L,9104L,9105L,
-     9106L,9107L,9108L,9109L,9110L,9111L,9112L,9113L,
-     9114L,9115L,9116L,9117L,9118L,9119L,9120L,9121L,
-     9122L,9123L,9124L,9125L,9126L,9127L,9128L,9129L,
-     9130L,9131L,9132L,9133L,9134L,9135L,9136L,9137L,
-     9138L,9139L,9140L,9141L,9142L,9143L,9144L,9145L,
-     9146L,9147L,9148L,9149L,9150L,9151L,9152L,9153L,
-     9154L,9155L,9156L,9157L,9157L,9158L,9159L,9160L,
-     9161L,9162L,9163L,9164L,9165L,9166L,9167L,9168L,
-     9169L,9170L,9171L,9172L,9173L,9174L,9175L,9176L,
-     9177L,9178L,9179L,9180L,9181L,9182L,9183L,9184L,
-     9185L,9186L,9187L,9188L,9189L,9190L,9191L,9192L,
-     9193L,9194L,9195L,9196L,9197L,9198L,9199L,9200L,
-     9201L,9202L,9203L,9204L,9205L,9206L,9207L,9208L,
-     9209L,9210L,9211L,9212L,9213L,9214L,9215L,9216L,
-     9217L,9218L,9219L,9220L,9221L,9222L,9223L,9224L,
-     9225L,9226L,9227L,9228L,9229L,9230L,9231L,9232L,
-     9233L,9234L,9235L,9236L,9237L,9238L,9239L,9240L,
-     9241L,9242L,9243L,9244L,9245L,9246L,9247L,9248L,
-     9249L,9250L,9251L,9252L,9253L,9254L,9255L,9256L,
-     9257L,9257L,9258L,9259L,9260L,9261L,9262L,9263L,
-     9264L,9265L,9266L,9267L,9268L,9269L,9270L,9271L,
-     9272L,9273L,9274L,9275L,9276L,9277L,9278L,9279L,
-     9280L,9281L,9282L,9283L,9284L,9285L,9286L,9287L,
-     9288L,9289L,9290L,9291L,9292L,9293L,9294L,9295L,
-     9296L,9297L,9298L,9299L,9300L,9301L,9302L,9303L,
-     9304L,9305L,9306L,9307L,9308L,9309L,9310L,9311L,
-     9312L,9313L,9314L,9315L,9316L,9317L,9318L,9319L,
-     9320L,9321L,9322L,9323L,9324L,9325L,9326L,9327L,
-     9328L,9329L,9330L,9331L,9332L,9333L,9334L,9335L,
-     9336L,9337L,9338L,9339L,9340L,9341L,9342L,9343L,
-     9344L,9345L,9346L,9347L,9348L,9349L,9350L,9351L,
-     9352L,9353L,9354L,9354L,9355L,9356L,9357L,9358L,
-     9359L,9360L,9361L,9362L,9363L,9364L,9365L,9366L,
-     9367L,9368L,9369L,9370L,9371L,9372L,9373L,9374L,
-     9375L,9376L,9377L,9378L,9379L,9380L,9381L,9382L,
-     9383L,9384L,9385L,9386L,9387L,9388L,9389L,9390L,
-     9391L,9392L,9393L,9394L,9395L,9396L,9397L,9398L,
-     9399L,9400L,9401L,9402L,9403L,9404L,9405L,9406L,
-     9407L,9408L,9409L,9410L,9411L,9412L,9413L,9414L,
-     9415L,9416L,9417L,9418L,9419L,9420L,9421L,9422L,
-     9423L,9424L,9425L,9426L,9427L,9428L,9429L,9430L,
-     9431L,9432L,9433L,9434L,9435L,9436L,9437L,9438L,
-     9439L,9440L,9441L,9442L,9443L,9444L,9445L,9446L,
-     9447L,9448L,9449L,9450L,9450L,9451L,9452L,9453L,
-     9454L,9455L,9456L,9457L,9458L,9459L,9460L,9461L,
-     9462L,9463L,9464L,9465L,9466L,9467L,9468L,9469L,
-     9470L,9471L,9472L,9473L,9474L,9475L,9476L,9477L,
-     9478L,9479L,9480L,9481L,9482L,9483L,9484L,9485L,
-     9486L,9487L,9488L,9489L,9490L,9491L,9492L,9493L,
-     9494L,9495L,9496L,9497L,9498L,9499L,9500L,9501L,
-     9502L,9503L,9504L,9505L,9506L,9507L,9508L,9509L,
-     9510L,9511L,9512L,9513L,9514L,9515L,9516L,9517L,
-     9518L,9519L,9520L,9521L,9522L,9523L,9524L,9525L,
-     9526L,9527L,9528L,9529L,9530L,9531L,9532L,9533L,
-     9534L,9535L,9536L,9537L,9538L,9539L,9540L,9541L,
-     9542L,9543L,9544L,9544L,9545L,9546L,9547L,9548L,
-     9549L,9550L,9551L,9552L,9553L,9554L,9555L,9556L,
-     9557L,9558L,9559L,9560L,9561L,9562L,9563L,9564L,
-     9565L,9566L,9567L,9568L,9569L,9570L,9571L,9572L,
-     9573L,9574L,9575L,9576L,9577L,9578L,9579L,9580L,
-     9581L,9582L,9583L,9584L,9585L,9586L,9587L,9588L,
-     9589L,9590L,9591L,9592L,9593L,9594L,9595L,9596L,
-     9597L,9598L,9599L,9600L,9601L,9602L,9603L,9604L,
-     9605L,9606L,9607L,9608L,9609L,9610L,9611L,9612L,
-     9613L,9614L,9615L,9616L,9617L,9618L,9619L,9620L,
-     9621L,9622L,9623L,9624L,9625L,9626L,9627L,9628L,
-     9629L,9630L,9631L,9632L,9633L,9634L,9635L,9636L,
-     9636L,9637L,9638L,9639L,9640L,9641L,9642L,9643L,
-     9644L,9645L,9646L,9647L,9648L,9649L,9650L,9651L,
-     9652L,9653L,9654L,9655L,9656L,9657L,9658L,9659L,
-     9660L,9661L,9662L,9663L,9664L,9665L,9666L,9667L,
-     9668L,9669L,9670L,9671L,9672L,9673L,9674L,9675L,
-     9676L,9677L,9678L,9679L,9680L,9681L,9682L,9683L,
-     9684L,9685L,9686L,9687L,9688L,9689L,9690L,9691L,
-     9692L,9693L,9694L,9695L,9696L,9697L,9698L,9699L,
-     9700L,9701L,9702L,9703L,9704L,9705L,9706L,9707L,
-     9708L,9709L,9710L,9711L,9712L,9713L,9714L,9715L,
-     9716L,9717L,9718L,9719L,9720L,9721L,9722L,9723L,
-     9724L,9725L,9726L,9726L,9727L,9728L,9729L,9730L,
-     9731L,9732L,9733L,9734L,9735L,9736L,9737L,9738L,
-     9739L,9740L,9741L,9742L,9743L,9744L,9745L,9746L,
-     9747L,9748L,9749L,9750L,9751L,9752L,9753L,9754L,
-     9755L,9756L,9757L,9758L,9759L,9760L,9761L,9762L,
-     9763L,9764L,9765L,9766L,9767L,9768L,9769L,9770L,
-     9771L,9772L,9773L,9774L,9775L,9776L,9777L,9778L,
-     9779L,9780L,9781L,9782L,9783L,9784L,9785L,9786L,
-     9787L,9788L,9789L,9790L,9791L,9792L,9793L,9794L,
-     9795L,9796L,9797L,9798L,9799L,9800L,9801L,9802L,
-     9803L,9804L,9805L,9806L,9807L,9808L,9809L,9810L,
-     9811L,9812L,9813L,9814L,9815L,9815L,9816L,9817L,
-     9818L,9819L,9820L,9821L,9822L,9823L,9824L,9825L,
-     9826L,9827L,9828L,9829L,9830L,9831L,9832L,9833L,
-     9834L,9835L,9836L,9837L,9838L,9839L,9840L,9841L,
-     9842L,9843L,9844L,9845L,9846L,9847L,9848L,9849L,
-     9850L,9851L,9852L,9853L,9854L,9855L,9856L,9857L,
-     9858L,9859L,9860L,9861L,9862L,9863L,9864L,9865L,
-     9866L,9867L,9868L,9869L,9870L,9871L,9872L,9873L,
-     9874L,9875L,9876L,9877L,9878L,9879L,9880L,9881L,
-     9882L,9883L,9884L,9885L,9886L,9887L,9888L,9889L,
-     9890L,9891L,9892L,9893L,9894L,9895L,9896L,9897L,
-     9898L,9899L,9900L,9901L,9902L,9902L,9903L,9904L,
-     9905L,9906L,9907L,9908L,9909L,9910L,9911L,9912L,
-     9913L,9914L,9915L,9916L,9917L,9918L,9919L,9920L,
-     9921L,9922L,9923L,9924L,9925L,9926L,9927L,9928L,
-     9929L,9930L,9931L,9932L,9933L,9934L,9935L,9936L,
-     9937L,9938L,9939L,9940L,9941L,9942L,9943L,9944L,
-     9945L,9946L,9947L,9948L,9949L,9950L,9951L,9952L,
-     9953L,9954L,9955L,9956L,9957L,9958L,9959L,9960L,
-     9961L,9962L,9963L,9964L,9965L,9966L,9967L,9968L,
-     9969L,9970L,9971L,9972L,9973L,9974L,9975L,9976L,
-     9977L,9978L,9979L,9980L,9981L,9982L,9983L,9984L,
-     9985L,9986L,9987L,9987L,9988L,9989L,9990L,9991L,
-     9992L,9993L,9994L,9995L,9996L,9997L,9998L,9999L,
-     10000L,10001L,10002L,10003L,10004L,10005L,10006L,10007L,
-     10008L,10009L,10010L,10011L,10012L,10013L,10014L,10015L,
-     10016L,10017L,10018L,10019L,10020L,10021L,10022L,10023L,
-     10024L,10025L,10026L,10027L,10028L,10029L,10030L,10031L,
-     10032L,10033L,10034L,10035L,10036L,10037L,10038L,10039L,
-     10040L,10041L,10042L,10043L,10044L,10045L,10046L,10047L,
-     10048L,10049L,10050L,10051L,10052L,10053L,10054L,10055L,
-     10056L,10057L,10058L,10059L,10060L,10061L,10062L,10063L,
-     10064L,10065L,10066L,10067L,10068L,10069L,10070L,10071L,
-     10071L,10072L,10073L,10074L,10075L,10076L,10077L,10078L,
-     10079L,10080L,10081L,10082L,10083L,10084L,10085L,10086L,
-     10087L,10088L,10089L,10090L,10091L,10092L,10093L,10094L,
-     10095L,10096L,10097L,10098L,10099L,10100L,10101L,10102L,
-     10103L,10104L,10105L,10106L,10107L,10108L,10109L,10110L,
-     10111L,10112L,10113L,10114L,10115L,10116L,10117L,10118L,
-     10119L,10120L,10121L,10122L,10123L,10124L,10125L,10126L,
-     10127L,10128L,10129L,10130L,10131L,10132L,10133L,10134L,
-     10135L,10136L,10137L,10138L,10139L,10140L,10141L,10142L,
-     10143L,10144L,10145L,10146L,10147L,10148L,10149L,10150L,
-     10151L,10152L,10153L,10153L,10154L,10155L,10156L,10157L,
-     10158L,10159L,10160L,10161L,10162L,10163L,10164L,10165L,
-     10166L,10167L,10168L,10169L,10170L,10171L,10172L,10173L,
-     10174L,10175L,10176L,10177L,10178L,10179L,10180L,10181L,
-     10182L,10183L,10184L,10185L,10186L,10187L,10188L,10189L,
-     10190L,10191L,10192L,10193L,10194L,10195L,10196L,10197L,
-     10198L,10199L,10200L,10201L,10202L,10203L,10204L,10205L,
-     10206L,10207L,10208L,10209L,10210L,10211L,10212L,10213L,
-     10214L,10215L,10216L,10217L,10218L,10219L,10220L,10221L,
-     10222L,10223L,10224L,10225L,10226L,10227L,10228L,10229L,
-     10230L,10231L,10232L,10233L,10234L,10235L,10235L,10236L,
-     10237L,10238L,10239L,10240L,10241L,10242L,10243L,10244L,
-     10245L,10246L,10247L,10248L,10249L,10250L,10251L,10252L,
-     10253L,10254L,10255L,10256L,10257L,10258L,10259L,10260L,
-     10261L,10262L,10263L,10264L,10265L,10266L,10267L,10268L,
-     10269L,10270L,10271L,10272L,10273L,10274L,10275L,10276L,
-     10277L,10278L,10279L,10280L,10281L,10282L,10283L,10284L,
-     10285L,10286L,10287L,10288L,10289L,10290L,10291L,10292L,
-     10293L,10294L,10295L,10296L,10297L,10298L,10299L,10300L,
-     10301L,10302L,10303L,10304L,10305L,10306L,10307L,10308L,
-     10309L,10310L,10311L,10312L,10313L,10314L,10315L,10315L,
-     10316L,10317L,10318L,10319L,10320L,10321L,10322L,10323L,
-     10324L,10325L,10326L,10327L,10328L,10329L,10330L,10331L,
-     10332L,10333L,10334L,10335L,10336L,10337L,10338L,10339L,
-     10340L,10341L,10342L,10343L,10344L,10345L,10346L,10347L,
-     10348L,10349L,10350L,10351L,10352L,10353L,10354L,10355L,
-     10356L,10357L,10358L,10359L,10360L,10361L,10362L,10363L,
-     10364L,10365L,10366L,10367L,10368L,10369L,10370L,10371L,
-     10372L,10373L,10374L,10375L,10376L,10377L,10378L,10379L,
-     10380L,10381L,10382L,10383L,10384L,10385L,10386L,10387L,
-     10388L,10389L,10390L,10391L,10392L,10393L,10393L,10394L,
-     10395L,10396L,10397L,10398L,10399L,10400L,10401L,10402L,
-     10403L,10404L,10405L,10406L,10407L,10408L,10409L,10410L,
-     10411L,10412L,10413L,10414L,10415L,10416L,10417L,10418L,
-     10419L,10420L,10421L,10422L,10423L,10424L,10425L,10426L,
-     10427L,10428L,10429L,10430L,10431L,10432L,10433L,10434L,
-     10435L,10436L,10437L,10438L,10439L,10440L,10441L,10442L,
-     10443L,10444L,10445L,10446L,10447L,10448L,10449L,10450L,
-     10451L,10452L,10453L,10454L,10455L,10456L,10457L,10458L,
-     10459L,10460L,10461L,10462L,10463L,10464L,10465L,10466L,
-     10467L,10468L,10469L,10470L,10471L,10471L,10472L,10473L,
-     10474L,10475L,10476L,10477L,10478L,10479L,10480L,10481L,
-     10482L,10483L,10484L,10485L,10486L,10487L,10488L,10489L,
-     10490L,10491L,10492L,10493L,10494L,10495L,10496L,10497L,
-     10498L,10499L,10500L,10501L,10502L,10503L,10504L,10505L,
-     10506L,10507L,10508L,10509L,10510L,10511L,10512L,10513L,
-     10514L,10515L,10516L,10517L,10518L,10519L,10520L,10521L,
-     10522L,10523L,10524L,10525L,10526L,10527L,10528L,10529L,
-     10530L,10531L,10532L,10533L,10534L,10535L,10536L,10537L,
-     10538L,10539L,10540L,10541L,10542L,10543L,10544L,10545L,
-     10546L,10547L,10547L,10548L,10549L,10550L,10551L,10552L,
-     10553L,10554L,10555L,10556L,10557L,10558L,10559L,10560L,
-     10561L,10562L,10563L,10564L,10565L,10566L,10567L,10568L,
-     10569L,10570L,10571L,10572L,10573L,10574L,10575L,10576L,
-     10577L,10578L,10579L,10580L,10581L,10582L,10583L,10584L,
-     10585L,10586L,10587L,10588L,10589L,10590L,10591L,10592L,
-     10593L,10594L,10595L,10596L,10597L,10598L,10599L,10600L,
-     10601L,10602L,10603L,10604L,10605L,10606L,10607L,10608L,
-     10609L,10610L,10611L,10612L,10613L,10614L,10615L,10616L,
-     10617L,10618L,10619L,10620L,10621L,10622L,10622L,10623L,
-     10624L,10625L,10626L,10627L,10628L,10629L,10630L,10631L,
-     10632L,10633L,10634L,10635L,10636L,10637L,10638L,10639L,
-     10640L,10641L,10642L,10643L,10644L,10645L,10646L,10647L,
-     10648L,10649L,10650L,10651L,10652L,10653L,10654L,10655L,
-     10656L,10657L,10658L,10659L,10660L,10661L,10662L,10663L,
-     10664L,10665L,10666L,10667L,10668L,10669L,10670L,10671L,
-     10672L,10673L,10674L,10675L,10676L,10677L,10678L,10679L,
-     10680L,10681L,10682L,10683L,10684L,10685L,10686L,10687L,
-     10688L,10689L,10690L,10691L,10692L,10693L,10694L,10695L,
-     10696L,10696L,10697L,10698L,10699L,10700L,10701L,10702L,
-     10703L,10704L,10705L,10706L,10707L,10708L,10709L,10710L,
-     10711L,10712L,10713L,10714L,10715L,10716L,10717L,10718L,
-     10719L,10720L,10721L,10722L,10723L,10724L,10725L,10726L,
-     10727L,10728L,10729L,10730L,10731L,10732L,10733L,10734L,
-     10735L,10736L,10737L,10738L,10739L,10740L,10741L,10742L,
-     10743L,10744L,10745L,10746L,10747L,10748L,10749L,10750L,
-     10751L,10752L,10753L,10754L,10755L,10756L,10757L,10758L,
-     10759L,10760L,10761L,10762L,10763L,10764L,10765L,10766L,
-     10767L,10768L,10769L,10769L,10770L,10771L,10772L,10773L,
-     10774L,10775L,10776L,10777L,10778L,10779L,10780L,10781L,
-     10782L,10783L,10784L,10785L,10786L,10787L,10788L,10789L,
-     10790L,10791L,10792L,10793L,10794L,10795L,10796L,10797L,
-     10798L,10799L,10800L,10801L,10802L,10803L,10804L,10805L,
-     10806L,10807L,10808L,10809L,10810L,10811L,10812L,10813L,
-     10814L,10815L,10816L,10817L,10818L,10819L,10820L,10821L,
-     10822L,10823L,10824L,10825L,10826L,10827L,10828L,10829L,
-     10830L,10831L,10832L,10833L,10834L,10835L,10836L,10837L,
-     10838L,10839L,10840L,10841L,10841L,10842L,10843L,10844L,
-     10845L,10846L,10847L,10848L,10849L,10850L,10851L,10852L,
-     10853L,10854L,10855L,10856L,10857L,10858L,10859L,10860L,
-     10861L,10862L,10863L,10864L,10865L,10866L,10867L,10868L,
-     10869L,10870L,10871L,10872L,10873L,10874L,10875L,10876L,
-     10877L,10878L,10879L,10880L,10881L,10882L,10883L,10884L,
-     10885L,10886L,10887L,10888L,10889L,10890L,10891L,10892L,
-     10893L,10894L,10895L,10896L,10897L,10898L,10899L,10900L,
-     10901L,10902L,10903L,10904L,10905L,10906L,10907L,10908L,
-     10909L,10910L,10911L,10912L,10913L,10913L,10914L,10915L,
-     10916L,10917L,10918L,10919L,10920L,10921L,10922L,10923L,
-     10924L,10925L,10926L,10927L,10928L,10929L,10930L,10931L,
-     10932L,10933L,10934L,10935L,10936L,10937L,10938L,10939L,
-     10940L,10941L,10942L,10943L,10944L,10945L,10946L,10947L,
-     10948L,10949L,10950L,10951L,10952L,10953L,10954L,10955L,
-     10956L,10957L,10958L,10959L,10960L,10961L,10962L,10963L,
-     10964L,10965L,10966L,10967L,10968L,10969L,10970L,10971L,
-     10972L,10973L,10974L,10975L,10976L,10977L,10978L,10979L,
-     10980L,10981L,10982L,10983L,10983L,10984L,10985L,10986L,
-     10987L,10988L,10989L,10990L,10991L,10992L,10993L,10994L,
-     10995L,10996L,10997L,10998L,10999L,11000L,11001L,11002L,
-     11003L,11004L,11005L,11006L,11007L,11008L,11009L,11010L,
-     11011L,11012L,11013L,11014L,11015L,11016L,11017L,11018L,
-     11019L,11020L,11021L,11022L,11023L,11024L,11025L,11026L,
-     11027L,11028L,11029L,11030L,11031L,11032L,11033L,11034L,
-     11035L,11036L,11037L,11038L,11039L,11040L,11041L,11042L,
-     11043L,11044L,11045L,11046L,11047L,11048L,11049L,11050L,
-     11051L,11052L,11052L,11053L,11054L,11055L,11056L,11057L,
-     11058L,11059L,11060L,11061L,11062L,11063L,11064L,11065L,
-     11066L,11067L,11068L,11069L,11070L,11071L,11072L,11073L,
-     11074L,11075L,11076L,11077L,11078L,11079L,11080L,11081L,
-     11082L,11083L,11084L,11085L,11086L,11087L,11088L,11089L,
-     11090L,11091L,11092L,11093L,11094L,11095L,11096L,11097L,
-     11098L,11099L,11100L,11101L,11102L,11103L,11104L,11105L,
-     11106L,11107L,11108L,11109L,11110L,11111L,11112L,11113L,
-     11114L,11115L,11116L,11117L,11118L,11119L,11120L,11121L,
-     11121L,11122L,11123L,11124L,11125L,11126L,11127L,11128L,
-     11129L,11130L,11131L,11132L,11133L,11134L,11135L,11136L,
-     11137L,11138L,11139L,11140L,11141L,11142L,11143L,11144L,
-     11145L,11146L,11147L,11148L,11149L,11150L,11151L,11152L,
-     11153L,11154L,11155L,11156L,11157L,11158L,11159L,11160L,
-     11161L,11162L,11163L,11164L,11165L,11166L,11167L,11168L,
-     11169L,11170L,11171L,11172L,11173L,11174L,11175L,11176L,
-     11177L,11178L,11179L,11180L,11181L,11182L,11183L,11184L,
-     11185L,11186L,11187L,11188L,11188L,11189L,11190L,11191L,
-     11192L,11193L,11194L,11195L,11196L,11197L,11198L,11199L,
-     11200L,11201L,11202L,11203L,11204L,11205L,11206L,11207L,
-     11208L,11209L,11210L,11211L,11212L,11213L,11214L,11215L,
-     11216L,11217L,11218L,11219L,11220L,11221L,11222L,11223L,
-     11224L,11225L,11226L,11227L,11228L,11229L,11230L,11231L,
-     11232L,11233L,11234L,11235L,11236L,11237L,11238L,11239L,
-     11240L,11241L,11242L,11243L,11244L,11245L,11246L,11247L,
-     11248L,11249L,11250L,11251L,11252L,11253L,11254L,11255L,
-     11255L,11256L,11257L,11258L,11259L,11260L,11261L,11262L,
-     11263L,11264L,11265L,11266L,11267L,11268L,11269L,11270L,
-     11271L,11272L,11273L,11274L,11275L,11276L,11277L,11278L,
-     11279L,11280L,11281L,11282L,11283L,11284L,11285L,11286L,
-     11287L,11288L,11289L,11290L,11291L,11292L,11293L,11294L,
-     11295L,11296L,11297L,11298L,11299L,11300L,11301L,11302L,
-     11303L,11304L,11305L,11306L,11307L,11308L,11309L,11310L,
-     11311L,11312L,11313L,11314L,11315L,11316L,11317L,11318L,
-     11319L,11320L,11321L,11321L,11322L,11323L,11324L,11325L,
-     11326L,11327L,11328L,11329L,11330L,11331L,11332L,11333L,
-     11334L,11335L,11336L,11337L,11338L,11339L,11340L,11341L,
-     11342L,11343L,11344L,11345L,11346L,11347L,11348L,11349L,
-     11350L,11351L,11352L,11353L,11354L,11355L,11356L,11357L,
-     11358L,11359L,11360L,11361L,11362L,11363L,11364L,11365L,
-     11366L,11367L,11368L,11369L,11370L,11371L,11372L,11373L,
-     11374L,11375L,11376L,11377L,11378L,11379L,11380L,11381L,
-     11382L,11383L,11384L,11385L,11386L,11386L,11387L,11388L,
-     11389L,11390L,11391L,11392L,11393L,11394L,11395L,11396L,
-     11397L,11398L,11399L,11400L,11401L,11402L,11403L,11404L,
-     11405L,11406L,11407L,11408L,11409L,11410L,11411L,11412L,
-     11413L,11414L,11415L,11416L,11417L,11418L,11419L,11420L,
-     11421L,11422L,11423L,11424L,11425L,11426L,11427L,11428L,
-     11429L,11430L,11431L,11432L,11433L,11434L,11435L,11436L,
-     11437L,11438L,11439L,11440L,11441L,11442L,11443L,11444L,
-     11445L,11446L,11447L,11448L,11449L,11450L,11450L,11451L,
-     11452L,11453L,11454L,11455L,11456L,11457L,11458L,11459L,
-     11460L,11461L,11462L,11463L,11464L,11465L,11466L,11467L,
-     11468L,11469L,11470L,11471L,11472L,11473L,11474L,11475L,
-     11476L,11477L,11478L,11479L,11480L,11481L,11482L,11483L,
-     11484L,11485L,11486L,11487L,11488L,11489L,11490L,11491L,
-     11492L,11493L,11494L,11495L,11496L,11497L,11498L,11499L,
-     11500L,11501L,11502L,11503L,11504L,11505L,11506L,11507L,
-     11508L,11509L,11510L,11511L,11512L,11513L,11514L,11514L,
-     11515L,11516L,11517L,11518L,11519L,11520L,11521L,11522L,
-     11523L,11524L,11525L,11526L,11527L,11528L,11529L,11530L,
-     11531L,11532L,11533L,11534L,11535L,11536L,11537L,11538L,
-     11539L,11540L,11541L,11542L,11543L,11544L,11545L,11546L,
-     11547L,11548L,11549L,11550L,11551L,11552L,11553L,11554L,
-     11555L,11556L,11557L,11558L,11559L,11560L,11561L,11562L,
-     11563L,11564L,11565L,11566L,11567L,11568L,11569L,11570L,
-     11571L,11572L,11573L,11574L,11575L,11576L,11577L,11577L,
-     11578L,11579L,11580L,11581L,11582L,11583L,11584L,11585L,
-     11586L,11587L,11588L,11589L,11590L,11591L,11592L,11593L,
-     11594L,11595L,11596L,11597L,11598L,11599L,11600L,11601L,
-     11602L,11603L,11604L,11605L,11606L,11607L,11608L,11609L,
-     11610L,11611L,11612L,11613L,11614L,11615L,11616L,11617L,
-     11618L,11619L,11620L,11621L,11622L,11623L,11624L,11625L,
-     11626L,11627L,11628L,11629L,11630L,11631L,11632L,11633L,
-     11634L,11635L,11636L,11637L,11638L,11639L,11639L,11640L,
-     11641L,11642L,11643L,11644L,11645L,11646L,11647L,11648L,
-     11649L,11650L,11651L,11652L,11653L,11654L,11655L,11656L,
-     11657L,11658L,11659L,11660L,11661L,11662L,11663L,11664L,
-     11665L,11666L,11667L,11668L,11669L,11670L,11671L,11672L,
-     11673L,11674L,11675L,11676L,11677L,11678L,11679L,11680L,
-     11681L,11682L,11683L,11684L,11685L,11686L,11687L,11688L,
-     11689L,11690L,11691L,11692L,11693L,11694L,11695L,11696L,
-     11697L,11698L,11699L,11700L,11701L,11701L,11702L,11703L,
-     11704L,11705L,11706L,11707L,11708L,11709L,11710L,11711L,
-     11712L,11713L,11714L,11715L,11716L,11717L,11718L,11719L,
-     11720L,11721L,11722L,11723L,11724L,11725L,11726L,11727L,
-     11728L,11729L,11730L,11731L,11732L,11733L,11734L,11735L,
-     11736L,11737L,11738L,11739L,11740L,11741L,11742L,11743L,
-     11744L,11745L,11746L,11747L,11748L,11749L,11750L,11751L,
-     11752L,11753L,11754L,11755L,11756L,11757L,11758L,11759L,
-     11760L,11761L,11762L,11762L,11763L,11764L,11765L,11766L,
-     11767L,11768L,11769L,11770L,11771L,11772L,11773L,11774L,
-     11775L,11776L,11777L,11778L,11779L,11780L,11781L,11782L,
-     11783L,11784L,11785L,11786L,11787L,11788L,11789L,11790L,
-     11791L,11792L,11793L,11794L,11795L,11796L,11797L,11798L,
-     11799L,11800L,11801L,11802L,11803L,11804L,11805L,11806L,
-     11807L,11808L,11809L,11810L,11811L,11812L,11813L,11814L,
-     11815L,11816L,11817L,11818L,11819L,11820L,11821L,11822L,
-     11822L,11823L,11824L,11825L,11826L,11827L,11828L,11829L,
-     11830L,11831L,11832L,11833L,11834L,11835L,11836L,11837L,
-     11838L,11839L,11840L,11841L,11842L,11843L,11844L,11845L,
-     11846L,11847L,11848L,11849L,11850L,11851L,11852L,11853L,
-     11854L,11855L,11856L,11857L,11858L,11859L,11860L,11861L,
-     11862L,11863L,11864L,11865L,11866L,11867L,11868L,11869L,
-     11870L,11871L,11872L,11873L,11874L,11875L,11876L,11877L,
-     11878L,11879L,11880L,11881L,11882L,11882L,11883L,11884L,
-     11885L,11886L,11887L,11888L,11889L,11890L,11891L,11892L,
-     11893L,11894L,11895L,11896L,11897L,11898L,11899L,11900L,
-     11901L,11902L,11903L,11904L,11905L,11906L,11907L,11908L,
-     11909L,11910L,11911L,11912L,11913L,11914L,11915L,11916L,
-     11917L,11918L,11919L,11920L,11921L,11922L,11923L,11924L,
-     11925L,11926L,11927L,11928L,11929L,11930L,11931L,11932L,
-     11933L,11934L,11935L,11936L,11937L,11938L,11939L,11940L,
-     11941L,11941L,11942L,11943L,11944L,11945L,11946L,11947L,
-     11948L,11949L,11950L,11951L,11952L,11953L,11954L,11955L,
-     11956L,11957L,11958L,11959L,11960L,11961L,11962L,11963L,
-     11964L,11965L,11966L,11967L,11968L,11969L,11970L,11971L,
-     11972L,11973L,11974L,11975L,11976L,11977L,11978L,11979L,
-     11980L,11981L,11982L,11983L,11984L,11985L,11986L,11987L,
-     11988L,11989L,11990L,11991L,11992L,11993L,11994L,11995L,
-     11996L,11997L,11998L,11999L,11999L,12000L,12001L,12002L,
-     12003L,12004L,12005L,12006L,12007L,12008L,12009L,12010L,
-     12011L,12012L,12013L,12014L,12015L,12016L,12017L,12018L,
-     12019L,12020L,12021L,12022L,12023L,12024L,12025L,12026L,
-     12027L,12028L,12029L,12030L,12031L,12032L,12033L,12034L,
-     12035L,12036L,12037L,12038L,12039L,12040L,12041L,12042L,
-     12043L,12044L,12045L,12046L,12047L,12048L,12049L,12050L,
-     12051L,12052L,12053L,12054L,12055L,12056L,12057L,12057L,
-     12058L,12059L,12060L,12061L,12062L,12063L,12064L,12065L,
-     12066L,12067L,12068L,12069L,12070L,12071L,12072L,12073L,
-     12074L,12075L,12076L,12077L,12078L,12079L,12080L,12081L,
-     12082L,12083L,12084L,12085L,12086L,12087L,12088L,12089L,
-     12090L,12091L,12092L,12093L,12094L,12095L,12096L,12097L,
-     12098L,12099L,12100L,12101L,12102L,12103L,12104L,12105L,
-     12106L,12107L,12108L,12109L,12110L,12111L,12112L,12113L,
-     12114L,12114L,12115L,12116L,12117L,12118L,12119L,12120L,
-     12121L,12122L,12123L,12124L,12125L,12126L,12127L,12128L,
-     12129L,12130L,12131L,12132L,12133L,12134L,12135L,12136L,
-     12137L,12138L,12139L,12140L,12141L,12142L,12143L,12144L,
-     12145L,12146L,12147L,12148L,12149L,12150L,12151L,12152L,
-     12153L,12154L,12155L,12156L,12157L,12158L,12159L,12160L,
-     12161L,12162L,12163L,12164L,12165L,12166L,12167L,12168L,
-     12169L,12170L,12171L,12171L,12172L,12173L,12174L,12175L,
-     12176L,12177L,12178L,12179L,12180L,12181L,12182L,12183L,
-     12184L,12185L,12186L,12187L,12188L,12189L,12190L,12191L,
-     12192L,12193L,12194L,12195L,12196L,12197L,12198L,12199L,
-     12200L,12201L,12202L,12203L,12204L,12205L,12206L,12207L,
-     12208L,12209L,12210L,12211L,12212L,12213L,12214L,12215L,
-     12216L,12217L,12218L,12219L,12220L,12221L,12222L,12223L,
-     12224L,12225L,12226L,12227L,12227L,12228L,12229L,12230L,
-     12231L,12232L,12233L,12234L,12235L,12236L,12237L,12238L,
-     12239L,12240L,12241L,12242L,12243L,12244L,12245L,12246L,
-     12247L,12248L,12249L,12250L,12251L,12252L,12253L,12254L,
-     12255L,12256L,12257L,12258L,12259L,12260L,12261L,12262L,
-     12263L,12264L,12265L,12266L,12267L,12268L,12269L,12270L,
-     12271L,12272L,12273L,12274L,12275L,12276L,12277L,12278L,
-     12279L,12280L,12281L,12282L,12283L,12283L,12284L,12285L,
-     12286L,12287L,12288L,12289L,12290L,12291L,12292L,12293L,
-     12294L,12295L,12296L,12297L,12298L,12299L,12300L,12301L,
-     12302L,12303L,12304L,12305L,12306L,12307L,12308L,12309L,
-     12310L,12311L,12312L,12313L,12314L,12315L,12316L,12317L,
-     12318L,12319L,12320L,12321L,12322L,12323L,12324L,12325L,
-     12326L,12327L,12328L,12329L,12330L,12331L,12332L,12333L,
-     12334L,12335L,12336L,12337L,12338L,12338L,12339L,12340L,
-     12341L,12342L,12343L,12344L,12345L,12346L,12347L,12348L,
-     12349L,12350L,12351L,12352L,12353L,12354L,12355L,12356L,
-     12357L,12358L,12359L,12360L,12361L,12362L,12363L,12364L,
-     12365L,12366L,12367L,12368L,12369L,12370L,12371L,12372L,
-     12373L,12374L,12375L,12376L,12377L,12378L,12379L,12380L,
-     12381L,12382L,12383L,12384L,12385L,12386L,12387L,12388L,
-     12389L,12390L,12391L,12392L,12393L,12393L,12394L,12395L,
-     12396L,12397L,12398L,12399L,12400L,12401L,12402L,12403L,
-     12404L,12405L,12406L,12407L,12408L,12409L,12410L,12411L,
-     12412L,12413L,12414L,12415L,12416L,12417L,12418L,12419L,
-     12420L,12421L,12422L,12423L,12424L,12425L,12426L,12427L,
-     12428L,12429L,12430L,12431L,12432L,12433L,12434L,12435L,
-     12436L,12437L,12438L,12439L,12440L,12441L,12442L,12443L,
-     12444L,12445L,12446L,12447L,12447L,12448L,12449L,12450L,
-     12451L,12452L,12453L,12454L,12455L,12456L,12457L,12458L,
-     12459L,12460L,12461L,12462L,12463L,12464L,12465L,12466L,
-     12467L,12468L,12469L,12470L,12471L,12472L,12473L,12474L,
-     12475L,12476L,12477L,12478L,12479L,12480L,12481L,12482L,
-     12483L,12484L,12485L,12486L,12487L,12488L,12489L,12490L,
-     12491L,12492L,12493L,12494L,12495L,12496L,12497L,12498L,
-     12499L,12500L,12501L,12501L,12502L,12503L,12504L,12505L,
-     12506L,12507L,12508L,12509L,12510L,12511L,12512L,12513L,
-     12514L,12515L,12516L,12517L,12518L,12519L,12520L,12521L,
-     12522L,12523L,12524L,12525L,12526L,12527L,12528L,12529L,
-     12530L,12531L,12532L,12533L,12534L,12535L,12536L,12537L,
-     12538L,12539L,12540L,12541L,12542L,12543L,12544L,12545L,
-     12546L,12547L,12548L,12549L,12550L,12551L,12552L,12553L,
-     12554L,12554L,12555L,12556L,12557L,12558L,12559L,12560L,
-     12561L,12562L,12563L,12564L,12565L,12566L,12567L,12568L,
-     12569L,12570L,12571L,12572L,12573L,12574L,12575L,12576L,
-     12577L,12578L,12579L,12580L,12581L,12582L,12583L,12584L,
-     12585L,12586L,12587L,12588L,12589L,12590L,12591L,12592L,
-     12593L,12594L,12595L,12596L,12597L,12598L,12599L,12600L,
-     12601L,12602L,12603L,12604L,12605L,12606L,12607L,12607L,
-     12608L,12609L,12610L,12611L,12612L,12613L,12614L,12615L,
-     12616L,12617L,12618L,12619L,12620L,12621L,12622L,12623L,
-     12624L,12625L,12626L,12627L,12628L,12629L,12630L,12631L,
-     12632L,12633L,12634L,12635L,12636L,12637L,12638L,12639L,
-     12640L,12641L,12642L,12643L,12644L,12645L,12646L,12647L,
-     12648L,12649L,12650L,12651L,12652L,12653L,12654L,12655L,
-     12656L,12657L,12658L,12659L,12659L,12660L,12661L,12662L,
-     12663L,12664L,12665L,12666L,12667L,12668L,12669L,12670L,
-     12671L,12672L,12673L,12674L,12675L,12676L,12677L,12678L,
-     12679L,12680L,12681L,12682L,12683L,12684L,12685L,12686L,
-     12687L,12688L,12689L,12690L,12691L,12692L,12693L,12694L,
-     12695L,12696L,12697L,12698L,12699L,12700L,12701L,12702L,
-     12703L,12704L,12705L,12706L,12707L,12708L,12709L,12710L,
-     12711L,12711L,12712L,12713L,12714L,12715L,12716L,12717L,
-     12718L,12719L,12720L,12721L,12722L,12723L,12724L,12725L,
-     12726L,12727L,12728L,12729L,12730L,12731L,12732L,12733L,
-     12734L,12735L,12736L,12737L,12738L,12739L,12740L,12741L,
-     12742L,12743L,12744L,12745L,12746L,12747L,12748L,12749L,
-     12750L,12751L,12752L,12753L,12754L,12755L,12756L,12757L,
-     12758L,12759L,12760L,12761L,12762L,12763L,12763L,12764L,
-     12765L,12766L,12767L,12768L,12769L,12770L,12771L,12772L,
-     12773L,12774L,12775L,12776L,12777L,12778L,12779L,12780L,
-     12781L,12782L,12783L,12784L,12785L,12786L,12787L,12788L,
-     12789L,12790L,12791L,12792L,12793L,12794L,12795L,12796L,
-     12797L,12798L,12799L,12800L,12801L,12802L,12803L,12804L,
-     12805L,12806L,12807L,12808L,12809L,12810L,12811L,12812L,
-     12813L,12814L,12814L,12815L,12816L,12817L,12818L,12819L,
-     12820L,12821L,12822L,12823L,12824L,12825L,12826L,12827L,
-     12828L,12829L,12830L,12831L,12832L,12833L,12834L,12835L,
-     12836L,12837L,12838L,12839L,12840L,12841L,12842L,12843L,
-     12844L,12845L,12846L,12847L,12848L,12849L,12850L,12851L,
-     12852L,12853L,12854L,12855L,12856L,12857L,12858L,12859L,
-     12860L,12861L,12862L,12863L,12864L,12864L,12865L,12866L,
-     12867L,12868L,12869L,12870L,12871L,12872L,12873L,12874L,
-     12875L,12876L,12877L,12878L,12879L,12880L,12881L,12882L,
-     12883L,12884L,12885L,12886L,12887L,12888L,12889L,12890L,
-     12891L,12892L,12893L,12894L,12895L,12896L,12897L,12898L,
-     12899L,12900L,12901L,12902L,12903L,12904L,12905L,12906L,
-     12907L,12908L,12909L,12910L,12911L,12912L,12913L,12914L,
-     12915L,12915L,12916L,12917L,12918L,12919L,12920L,12921L,
-     12922L,12923L,12924L,12925L,12926L,12927L,12928L,12929L,
-     12930L,12931L,12932L,12933L,12934L,12935L,12936L,12937L,
-     12938L,12939L,12940L,12941L,12942L,12943L,12944L,12945L,
-     12946L,12947L,12948L,12949L,12950L,12951L,12952L,12953L,
-     12954L,12955L,12956L,12957L,12958L,12959L,12960L,12961L,
-     12962L,12963L,12964L,12964L,12965L,12966L,12967L,12968L,
-     12969L,12970L,12971L,12972L,12973L,12974L,12975L,12976L,
-     12977L,12978L,12979L,12980L,12981L,12982L,12983L,12984L,
-     12985L,12986L,12987L,12988L,12989L,12990L,12991L,12992L,
-     12993L,12994L,12995L,12996L,12997L,12998L,12999L,13000L,
-     13001L,13002L,13003L,13004L,13005L,13006L,13007L,13008L,
-     13009L,13010L,13011L,13012L,13013L,13014L,13014L,13015L,
-     13016L,13017L,13018L,13019L,13020L,13021L,13022L,13023L,
-     13024L,13025L,13026L,13027L,13028L,13029L,13030L,13031L,
-     13032L,13033L,13034L,13035L,13036L,13037L,13038L,13039L,
-     13040L,13041L,13042L,13043L,13044L,13045L,13046L,13047L,
-     13048L,13049L,13050L,13051L,13052L,13053L,13054L,13055L,
-     13056L,13057L,13058L,13059L,13060L,13061L,13062L,13063L,
-     13063L,13064L,13065L,13066L,13067L,13068L,13069L,13070L,
-     13071L,13072L,13073L,13074L,13075L,13076L,13077L,13078L,
-     13079L,13080L,13081L,13082L,13083L,13084L,13085L,13086L,
-     13087L,13088L,13089L,13090L,13091L,13092L,13093L,13094L,
-     13095L,13096L,13097L,13098L,13099L,13100L,13101L,13102L,
-     13103L,13104L,13105L,13106L,13107L,13108L,13109L,13110L,
-     13111L,13111L,13112L,13113L,13114L,13115L,13116L,13117L,
-     13118L,13119L,13120L,13121L,13122L,13123L,13124L,13125L,
-     13126L,13127L,13128L,13129L,13130L,13131L,13132L,13133L,
-     13134L,13135L,13136L,13137L,13138L,13139L,13140L,13141L,
-     13142L,13143L,13144L,13145L,13146L,13147L,13148L,13149L,
-     13150L,13151L,13152L,13153L,13154L,13155L,13156L,13157L,
-     13158L,13159L,13160L,13160L,13161L,13162L,13163L,13164L,
-     13165L,13166L,13167L,13168L,13169L,13170L,13171L,13172L,
-     13173L,13174L,13175L,13176L,13177L,13178L,13179L,13180L,
-     13181L,13182L,13183L,13184L,13185L,13186L,13187L,13188L,
-     13189L,13190L,13191L,13192L,13193L,13194L,13195L,13196L,
-     13197L,13198L,13199L,13200L,13201L,13202L,13203L,13204L,
-     13205L,13206L,13207L,13208L,13208L,13209L,13210L,13211L,
-     13212L,13213L,13214L,13215L,13216L,13217L,13218L,13219L,
-     13220L,13221L,13222L,13223L,13224L,13225L,13226L,13227L,
-     13228L,13229L,13230L,13231L,13232L,13233L,13234L,13235L,
-     13236L,13237L,13238L,13239L,13240L,13241L,13242L,13243L,
-     13244L,13245L,13246L,13247L,13248L,13249L,13250L,13251L,
-     13252L,13253L,13254L,13255L,13255L,13256L,13257L,13258L,
-     13259L,13260L,13261L,13262L,13263L,13264L,13265L,13266L,
-     13267L,13268L,13269L,13270L,13271L,13272L,13273L,13274L,
-     13275L,13276L,13277L,13278L,13279L,13280L,13281L,13282L,
-     13283L,13284L,13285L,13286L,13287L,13288L,13289L,13290L,
-     13291L,13292L,13293L,13294L,13295L,13296L,13297L,13298L,
-     13299L,13300L,13301L,13302L,13302L,13303L,13304L,13305L,
-     13306L,13307L,13308L,13309L,13310L,13311L,13312L,13313L,
-     13314L,13315L,13316L,13317L,13318L,13319L,13320L,13321L,
-     13322L,13323L,13324L,13325L,13326L,13327L,13328L,13329L,
-     13330L,13331L,13332L,13333L,13334L,13335L,13336L,13337L,
-     13338L,13339L,13340L,13341L,13342L,13343L,13344L,13345L,
-     13346L,13347L,13348L,13349L,13349L,13350L,13351L,13352L,
-     13353L,13354L,13355L,13356L,13357L,13358L,13359L,13360L,
-     13361L,13362L,13363L,13364L,13365L,13366L,13367L,13368L,
-     13369L,13370L,13371L,13372L,13373L,13374L,13375L,13376L,
-     13377L,13378L,13379L,13380L,13381L,13382L,13383L,13384L,
-     13385L,13386L,13387L,13388L,13389L,13390L,13391L,13392L,
-     13393L,13394L,13395L,13396L,13396L,13397L,13398L,13399L,
-     13400L,13401L,13402L,13403L,13404L,13405L,13406L,13407L,
-     13408L,13409L,13410L,13411L,13412L,13413L,13414L,13415L,
-     13416L,13417L,13418L,13419L,13420L,13421L,13422L,13423L,
-     13424L,13425L,13426L,13427L,13428L,13429L,13430L,13431L,
-     13432L,13433L,13434L,13435L,13436L,13437L,13438L,13439L,
-     13440L,13441L,13442L,13442L,13443L,13444L,13445L,13446L,
-     13447L,13448L,13449L,13450L,13451L,13452L,13453L,13454L,
-     13455L,13456L,13457L,13458L,13459L,13460L,13461L,13462L,
-     13463L,13464L,13465L,13466L,13467L,13468L,13469L,13470L,
-     13471L,13472L,13473L,13474L,13475L,13476L,13477L,13478L,
-     13479L,13480L,13481L,13482L,13483L,13484L,13485L,13486L,
-     13487L,13488L,13488L,13489L,13490L,13491L,13492L,13493L,
-     13494L,13495L,13496L,13497L,13498L,13499L,13500L,13501L,
-     13502L,13503L,13504L,13505L,13506L,13507L,13508L,13509L,
-     13510L,13511L,13512L,13513L,13514L,13515L,13516L,13517L,
-     13518L,13519L,13520L,13521L,13522L,13523L,13524L,13525L,
-     13526L,13527L,13528L,13529L,13530L,13531L,13532L,13533L,
-     13534L,13534L,13535L,13536L,13537L,13538L,13539L,13540L,
-     13541L,13542L,13543L,13544L,13545L,13546L,13547L,13548L,
-     13549L,13550L,13551L,13552L,13553L,13554L,13555L,13556L,
-     13557L,13558L,13559L,13560L,13561L,13562L,13563L,13564L,
-     13565L,13566L,13567L,13568L,13569L,13570L,13571L,13572L,
-     13573L,13574L,13575L,13576L,13577L,13578L,13579L,13579L,
-     13580L,13581L,13582L,13583L,13584L,13585L,13586L,13587L,
-     13588L,13589L,13590L,13591L,13592L,13593L,13594L,13595L,
-     13596L,13597L,13598L,13599L,13600L,13601L,13602L,13603L,
-     13604L,13605L,13606L,13607L,13608L,13609L,13610L,13611L,
-     13612L,13613L,13614L,13615L,13616L,13617L,13618L,13619L,
-     13620L,13621L,13622L,13623L,13624L,13624L,13625L,13626L,
-     13627L,13628L,13629L,13630L,13631L,13632L,13633L,13634L,
-     13635L,13636L,13637L,13638L,13639L,13640L,13641L,13642L,
-     13643L,13644L,13645L,13646L,13647L,13648L,13649L,13650L,
-     13651L,13652L,13653L,13654L,13655L,13656L,13657L,13658L,
-     13659L,13660L,13661L,13662L,13663L,13664L,13665L,13666L,
-     13667L,13668L,13668L,13669L,13670L,13671L,13672L,13673L,
-     13674L,13675L,13676L,13677L,13678L,13679L,13680L,13681L,
-     13682L,13683L,13684L,13685L,13686L,13687L,13688L,13689L,
-     13690L,13691L,13692L,13693L,13694L,13695L,13696L,13697L,
-     13698L,13699L,13700L,13701L,13702L,13703L,13704L,13705L,
-     13706L,13707L,13708L,13709L,13710L,13711L,13712L,13713L,
-     13713L,13714L,13715L,13716L,13717L,13718L,13719L,13720L,
-     13721L,13722L,13723L,13724L,13725L,13726L,13727L,13728L,
-     13729L,13730L,13731L,13732L,13733L,13734L,13735L,13736L,
-     13737L,13738L,13739L,13740L,13741L,13742L,13743L,13744L,
-     13745L,13746L,13747L,13748L,13749L,13750L,13751L,13752L,
-     13753L,13754L,13755L,13756L,13757L,13757L,13758L,13759L,
-     13760L,13761L,13762L,13763L,13764L,13765L,13766L,13767L,
-     13768L,13769L,13770L,13771L,13772L,13773L,13774L,13775L,
-     13776L,13777L,13778L,13779L,13780L,13781L,13782L,13783L,
-     13784L,13785L,13786L,13787L,13788L,13789L,13790L,13791L,
-     13792L,13793L,13794L,13795L,13796L,13797L,13798L,13799L,
-     13800L,13800L,13801L,13802L,13803L,13804L,13805L,13806L,
-     13807L,13808L,13809L,13810L,13811L,13812L,13813L,13814L,
-     13815L,13816L,13817L,13818L,13819L,13820L,13821L,13822L,
-     13823L,13824L,13825L,13826L,13827L,13828L,13829L,13830L,
-     13831L,13832L,13833L,13834L,13835L,13836L,13837L,13838L,
-     13839L,13840L,13841L,13842L,13843L,13844L,13844L,13845L,
-     13846L,13847L,13848L,13849L,13850L,13851L,13852L,13853L,
-     13854L,13855L,13856L,13857L,13858L,13859L,13860L,13861L,
-     13862L,13863L,13864L,13865L,13866L,13867L,13868L,13869L,
-     13870L,13871L,13872L,13873L,13874L,13875L,13876L,13877L,
-     13878L,13879L,13880L,13881L,13882L,13883L,13884L,13885L,
-     13886L,13887L,13887L,13888L,13889L,13890L,13891L,13892L,
-     13893L,13894L,13895L,13896L,13897L,13898L,13899L,13900L,
-     13901L,13902L,13903L,13904L,13905L,13906L,13907L,13908L,
-     13909L,13910L,13911L,13912L,13913L,13914L,13915L,13916L,
-     13917L,13918L,13919L,13920L,13921L,13922L,13923L,13924L,
-     13925L,13926L,13927L,13928L,13929L,13930L,13930L,13931L,
-     13932L,13933L,13934L,13935L,13936L,13937L,13938L,13939L,
-     13940L,13941L,13942L,13943L,13944L,13945L,13946L,13947L,
-     13948L,13949L,13950L,13951L,13952L,13953L,13954L,13955L,
-     13956L,13957L,13958L,13959L,13960L,13961L,13962L,13963L,
-     13964L,13965L,13966L,13967L,13968L,13969L,13970L,13971L,
-     13972L,13973L,13973L,13974L,13975L,13976L,13977L,13978L,
-     13979L,13980L,13981L,13982L,13983L,13984L,13985L,13986L,
-     13987L,13988L,13989L,13990L,13991L,13992L,13993L,13994L,
-     13995L,13996L,13997L,13998L,13999L,14000L,14001L,14002L,
-     14003L,14004L,14005L,14006L,14007L,14008L,14009L,14010L,
-     14011L,14012L,14013L,14014L,14015L,14015L,14016L,14017L,
-     14018L,14019L,14020L,14021L,14022L,14023L,14024L,14025L,
-     14026L,14027L,14028L,14029L,14030L,14031L,14032L,14033L,
-     14034L,14035L,14036L,14037L,14038L,14039L,14040L,14041L,
-     14042L,14043L,14044L,14045L,14046L,14047L,14048L,14049L,
-     14050L,14051L,14052L,14053L,14054L,14055L,14056L,14057L,
-     14057L,14058L,14059L,14060L,14061L,14062L,14063L,14064L,
-     14065L,14066L,14067L,14068L,14069L,14070L,14071L,14072L,
-     14073L,14074L,14075L,14076L,14077L,14078L,14079L,14080L,
-     14081L,14082L,14083L,14084L,14085L,14086L,14087L,14088L,
-     14089L,14090L,14091L,14092L,14093L,14094L,14095L,14096L,
-     14097L,14098L,14099L,14099L,14100L,14101L,14102L,14103L,
-     14104L,14105L,14106L,14107L,14108L,14109L,14110L,14111L,
-     14112L,14113L,14114L,14115L,14116L,14117L,14118L,14119L,
-     14120L,14121L,14122L,14123L,14124L,14125L,14126L,14127L,
-     14128L,14129L,14130L,14131L,14132L,14133L,14134L,14135L,
-     14136L,14137L,14138L,14139L,14140L,14141L,14141L,14142L,
-     14143L,14144L,14145L,14146L,14147L,14148L,14149L,14150L,
-     14151L,14152L,14153L,14154L,14155L,14156L,14157L,14158L,
-     14159L,14160L,14161L,14162L,14163L,14164L,14165L,14166L,
-     14167L,14168L,14169L,14170L,14171L,14172L,14173L,14174L,
-     14175L,14176L,14177L,14178L,14179L,14180L,14181L,14182L,
-     14182L,14183L,14184L,14185L,14186L,14187L,14188L,14189L,
-     14190L,14191L,14192L,14193L,14194L,14195L,14196L,14197L,
-     14198L,14199L,14200L,14201L,14202L,14203L,14204L,14205L,
-     14206L,14207L,14208L,14209L,14210L,14211L,14212L,14213L,
-     14214L,14215L,14216L,14217L,14218L,14219L,14220L,14221L,
-     14222L,14223L,14223L,14224L,14225L,14226L,14227L,14228L,
-     14229L,14230L,14231L,14232L,14233L,14234L,14235L,14236L,
-     14237L,14238L,14239L,14240L,14241L,14242L,14243L,14244L,
-     14245L,14246L,14247L,14248L,14249L,14250L,14251L,14252L,
-     14253L,14254L,14255L,14256L,14257L,14258L,14259L,14260L,
-     14261L,14262L,14263L,14264L,14264L,14265L,14266L,14267L,
-     14268L,14269L,14270L,14271L,14272L,14273L,14274L,14275L,
-     14276L,14277L,14278L,14279L,14280L,14281L,14282L,14283L,
-     14284L,14285L,14286L,14287L,14288L,14289L,14290L,14291L,
-     14292L,14293L,14294L,14295L,14296L,14297L,14298L,14299L,
-     14300L,14301L,14302L,14303L,14304L,14304L,14305L,14306L,
-     14307L,14308L,14309L,14310L,14311L,14312L,14313L,14314L,
-     14315L,14316L,14317L,14318L,14319L,14320L,14321L,14322L,
-     14323L,14324L,14325L,14326L,14327L,14328L,14329L,14330L,
-     14331L,14332L,14333L,14334L,14335L,14336L,14337L,14338L,
-     14339L,14340L,14341L,14342L,14343L,14344L,14345L,14345L,
-     14346L,14347L,14348L,14349L,14350L,14351L,14352L,14353L,
-     14354L,14355L,14356L,14357L,14358L,14359L,14360L,14361L,
-     14362L,14363L,14364L,14365L,14366L,14367L,14368L,14369L,
-     14370L,14371L,14372L,14373L,14374L,14375L,14376L,14377L,
-     14378L,14379L,14380L,14381L,14382L,14383L,14384L,14385L,
-     14385L,14386L,14387L,14388L,14389L,14390L,14391L,14392L,
-     14393L,14394L,14395L,14396L,14397L,14398L,14399L,14400L,
-     14401L,14402L,14403L,14404L,14405L,14406L,14407L,14408L,
-     14409L,14410L,14411L,14412L,14413L,14414L,14415L,14416L,
-     14417L,14418L,14419L,14420L,14421L,14422L,14423L,14424L,
-     14425L,14425L,14426L,14427L,14428L,14429L,14430L,14431L,
-     14432L,14433L,14434L,14435L,14436L,14437L,14438L,14439L,
-     14440L,14441L,14442L,14443L,14444L,14445L,14446L,14447L,
-     14448L,14449L,14450L,14451L,14452L,14453L,14454L,14455L,
-     14456L,14457L,14458L,14459L,14460L,14461L,14462L,14463L,
-     14464L,14465L,14465L,14466L,14467L,14468L,14469L,14470L,
-     14471L,14472L,14473L,14474L,14475L,14476L,14477L,14478L,
-     14479L,14480L,14481L,14482L,14483L,14484L,14485L,14486L,
-     14487L,14488L,14489L,14490L,14491L,14492L,14493L,14494L,
-     14495L,14496L,14497L,14498L,14499L,14500L,14501L,14502L,
-     14503L,14504L,14504L,14505L,14506L,14507L,14508L,14509L,
-     14510L,14511L,14512L,14513L,14514L,14515L,14516L,14517L,
-     14518L,14519L,14520L,14521L,14522L,14523L,14524L,14525L,
-     14526L,14527L,14528L,14529L,14530L,14531L,14532L,14533L,
-     14534L,14535L,14536L,14537L,14538L,14539L,14540L,14541L,
-     14542L,14543L,14543L,14544L,14545L,14546L,14547L,14548L,
-     14549L,14550L,14551L,14552L,14553L,14554L,14555L,14556L,
-     14557L,14558L,14559L,14560L,14561L,14562L,14563L,14564L,
-     14565L,14566L,14567L,14568L,14569L,14570L,14571L,14572L,
-     14573L,14574L,14575L,14576L,14577L,14578L,14579L,14580L,
-     14581L,14582L,14582L,14583L,14584L,14585L,14586L,14587L,
-     14588L,14589L,14590L,14591L,14592L,14593L,14594L,14595L,
-     14596L,14597L,14598L,14599L,14600L,14601L,14602L,14603L,
-     14604L,14605L,14606L,14607L,14608L,14609L,14610L,14611L,
-     14612L,14613L,14614L,14615L,14616L,14617L,14618L,14619L,
-     14620L,14621L,14621L,14622L,14623L,14624L,14625L,14626L,
-     14627L,14628L,14629L,14630L,14631L,14632L,14633L,14634L,
-     14635L,14636L,14637L,14638L,14639L,14640L,14641L,14642L,
-     14643L,14644L,14645L,14646L,14647L,14648L,14649L,14650L,
-     14651L,14652L,14653L,14654L,14655L,14656L,14657L,14658L,
-     14659L,14660L,14660L,14661L,14662L,14663L,14664L,14665L,
-     14666L,14667L,14668L,14669L,14670L,14671L,14672L,14673L,
-     14674L,14675L,14676L,14677L,14678L,14679L,14680L,14681L,
-     14682L,14683L,14684L,14685L,14686L,14687L,14688L,14689L,
-     14690L,14691L,14692L,14693L,14694L,14695L,14696L,14697L,
-     14698L,14698L,14699L,14700L,14701L,14702L,14703L,14704L,
-     14705L,14706L,14707L,14708L,14709L,14710L,14711L,14712L,
-     14713L,14714L,14715L,14716L,14717L,14718L,14719L,14720L,
-     14721L,14722L,14723L,14724L,14725L,14726L,14727L,14728L,
-     14729L,14730L,14731L,14732L,14733L,14734L,14735L,14736L,
-     14736L,14737L,14738L,14739L,14740L,14741L,14742L,14743L,
-     14744L,14745L,14746L,14747L,14748L,14749L,14750L,14751L,
-     14752L,14753L,14754L,14755L,14756L,14757L,14758L,14759L,
-     14760L,14761L,14762L,14763L,14764L,14765L,14766L,14767L,
-     14768L,14769L,14770L,14771L,14772L,14773L,14774L,14774L,
-     14775L,14776L,14777L,14778L,14779L,14780L,14781L,14782L,
-     14783L,14784L,14785L,14786L,14787L,14788L,14789L,14790L,
-     14791L,14792L,14793L,14794L,14795L,14796L,14797L,14798L,
-     14799L,14800L,14801L,14802L,14803L,14804L,14805L,14806L,
-     14807L,14808L,14809L,14810L,14811L,14812L,14812L,14813L,
-     14814L,14815L,14816L,14817L,14818L,14819L,14820L,14821L,
-     14822L,14823L,14824L,14825L,14826L,14827L,14828L,14829L,
-     14830L,14831L,14832L,14833L,14834L,14835L,14836L,14837L,
-     14838L,14839L,14840L,14841L,14842L,14843L,14844L,14845L,
-     14846L,14847L,14848L,14849L,14849L,14850L,14851L,14852L,
-     14853L,14854L,14855L,14856L,14857L,14858L,14859L,14860L,
-     14861L,14862L,14863L,14864L,14865L,14866L,14867L,14868L,
-     14869L,14870L,14871L,14872L,14873L,14874L,14875L,14876L,
-     14877L,14878L,14879L,14880L,14881L,14882L,14883L,14884L,
-     14885L,14886L,14887L,14887L,14888L,14889L,14890L,14891L,
-     14892L,14893L,14894L,14895L,14896L,14897L,14898L,14899L,
-     14900L,14901L,14902L,14903L,14904L,14905L,14906L,14907L,
-     14908L,14909L,14910L,14911L,14912L,14913L,14914L,14915L,
-     14916L,14917L,14918L,14919L,14920L,14921L,14922L,14923L,
-     14924L,14924L,14925L,14926L,14927L,14928L,14929L,14930L,
-     14931L,14932L,14933L,14934L,14935L,14936L,14937L,14938L,
-     14939L,14940L,14941L,14942L,14943L,14944L,14945L,14946L,
-     14947L,14948L,14949L,14950L,14951L,14952L,14953L,14954L,
-     14955L,14956L,14957L,14958L,14959L,14960L,14961L,14961L,
-     14962L,14963L,14964L,14965L,14966L,14967L,14968L,14969L,
-     14970L,14971L,14972L,14973L,14974L,14975L,14976L,14977L,
-     14978L,14979L,14980L,14981L,14982L,14983L,14984L,14985L,
-     14986L,14987L,14988L,14989L,14990L,14991L,14992L,14993L,
-     14994L,14995L,14996L,14997L,14998L,14998L,14999L,15000L,
-     15001L,15002L,15003L,15004L,15005L,15006L,15007L,15008L,
-     15009L,15010L,15011L,15012L,15013L,15014L,15015L,15016L,
-     15017L,15018L,15019L,15020L,15021L,15022L,15023L,15024L,
-     15025L,15026L,15027L,15028L,15029L,15030L,15031L,15032L,
-     15033L,15034L,15034L,15035L,15036L,15037L,15038L,15039L,
-     15040L,15041L,15042L,15043L,15044L,15045L,15046L,15047L,
-     15048L,15049L,15050L,15051L,15052L,15053L,15054L,15055L,
-     15056L,15057L,15058L,15059L,15060L,15061L,15062L,15063L,
-     15064L,15065L,15066L,15067L,15068L,15069L,15070L,15071L,
-     15071L,15072L,15073L,15074L,15075L,15076L,15077L,15078L,
-     15079L,15080L,15081L,15082L,15083L,15084L,15085L,15086L,
-     15087L,15088L,15089L,15090L,15091L,15092L,15093L,15094L,
-     15095L,15096L,15097L,15098L,15099L,15100L,15101L,15102L,
-     15103L,15104L,15105L,15106L,15107L,15107L,15108L,15109L,
-     15110L,15111L,15112L,15113L,15114L,15115L,15116L,15117L,
-     15118L,15119L,15120L,15121L,15122L,15123L,15124L,15125L,
-     15126L,15127L,15128L,15129L,15130L,15131L,15132L,15133L,
-     15134L,15135L,15136L,15137L,15138L,15139L,15140L,15141L,
-     15142L,15143L,15143L,15144L,15145L,15146L,15147L,15148L,
-     15149L,15150L,15151L,15152L,15153L,15154L,15155L,15156L,
-     15157L,15158L,15159L,15160L,15161L,15162L,15163L,15164L,
-     15165L,15166L,15167L,15168L,15169L,15170L,15171L,15172L,
-     15173L,15174L,15175L,15176L,15177L,15178L,15179L,15179L,
-     15180L,15181L,15182L,15183L,15184L,15185L,15186L,15187L,
-     15188L,15189L,15190L,15191L,15192L,15193L,15194L,15195L,
-     15196L,15197L,15198L,15199L,15200L,15201L,15202L,15203L,
-     15204L,15205L,15206L,15207L,15208L,15209L,15210L,15211L,
-     15212L,15213L,15214L,15215L,15215L,15216L,15217L,15218L,
-     15219L,15220L,15221L,15222L,15223L,15224L,15225L,15226L,
-     15227L,15228L,15229L,15230L,15231L,15232L,15233L,15234L,
-     15235L,15236L,15237L,15238L,15239L,15240L,15241L,15242L,
-     15243L,15244L,15245L,15246L,15247L,15248L,15249L,15250L,
-     15250L,15251L,15252L,15253L,15254L,15255L,15256L,15257L,
-     15258L,15259L,15260L,15261L,15262L,15263L,15264L,15265L,
-     15266L,15267L,15268L,15269L,15270L,15271L,15272L,15273L,
-     15274L,15275L,15276L,15277L,15278L,15279L,15280L,15281L,
-     15282L,15283L,15284L,15285L,15285L,15286L,15287L,15288L,
-     15289L,15290L,15291L,15292L,15293L,15294L,15295L,15296L,
-     15297L,15298L,15299L,15300L,15301L,15302L,15303L,15304L,
-     15305L,15306L,15307L,15308L,15309L,15310L,15311L,15312L,
-     15313L,15314L,15315L,15316L,15317L,15318L,15319L,15320L,
-     15321L,15321L,15322L,15323L,15324L,15325L,15326L,15327L,
-     15328L,15329L,15330L,15331L,15332L,15333L,15334L,15335L,
-     15336L,15337L,15338L,15339L,15340L,15341L,15342L,15343L,
-     15344L,15345L,15346L,15347L,15348L,15349L,15350L,15351L,
-     15352L,15353L,15354L,15355L,15356L,15356L,15357L,15358L,
-     15359L,15360L,15361L,15362L,15363L,15364L,15365L,15366L,
-     15367L,15368L,15369L,15370L,15371L,15372L,15373L,15374L,
-     15375L,15376L,15377L,15378L,15379L,15380L,15381L,15382L,
-     15383L,15384L,15385L,15386L,15387L,15388L,15389L,15390L,
-     15390L,15391L,15392L,15393L,15394L,15395L,15396L,15397L,
-     15398L,15399L,15400L,15401L,15402L,15403L,15404L,15405L,
-     15406L,15407L,15408L,15409L,15410L,15411L,15412L,15413L,
-     15414L,15415L,15416L,15417L,15418L,15419L,15420L,15421L,
-     15422L,15423L,15424L,15425L,15425L,15426L,15427L,15428L,
-     15429L,15430L,15431L,15432L,15433L,15434L,15435L,15436L,
-     15437L,15438L,15439L,15440L,15441L,15442L,15443L,15444L,
-     15445L,15446L,15447L,15448L,15449L,15450L,15451L,15452L,
-     15453L,15454L,15455L,15456L,15457L,15458L,15459L,15460L,
-     15460L,15461L,15462L,15463L,15464L,15465L,15466L,15467L,
-     15468L,15469L,15470L,15471L,15472L,15473L,15474L,15475L,
-     15476L,15477L,15478L,15479L,15480L,15481L,15482L,15483L,
-     15484L,15485L,15486L,15487L,15488L,15489L,15490L,15491L,
-     15492L,15493L,15494L,15494L,15495L,15496L,15497L,15498L,
-     15499L,15500L,15501L,15502L,15503L,15504L,15505L,15506L,
-     15507L,15508L,15509L,15510L,15511L,15512L,15513L,15514L,
-     15515L,15516L,15517L,15518L,15519L,15520L,15521L,15522L,
-     15523L,15524L,15525L,15526L,15527L,15528L,15528L,15529L,
-     15530L,15531L,15532L,15533L,15534L,15535L,15536L,15537L,
-     15538L,15539L,15540L,15541L,15542L,15543L,15544L,15545L,
-     15546L,15547L,15548L,15549L,15550L,15551L,15552L,15553L,
-     15554L,15555L,15556L,15557L,15558L,15559L,15560L,15561L,
-     15562L,15562L,15563L,15564L,15565L,15566L,15567L,15568L,
-     15569L,15570L,15571L,15572L,15573L,15574L,15575L,15576L,
-     15577L,15578L,15579L,15580L,15581L,15582L,15583L,15584L,
-     15585L,15586L,15587L,15588L,15589L,15590L,15591L,15592L,
-     15593L,15594L,15595L,15596L,15596L,15597L,15598L,15599L,
-     15600L,15601L,15602L,15603L,15604L,15605L,15606L,15607L,
-     15608L,15609L,15610L,15611L,15612L,15613L,15614L,15615L,
-     15616L,15617L,15618L,15619L,15620L,15621L,15622L,15623L,
-     15624L,15625L,15626L,15627L,15628L,15629L,15630L,15630L,
-     15631L,15632L,15633L,15634L,15635L,15636L,15637L,15638L,
-     15639L,15640L,15641L,15642L,15643L,15644L,15645L,15646L,
-     15647L,15648L,15649L,15650L,15651L,15652L,15653L,15654L,
-     15655L,15656L,15657L,15658L,15659L,15660L,15661L,15662L,
-     15663L,15663L,15664L,15665L,15666L,15667L,15668L,15669L,
-     15670L,15671L,15672L,15673L,15674L,15675L,15676L,15677L,
-     15678L,15679L,15680L,15681L,15682L,15683L,15684L,15685L,
-     15686L,15687L,15688L,15689L,15690L,15691L,15692L,15693L,
-     15694L,15695L,15696L,15697L,15697L,15698L,15699L,15700L,
-     15701L,15702L,15703L,15704L,15705L,15706L,15707L,15708L,
-     15709L,15710L,15711L,15712L,15713L,15714L,15715L,15716L,
-     15717L,15718L,15719L,15720L,15721L,15722L,15723L,15724L,
-     15725L,15726L,15727L,15728L,15729L,15730L,15730L,15731L,
-     15732L,15733L,15734L,15735L,15736L,15737L,15738L,15739L,
-     15740L,15741L,15742L,15743L,15744L,15745L,15746L,15747L,
-     15748L,15749L,15750L,15751L,15752L,15753L,15754L,15755L,
-     15756L,15757L,15758L,15759L,15760L,15761L,15762L,15763L,
-     15763L,15764L,15765L,15766L,15767L,15768L,15769L,15770L,
-     15771L,15772L,15773L,15774L,15775L,15776L,15777L,15778L,
-     15779L,15780L,15781L,15782L,15783L,15784L,15785L,15786L,
-     15787L,15788L,15789L,15790L,15791L,15792L,15793L,15794L,
-     15795L,15796L,15796L,15797L,15798L,15799L,15800L,15801L,
-     15802L,15803L,15804L,15805L,15806L,15807L,15808L,15809L,
-     15810L,15811L,15812L,15813L,15814L,15815L,15816L,15817L,
-     15818L,15819L,15820L,15821L,15822L,15823L,15824L,15825L,
-     15826L,15827L,15828L,15829L,15829L,15830L,15831L,15832L,
-     15833L,15834L,15835L,15836L,15837L,15838L,15839L,15840L,
-     15841L,15842L,15843L,15844L,15845L,15846L,15847L,15848L,
-     15849L,15850L,15851L,15852L,15853L,15854L,15855L,15856L,
-     15857L,15858L,15859L,15860L,15861L,15862L,15862L,15863L,
-     15864L,15865L,15866L,15867L,15868L,15869L,15870L,15871L,
-     15872L,15873L,15874L,15875L,15876L,15877L,15878L,15879L,
-     15880L,15881L,15882L,15883L,15884L,15885L,15886L,15887L,
-     15888L,15889L,15890L,15891L,15892L,15893L,15894L,15894L,
-     15895L,15896L,15897L,15898L,15899L,15900L,15901L,15902L,
-     15903L,15904L,15905L,15906L,15907L,15908L,15909L,15910L,
-     15911L,15912L,15913L,15914L,15915L,15916L,15917L,15918L,
-     15919L,15920L,15921L,15922L,15923L,15924L,15925L,15926L,
-     15927L,15927L,15928L,15929L,15930L,15931L,15932L,15933L,
-     15934L,15935L,15936L,15937L,15938L,15939L,15940L,15941L,
-     15942L,15943L,15944L,15945L,15946L,15947L,15948L,15949L,
-     15950L,15951L,15952L,15953L,15954L,15955L,15956L,15957L,
-     15958L,15959L,15959L,15960L,15961L,15962L,15963L,15964L,
-     15965L,15966L,15967L,15968L,15969L,15970L,15971L,15972L,
-     15973L,15974L,15975L,15976L,15977L,15978L,15979L,15980L,
-     15981L,15982L,15983L,15984L,15985L,15986L,15987L,15988L,
-     15989L,15990L,15991L,15991L,15992L,15993L,15994L,15995L,
-     15996L,15997L,15998L,15999L,16000L,16001L,16002L,16003L,
-     16004L,16005L,16006L,16007L,16008L,16009L,16010L,16011L,
-     16012L,16013L,16014L,16015L,16016L,16017L,16018L,16019L,
-     16020L,16021L,16022L,16023L,16023L,16024L,16025L,16026L,
-     16027L,16028L,16029L,16030L,16031L,16032L,16033L,16034L,
-     16035L,16036L,16037L,16038L,16039L,16040L,16041L,16042L,
-     16043L,16044L,16045L,16046L,16047L,16048L,16049L,16050L,
-     16051L,16052L,16053L,16054L,16055L,16055L,16056L,16057L,
-     16058L,16059L,16060L,16061L,16062L,16063L,16064L,16065L,
-     16066L,16067L,16068L,16069L,16070L,16071L,16072L,16073L,
-     16074L,16075L,16076L,16077L,16078L,16079L,16080L,16081L,
-     16082L,16083L,16084L,16085L,16086L,16087L,16087L,16088L,
-     16089L,16090L,16091L,16092L,16093L,16094L,16095L,16096L,
-     16097L,16098L,16099L,16100L,16101L,16102L,16103L,16104L,
-     16105L,16106L,16107L,16108L,16109L,16110L,16111L,16112L,
-     16113L,16114L,16115L,16116L,16117L,16118L,16119L,16119L,
-     16120L,16121L,16122L,16123L,16124L,16125L,16126L,16127L,
-     16128L,16129L,16130L,16131L,16132L,16133L,16134L,16135L,
-     16136L,16137L,16138L,16139L,16140L,16141L,16142L,16143L,
-     16144L,16145L,16146L,16147L,16148L,16149L,16150L,16150L,
-     16151L,16152L,16153L,16154L,16155L,16156L,16157L,16158L,
-     16159L,16160L,16161L,16162L,16163L,16164L,16165L,16166L,
-     16167L,16168L,16169L,16170L,16171L,16172L,16173L,16174L,
-     16175L,16176L,16177L,16178L,16179L,16180L,16181L,16181L,
-     16182L,16183L,16184L,16185L,16186L,16187L,16188L,16189L,
-     16190L,16191L,16192L,16193L,16194L,16195L,16196L,16197L,
-     16198L,16199L,16200L,16201L,16202L,16203L,16204L,16205L,
-     16206L,16207L,16208L,16209L,16210L,16211L,16212L,16213L,
-     16213L,16214L,16215L,16216L,16217L,16218L,16219L,16220L,
-     16221L,16222L,16223L,16224L,16225L,16226L,16227L,16228L,
-     16229L,16230L,16231L,16232L,16233L,16234L,16235L,16236L,
-     16237L,16238L,16239L,16240L,16241L,16242L,16243L,16244L,
-     16244L,16245L,16246L,16247L,16248L,16249L,16250L,16251L,
-     16252L,16253L,16254L,16255L,16256L,16257L,16258L,16259L,
-     16260L,16261L,16262L,16263L,16264L,16265L,16266L,16267L,
-     16268L,16269L,16270L,16271L,16272L,16273L,16274L,16275L,
-     16275L,16276L,16277L,16278L,16279L,16280L,16281L,16282L,
-     16283L,16284L,16285L,16286L,16287L,16288L,16289L,16290L,
-     16291L,16292L,16293L,16294L,16295L,16296L,16297L,16298L,
-     16299L,16300L,16301L,16302L,16303L,16304L,16305L,16306L,
-     16306L,16307L,16308L,16309L,16310L,16311L,16312L,16313L,
-     16314L,16315L,16316L,16317L,16318L,16319L,16320L,16321L,
-     16322L,16323L,16324L,16325L,16326L,16327L,16328L,16329L,
-     16330L,16331L,16332L,16333L,16334L,16335L,16336L,16336L,
-     16337L,16338L,16339L,16340L,16341L,16342L,16343L,16344L,
-     16345L,16346L,16347L,16348L,16349L,16350L,16351L,16352L,
-     16353L,16354L,16355L,16356L,16357L,16358L,16359L,16360L,
-     16361L,16362L,16363L,16364L,16365L,16366L,16367L,16367L,
-     16368L,16369L,16370L,16371L,16372L,16373L,16374L,16375L,
-     16376L,16377L,16378L,16379L,16380L,16381L,16382L,16383L,
-     16384L,16385L,16386L,16387L,16388L,16389L,16390L,16391L,
-     16392L,16393L,16394L,16395L,16396L,16397L,16398L,16398L,
-     16399L,16400L,16401L,16402L,16403L,16404L,16405L,16406L,
-     16407L,16408L,16409L,16410L,16411L,16412L,16413L,16414L,
-     16415L,16416L,16417L,16418L,16419L,16420L,16421L,16422L,
-     16423L,16424L,16425L,16426L,16427L,16428L,16428L,16429L,
-     16430L,16431L,16432L,16433L,16434L,16435L,16436L,16437L,
-     16438L,16439L,16440L,16441L,16442L,16443L,16444L,16445L,
-     16446L,16447L,16448L,16449L,16450L,16451L,16452L,16453L,
-     16454L,16455L,16456L,16457L,16458L,16458L,16459L,16460L,
-     16461L,16462L,16463L,16464L,16465L,16466L,16467L,16468L,
-     16469L,16470L,16471L,16472L,16473L,16474L,16475L,16476L,
-     16477L,16478L,16479L,16480L,16481L,16482L,16483L,16484L,
-     16485L,16486L,16487L,16488L,16488L,16489L,16490L,16491L,
-     16492L,16493L,16494L,16495L,16496L,16497L,16498L,16499L,
-     16500L,16501L,16502L,16503L,16504L,16505L,16506L,16507L,
-     16508L,16509L,16510L,16511L,16512L,16513L,16514L,16515L,
-     16516L,16517L,16518L,16518L,16519L,16520L,16521L,16522L,
-     16523L,16524L,16525L,16526L,16527L,16528L,16529L,16530L,
-     16531L,16532L,16533L,16534L,16535L,16536L,16537L,16538L,
-     16539L,16540L,16541L,16542L,16543L,16544L,16545L,16546L,
-     16547L,16548L,16548L,16549L,16550L,16551L,16552L,16553L,
-     16554L,16555L,16556L,16557L,16558L,16559L,16560L,16561L,
-     16562L,16563L,16564L,16565L,16566L,16567L,16568L,16569L,
-     16570L,16571L,16572L,16573L,16574L,16575L,16576L,16577L,
-     16578L,16578L,16579L,16580L,16581L,16582L,16583L,16584L,
-     16585L,16586L,16587L,16588L,16589L,16590L,16591L,16592L,
-     16593L,16594L,16595L,16596L,16597L,16598L,16599L,16600L,
-     16601L,16602L,16603L,16604L,16605L,16606L,16607L,16608L,
-     16608L,16609L,16610L,16611L,16612L,16613L,16614L,16615L,
-     16616L,16617L,16618L,16619L,16620L,16621L,16622L,16623L,
-     16624L,16625L,16626L,16627L,16628L,16629L,16630L,16631L,
-     16632L,16633L,16634L,16635L,16636L,16637L,16637L,16638L,
-     16639L,16640L,16641L,16642L,16643L,16644L,16645L,16646L,
-     16647L,16648L,16649L,16650L,16651L,16652L,16653L,16654L,
-     16655L,16656L,16657L,16658L,16659L,16660L,16661L,16662L,
-     16663L,16664L,16665L,16666L,16667L,16667L,16668L,16669L,
-     16670L,16671L,16672L,16673L,16674L,16675L,16676L,16677L,
-     16678L,16679L,16680L,16681L,16682L,16683L,16684L,16685L,
-     16686L,16687L,16688L,16689L,16690L,16691L,16692L,16693L,
-     16694L,16695L,16696L,16696L,16697L,16698L,16699L,16700L,
-     16701L,16702L,16703L,16704L,16705L,16706L,16707L,16708L,
-     16709L,16710L,16711L,16712L,16713L,16714L,16715L,16716L,
-     16717L,16718L,16719L,16720L,16721L,16722L,16723L,16724L,
-     16725L,16725L,16726L,16727L,16728L,16729L,16730L,16731L,
-     16732L,16733L,16734L,16735L,16736L,16737L,16738L,16739L,
-     16740L,16741L,16742L,16743L,16744L,16745L,16746L,16747L,
-     16748L,16749L,16750L,16751L,16752L,16753L,16754L,16755L,
-     16755L,16756L,16757L,16758L,16759L,16760L,16761L,16762L,
-     16763L,16764L,16765L,16766L,16767L,16768L,16769L,16770L,
-     16771L,16772L,16773L,16774L,16775L,16776L,16777L,16778L,
-     16779L,16780L,16781L,16782L,16783L,16784L,16784L,16785L,
-     16786L,16787L,16788L,16789L,16790L,16791L,16792L,16793L,
-     16794L,16795L,16796L,16797L,16798L,16799L,16800L,16801L,
-     16802L,16803L,16804L,16805L,16806L,16807L,16808L,16809L,
-     16810L,16811L,16812L,16813L,16813L,16814L,16815L,16816L,
-     16817L,16818L,16819L,16820L,16821L,16822L,16823L,16824L,
-     16825L,16826L,16827L,16828L,16829L,16830L,16831L,16832L,
-     16833L,16834L,16835L,16836L,16837L,16838L,16839L,16840L,
-     16841L,16841L,16842L,16843L,16844L,16845L,16846L,16847L,
-     16848L,16849L,16850L,16851L,16852L,16853L,16854L,16855L,
-     16856L,16857L,16858L,16859L,16860L,16861L,16862L,16863L,
-     16864L,16865L,16866L,16867L,16868L,16869L,16870L,16870L,
-     16871L,16872L,16873L,16874L,16875L,16876L,16877L,16878L,
-     16879L,16880L,16881L,16882L,16883L,16884L,16885L,16886L,
-     16887L,16888L,16889L,16890L,16891L,16892L,16893L,16894L,
-     16895L,16896L,16897L,16898L,16899L,16899L,16900L,16901L,
-     16902L,16903L,16904L,16905L,16906L,16907L,16908L,16909L,
-     16910L,16911L,16912L,16913L,16914L,16915L,16916L,16917L,
-     16918L,16919L,16920L,16921L,16922L,16923L,16924L,16925L,
-     16926L,16927L,16927L,16928L,16929L,16930L,16931L,16932L,
-     16933L,16934L,16935L,16936L,16937L,16938L,16939L,16940L,
-     16941L,16942L,16943L,16944L,16945L,16946L,16947L,16948L,
-     16949L,16950L,16951L,16952L,16953L,16954L,16955L,16956L,
-     16956L,16957L,16958L,16959L,16960L,16961L,16962L,16963L,
-     16964L,16965L,16966L,16967L,16968L,16969L,16970L,16971L,
-     16972L,16973L,16974L,16975L,16976L,16977L,16978L,16979L,
-     16980L,16981L,16982L,16983L,16984L,16984L,16985L,16986L,
-     16987L,16988L,16989L,16990L,16991L,16992L,16993L,16994L,
-     16995L,16996L,16997L,16998L,16999L,17000L,17001L,17002L,
-     17003L,17004L,17005L,17006L,17007L,17008L,17009L,17010L,
-     17011L,17012L,17012L,17013L,17014L,17015L,17016L,17017L,
-     17018L,17019L,17020L,17021L,17022L,17023L,17024L,17025L,
-     17026L,17027L,17028L,17029L,17030L,17031L,17032L,17033L,
-     17034L,17035L,17036L,17037L,17038L,17039L,17040L,17040L,
-     17041L,17042L,17043L,17044L,17045L,17046L,17047L,17048L,
-     17049L,17050L,17051L,17052L,17053L,17054L,17055L,17056L,
-     17057L,17058L,17059L,17060L,17061L,17062L,17063L,17064L,
-     17065L,17066L,17067L,17068L,17068L,17069L,17070L,17071L,
-     17072L,17073L,17074L,17075L,17076L,17077L,17078L,17079L,
-     17080L,17081L,17082L,17083L,17084L,17085L,17086L,17087L,
-     17088L,17089L,17090L,17091L,17092L,17093L,17094L,17095L,
-     17096L,17096L,17097L,17098L,17099L,17100L,17101L,17102L,
-     17103L,17104L,17105L,17106L,17107L,17108L,17109L,17110L,
-     17111L,17112L,17113L,17114L,17115L,17116L,17117L,17118L,
-     17119L,17120L,17121L,17122L,17123L,17124L,17124L,17125L,
-     17126L,17127L,17128L,17129L,17130L,17131L,17132L,17133L,
-     17134L,17135L,17136L,17137L,17138L,17139L,17140L,17141L,
-     17142L,17143L,17144L,17145L,17146L,17147L,17148L,17149L,
-     17150L,17151L,17152L,17152L,17153L,17154L,17155L,17156L,
-     17157L,17158L,17159L,17160L,17161L,17162L,17163L,17164L,
-     17165L,17166L,17167L,17168L,17169L,17170L,17171L,17172L,
-     17173L,17174L,17175L,17176L,17177L,17178L,17179L,17180L,
-     17180L,17181L,17182L,17183L,17184L,17185L,17186L,17187L,
-     17188L,17189L,17190L,17191L,17192L,17193L,17194L,17195L,
-     17196L,17197L,17198L,17199L,17200L,17201L,17202L,17203L,
-     17204L,17205L,17206L,17207L,17207L,17208L,17209L,17210L,
-     17211L,17212L,17213L,17214L,17215L,17216L,17217L,17218L,
-     17219L,17220L,17221L,17222L,17223L,17224L,17225L,17226L,
-     17227L,17228L,17229L,17230L,17231L,17232L,17233L,17234L,
-     17235L,17235L,17236L,17237L,17238L,17239L,17240L,17241L,
-     17242L,17243L,17244L,17245L,17246L,17247L,17248L,17249L,
-     17250L,17251L,17252L,17253L,17254L,17255L,17256L,17257L,
-     17258L,17259L,17260L,17261L,17262L,17262L,17263L,17264L,
-     17265L,17266L,17267L,17268L,17269L,17270L,17271L,17272L,
-     17273L,17274L,17275L,17276L,17277L,17278L,17279L,17280L,
-     17281L,17282L,17283L,17284L,17285L,17286L,17287L,17288L,
-     17289L,17289L,17290L,17291L,17292L,17293L,17294L,17295L,
-     17296L,17297L,17298L,17299L,17300L,17301L,17302L,17303L,
-     17304L,17305L,17306L,17307L,17308L,17309L,17310L,17311L,
-     17312L,17313L,17314L,17315L,17316L,17316L,17317L,17318L,
-     17319L,17320L,17321L,17322L,17323L,17324L,17325L,17326L,
-     17327L,17328L,17329L,17330L,17331L,17332L,17333L,17334L,
-     17335L,17336L,17337L,17338L,17339L,17340L,17341L,17342L,
-     17343L,17344L,17344L,17345L,17346L,17347L,17348L,17349L,
-     17350L,17351L,17352L,17353L,17354L,17355L,17356L,17357L,
-     17358L,17359L,17360L,17361L,17362L,17363L,17364L,17365L,
-     17366L,17367L,17368L,17369L,17370L,17371L,17371L,17372L,
-     17373L,17374L,17375L,17376L,17377L,17378L,17379L,17380L,
-     17381L,17382L,17383L,17384L,17385L,17386L,17387L,17388L,
-     17389L,17390L,17391L,17392L,17393L,17394L,17395L,17396L,
-     17397L,17397L,17398L,17399L,17400L,17401L,17402L,17403L,
-     17404L,17405L,17406L,17407L,17408L,17409L,17410L,17411L,
-     17412L,17413L,17414L,17415L,17416L,17417L,17418L,17419L,
-     17420L,17421L,17422L,17423L,17424L,17424L,17425L,17426L,
-     17427L,17428L,17429L,17430L,17431L,17432L,17433L,17434L,
-     17435L,17436L,17437L,17438L,17439L,17440L,17441L,17442L,
-     17443L,17444L,17445L,17446L,17447L,17448L,17449L,17450L,
-     17451L,17451L,17452L,17453L,17454L,17455L,17456L,17457L,
-     17458L,17459L,17460L,17461L,17462L,17463L,17464L,17465L,
-     17466L,17467L,17468L,17469L,17470L,17471L,17472L,17473L,
-     17474L,17475L,17476L,17477L,17478L,17478L,17479L,17480L,
-     17481L,17482L,17483L,17484L,17485L,17486L,17487L,17488L,
-     17489L,17490L,17491L,17492L,17493L,17494L,17495L,17496L,
-     17497L,17498L,17499L,17500L,17501L,17502L,17503L,17504L,
-     17504L,17505L,17506L,17507L,17508L,17509L,17510L,17511L,
-     17512L,17513L,17514L,17515L,17516L,17517L,17518L,17519L,
-     17520L,17521L,17522L,17523L,17524L,17525L,17526L,17527L,
-     17528L,17529L,17530L,17531L,17531L,17532L,17533L,17534L,
-     17535L,17536L,17537L,17538L,17539L,17540L,17541L,17542L,
-     17543L,17544L,17545L,17546L,17547L,17548L,17549L,17550L,
-     17551L,17552L,17553L,17554L,17555L,17556L,17557L,17557L,
-     17558L,17559L,17560L,17561L,17562L,17563L,17564L,17565L,
-     17566L,17567L,17568L,17569L,17570L,17571L,17572L,17573L,
-     17574L,17575L,17576L,17577L,17578L,17579L,17580L,17581L,
-     17582L,17583L,17583L,17584L,17585L,17586L,17587L,17588L,
-     17589L,17590L,17591L,17592L,17593L,17594L,17595L,17596L,
-     17597L,17598L,17599L,17600L,17601L,17602L,17603L,17604L,
-     17605L,17606L,17607L,17608L,17609L,17610L,17610L,17611L,
-     17612L,17613L,17614L,17615L,17616L,17617L,17618L,17619L,
-     17620L,17621L,17622L,17623L,17624L,17625L,17626L,17627L,
-     17628L,17629L,17630L,17631L,17632L,17633L,17634L,17635L,
-     17636L,17636L,17637L,17638L,17639L,17640L,17641L,17642L,
-     17643L,17644L,17645L,17646L,17647L,17648L,17649L,17650L,
-     17651L,17652L,17653L,17654L,17655L,17656L,17657L,17658L,
-     17659L,17660L,17661L,17662L,17662L,17663L,17664L,17665L,
-     17666L,17667L,17668L,17669L,17670L,17671L,17672L,17673L,
-     17674L,17675L,17676L,17677L,17678L,17679L,17680L,17681L,
-     17682L,17683L,17684L,17685L,17686L,17687L,17688L,17688L,
-     17689L,17690L,17691L,17692L,17693L,17694L,17695L,17696L,
-     17697L,17698L,17699L,17700L,17701L,17702L,17703L,17704L,
-     17705L,17706L,17707L,17708L,17709L,17710L,17711L,17712L,
-     17713L,17714L,17714L,17715L,17716L,17717L,17718L,17719L,
-     17720L,17721L,17722L,17723L,17724L,17725L,17726L,17727L,
-     17728L,17729L,17730L,17731L,17732L,17733L,17734L,17735L,
-     17736L,17737L,17738L,17739L,17740L,17740L,17741L,17742L,
-     17743L,17744L,17745L,17746L,17747L,17748L,17749L,17750L,
-     17751L,17752L,17753L,17754L,17755L,17756L,17757L,17758L,
-     17759L,17760L,17761L,17762L,17763L,17764L,17765L,17765L,
-     17766L,17767L,17768L,17769L,17770L,17771L,17772L,17773L,
-     17774L,17775L,17776L,17777L,17778L,17779L,17780L,17781L,
-     17782L,17783L,17784L,17785L,17786L,17787L,17788L,17789L,
-     17790L,17791L,17791L,17792L,17793L,17794L,17795L,17796L,
-     17797L,17798L,17799L,17800L,17801L,17802L,17803L,17804L,
-     17805L,17806L,17807L,17808L,17809L,17810L,17811L,17812L,
-     17813L,17814L,17815L,17816L,17817L,17817L,17818L,17819L,
-     17820L,17821L,17822L,17823L,17824L,17825L,17826L,17827L,
-     17828L,17829L,17830L,17831L,17832L,17833L,17834L,17835L,
-     17836L,17837L,17838L,17839L,17840L,17841L,17842L,17842L,
-     17843L,17844L,17845L,17846L,17847L,17848L,17849L,17850L,
-     17851L,17852L,17853L,17854L,17855L,17856L,17857L,17858L,
-     17859L,17860L,17861L,17862L,17863L,17864L,17865L,17866L,
-     17867L,17868L,17868L,17869L,17870L,17871L,17872L,17873L,
-     17874L,17875L,17876L,17877L,17878L,17879L,17880L,17881L,
-     17882L,17883L,17884L,17885L,17886L,17887L,17888L,17889L,
-     17890L,17891L,17892L,17893L,17893L,17894L,17895L,17896L,
-     17897L,17898L,17899L,17900L,17901L,17902L,17903L,17904L,
-     17905L,17906L,17907L,17908L,17909L,17910L,17911L,17912L,
-     17913L,17914L,17915L,17916L,17917L,17918L,17918L,17919L,
-     17920L,17921L,17922L,17923L,17924L,17925L,17926L,17927L,
-     17928L,17929L,17930L,17931L,17932L,17933L,17934L,17935L,
-     17936L,17937L,17938L,17939L,17940L,17941L,17942L,17943L,
-     17943L,17944L,17945L,17946L,17947L,17948L,17949L,17950L,
-     17951L,17952L,17953L,17954L,17955L,17956L,17957L,17958L,
-     17959L,17960L,17961L,17962L,17963L,17964L,17965L,17966L,
-     17967L,17968L,17969L,17969L,17970L,17971L,17972L,17973L,
-     17974L,17975L,17976L,17977L,17978L,17979L,17980L,17981L,
-     17982L,17983L,17984L,17985L,17986L,17987L,17988L,17989L,
-     17990L,17991L,17992L,17993L,17994L,17994L,17995L,17996L,
-     17997L,17998L,17999L,18000L,18001L,18002L,18003L,18004L,
-     18005L,18006L,18007L,18008L,18009L,18010L,18011L,18012L,
-     18013L,18014L,18015L,18016L,18017L,18018L,18019L,18019L,
-     18020L,18021L,18022L,18023L,18024L,18025L,18026L,18027L,
-     18028L,18029L,18030L,18031L,18032L,18033L,18034L,18035L,
-     18036L,18037L,18038L,18039L,18040L,18041L,18042L,18043L,
-     18044L,18044L,18045L,18046L,18047L,18048L,18049L,18050L,
-     18051L,18052L,18053L,18054L,18055L,18056L,18057L,18058L,
-     18059L,18060L,18061L,18062L,18063L,18064L,18065L,18066L,
-     18067L,18068L,18068L,18069L,18070L,18071L,18072L,18073L,
-     18074L,18075L,18076L,18077L,18078L,18079L,18080L,18081L,
-     18082L,18083L,18084L,18085L,18086L,18087L,18088L,18089L,
-     18090L,18091L,18092L,18093L,18093L,18094L,18095L,18096L,
-     18097L,18098L,18099L,18100L,18101L,18102L,18103L,18104L,
-     18105L,18106L,18107L,18108L,18109L,18110L,18111L,18112L,
-     18113L,18114L,18115L,18116L,18117L,18118L,18118L,18119L,
-     18120L,18121L,18122L,18123L,18124L,18125L,18126L,18127L,
-     18128L,18129L,18130L,18131L,18132L,18133L,18134L,18135L,
-     18136L,18137L,18138L,18139L,18140L,18141L,18142L,18143L,
-     18143L,18144L,18145L,18146L,18147L,18148L,18149L,18150L,
-     18151L,18152L,18153L,18154L,18155L,18156L,18157L,18158L,
-     18159L,18160L,18161L,18162L,18163L,18164L,18165L,18166L,
-     18167L,18167L,18168L,18169L,18170L,18171L,18172L,18173L,
-     18174L,18175L,18176L,18177L,18178L,18179L,18180L,18181L,
-     18182L,18183L,18184L,18185L,18186L,18187L,18188L,18189L,
-     18190L,18191L,18192L,18192L,18193L,18194L,18195L,18196L,
-     18197L,18198L,18199L,18200L,18201L,18202L,18203L,18204L,
-     18205L,18206L,18207L,18208L,18209L,18210L,18211L,18212L,
-     18213L,18214L,18215L,18216L,18216L,18217L,18218L,18219L,
-     18220L,18221L,18222L,18223L,18224L,18225L,18226L,18227L,
-     18228L,18229L,18230L,18231L,18232L,18233L,18234L,18235L,
-     18236L,18237L,18238L,18239L,18240L,18240L,18241L,18242L,
-     18243L,18244L,18245L,18246L,18247L,18248L,18249L,18250L,
-     18251L,18252L,18253L,18254L,18255L,18256L,18257L,18258L,
-     18259L,18260L,18261L,18262L,18263L,18264L,18265L,18265L,
-     18266L,18267L,18268L,18269L,18270L,18271L,18272L,18273L,
-     18274L,18275L,18276L,18277L,18278L,18279L,18280L,18281L,
-     18282L,18283L,18284L,18285L,18286L,18287L,18288L,18289L,
-     18289L,18290L,18291L,18292L,18293L,18294L,18295L,18296L,
-     18297L,18298L,18299L,18300L,18301L,18302L,18303L,18304L,
-     18305L,18306L,18307L,18308L,18309L,18310L,18311L,18312L,
-     18313L,18313L,18314L,18315L,18316L,18317L,18318L,18319L,
-     18320L,18321L,18322L,18323L,18324L,18325L,18326L,18327L,
-     18328L,18329L,18330L,18331L,18332L,18333L,18334L,18335L,
-     18336L,18337L,18337L,18338L,18339L,18340L,18341L,18342L,
-     18343L,18344L,18345L,18346L,18347L,18348L,18349L,18350L,
-     18351L,18352L,18353L,18354L,18355L,18356L,18357L,18358L,
-     18359L,18360L,18361L,18361L,18362L,18363L,18364L,18365L,
-     18366L,18367L,18368L,18369L,18370L,18371L,18372L,18373L,
-     18374L,18375L,18376L,18377L,18378L,18379L,18380L,18381L,
-     18382L,18383L,18384L,18385L,18385L,18386L,18387L,18388L,
-     18389L,18390L,18391L,18392L,18393L,18394L,18395L,18396L,
-     18397L,18398L,18399L,18400L,18401L,18402L,18403L,18404L,
-     18405L,18406L,18407L,18408L,18409L,18409L,18410L,18411L,
-     18412L,18413L,18414L,18415L,18416L,18417L,18418L,18419L,
-     18420L,18421L,18422L,18423L,18424L,18425L,18426L,18427L,
-     18428L,18429L,18430L,18431L,18432L,18433L,18433L,18434L,
-     18435L,18436L,18437L,18438L,18439L,18440L,18441L,18442L,
-     18443L,18444L,18445L,18446L,18447L,18448L,18449L,18450L,
-     18451L,18452L,18453L,18454L,18455L,18456L,18456L,18457L,
-     18458L,18459L,18460L,18461L,18462L,18463L,18464L,18465L,
-     18466L,18467L,18468L,18469L,18470L,18471L,18472L,18473L,
-     18474L,18475L,18476L,18477L,18478L,18479L,18480L,18480L,
-     18481L,18482L,18483L,18484L,18485L,18486L,18487L,18488L,
-     18489L,18490L,18491L,18492L,18493L,18494L,18495L,18496L,
-     18497L,18498L,18499L,18500L,18501L,18502L,18503L,18504L,
-     18504L,18505L,18506L,18507L,18508L,18509L,18510L,18511L,
-     18512L,18513L,18514L,18515L,18516L,18517L,18518L,18519L,
-     18520L,18521L,18522L,18523L,18524L,18525L,18526L,18527L,
-     18527L,18528L,18529L,18530L,18531L,18532L,18533L,18534L,
-     18535L,18536L,18537L,18538L,18539L,18540L,18541L,18542L,
-     18543L,18544L,18545L,18546L,18547L,18548L,18549L,18550L,
-     18551L,18551L,18552L,18553L,18554L,18555L,18556L,18557L,
-     18558L,18559L,18560L,18561L,18562L,18563L,18564L,18565L,
-     18566L,18567L,18568L,18569L,18570L,18571L,18572L,18573L,
-     18574L,18574L,18575L,18576L,18577L,18578L,18579L,18580L,
-     18581L,18582L,18583L,18584L,18585L,18586L,18587L,18588L,
-     18589L,18590L,18591L,18592L,18593L,18594L,18595L,18596L,
-     18597L,18597L,18598L,18599L,18600L,18601L,18602L,18603L,
-     18604L,18605L,18606L,18607L,18608L,18609L,18610L,18611L,
-     18612L,18613L,18614L,18615L,18616L,18617L,18618L,18619L,
-     18620L,18621L,18621L,18622L,18623L,18624L,18625L,18626L,
-     18627L,18628L,18629L,18630L,18631L,18632L,18633L,18634L,
-     18635L,18636L,18637L,18638L,18639L,18640L,18641L,18642L,
-     18643L,18644L,18644L,18645L,18646L,18647L,18648L,18649L,
-     18650L,18651L,18652L,18653L,18654L,18655L,18656L,18657L,
-     18658L,18659L,18660L,18661L,18662L,18663L,18664L,18665L,
-     18666L,18667L,18667L,18668L,18669L,18670L,18671L,18672L,
-     18673L,18674L,18675L,18676L,18677L,18678L,18679L,18680L,
-     18681L,18682L,18683L,18684L,18685L,18686L,18687L,18688L,
-     18689L,18690L,18690L,18691L,18692L,18693L,18694L,18695L,
-     18696L,18697L,18698L,18699L,18700L,18701L,18702L,18703L,
-     18704L,18705L,18706L,18707L,18708L,18709L,18710L,18711L,
-     18712L,18713L,18713L,18714L,18715L,18716L,18717L,18718L,
-     18719L,18720L,18721L,18722L,18723L,18724L,18725L,18726L,
-     18727L,18728L,18729L,18730L,18731L,18732L,18733L,18734L,
-     18735L,18736L,18736L,18737L,18738L,18739L,18740L,18741L,
-     18742L,18743L,18744L,18745L,18746L,18747L,18748L,18749L,
-     18750L,18751L,18752L,18753L,18754L,18755L,18756L,18757L,
-     18758L,18759L,18759L,18760L,18761L,18762L,18763L,18764L,
-     18765L,18766L,18767L,18768L,18769L,18770L,18771L,18772L,
-     18773L,18774L,18775L,18776L,18777L,18778L,18779L,18780L,
-     18781L,18782L,18782L,18783L,18784L,18785L,18786L,18787L,
-     18788L,18789L,18790L,18791L,18792L,18793L,18794L,18795L,
-     18796L,18797L,18798L,18799L,18800L,18801L,18802L,18803L,
-     18804L,18805L,18805L,18806L,18807L,18808L,18809L,18810L,
-     18811L,18812L,18813L,18814L,18815L,18816L,18817L,18818L,
-     18819L,18820L,18821L,18822L,18823L,18824L,18825L,18826L,
-     18827L,18828L,18828L,18829L,18830L,18831L,18832L,18833L,
-     18834L,18835L,18836L,18837L,18838L,18839L,18840L,18841L,
-     18842L,18843L,18844L,18845L,18846L,18847L,18848L,18849L,
-     18850L,18850L,18851L,18852L,18853L,18854L,18855L,18856L,
-     18857L,18858L,18859L,18860L,18861L,18862L,18863L,18864L,
-     18865L,18866L,18867L,18868L,18869L,18870L,18871L,18872L,
-     18873L,18873L,18874L,18875L,18876L,18877L,18878L,18879L,
-     18880L,18881L,18882L,18883L,18884L,18885L,18886L,18887L,
-     18888L,18889L,18890L,18891L,18892L,18893L,18894L,18895L,
-     18896L,18896L,18897L,18898L,18899L,18900L,18901L,18902L,
-     18903L,18904L,18905L,18906L,18907L,18908L,18909L,18910L,
-     18911L,18912L,18913L,18914L,18915L,18916L,18917L,18918L,
-     18918L,18919L,18920L,18921L,18922L,18923L,18924L,18925L,
-     18926L,18927L,18928L,18929L,18930L,18931L,18932L,18933L,
-     18934L,18935L,18936L,18937L,18938L,18939L,18940L,18941L,
-     18941L,18942L,18943L,18944L,18945L,18946L,18947L,18948L,
-     18949L,18950L,18951L,18952L,18953L,18954L,18955L,18956L,
-     18957L,18958L,18959L,18960L,18961L,18962L,18963L,18963L,
-     18964L,18965L,18966L,18967L,18968L,18969L,18970L,18971L,
-     18972L,18973L,18974L,18975L,18976L,18977L,18978L,18979L,
-     18980L,18981L,18982L,18983L,18984L,18985L,18985L,18986L,
-     18987L,18988L,18989L,18990L,18991L,18992L,18993L,18994L,
-     18995L,18996L,18997L,18998L,18999L,19000L,19001L,19002L,
-     19003L,19004L,19005L,19006L,19007L,19008L,19008L,19009L,
-     19010L,19011L,19012L,19013L,19014L,19015L,19016L,19017L,
-     19018L,19019L,19020L,19021L,19022L,19023L,19024L,19025L,
-     19026L,19027L,19028L,19029L,19030L,19030L,19031L,19032L,
-     19033L,19034L,19035L,19036L,19037L,19038L,19039L,19040L,
-     19041L,19042L,19043L,19044L,19045L,19046L,19047L,19048L,
-     19049L,19050L,19051L,19052L,19052L,19053L,19054L,19055L,
-     19056L,19057L,19058L,19059L,19060L,19061L,19062L,19063L,
-     19064L,19065L,19066L,19067L,19068L,19069L,19070L,19071L,
-     19072L,19073L,19074L,19074L,19075L,19076L,19077L,19078L,
-     19079L,19080L,19081L,19082L,19083L,19084L,19085L,19086L,
-     19087L,19088L,19089L,19090L,19091L,19092L,19093L,19094L,
-     19095L,19096L,19096L,19097L,19098L,19099L,19100L,19101L,
-     19102L,19103L,19104L,19105L,19106L,19107L,19108L,19109L,
-     19110L,19111L,19112L,19113L,19114L,19115L,19116L,19117L,
-     19118L,19118L,19119L,19120L,19121L,19122L,19123L,19124L,
-     19125L,19126L,19127L,19128L,19129L,19130L,19131L,19132L,
-     19133L,19134L,19135L,19136L,19137L,19138L,19139L,19140L,
-     19140L,19141L,19142L,19143L,19144L,19145L,19146L,19147L,
-     19148L,19149L,19150L,19151L,19152L,19153L,19154L,19155L,
-     19156L,19157L,19158L,19159L,19160L,19161L,19162L,19162L,
-     19163L,19164L,19165L,19166L,19167L,19168L,19169L,19170L,
-     19171L,19172L,19173L,19174L,19175L,19176L,19177L,19178L,
-     19179L,19180L,19181L,19182L,19183L,19184L,19184L,19185L,
-     19186L,19187L,19188L,19189L,19190L,19191L,19192L,19193L,
-     19194L,19195L,19196L,19197L,19198L,19199L,19200L,19201L,
-     19202L,19203L,19204L,19205L,19206L,19206L,19207L,19208L,
-     19209L,19210L,19211L,19212L,19213L,19214L,19215L,19216L,
-     19217L,19218L,19219L,19220L,19221L,19222L,19223L,19224L,
-     19225L,19226L,19227L,19228L,19228L,19229L,19230L,19231L,
-     19232L,19233L,19234L,19235L,19236L,19237L,19238L,19239L,
-     19240L,19241L,19242L,19243L,19244L,19245L,19246L,19247L,
-     19248L,19249L,19249L,19250L,19251L,19252L,19253L,19254L,
-     19255L,19256L,19257L,19258L,19259L,19260L,19261L,19262L,
-     19263L,19264L,19265L,19266L,19267L,19268L,19269L,19270L,
-     19271L,19271L,19272L,19273L,19274L,19275L,19276L,19277L,
-     19278L,19279L,19280L,19281L,19282L,19283L,19284L,19285L,
-     19286L,19287L,19288L,19289L,19290L,19291L,19292L,19293L,
-     19293L,19294L,19295L,19296L,19297L,19298L,19299L,19300L,
-     19301L,19302L,19303L,19304L,19305L,19306L,19307L,19308L,
-     19309L,19310L,19311L,19312L,19313L,19314L,19314L,19315L,
-     19316L,19317L,19318L,19319L,19320L,19321L,19322L,19323L,
-     19324L,19325L,19326L,19327L,19328L,19329L,19330L,19331L,
-     19332L,19333L,19334L,19335L,19336L,19336L,19337L,19338L,
-     19339L,19340L,19341L,19342L,19343L,19344L,19345L,19346L,
-     19347L,19348L,19349L,19350L,19351L,19352L,19353L,19354L,
-     19355L,19356L,19357L,19357L,19358L,19359L,19360L,19361L,
-     19362L,19363L,19364L,19365L,19366L,19367L,19368L,19369L,
-     19370L,19371L,19372L,19373L,19374L,19375L,19376L,19377L,
-     19378L,19378L,19379L,19380L,19381L,19382L,19383L,19384L,
-     19385L,19386L,19387L,19388L,19389L,19390L,19391L,19392L,
-     19393L,19394L,19395L,19396L,19397L,19398L,19399L,19400L,
-     19400L,19401L,19402L,19403L,19404L,19405L,19406L,19407L,
-     19408L,19409L,19410L,19411L,19412L,19413L,19414L,19415L,
-     19416L,19417L,19418L,19419L,19420L,19421L,19421L,19422L,
-     19423L,19424L,19425L,19426L,19427L,19428L,19429L,19430L,
-     19431L,19432L,19433L,19434L,19435L,19436L,19437L,19438L,
-     19439L,19440L,19441L,19442L,19442L,19443L,19444L,19445L,
-     19446L,19447L,19448L,19449L,19450L,19451L,19452L,19453L,
-     19454L,19455L,19456L,19457L,19458L,19459L,19460L,19461L,
-     19462L,19463L,19463L,19464L,19465L,19466L,19467L,19468L,
-     19469L,19470L,19471L,19472L,19473L,19474L,19475L,19476L,
-     19477L,19478L,19479L,19480L,19481L,19482L,19483L,19484L,
-     19485L,19485L,19486L,19487L,19488L,19489L,19490L,19491L,
-     19492L,19493L,19494L,19495L,19496L,19497L,19498L,19499L,
-     19500L,19501L,19502L,19503L,19504L,19505L,19506L,19506L,
-     19507L,19508L,19509L,19510L,19511L,19512L,19513L,19514L,
-     19515L,19516L,19517L,19518L,19519L,19520L,19521L,19522L,
-     19523L,19524L,19525L,19526L,19527L,19527L,19528L,19529L,
-     19530L,19531L,19532L,19533L,19534L,19535L,19536L,19537L,
-     19538L,19539L,19540L,19541L,19542L,19543L,19544L,19545L,
-     19546L,19547L,19548L,19548L,19549L,19550L,19551L,19552L,
-     19553L,19554L,19555L,19556L,19557L,19558L,19559L,19560L,
-     19561L,19562L,19563L,19564L,19565L,19566L,19567L,19568L,
-     19569L,19569L,19570L,19571L,19572L,19573L,19574L,19575L,
-     19576L,19577L,19578L,19579L,19580L,19581L,19582L,19583L,
-     19584L,19585L,19586L,19587L,19588L,19589L,19590L,19590L,
-     19591L,19592L,19593L,19594L,19595L,19596L,19597L,19598L,
-     19599L,19600L,19601L,19602L,19603L,19604L,19605L,19606L,
-     19607L,19608L,19609L,19610L,19610L,19611L,19612L,19613L,
-     19614L,19615L,19616L,19617L,19618L,19619L,19620L,19621L,
-     19622L,19623L,19624L,19625L,19626L,19627L,19628L,19629L,
-     19630L,19631L,19631L,19632L,19633L,19634L,19635L,19636L,
-     19637L,19638L,19639L,19640L,19641L,19642L,19643L,19644L,
-     19645L,19646L,19647L,19648L,19649L,19650L,19651L,19652L,
-     19652L,19653L,19654L,19655L,19656L,19657L,19658L,19659L,
-     19660L,19661L,19662L,19663L,19664L,19665L,19666L,19667L,
-     19668L,19669L,19670L,19671L,19672L,19673L,19673L,19674L,
-     19675L,19676L,19677L,19678L,19679L,19680L,19681L,19682L,
-     19683L,19684L,19685L,19686L,19687L,19688L,19689L,19690L,
-     19691L,19692L,19693L,19693L,19694L,19695L,19696L,19697L,
-     19698L,19699L,19700L,19701L,19702L,19703L,19704L,19705L,
-     19706L,19707L,19708L,19709L,19710L,19711L,19712L,19713L,
-     19714L,19714L,19715L,19716L,19717L,19718L,19719L,19720L,
-     19721L,19722L,19723L,19724L,19725L,19726L,19727L,19728L,
-     19729L,19730L,19731L,19732L,19733L,19734L,19735L,19735L,
-     19736L,19737L,19738L,19739L,19740L,19741L,19742L,19743L,
-     19744L,19745L,19746L,19747L,19748L,19749L,19750L,19751L,
-     19752L,19753L,19754L,19755L,19755L,19756L,19757L,19758L,
-     19759L,19760L,19761L,19762L,19763L,19764L,19765L,19766L,
-     19767L,19768L,19769L,19770L,19771L,19772L,19773L,19774L,
-     19775L,19776L,19776L,19777L,19778L,19779L,19780L,19781L,
-     19782L,19783L,19784L,19785L,19786L,19787L,19788L,19789L,
-     19790L,19791L,19792L,19793L,19794L,19795L,19796L,19796L,
-     19797L,19798L,19799L,19800L,19801L,19802L,19803L,19804L,
-     19805L,19806L,19807L,19808L,19809L,19810L,19811L,19812L,
-     19813L,19814L,19815L,19816L,19816L,19817L,19818L,19819L,
-     19820L,19821L,19822L,19823L,19824L,19825L,19826L,19827L,
-     19828L,19829L,19830L,19831L,19832L,19833L,19834L,19835L,
-     19836L,19837L,19837L,19838L,19839L,19840L,19841L,19842L,
-     19843L,19844L,19845L,19846L,19847L,19848L,19849L,19850L,
-     19851L,19852L,19853L,19854L,19855L,19856L,19857L,19857L,
-     19858L,19859L,19860L,19861L,19862L,19863L,19864L,19865L,
-     19866L,19867L,19868L,19869L,19870L,19871L,19872L,19873L,
-     19874L,19875L,19876L,19877L,19877L,19878L,19879L,19880L,
-     19881L,19882L,19883L,19884L,19885L,19886L,19887L,19888L,
-     19889L,19890L,19891L,19892L,19893L,19894L,19895L,19896L,
-     19897L,19897L,19898L,19899L,19900L,19901L,19902L,19903L,
-     19904L,19905L,19906L,19907L,19908L,19909L,19910L,19911L,
-     19912L,19913L,19914L,19915L,19916L,19917L,19918L,19918L,
-     19919L,19920L,19921L,19922L,19923L,19924L,19925L,19926L,
-     19927L,19928L,19929L,19930L,19931L,19932L,19933L,19934L,
-     19935L,19936L,19937L,19938L,19938L,19939L,19940L,19941L,
-     19942L,19943L,19944L,19945L,19946L,19947L,19948L,19949L,
-     19950L,19951L,19952L,19953L,19954L,19955L,19956L,19957L,
-     19958L,19958L,19959L,19960L,19961L,19962L,19963L,19964L,
-     19965L,19966L,19967L,19968L,19969L,19970L,19971L,19972L,
-     19973L,19974L,19975L,19976L,19977L,19978L,19978L,19979L,
-     19980L,19981L,19982L,19983L,19984L,19985L,19986L,19987L,
-     19988L,19989L,19990L,19991L,19992L,19993L,19994L,19995L,
-     19996L,19997L,19998L,19998L,19999L,20000L,20001L,20002L,
-     20003L,20004L,20005L,20006L,20007L,20008L,20009L,20010L,
-     20011L,20012L,20013L,20014L,20015L,20016L,20017L,20018L,
-     20018L,20019L,20020L,20021L,20022L,20023L,20024L,20025L,
-     20026L,20027L,20028L,20029L,20030L,20031L,20032L,20033L,
-     20034L,20035L,20036L,20037L,20038L,20038L,20039L,20040L,
-     20041L,20042L,20043L,20044L,20045L,20046L,20047L,20048L,
-     20049L,20050L,20051L,20052L,20053L,20054L,20055L,20056L,
-     20057L,20058L,20058L,20059L,20060L,20061L,20062L,20063L,
-     20064L,20065L,20066L,20067L,20068L,20069L,20070L,20071L,
-     20072L,20073L,20074L,20075L,20076L,20077L,20077L,20078L,
-     20079L,20080L,20081L,20082L,20083L,20084L,20085L,20086L,
-     20087L,20088L,20089L,20090L,20091L,20092L,20093L,20094L,
-     20095L,20096L,20097L,20097L,20098L,20099L,20100L,20101L,
-     20102L,20103L,20104L,20105L,20106L,20107L,20108L,20109L,
-     20110L,20111L,20112L,20113L,20114L,20115L,20116L,20117L,
-     20117L,20118L,20119L,20120L,20121L,20122L,20123L,20124L,
-     20125L,20126L,20127L,20128L,20129L,20130L,20131L,20132L,
-     20133L,20134L,20135L,20136L,20137L,20137L,20138L,20139L,
-     20140L,20141L,20142L,20143L,20144L,20145L,20146L,20147L,
-     20148L,20149L,20150L,20151L,20152L,20153L,20154L,20155L,
-     20156L,20156L,20157L,20158L,20159L,20160L,20161L,20162L,
-     20163L,20164L,20165L,20166L,20167L,20168L,20169L,20170L,
-     20171L,20172L,20173L,20174L,20175L,20176L,20176L,20177L,
-     20178L,20179L,20180L,20181L,20182L,20183L,20184L,20185L,
-     20186L,20187L,20188L,20189L,20190L,20191L,20192L,20193L,
-     20194L,20195L,20195L,20196L,20197L,20198L,20199L,20200L,
-     20201L,20202L,20203L,20204L,20205L,20206L,20207L,20208L,
-     20209L,20210L,20211L,20212L,20213L,20214L,20215L,20215L,
-     20216L,20217L,20218L,20219L,20220L,20221L,20222L,20223L,
-     20224L,20225L,20226L,20227L,20228L,20229L,20230L,20231L,
-     20232L,20233L,20234L,20234L,20235L,20236L,20237L,20238L,
-     20239L,20240L,20241L,20242L,20243L,20244L,20245L,20246L,
-     20247L,20248L,20249L,20250L,20251L,20252L,20253L,20254L,
-     20254L,20255L,20256L,20257L,20258L,20259L,20260L,20261L,
-     20262L,20263L,20264L,20265L,20266L,20267L,20268L,20269L,
-     20270L,20271L,20272L,20273L,20273L,20274L,20275L,20276L,
-     20277L,20278L,20279L,20280L,20281L,20282L,20283L,20284L,
-     20285L,20286L,20287L,20288L,20289L,20290L,20291L,20292L,
-     20293L,20293L,20294L,20295L,20296L,20297L,20298L,20299L,
-     20300L,20301L,20302L,20303L,20304L,20305L,20306L,20307L,
-     20308L,20309L,20310L,20311L,20312L,20312L,20313L,20314L,
-     20315L,20316L,20317L,20318L,20319L,20320L,20321L,20322L,
-     20323L,20324L,20325L,20326L,20327L,20328L,20329L,20330L,
-     20331L,20331L,20332L,20333L,20334L,20335L,20336L,20337L,
-     20338L,20339L,20340L,20341L,20342L,20343L,20344L,20345L,
-     20346L,20347L,20348L,20349L,20350L,20351L,20351L,20352L,
-     20353L,20354L,20355L,20356L,20357L,20358L,20359L,20360L,
-     20361L,20362L,20363L,20364L,20365L,20366L,20367L,20368L,
-     20369L,20370L,20370L,20371L,20372L,20373L,20374L,20375L,
-     20376L,20377L,20378L,20379L,20380L,20381L,20382L,20383L,
-     20384L,20385L,20386L,20387L,20388L,20389L,20389L,20390L,
-     20391L,20392L,20393L,20394L,20395L,20396L,20397L,20398L,
-     20399L,20400L,20401L,20402L,20403L,20404L,20405L,20406L,
-     20407L,20408L,20408L,20409L,20410L,20411L,20412L,20413L,
-     20414L,20415L,20416L,20417L,20418L,20419L,20420L,20421L,
-     20422L,20423L,20424L,20425L,20426L,20427L,20427L,20428L,
-     20429L,20430L,20431L,20432L,20433L,20434L,20435L,20436L,
-     20437L,20438L,20439L,20440L,20441L,20442L,20443L,20444L,
-     20445L,20446L,20446L,20447L,20448L,20449L,20450L,20451L,
-     20452L,20453L,20454L,20455L,20456L,20457L,20458L,20459L,
-     20460L,20461L,20462L,20463L,20464L,20465L,20465L,20466L,
-     20467L,20468L,20469L,20470L,20471L,20472L,20473L,20474L,
-     20475L,20476L,20477L,20478L,20479L,20480L,20481L,20482L,
-     20483L,20484L,20484L,20485L,20486L,20487L,20488L,20489L,
-     20490L,20491L,20492L,20493L,20494L,20495L,20496L,20497L,
-     20498L,20499L,20500L,20501L,20502L,20503L,20503L,20504L,
-     20505L,20506L,20507L,20508L,20509L,20510L,20511L,20512L,
-     20513L,20514L,20515L,20516L,20517L,20518L,20519L,20520L,
-     20521L,20522L,20522L,20523L,20524L,20525L,20526L,20527L,
-     20528L,20529L,20530L,20531L,20532L,20533L,20534L,20535L,
-     20536L,20537L,20538L,20539L,20540L,20541L,20541L,20542L,
-     20543L,20544L,20545L,20546L,20547L,20548L,20549L,20550L,
-     20551L,20552L,20553L,20554L,20555L,20556L,20557L,20558L,
-     20559L,20560L,20560L,20561L,20562L,20563L,20564L,20565L,
-     20566L,20567L,20568L,20569L,20570L,20571L,20572L,20573L,
-     20574L,20575L,20576L,20577L,20578L,20579L,20579L,20580L,
-     20581L,20582L,20583L,20584L,20585L,20586L,20587L,20588L,
-     20589L,20590L,20591L,20592L,20593L,20594L,20595L,20596L,
-     20597L,20597L,20598L,20599L,20600L,20601L,20602L,20603L,
-     20604L,20605L,20606L,20607L,20608L,20609L,20610L,20611L,
-     20612L,20613L,20614L,20615L,20616L,20616L,20617L,20618L,
-     20619L,20620L,20621L,20622L,20623L,20624L,20625L,20626L,
-     20627L,20628L,20629L,20630L,20631L,20632L,20633L,20634L,
-     20635L,20635L,20636L,20637L,20638L,20639L,20640L,20641L,
-     20642L,20643L,20644L,20645L,20646L,20647L,20648L,20649L,
-     20650L,20651L,20652L,20653L,20653L,20654L,20655L,20656L,
-     20657L,20658L,20659L,20660L,20661L,20662L,20663L,20664L,
-     20665L,20666L,20667L,20668L,20669L,20670L,20671L,20672L,
-     20672L,20673L,20674L,20675L,20676L,20677L,20678L,20679L,
-     20680L,20681L,20682L,20683L,20684L,20685L,20686L,20687L,
-     20688L,20689L,20690L,20691L,20691L,20692L,20693L,20694L,
-     20695L,20696L,20697L,20698L,20699L,20700L,20701L,20702L,
-     20703L,20704L,20705L,20706L,20707L,20708L,20709L,20709L,
-     20710L,20711L,20712L,20713L,20714L,20715L,20716L,20717L,
-     20718L,20719L,20720L,20721L,20722L,20723L,20724L,20725L,
-     20726L,20727L,20728L,20728L,20729L,20730L,20731L,20732L,
-     20733L,20734L,20735L,20736L,20737L,20738L,20739L,20740L,
-     20741L,20742L,20743L,20744L,20745L,20746L,20746L,20747L,
-     20748L,20749L,20750L,20751L,20752L,20753L,20754L,20755L,
-     20756L,20757L,20758L,20759L,20760L,20761L,20762L,20763L,
-     20764L,20764L,20765L,20766L,20767L,20768L,20769L,20770L,
-     20771L,20772L,20773L,20774L,20775L,20776L,20777L,20778L,
-     20779L,20780L,20781L,20782L,20783L,20783L,20784L,20785L,
-     20786L,20787L,20788L,20789L,20790L,20791L,20792L,20793L,
-     20794L,20795L,20796L,20797L,20798L,20799L,20800L,20801L,
-     20801L,20802L,20803L,20804L,20805L,20806L,20807L,20808L,
-     20809L,20810L,20811L,20812L,20813L,20814L,20815L,20816L,
-     20817L,20818L,20819L,20820L,20820L,20821L,20822L,20823L,
-     20824L,20825L,20826L,20827L,20828L,20829L,20830L,20831L,
-     20832L,20833L,20834L,20835L,20836L,20837L,20838L,20838L,
-     20839L,20840L,20841L,20842L,20843L,20844L,20845L,20846L,
-     20847L,20848L,20849L,20850L,20851L,20852L,20853L,20854L,
-     20855L,20856L,20856L,20857L,20858L,20859L,20860L,20861L,
-     20862L,20863L,20864L,20865L,20866L,20867L,20868L,20869L,
-     20870L,20871L,20872L,20873L,20874L,20874L,20875L,20876L,
-     20877L,20878L,20879L,20880L,20881L,20882L,20883L,20884L,
-     20885L,20886L,20887L,20888L,20889L,20890L,20891L,20892L,
-     20892L,20893L,20894L,20895L,20896L,20897L,20898L,20899L,
-     20900L,20901L,20902L,20903L,20904L,20905L,20906L,20907L,
-     20908L,20909L,20910L,20911L,20911L,20912L,20913L,20914L,
-     20915L,20916L,20917L,20918L,20919L,20920L,20921L,20922L,
-     20923L,20924L,20925L,20926L,20927L,20928L,20929L,20929L,
-     20930L,20931L,20932L,20933L,20934L,20935L,20936L,20937L,
-     20938L,20939L,20940L,20941L,20942L,20943L,20944L,20945L,
-     20946L,20947L,20947L,20948L,20949L,20950L,20951L,20952L,
-     20953L,20954L,20955L,20956L,20957L,20958L,20959L,20960L,
-     20961L,20962L,20963L,20964L,20965L,20965L,20966L,20967L,
-     20968L,20969L,20970L,20971L,20972L,20973L,20974L,20975L,
-     20976L,20977L,20978L,20979L,20980L,20981L,20982L,20983L,
-     20983L,20984L,20985L,20986L,20987L,20988L,20989L,20990L,
-     20991L,20992L,20993L,20994L,20995L,20996L,20997L,20998L,
-     20999L,21000L,21001L,21001L,21002L,21003L,21004L,21005L,
-     21006L,21007L,21008L,21009L,21010L,21011L,21012L,21013L,
-     21014L,21015L,21016L,21017L,21018L,21019L,21019L,21020L,
-     21021L,21022L,21023L,21024L,21025L,21026L,21027L,21028L,
-     21029L,21030L,21031L,21032L,21033L,21034L,21035L,21036L,
-     21037L,21037L,21038L,21039L,21040L,21041L,21042L,21043L,
-     21044L,21045L,21046L,21047L,21048L,21049L,21050L,21051L,
-     21052L,21053L,21054L,21055L,21055L,21056L,21057L,21058L,
-     21059L,21060L,21061L,21062L,21063L,21064L,21065L,21066L,
-     21067L,21068L,21069L,21070L,21071L,21072L,21072L,21073L,
-     21074L,21075L,21076L,21077L,21078L,21079L,21080L,21081L,
-     21082L,21083L,21084L,21085L,21086L,21087L,21088L,21089L,
-     21090L,21090L,21091L,21092L,21093L,21094L,21095L,21096L,
-     21097L,21098L,21099L,21100L,21101L,21102L,21103L,21104L,
-     21105L,21106L,21107L,21108L,21108L,21109L,21110L,21111L,
-     21112L,21113L,21114L,21115L,21116L,21117L,21118L,21119L,
-     21120L,21121L,21122L,21123L,21124L,21125L,21126L,21126L,
-     21127L,21128L,21129L,21130L,21131L,21132L,21133L,21134L,
-     21135L,21136L,21137L,21138L,21139L,21140L,21141L,21142L,
-     21143L,21144L,21144L,21145L,21146L,21147L,21148L,21149L,
-     21150L,21151L,21152L,21153L,21154L,21155L,21156L,21157L,
-     21158L,21159L,21160L,21161L,21161L,21162L,21163L,21164L,
-     21165L,21166L,21167L,21168L,21169L,21170L,21171L,21172L,
-     21173L,21174L,21175L,21176L,21177L,21178L,21179L,21179L,
-     21180L,21181L,21182L,21183L,21184L,21185L,21186L,21187L,
-     21188L,21189L,21190L,21191L,21192L,21193L,21194L,21195L,
-     21196L,21196L,21197L,21198L,21199L,21200L,21201L,21202L,
-     21203L,21204L,21205L,21206L,21207L,21208L,21209L,21210L,
-     21211L,21212L,21213L,21214L,21214L,21215L,21216L,21217L,
-     21218L,21219L,21220L,21221L,21222L,21223L,21224L,21225L,
-     21226L,21227L,21228L,21229L,21230L,21231L,21232L,21232L,
-     21233L,21234L,21235L,21236L,21237L,21238L,21239L,21240L,
-     21241L,21242L,21243L,21244L,21245L,21246L,21247L,21248L,
-     21249L,21249L,21250L,21251L,21252L,21253L,21254L,21255L,
-     21256L,21257L,21258L,21259L,21260L,21261L,21262L,21263L,
-     21264L,21265L,21266L,21267L,21267L,21268L,21269L,21270L,
-     21271L,21272L,21273L,21274L,21275L,21276L,21277L,21278L,
-     21279L,21280L,21281L,21282L,21283L,21284L,21284L,21285L,
-     21286L,21287L,21288L,21289L,21290L,21291L,21292L,21293L,
-     21294L,21295L,21296L,21297L,21298L,21299L,21300L,21301L,
-     21302L,21302L,21303L,21304L,21305L,21306L,21307L,21308L,
-     21309L,21310L,21311L,21312L,21313L,21314L,21315L,21316L,
-     21317L,21318L,21319L,21319L,21320L,21321L,21322L,21323L,
-     21324L,21325L,21326L,21327L,21328L,21329L,21330L,21331L,
-     21332L,21333L,21334L,21335L,21336L,21336L,21337L,21338L,
-     21339L,21340L,21341L,21342L,21343L,21344L,21345L,21346L,
-     21347L,21348L,21349L,21350L,21351L,21352L,21353L,21354L,
-     21354L,21355L,21356L,21357L,21358L,21359L,21360L,21361L,
-     21362L,21363L,21364L,21365L,21366L,21367L,21368L,21369L,
-     21370L,21371L,21371L,21372L,21373L,21374L,21375L,21376L,
-     21377L,21378L,21379L,21380L,21381L,21382L,21383L,21384L,
-     21385L,21386L,21387L,21388L,21388L,21389L,21390L,21391L,
-     21392L,21393L,21394L,21395L,21396L,21397L,21398L,21399L,
-     21400L,21401L,21402L,21403L,21404L,21405L,21406L,21406L,
-     21407L,21408L,21409L,21410L,21411L,21412L,21413L,21414L,
-     21415L,21416L,21417L,21418L,21419L,21420L,21421L,21422L,
-     21423L,21423L,21424L,21425L,21426L,21427L,21428L,21429L,
-     21430L,21431L,21432L,21433L,21434L,21435L,21436L,21437L,
-     21438L,21439L,21440L,21440L,21441L,21442L,21443L,21444L,
-     21445L,21446L,21447L,21448L,21449L,21450L,21451L,21452L,
-     21453L,21454L,21455L,21456L,21457L,21457L,21458L,21459L,
-     21460L,21461L,21462L,21463L,21464L,21465L,21466L,21467L,
-     21468L,21469L,21470L,21471L,21472L,21473L,21474L,21474L,
-     21475L,21476L,21477L,21478L,21479L,21480L,21481L,21482L,
-     21483L,21484L,21485L,21486L,21487L,21488L,21489L,21490L,
-     21491L,21491L,21492L,21493L,21494L,21495L,21496L,21497L,
-     21498L,21499L,21500L,21501L,21502L,21503L,21504L,21505L,
-     21506L,21507L,21508L,21508L,21509L,21510L,21511L,21512L,
-     21513L,21514L,21515L,21516L,21517L,21518L,21519L,21520L,
-     21521L,21522L,21523L,21524L,21525L,21525L,21526L,21527L,
-     21528L,21529L,21530L,21531L,21532L,21533L,21534L,21535L,
-     21536L,21537L,21538L,21539L,21540L,21541L,21542L,21542L,
-     21543L,21544L,21545L,21546L,21547L,21548L,21549L,21550L,
-     21551L,21552L,21553L,21554L,21555L,21556L,21557L,21558L,
-     21559L,21559L,21560L,21561L,21562L,21563L,21564L,21565L,
-     21566L,21567L,21568L,21569L,21570L,21571L,21572L,21573L,
-     21574L,21575L,21576L,21576L,21577L,21578L,21579L,21580L,
-     21581L,21582L,21583L,21584L,21585L,21586L,21587L,21588L,
-     21589L,21590L,21591L,21592L,21593L,21593L,21594L,21595L,
-     21596L,21597L,21598L,21599L,21600L,21601L,21602L,21603L,
-     21604L,21605L,21606L,21607L,21608L,21609L,21610L,21610L,
-     21611L,21612L,21613L,21614L,21615L,21616L,21617L,21618L,
-     21619L,21620L,21621L,21622L,21623L,21624L,21625L,21626L,
-     21627L,21627L,21628L,21629L,21630L,21631L,21632L,21633L,
-     21634L,21635L,21636L,21637L,21638L,21639L,21640L,21641L,
-     21642L,21643L,21644L,21644L,21645L,21646L,21647L,21648L,
-     21649L,21650L,21651L,21652L,21653L,21654L,21655L,21656L,
-     21657L,21658L,21659L,21660L,21661L,21661L,21662L,21663L,
-     21664L,21665L,21666L,21667L,21668L,21669L,21670L,21671L,
-     21672L,21673L,21674L,21675L,21676L,21677L,21677L,21678L,
-     21679L,21680L,21681L,21682L,21683L,21684L,21685L,21686L,
-     21687L,21688L,21689L,21690L,21691L,21692L,21693L,21694L,
-     21694L,21695L,21696L,21697L,21698L,21699L,21700L,21701L,
-     21702L,21703L,21704L,21705L,21706L,21707L,21708L,21709L,
-     21710L,21711L,21711L,21712L,21713L,21714L,21715L,21716L,
-     21717L,21718L,21719L,21720L,21721L,21722L,21723L,21724L,
-     21725L,21726L,21727L,21728L,21728L,21729L,21730L,21731L,
-     21732L,21733L,21734L,21735L,21736L,21737L,21738L,21739L,
-     21740L,21741L,21742L,21743L,21744L,21744L,21745L,21746L,
-     21747L,21748L,21749L,21750L,21751L,21752L,21753L,21754L,
-     21755L,21756L,21757L,21758L,21759L,21760L,21761L,21761L,
-     21762L,21763L,21764L,21765L,21766L,21767L,21768L,21769L,
-     21770L,21771L,21772L,21773L,21774L,21775L,21776L,21777L,
-     21778L,21778L,21779L,21780L,21781L,21782L,21783L,21784L,
-     21785L,21786L,21787L,21788L,21789L,21790L,21791L,21792L,
-     21793L,21794L,21794L,21795L,21796L,21797L,21798L,21799L,
-     21800L,21801L,21802L,21803L,21804L,21805L,21806L,21807L,
-     21808L,21809L,21810L,21811L,21811L,21812L,21813L,21814L,
-     21815L,21816L,21817L,21818L,21819L,21820L,21821L,21822L,
-     21823L,21824L,21825L,21826L,21827L,21827L,21828L,21829L,
-     21830L,21831L,21832L,21833L,21834L,21835L,21836L,21837L,
-     21838L,21839L,21840L,21841L,21842L,21843L,21844L,21844L,
-     21845L,21846L,21847L,21848L,21849L,21850L,21851L,21852L,
-     21853L,21854L,21855L,21856L,21857L,21858L,21859L,21860L,
-     21860L,21861L,21862L,21863L,21864L,21865L,21866L,21867L,
-     21868L,21869L,21870L,21871L,21872L,21873L,21874L,21875L,
-     21876L,21877L,21877L,21878L,21879L,21880L,21881L,21882L,
-     21883L,21884L,21885L,21886L,21887L,21888L,21889L,21890L,
-     21891L,21892L,21893L,21893L,21894L,21895L,21896L,21897L,
-     21898L,21899L,21900L,21901L,21902L,21903L,21904L,21905L,
-     21906L,21907L,21908L,21909L,21909L,21910L,21911L,21912L,
-     21913L,21914L,21915L,21916L,21917L,21918L,21919L,21920L,
-     21921L,21922L,21923L,21924L,21925L,21926L,21926L,21927L,
-     21928L,21929L,21930L,21931L,21932L,21933L,21934L,21935L,
-     21936L,21937L,21938L,21939L,21940L,21941L,21942L,21942L,
-     21943L,21944L,21945L,21946L,21947L,21948L,21949L,21950L,
-     21951L,21952L,21953L,21954L,21955L,21956L,21957L,21958L,
-     21959L,21959L,21960L,21961L,21962L,21963L,21964L,21965L,
-     21966L,21967L,21968L,21969L,21970L,21971L,21972L,21973L,
-     21974L,21975L,21975L,21976L,21977L,21978L,21979L,21980L,
-     21981L,21982L,21983L,21984L,21985L,21986L,21987L,21988L,
-     21989L,21990L,21991L,21991L,21992L,21993L,21994L,21995L,
-     21996L,21997L,21998L,21999L,22000L,22001L,22002L,22003L,
-     22004L,22005L,22006L,22007L,22007L,22008L,22009L,22010L,
-     22011L,22012L,22013L,22014L,22015L,22016L,22017L,22018L,
-     22019L,22020L,22021L,22022L,22023L,22024L,22024L,22025L,
-     22026L,22027L,22028L,22029L,22030L,22031L,22032L,22033L,
-     22034L,22035L,22036L,22037L,22038L,22039L,22040L,22040L,
-     22041L,22042L,22043L,22044L,22045L,22046L,22047L,22048L,
-     22049L,22050L,22051L,22052L,22053L,22054L,22055L,22056L,
-     22056L,22057L,22058L,22059L,22060L,22061L,22062L,22063L,
-     22064L,22065L,22066L,22067L,22068L,22069L,22070L,22071L,
-     22072L,22072L,22073L,22074L,22075L,22076L,22077L,22078L,
-     22079L,22080L,22081L,22082L,22083L,22084L,22085L,22086L,
-     22087L,22088L,22088L,22089L,22090L,22091L,22092L,22093L,
-     22094L,22095L,22096L,22097L,22098L,22099L,22100L,22101L,
-     22102L,22103L,22104L,22104L,22105L,22106L,22107L,22108L,
-     22109L,22110L,22111L,22112L,22113L,22114L,22115L,22116L,
-     22117L,22118L,22119L,22120L,22120L,22121L,22122L,22123L,
-     22124L,22125L,22126L,22127L,22128L,22129L,22130L,22131L,
-     22132L,22133L,22134L,22135L,22136L,22136L,22137L,22138L,
-     22139L,22140L,22141L,22142L,22143L,22144L,22145L,22146L,
-     22147L,22148L,22149L,22150L,22151L,22152L,22152L,22153L,
-     22154L,22155L,22156L,22157L,22158L,22159L,22160L,22161L,
-     22162L,22163L,22164L,22165L,22166L,22167L,22168L,22168L,
-     22169L,22170L,22171L,22172L,22173L,22174L,22175L,22176L,
-     22177L,22178L,22179L,22180L,22181L,22182L,22183L,22184L,
-     22184L,22185L,22186L,22187L,22188L,22189L,22190L,22191L,
-     22192L,22193L,22194L,22195L,22196L,22197L,22198L,22199L,
-     22200L,22200L,22201L,22202L,22203L,22204L,22205L,22206L,
-     22207L,22208L,22209L,22210L,22211L,22212L,22213L,22214L,
-     22215L,22216L,22216L,22217L,22218L,22219L,22220L,22221L,
-     22222L,22223L,22224L,22225L,22226L,22227L,22228L,22229L,
-     22230L,22231L,22232L,22232L,22233L,22234L,22235L,22236L,
-     22237L,22238L,22239L,22240L,22241L,22242L,22243L,22244L,
-     22245L,22246L,22247L,22248L,22248L,22249L,22250L,22251L,
-     22252L,22253L,22254L,22255L,22256L,22257L,22258L,22259L,
-     22260L,22261L,22262L,22263L,22264L,22264L,22265L,22266L,
-     22267L,22268L,22269L,22270L,22271L,22272L,22273L,22274L,
-     22275L,22276L,22277L,22278L,22279L,22279L,22280L,22281L,
-     22282L,22283L,22284L,22285L,22286L,22287L,22288L,22289L,
-     22290L,22291L,22292L,22293L,22294L,22295L,22295L,22296L,
-     22297L,22298L,22299L,22300L,22301L,22302L,22303L,22304L,
-     22305L,22306L,22307L,22308L,22309L,22310L,22311L,22311L,
-     22312L,22313L,22314L,22315L,22316L,22317L,22318L,22319L,
-     22320L,22321L,22322L,22323L,22324L,22325L,22326L,22327L,
-     22327L,22328L,22329L,22330L,22331L,22332L,22333L,22334L,
-     22335L,22336L,22337L,22338L,22339L,22340L,22341L,22342L,
-     22342L,22343L,22344L,22345L,22346L,22347L,22348L,22349L,
-     22350L,22351L,22352L,22353L,22354L,22355L,22356L,22357L,
-     22358L,22358L,22359L,22360L,22361L,22362L,22363L,22364L,
-     22365L,22366L,22367L,22368L,22369L,22370L,22371L,22372L,
-     22373L,22374L,22374L,22375L,22376L,22377L,22378L,22379L,
-     22380L,22381L,22382L,22383L,22384L,22385L,22386L,22387L,
-     22388L,22389L,22389L,22390L,22391L,22392L,22393L,22394L,
-     22395L,22396L,22397L,22398L,22399L,22400L,22401L,22402L,
-     22403L,22404L,22405L,22405L,22406L,22407L,22408L,22409L,
-     22410L,22411L,22412L,22413L,22414L,22415L,22416L,22417L,
-     22418L,22419L,22420L,22421L,22421L,22422L,22423L,22424L,
-     22425L,22426L,22427L,22428L,22429L,22430L,22431L,22432L,
-     22433L,22434L,22435L,22436L,22436L,22437L,22438L,22439L,
-     22440L,22441L,22442L,22443L,22444L,22445L,22446L,22447L,
-     22448L,22449L,22450L,22451L,22452L,22452L,22453L,22454L,
-     22455L,22456L,22457L,22458L,22459L,22460L,22461L,22462L,
-     22463L,22464L,22465L,22466L,22467L,22467L,22468L,22469L,
-     22470L,22471L,22472L,22473L,22474L,22475L,22476L,22477L,
-     22478L,22479L,22480L,22481L,22482L,22483L,22483L,22484L,
-     22485L,22486L,22487L,22488L,22489L,22490L,22491L,22492L,
-     22493L,22494L,22495L,22496L,22497L,22498L,22498L,22499L,
-     22500L,22501L,22502L,22503L,22504L,22505L,22506L,22507L,
-     22508L,22509L,22510L,22511L,22512L,22513L,22514L,22514L,
-     22515L,22516L,22517L,22518L,22519L,22520L,22521L,22522L,
-     22523L,22524L,22525L,22526L,22527L,22528L,22529L,22529L,
-     22530L,22531L,22532L,22533L,22534L,22535L,22536L,22537L,
-     22538L,22539L,22540L,22541L,22542L,22543L,22544L,22544L,
-     22545L,22546L,22547L,22548L,22549L,22550L,22551L,22552L,
-     22553L,22554L,22555L,22556L,22557L,22558L,22559L,22560L,
-     22560L,22561L,22562L,22563L,22564L,22565L,22566L,22567L,
-     22568L,22569L,22570L,22571L,22572L,22573L,22574L,22575L,
-     22575L,22576L,22577L,22578L,22579L,22580L,22581L,22582L,
-     22583L,22584L,22585L,22586L,22587L,22588L,22589L,22590L,
-     22590L,22591L,22592L,22593L,22594L,22595L,22596L,22597L,
-     22598L,22599L,22600L,22601L,22602L,22603L,22604L,22605L,
-     22606L,22606L,22607L,22608L,22609L,22610L,22611L,22612L,
-     22613L,22614L,22615L,22616L,22617L,22618L,22619L,22620L,
-     22621L,22621L,22622L,22623L,22624L,22625L,22626L,22627L,
-     22628L,22629L,22630L,22631L,22632L,22633L,22634L,22635L,
-     22636L,22636L,22637L,22638L,22639L,22640L,22641L,22642L,
-     22643L,22644L,22645L,22646L,22647L,22648L,22649L,22650L,
-     22651L,22651L,22652L,22653L,22654L,22655L,22656L,22657L,
-     22658L,22659L,22660L,22661L,22662L,22663L,22664L,22665L,
-     22666L,22667L,22667L,22668L,22669L,22670L,22671L,22672L,
-     22673L,22674L,22675L,22676L,22677L,22678L,22679L,22680L,
-     22681L,22682L,22682L,22683L,22684L,22685L,22686L,22687L,
-     22688L,22689L,22690L,22691L,22692L,22693L,22694L,22695L,
-     22696L,22697L,22697L,22698L,22699L,22700L,22701L,22702L,
-     22703L,22704L,22705L,22706L,22707L,22708L,22709L,22710L,
-     22711L,22712L,22712L,22713L,22714L,22715L,22716L,22717L,
-     22718L,22719L,22720L,22721L,22722L,22723L,22724L,22725L,
-     22726L,22727L,22727L,22728L,22729L,22730L,22731L,22732L,
-     22733L,22734L,22735L,22736L,22737L,22738L,22739L,22740L,
-     22741L,22742L,22742L,22743L,22744L,22745L,22746L,22747L,
-     22748L,22749L,22750L,22751L,22752L,22753L,22754L,22755L,
-     22756L,22757L,22758L,22758L,22759L,22760L,22761L,22762L,
-     22763L,22764L,22765L,22766L,22767L,22768L,22769L,22770L,
-     22771L,22772L,22773L,22773L,22774L,22775L,22776L,22777L,
-     22778L,22779L,22780L,22781L,22782L,22783L,22784L,22785L,
-     22786L,22787L,22788L,22788L,22789L,22790L,22791L,22792L,
-     22793L,22794L,22795L,22796L,22797L,22798L,22799L,22800L,
-     22801L,22802L,22803L,22803L,22804L,22805L,22806L,22807L,
-     22808L,22809L,22810L,22811L,22812L,22813L,22814L,22815L,
-     22816L,22817L,22818L,22818L,22819L,22820L,22821L,22822L,
-     22823L,22824L,22825L,22826L,22827L,22828L,22829L,22830L,
-     22831L,22832L,22833L,22833L,22834L,22835L,22836L,22837L,
-     22838L,22839L,22840L,22841L,22842L,22843L,22844L,22845L,
-     22846L,22847L,22848L,22848L,22849L,22850L,22851L,22852L,
-     22853L,22854L,22855L,22856L,22857L,22858L,22859L,22860L,
-     22861L,22862L,22862L,22863L,22864L,22865L,22866L,22867L,
-     22868L,22869L,22870L,22871L,22872L,22873L,22874L,22875L,
-     22876L,22877L,22877L,22878L,22879L,22880L,22881L,22882L,
-     22883L,22884L,22885L,22886L,22887L,22888L,22889L,22890L,
-     22891L,22892L,22892L,22893L,22894L,22895L,22896L,22897L,
-     22898L,22899L,22900L,22901L,22902L,22903L,22904L,22905L,
-     22906L,22907L,22907L,22908L,22909L,22910L,22911L,22912L,
-     22913L,22914L,22915L,22916L,22917L,22918L,22919L,22920L,
-     22921L,22922L,22922L,22923L,22924L,22925L,22926L,22927L,
-     22928L,22929L,22930L,22931L,22932L,22933L,22934L,22935L,
-     22936L,22937L,22937L,22938L,22939L,22940L,22941L,22942L,
-     22943L,22944L,22945L,22946L,22947L,22948L,22949L,22950L,
-     22951L,22952L,22952L,22953L,22954L,22955L,22956L,22957L,
-     22958L,22959L,22960L,22961L,22962L,22963L,22964L,22965L,
-     22966L,22966L,22967L,22968L,22969L,22970L,22971L,22972L,
-     22973L,22974L,22975L,22976L,22977L,22978L,22979L,22980L,
-     22981L,22981L,22982L,22983L,22984L,22985L,22986L,22987L,
-     22988L,22989L,22990L,22991L,22992L,22993L,22994L,22995L,
-     22996L,22996L,22997L,22998L,22999L,23000L,23001L,23002L,
-     23003L,23004L,23005L,23006L,23007L,23008L,23009L,23010L,
-     23011L,23011L,23012L,23013L,23014L,23015L,23016L,23017L,
-     23018L,23019L,23020L,23021L,23022L,23023L,23024L,23025L,
-     23025L,23026L,23027L,23028L,23029L,23030L,23031L,23032L,
-     23033L,23034L,23035L,23036L,23037L,23038L,23039L,23040L,
-     23040L,23041L,23042L,23043L,23044L,23045L,23046L,23047L,
-     23048L,23049L,23050L,23051L,23052L,23053L,23054L,23055L,
-     23055L,23056L,23057L,23058L,23059L,23060L,23061L,23062L,
-     23063L,23064L,23065L,23066L,23067L,23068L,23069L,23069L,
-     23070L,23071L,23072L,23073L,23074L,23075L,23076L,23077L,
-     23078L,23079L,23080L,23081L,23082L,23083L,23084L,23084L,
-     23085L,23086L,23087L,23088L,23089L,23090L,23091L,23092L,
-     23093L,23094L,23095L,23096L,23097L,23098L,23098L,23099L,
-     23100L,23101L,23102L,23103L,23104L,23105L,23106L,23107L,
-     23108L,23109L,23110L,23111L,23112L,23113L,23113L,23114L,
-     23115L,23116L,23117L,23118L,23119L,23120L,23121L,23122L,
-     23123L,23124L,23125L,23126L,23127L,23128L,23128L,23129L,
-     23130L,23131L,23132L,23133L,23134L,23135L,23136L,23137L,
-     23138L,23139L,23140L,23141L,23142L,23142L,23143L,23144L,
-     23145L,23146L,23147L,23148L,23149L,23150L,23151L,23152L,
-     23153L,23154L,23155L,23156L,23157L,23157L,23158L,23159L,
-     23160L,23161L,23162L,23163L,23164L,23165L,23166L,23167L,
-     23168L,23169L,23170L,23171L,23171L,23172L,23173L,23174L,
-     23175L,23176L,23177L,23178L,23179L,23180L,23181L,23182L,
-     23183L,23184L,23185L,23186L,23186L,23187L,23188L,23189L,
-     23190L,23191L,23192L,23193L,23194L,23195L,23196L,23197L,
-     23198L,23199L,23200L,23200L,23201L,23202L,23203L,23204L,
-     23205L,23206L,23207L,23208L,23209L,23210L,23211L,23212L,
-     23213L,23214L,23215L,23215L,23216L,23217L,23218L,23219L,
-     23220L,23221L,23222L,23223L,23224L,23225L,23226L,23227L,
-     23228L,23229L,23229L,23230L,23231L,23232L,23233L,23234L,
-     23235L,23236L,23237L,23238L,23239L,23240L,23241L,23242L,
-     23243L,23243L,23244L,23245L,23246L,23247L,23248L,23249L,
-     23250L,23251L,23252L,23253L,23254L,23255L,23256L,23257L,
-     23258L,23258L,23259L,23260L,23261L,23262L,23263L,23264L,
-     23265L,23266L,23267L,23268L,23269L,23270L,23271L,23272L,
-     23272L,23273L,23274L,23275L,23276L,23277L,23278L,23279L,
-     23280L,23281L,23282L,23283L,23284L,23285L,23286L,23286L,
-     23287L,23288L,23289L,23290L,23291L,23292L,23293L,23294L,
-     23295L,23296L,23297L,23298L,23299L,23300L,23301L,23301L,
-     23302L,23303L,23304L,23305L,23306L,23307L,23308L,23309L,
-     23310L,23311L,23312L,23313L,23314L,23315L,23315L,23316L,
-     23317L,23318L,23319L,23320L,23321L,23322L,23323L,23324L,
-     23325L,23326L,23327L,23328L,23329L,23329L,23330L,23331L,
-     23332L,23333L,23334L,23335L,23336L,23337L,23338L,23339L,
-     23340L,23341L,23342L,23343L,23344L,23344L,23345L,23346L,
-     23347L,23348L,23349L,23350L,23351L,23352L,23353L,23354L,
-     23355L,23356L,23357L,23358L,23358L,23359L,23360L,23361L,
-     23362L,23363L,23364L,23365L,23366L,23367L,23368L,23369L,
-     23370L,23371L,23372L,23372L,23373L,23374L,23375L,23376L,
-     23377L,23378L,23379L,23380L,23381L,23382L,23383L,23384L,
-     23385L,23386L,23386L,23387L,23388L,23389L,23390L,23391L,
-     23392L,23393L,23394L,23395L,23396L,23397L,23398L,23399L,
-     23400L,23400L,23401L,23402L,23403L,23404L,23405L,23406L,
-     23407L,23408L,23409L,23410L,23411L,23412L,23413L,23414L,
-     23415L,23415L,23416L,23417L,23418L,23419L,23420L,23421L,
-     23422L,23423L,23424L,23425L,23426L,23427L,23428L,23429L,
-     23429L,23430L,23431L,23432L,23433L,23434L,23435L,23436L,
-     23437L,23438L,23439L,23440L,23441L,23442L,23443L,23443L,
-     23444L,23445L,23446L,23447L,23448L,23449L,23450L,23451L,
-     23452L,23453L,23454L,23455L,23456L,23457L,23457L,23458L,
-     23459L,23460L,23461L,23462L,23463L,23464L,23465L,23466L,
-     23467L,23468L,23469L,23470L,23471L,23471L,23472L,23473L,
-     23474L,23475L,23476L,23477L,23478L,23479L,23480L,23481L,
-     23482L,23483L,23484L,23485L,23485L,23486L,23487L,23488L,
-     23489L,23490L,23491L,23492L,23493L,23494L,23495L,23496L,
-     23497L,23498L,23499L,23499L,23500L,23501L,23502L,23503L,
-     23504L,23505L,23506L,23507L,23508L,23509L,23510L,23511L,
-     23512L,23513L,23513L,23514L,23515L,23516L,23517L,23518L,
-     23519L,23520L,23521L,23522L,23523L,23524L,23525L,23526L,
-     23527L,23527L,23528L,23529L,23530L,23531L,23532L,23533L,
-     23534L,23535L,23536L,23537L,23538L,23539L,23540L,23541L,
-     23541L,23542L,23543L,23544L,23545L,23546L,23547L,23548L,
-     23549L,23550L,23551L,23552L,23553L,23554L,23555L,23555L,
-     23556L,23557L,23558L,23559L,23560L,23561L,23562L,23563L,
-     23564L,23565L,23566L,23567L,23568L,23569L,23569L,23570L,
-     23571L,23572L,23573L,23574L,23575L,23576L,23577L,23578L,
-     23579L,23580L,23581L,23582L,23583L,23583L,23584L,23585L,
-     23586L,23587L,23588L,23589L,23590L,23591L,23592L,23593L,
-     23594L,23595L,23596L,23597L,23597L,23598L,23599L,23600L,
-     23601L,23602L,23603L,23604L,23605L,23606L,23607L,23608L,
-     23609L,23610L,23611L,23611L,23612L,23613L,23614L,23615L,
-     23616L,23617L,23618L,23619L,23620L,23621L,23622L,23623L,
-     23624L,23625L,23625L,23626L,23627L,23628L,23629L,23630L,
-     23631L,23632L,23633L,23634L,23635L,23636L,23637L,23638L,
-     23639L,23639L,23640L,23641L,23642L,23643L,23644L,23645L,
-     23646L,23647L,23648L,23649L,23650L,23651L,23652L,23652L,
-     23653L,23654L,23655L,23656L,23657L,23658L,23659L,23660L,
-     23661L,23662L,23663L,23664L,23665L,23666L,23666L,23667L,
-     23668L,23669L,23670L,23671L,23672L,23673L,23674L,23675L,
-     23676L,23677L,23678L,23679L,23680L,23680L,23681L,23682L,
-     23683L,23684L,23685L,23686L,23687L,23688L,23689L,23690L,
-     23691L,23692L,23693L,23694L,23694L,23695L,23696L,23697L,
-     23698L,23699L,23700L,23701L,23702L,23703L,23704L,23705L,
-     23706L,23707L,23708L,23708L,23709L,23710L,23711L,23712L,
-     23713L,23714L,23715L,23716L,23717L,23718L,23719L,23720L,
-     23721L,23721L,23722L,23723L,23724L,23725L,23726L,23727L,
-     23728L,23729L,23730L,23731L,23732L,23733L,23734L,23735L,
-     23735L,23736L,23737L,23738L,23739L,23740L,23741L,23742L,
-     23743L,23744L,23745L,23746L,23747L,23748L,23749L,23749L,
-     23750L,23751L,23752L,23753L,23754L,23755L,23756L,23757L,
-     23758L,23759L,23760L,23761L,23762L,23763L,23763L,23764L,
-     23765L,23766L,23767L,23768L,23769L,23770L,23771L,23772L,
-     23773L,23774L,23775L,23776L,23776L,23777L,23778L,23779L,
-     23780L,23781L,23782L,23783L,23784L,23785L,23786L,23787L,
-     23788L,23789L,23790L,23790L,23791L,23792L,23793L,23794L,
-     23795L,23796L,23797L,23798L,23799L,23800L,23801L,23802L,
-     23803L,23804L,23804L,23805L,23806L,23807L,23808L,23809L,
-     23810L,23811L,23812L,23813L,23814L,23815L,23816L,23817L,
-     23817L,23818L,23819L,23820L,23821L,23822L,23823L,23824L,
-     23825L,23826L,23827L,23828L,23829L,23830L,23831L,23831L,
-     23832L,23833L,23834L,23835L,23836L,23837L,23838L,23839L,
-     23840L,23841L,23842L,23843L,23844L,23844L,23845L,23846L,
-     23847L,23848L,23849L,23850L,23851L,23852L,23853L,23854L,
-     23855L,23856L,23857L,23858L,23858L,23859L,23860L,23861L,
-     23862L,23863L,23864L,23865L,23866L,23867L,23868L,23869L,
-     23870L,23871L,23872L,23872L,23873L,23874L,23875L,23876L,
-     23877L,23878L,23879L,23880L,23881L,23882L,23883L,23884L,
-     23885L,23885L,23886L,23887L,23888L,23889L,23890L,23891L,
-     23892L,23893L,23894L,23895L,23896L,23897L,23898L,23899L,
-     23899L,23900L,23901L,23902L,23903L,23904L,23905L,23906L,
-     23907L,23908L,23909L,23910L,23911L,23912L,23912L,23913L,
-     23914L,23915L,23916L,23917L,23918L,23919L,23920L,23921L,
-     23922L,23923L,23924L,23925L,23926L,23926L,23927L,23928L,
-     23929L,23930L,23931L,23932L,23933L,23934L,23935L,23936L,
-     23937L,23938L,23939L,23939L,23940L,23941L,23942L,23943L,
-     23944L,23945L,23946L,23947L,23948L,23949L,23950L,23951L,
-     23952L,23953L,23953L,23954L,23955L,23956L,23957L,23958L,
-     23959L,23960L,23961L,23962L,23963L,23964L,23965L,23966L,
-     23966L,23967L,23968L,23969L,23970L,23971L,23972L,23973L,
-     23974L,23975L,23976L,23977L,23978L,23979L,23979L,23980L,
-     23981L,23982L,23983L,23984L,23985L,23986L,23987L,23988L,
-     23989L,23990L,23991L,23992L,23993L,23993L,23994L,23995L,
-     23996L,23997L,23998L,23999L,24000L,24001L,24002L,24003L,
-     24004L,24005L,24006L,24006L,24007L,24008L,24009L,24010L,
-     24011L,24012L,24013L,24014L,24015L,24016L,24017L,24018L,
-     24019L,24020L,24020L,24021L,24022L,24023L,24024L,24025L,
-     24026L,24027L,24028L,24029L,24030L,24031L,24032L,24033L,
-     24033L,24034L,24035L,24036L,24037L,24038L,24039L,24040L,
-     24041L,24042L,24043L,24044L,24045L,24046L,24046L,24047L,
-     24048L,24049L,24050L,24051L,24052L,24053L,24054L,24055L,
-     24056L,24057L,24058L,24059L,24060L,24060L,24061L,24062L,
-     24063L,24064L,24065L,24066L,24067L,24068L,24069L,24070L,
-     24071L,24072L,24073L,24073L,24074L,24075L,24076L,24077L,
-     24078L,24079L,24080L,24081L,24082L,24083L,24084L,24085L,
-     24086L,24086L,24087L,24088L,24089L,24090L,24091L,24092L,
-     24093L,24094L,24095L,24096L,24097L,24098L,24099L,24100L,
-     24100L,24101L,24102L,24103L,24104L,24105L,24106L,24107L,
-     24108L,24109L,24110L,24111L,24112L,24113L,24113L,24114L,
-     24115L,24116L,24117L,24118L,24119L,24120L,24121L,24122L,
-     24123L,24124L,24125L,24126L,24126L,24127L,24128L,24129L,
-     24130L,24131L,24132L,24133L,24134L,24135L,24136L,24137L,
-     24138L,24139L,24139L,24140L,24141L,24142L,24143L,24144L,
-     24145L,24146L,24147L,24148L,24149L,24150L,24151L,24152L,
-     24153L,24153L,24154L,24155L,24156L,24157L,24158L,24159L,
-     24160L,24161L,24162L,24163L,24164L,24165L,24166L,24166L,
-     24167L,24168L,24169L,24170L,24171L,24172L,24173L,24174L,
-     24175L,24176L,24177L,24178L,24179L,24179L,24180L,24181L,
-     24182L,24183L,24184L,24185L,24186L,24187L,24188L,24189L,
-     24190L,24191L,24192L,24192L,24193L,24194L,24195L,24196L,
-     24197L,24198L,24199L,24200L,24201L,24202L,24203L,24204L,
-     24205L,24205L,24206L,24207L,24208L,24209L,24210L,24211L,
-     24212L,24213L,24214L,24215L,24216L,24217L,24218L,24218L,
-     24219L,24220L,24221L,24222L,24223L,24224L,24225L,24226L,
-     24227L,24228L,24229L,24230L,24231L,24232L,24232L,24233L,
-     24234L,24235L,24236L,24237L,24238L,24239L,24240L,24241L,
-     24242L,24243L,24244L,24245L,24245L,24246L,24247L,24248L,
-     24249L,24250L,24251L,24252L,24253L,24254L,24255L,24256L,
-     24257L,24258L,24258L,24259L,24260L,24261L,24262L,24263L,
-     24264L,24265L,24266L,24267L,24268L,24269L,24270L,24271L,
-     24271L,24272L,24273L,24274L,24275L,24276L,24277L,24278L,
-     24279L,24280L,24281L,24282L,24283L,24284L,24284L,24285L,
-     24286L,24287L,24288L,24289L,24290L,24291L,24292L,24293L,
-     24294L,24295L,24296L,24297L,24297L,24298L,24299L,24300L,
-     24301L,24302L,24303L,24304L,24305L,24306L,24307L,24308L,
-     24309L,24310L,24310L,24311L,24312L,24313L,24314L,24315L,
-     24316L,24317L,24318L,24319L,24320L,24321L,24322L,24323L,
-     24323L,24324L,24325L,24326L,24327L,24328L,24329L,24330L,
-     24331L,24332L,24333L,24334L,24335L,24336L,24336L,24337L,
-     24338L,24339L,24340L,24341L,24342L,24343L,24344L,24345L,
-     24346L,24347L,24348L,24349L,24349L,24350L,24351L,24352L,
-     24353L,24354L,24355L,24356L,24357L,24358L,24359L,24360L,
-     24361L,24362L,24362L,24363L,24364L,24365L,24366L,24367L,
-     24368L,24369L,24370L,24371L,24372L,24373L,24374L,24375L,
-     24375L,24376L,24377L,24378L,24379L,24380L,24381L,24382L,
-     24383L,24384L,24385L,24386L,24387L,24388L,24388L,24389L,
-     24390L,24391L,24392L,24393L,24394L,24395L,24396L,24397L,
-     24398L,24399L,24400L,24401L,24401L,24402L,24403L,24404L,
-     24405L,24406L,24407L,24408L,24409L,24410L,24411L,24412L,
-     24413L,24414L,24414L,24415L,24416L,24417L,24418L,24419L,
-     24420L,24421L,24422L,24423L,24424L,24425L,24426L,24426L,
-     24427L,24428L,24429L,24430L,24431L,24432L,24433L,24434L,
-     24435L,24436L,24437L,24438L,24439L,24439L,24440L,24441L,
-     24442L,24443L,24444L,24445L,24446L,24447L,24448L,24449L,
-     24450L,24451L,24452L,24452L,24453L,24454L,24455L,24456L,
-     24457L,24458L,24459L,24460L,24461L,24462L,24463L,24464L,
-     24465L,24465L,24466L,24467L,24468L,24469L,24470L,24471L,
-     24472L,24473L,24474L,24475L,24476L,24477L,24478L,24478L,
-     24479L,24480L,24481L,24482L,24483L,24484L,24485L,24486L,
-     24487L,24488L,24489L,24490L,24491L,24491L,24492L,24493L,
-     24494L,24495L,24496L,24497L,24498L,24499L,24500L,24501L,
-     24502L,24503L,24503L,24504L,24505L,24506L,24507L,24508L,
-     24509L,24510L,24511L,24512L,24513L,24514L,24515L,24516L,
-     24516L,24517L,24518L,24519L,24520L,24521L,24522L,24523L,
-     24524L,24525L,24526L,24527L,24528L,24529L,24529L,24530L,
-     24531L,24532L,24533L,24534L,24535L,24536L,24537L,24538L,
-     24539L,24540L,24541L,24542L,24542L,24543L,24544L,24545L,
-     24546L,24547L,24548L,24549L,24550L,24551L,24552L,24553L,
-     24554L,24554L,24555L,24556L,24557L,24558L,24559L,24560L,
-     24561L,24562L,24563L,24564L,24565L,24566L,24567L,24567L,
-     24568L,24569L,24570L,24571L,24572L,24573L,24574L,24575L,
-     24576L,24577L,24578L,24579L,24580L,24580L,24581L,24582L,
-     24583L,24584L,24585L,24586L,24587L,24588L,24589L,24590L,
-     24591L,24592L,24593L,24593L,24594L,24595L,24596L,24597L,
-     24598L,24599L,24600L,24601L,24602L,24603L,24604L,24605L,
-     24605L,24606L,24607L,24608L,24609L,24610L,24611L,24612L,
-     24613L,24614L,24615L,24616L,24617L,24618L,24618L,24619L,
-     24620L,24621L,24622L,24623L,24624L,24625L,24626L,24627L,
-     24628L,24629L,24630L,24631L,24631L,24632L,24633L,24634L,
-     24635L,24636L,24637L,24638L,24639L,24640L,24641L,24642L,
-     24643L,24643L,24644L,24645L,24646L,24647L,24648L,24649L,
-     24650L,24651L,24652L,24653L,24654L,24655L,24656L,24656L,
-     24657L,24658L,24659L,24660L,24661L,24662L,24663L,24664L,
-     24665L,24666L,24667L,24668L,24668L,24669L,24670L,24671L,
-     24672L,24673L,24674L,24675L,24676L,24677L,24678L,24679L,
-     24680L,24681L,24681L,24682L,24683L,24684L,24685L,24686L,
-     24687L,24688L,24689L,24690L,24691L,24692L,24693L,24694L,
-     24694L,24695L,24696L,24697L,24698L,24699L,24700L,24701L,
-     24702L,24703L,24704L,24705L,24706L,24706L,24707L,24708L,
-     24709L,24710L,24711L,24712L,24713L,24714L,24715L,24716L,
-     24717L,24718L,24719L,24719L,24720L,24721L,24722L,24723L,
-     24724L,24725L,24726L,24727L,24728L,24729L,24730L,24731L,
-     24731L,24732L,24733L,24734L,24735L,24736L,24737L,24738L,
-     24739L,24740L,24741L,24742L,24743L,24744L,24744L,24745L,
-     24746L,24747L,24748L,24749L,24750L,24751L,24752L,24753L,
-     24754L,24755L,24756L,24756L,24757L,24758L,24759L,24760L,
-     24761L,24762L,24763L,24764L,24765L,24766L,24767L,24768L,
-     24769L,24769L,24770L,24771L,24772L,24773L,24774L,24775L,
-     24776L,24777L,24778L,24779L,24780L,24781L,24781L,24782L,
-     24783L,24784L,24785L,24786L,24787L,24788L,24789L,24790L,
-     24791L,24792L,24793L,24794L,24794L,24795L,24796L,24797L,
-     24798L,24799L,24800L,24801L,24802L,24803L,24804L,24805L,
-     24806L,24806L,24807L,24808L,24809L,24810L,24811L,24812L,
-     24813L,24814L,24815L,24816L,24817L,24818L,24819L,24819L,
-     24820L,24821L,24822L,24823L,24824L,24825L,24826L,24827L,
-     24828L,24829L,24830L,24831L,24831L,24832L,24833L,24834L,
-     24835L,24836L,24837L,24838L,24839L,24840L,24841L,24842L,
-     24843L,24843L,24844L,24845L,24846L,24847L,24848L,24849L,
-     24850L,24851L,24852L,24853L,24854L,24855L,24856L,24856L,
-     24857L,24858L,24859L,24860L,24861L,24862L,24863L,24864L,
-     24865L,24866L,24867L,24868L,24868L,24869L,24870L,24871L,
-     24872L,24873L,24874L,24875L,24876L,24877L,24878L,24879L,
-     24880L,24881L,24881L,24882L,24883L,24884L,24885L,24886L,
-     24887L,24888L,24889L,24890L,24891L,24892L,24893L,24893L,
-     24894L,24895L,24896L,24897L,24898L,24899L,24900L,24901L,
-     24902L,24903L,24904L,24905L,24905L,24906L,24907L,24908L,
-     24909L,24910L,24911L,24912L,24913L,24914L,24915L,24916L,
-     24917L,24918L,24918L,24919L,24920L,24921L,24922L,24923L,
-     24924L,24925L,24926L,24927L,24928L,24929L,24930L,24930L,
-     24931L,24932L,24933L,24934L,24935L,24936L,24937L,24938L,
-     24939L,24940L,24941L,24942L,24942L,24943L,24944L,24945L,
-     24946L,24947L,24948L,24949L,24950L,24951L,24952L,24953L,
-     24954L,24954L,24955L,24956L,24957L,24958L,24959L,24960L,
-     24961L,24962L,24963L,24964L,24965L,24966L,24967L,24967L,
-     24968L,24969L,24970L,24971L,24972L,24973L,24974L,24975L,
-     24976L,24977L,24978L,24979L,24979L,24980L,24981L,24982L,
-     24983L,24984L,24985L,24986L,24987L,24988L,24989L,24990L,
-     24991L,24991L,24992L,24993L,24994L,24995L,24996L,24997L,
-     24998L,24999L,25000L,25001L,25002L,25003L,25003L,25004L,
-     25005L,25006L,25007L,25008L,25009L,25010L,25011L,25012L,
-     25013L,25014L,25015L,25016L,25016L,25017L,25018L,25019L,
-     25020L,25021L,25022L,25023L,25024L,25025L,25026L,25027L,
-     25028L,25028L,25029L,25030L,25031L,25032L,25033L,25034L,
-     25035L,25036L,25037L,25038L,25039L,25040L,25040L,25041L,
-     25042L,25043L,25044L,25045L,25046L,25047L,25048L,25049L,
-     25050L,25051L,25052L,25052L,25053L,25054L,25055L,25056L,
-     25057L,25058L,25059L,25060L,25061L,25062L,25063L,25064L,
-     25064L,25065L,25066L,25067L,25068L,25069L,25070L,25071L,
-     25072L,25073L,25074L,25075L,25076L,25077L,25077L,25078L,
-     25079L,25080L,25081L,25082L,25083L,25084L,25085L,25086L,
-     25087L,25088L,25089L,25089L,25090L,25091L,25092L,25093L,
-     25094L,25095L,25096L,25097L,25098L,25099L,25100L,25101L,
-     25101L,25102L,25103L,25104L,25105L,25106L,25107L,25108L,
-     25109L,25110L,25111L,25112L,25113L,25113L,25114L,25115L,
-     25116L,25117L,25118L,25119L,25120L,25121L,25122L,25123L,
-     25124L,25125L,25125L,25126L,25127L,25128L,25129L,25130L,
-     25131L,25132L,25133L,25134L,25135L,25136L,25137L,25137L,
-     25138L,25139L,25140L,25141L,25142L,25143L,25144L,25145L,
-     25146L,25147L,25148L,25149L,25149L,25150L,25151L,25152L,
-     25153L,25154L,25155L,25156L,25157L,25158L,25159L,25160L,
-     25161L,25161L,25162L,25163L,25164L,25165L,25166L,25167L,
-     25168L,25169L,25170L,25171L,25172L,25173L,25173L,25174L,
-     25175L,25176L,25177L,25178L,25179L,25180L,25181L,25182L,
-     25183L,25184L,25185L,25185L,25186L,25187L,25188L,25189L,
-     25190L,25191L,25192L,25193L,25194L,25195L,25196L,25197L,
-     25197L,25198L,25199L,25200L,25201L,25202L,25203L,25204L,
-     25205L,25206L,25207L,25208L,25209L,25209L,25210L,25211L,
-     25212L,25213L,25214L,25215L,25216L,25217L,25218L,25219L,
-     25220L,25221L,25221L,25222L,25223L,25224L,25225L,25226L,
-     25227L,25228L,25229L,25230L,25231L,25232L,25233L,25233L,
-     25234L,25235L,25236L,25237L,25238L,25239L,25240L,25241L,
-     25242L,25243L,25244L,25245L,25245L,25246L,25247L,25248L,
-     25249L,25250L,25251L,25252L,25253L,25254L,25255L,25256L,
-     25257L,25257L,25258L,25259L,25260L,25261L,25262L,25263L,
-     25264L,25265L,25266L,25267L,25268L,25269L,25269L,25270L,
-     25271L,25272L,25273L,25274L,25275L,25276L,25277L,25278L,
-     25279L,25280L,25281L,25281L,25282L,25283L,25284L,25285L,
-     25286L,25287L,25288L,25289L,25290L,25291L,25292L,25293L,
-     25293L,25294L,25295L,25296L,25297L,25298L,25299L,25300L,
-     25301L,25302L,25303L,25304L,25305L,25305L,25306L,25307L,
-     25308L,25309L,25310L,25311L,25312L,25313L,25314L,25315L,
-     25316L,25317L,25317L,25318L,25319L,25320L,25321L,25322L,
-     25323L,25324L,25325L,25326L,25327L,25328L,25329L,25329L,
-     25330L,25331L,25332L,25333L,25334L,25335L,25336L,25337L,
-     25338L,25339L,25340L,25340L,25341L,25342L,25343L,25344L,
-     25345L,25346L,25347L,25348L,25349L,25350L,25351L,25352L,
-     25352L,25353L,25354L,25355L,25356L,25357L,25358L,25359L,
-     25360L,25361L,25362L,25363L,25364L,25364L,25365L,25366L,
-     25367L,25368L,25369L,25370L,25371L,25372L,25373L,25374L,
-     25375L,25376L,25376L,25377L,25378L,25379L,25380L,25381L,
-     25382L,25383L,25384L,25385L,25386L,25387L,25388L,25388L,
-     25389L,25390L,25391L,25392L,25393L,25394L,25395L,25396L,
-     25397L,25398L,25399L,25400L,25400L,25401L,25402L,25403L,
-     25404L,25405L,25406L,25407L,25408L,25409L,25410L,25411L,
-     25411L,25412L,25413L,25414L,25415L,25416L,25417L,25418L,
-     25419L,25420L,25421L,25422L,25423L,25423L,25424L,25425L,
-     25426L,25427L,25428L,25429L,25430L,25431L,25432L,25433L,
-     25434L,25435L,25435L,25436L,25437L,25438L,25439L,25440L,
-     25441L,25442L,25443L,25444L,25445L,25446L,25447L,25447L,
-     25448L,25449L,25450L,25451L,25452L,25453L,25454L,25455L,
-     25456L,25457L,25458L,25458L,25459L,25460L,25461L,25462L,
-     25463L,25464L,25465L,25466L,25467L,25468L,25469L,25470L,
-     25470L,25471L,25472L,25473L,25474L,25475L,25476L,25477L,
-     25478L,25479L,25480L,25481L,25482L,25482L,25483L,25484L,
-     25485L,25486L,25487L,25488L,25489L,25490L,25491L,25492L,
-     25493L,25494L,25494L,25495L,25496L,25497L,25498L,25499L,
-     25500L,25501L,25502L,25503L,25504L,25505L,25505L,25506L,
-     25507L,25508L,25509L,25510L,25511L,25512L,25513L,25514L,
-     25515L,25516L,25517L,25517L,25518L,25519L,25520L,25521L,
-     25522L,25523L,25524L,25525L,25526L,25527L,25528L,25529L,
-     25529L,25530L,25531L,25532L,25533L,25534L,25535L,25536L,
-     25537L,25538L,25539L,25540L,25540L,25541L,25542L,25543L,
-     25544L,25545L,25546L,25547L,25548L,25549L,25550L,25551L,
-     25552L,25552L,25553L,25554L,25555L,25556L,25557L,25558L,
-     25559L,25560L,25561L,25562L,25563L,25564L,25564L,25565L,
-     25566L,25567L,25568L,25569L,25570L,25571L,25572L,25573L,
-     25574L,25575L,25575L,25576L,25577L,25578L,25579L,25580L,
-     25581L,25582L,25583L,25584L,25585L,25586L,25587L,25587L,
-     25588L,25589L,25590L,25591L,25592L,25593L,25594L,25595L,
-     25596L,25597L,25598L,25598L,25599L,25600L,25601L,25602L,
-     25603L,25604L,25605L,25606L,25607L,25608L,25609L,25610L,
-     25610L,25611L,25612L,25613L,25614L,25615L,25616L,25617L,
-     25618L,25619L,25620L,25621L,25621L,25622L,25623L,25624L,
-     25625L,25626L,25627L,25628L,25629L,25630L,25631L,25632L,
-     25633L,25633L,25634L,25635L,25636L,25637L,25638L,25639L,
-     25640L,25641L,25642L,25643L,25644L,25645L,25645L,25646L,
-     25647L,25648L,25649L,25650L,25651L,25652L,25653L,25654L,
-     25655L,25656L,25656L,25657L,25658L,25659L,25660L,25661L,
-     25662L,25663L,25664L,25665L,25666L,25667L,25668L,25668L,
-     25669L,25670L,25671L,25672L,25673L,25674L,25675L,25676L,
-     25677L,25678L,25679L,25679L,25680L,25681L,25682L,25683L,
-     25684L,25685L,25686L,25687L,25688L,25689L,25690L,25691L,
-     25691L,25692L,25693L,25694L,25695L,25696L,25697L,25698L,
-     25699L,25700L,25701L,25702L,25702L,25703L,25704L,25705L,
-     25706L,25707L,25708L,25709L,25710L,25711L,25712L,25713L,
-     25714L,25714L,25715L,25716L,25717L,25718L,25719L,25720L,
-     25721L,25722L,25723L,25724L,25725L,25725L,25726L,25727L,
-     25728L,25729L,25730L,25731L,25732L,25733L,25734L,25735L,
-     25736L,25737L,25737L,25738L,25739L,25740L,25741L,25742L,
-     25743L,25744L,25745L,25746L,25747L,25748L,25748L,25749L,
-     25750L,25751L,25752L,25753L,25754L,25755L,25756L,25757L,
-     25758L,25759L,25759L,25760L,25761L,25762L,25763L,25764L,
-     25765L,25766L,25767L,25768L,25769L,25770L,25771L,25771L,
-     25772L,25773L,25774L,25775L,25776L,25777L,25778L,25779L,
-     25780L,25781L,25782L,25782L,25783L,25784L,25785L,25786L,
-     25787L,25788L,25789L,25790L,25791L,25792L,25793L,25794L,
-     25794L,25795L,25796L,25797L,25798L,25799L,25800L,25801L,
-     25802L,25803L,25804L,25805L,25805L,25806L,25807L,25808L,
-     25809L,25810L,25811L,25812L,25813L,25814L,25815L,25816L,
-     25816L,25817L,25818L,25819L,25820L,25821L,25822L,25823L,
-     25824L,25825L,25826L,25827L,25828L,25828L,25829L,25830L,
-     25831L,25832L,25833L,25834L,25835L,25836L,25837L,25838L,
-     25839L,25839L,25840L,25841L,25842L,25843L,25844L,25845L,
-     25846L,25847L,25848L,25849L,25850L,25850L,25851L,25852L,
-     25853L,25854L,25855L,25856L,25857L,25858L,25859L,25860L,
-     25861L,25862L,25862L,25863L,25864L,25865L,25866L,25867L,
-     25868L,25869L,25870L,25871L,25872L,25873L,25873L,25874L,
-     25875L,25876L,25877L,25878L,25879L,25880L,25881L,25882L,
-     25883L,25884L,25884L,25885L,25886L,25887L,25888L,25889L,
-     25890L,25891L,25892L,25893L,25894L,25895L,25896L,25896L,
-     25897L,25898L,25899L,25900L,25901L,25902L,25903L,25904L,
-     25905L,25906L,25907L,25907L,25908L,25909L,25910L,25911L,
-     25912L,25913L,25914L,25915L,25916L,25917L,25918L,25918L,
-     25919L,25920L,25921L,25922L,25923L,25924L,25925L,25926L,
-     25927L,25928L,25929L,25930L,25930L,25931L,25932L,25933L,
-     25934L,25935L,25936L,25937L,25938L,25939L,25940L,25941L,
-     25941L,25942L,25943L,25944L,25945L,25946L,25947L,25948L,
-     25949L,25950L,25951L,25952L,25952L,25953L,25954L,25955L,
-     25956L,25957L,25958L,25959L,25960L,25961L,25962L,25963L,
-     25963L,25964L,25965L,25966L,25967L,25968L,25969L,25970L,
-     25971L,25972L,25973L,25974L,25974L,25975L,25976L,25977L,
-     25978L,25979L,25980L,25981L,25982L,25983L,25984L,25985L,
-     25986L,25986L,25987L,25988L,25989L,25990L,25991L,25992L,
-     25993L,25994L,25995L,25996L,25997L,25997L,25998L,25999L,
-     26000L,26001L,26002L,26003L,26004L,26005L,26006L,26007L,
-     26008L,26008L,26009L,26010L,26011L,26012L,26013L,26014L,
-     26015L,26016L,26017L,26018L,26019L,26019L,26020L,26021L,
-     26022L,26023L,26024L,26025L,26026L,26027L,26028L,26029L,
-     26030L,26030L,26031L,26032L,26033L,26034L,26035L,26036L,
-     26037L,26038L,26039L,26040L,26041L,26042L,26042L,26043L,
-     26044L,26045L,26046L,26047L,26048L,26049L,26050L,26051L,
-     26052L,26053L,26053L,26054L,26055L,26056L,26057L,26058L,
-     26059L,26060L,26061L,26062L,26063L,26064L,26064L,26065L,
-     26066L,26067L,26068L,26069L,26070L,26071L,26072L,26073L,
-     26074L,26075L,26075L,26076L,26077L,26078L,26079L,26080L,
-     26081L,26082L,26083L,26084L,26085L,26086L,26086L,26087L,
-     26088L,26089L,26090L,26091L,26092L,26093L,26094L,26095L,
-     26096L,26097L,26097L,26098L,26099L,26100L,26101L,26102L,
-     26103L,26104L,26105L,26106L,26107L,26108L,26108L,26109L,
-     26110L,26111L,26112L,26113L,26114L,26115L,26116L,26117L,
-     26118L,26119L,26119L,26120L,26121L,26122L,26123L,26124L,
-     26125L,26126L,26127L,26128L,26129L,26130L,26130L,26131L,
-     26132L,26133L,26134L,26135L,26136L,26137L,26138L,26139L,
-     26140L,26141L,26141L,26142L,26143L,26144L,26145L,26146L,
-     26147L,26148L,26149L,26150L,26151L,26152L,26152L,26153L,
-     26154L,26155L,26156L,26157L,26158L,26159L,26160L,26161L,
-     26162L,26163L,26163L,26164L,26165L,26166L,26167L,26168L,
-     26169L,26170L,26171L,26172L,26173L,26174L,26174L,26175L,
-     26176L,26177L,26178L,26179L,26180L,26181L,26182L,26183L,
-     26184L,26185L,26186L,26186L,26187L,26188L,26189L,26190L,
-     26191L,26192L,26193L,26194L,26195L,26196L,26197L,26197L,
-     26198L,26199L,26200L,26201L,26202L,26203L,26204L,26205L,
-     26206L,26207L,26208L,26208L,26209L,26210L,26211L,26212L,
-     26213L,26214L,26215L,26216L,26217L,26218L,26218L,26219L,
-     26220L,26221L,26222L,26223L,26224L,26225L,26226L,26227L,
-     26228L,26229L,26229L,26230L,26231L,26232L,26233L,26234L,
-     26235L,26236L,26237L,26238L,26239L,26240L,26240L,26241L,
-     26242L,26243L,26244L,26245L,26246L,26247L,26248L,26249L,
-     26250L,26251L,26251L,26252L,26253L,26254L,26255L,26256L,
-     26257L,26258L,26259L,26260L,26261L,26262L,26262L,26263L,
-     26264L,26265L,26266L,26267L,26268L,26269L,26270L,26271L,
-     26272L,26273L,26273L,26274L,26275L,26276L,26277L,26278L,
-     26279L,26280L,26281L,26282L,26283L,26284L,26284L,26285L,
-     26286L,26287L,26288L,26289L,26290L,26291L,26292L,26293L,
-     26294L,26295L,26295L,26296L,26297L,26298L,26299L,26300L,
-     26301L,26302L,26303L,26304L,26305L,26306L,26306L,26307L,
-     26308L,26309L,26310L,26311L,26312L,26313L,26314L,26315L,
-     26316L,26317L,26317L,26318L,26319L,26320L,26321L,26322L,
-     26323L,26324L,26325L,26326L,26327L,26328L,26328L,26329L,
-     26330L,26331L,26332L,26333L,26334L,26335L,26336L,26337L,
-     26338L,26339L,26339L,26340L,26341L,26342L,26343L,26344L,
-     26345L,26346L,26347L,26348L,26349L,26349L,26350L,26351L,
-     26352L,26353L,26354L,26355L,26356L,26357L,26358L,26359L,
-     26360L,26360L,26361L,26362L,26363L,26364L,26365L,26366L,
-     26367L,26368L,26369L,26370L,26371L,26371L,26372L,26373L,
-     26374L,26375L,26376L,26377L,26378L,26379L,26380L,26381L,
-     26382L,26382L,26383L,26384L,26385L,26386L,26387L,26388L,
-     26389L,26390L,26391L,26392L,26393L,26393L,26394L,26395L,
-     26396L,26397L,26398L,26399L,26400L,26401L,26402L,26403L,
-     26404L,26404L,26405L,26406L,26407L,26408L,26409L,26410L,
-     26411L,26412L,26413L,26414L,26414L,26415L,26416L,26417L,
-     26418L,26419L,26420L,26421L,26422L,26423L,26424L,26425L,
-     26425L,26426L,26427L,26428L,26429L,26430L,26431L,26432L,
-     26433L,26434L,26435L,26436L,26436L,26437L,26438L,26439L,
-     26440L,26441L,26442L,26443L,26444L,26445L,26446L,26447L,
-     26447L,26448L,26449L,26450L,26451L,26452L,26453L,26454L,
-     26455L,26456L,26457L,26457L,26458L,26459L,26460L,26461L,
-     26462L,26463L,26464L,26465L,26466L,26467L,26468L,26468L,
-     26469L,26470L,26471L,26472L,26473L,26474L,26475L,26476L,
-     26477L,26478L,26479L,26479L,26480L,26481L,26482L,26483L,
-     26484L,26485L,26486L,26487L,26488L,26489L,26490L,26490L,
-     26491L,26492L,26493L,26494L,26495L,26496L,26497L,26498L,
-     26499L,26500L,26500L,26501L,26502L,26503L,26504L,26505L,
-     26506L,26507L,26508L,26509L,26510L,26511L,26511L,26512L,
-     26513L,26514L,26515L,26516L,26517L,26518L,26519L,26520L,
-     26521L,26522L,26522L,26523L,26524L,26525L,26526L,26527L,
-     26528L,26529L,26530L,26531L,26532L,26532L,26533L,26534L,
-     26535L,26536L,26537L,26538L,26539L,26540L,26541L,26542L,
-     26543L,26543L,26544L,26545L,26546L,26547L,26548L,26549L,
-     26550L,26551L,26552L,26553L,26554L,26554L,26555L,26556L,
-     26557L,26558L,26559L,26560L,26561L,26562L,26563L,26564L,
-     26564L,26565L,26566L,26567L,26568L,26569L,26570L,26571L,
-     26572L,26573L,26574L,26575L,26575L,26576L,26577L,26578L,
-     26579L,26580L,26581L,26582L,26583L,26584L,26585L,26586L,
-     26586L,26587L,26588L,26589L,26590L,26591L,26592L,26593L,
-     26594L,26595L,26596L,26596L,26597L,26598L,26599L,26600L,
-     26601L,26602L,26603L,26604L,26605L,26606L,26607L,26607L,
-     26608L,26609L,26610L,26611L,26612L,26613L,26614L,26615L,
-     26616L,26617L,26618L,26618L,26619L,26620L,26621L,26622L,
-     26623L,26624L,26625L,26626L,26627L,26628L,26628L,26629L,
-     26630L,26631L,26632L,26633L,26634L,26635L,26636L,26637L,
-     26638L,26639L,26639L,26640L,26641L,26642L,26643L,26644L,
-     26645L,26646L,26647L,26648L,26649L,26649L,26650L,26651L,
-     26652L,26653L,26654L,26655L,26656L,26657L,26658L,26659L,
-     26660L,26660L,26661L,26662L,26663L,26664L,26665L,26666L,
-     26667L,26668L,26669L,26670L,26670L,26671L,26672L,26673L,
-     26674L,26675L,26676L,26677L,26678L,26679L,26680L,26681L,
-     26681L,26682L,26683L,26684L,26685L,26686L,26687L,26688L,
-     26689L,26690L,26691L,26692L,26692L,26693L,26694L,26695L,
-     26696L,26697L,26698L,26699L,26700L,26701L,26702L,26702L,
-     26703L,26704L,26705L,26706L,26707L,26708L,26709L,26710L,
-     26711L,26712L,26713L,26713L,26714L,26715L,26716L,26717L,
-     26718L,26719L,26720L,26721L,26722L,26723L,26723L,26724L,
-     26725L,26726L,26727L,26728L,26729L,26730L,26731L,26732L,
-     26733L,26734L,26734L,26735L,26736L,26737L,26738L,26739L,
-     26740L,26741L,26742L,26743L,26744L,26744L,26745L,26746L,
-     26747L,26748L,26749L,26750L,26751L,26752L,26753L,26754L,
-     26755L,26755L,26756L,26757L,26758L,26759L,26760L,26761L,
-     26762L,26763L,26764L,26765L,26765L,26766L,26767L,26768L,
-     26769L,26770L,26771L,26772L,26773L,26774L,26775L,26776L,
-     26776L,26777L,26778L,26779L,26780L,26781L,26782L,26783L,
-     26784L,26785L,26786L,26786L,26787L,26788L,26789L,26790L,
-     26791L,26792L,26793L,26794L,26795L,26796L,26796L,26797L,
-     26798L,26799L,26800L,26801L,26802L,26803L,26804L,26805L,
-     26806L,26807L,26807L,26808L,26809L,26810L,26811L,26812L,
-     26813L,26814L,26815L,26816L,26817L,26817L,26818L,26819L,
-     26820L,26821L,26822L,26823L,26824L,26825L,26826L,26827L,
-     26828L,26828L,26829L,26830L,26831L,26832L,26833L,26834L,
-     26835L,26836L,26837L,26838L,26838L,26839L,26840L,26841L,
-     26842L,26843L,26844L,26845L,26846L,26847L,26848L,26849L,
-     26849L,26850L,26851L,26852L,26853L,26854L,26855L,26856L,
-     26857L,26858L,26859L,26859L,26860L,26861L,26862L,26863L,
-     26864L,26865L,26866L,26867L,26868L,26869L,26869L,26870L,
-     26871L,26872L,26873L,26874L,26875L,26876L,26877L,26878L,
-     26879L,26880L,26880L,26881L,26882L,26883L,26884L,26885L,
-     26886L,26887L,26888L,26889L,26890L,26890L,26891L,26892L,
-     26893L,26894L,26895L,26896L,26897L,26898L,26899L,26900L,
-     26900L,26901L,26902L,26903L,26904L,26905L,26906L,26907L,
-     26908L,26909L,26910L,26911L,26911L,26912L,26913L,26914L,
-     26915L,26916L,26917L,26918L,26919L,26920L,26921L,26921L,
-     26922L,26923L,26924L,26925L,26926L,26927L,26928L,26929L,
-     26930L,26931L,26931L,26932L,26933L,26934L,26935L,26936L,
-     26937L,26938L,26939L,26940L,26941L,26942L,26942L,26943L,
-     26944L,26945L,26946L,26947L,26948L,26949L,26950L,26951L,
-     26952L,26952L,26953L,26954L,26955L,26956L,26957L,26958L,
-     26959L,26960L,26961L,26962L,26962L,26963L,26964L,26965L,
-     26966L,26967L,26968L,26969L,26970L,26971L,26972L,26973L,
-     26973L,26974L,26975L,26976L,26977L,26978L,26979L,26980L,
-     26981L,26982L,26983L,26983L,26984L,26985L,26986L,26987L,
-     26988L,26989L,26990L,26991L,26992L,26993L,26993L,26994L,
-     26995L,26996L,26997L,26998L,26999L,27000L,27001L,27002L,
-     27003L,27003L,27004L,27005L,27006L,27007L,27008L,27009L,
-     27010L,27011L,27012L,27013L,27014L,27014L,27015L,27016L,
-     27017L,27018L,27019L,27020L,27021L,27022L,27023L,27024L,
-     27024L,27025L,27026L,27027L,27028L,27029L,27030L,27031L,
-     27032L,27033L,27034L,27034L,27035L,27036L,27037L,27038L,
-     27039L,27040L,27041L,27042L,27043L,27044L,27044L,27045L,
-     27046L,27047L,27048L,27049L,27050L,27051L,27052L,27053L,
-     27054L,27055L,27055L,27056L,27057L,27058L,27059L,27060L,
-     27061L,27062L,27063L,27064L,27065L,27065L,27066L,27067L,
-     27068L,27069L,27070L,27071L,27072L,27073L,27074L,27075L,
-     27075L,27076L,27077L,27078L,27079L,27080L,27081L,27082L,
-     27083L,27084L,27085L,27085L,27086L,27087L,27088L,27089L,
-     27090L,27091L,27092L,27093L,27094L,27095L,27095L,27096L,
-     27097L,27098L,27099L,27100L,27101L,27102L,27103L,27104L,
-     27105L,27106L,27106L,27107L,27108L,27109L,27110L,27111L,
-     27112L,27113L,27114L,27115L,27116L,27116L,27117L,27118L,
-     27119L,27120L,27121L,27122L,27123L,27124L,27125L,27126L,
-     27126L,27127L,27128L,27129L,27130L,27131L,27132L,27133L,
-     27134L,27135L,27136L,27136L,27137L,27138L,27139L,27140L,
-     27141L,27142L,27143L,27144L,27145L,27146L,27146L,27147L,
-     27148L,27149L,27150L,27151L,27152L,27153L,27154L,27155L,
-     27156L,27156L,27157L,27158L,27159L,27160L,27161L,27162L,
-     27163L,27164L,27165L,27166L,27166L,27167L,27168L,27169L,
-     27170L,27171L,27172L,27173L,27174L,27175L,27176L,27176L,
-     27177L,27178L,27179L,27180L,27181L,27182L,27183L,27184L,
-     27185L,27186L,27187L,27187L,27188L,27189L,27190L,27191L,
-     27192L,27193L,27194L,27195L,27196L,27197L,27197L,27198L,
-     27199L,27200L,27201L,27202L,27203L,27204L,27205L,27206L,
-     27207L,27207L,27208L,27209L,27210L,27211L,27212L,27213L,
-     27214L,27215L,27216L,27217L,27217L,27218L,27219L,27220L,
-     27221L,27222L,27223L,27224L,27225L,27226L,27227L,27227L,
-     27228L,27229L,27230L,27231L,27232L,27233L,27234L,27235L,
-     27236L,27237L,27237L,27238L,27239L,27240L,27241L,27242L,
-     27243L,27244L,27245L,27246L,27247L,27247L,27248L,27249L,
-     27250L,27251L,27252L,27253L,27254L,27255L,27256L,27257L,
-     27257L,27258L,27259L,27260L,27261L,27262L,27263L,27264L,
-     27265L,27266L,27267L,27267L,27268L,27269L,27270L,27271L,
-     27272L,27273L,27274L,27275L,27276L,27277L,27277L,27278L,
-     27279L,27280L,27281L,27282L,27283L,27284L,27285L,27286L,
-     27287L,27287L,27288L,27289L,27290L,27291L,27292L,27293L,
-     27294L,27295L,27296L,27297L,27297L,27298L,27299L,27300L,
-     27301L,27302L,27303L,27304L,27305L,27306L,27307L,27307L,
-     27308L,27309L,27310L,27311L,27312L,27313L,27314L,27315L,
-     27316L,27317L,27317L,27318L,27319L,27320L,27321L,27322L,
-     27323L,27324L,27325L,27326L,27327L,27327L,27328L,27329L,
-     27330L,27331L,27332L,27333L,27334L,27335L,27336L,27337L,
-     27337L,27338L,27339L,27340L,27341L,27342L,27343L,27344L,
-     27345L,27346L,27347L,27347L,27348L,27349L,27350L,27351L,
-     27352L,27353L,27354L,27355L,27356L,27357L,27357L,27358L,
-     27359L,27360L,27361L,27362L,27363L,27364L,27365L,27366L,
-     27367L,27367L,27368L,27369L,27370L,27371L,27372L,27373L,
-     27374L,27375L,27376L,27377L,27377L,27378L,27379L,27380L,
-     27381L,27382L,27383L,27384L,27385L,27386L,27387L,27387L,
-     27388L,27389L,27390L,27391L,27392L,27393L,27394L,27395L,
-     27396L,27397L,27397L,27398L,27399L,27400L,27401L,27402L,
-     27403L,27404L,27405L,27406L,27407L,27407L,27408L,27409L,
-     27410L,27411L,27412L,27413L,27414L,27415L,27416L,27417L,
-     27417L,27418L,27419L,27420L,27421L,27422L,27423L,27424L,
-     27425L,27426L,27426L,27427L,27428L,27429L,27430L,27431L,
-     27432L,27433L,27434L,27435L,27436L,27436L,27437L,27438L,
-     27439L,27440L,27441L,27442L,27443L,27444L,27445L,27446L,
-     27446L,27447L,27448L,27449L,27450L,27451L,27452L,27453L,
-     27454L,27455L,27456L,27456L,27457L,27458L,27459L,27460L,
-     27461L,27462L,27463L,27464L,27465L,27466L,27466L,27467L,
-     27468L,27469L,27470L,27471L,27472L,27473L,27474L,27475L,
-     27476L,27476L,27477L,27478L,27479L,27480L,27481L,27482L,
-     27483L,27484L,27485L,27486L,27486L,27487L,27488L,27489L,
-     27490L,27491L,27492L,27493L,27494L,27495L,27496L,27496L,
-     27497L,27498L,27499L,27500L,27501L,27502L,27503L,27504L,
-     27505L,27505L,27506L,27507L,27508L,27509L,27510L,27511L,
-     27512L,27513L,27514L,27515L,27515L,27516L,27517L,27518L,
-     27519L,27520L,27521L,27522L,27523L,27524L,27525L,27525L,
-     27526L,27527L,27528L,27529L,27530L,27531L,27532L,27533L,
-     27534L,27535L,27535L,27536L,27537L,27538L,27539L,27540L,
-     27541L,27542L,27543L,27544L,27545L,27545L,27546L,27547L,
-     27548L,27549L,27550L,27551L,27552L,27553L,27554L,27554L,
-     27555L,27556L,27557L,27558L,27559L,27560L,27561L,27562L,
-     27563L,27564L,27564L,27565L,27566L,27567L,27568L,27569L,
-     27570L,27571L,27572L,27573L,27574L,27574L,27575L,27576L,
-     27577L,27578L,27579L,27580L,27581L,27582L,27583L,27584L,
-     27584L,27585L,27586L,27587L,27588L,27589L,27590L,27591L,
-     27592L,27593L,27594L,27594L,27595L,27596L,27597L,27598L,
-     27599L,27600L,27601L,27602L,27603L,27603L,27604L,27605L,
-     27606L,27607L,27608L,27609L,27610L,27611L,27612L,27613L,
-     27613L,27614L,27615L,27616L,27617L,27618L,27619L,27620L,
-     27621L,27622L,27623L,27623L,27624L,27625L,27626L,27627L,
-     27628L,27629L,27630L,27631L,27632L,27633L,27633L,27634L,
-     27635L,27636L,27637L,27638L,27639L,27640L,27641L,27642L,
-     27642L,27643L,27644L,27645L,27646L,27647L,27648L,27649L,
-     27650L,27651L,27652L,27652L,27653L,27654L,27655L,27656L,
-     27657L,27658L,27659L,27660L,27661L,27662L,27662L,27663L,
-     27664L,27665L,27666L,27667L,27668L,27669L,27670L,27671L,
-     27671L,27672L,27673L,27674L,27675L,27676L,27677L,27678L,
-     27679L,27680L,27681L,27681L,27682L,27683L,27684L,27685L,
-     27686L,27687L,27688L,27689L,27690L,27691L,27691L,27692L,
-     27693L,27694L,27695L,27696L,27697L,27698L,27699L,27700L,
-     27700L,27701L,27702L,27703L,27704L,27705L,27706L,27707L,
-     27708L,27709L,27710L,27710L,27711L,27712L,27713L,27714L,
-     27715L,27716L,27717L,27718L,27719L,27720L,27720L,27721L,
-     27722L,27723L,27724L,27725L,27726L,27727L,27728L,27729L,
-     27729L,27730L,27731L,27732L,27733L,27734L,27735L,27736L,
-     27737L,27738L,27739L,27739L,27740L,27741L,27742L,27743L,
-     27744L,27745L,27746L,27747L,27748L,27749L,27749L,27750L,
-     27751L,27752L,27753L,27754L,27755L,27756L,27757L,27758L,
-     27758L,27759L,27760L,27761L,27762L,27763L,27764L,27765L,
-     27766L,27767L,27768L,27768L,27769L,27770L,27771L,27772L,
-     27773L,27774L,27775L,27776L,27777L,27778L,27778L,27779L,
-     27780L,27781L,27782L,27783L,27784L,27785L,27786L,27787L,
-     27787L,27788L,27789L,27790L,27791L,27792L,27793L,27794L,
-     27795L,27796L,27797L,27797L,27798L,27799L,27800L,27801L,
-     27802L,27803L,27804L,27805L,27806L,27806L,27807L,27808L,
-     27809L,27810L,27811L,27812L,27813L,27814L,27815L,27816L,
-     27816L,27817L,27818L,27819L,27820L,27821L,27822L,27823L,
-     27824L,27825L,27825L,27826L,27827L,27828L,27829L,27830L,
-     27831L,27832L,27833L,27834L,27835L,27835L,27836L,27837L,
-     27838L,27839L,27840L,27841L,27842L,27843L,27844L,27845L,
-     27845L,27846L,27847L,27848L,27849L,27850L,27851L,27852L,
-     27853L,27854L,27854L,27855L,27856L,27857L,27858L,27859L,
-     27860L,27861L,27862L,27863L,27864L,27864L,27865L,27866L,
-     27867L,27868L,27869L,27870L,27871L,27872L,27873L,27873L,
-     27874L,27875L,27876L,27877L,27878L,27879L,27880L,27881L,
-     27882L,27883L,27883L,27884L,27885L,27886L,27887L,27888L,
-     27889L,27890L,27891L,27892L,27892L,27893L,27894L,27895L,
-     27896L,27897L,27898L,27899L,27900L,27901L,27902L,27902L,
-     27903L,27904L,27905L,27906L,27907L,27908L,27909L,27910L,
-     27911L,27911L,27912L,27913L,27914L,27915L,27916L,27917L,
-     27918L,27919L,27920L,27921L,27921L,27922L,27923L,27924L,
-     27925L,27926L,27927L,27928L,27929L,27930L,27930L,27931L,
-     27932L,27933L,27934L,27935L,27936L,27937L,27938L,27939L,
-     27940L,27940L,27941L,27942L,27943L,27944L,27945L,27946L,
-     27947L,27948L,27949L,27949L,27950L,27951L,27952L,27953L,
-     27954L,27955L,27956L,27957L,27958L,27959L,27959L,27960L,
-     27961L,27962L,27963L,27964L,27965L,27966L,27967L,27968L,
-     27968L,27969L,27970L,27971L,27972L,27973L,27974L,27975L,
-     27976L,27977L,27978L,27978L,27979L,27980L,27981L,27982L,
-     27983L,27984L,27985L,27986L,27987L,27987L,27988L,27989L,
-     27990L,27991L,27992L,27993L,27994L,27995L,27996L,27996L,
-     27997L,27998L,27999L,28000L,28001L,28002L,28003L,28004L,
-     28005L,28006L,28006L,28007L,28008L,28009L,28010L,28011L,
-     28012L,28013L,28014L,28015L,28015L,28016L,28017L,28018L,
-     28019L,28020L,28021L,28022L,28023L,28024L,28025L,28025L,
-     28026L,28027L,28028L,28029L,28030L,28031L,28032L,28033L,
-     28034L,28034L,28035L,28036L,28037L,28038L,28039L,28040L,
-     28041L,28042L,28043L,28044L,28044L,28045L,28046L,28047L,
-     28048L,28049L,28050L,28051L,28052L,28053L,28053L,28054L,
-     28055L,28056L,28057L,28058L,28059L,28060L,28061L,28062L,
-     28062L,28063L,28064L,28065L,28066L,28067L,28068L,28069L,
-     28070L,28071L,28072L,28072L,28073L,28074L,28075L,28076L,
-     28077L,28078L,28079L,28080L,28081L,28081L,28082L,28083L,
-     28084L,28085L,28086L,28087L,28088L,28089L,28090L,28090L,
-     28091L,28092L,28093L,28094L,28095L,28096L,28097L,28098L,
-     28099L,28100L,28100L,28101L,28102L,28103L,28104L,28105L,
-     28106L,28107L,28108L,28109L,28109L,28110L,28111L,28112L,
-     28113L,28114L,28115L,28116L,28117L,28118L,28119L,28119L,
-     28120L,28121L,28122L,28123L,28124L,28125L,28126L,28127L,
-     28128L,28128L,28129L,28130L,28131L,28132L,28133L,28134L,
-     28135L,28136L,28137L,28137L,28138L,28139L,28140L,28141L,
-     28142L,28143L,28144L,28145L,28146L,28146L,28147L,28148L,
-     28149L,28150L,28151L,28152L,28153L,28154L,28155L,28156L,
-     28156L,28157L,28158L,28159L,28160L,28161L,28162L,28163L,
-     28164L,28165L,28165L,28166L,28167L,28168L,28169L,28170L,
-     28171L,28172L,28173L,28174L,28174L,28175L,28176L,28177L,
-     28178L,28179L,28180L,28181L,28182L,28183L,28184L,28184L,
-     28185L,28186L,28187L,28188L,28189L,28190L,28191L,28192L,
-     28193L,28193L,28194L,28195L,28196L,28197L,28198L,28199L,
-     28200L,28201L,28202L,28202L,28203L,28204L,28205L,28206L,
-     28207L,28208L,28209L,28210L,28211L,28212L,28212L,28213L,
-     28214L,28215L,28216L,28217L,28218L,28219L,28220L,28221L,
-     28221L,28222L,28223L,28224L,28225L,28226L,28227L,28228L,
-     28229L,28230L,28230L,28231L,28232L,28233L,28234L,28235L,
-     28236L,28237L,28238L,28239L,28239L,28240L,28241L,28242L,
-     28243L,28244L,28245L,28246L,28247L,28248L,28249L,28249L,
-     28250L,28251L,28252L,28253L,28254L,28255L,28256L,28257L,
-     28258L,28258L,28259L,28260L,28261L,28262L,28263L,28264L,
-     28265L,28266L,28267L,28267L,28268L,28269L,28270L,28271L,
-     28272L,28273L,28274L,28275L,28276L,28276L,28277L,28278L,
-     28279L,28280L,28281L,28282L,28283L,28284L,28285L,28285L,
-     28286L,28287L,28288L,28289L,28290L,28291L,28292L,28293L,
-     28294L,28295L,28295L,28296L,28297L,28298L,28299L,28300L,
-     28301L,28302L,28303L,28304L,28304L,28305L,28306L,28307L,
-     28308L,28309L,28310L,28311L,28312L,28313L,28313L,28314L,
-     28315L,28316L,28317L,28318L,28319L,28320L,28321L,28322L,
-     28322L,28323L,28324L,28325L,28326L,28327L,28328L,28329L,
-     28330L,28331L,28331L,28332L,28333L,28334L,28335L,28336L,
-     28337L,28338L,28339L,28340L,28341L,28341L,28342L,28343L,
-     28344L,28345L,28346L,28347L,28348L,28349L,28350L,28350L,
-     28351L,28352L,28353L,28354L,28355L,28356L,28357L,28358L,
-     28359L,28359L,28360L,28361L,28362L,28363L,28364L,28365L,
-     28366L,28367L,28368L,28368L,28369L,28370L,28371L,28372L,
-     28373L,28374L,28375L,28376L,28377L,28377L,28378L,28379L,
-     28380L,28381L,28382L,28383L,28384L,28385L,28386L,28386L,
-     28387L,28388L,28389L,28390L,28391L,28392L,28393L,28394L,
-     28395L,28395L,28396L,28397L,28398L,28399L,28400L,28401L,
-     28402L,28403L,28404L,28405L,28405L,28406L,28407L,28408L,
-     28409L,28410L,28411L,28412L,28413L,28414L,28414L,28415L,
-     28416L,28417L,28418L,28419L,28420L,28421L,28422L,28423L,
-     28423L,28424L,28425L,28426L,28427L,28428L,28429L,28430L,
-     28431L,28432L,28432L,28433L,28434L,28435L,28436L,28437L,
-     28438L,28439L,28440L,28441L,28441L,28442L,28443L,28444L,
-     28445L,28446L,28447L,28448L,28449L,28450L,28450L,28451L,
-     28452L,28453L,28454L,28455L,28456L,28457L,28458L,28459L,
-     28459L,28460L,28461L,28462L,28463L,28464L,28465L,28466L,
-     28467L,28468L,28468L,28469L,28470L,28471L,28472L,28473L,
-     28474L,28475L,28476L,28477L,28477L,28478L,28479L,28480L,
-     28481L,28482L,28483L,28484L,28485L,28486L,28486L,28487L,
-     28488L,28489L,28490L,28491L,28492L,28493L,28494L,28495L,
-     28495L,28496L,28497L,28498L,28499L,28500L,28501L,28502L,
-     28503L,28504L,28505L,28505L,28506L,28507L,28508L,28509L,
-     28510L,28511L,28512L,28513L,28514L,28514L,28515L,28516L,
-     28517L,28518L,28519L,28520L,28521L,28522L,28523L,28523L,
-     28524L,28525L,28526L,28527L,28528L,28529L,28530L,28531L,
-     28532L,28532L,28533L,28534L,28535L,28536L,28537L,28538L,
-     28539L,28540L,28541L,28541L,28542L,28543L,28544L,28545L,
-     28546L,28547L,28548L,28549L,28550L,28550L,28551L,28552L,
-     28553L,28554L,28555L,28556L,28557L,28558L,28559L,28559L,
-     28560L,28561L,28562L,28563L,28564L,28565L,28566L,28567L,
-     28568L,28568L,28569L,28570L,28571L,28572L,28573L,28574L,
-     28575L,28576L,28577L,28577L,28578L,28579L,28580L,28581L,
-     28582L,28583L,28584L,28585L,28586L,28586L,28587L,28588L,
-     28589L,28590L,28591L,28592L,28593L,28594L,28595L,28595L,
-     28596L,28597L,28598L,28599L,28600L,28601L,28602L,28603L,
-     28604L,28604L,28605L,28606L,28607L,28608L,28609L,28610L,
-     28611L,28612L,28613L,28613L,28614L,28615L,28616L,28617L,
-     28618L,28619L,28620L,28621L,28622L,28622L,28623L,28624L,
-     28625L,28626L,28627L,28628L,28629L,28630L,28631L,28631L,
-     28632L,28633L,28634L,28635L,28636L,28637L,28638L,28639L,
-     28639L,28640L,28641L,28642L,28643L,28644L,28645L,28646L,
-     28647L,28648L,28648L,28649L,28650L,28651L,28652L,28653L,
-     28654L,28655L,28656L,28657L,28657L,28658L,28659L,28660L,
-     28661L,28662L,28663L,28664L,28665L,28666L,28666L,28667L,
-     28668L,28669L,28670L,28671L,28672L,28673L,28674L,28675L,
-     28675L,28676L,28677L,28678L,28679L,28680L,28681L,28682L,
-     28683L,28684L,28684L,28685L,28686L,28687L,28688L,28689L,
-     28690L,28691L,28692L,28693L,28693L,28694L,28695L,28696L,
-     28697L,28698L,28699L,28700L,28701L,28702L,28702L,28703L,
-     28704L,28705L,28706L,28707L,28708L,28709L,28710L,28711L,
-     28711L,28712L,28713L,28714L,28715L,28716L,28717L,28718L,
-     28719L,28720L,28720L,28721L,28722L,28723L,28724L,28725L,
-     28726L,28727L,28728L,28729L,28729L,28730L,28731L,28732L,
-     28733L,28734L,28735L,28736L,28737L,28737L,28738L,28739L,
-     28740L,28741L,28742L,28743L,28744L,28745L,28746L,28746L,
-     28747L,28748L,28749L,28750L,28751L,28752L,28753L,28754L,
-     28755L,28755L,28756L,28757L,28758L,28759L,28760L,28761L,
-     28762L,28763L,28764L,28764L,28765L,28766L,28767L,28768L,
-     28769L,28770L,28771L,28772L,28773L,28773L,28774L,28775L,
-     28776L,28777L,28778L,28779L,28780L,28781L,28782L,28782L,
-     28783L,28784L,28785L,28786L,28787L,28788L,28789L,28790L,
-     28791L,28791L,28792L,28793L,28794L,28795L,28796L,28797L,
-     28798L,28799L,28799L,28800L,28801L,28802L,28803L,28804L,
-     28805L,28806L,28807L,28808L,28808L,28809L,28810L,28811L,
-     28812L,28813L,28814L,28815L,28816L,28817L,28817L,28818L,
-     28819L,28820L,28821L,28822L,28823L,28824L,28825L,28826L,
-     28826L,28827L,28828L,28829L,28830L,28831L,28832L,28833L,
-     28834L,28835L,28835L,28836L,28837L,28838L,28839L,28840L,
-     28841L,28842L,28843L,28844L,28844L,28845L,28846L,28847L,
-     28848L,28849L,28850L,28851L,28852L,28852L,28853L,28854L,
-     28855L,28856L,28857L,28858L,28859L,28860L,28861L,28861L,
-     28862L,28863L,28864L,28865L,28866L,28867L,28868L,28869L,
-     28870L,28870L,28871L,28872L,28873L,28874L,28875L,28876L,
-     28877L,28878L,28879L,28879L,28880L,28881L,28882L,28883L,
-     28884L,28885L,28886L,28887L,28887L,28888L,28889L,28890L,
-     28891L,28892L,28893L,28894L,28895L,28896L,28896L,28897L,
-     28898L,28899L,28900L,28901L,28902L,28903L,28904L,28905L,
-     28905L,28906L,28907L,28908L,28909L,28910L,28911L,28912L,
-     28913L,28914L,28914L,28915L,28916L,28917L,28918L,28919L,
-     28920L,28921L,28922L,28922L,28923L,28924L,28925L,28926L,
-     28927L,28928L,28929L,28930L,28931L,28931L,28932L,28933L,
-     28934L,28935L,28936L,28937L,28938L,28939L,28940L,28940L,
-     28941L,28942L,28943L,28944L,28945L,28946L,28947L,28948L,
-     28949L,28949L,28950L,28951L,28952L,28953L,28954L,28955L,
-     28956L,28957L,28957L,28958L,28959L,28960L,28961L,28962L,
-     28963L,28964L,28965L,28966L,28966L,28967L,28968L,28969L,
-     28970L,28971L,28972L,28973L,28974L,28975L,28975L,28976L,
-     28977L,28978L,28979L,28980L,28981L,28982L,28983L,28984L,
-     28984L,28985L,28986L,28987L,28988L,28989L,28990L,28991L,
-     28992L,28992L,28993L,28994L,28995L,28996L,28997L,28998L,
-     28999L,29000L,29001L,29001L,29002L,29003L,29004L,29005L,
-     29006L,29007L,29008L,29009L,29010L,29010L,29011L,29012L,
-     29013L,29014L,29015L,29016L,29017L,29018L,29018L,29019L,
-     29020L,29021L,29022L,29023L,29024L,29025L,29026L,29027L,
-     29027L,29028L,29029L,29030L,29031L,29032L,29033L,29034L,
-     29035L,29036L,29036L,29037L,29038L,29039L,29040L,29041L,
-     29042L,29043L,29044L,29044L,29045L,29046L,29047L,29048L,
-     29049L,29050L,29051L,29052L,29053L,29053L,29054L,29055L,
-     29056L,29057L,29058L,29059L,29060L,29061L,29062L,29062L,
-     29063L,29064L,29065L,29066L,29067L,29068L,29069L,29070L,
-     29070L,29071L,29072L,29073L,29074L,29075L,29076L,29077L,
-     29078L,29079L,29079L,29080L,29081L,29082L,29083L,29084L,
-     29085L,29086L,29087L,29087L,29088L,29089L,29090L,29091L,
-     29092L,29093L,29094L,29095L,29096L,29096L,29097L,29098L,
-     29099L,29100L,29101L,29102L,29103L,29104L,29105L,29105L,
-     29106L,29107L,29108L,29109L,29110L,29111L,29112L,29113L,
-     29113L,29114L,29115L,29116L,29117L,29118L,29119L,29120L,
-     29121L,29122L,29122L,29123L,29124L,29125L,29126L,29127L,
-     29128L,29129L,29130L,29130L,29131L,29132L,29133L,29134L,
-     29135L,29136L,29137L,29138L,29139L,29139L,29140L,29141L,
-     29142L,29143L,29144L,29145L,29146L,29147L,29148L,29148L,
-     29149L,29150L,29151L,29152L,29153L,29154L,29155L,29156L,
-     29156L,29157L,29158L,29159L,29160L,29161L,29162L,29163L,
-     29164L,29165L,29165L,29166L,29167L,29168L,29169L,29170L,
-     29171L,29172L,29173L,29173L,29174L,29175L,29176L,29177L,
-     29178L,29179L,29180L,29181L,29182L,29182L,29183L,29184L,
-     29185L,29186L,29187L,29188L,29189L,29190L,29191L,29191L,
-     29192L,29193L,29194L,29195L,29196L,29197L,29198L,29199L,
-     29199L,29200L,29201L,29202L,29203L,29204L,29205L,29206L,
-     29207L,29208L,29208L,29209L,29210L,29211L,29212L,29213L,
-     29214L,29215L,29216L,29216L,29217L,29218L,29219L,29220L,
-     29221L,29222L,29223L,29224L,29225L,29225L,29226L,29227L,
-     29228L,29229L,29230L,29231L,29232L,29233L,29233L,29234L,
-     29235L,29236L,29237L,29238L,29239L,29240L,29241L,29242L,
-     29242L,29243L,29244L,29245L,29246L,29247L,29248L,29249L,
-     29250L,29250L,29251L,29252L,29253L,29254L,29255L,29256L,
-     29257L,29258L,29259L,29259L,29260L,29261L,29262L,29263L,
-     29264L,29265L,29266L,29267L,29267L,29268L,29269L,29270L,
-     29271L,29272L,29273L,29274L,29275L,29276L,29276L,29277L,
-     29278L,29279L,29280L,29281L,29282L,29283L,29284L,29284L,
-     29285L,29286L,29287L,29288L,29289L,29290L,29291L,29292L,
-     29293L,29293L,29294L,29295L,29296L,29297L,29298L,29299L,
-     29300L,29301L,29301L,29302L,29303L,29304L,29305L,29306L,
-     29307L,29308L,29309L,29310L,29310L,29311L,29312L,29313L,
-     29314L,29315L,29316L,29317L,29318L,29318L,29319L,29320L,
-     29321L,29322L,29323L,29324L,29325L,29326L,29327L,29327L,
-     29328L,29329L,29330L,29331L,29332L,29333L,29334L,29335L,
-     29335L,29336L,29337L,29338L,29339L,29340L,29341L,29342L,
-     29343L,29344L,29344L,29345L,29346L,29347L,29348L,29349L,
-     29350L,29351L,29352L,29352L,29353L,29354L,29355L,29356L,
-     29357L,29358L,29359L,29360L,29360L,29361L,29362L,29363L,
-     29364L,29365L,29366L,29367L,29368L,29369L,29369L,29370L,
-     29371L,29372L,29373L,29374L,29375L,29376L,29377L,29377L,
-     29378L,29379L,29380L,29381L,29382L,29383L,29384L,29385L,
-     29386L,29386L,29387L,29388L,29389L,29390L,29391L,29392L,
-     29393L,29394L,29394L,29395L,29396L,29397L,29398L,29399L,
-     29400L,29401L,29402L,29403L,29403L,29404L,29405L,29406L,
-     29407L,29408L,29409L,29410L,29411L,29411L,29412L,29413L,
-     29414L,29415L,29416L,29417L,29418L,29419L,29419L,29420L,
-     29421L,29422L,29423L,29424L,29425L,29426L,29427L,29428L,
-     29428L,29429L,29430L,29431L,29432L,29433L,29434L,29435L,
-     29436L,29436L,29437L,29438L,29439L,29440L,29441L,29442L,
-     29443L,29444L,29445L,29445L,29446L,29447L,29448L,29449L,
-     29450L,29451L,29452L,29453L,29453L,29454L,29455L,29456L,
-     29457L,29458L,29459L,29460L,29461L,29461L,29462L,29463L,
-     29464L,29465L,29466L,29467L,29468L,29469L,29470L,29470L,
-     29471L,29472L,29473L,29474L,29475L,29476L,29477L,29478L,
-     29478L,29479L,29480L,29481L,29482L,29483L,29484L,29485L,
-     29486L,29486L,29487L,29488L,29489L,29490L,29491L,29492L,
-     29493L,29494L,29495L,29495L,29496L,29497L,29498L,29499L,
-     29500L,29501L,29502L,29503L,29503L,29504L,29505L,29506L,
-     29507L,29508L,29509L,29510L,29511L,29511L,29512L,29513L,
-     29514L,29515L,29516L,29517L,29518L,29519L,29520L,29520L,
-     29521L,29522L,29523L,29524L,29525L,29526L,29527L,29528L,
-     29528L,29529L,29530L,29531L,29532L,29533L,29534L,29535L,
-     29536L,29536L,29537L,29538L,29539L,29540L,29541L,29542L,
-     29543L,29544L,29545L,29545L,29546L,29547L,29548L,29549L,
-     29550L,29551L,29552L,29553L,29553L,29554L,29555L,29556L,
-     29557L,29558L,29559L,29560L,29561L,29561L,29562L,29563L,
-     29564L,29565L,29566L,29567L,29568L,29569L,29570L,29570L,
-     29571L,29572L,29573L,29574L,29575L,29576L,29577L,29578L,
-     29578L,29579L,29580L,29581L,29582L,29583L,29584L,29585L,
-     29586L,29586L,29587L,29588L,29589L,29590L,29591L,29592L,
-     29593L,29594L,29594L,29595L,29596L,29597L,29598L,29599L,
-     29600L,29601L,29602L,29603L,29603L,29604L,29605L,29606L,
-     29607L,29608L,29609L,29610L,29611L,29611L,29612L,29613L,
-     29614L,29615L,29616L,29617L,29618L,29619L,29619L,29620L,
-     29621L,29622L,29623L,29624L,29625L,29626L,29627L,29628L,
-     29628L,29629L,29630L,29631L,29632L,29633L,29634L,29635L,
-     29636L,29636L,29637L,29638L,29639L,29640L,29641L,29642L,
-     29643L,29644L,29644L,29645L,29646L,29647L,29648L,29649L,
-     29650L,29651L,29652L,29652L,29653L,29654L,29655L,29656L,
-     29657L,29658L,29659L,29660L,29660L,29661L,29662L,29663L,
-     29664L,29665L,29666L,29667L,29668L,29669L,29669L,29670L,
-     29671L,29672L,29673L,29674L,29675L,29676L,29677L,29677L,
-     29678L,29679L,29680L,29681L,29682L,29683L,29684L,29685L,
-     29685L,29686L,29687L,29688L,29689L,29690L,29691L,29692L,
-     29693L,29693L,29694L,29695L,29696L,29697L,29698L,29699L,
-     29700L,29701L,29702L,29702L,29703L,29704L,29705L,29706L,
-     29707L,29708L,29709L,29710L,29710L,29711L,29712L,29713L,
-     29714L,29715L,29716L,29717L,29718L,29718L,29719L,29720L,
-     29721L,29722L,29723L,29724L,29725L,29726L,29726L,29727L,
-     29728L,29729L,29730L,29731L,29732L,29733L,29734L,29734L,
-     29735L,29736L,29737L,29738L,29739L,29740L,29741L,29742L,
-     29743L,29743L,29744L,29745L,29746L,29747L,29748L,29749L,
-     29750L,29751L,29751L,29752L,29753L,29754L,29755L,29756L,
-     29757L,29758L,29759L,29759L,29760L,29761L,29762L,29763L,
-     29764L,29765L,29766L,29767L,29767L,29768L,29769L,29770L,
-     29771L,29772L,29773L,29774L,29775L,29775L,29776L,29777L,
-     29778L,29779L,29780L,29781L,29782L,29783L,29783L,29784L,
-     29785L,29786L,29787L,29788L,29789L,29790L,29791L,29792L,
-     29792L,29793L,29794L,29795L,29796L,29797L,29798L,29799L,
-     29800L,29800L,29801L,29802L,29803L,29804L,29805L,29806L,
-     29807L,29808L,29808L,29809L,29810L,29811L,29812L,29813L,
-     29814L,29815L,29816L,29816L,29817L,29818L,29819L,29820L,
-     29821L,29822L,29823L,29824L,29824L,29825L,29826L,29827L,
-     29828L,29829L,29830L,29831L,29832L,29832L,29833L,29834L,
-     29835L,29836L,29837L,29838L,29839L,29840L,29840L,29841L,
-     29842L,29843L,29844L,29845L,29846L,29847L,29848L,29848L,
-     29849L,29850L,29851L,29852L,29853L,29854L,29855L,29856L,
-     29857L,29857L,29858L,29859L,29860L,29861L,29862L,29863L,
-     29864L,29865L,29865L,29866L,29867L,29868L,29869L,29870L,
-     29871L,29872L,29873L,29873L,29874L,29875L,29876L,29877L,
-     29878L,29879L,29880L,29881L,29881L,29882L,29883L,29884L,
-     29885L,29886L,29887L,29888L,29889L,29889L,29890L,29891L,
-     29892L,29893L,29894L,29895L,29896L,29897L,29897L,29898L,
-     29899L,29900L,29901L,29902L,29903L,29904L,29905L,29905L,
-     29906L,29907L,29908L,29909L,29910L,29911L,29912L,29913L,
-     29913L,29914L,29915L,29916L,29917L,29918L,29919L,29920L,
-     29921L,29921L,29922L,29923L,29924L,29925L,29926L,29927L,
-     29928L,29929L,29929L,29930L,29931L,29932L,29933L,29934L,
-     29935L,29936L,29937L,29937L,29938L,29939L,29940L,29941L,
-     29942L,29943L,29944L,29945L,29945L,29946L,29947L,29948L,
-     29949L,29950L,29951L,29952L,29953L,29954L,29954L,29955L,
-     29956L,29957L,29958L,29959L,29960L,29961L,29962L,29962L,
-     29963L,29964L,29965L,29966L,29967L,29968L,29969L,29970L,
-     29970L,29971L,29972L,29973L,29974L,29975L,29976L,29977L,
-     29978L,29978L,29979L,29980L,29981L,29982L,29983L,29984L,
-     29985L,29986L,29986L,29987L,29988L,29989L,29990L,29991L,
-     29992L,29993L,29994L,29994L,29995L,29996L,29997L,29998L,
-     29999L,30000L,30001L,30002L,30002L,30003L,30004L,30005L,
-     30006L,30007L,30008L,30009L,30010L,30010L,30011L,30012L,
-     30013L,30014L,30015L,30016L,30017L,30018L,30018L,30019L,
-     30020L,30021L,30022L,30023L,30024L,30025L,30026L,30026L,
-     30027L,30028L,30029L,30030L,30031L,30032L,30033L,30034L,
-     30034L,30035L,30036L,30037L,30038L,30039L,30040L,30041L,
-     30042L,30042L,30043L,30044L,30045L,30046L,30047L,30048L,
-     30049L,30050L,30050L,30051L,30052L,30053L,30054L,30055L,
-     30056L,30057L,30058L,30058L,30059L,30060L,30061L,30062L,
-     30063L,30064L,30065L,30066L,30066L,30067L,30068L,30069L,
-     30070L,30071L,30072L,30073L,30074L,30074L,30075L,30076L,
-     30077L,30078L,30079L,30080L,30081L,30082L,30082L,30083L,
-     30084L,30085L,30086L,30087L,30088L,30089L,30090L,30090L,
-     30091L,30092L,30093L,30094L,30095L,30096L,30097L,30097L,
-     30098L,30099L,30100L,30101L,30102L,30103L,30104L,30105L,
-     30105L,30106L,30107L,30108L,30109L,30110L,30111L,30112L,
-     30113L,30113L,30114L,30115L,30116L,30117L,30118L,30119L,
-     30120L,30121L,30121L,30122L,30123L,30124L,30125L,30126L,
-     30127L,30128L,30129L,30129L,30130L,30131L,30132L,30133L,
-     30134L,30135L,30136L,30137L,30137L,30138L,30139L,30140L,
-     30141L,30142L,30143L,30144L,30145L,30145L,30146L,30147L,
-     30148L,30149L,30150L,30151L,30152L,30153L,30153L,30154L,
-     30155L,30156L,30157L,30158L,30159L,30160L,30161L,30161L,
-     30162L,30163L,30164L,30165L,30166L,30167L,30168L,30169L,
-     30169L,30170L,30171L,30172L,30173L,30174L,30175L,30176L,
-     30177L,30177L,30178L,30179L,30180L,30181L,30182L,30183L,
-     30184L,30185L,30185L,30186L,30187L,30188L,30189L,30190L,
-     30191L,30192L,30193L,30193L,30194L,30195L,30196L,30197L,
-     30198L,30199L,30200L,30200L,30201L,30202L,30203L,30204L,
-     30205L,30206L,30207L,30208L,30208L,30209L,30210L,30211L,
-     30212L,30213L,30214L,30215L,30216L,30216L,30217L,30218L,
-     30219L,30220L,30221L,30222L,30223L,30224L,30224L,30225L,
-     30226L,30227L,30228L,30229L,30230L,30231L,30232L,30232L,
-     30233L,30234L,30235L,30236L,30237L,30238L,30239L,30240L,
-     30240L,30241L,30242L,30243L,30244L,30245L,30246L,30247L,
-     30248L,30248L,30249L,30250L,30251L,30252L,30253L,30254L,
-     30255L,30256L,30256L,30257L,30258L,30259L,30260L,30261L,
-     30262L,30263L,30263L,30264L,30265L,30266L,30267L,30268L,
-     30269L,30270L,30271L,30271L,30272L,30273L,30274L,30275L,
-     30276L,30277L,30278L,30279L,30279L,30280L,30281L,30282L,
-     30283L,30284L,30285L,30286L,30287L,30287L,30288L,30289L,
-     30290L,30291L,30292L,30293L,30294L,30295L,30295L,30296L,
-     30297L,30298L,30299L,30300L,30301L,30302L,30303L,30303L,
-     30304L,30305L,30306L,30307L,30308L,30309L,30310L,30310L,
-     30311L,30312L,30313L,30314L,30315L,30316L,30317L,30318L,
-     30318L,30319L,30320L,30321L,30322L,30323L,30324L,30325L,
-     30326L,30326L,30327L,30328L,30329L,30330L,30331L,30332L,
-     30333L,30334L,30334L,30335L,30336L,30337L,30338L,30339L,
-     30340L,30341L,30342L,30342L,30343L,30344L,30345L,30346L,
-     30347L,30348L,30349L,30349L,30350L,30351L,30352L,30353L,
-     30354L,30355L,30356L,30357L,30357L,30358L,30359L,30360L,
-     30361L,30362L,30363L,30364L,30365L,30365L,30366L,30367L,
-     30368L,30369L,30370L,30371L,30372L,30373L,30373L,30374L,
-     30375L,30376L,30377L,30378L,30379L,30380L,30381L,30381L,
-     30382L,30383L,30384L,30385L,30386L,30387L,30388L,30388L,
-     30389L,30390L,30391L,30392L,30393L,30394L,30395L,30396L,
-     30396L,30397L,30398L,30399L,30400L,30401L,30402L,30403L,
-     30404L,30404L,30405L,30406L,30407L,30408L,30409L,30410L,
-     30411L,30412L,30412L,30413L,30414L,30415L,30416L,30417L,
-     30418L,30419L,30419L,30420L,30421L,30422L,30423L,30424L,
-     30425L,30426L,30427L,30427L,30428L,30429L,30430L,30431L,
-     30432L,30433L,30434L,30435L,30435L,30436L,30437L,30438L,
-     30439L,30440L,30441L,30442L,30443L,30443L,30444L,30445L,
-     30446L,30447L,30448L,30449L,30450L,30450L,30451L,30452L,
-     30453L,30454L,30455L,30456L,30457L,30458L,30458L,30459L,
-     30460L,30461L,30462L,30463L,30464L,30465L,30466L,30466L,
-     30467L,30468L,30469L,30470L,30471L,30472L,30473L,30474L,
-     30474L,30475L,30476L,30477L,30478L,30479L,30480L,30481L,
-     30481L,30482L,30483L,30484L,30485L,30486L,30487L,30488L,
-     30489L,30489L,30490L,30491L,30492L,30493L,30494L,30495L,
-     30496L,30497L,30497L,30498L,30499L,30500L,30501L,30502L,
-     30503L,30504L,30504L,30505L,30506L,30507L,30508L,30509L,
-     30510L,30511L,30512L,30512L,30513L,30514L,30515L,30516L,
-     30517L,30518L,30519L,30520L,30520L,30521L,30522L,30523L,
-     30524L,30525L,30526L,30527L,30528L,30528L,30529L,30530L,
-     30531L,30532L,30533L,30534L,30535L,30535L,30536L,30537L,
-     30538L,30539L,30540L,30541L,30542L,30543L,30543L,30544L,
-     30545L,30546L,30547L,30548L,30549L,30550L,30551L,30551L,
-     30552L,30553L,30554L,30555L,30556L,30557L,30558L,30558L,
-     30559L,30560L,30561L,30562L,30563L,30564L,30565L,30566L,
-     30566L,30567L,30568L,30569L,30570L,30571L,30572L,30573L,
-     30574L,30574L,30575L,30576L,30577L,30578L,30579L,30580L,
-     30581L,30581L,30582L,30583L,30584L,30585L,30586L,30587L,
-     30588L,30589L,30589L,30590L,30591L,30592L,30593L,30594L,
-     30595L,30596L,30597L,30597L,30598L,30599L,30600L,30601L,
-     30602L,30603L,30604L,30604L,30605L,30606L,30607L,30608L,
-     30609L,30610L,30611L,30612L,30612L,30613L,30614L,30615L,
-     30616L,30617L,30618L,30619L,30619L,30620L,30621L,30622L,
-     30623L,30624L,30625L,30626L,30627L,30627L,30628L,30629L,
-     30630L,30631L,30632L,30633L,30634L,30635L,30635L,30636L,
-     30637L,30638L,30639L,30640L,30641L,30642L,30642L,30643L,
-     30644L,30645L,30646L,30647L,30648L,30649L,30650L,30650L,
-     30651L,30652L,30653L,30654L,30655L,30656L,30657L,30658L,
-     30658L,30659L,30660L,30661L,30662L,30663L,30664L,30665L,
-     30665L,30666L,30667L,30668L,30669L,30670L,30671L,30672L,
-     30673L,30673L,30674L,30675L,30676L,30677L,30678L,30679L,
-     30680L,30680L,30681L,30682L,30683L,30684L,30685L,30686L,
-     30687L,30688L,30688L,30689L,30690L,30691L,30692L,30693L,
-     30694L,30695L,30696L,30696L,30697L,30698L,30699L,30700L,
-     30701L,30702L,30703L,30703L,30704L,30705L,30706L,30707L,
-     30708L,30709L,30710L,30711L,30711L,30712L,30713L,30714L,
-     30715L,30716L,30717L,30718L,30718L,30719L,30720L,30721L,
-     30722L,30723L,30724L,30725L,30726L,30726L,30727L,30728L,
-     30729L,30730L,30731L,30732L,30733L,30733L,30734L,30735L,
-     30736L,30737L,30738L,30739L,30740L,30741L,30741L,30742L,
-     30743L,30744L,30745L,30746L,30747L,30748L,30748L,30749L,
-     30750L,30751L,30752L,30753L,30754L,30755L,30756L,30756L,
-     30757L,30758L,30759L,30760L,30761L,30762L,30763L,30764L,
-     30764L,30765L,30766L,30767L,30768L,30769L,30770L,30771L,
-     30771L,30772L,30773L,30774L,30775L,30776L,30777L,30778L,
-     30779L,30779L,30780L,30781L,30782L,30783L,30784L,30785L,
-     30786L,30786L,30787L,30788L,30789L,30790L,30791L,30792L,
-     30793L,30794L,30794L,30795L,30796L,30797L,30798L,30799L,
-     30800L,30801L,30801L,30802L,30803L,30804L,30805L,30806L,
-     30807L,30808L,30809L,30809L,30810L,30811L,30812L,30813L,
-     30814L,30815L,30816L,30816L,30817L,30818L,30819L,30820L,
-     30821L,30822L,30823L,30824L,30824L,30825L,30826L,30827L,
-     30828L,30829L,30830L,30831L,30831L,30832L,30833L,30834L,
-     30835L,30836L,30837L,30838L,30839L,30839L,30840L,30841L,
-     30842L,30843L,30844L,30845L,30846L,30846L,30847L,30848L,
-     30849L,30850L,30851L,30852L,30853L,30854L,30854L,30855L,
-     30856L,30857L,30858L,30859L,30860L,30861L,30861L,30862L,
-     30863L,30864L,30865L,30866L,30867L,30868L,30869L,30869L,
-     30870L,30871L,30872L,30873L,30874L,30875L,30876L,30876L,
-     30877L,30878L,30879L,30880L,30881L,30882L,30883L,30884L,
-     30884L,30885L,30886L,30887L,30888L,30889L,30890L,30891L,
-     30891L,30892L,30893L,30894L,30895L,30896L,30897L,30898L,
-     30899L,30899L,30900L,30901L,30902L,30903L,30904L,30905L,
-     30906L,30906L,30907L,30908L,30909L,30910L,30911L,30912L,
-     30913L,30914L,30914L,30915L,30916L,30917L,30918L,30919L,
-     30920L,30921L,30921L,30922L,30923L,30924L,30925L,30926L,
-     30927L,30928L,30929L,30929L,30930L,30931L,30932L,30933L,
-     30934L,30935L,30936L,30936L,30937L,30938L,30939L,30940L,
-     30941L,30942L,30943L,30943L,30944L,30945L,30946L,30947L,
-     30948L,30949L,30950L,30951L,30951L,30952L,30953L,30954L,
-     30955L,30956L,30957L,30958L,30958L,30959L,30960L,30961L,
-     30962L,30963L,30964L,30965L,30966L,30966L,30967L,30968L,
-     30969L,30970L,30971L,30972L,30973L,30973L,30974L,30975L,
-     30976L,30977L,30978L,30979L,30980L,30981L,30981L,30982L,
-     30983L,30984L,30985L,30986L,30987L,30988L,30988L,30989L,
-     30990L,30991L,30992L,30993L,30994L,30995L,30995L,30996L,
-     30997L,30998L,30999L,31000L,31001L,31002L,31003L,31003L,
-     31004L,31005L,31006L,31007L,31008L,31009L,31010L,31010L,
-     31011L,31012L,31013L,31014L,31015L,31016L,31017L,31018L,
-     31018L,31019L,31020L,31021L,31022L,31023L,31024L,31025L,
-     31025L,31026L,31027L,31028L,31029L,31030L,31031L,31032L,
-     31032L,31033L,31034L,31035L,31036L,31037L,31038L,31039L,
-     31040L,31040L,31041L,31042L,31043L,31044L,31045L,31046L,
-     31047L,31047L,31048L,31049L,31050L,31051L,31052L,31053L,
-     31054L,31055L,31055L,31056L,31057L,31058L,31059L,31060L,
-     31061L,31062L,31062L,31063L,31064L,31065L,31066L,31067L,
-     31068L,31069L,31069L,31070L,31071L,31072L,31073L,31074L,
-     31075L,31076L,31077L,31077L,31078L,31079L,31080L,31081L,
-     31082L,31083L,31084L,31084L,31085L,31086L,31087L,31088L,
-     31089L,31090L,31091L,31091L,31092L,31093L,31094L,31095L,
-     31096L,31097L,31098L,31099L,31099L,31100L,31101L,31102L,
-     31103L,31104L,31105L,31106L,31106L,31107L,31108L,31109L,
-     31110L,31111L,31112L,31113L,31113L,31114L,31115L,31116L,
-     31117L,31118L,31119L,31120L,31121L,31121L,31122L,31123L,
-     31124L,31125L,31126L,31127L,31128L,31128L,31129L,31130L,
-     31131L,31132L,31133L,31134L,31135L,31135L,31136L,31137L,
-     31138L,31139L,31140L,31141L,31142L,31143L,31143L,31144L,
-     31145L,31146L,31147L,31148L,31149L,31150L,31150L,31151L,
-     31152L,31153L,31154L,31155L,31156L,31157L,31157L,31158L,
-     31159L,31160L,31161L,31162L,31163L,31164L,31165L,31165L,
-     31166L,31167L,31168L,31169L,31170L,31171L,31172L,31172L,
-     31173L,31174L,31175L,31176L,31177L,31178L,31179L,31179L,
-     31180L,31181L,31182L,31183L,31184L,31185L,31186L,31187L,
-     31187L,31188L,31189L,31190L,31191L,31192L,31193L,31194L,
-     31194L,31195L,31196L,31197L,31198L,31199L,31200L,31201L,
-     31201L,31202L,31203L,31204L,31205L,31206L,31207L,31208L,
-     31208L,31209L,31210L,31211L,31212L,31213L,31214L,31215L,
-     31216L,31216L,31217L,31218L,31219L,31220L,31221L,31222L,
-     31223L,31223L,31224L,31225L,31226L,31227L,31228L,31229L,
-     31230L,31230L,31231L,31232L,31233L,31234L,31235L,31236L,
-     31237L,31238L,31238L,31239L,31240L,31241L,31242L,31243L,
-     31244L,31245L,31245L,31246L,31247L,31248L,31249L,31250L,
-     31251L,31252L,31252L,31253L,31254L,31255L,31256L,31257L,
-     31258L,31259L,31259L,31260L,31261L,31262L,31263L,31264L,
-     31265L,31266L,31267L,31267L,31268L,31269L,31270L,31271L,
-     31272L,31273L,31274L,31274L,31275L,31276L,31277L,31278L,
-     31279L,31280L,31281L,31281L,31282L,31283L,31284L,31285L,
-     31286L,31287L,31288L,31288L,31289L,31290L,31291L,31292L,
-     31293L,31294L,31295L,31296L,31296L,31297L,31298L,31299L,
-     31300L,31301L,31302L,31303L,31303L,31304L,31305L,31306L,
-     31307L,31308L,31309L,31310L,31310L,31311L,31312L,31313L,
-     31314L,31315L,31316L,31317L,31317L,31318L,31319L,31320L,
-     31321L,31322L,31323L,31324L,31325L,31325L,31326L,31327L,
-     31328L,31329L,31330L,31331L,31332L,31332L,31333L,31334L,
-     31335L,31336L,31337L,31338L,31339L,31339L,31340L,31341L,
-     31342L,31343L,31344L,31345L,31346L,31346L,31347L,31348L,
-     31349L,31350L,31351L,31352L,31353L,31353L,31354L,31355L,
-     31356L,31357L,31358L,31359L,31360L,31361L,31361L,31362L,
-     31363L,31364L,31365L,31366L,31367L,31368L,31368L,31369L,
-     31370L,31371L,31372L,31373L,31374L,31375L,31375L,31376L,
-     31377L,31378L,31379L,31380L,31381L,31382L,31382L,31383L,
-     31384L,31385L,31386L,31387L,31388L,31389L,31389L,31390L,
-     31391L,31392L,31393L,31394L,31395L,31396L,31397L,31397L,
-     31398L,31399L,31400L,31401L,31402L,31403L,31404L,31404L,
-     31405L,31406L,31407L,31408L,31409L,31410L,31411L,31411L,
-     31412L,31413L,31414L,31415L,31416L,31417L,31418L,31418L,
-     31419L,31420L,31421L,31422L,31423L,31424L,31425L,31425L,
-     31426L,31427L,31428L,31429L,31430L,31431L,31432L,31432L,
-     31433L,31434L,31435L,31436L,31437L,31438L,31439L,31440L,
-     31440L,31441L,31442L,31443L,31444L,31445L,31446L,31447L,
-     31447L,31448L,31449L,31450L,31451L,31452L,31453L,31454L,
-     31454L,31455L,31456L,31457L,31458L,31459L,31460L,31461L,
-     31461L,31462L,31463L,31464L,31465L,31466L,31467L,31468L,
-     31468L,31469L,31470L,31471L,31472L,31473L,31474L,31475L,
-     31475L,31476L,31477L,31478L,31479L,31480L,31481L,31482L,
-     31482L,31483L,31484L,31485L,31486L,31487L,31488L,31489L,
-     31490L,31490L,31491L,31492L,31493L,31494L,31495L,31496L,
-     31497L,31497L,31498L,31499L,31500L,31501L,31502L,31503L,
-     31504L,31504L,31505L,31506L,31507L,31508L,31509L,31510L,
-     31511L,31511L,31512L,31513L,31514L,31515L,31516L,31517L,
-     31518L,31518L,31519L,31520L,31521L,31522L,31523L,31524L,
-     31525L,31525L,31526L,31527L,31528L,31529L,31530L,31531L,
-     31532L,31532L,31533L,31534L,31535L,31536L,31537L,31538L,
-     31539L,31539L,31540L,31541L,31542L,31543L,31544L,31545L,
-     31546L,31547L,31547L,31548L,31549L,31550L,31551L,31552L,
-     31553L,31554L,31554L,31555L,31556L,31557L,31558L,31559L,
-     31560L,31561L,31561L,31562L,31563L,31564L,31565L,31566L,
-     31567L,31568L,31568L,31569L,31570L,31571L,31572L,31573L,
-     31574L,31575L,31575L,31576L,31577L,31578L,31579L,31580L,
-     31581L,31582L,31582L,31583L,31584L,31585L,31586L,31587L,
-     31588L,31589L,31589L,31590L,31591L,31592L,31593L,31594L,
-     31595L,31596L,31596L,31597L,31598L,31599L,31600L,31601L,
-     31602L,31603L,31603L,31604L,31605L,31606L,31607L,31608L,
-     31609L,31610L,31610L,31611L,31612L,31613L,31614L,31615L,
-     31616L,31617L,31617L,31618L,31619L,31620L,31621L,31622L,
-     31623L,31624L,31624L,31625L,31626L,31627L,31628L,31629L,
-     31630L,31631L,31631L,31632L,31633L,31634L,31635L,31636L,
-     31637L,31638L,31638L,31639L,31640L,31641L,31642L,31643L,
-     31644L,31645L,31646L,31646L,31647L,31648L,31649L,31650L,
-     31651L,31652L,31653L,31653L,31654L,31655L,31656L,31657L,
-     31658L,31659L,31660L,31660L,31661L,31662L,31663L,31664L,
-     31665L,31666L,31667L,31667L,31668L,31669L,31670L,31671L,
-     31672L,31673L,31674L,31674L,31675L,31676L,31677L,31678L,
-     31679L,31680L,31681L,31681L,31682L,31683L,31684L,31685L,
-     31686L,31687L,31688L,31688L,31689L,31690L,31691L,31692L,
-     31693L,31694L,31695L,31695L,31696L,31697L,31698L,31699L,
-     31700L,31701L,31702L,31702L,31703L,31704L,31705L,31706L,
-     31707L,31708L,31709L,31709L,31710L,31711L,31712L,31713L,
-     31714L,31715L,31716L,31716L,31717L,31718L,31719L,31720L,
-     31721L,31722L,31723L,31723L,31724L,31725L,31726L,31727L,
-     31728L,31729L,31730L,31730L,31731L,31732L,31733L,31734L,
-     31735L,31736L,31737L,31737L,31738L,31739L,31740L,31741L,
-     31742L,31743L,31744L,31744L,31745L,31746L,31747L,31748L,
-     31749L,31750L,31751L,31751L,31752L,31753L,31754L,31755L,
-     31756L,31757L,31758L,31758L,31759L,31760L,31761L,31762L,
-     31763L,31764L,31765L,31765L,31766L,31767L,31768L,31769L,
-     31770L,31771L,31772L,31772L,31773L,31774L,31775L,31776L,
-     31777L,31778L,31779L,31779L,31780L,31781L,31782L,31783L,
-     31784L,31785L,31786L,31786L,31787L,31788L,31789L,31790L,
-     31791L,31792L,31793L,31793L,31794L,31795L,31796L,31797L,
-     31798L,31799L,31800L,31800L,31801L,31802L,31803L,31804L,
-     31805L,31806L,31807L,31807L,31808L,31809L,31810L,31811L,
-     31812L,31813L,31814L,31814L,31815L,31816L,31817L,31818L,
-     31819L,31820L,31820L,31821L,31822L,31823L,31824L,31825L,
-     31826L,31827L,31827L,31828L,31829L,31830L,31831L,31832L,
-     31833L,31834L,31834L,31835L,31836L,31837L,31838L,31839L,
-     31840L,31841L,31841L,31842L,31843L,31844L,31845L,31846L,
-     31847L,31848L,31848L,31849L,31850L,31851L,31852L,31853L,
-     31854L,31855L,31855L,31856L,31857L,31858L,31859L,31860L,
-     31861L,31862L,31862L,31863L,31864L,31865L,31866L,31867L,
-     31868L,31869L,31869L,31870L,31871L,31872L,31873L,31874L,
-     31875L,31876L,31876L,31877L,31878L,31879L,31880L,31881L,
-     31882L,31883L,31883L,31884L,31885L,31886L,31887L,31888L,
-     31889L,31890L,31890L,31891L,31892L,31893L,31894L,31895L,
-     31896L,31897L,31897L,31898L,31899L,31900L,31901L,31902L,
-     31903L,31904L,31904L,31905L,31906L,31907L,31908L,31909L,
-     31910L,31910L,31911L,31912L,31913L,31914L,31915L,31916L,
-     31917L,31917L,31918L,31919L,31920L,31921L,31922L,31923L,
-     31924L,31924L,31925L,31926L,31927L,31928L,31929L,31930L,
-     31931L,31931L,31932L,31933L,31934L,31935L,31936L,31937L,
-     31938L,31938L,31939L,31940L,31941L,31942L,31943L,31944L,
-     31945L,31945L,31946L,31947L,31948L,31949L,31950L,31951L,
-     31952L,31952L,31953L,31954L,31955L,31956L,31957L,31958L,
-     31959L,31959L,31960L,31961L,31962L,31963L,31964L,31965L,
-     31966L,31966L,31967L,31968L,31969L,31970L,31971L,31972L,
-     31972L,31973L,31974L,31975L,31976L,31977L,31978L,31979L,
-     31979L,31980L,31981L,31982L,31983L,31984L,31985L,31986L,
-     31986L,31987L,31988L,31989L,31990L,31991L,31992L,31993L,
-     31993L,31994L,31995L,31996L,31997L,31998L,31999L,32000L,
-     32000L,32001L,32002L,32003L,32004L,32005L,32006L,32007L,
-     32007L,32008L,32009L,32010L,32011L,32012L,32013L,32014L,
-     32014L,32015L,32016L,32017L,32018L,32019L,32020L,32020L,
-     32021L,32022L,32023L,32024L,32025L,32026L,32027L,32027L,
-     32028L,32029L,32030L,32031L,32032L,32033L,32034L,32034L,
-     32035L,32036L,32037L,32038L,32039L,32040L,32041L,32041L,
-     32042L,32043L,32044L,32045L,32046L,32047L,32048L,32048L,
-     32049L,32050L,32051L,32052L,32053L,32054L,32055L,32055L,
-     32056L,32057L,32058L,32059L,32060L,32061L,32061L,32062L,
-     32063L,32064L,32065L,32066L,32067L,32068L,32068L,32069L,
-     32070L,32071L,32072L,32073L,32074L,32075L,32075L,32076L,
-     32077L,32078L,32079L,32080L,32081L,32082L,32082L,32083L,
-     32084L,32085L,32086L,32087L,32088L,32089L,32089L,32090L,
-     32091L,32092L,32093L,32094L,32095L,32096L,32096L,32097L,
-     32098L,32099L,32100L,32101L,32102L,32102L,32103L,32104L,
-     32105L,32106L,32107L,32108L,32109L,32109L,32110L,32111L,
-     32112L,32113L,32114L,32115L,32116L,32116L,32117L,32118L,
-     32119L,32120L,32121L,32122L,32123L,32123L,32124L,32125L,
-     32126L,32127L,32128L,32129L,32130L,32130L,32131L,32132L,
-     32133L,32134L,32135L,32136L,32136L,32137L,32138L,32139L,
-     32140L,32141L,32142L,32143L,32143L,32144L,32145L,32146L,
-     32147L,32148L,32149L,32150L,32150L,32151L,32152L,32153L,
-     32154L,32155L,32156L,32157L,32157L,32158L,32159L,32160L,
-     32161L,32162L,32163L,32163L,32164L,32165L,32166L,32167L,
-     32168L,32169L,32170L,32170L,32171L,32172L,32173L,32174L,
-     32175L,32176L,32177L,32177L,32178L,32179L,32180L,32181L,
-     32182L,32183L,32184L,32184L,32185L,32186L,32187L,32188L,
-     32189L,32190L,32190L,32191L,32192L,32193L,32194L,32195L,
-     32196L,32197L,32197L,32198L,32199L,32200L,32201L,32202L,
-     32203L,32204L,32204L,32205L,32206L,32207L,32208L,32209L,
-     32210L,32211L,32211L,32212L,32213L,32214L,32215L,32216L,
-     32217L,32217L,32218L,32219L,32220L,32221L,32222L,32223L,
-     32224L,32224L,32225L,32226L,32227L,32228L,32229L,32230L,
-     32231L,32231L,32232L,32233L,32234L,32235L,32236L,32237L,
-     32238L,32238L,32239L,32240L,32241L,32242L,32243L,32244L,
-     32244L,32245L,32246L,32247L,32248L,32249L,32250L,32251L,
-     32251L,32252L,32253L,32254L,32255L,32256L,32257L,32258L,
-     32258L,32259L,32260L,32261L,32262L,32263L,32264L,32265L,
-     32265L,32266L,32267L,32268L,32269L,32270L,32271L,32271L,
-     32272L,32273L,32274L,32275L,32276L,32277L,32278L,32278L,
-     32279L,32280L,32281L,32282L,32283L,32284L,32285L,32285L,
-     32286L,32287L,32288L,32289L,32290L,32291L,32291L,32292L,
-     32293L,32294L,32295L,32296L,32297L,32298L,32298L,32299L,
-     32300L,32301L,32302L,32303L,32304L,32305L,32305L,32306L,
-     32307L,32308L,32309L,32310L,32311L,32311L,32312L,32313L,
-     32314L,32315L,32316L,32317L,32318L,32318L,32319L,32320L,
-     32321L,32322L,32323L,32324L,32325L,32325L,32326L,32327L,
-     32328L,32329L,32330L,32331L,32332L,32332L,32333L,32334L,
-     32335L,32336L,32337L,32338L,32338L,32339L,32340L,32341L,
-     32342L,32343L,32344L,32345L,32345L,32346L,32347L,32348L,
-     32349L,32350L,32351L,32352L,32352L,32353L,32354L,32355L,
-     32356L,32357L,32358L,32358L,32359L,32360L,32361L,32362L,
-     32363L,32364L,32365L,32365L,32366L,32367L,32368L,32369L,
-     32370L,32371L,32372L,32372L,32373L,32374L,32375L,32376L,
-     32377L,32378L,32378L,32379L,32380L,32381L,32382L,32383L,
-     32384L,32385L,32385L,32386L,32387L,32388L,32389L,32390L,
-     32391L,32392L,32392L,32393L,32394L,32395L,32396L,32397L,
-     32398L,32398L,32399L,32400L,32401L,32402L,32403L,32404L,
-     32405L,32405L,32406L,32407L,32408L,32409L,32410L,32411L,
-     32411L,32412L,32413L,32414L,32415L,32416L,32417L,32418L,
-     32418L,32419L,32420L,32421L,32422L,32423L,32424L,32425L,
-     32425L,32426L,32427L,32428L,32429L,32430L,32431L,32431L,
-     32432L,32433L,32434L,32435L,32436L,32437L,32438L,32438L,
-     32439L,32440L,32441L,32442L,32443L,32444L,32445L,32445L,
-     32446L,32447L,32448L,32449L,32450L,32451L,32451L,32452L,
-     32453L,32454L,32455L,32456L,32457L,32458L,32458L,32459L,
-     32460L,32461L,32462L,32463L,32464L,32465L,32465L,32466L,
-     32467L,32468L,32469L,32470L,32471L,32471L,32472L,32473L,
-     32474L,32475L,32476L,32477L,32478L,32478L,32479L,32480L,
-     32481L,32482L,32483L,32484L,32484L,32485L,32486L,32487L,
-     32488L,32489L,32490L,32491L,32491L,32492L,32493L,32494L,
-     32495L,32496L,32497L,32498L,32498L,32499L,32500L,32501L,
-     32502L,32503L,32504L,32504L,32505L,32506L,32507L,32508L,
-     32509L,32510L,32511L,32511L,32512L,32513L,32514L,32515L,
-     32516L,32517L,32517L,32518L,32519L,32520L,32521L,32522L,
-     32523L,32524L,32524L,32525L,32526L,32527L,32528L,32529L,
-     32530L,32531L,32531L,32532L,32533L,32534L,32535L,32536L,
-     32537L,32537L,32538L,32539L,32540L,32541L,32542L,32543L,
-     32544L,32544L,32545L,32546L,32547L,32548L,32549L,32550L,
-     32550L,32551L,32552L,32553L,32554L,32555L,32556L,32557L,
-     32557L,32558L,32559L,32560L,32561L,32562L,32563L,32563L,
-     32564L,32565L,32566L,32567L,32568L,32569L,32570L,32570L,
-     32571L,32572L,32573L,32574L,32575L,32576L,32576L,32577L,
-     32578L,32579L,32580L,32581L,32582L,32583L,32583L,32584L,
-     32585L,32586L,32587L,32588L,32589L,32590L,32590L,32591L,
-     32592L,32593L,32594L,32595L,32596L,32596L,32597L,32598L,
-     32599L,32600L,32601L,32602L,32603L,32603L,32604L,32605L,
-     32606L,32607L,32608L,32609L,32609L,32610L,32611L,32612L,
-     32613L,32614L,32615L,32616L,32616L,32617L,32618L,32619L,
-     32620L,32621L,32622L,32622L,32623L,32624L,32625L,32626L,
-     32627L,32628L,32629L,32629L,32630L,32631L,32632L,32633L,
-     32634L,32635L,32635L,32636L,32637L,32638L,32639L,32640L,
-     32641L,32642L,32642L,32643L,32644L,32645L,32646L,32647L,
-     32648L,32648L,32649L,32650L,32651L,32652L,32653L,32654L,
-     32655L,32655L,32656L,32657L,32658L,32659L,32660L,32661L,
-     32661L,32662L,32663L,32664L,32665L,32666L,32667L,32668L,
-     32668L,32669L,32670L,32671L,32672L,32673L,32674L,32675L,
-     32675L,32676L,32677L,32678L,32679L,32680L,32681L,32681L,
-     32682L,32683L,32684L,32685L,32686L,32687L,32688L,32688L,
-     32689L,32690L,32691L,32692L,32693L,32694L,32694L,32695L,
-     32696L,32697L,32698L,32699L,32700L,32701L,32701L,32702L,
-     32703L,32704L,32705L,32706L,32707L,32707L,32708L,32709L,
-     32710L,32711L,32712L,32713L,32714L,32714L,32715L,32716L,
-     32717L,32718L,32719L,32720L,32720L,32721L,32722L,32723L,
-     32724L,32725L,32726L,32726L,32727L,32728L,32729L,32730L,
-     32731L,32732L,32733L,32733L,32734L,32735L,32736L,32737L,
-     32738L,32739L,32739L,32740L,32741L,32742L,32743L,32744L,
-     32745L,32746L,32746L,32747L,32748L,32749L,32750L,32751L,
-     32752L,32752L,32753L,32754L,32755L,32756L,32757L,32758L,
-     32759L,32759L,32760L,32761L,32762L,32763L,32764L,32765L,
-     32765L,32766L,32767L,32768L,32769L,32770L,32771L,32772L,
-     32772L,32773L,32774L,32775L,32776L,32777L,32778L,32778L,
-     32779L,32780L,32781L,32782L,32783L,32784L,32785L,32785L,
-     32786L,32787L,32788L,32789L,32790L,32791L,32791L,32792L,
-     32793L,32794L,32795L,32796L,32797L,32798L,32798L,32799L,
-     32800L,32801L,32802L,32803L,32804L,32804L,32805L,32806L,
-     32807L,32808L,32809L,32810L,32811L,32811L,32812L,32813L,
-     32814L,32815L,32816L,32817L,32817L,32818L,32819L,32820L,
-     32821L,32822L,32823L,32823L,32824L,32825L,32826L,32827L,
-     32828L,32829L,32830L,32830L,32831L,32832L,32833L,32834L,
-     32835L,32836L,32836L,32837L,32838L,32839L,32840L,32841L,
-     32842L,32843L,32843L,32844L,32845L,32846L,32847L,32848L,
-     32849L,32849L,32850L,32851L,32852L,32853L,32854L,32855L,
-     32856L,32856L,32857L,32858L,32859L,32860L,32861L,32862L,
-     32862L,32863L,32864L,32865L,32866L,32867L,32868L,32868L,
-     32869L,32870L,32871L,32872L,32873L,32874L,32875L,32875L,
-     32876L,32877L,32878L,32879L,32880L,32881L,32881L,32882L,
-     32883L,32884L,32885L,32886L,32887L,32888L,32888L,32889L,
-     32890L,32891L,32892L,32893L,32894L,32894L,32895L,32896L,
-     32897L,32898L,32899L,32900L,32900L,32901L,32902L,32903L,
-     32904L,32905L,32906L,32907L,32907L,32908L,32909L,32910L,
-     32911L,32912L,32913L,32913L,32914L,32915L,32916L,32917L,
-     32918L,32919L,32920L,32920L,32921L,32922L,32923L,32924L,
-     32925L,32926L,32926L,32927L,32928L,32929L,32930L,32931L,
-     32932L,32932L,32933L,32934L,32935L,32936L,32937L,32938L,
-     32939L,32939L,32940L,32941L,32942L,32943L,32944L,32945L,
-     32945L,32946L,32947L,32948L,32949L,32950L,32951L,32952L,
-     32952L,32953L,32954L,32955L,32956L,32957L,32958L,32958L,
-     32959L,32960L,32961L,32962L,32963L,32964L,32964L,32965L,
-     32966L,32967L,32968L,32969L,32970L,32971L,32971L,32972L,
-     32973L,32974L,32975L,32976L,32977L,32977L,32978L,32979L,
-     32980L,32981L,32982L,32983L,32983L,32984L,32985L,32986L,
-     32987L,32988L,32989L,32990L,32990L,32991L,32992L,32993L,
-     32994L,32995L,32996L,32996L,32997L,32998L,32999L,33000L,
-     33001L,33002L,33002L,33003L,33004L,33005L,33006L,33007L,
-     33008L,33009L,33009L,33010L,33011L,33012L,33013L,33014L,
-     33015L,33015L,33016L,33017L,33018L,33019L,33020L,33021L,
-     33021L,33022L,33023L,33024L,33025L,33026L,33027L,33028L,
-     33028L,33029L,33030L,33031L,33032L,33033L,33034L,33034L,
-     33035L,33036L,33037L,33038L,33039L,33040L,33040L,33041L,
-     33042L,33043L,33044L,33045L,33046L,33047L,33047L,33048L,
-     33049L,33050L,33051L,33052L,33053L,33053L,33054L,33055L,
-     33056L,33057L,33058L,33059L,33059L,33060L,33061L,33062L,
-     33063L,33064L,33065L,33066L,33066L,33067L,33068L,33069L,
-     33070L,33071L,33072L,33072L,33073L,33074L,33075L,33076L,
-     33077L,33078L,33078L,33079L,33080L,33081L,33082L,33083L,
-     33084L,33085L,33085L,33086L,33087L,33088L,33089L,33090L,
-     33091L,33091L,33092L,33093L,33094L,33095L,33096L,33097L,
-     33097L,33098L,33099L,33100L,33101L,33102L,33103L,33104L,
-     33104L,33105L,33106L,33107L,33108L,33109L,33110L,33110L,
-     33111L,33112L,33113L,33114L,33115L,33116L,33116L,33117L,
-     33118L,33119L,33120L,33121L,33122L,33123L,33123L,33124L,
-     33125L,33126L,33127L,33128L,33129L,33129L,33130L,33131L,
-     33132L,33133L,33134L,33135L,33135L,33136L,33137L,33138L,
-     33139L,33140L,33141L,33141L,33142L,33143L,33144L,33145L,
-     33146L,33147L,33148L,33148L,33149L,33150L,33151L,33152L,
-     33153L,33154L,33154L,33155L,33156L,33157L,33158L,33159L,
-     33160L,33160L,33161L,33162L,33163L,33164L,33165L,33166L,
-     33167L,33167L,33168L,33169L,33170L,33171L,33172L,33173L,
-     33173L,33174L,33175L,33176L,33177L,33178L,33179L,33179L,
-     33180L,33181L,33182L,33183L,33184L,33185L,33185L,33186L,
-     33187L,33188L,33189L,33190L,33191L,33192L,33192L,33193L,
-     33194L,33195L,33196L,33197L,33198L,33198L,33199L,33200L,
-     33201L,33202L,33203L,33204L,33204L,33205L,33206L,33207L,
-     33208L,33209L,33210L,33210L,33211L,33212L,33213L,33214L,
-     33215L,33216L,33217L,33217L,33218L,33219L,33220L,33221L,
-     33222L,33223L,33223L,33224L,33225L,33226L,33227L,33228L,
-     33229L,33229L,33230L,33231L,33232L,33233L,33234L,33235L,
-     33235L,33236L,33237L,33238L,33239L,33240L,33241L,33242L,
-     33242L,33243L,33244L,33245L,33246L,33247L,33248L,33248L,
-     33249L,33250L,33251L,33252L,33253L,33254L,33254L,33255L,
-     33256L,33257L,33258L,33259L,33260L,33260L,33261L,33262L,
-     33263L,33264L,33265L,33266L,33266L,33267L,33268L,33269L,
-     33270L,33271L,33272L,33273L,33273L,33274L,33275L,33276L,
-     33277L,33278L,33279L,33279L,33280L,33281L,33282L,33283L,
-     33284L,33285L,33285L,33286L,33287L,33288L,33289L,33290L,
-     33291L,33291L,33292L,33293L,33294L,33295L,33296L,33297L,
-     33298L,33298L,33299L,33300L,33301L,33302L,33303L,33304L,
-     33304L,33305L,33306L,33307L,33308L,33309L,33310L,33310L,
-     33311L,33312L,33313L,33314L,33315L,33316L,33316L,33317L,
-     33318L,33319L,33320L,33321L,33322L,33322L,33323L,33324L,
-     33325L,33326L,33327L,33328L,33329L,33329L,33330L,33331L,
-     33332L,33333L,33334L,33335L,33335L,33336L,33337L,33338L,
-     33339L,33340L,33341L,33341L,33342L,33343L,33344L,33345L,
-     33346L,33347L,33347L,33348L,33349L,33350L,33351L,33352L,
-     33353L,33353L,33354L,33355L,33356L,33357L,33358L,33359L,
-     33360L,33360L,33361L,33362L,33363L,33364L,33365L,33366L,
-     33366L,33367L,33368L,33369L,33370L,33371L,33372L,33372L,
-     33373L,33374L,33375L,33376L,33377L,33378L,33378L,33379L,
-     33380L,33381L,33382L,33383L,33384L,33384L,33385L,33386L,
-     33387L,33388L,33389L,33390L,33390L,33391L,33392L,33393L,
-     33394L,33395L,33396L,33397L,33397L,33398L,33399L,33400L,
-     33401L,33402L,33403L,33403L,33404L,33405L,33406L,33407L,
-     33408L,33409L,33409L,33410L,33411L,33412L,33413L,33414L,
-     33415L,33415L,33416L,33417L,33418L,33419L,33420L,33421L,
-     33421L,33422L,33423L,33424L,33425L,33426L,33427L,33427L,
-     33428L,33429L,33430L,33431L,33432L,33433L,33434L,33434L,
-     33435L,33436L,33437L,33438L,33439L,33440L,33440L,33441L,
-     33442L,33443L,33444L,33445L,33446L,33446L,33447L,33448L,
-     33449L,33450L,33451L,33452L,33452L,33453L,33454L,33455L,
-     33456L,33457L,33458L,33458L,33459L,33460L,33461L,33462L,
-     33463L,33464L,33464L,33465L,33466L,33467L,33468L,33469L,
-     33470L,33470L,33471L,33472L,33473L,33474L,33475L,33476L,
-     33476L,33477L,33478L,33479L,33480L,33481L,33482L,33483L,
-     33483L,33484L,33485L,33486L,33487L,33488L,33489L,33489L,
-     33490L,33491L,33492L,33493L,33494L,33495L,33495L,33496L,
-     33497L,33498L,33499L,33500L,33501L,33501L,33502L,33503L,
-     33504L,33505L,33506L,33507L,33507L,33508L,33509L,33510L,
-     33511L,33512L,33513L,33513L,33514L,33515L,33516L,33517L,
-     33518L,33519L,33519L,33520L,33521L,33522L,33523L,33524L,
-     33525L,33525L,33526L,33527L,33528L,33529L,33530L,33531L,
-     33531L,33532L,33533L,33534L,33535L,33536L,33537L,33538L,
-     33538L,33539L,33540L,33541L,33542L,33543L,33544L,33544L,
-     33545L,33546L,33547L,33548L,33549L,33550L,33550L,33551L,
-     33552L,33553L,33554L,33555L,33556L,33556L,33557L,33558L,
-     33559L,33560L,33561L,33562L,33562L,33563L,33564L,33565L,
-     33566L,33567L,33568L,33568L,33569L,33570L,33571L,33572L,
-     33573L,33574L,33574L,33575L,33576L,33577L,33578L,33579L,
-     33580L,33580L,33581L,33582L,33583L,33584L,33585L,33586L,
-     33586L,33587L,33588L,33589L,33590L,33591L,33592L,33592L,
-     33593L,33594L,33595L,33596L,33597L,33598L,33598L,33599L,
-     33600L,33601L,33602L,33603L,33604L,33605L,33605L,33606L,
-     33607L,33608L,33609L,33610L,33611L,33611L,33612L,33613L,
-     33614L,33615L,33616L,33617L,33617L,33618L,33619L,33620L,
-     33621L,33622L,33623L,33623L,33624L,33625L,33626L,33627L,
-     33628L,33629L,33629L,33630L,33631L,33632L,33633L,33634L,
-     33635L,33635L,33636L,33637L,33638L,33639L,33640L,33641L,
-     33641L,33642L,33643L,33644L,33645L,33646L,33647L,33647L,
-     33648L,33649L,33650L,33651L,33652L,33653L,33653L,33654L,
-     33655L,33656L,33657L,33658L,33659L,33659L,33660L,33661L,
-     33662L,33663L,33664L,33665L,33665L,33666L,33667L,33668L,
-     33669L,33670L,33671L,33671L,33672L,33673L,33674L,33675L,
-     33676L,33677L,33677L,33678L,33679L,33680L,33681L,33682L,
-     33683L,33683L,33684L,33685L,33686L,33687L,33688L,33689L,
-     33689L,33690L,33691L,33692L,33693L,33694L,33695L,33695L,
-     33696L,33697L,33698L,33699L,33700L,33701L,33701L,33702L,
-     33703L,33704L,33705L,33706L,33707L,33707L,33708L,33709L,
-     33710L,33711L,33712L,33713L,33713L,33714L,33715L,33716L,
-     33717L,33718L,33719L,33719L,33720L,33721L,33722L,33723L,
-     33724L,33725L,33725L,33726L,33727L,33728L,33729L,33730L,
-     33731L,33731L,33732L,33733L,33734L,33735L,33736L,33737L,
-     33737L,33738L,33739L,33740L,33741L,33742L,33743L,33743L,
-     33744L,33745L,33746L,33747L,33748L,33749L,33749L,33750L,
-     33751L,33752L,33753L,33754L,33755L,33755L,33756L,33757L,
-     33758L,33759L,33760L,33761L,33761L,33762L,33763L,33764L,
-     33765L,33766L,33767L,33767L,33768L,33769L,33770L,33771L,
-     33772L,33773L,33773L,33774L,33775L,33776L,33777L,33778L,
-     33779L,33779L,33780L,33781L,33782L,33783L,33784L,33785L,
-     33785L,33786L,33787L,33788L,33789L,33790L,33791L,33791L,
-     33792L,33793L,33794L,33795L,33796L,33797L,33797L,33798L,
-     33799L,33800L,33801L,33802L,33803L,33803L,33804L,33805L,
-     33806L,33807L,33808L,33809L,33809L,33810L,33811L,33812L,
-     33813L,33814L,33815L,33815L,33816L,33817L,33818L,33819L,
-     33820L,33821L,33821L,33822L,33823L,33824L,33825L,33826L,
-     33827L,33827L,33828L,33829L,33830L,33831L,33832L,33833L,
-     33833L,33834L,33835L,33836L,33837L,33838L,33839L,33839L,
-     33840L,33841L,33842L,33843L,33844L,33845L,33845L,33846L,
-     33847L,33848L,33849L,33850L,33851L,33851L,33852L,33853L,
-     33854L,33855L,33856L,33857L,33857L,33858L,33859L,33860L,
-     33861L,33862L,33863L,33863L,33864L,33865L,33866L,33867L,
-     33868L,33869L,33869L,33870L,33871L,33872L,33873L,33874L,
-     33875L,33875L,33876L,33877L,33878L,33879L,33880L,33881L,
-     33881L,33882L,33883L,33884L,33885L,33886L,33887L,33887L,
-     33888L,33889L,33890L,33891L,33892L,33893L,33893L,33894L,
-     33895L,33896L,33897L,33898L,33899L,33899L,33900L,33901L,
-     33902L,33903L,33904L,33905L,33905L,33906L,33907L,33908L,
-     33909L,33910L,33910L,33911L,33912L,33913L,33914L,33915L,
-     33916L,33916L,33917L,33918L,33919L,33920L,33921L,33922L,
-     33922L,33923L,33924L,33925L,33926L,33927L,33928L,33928L,
-     33929L,33930L,33931L,33932L,33933L,33934L,33934L,33935L,
-     33936L,33937L,33938L,33939L,33940L,33940L,33941L,33942L,
-     33943L,33944L,33945L,33946L,33946L,33947L,33948L,33949L,
-     33950L,33951L,33952L,33952L,33953L,33954L,33955L,33956L,
-     33957L,33958L,33958L,33959L,33960L,33961L,33962L,33963L,
-     33964L,33964L,33965L,33966L,33967L,33968L,33969L,33970L,
-     33970L,33971L,33972L,33973L,33974L,33975L,33976L,33976L,
-     33977L,33978L,33979L,33980L,33981L,33981L,33982L,33983L,
-     33984L,33985L,33986L,33987L,33987L,33988L,33989L,33990L,
-     33991L,33992L,33993L,33993L,33994L,33995L,33996L,33997L,
-     33998L,33999L,33999L,34000L,34001L,34002L,34003L,34004L,
-     34005L,34005L,34006L,34007L,34008L,34009L,34010L,34011L,
-     34011L,34012L,34013L,34014L,34015L,34016L,34017L,34017L,
-     34018L,34019L,34020L,34021L,34022L,34023L,34023L,34024L,
-     34025L,34026L,34027L,34028L,34029L,34029L,34030L,34031L,
-     34032L,34033L,34034L,34034L,34035L,34036L,34037L,34038L,
-     34039L,34040L,34040L,34041L,34042L,34043L,34044L,34045L,
-     34046L,34046L,34047L,34048L,34049L,34050L,34051L,34052L,
-     34052L,34053L,34054L,34055L,34056L,34057L,34058L,34058L,
-     34059L,34060L,34061L,34062L,34063L,34064L,34064L,34065L,
-     34066L,34067L,34068L,34069L,34070L,34070L,34071L,34072L,
-     34073L,34074L,34075L,34076L,34076L,34077L,34078L,34079L,
-     34080L,34081L,34081L,34082L,34083L,34084L,34085L,34086L,
-     34087L,34087L,34088L,34089L,34090L,34091L,34092L,34093L,
-     34093L,34094L,34095L,34096L,34097L,34098L,34099L,34099L,
-     34100L,34101L,34102L,34103L,34104L,34105L,34105L,34106L,
-     34107L,34108L,34109L,34110L,34111L,34111L,34112L,34113L,
-     34114L,34115L,34116L,34116L,34117L,34118L,34119L,34120L,
-     34121L,34122L,34122L,34123L,34124L,34125L,34126L,34127L,
-     34128L,34128L,34129L,34130L,34131L,34132L,34133L,34134L,
-     34134L,34135L,34136L,34137L,34138L,34139L,34140L,34140L,
-     34141L,34142L,34143L,34144L,34145L,34146L,34146L,34147L,
-     34148L,34149L,34150L,34151L,34151L,34152L,34153L,34154L,
-     34155L,34156L,34157L,34157L,34158L,34159L,34160L,34161L,
-     34162L,34163L,34163L,34164L,34165L,34166L,34167L,34168L,
-     34169L,34169L,34170L,34171L,34172L,34173L,34174L,34175L,
-     34175L,34176L,34177L,34178L,34179L,34180L,34181L,34181L,
-     34182L,34183L,34184L,34185L,34186L,34186L,34187L,34188L,
-     34189L,34190L,34191L,34192L,34192L,34193L,34194L,34195L,
-     34196L,34197L,34198L,34198L,34199L,34200L,34201L,34202L,
-     34203L,34204L,34204L,34205L,34206L,34207L,34208L,34209L,
-     34210L,34210L,34211L,34212L,34213L,34214L,34215L,34215L,
-     34216L,34217L,34218L,34219L,34220L,34221L,34221L,34222L,
-     34223L,34224L,34225L,34226L,34227L,34227L,34228L,34229L,
-     34230L,34231L,34232L,34233L,34233L,34234L,34235L,34236L,
-     34237L,34238L,34239L,34239L,34240L,34241L,34242L,34243L,
-     34244L,34244L,34245L,34246L,34247L,34248L,34249L,34250L,
-     34250L,34251L,34252L,34253L,34254L,34255L,34256L,34256L,
-     34257L,34258L,34259L,34260L,34261L,34262L,34262L,34263L,
-     34264L,34265L,34266L,34267L,34267L,34268L,34269L,34270L,
-     34271L,34272L,34273L,34273L,34274L,34275L,34276L,34277L,
-     34278L,34279L,34279L,34280L,34281L,34282L,34283L,34284L,
-     34285L,34285L,34286L,34287L,34288L,34289L,34290L,34291L,
-     34291L,34292L,34293L,34294L,34295L,34296L,34296L,34297L,
-     34298L,34299L,34300L,34301L,34302L,34302L,34303L,34304L,
-     34305L,34306L,34307L,34308L,34308L,34309L,34310L,34311L,
-     34312L,34313L,34314L,34314L,34315L,34316L,34317L,34318L,
-     34319L,34319L,34320L,34321L,34322L,34323L,34324L,34325L,
-     34325L,34326L,34327L,34328L,34329L,34330L,34331L,34331L,
-     34332L,34333L,34334L,34335L,34336L,34337L,34337L,34338L,
-     34339L,34340L,34341L,34342L,34342L,34343L,34344L,34345L,
-     34346L,34347L,34348L,34348L,34349L,34350L,34351L,34352L,
-     34353L,34354L,34354L,34355L,34356L,34357L,34358L,34359L,
-     34360L,34360L,34361L,34362L,34363L,34364L,34365L,34365L,
-     34366L,34367L,34368L,34369L,34370L,34371L,34371L,34372L,
-     34373L,34374L,34375L,34376L,34377L,34377L,34378L,34379L,
-     34380L,34381L,34382L,34383L,34383L,34384L,34385L,34386L,
-     34387L,34388L,34388L,34389L,34390L,34391L,34392L,34393L,
-     34394L,34394L,34395L,34396L,34397L,34398L,34399L,34400L,
-     34400L,34401L,34402L,34403L,34404L,34405L,34405L,34406L,
-     34407L,34408L,34409L,34410L,34411L,34411L,34412L,34413L,
-     34414L,34415L,34416L,34417L,34417L,34418L,34419L,34420L,
-     34421L,34422L,34423L,34423L,34424L,34425L,34426L,34427L,
-     34428L,34428L,34429L,34430L,34431L,34432L,34433L,34434L,
-     34434L,34435L,34436L,34437L,34438L,34439L,34440L,34440L,
-     34441L,34442L,34443L,34444L,34445L,34445L,34446L,34447L,
-     34448L,34449L,34450L,34451L,34451L,34452L,34453L,34454L,
-     34455L,34456L,34457L,34457L,34458L,34459L,34460L,34461L,
-     34462L,34462L,34463L,34464L,34465L,34466L,34467L,34468L,
-     34468L,34469L,34470L,34471L,34472L,34473L,34474L,34474L,
-     34475L,34476L,34477L,34478L,34479L,34480L,34480L,34481L,
-     34482L,34483L,34484L,34485L,34485L,34486L,34487L,34488L,
-     34489L,34490L,34491L,34491L,34492L,34493L,34494L,34495L,
-     34496L,34497L,34497L,34498L,34499L,34500L,34501L,34502L,
-     34502L,34503L,34504L,34505L,34506L,34507L,34508L,34508L,
-     34509L,34510L,34511L,34512L,34513L,34514L,34514L,34515L,
-     34516L,34517L,34518L,34519L,34519L,34520L,34521L,34522L,
-     34523L,34524L,34525L,34525L,34526L,34527L,34528L,34529L,
-     34530L,34531L,34531L,34532L,34533L,34534L,34535L,34536L,
-     34536L,34537L,34538L,34539L,34540L,34541L,34542L,34542L,
-     34543L,34544L,34545L,34546L,34547L,34548L,34548L,34549L,
-     34550L,34551L,34552L,34553L,34553L,34554L,34555L,34556L,
-     34557L,34558L,34559L,34559L,34560L,34561L,34562L,34563L,
-     34564L,34565L,34565L,34566L,34567L,34568L,34569L,34570L,
-     34570L,34571L,34572L,34573L,34574L,34575L,34576L,34576L,
-     34577L,34578L,34579L,34580L,34581L,34581L,34582L,34583L,
-     34584L,34585L,34586L,34587L,34587L,34588L,34589L,34590L,
-     34591L,34592L,34593L,34593L,34594L,34595L,34596L,34597L,
-     34598L,34598L,34599L,34600L,34601L,34602L,34603L,34604L,
-     34604L,34605L,34606L,34607L,34608L,34609L,34610L,34610L,
-     34611L,34612L,34613L,34614L,34615L,34615L,34616L,34617L,
-     34618L,34619L,34620L,34621L,34621L,34622L,34623L,34624L,
-     34625L,34626L,34627L,34627L,34628L,34629L,34630L,34631L,
-     34632L,34632L,34633L,34634L,34635L,34636L,34637L,34638L,
-     34638L,34639L,34640L,34641L,34642L,34643L,34643L,34644L,
-     34645L,34646L,34647L,34648L,34649L,34649L,34650L,34651L,
-     34652L,34653L,34654L,34655L,34655L,34656L,34657L,34658L,
-     34659L,34660L,34660L,34661L,34662L,34663L,34664L,34665L,
-     34666L,34666L,34667L,34668L,34669L,34670L,34671L,34671L,
-     34672L,34673L,34674L,34675L,34676L,34677L,34677L,34678L,
-     34679L,34680L,34681L,34682L,34683L,34683L,34684L,34685L,
-     34686L,34687L,34688L,34688L,34689L,34690L,34691L,34692L,
-     34693L,34694L,34694L,34695L,34696L,34697L,34698L,34699L,
-     34699L,34700L,34701L,34702L,34703L,34704L,34705L,34705L,
-     34706L,34707L,34708L,34709L,34710L,34711L,34711L,34712L,
-     34713L,34714L,34715L,34716L,34716L,34717L,34718L,34719L,
-     34720L,34721L,34722L,34722L,34723L,34724L,34725L,34726L,
-     34727L,34727L,34728L,34729L,34730L,34731L,34732L,34733L,
-     34733L,34734L,34735L,34736L,34737L,34738L,34739L,34739L,
-     34740L,34741L,34742L,34743L,34744L,34744L,34745L,34746L,
-     34747L,34748L,34749L,34750L,34750L,34751L,34752L,34753L,
-     34754L,34755L,34755L,34756L,34757L,34758L,34759L,34760L,
-     34761L,34761L,34762L,34763L,34764L,34765L,34766L,34766L,
-     34767L,34768L,34769L,34770L,34771L,34772L,34772L,34773L,
-     34774L,34775L,34776L,34777L,34778L,34778L,34779L,34780L,
-     34781L,34782L,34783L,34783L,34784L,34785L,34786L,34787L,
-     34788L,34789L,34789L,34790L,34791L,34792L,34793L,34794L,
-     34794L,34795L,34796L,34797L,34798L,34799L,34800L,34800L,
-     34801L,34802L,34803L,34804L,34805L,34805L,34806L,34807L,
-     34808L,34809L,34810L,34811L,34811L,34812L,34813L,34814L,
-     34815L,34816L,34816L,34817L,34818L,34819L,34820L,34821L,
-     34822L,34822L,34823L,34824L,34825L,34826L,34827L,34827L,
-     34828L,34829L,34830L,34831L,34832L,34833L,34833L,34834L,
-     34835L,34836L,34837L,34838L,34839L,34839L,34840L,34841L,
-     34842L,34843L,34844L,34844L,34845L,34846L,34847L,34848L,
-     34849L,34850L,34850L,34851L,34852L,34853L,34854L,34855L,
-     34855L,34856L,34857L,34858L,34859L,34860L,34861L,34861L,
-     34862L,34863L,34864L,34865L,34866L,34866L,34867L,34868L,
-     34869L,34870L,34871L,34872L,34872L,34873L,34874L,34875L,
-     34876L,34877L,34877L,34878L,34879L,34880L,34881L,34882L,
-     34883L,34883L,34884L,34885L,34886L,34887L,34888L,34888L,
-     34889L,34890L,34891L,34892L,34893L,34894L,34894L,34895L,
-     34896L,34897L,34898L,34899L,34899L,34900L,34901L,34902L,
-     34903L,34904L,34905L,34905L,34906L,34907L,34908L,34909L,
-     34910L,34910L,34911L,34912L,34913L,34914L,34915L,34916L,
-     34916L,34917L,34918L,34919L,34920L,34921L,34921L,34922L,
-     34923L,34924L,34925L,34926L,34927L,34927L,34928L,34929L,
-     34930L,34931L,34932L,34932L,34933L,34934L,34935L,34936L,
-     34937L,34938L,34938L,34939L,34940L,34941L,34942L,34943L,
-     34943L,34944L,34945L,34946L,34947L,34948L,34949L,34949L,
-     34950L,34951L,34952L,34953L,34954L,34954L,34955L,34956L,
-     34957L,34958L,34959L,34960L,34960L,34961L,34962L,34963L,
-     34964L,34965L,34965L,34966L,34967L,34968L,34969L,34970L,
-     34971L,34971L,34972L,34973L,34974L,34975L,34976L,34976L,
-     34977L,34978L,34979L,34980L,34981L,34982L,34982L,34983L,
-     34984L,34985L,34986L,34987L,34987L,34988L,34989L,34990L,
-     34991L,34992L,34993L,34993L,34994L,34995L,34996L,34997L,
-     34998L,34998L,34999L,35000L,35001L,35002L,35003L,35004L,
-     35004L,35005L,35006L,35007L,35008L,35009L,35009L,35010L,
-     35011L,35012L,35013L,35014L,35015L,35015L,35016L,35017L,
-     35018L,35019L,35020L,35020L,35021L,35022L,35023L,35024L,
-     35025L,35025L,35026L,35027L,35028L,35029L,35030L,35031L,
-     35031L,35032L,35033L,35034L,35035L,35036L,35036L,35037L,
-     35038L,35039L,35040L,35041L,35042L,35042L,35043L,35044L,
-     35045L,35046L,35047L,35047L,35048L,35049L,35050L,35051L,
-     35052L,35053L,35053L,35054L,35055L,35056L,35057L,35058L,
-     35058L,35059L,35060L,35061L,35062L,35063L,35064L,35064L,
-     35065L,35066L,35067L,35068L,35069L,35069L,35070L,35071L,
-     35072L,35073L,35074L,35075L,35075L,35076L,35077L,35078L,
-     35079L,35080L,35080L,35081L,35082L,35083L,35084L,35085L,
-     35085L,35086L,35087L,35088L,35089L,35090L,35091L,35091L,
-     35092L,35093L,35094L,35095L,35096L,35096L,35097L,35098L,
-     35099L,35100L,35101L,35102L,35102L,35103L,35104L,35105L,
-     35106L,35107L,35107L,35108L,35109L,35110L,35111L,35112L,
-     35113L,35113L,35114L,35115L,35116L,35117L,35118L,35118L,
-     35119L,35120L,35121L,35122L,35123L,35123L,35124L,35125L,
-     35126L,35127L,35128L,35129L,35129L,35130L,35131L,35132L,
-     35133L,35134L,35134L,35135L,35136L,35137L,35138L,35139L,
-     35140L,35140L,35141L,35142L,35143L,35144L,35145L,35145L,
-     35146L,35147L,35148L,35149L,35150L,35150L,35151L,35152L,
-     35153L,35154L,35155L,35156L,35156L,35157L,35158L,35159L,
-     35160L,35161L,35161L,35162L,35163L,35164L,35165L,35166L,
-     35167L,35167L,35168L,35169L,35170L,35171L,35172L,35172L,
-     35173L,35174L,35175L,35176L,35177L,35177L,35178L,35179L,
-     35180L,35181L,35182L,35183L,35183L,35184L,35185L,35186L,
-     35187L,35188L,35188L,35189L,35190L,35191L,35192L,35193L,
-     35194L,35194L,35195L,35196L,35197L,35198L,35199L,35199L,
-     35200L,35201L,35202L,35203L,35204L,35204L,35205L,35206L,
-     35207L,35208L,35209L,35210L,35210L,35211L,35212L,35213L,
-     35214L,35215L,35215L,35216L,35217L,35218L,35219L,35220L,
-     35221L,35221L,35222L,35223L,35224L,35225L,35226L,35226L,
-     35227L,35228L,35229L,35230L,35231L,35231L,35232L,35233L,
-     35234L,35235L,35236L,35237L,35237L,35238L,35239L,35240L,
-     35241L,35242L,35242L,35243L,35244L,35245L,35246L,35247L,
-     35247L,35248L,35249L,35250L,35251L,35252L,35253L,35253L,
-     35254L,35255L,35256L,35257L,35258L,35258L,35259L,35260L,
-     35261L,35262L,35263L,35264L,35264L,35265L,35266L,35267L,
-     35268L,35269L,35269L,35270L,35271L,35272L,35273L,35274L,
-     35274L,35275L,35276L,35277L,35278L,35279L,35280L,35280L,
-     35281L,35282L,35283L,35284L,35285L,35285L,35286L,35287L,
-     35288L,35289L,35290L,35290L,35291L,35292L,35293L,35294L,
-     35295L,35296L,35296L,35297L,35298L,35299L,35300L,35301L,
-     35301L,35302L,35303L,35304L,35305L,35306L,35306L,35307L,
-     35308L,35309L,35310L,35311L,35312L,35312L,35313L,35314L,
-     35315L,35316L,35317L,35317L,35318L,35319L,35320L,35321L,
-     35322L,35322L,35323L,35324L,35325L,35326L,35327L,35328L,
-     35328L,35329L,35330L,35331L,35332L,35333L,35333L,35334L,
-     35335L,35336L,35337L,35338L,35339L,35339L,35340L,35341L,
-     35342L,35343L,35344L,35344L,35345L,35346L,35347L,35348L,
-     35349L,35349L,35350L,35351L,35352L,35353L,35354L,35355L,
-     35355L,35356L,35357L,35358L,35359L,35360L,35360L,35361L,
-     35362L,35363L,35364L,35365L,35365L,35366L,35367L,35368L,
-     35369L,35370L,35370L,35371L,35372L,35373L,35374L,35375L,
-     35376L,35376L,35377L,35378L,35379L,35380L,35381L,35381L,
-     35382L,35383L,35384L,35385L,35386L,35386L,35387L,35388L,
-     35389L,35390L,35391L,35392L,35392L,35393L,35394L,35395L,
-     35396L,35397L,35397L,35398L,35399L,35400L,35401L,35402L,
-     35402L,35403L,35404L,35405L,35406L,35407L,35408L,35408L,
-     35409L,35410L,35411L,35412L,35413L,35413L,35414L,35415L,
-     35416L,35417L,35418L,35418L,35419L,35420L,35421L,35422L,
-     35423L,35424L,35424L,35425L,35426L,35427L,35428L,35429L,
-     35429L,35430L,35431L,35432L,35433L,35434L,35434L,35435L,
-     35436L,35437L,35438L,35439L,35440L,35440L,35441L,35442L,
-     35443L,35444L,35445L,35445L,35446L,35447L,35448L,35449L,
-     35450L,35450L,35451L,35452L,35453L,35454L,35455L,35455L,
-     35456L,35457L,35458L,35459L,35460L,35461L,35461L,35462L,
-     35463L,35464L,35465L,35466L,35466L,35467L,35468L,35469L,
-     35470L,35471L,35471L,35472L,35473L,35474L,35475L,35476L,
-     35477L,35477L,35478L,35479L,35480L,35481L,35482L,35482L,
-     35483L,35484L,35485L,35486L,35487L,35487L,35488L,35489L,
-     35490L,35491L,35492L,35492L,35493L,35494L,35495L,35496L,
-     35497L,35498L,35498L,35499L,35500L,35501L,35502L,35503L,
-     35503L,35504L,35505L,35506L,35507L,35508L,35508L,35509L,
-     35510L,35511L,35512L,35513L,35513L,35514L,35515L,35516L,
-     35517L,35518L,35519L,35519L,35520L,35521L,35522L,35523L,
-     35524L,35524L,35525L,35526L,35527L,35528L,35529L,35529L,
-     35530L,35531L,35532L,35533L,35534L,35535L,35535L,35536L,
-     35537L,35538L,35539L,35540L,35540L,35541L,35542L,35543L,
-     35544L,35545L,35545L,35546L,35547L,35548L,35549L,35550L,
-     35550L,35551L,35552L,35553L,35554L,35555L,35556L,35556L,
-     35557L,35558L,35559L,35560L,35561L,35561L,35562L,35563L,
-     35564L,35565L,35566L,35566L,35567L,35568L,35569L,35570L,
-     35571L,35571L,35572L,35573L,35574L,35575L,35576L,35577L,
-     35577L,35578L,35579L,35580L,35581L,35582L,35582L,35583L,
-     35584L,35585L,35586L,35587L,35587L,35588L,35589L,35590L,
-     35591L,35592L,35592L,35593L,35594L,35595L,35596L,35597L,
-     35597L,35598L,35599L,35600L,35601L,35602L,35603L,35603L,
-     35604L,35605L,35606L,35607L,35608L,35608L,35609L,35610L,
-     35611L,35612L,35613L,35613L,35614L,35615L,35616L,35617L,
-     35618L,35618L,35619L,35620L,35621L,35622L,35623L,35624L,
-     35624L,35625L,35626L,35627L,35628L,35629L,35629L,35630L,
-     35631L,35632L,35633L,35634L,35634L,35635L,35636L,35637L,
-     35638L,35639L,35639L,35640L,35641L,35642L,35643L,35644L,
-     35645L,35645L,35646L,35647L,35648L,35649L,35650L,35650L,
-     35651L,35652L,35653L,35654L,35655L,35655L,35656L,35657L,
-     35658L,35659L,35660L,35660L,35661L,35662L,35663L,35664L,
-     35665L,35665L,35666L,35667L,35668L,35669L,35670L,35671L,
-     35671L,35672L,35673L,35674L,35675L,35676L,35676L,35677L,
-     35678L,35679L,35680L,35681L,35681L,35682L,35683L,35684L,
-     35685L,35686L,35686L,35687L,35688L,35689L,35690L,35691L,
-     35691L,35692L,35693L,35694L,35695L,35696L,35697L,35697L,
-     35698L,35699L,35700L,35701L,35702L,35702L,35703L,35704L,
-     35705L,35706L,35707L,35707L,35708L,35709L,35710L,35711L,
-     35712L,35712L,35713L,35714L,35715L,35716L,35717L,35717L,
-     35718L,35719L,35720L,35721L,35722L,35723L,35723L,35724L,
-     35725L,35726L,35727L,35728L,35728L,35729L,35730L,35731L,
-     35732L,35733L,35733L,35734L,35735L,35736L,35737L,35738L,
-     35738L,35739L,35740L,35741L,35742L,35743L,35743L,35744L,
-     35745L,35746L,35747L,35748L,35748L,35749L,35750L,35751L,
-     35752L,35753L,35754L,35754L,35755L,35756L,35757L,35758L,
-     35759L,35759L,35760L,35761L,35762L,35763L,35764L,35764L,
-     35765L,35766L,35767L,35768L,35769L,35769L,35770L,35771L,
-     35772L,35773L,35774L,35774L,35775L,35776L,35777L,35778L,
-     35779L,35779L,35780L,35781L,35782L,35783L,35784L,35785L,
-     35785L,35786L,35787L,35788L,35789L,35790L,35790L,35791L,
-     35792L,35793L,35794L,35795L,35795L,35796L,35797L,35798L,
-     35799L,35800L,35800L,35801L,35802L,35803L,35804L,35805L,
-     35805L,35806L,35807L,35808L,35809L,35810L,35810L,35811L,
-     35812L,35813L,35814L,35815L,35816L,35816L,35817L,35818L,
-     35819L,35820L,35821L,35821L,35822L,35823L,35824L,35825L,
-     35826L,35826L,35827L,35828L,35829L,35830L,35831L,35831L,
-     35832L,35833L,35834L,35835L,35836L,35836L,35837L,35838L,
-     35839L,35840L,35841L,35841L,35842L,35843L,35844L,35845L,
-     35846L,35846L,35847L,35848L,35849L,35850L,35851L,35852L,
-     35852L,35853L,35854L,35855L,35856L,35857L,35857L,35858L,
-     35859L,35860L,35861L,35862L,35862L,35863L,35864L,35865L,
-     35866L,35867L,35867L,35868L,35869L,35870L,35871L,35872L,
-     35872L,35873L,35874L,35875L,35876L,35877L,35877L,35878L,
-     35879L,35880L,35881L,35882L,35882L,35883L,35884L,35885L,
-     35886L,35887L,35888L,35888L,35889L,35890L,35891L,35892L,
-     35893L,35893L,35894L,35895L,35896L,35897L,35898L,35898L,
-     35899L,35900L,35901L,35902L,35903L,35903L,35904L,35905L,
-     35906L,35907L,35908L,35908L,35909L,35910L,35911L,35912L,
-     35913L,35913L,35914L,35915L,35916L,35917L,35918L,35918L,
-     35919L,35920L,35921L,35922L,35923L,35923L,35924L,35925L,
-     35926L,35927L,35928L,35928L,35929L,35930L,35931L,35932L,
-     35933L,35934L,35934L,35935L,35936L,35937L,35938L,35939L,
-     35939L,35940L,35941L,35942L,35943L,35944L,35944L,35945L,
-     35946L,35947L,35948L,35949L,35949L,35950L,35951L,35952L,
-     35953L,35954L,35954L,35955L,35956L,35957L,35958L,35959L,
-     35959L,35960L,35961L,35962L,35963L,35964L,35964L,35965L,
-     35966L,35967L,35968L,35969L,35969L,35970L,35971L,35972L,
-     35973L,35974L,35974L,35975L,35976L,35977L,35978L,35979L,
-     35979L,35980L,35981L,35982L,35983L,35984L,35985L,35985L,
-     35986L,35987L,35988L,35989L,35990L,35990L,35991L,35992L,
-     35993L,35994L,35995L,35995L,35996L,35997L,35998L,35999L,
-     36000L,36000L,36001L,36002L,36003L,36004L,36005L,36005L,
-     36006L,36007L,36008L,36009L,36010L,36010L,36011L,36012L,
-     36013L,36014L,36015L,36015L,36016L,36017L,36018L,36019L,
-     36020L,36020L,36021L,36022L,36023L,36024L,36025L,36025L,
-     36026L,36027L,36028L,36029L,36030L,36030L,36031L,36032L,
-     36033L,36034L,36035L,36035L,36036L,36037L,36038L,36039L,
-     36040L,36040L,36041L,36042L,36043L,36044L,36045L,36046L,
-     36046L,36047L,36048L,36049L,36050L,36051L,36051L,36052L,
-     36053L,36054L,36055L,36056L,36056L,36057L,36058L,36059L,
-     36060L,36061L,36061L,36062L,36063L,36064L,36065L,36066L,
-     36066L,36067L,36068L,36069L,36070L,36071L,36071L,36072L,
-     36073L,36074L,36075L,36076L,36076L,36077L,36078L,36079L,
-     36080L,36081L,36081L,36082L,36083L,36084L,36085L,36086L,
-     36086L,36087L,36088L,36089L,36090L,36091L,36091L,36092L,
-     36093L,36094L,36095L,36096L,36096L,36097L,36098L,36099L,
-     36100L,36101L,36101L,36102L,36103L,36104L,36105L,36106L,
-     36106L,36107L,36108L,36109L,36110L,36111L,36111L,36112L,
-     36113L,36114L,36115L,36116L,36116L,36117L,36118L,36119L,
-     36120L,36121L,36121L,36122L,36123L,36124L,36125L,36126L,
-     36126L,36127L,36128L,36129L,36130L,36131L,36131L,36132L,
-     36133L,36134L,36135L,36136L,36136L,36137L,36138L,36139L,
-     36140L,36141L,36141L,36142L,36143L,36144L,36145L,36146L,
-     36146L,36147L,36148L,36149L,36150L,36151L,36151L,36152L,
-     36153L,36154L,36155L,36156L,36157L,36157L,36158L,36159L,
-     36160L,36161L,36162L,36162L,36163L,36164L,36165L,36166L,
-     36167L,36167L,36168L,36169L,36170L,36171L,36172L,36172L,
-     36173L,36174L,36175L,36176L,36177L,36177L,36178L,36179L,
-     36180L,36181L,36182L,36182L,36183L,36184L,36185L,36186L,
-     36187L,36187L,36188L,36189L,36190L,36191L,36192L,36192L,
-     36193L,36194L,36195L,36196L,36197L,36197L,36198L,36199L,
-     36200L,36201L,36202L,36202L,36203L,36204L,36205L,36206L,
-     36207L,36207L,36208L,36209L,36210L,36211L,36212L,36212L,
-     36213L,36214L,36215L,36216L,36217L,36217L,36218L,36219L,
-     36220L,36221L,36222L,36222L,36223L,36224L,36225L,36226L,
-     36227L,36227L,36228L,36229L,36230L,36231L,36232L,36232L,
-     36233L,36234L,36235L,36236L,36237L,36237L,36238L,36239L,
-     36240L,36241L,36242L,36242L,36243L,36244L,36245L,36246L,
-     36247L,36247L,36248L,36249L,36250L,36251L,36252L,36252L,
-     36253L,36254L,36255L,36256L,36257L,36257L,36258L,36259L,
-     36260L,36261L,36262L,36262L,36263L,36264L,36265L,36266L,
-     36267L,36267L,36268L,36269L,36270L,36271L,36272L,36272L,
-     36273L,36274L,36275L,36276L,36277L,36277L,36278L,36279L,
-     36280L,36281L,36282L,36282L,36283L,36284L,36285L,36286L,
-     36287L,36287L,36288L,36289L,36290L,36291L,36292L,36292L,
-     36293L,36294L,36295L,36296L,36297L,36297L,36298L,36299L,
-     36300L,36301L,36301L,36302L,36303L,36304L,36305L,36306L,
-     36306L,36307L,36308L,36309L,36310L,36311L,36311L,36312L,
-     36313L,36314L,36315L,36316L,36316L,36317L,36318L,36319L,
-     36320L,36321L,36321L,36322L,36323L,36324L,36325L,36326L,
-     36326L,36327L,36328L,36329L,36330L,36331L,36331L,36332L,
-     36333L,36334L,36335L,36336L,36336L,36337L,36338L,36339L,
-     36340L,36341L,36341L,36342L,36343L,36344L,36345L,36346L,
-     36346L,36347L,36348L,36349L,36350L,36351L,36351L,36352L,
-     36353L,36354L,36355L,36356L,36356L,36357L,36358L,36359L,
-     36360L,36361L,36361L,36362L,36363L,36364L,36365L,36366L,
-     36366L,36367L,36368L,36369L,36370L,36371L,36371L,36372L,
-     36373L,36374L,36375L,36376L,36376L,36377L,36378L,36379L,
-     36380L,36381L,36381L,36382L,36383L,36384L,36385L,36386L,
-     36386L,36387L,36388L,36389L,36390L,36391L,36391L,36392L,
-     36393L,36394L,36395L,36396L,36396L,36397L,36398L,36399L,
-     36400L,36401L,36401L,36402L,36403L,36404L,36405L,36406L,
-     36406L,36407L,36408L,36409L,36410L,36410L,36411L,36412L,
-     36413L,36414L,36415L,36415L,36416L,36417L,36418L,36419L,
-     36420L,36420L,36421L,36422L,36423L,36424L,36425L,36425L,
-     36426L,36427L,36428L,36429L,36430L,36430L,36431L,36432L,
-     36433L,36434L,36435L,36435L,36436L,36437L,36438L,36439L,
-     36440L,36440L,36441L,36442L,36443L,36444L,36445L,36445L,
-     36446L,36447L,36448L,36449L,36450L,36450L,36451L,36452L,
-     36453L,36454L,36455L,36455L,36456L,36457L,36458L,36459L,
-     36460L,36460L,36461L,36462L,36463L,36464L,36465L,36465L,
-     36466L,36467L,36468L,36469L,36470L,36470L,36471L,36472L,
-     36473L,36474L,36474L,36475L,36476L,36477L,36478L,36479L,
-     36479L,36480L,36481L,36482L,36483L,36484L,36484L,36485L,
-     36486L,36487L,36488L,36489L,36489L,36490L,36491L,36492L,
-     36493L,36494L,36494L,36495L,36496L,36497L,36498L,36499L,
-     36499L,36500L,36501L,36502L,36503L,36504L,36504L,36505L,
-     36506L,36507L,36508L,36509L,36509L,36510L,36511L,36512L,
-     36513L,36514L,36514L,36515L,36516L,36517L,36518L,36519L,
-     36519L,36520L,36521L,36522L,36523L,36523L,36524L,36525L,
-     36526L,36527L,36528L,36528L,36529L,36530L,36531L,36532L,
-     36533L,36533L,36534L,36535L,36536L,36537L,36538L,36538L,
-     36539L,36540L,36541L,36542L,36543L,36543L,36544L,36545L,
-     36546L,36547L,36548L,36548L,36549L,36550L,36551L,36552L,
-     36553L,36553L,36554L,36555L,36556L,36557L,36558L,36558L,
-     36559L,36560L,36561L,36562L,36563L,36563L,36564L,36565L,
-     36566L,36567L,36567L,36568L,36569L,36570L,36571L,36572L,
-     36572L,36573L,36574L,36575L,36576L,36577L,36577L,36578L,
-     36579L,36580L,36581L,36582L,36582L,36583L,36584L,36585L,
-     36586L,36587L,36587L,36588L,36589L,36590L,36591L,36592L,
-     36592L,36593L,36594L,36595L,36596L,36597L,36597L,36598L,
-     36599L,36600L,36601L,36602L,36602L,36603L,36604L,36605L,
-     36606L,36606L,36607L,36608L,36609L,36610L,36611L,36611L,
-     36612L,36613L,36614L,36615L,36616L,36616L,36617L,36618L,
-     36619L,36620L,36621L,36621L,36622L,36623L,36624L,36625L,
-     36626L,36626L,36627L,36628L,36629L,36630L,36631L,36631L,
-     36632L,36633L,36634L,36635L,36636L,36636L,36637L,36638L,
-     36639L,36640L,36640L,36641L,36642L,36643L,36644L,36645L,
-     36645L,36646L,36647L,36648L,36649L,36650L,36650L,36651L,
-     36652L,36653L,36654L,36655L,36655L,36656L,36657L,36658L,
-     36659L,36660L,36660L,36661L,36662L,36663L,36664L,36665L,
-     36665L,36666L,36667L,36668L,36669L,36669L,36670L,36671L,
-     36672L,36673L,36674L,36674L,36675L,36676L,36677L,36678L,
-     36679L,36679L,36680L,36681L,36682L,36683L,36684L,36684L,
-     36685L,36686L,36687L,36688L,36689L,36689L,36690L,36691L,
-     36692L,36693L,36694L,36694L,36695L,36696L,36697L,36698L,
-     36699L,36699L,36700L,36701L,36702L,36703L,36703L,36704L,
-     36705L,36706L,36707L,36708L,36708L,36709L,36710L,36711L,
-     36712L,36713L,36713L,36714L,36715L,36716L,36717L,36718L,
-     36718L,36719L,36720L,36721L,36722L,36723L,36723L,36724L,
-     36725L,36726L,36727L,36727L,36728L,36729L,36730L,36731L,
-     36732L,36732L,36733L,36734L,36735L,36736L,36737L,36737L,
-     36738L,36739L,36740L,36741L,36742L,36742L,36743L,36744L,
-     36745L,36746L,36747L,36747L,36748L,36749L,36750L,36751L,
-     36752L,36752L,36753L,36754L,36755L,36756L,36756L,36757L,
-     36758L,36759L,36760L,36761L,36761L,36762L,36763L,36764L,
-     36765L,36766L,36766L,36767L,36768L,36769L,36770L,36771L,
-     36771L,36772L,36773L,36774L,36775L,36776L,36776L,36777L,
-     36778L,36779L,36780L,36780L,36781L,36782L,36783L,36784L,
-     36785L,36785L,36786L,36787L,36788L,36789L,36790L,36790L,
-     36791L,36792L,36793L,36794L,36795L,36795L,36796L,36797L,
-     36798L,36799L,36800L,36800L,36801L,36802L,36803L,36804L,
-     36804L,36805L,36806L,36807L,36808L,36809L,36809L,36810L,
-     36811L,36812L,36813L,36814L,36814L,36815L,36816L,36817L,
-     36818L,36819L,36819L,36820L,36821L,36822L,36823L,36824L,
-     36824L,36825L,36826L,36827L,36828L,36828L,36829L,36830L,
-     36831L,36832L,36833L,36833L,36834L,36835L,36836L,36837L,
-     36838L,36838L,36839L,36840L,36841L,36842L,36843L,36843L,
-     36844L,36845L,36846L,36847L,36847L,36848L,36849L,36850L,
-     36851L,36852L,36852L,36853L,36854L,36855L,36856L,36857L,
-     36857L,36858L,36859L,36860L,36861L,36862L,36862L,36863L,
-     36864L,36865L,36866L,36867L,36867L,36868L,36869L,36870L,
-     36871L,36871L,36872L,36873L,36874L,36875L,36876L,36876L,
-     36877L,36878L,36879L,36880L,36881L,36881L,36882L,36883L,
-     36884L,36885L,36886L,36886L,36887L,36888L,36889L,36890L,
-     36890L,36891L,36892L,36893L,36894L,36895L,36895L,36896L,
-     36897L,36898L,36899L,36900L,36900L,36901L,36902L,36903L,
-     36904L,36905L,36905L,36906L,36907L,36908L,36909L,36909L,
-     36910L,36911L,36912L,36913L,36914L,36914L,36915L,36916L,
-     36917L,36918L,36919L,36919L,36920L,36921L,36922L,36923L,
-     36924L,36924L,36925L,36926L,36927L,36928L,36928L,36929L,
-     36930L,36931L,36932L,36933L,36933L,36934L,36935L,36936L,
-     36937L,36938L,36938L,36939L,36940L,36941L,36942L,36943L,
-     36943L,36944L,36945L,36946L,36947L,36947L,36948L,36949L,
-     36950L,36951L,36952L,36952L,36953L,36954L,36955L,36956L,
-     36957L,36957L,36958L,36959L,36960L,36961L,36962L,36962L,
-     36963L,36964L,36965L,36966L,36966L,36967L,36968L,36969L,
-     36970L,36971L,36971L,36972L,36973L,36974L,36975L,36976L,
-     36976L,36977L,36978L,36979L,36980L,36981L,36981L,36982L,
-     36983L,36984L,36985L,36985L,36986L,36987L,36988L,36989L,
-     36990L,36990L,36991L,36992L,36993L,36994L,36995L,36995L,
-     36996L,36997L,36998L,36999L,37000L,37000L,37001L,37002L,
-     37003L,37004L,37004L,37005L,37006L,37007L,37008L,37009L,
-     37009L,37010L,37011L,37012L,37013L,37014L,37014L,37015L,
-     37016L,37017L,37018L,37018L,37019L,37020L,37021L,37022L,
-     37023L,37023L,37024L,37025L,37026L,37027L,37028L,37028L,
-     37029L,37030L,37031L,37032L,37033L,37033L,37034L,37035L,
-     37036L,37037L,37037L,37038L,37039L,37040L,37041L,37042L,
-     37042L,37043L,37044L,37045L,37046L,37047L,37047L,37048L,
-     37049L,37050L,37051L,37051L,37052L,37053L,37054L,37055L,
-     37056L,37056L,37057L,37058L,37059L,37060L,37061L,37061L,
-     37062L,37063L,37064L,37065L,37066L,37066L,37067L,37068L,
-     37069L,37070L,37070L,37071L,37072L,37073L,37074L,37075L,
-     37075L,37076L,37077L,37078L,37079L,37080L,37080L,37081L,
-     37082L,37083L,37084L,37084L,37085L,37086L,37087L,37088L,
-     37089L,37089L,37090L,37091L,37092L,37093L,37094L,37094L,
-     37095L,37096L,37097L,37098L,37098L,37099L,37100L,37101L,
-     37102L,37103L,37103L,37104L,37105L,37106L,37107L,37108L,
-     37108L,37109L,37110L,37111L,37112L,37113L,37113L,37114L,
-     37115L,37116L,37117L,37117L,37118L,37119L,37120L,37121L,
-     37122L,37122L,37123L,37124L,37125L,37126L,37127L,37127L,
-     37128L,37129L,37130L,37131L,37131L,37132L,37133L,37134L,
-     37135L,37136L,37136L,37137L,37138L,37139L,37140L,37141L,
-     37141L,37142L,37143L,37144L,37145L,37145L,37146L,37147L,
-     37148L,37149L,37150L,37150L,37151L,37152L,37153L,37154L,
-     37155L,37155L,37156L,37157L,37158L,37159L,37159L,37160L,
-     37161L,37162L,37163L,37164L,37164L,37165L,37166L,37167L,
-     37168L,37169L,37169L,37170L,37171L,37172L,37173L,37173L,
-     37174L,37175L,37176L,37177L,37178L,37178L,37179L,37180L,
-     37181L,37182L,37183L,37183L,37184L,37185L,37186L,37187L,
-     37187L,37188L,37189L,37190L,37191L,37192L,37192L,37193L,
-     37194L,37195L,37196L,37197L,37197L,37198L,37199L,37200L,
-     37201L,37201L,37202L,37203L,37204L,37205L,37206L,37206L,
-     37207L,37208L,37209L,37210L,37211L,37211L,37212L,37213L,
-     37214L,37215L,37215L,37216L,37217L,37218L,37219L,37220L,
-     37220L,37221L,37222L,37223L,37224L,37225L,37225L,37226L,
-     37227L,37228L,37229L,37229L,37230L,37231L,37232L,37233L,
-     37234L,37234L,37235L,37236L,37237L,37238L,37239L,37239L,
-     37240L,37241L,37242L,37243L,37243L,37244L,37245L,37246L,
-     37247L,37248L,37248L,37249L,37250L,37251L,37252L,37252L,
-     37253L,37254L,37255L,37256L,37257L,37257L,37258L,37259L,
-     37260L,37261L,37262L,37262L,37263L,37264L,37265L,37266L,
-     37266L,37267L,37268L,37269L,37270L,37271L,37271L,37272L,
-     37273L,37274L,37275L,37276L,37276L,37277L,37278L,37279L,
-     37280L,37280L,37281L,37282L,37283L,37284L,37285L,37285L,
-     37286L,37287L,37288L,37289L,37290L,37290L,37291L,37292L,
-     37293L,37294L,37294L,37295L,37296L,37297L,37298L,37299L,
-     37299L,37300L,37301L,37302L,37303L,37303L,37304L,37305L,
-     37306L,37307L,37308L,37308L,37309L,37310L,37311L,37312L,
-     37313L,37313L,37314L,37315L,37316L,37317L,37317L,37318L,
-     37319L,37320L,37321L,37322L,37322L,37323L,37324L,37325L,
-     37326L,37327L,37327L,37328L,37329L,37330L,37331L,37331L,
-     37332L,37333L,37334L,37335L,37336L,37336L,37337L,37338L,
-     37339L,37340L,37340L,37341L,37342L,37343L,37344L,37345L,
-     37345L,37346L,37347L,37348L,37349L,37350L,37350L,37351L,
-     37352L,37353L,37354L,37354L,37355L,37356L,37357L,37358L,
-     37359L,37359L,37360L,37361L,37362L,37363L,37363L,37364L,
-     37365L,37366L,37367L,37368L,37368L,37369L,37370L,37371L,
-     37372L,37373L,37373L,37374L,37375L,37376L,37377L,37377L,
-     37378L,37379L,37380L,37381L,37382L,37382L,37383L,37384L,
-     37385L,37386L,37386L,37387L,37388L,37389L,37390L,37391L,
-     37391L,37392L,37393L,37394L,37395L,37396L,37396L,37397L,
-     37398L,37399L,37400L,37400L,37401L,37402L,37403L,37404L,
-     37405L,37405L,37406L,37407L,37408L,37409L,37409L,37410L,
-     37411L,37412L,37413L,37414L,37414L,37415L,37416L,37417L,
-     37418L,37419L,37419L,37420L,37421L,37422L,37423L,37423L,
-     37424L,37425L,37426L,37427L,37428L,37428L,37429L,37430L,
-     37431L,37432L,37432L,37433L,37434L,37435L,37436L,37437L,
-     37437L,37438L,37439L,37440L,37441L,37441L,37442L,37443L,
-     37444L,37445L,37446L,37446L,37447L,37448L,37449L,37450L,
-     37451L,37451L,37452L,37453L,37454L,37455L,37455L,37456L,
-     37457L,37458L,37459L,37460L,37460L,37461L,37462L,37463L,
-     37464L,37464L,37465L,37466L,37467L,37468L,37469L,37469L,
-     37470L,37471L,37472L,37473L,37473L,37474L,37475L,37476L,
-     37477L,37478L,37478L,37479L,37480L,37481L,37482L,37483L,
-     37483L,37484L,37485L,37486L,37487L,37487L,37488L,37489L,
-     37490L,37491L,37492L,37492L,37493L,37494L,37495L,37496L,
-     37496L,37497L,37498L,37499L,37500L,37501L,37501L,37502L,
-     37503L,37504L,37505L,37505L,37506L,37507L,37508L,37509L,
-     37510L,37510L,37511L,37512L,37513L,37514L,37515L,37515L,
-     37516L,37517L,37518L,37519L,37519L,37520L,37521L,37522L,
-     37523L,37524L,37524L,37525L,37526L,37527L,37528L,37528L,
-     37529L,37530L,37531L,37532L,37533L,37533L,37534L,37535L,
-     37536L,37537L,37537L,37538L,37539L,37540L,37541L,37542L,
-     37542L,37543L,37544L,37545L,37546L,37546L,37547L,37548L,
-     37549L,37550L,37551L,37551L,37552L,37553L,37554L,37555L,
-     37555L,37556L,37557L,37558L,37559L,37560L,37560L,37561L,
-     37562L,37563L,37564L,37565L,37565L,37566L,37567L,37568L,
-     37569L,37569L,37570L,37571L,37572L,37573L,37574L,37574L,
-     37575L,37576L,37577L,37578L,37578L,37579L,37580L,37581L,
-     37582L,37583L,37583L,37584L,37585L,37586L,37587L,37587L,
-     37588L,37589L,37590L,37591L,37592L,37592L,37593L,37594L,
-     37595L,37596L,37596L,37597L,37598L,37599L,37600L,37601L,
-     37601L,37602L,37603L,37604L,37605L,37605L,37606L,37607L,
-     37608L,37609L,37610L,37610L,37611L,37612L,37613L,37614L,
-     37614L,37615L,37616L,37617L,37618L,37619L,37619L,37620L,
-     37621L,37622L,37623L,37623L,37624L,37625L,37626L,37627L,
-     37628L,37628L,37629L,37630L,37631L,37632L,37632L,37633L,
-     37634L,37635L,37636L,37637L,37637L,37638L,37639L,37640L,
-     37641L,37641L,37642L,37643L,37644L,37645L,37646L,37646L,
-     37647L,37648L,37649L,37650L,37650L,37651L,37652L,37653L,
-     37654L,37655L,37655L,37656L,37657L,37658L,37659L,37660L,
-     37660L,37661L,37662L,37663L,37664L,37664L,37665L,37666L,
-     37667L,37668L,37669L,37669L,37670L,37671L,37672L,37673L,
-     37673L,37674L,37675L,37676L,37677L,37678L,37678L,37679L,
-     37680L,37681L,37682L,37682L,37683L,37684L,37685L,37686L,
-     37687L,37687L,37688L,37689L,37690L,37691L,37691L,37692L,
-     37693L,37694L,37695L,37696L,37696L,37697L,37698L,37699L,
-     37700L,37700L,37701L,37702L,37703L,37704L,37705L,37705L,
-     37706L,37707L,37708L,37709L,37709L,37710L,37711L,37712L,
-     37713L,37713L,37714L,37715L,37716L,37717L,37718L,37718L,
-     37719L,37720L,37721L,37722L,37722L,37723L,37724L,37725L,
-     37726L,37727L,37727L,37728L,37729L,37730L,37731L,37731L,
-     37732L,37733L,37734L,37735L,37736L,37736L,37737L,37738L,
-     37739L,37740L,37740L,37741L,37742L,37743L,37744L,37745L,
-     37745L,37746L,37747L,37748L,37749L,37749L,37750L,37751L,
-     37752L,37753L,37754L,37754L,37755L,37756L,37757L,37758L,
-     37758L,37759L,37760L,37761L,37762L,37763L,37763L,37764L,
-     37765L,37766L,37767L,37767L,37768L,37769L,37770L,37771L,
-     37772L,37772L,37773L,37774L,37775L,37776L,37776L,37777L,
-     37778L,37779L,37780L,37781L,37781L,37782L,37783L,37784L,
-     37785L,37785L,37786L,37787L,37788L,37789L,37790L,37790L,
-     37791L,37792L,37793L,37794L,37794L,37795L,37796L,37797L,
-     37798L,37799L,37799L,37800L,37801L,37802L,37803L,37803L,
-     37804L,37805L,37806L,37807L,37807L,37808L,37809L,37810L,
-     37811L,37812L,37812L,37813L,37814L,37815L,37816L,37816L,
-     37817L,37818L,37819L,37820L,37821L,37821L,37822L,37823L,
-     37824L,37825L,37825L,37826L,37827L,37828L,37829L,37830L,
-     37830L,37831L,37832L,37833L,37834L,37834L,37835L,37836L,
-     37837L,37838L,37839L,37839L,37840L,37841L,37842L,37843L,
-     37843L,37844L,37845L,37846L,37847L,37848L,37848L,37849L,
-     37850L,37851L,37852L,37852L,37853L,37854L,37855L,37856L,
-     37856L,37857L,37858L,37859L,37860L,37861L,37861L,37862L,
-     37863L,37864L,37865L,37865L,37866L,37867L,37868L,37869L,
-     37870L,37870L,37871L,37872L,37873L,37874L,37874L,37875L,
-     37876L,37877L,37878L,37879L,37879L,37880L,37881L,37882L,
-     37883L,37883L,37884L,37885L,37886L,37887L,37887L,37888L,
-     37889L,37890L,37891L,37892L,37892L,37893L,37894L,37895L,
-     37896L,37896L,37897L,37898L,37899L,37900L,37901L,37901L,
-     37902L,37903L,37904L,37905L,37905L,37906L,37907L,37908L,
-     37909L,37910L,37910L,37911L,37912L,37913L,37914L,37914L,
-     37915L,37916L,37917L,37918L,37918L,37919L,37920L,37921L,
-     37922L,37923L,37923L,37924L,37925L,37926L,37927L,37927L,
-     37928L,37929L,37930L,37931L,37932L,37932L,37933L,37934L,
-     37935L,37936L,37936L,37937L,37938L,37939L,37940L,37941L,
-     37941L,37942L,37943L,37944L,37945L,37945L,37946L,37947L,
-     37948L,37949L,37949L,37950L,37951L,37952L,37953L,37954L,
-     37954L,37955L,37956L,37957L,37958L,37958L,37959L,37960L,
-     37961L,37962L,37963L,37963L,37964L,37965L,37966L,37967L,
-     37967L,37968L,37969L,37970L,37971L,37971L,37972L,37973L,
-     37974L,37975L,37976L,37976L,37977L,37978L,37979L,37980L,
-     37980L,37981L,37982L,37983L,37984L,37985L,37985L,37986L,
-     37987L,37988L,37989L,37989L,37990L,37991L,37992L,37993L,
-     37993L,37994L,37995L,37996L,37997L,37998L,37998L,37999L,
-     38000L,38001L,38002L,38002L,38003L,38004L,38005L,38006L,
-     38007L,38007L,38008L,38009L,38010L,38011L,38011L,38012L,
-     38013L,38014L,38015L,38015L,38016L,38017L,38018L,38019L,
-     38020L,38020L,38021L,38022L,38023L,38024L,38024L,38025L,
-     38026L,38027L,38028L,38029L,38029L,38030L,38031L,38032L,
-     38033L,38033L,38034L,38035L,38036L,38037L,38037L,38038L,
-     38039L,38040L,38041L,38042L,38042L,38043L,38044L,38045L,
-     38046L,38046L,38047L,38048L,38049L,38050L,38051L,38051L,
-     38052L,38053L,38054L,38055L,38055L,38056L,38057L,38058L,
-     38059L,38059L,38060L,38061L,38062L,38063L,38064L,38064L,
-     38065L,38066L,38067L,38068L,38068L,38069L,38070L,38071L,
-     38072L,38072L,38073L,38074L,38075L,38076L,38077L,38077L,
-     38078L,38079L,38080L,38081L,38081L,38082L,38083L,38084L,
-     38085L,38086L,38086L,38087L,38088L,38089L,38090L,38090L,
-     38091L,38092L,38093L,38094L,38094L,38095L,38096L,38097L,
-     38098L,38099L,38099L,38100L,38101L,38102L,38103L,38103L,
-     38104L,38105L,38106L,38107L,38107L,38108L,38109L,38110L,
-     38111L,38112L,38112L,38113L,38114L,38115L,38116L,38116L,
-     38117L,38118L,38119L,38120L,38120L,38121L,38122L,38123L,
-     38124L,38125L,38125L,38126L,38127L,38128L,38129L,38129L,
-     38130L,38131L,38132L,38133L,38134L,38134L,38135L,38136L,
-     38137L,38138L,38138L,38139L,38140L,38141L,38142L,38142L,
-     38143L,38144L,38145L,38146L,38147L,38147L,38148L,38149L,
-     38150L,38151L,38151L,38152L,38153L,38154L,38155L,38155L,
-     38156L,38157L,38158L,38159L,38160L,38160L,38161L,38162L,
-     38163L,38164L,38164L,38165L,38166L,38167L,38168L,38168L,
-     38169L,38170L,38171L,38172L,38173L,38173L,38174L,38175L,
-     38176L,38177L,38177L,38178L,38179L,38180L,38181L,38181L,
-     38182L,38183L,38184L,38185L,38186L,38186L,38187L,38188L,
-     38189L,38190L,38190L,38191L,38192L,38193L,38194L,38194L,
-     38195L,38196L,38197L,38198L,38199L,38199L,38200L,38201L,
-     38202L,38203L,38203L,38204L,38205L,38206L,38207L,38207L,
-     38208L,38209L,38210L,38211L,38212L,38212L,38213L,38214L,
-     38215L,38216L,38216L,38217L,38218L,38219L,38220L,38220L,
-     38221L,38222L,38223L,38224L,38225L,38225L,38226L,38227L,
-     38228L,38229L,38229L,38230L,38231L,38232L,38233L,38233L,
-     38234L,38235L,38236L,38237L,38238L,38238L,38239L,38240L,
-     38241L,38242L,38242L,38243L,38244L,38245L,38246L,38246L,
-     38247L,38248L,38249L,38250L,38251L,38251L,38252L,38253L,
-     38254L,38255L,38255L,38256L,38257L,38258L,38259L,38259L,
-     38260L,38261L,38262L,38263L,38264L,38264L,38265L,38266L,
-     38267L,38268L,38268L,38269L,38270L,38271L,38272L,38272L,
-     38273L,38274L,38275L,38276L,38277L,38277L,38278L,38279L,
-     38280L,38281L,38281L,38282L,38283L,38284L,38285L,38285L,
-     38286L,38287L,38288L,38289L,38289L,38290L,38291L,38292L,
-     38293L,38294L,38294L,38295L,38296L,38297L,38298L,38298L,
-     38299L,38300L,38301L,38302L,38302L,38303L,38304L,38305L,
-     38306L,38307L,38307L,38308L,38309L,38310L,38311L,38311L,
-     38312L,38313L,38314L,38315L,38315L,38316L,38317L,38318L,
-     38319L,38320L,38320L,38321L,38322L,38323L,38324L,38324L,
-     38325L,38326L,38327L,38328L,38328L,38329L,38330L,38331L,
-     38332L,38332L,38333L,38334L,38335L,38336L,38337L,38337L,
-     38338L,38339L,38340L,38341L,38341L,38342L,38343L,38344L,
-     38345L,38345L,38346L,38347L,38348L,38349L,38350L,38350L,
-     38351L,38352L,38353L,38354L,38354L,38355L,38356L,38357L,
-     38358L,38358L,38359L,38360L,38361L,38362L,38363L,38363L,
-     38364L,38365L,38366L,38367L,38367L,38368L,38369L,38370L,
-     38371L,38371L,38372L,38373L,38374L,38375L,38375L,38376L,
-     38377L,38378L,38379L,38380L,38380L,38381L,38382L,38383L,
-     38384L,38384L,38385L,38386L,38387L,38388L,38388L,38389L,
-     38390L,38391L,38392L,38392L,38393L,38394L,38395L,38396L,
-     38397L,38397L,38398L,38399L,38400L,38401L,38401L,38402L,
-     38403L,38404L,38405L,38405L,38406L,38407L,38408L,38409L,
-     38410L,38410L,38411L,38412L,38413L,38414L,38414L,38415L,
-     38416L,38417L,38418L,38418L,38419L,38420L,38421L,38422L,
-     38422L,38423L,38424L,38425L,38426L,38427L,38427L,38428L,
-     38429L,38430L,38431L,38431L,38432L,38433L,38434L,38435L,
-     38435L,38436L,38437L,38438L,38439L,38439L,38440L,38441L,
-     38442L,38443L,38444L,38444L,38445L,38446L,38447L,38448L,
-     38448L,38449L,38450L,38451L,38452L,38452L,38453L,38454L,
-     38455L,38456L,38456L,38457L,38458L,38459L,38460L,38461L,
-     38461L,38462L,38463L,38464L,38465L,38465L,38466L,38467L,
-     38468L,38469L,38469L,38470L,38471L,38472L,38473L,38473L,
-     38474L,38475L,38476L,38477L,38478L,38478L,38479L,38480L,
-     38481L,38482L,38482L,38483L,38484L,38485L,38486L,38486L,
-     38487L,38488L,38489L,38490L,38490L,38491L,38492L,38493L,
-     38494L,38495L,38495L,38496L,38497L,38498L,38499L,38499L,
-     38500L,38501L,38502L,38503L,38503L,38504L,38505L,38506L,
-     38507L,38507L,38508L,38509L,38510L,38511L,38512L,38512L,
-     38513L,38514L,38515L,38516L,38516L,38517L,38518L,38519L,
-     38520L,38520L,38521L,38522L,38523L,38524L,38524L,38525L,
-     38526L,38527L,38528L,38529L,38529L,38530L,38531L,38532L,
-     38533L,38533L,38534L,38535L,38536L,38537L,38537L,38538L,
-     38539L,38540L,38541L,38541L,38542L,38543L,38544L,38545L,
-     38546L,38546L,38547L,38548L,38549L,38550L,38550L,38551L,
-     38552L,38553L,38554L,38554L,38555L,38556L,38557L,38558L,
-     38558L,38559L,38560L,38561L,38562L,38562L,38563L,38564L,
-     38565L,38566L,38567L,38567L,38568L,38569L,38570L,38571L,
-     38571L,38572L,38573L,38574L,38575L,38575L,38576L,38577L,
-     38578L,38579L,38579L,38580L,38581L,38582L,38583L,38584L,
-     38584L,38585L,38586L,38587L,38588L,38588L,38589L,38590L,
-     38591L,38592L,38592L,38593L,38594L,38595L,38596L,38596L,
-     38597L,38598L,38599L,38600L,38600L,38601L,38602L,38603L,
-     38604L,38605L,38605L,38606L,38607L,38608L,38609L,38609L,
-     38610L,38611L,38612L,38613L,38613L,38614L,38615L,38616L,
-     38617L,38617L,38618L,38619L,38620L,38621L,38621L,38622L,
-     38623L,38624L,38625L,38626L,38626L,38627L,38628L,38629L,
-     38630L,38630L,38631L,38632L,38633L,38634L,38634L,38635L,
-     38636L,38637L,38638L,38638L,38639L,38640L,38641L,38642L,
-     38642L,38643L,38644L,38645L,38646L,38647L,38647L,38648L,
-     38649L,38650L,38651L,38651L,38652L,38653L,38654L,38655L,
-     38655L,38656L,38657L,38658L,38659L,38659L,38660L,38661L,
-     38662L,38663L,38663L,38664L,38665L,38666L,38667L,38668L,
-     38668L,38669L,38670L,38671L,38672L,38672L,38673L,38674L,
-     38675L,38676L,38676L,38677L,38678L,38679L,38680L,38680L,
-     38681L,38682L,38683L,38684L,38684L,38685L,38686L,38687L,
-     38688L,38689L,38689L,38690L,38691L,38692L,38693L,38693L,
-     38694L,38695L,38696L,38697L,38697L,38698L,38699L,38700L,
-     38701L,38701L,38702L,38703L,38704L,38705L,38705L,38706L,
-     38707L,38708L,38709L,38709L,38710L,38711L,38712L,38713L,
-     38714L,38714L,38715L,38716L,38717L,38718L,38718L,38719L,
-     38720L,38721L,38722L,38722L,38723L,38724L,38725L,38726L,
-     38726L,38727L,38728L,38729L,38730L,38730L,38731L,38732L,
-     38733L,38734L,38735L,38735L,38736L,38737L,38738L,38739L,
-     38739L,38740L,38741L,38742L,38743L,38743L,38744L,38745L,
-     38746L,38747L,38747L,38748L,38749L,38750L,38751L,38751L,
-     38752L,38753L,38754L,38755L,38755L,38756L,38757L,38758L,
-     38759L,38760L,38760L,38761L,38762L,38763L,38764L,38764L,
-     38765L,38766L,38767L,38768L,38768L,38769L,38770L,38771L,
-     38772L,38772L,38773L,38774L,38775L,38776L,38776L,38777L,
-     38778L,38779L,38780L,38780L,38781L,38782L,38783L,38784L,
-     38785L,38785L,38786L,38787L,38788L,38789L,38789L,38790L,
-     38791L,38792L,38793L,38793L,38794L,38795L,38796L,38797L,
-     38797L,38798L,38799L,38800L,38801L,38801L,38802L,38803L,
-     38804L,38805L,38805L,38806L,38807L,38808L,38809L,38809L,
-     38810L,38811L,38812L,38813L,38814L,38814L,38815L,38816L,
-     38817L,38818L,38818L,38819L,38820L,38821L,38822L,38822L,
-     38823L,38824L,38825L,38826L,38826L,38827L,38828L,38829L,
-     38830L,38830L,38831L,38832L,38833L,38834L,38834L,38835L,
-     38836L,38837L,38838L,38838L,38839L,38840L,38841L,38842L,
-     38843L,38843L,38844L,38845L,38846L,38847L,38847L,38848L,
-     38849L,38850L,38851L,38851L,38852L,38853L,38854L,38855L,
-     38855L,38856L,38857L,38858L,38859L,38859L,38860L,38861L,
-     38862L,38863L,38863L,38864L,38865L,38866L,38867L,38867L,
-     38868L,38869L,38870L,38871L,38872L,38872L,38873L,38874L,
-     38875L,38876L,38876L,38877L,38878L,38879L,38880L,38880L,
-     38881L,38882L,38883L,38884L,38884L,38885L,38886L,38887L,
-     38888L,38888L,38889L,38890L,38891L,38892L,38892L,38893L,
-     38894L,38895L,38896L,38896L,38897L,38898L,38899L,38900L,
-     38900L,38901L,38902L,38903L,38904L,38905L,38905L,38906L,
-     38907L,38908L,38909L,38909L,38910L,38911L,38912L,38913L,
-     38913L,38914L,38915L,38916L,38917L,38917L,38918L,38919L,
-     38920L,38921L,38921L,38922L,38923L,38924L,38925L,38925L,
-     38926L,38927L,38928L,38929L,38929L,38930L,38931L,38932L,
-     38933L,38933L,38934L,38935L,38936L,38937L,38937L,38938L,
-     38939L,38940L,38941L,38942L,38942L,38943L,38944L,38945L,
-     38946L,38946L,38947L,38948L,38949L,38950L,38950L,38951L,
-     38952L,38953L,38954L,38954L,38955L,38956L,38957L,38958L,
-     38958L,38959L,38960L,38961L,38962L,38962L,38963L,38964L,
-     38965L,38966L,38966L,38967L,38968L,38969L,38970L,38970L,
-     38971L,38972L,38973L,38974L,38974L,38975L,38976L,38977L,
-     38978L,38979L,38979L,38980L,38981L,38982L,38983L,38983L,
-     38984L,38985L,38986L,38987L,38987L,38988L,38989L,38990L,
-     38991L,38991L,38992L,38993L,38994L,38995L,38995L,38996L,
-     38997L,38998L,38999L,38999L,39000L,39001L,39002L,39003L,
-     39003L,39004L,39005L,39006L,39007L,39007L,39008L,39009L,
-     39010L,39011L,39011L,39012L,39013L,39014L,39015L,39015L,
-     39016L,39017L,39018L,39019L,39019L,39020L,39021L,39022L,
-     39023L,39024L,39024L,39025L,39026L,39027L,39028L,39028L,
-     39029L,39030L,39031L,39032L,39032L,39033L,39034L,39035L,
-     39036L,39036L,39037L,39038L,39039L,39040L,39040L,39041L,
-     39042L,39043L,39044L,39044L,39045L,39046L,39047L,39048L,
-     39048L,39049L,39050L,39051L,39052L,39052L,39053L,39054L,
-     39055L,39056L,39056L,39057L,39058L,39059L,39060L,39060L,
-     39061L,39062L,39063L,39064L,39064L,39065L,39066L,39067L,
-     39068L,39068L,39069L,39070L,39071L,39072L,39072L,39073L,
-     39074L,39075L,39076L,39077L,39077L,39078L,39079L,39080L,
-     39081L,39081L,39082L,39083L,39084L,39085L,39085L,39086L,
-     39087L,39088L,39089L,39089L,39090L,39091L,39092L,39093L,
-     39093L,39094L,39095L,39096L,39097L,39097L,39098L,39099L,
-     39100L,39101L,39101L,39102L,39103L,39104L,39105L,39105L,
-     39106L,39107L,39108L,39109L,39109L,39110L,39111L,39112L,
-     39113L,39113L,39114L,39115L,39116L,39117L,39117L,39118L,
-     39119L,39120L,39121L,39121L,39122L,39123L,39124L,39125L,
-     39125L,39126L,39127L,39128L,39129L,39129L,39130L,39131L,
-     39132L,39133L,39133L,39134L,39135L,39136L,39137L,39137L,
-     39138L,39139L,39140L,39141L,39142L,39142L,39143L,39144L,
-     39145L,39146L,39146L,39147L,39148L,39149L,39150L,39150L,
-     39151L,39152L,39153L,39154L,39154L,39155L,39156L,39157L,
-     39158L,39158L,39159L,39160L,39161L,39162L,39162L,39163L,
-     39164L,39165L,39166L,39166L,39167L,39168L,39169L,39170L,
-     39170L,39171L,39172L,39173L,39174L,39174L,39175L,39176L,
-     39177L,39178L,39178L,39179L,39180L,39181L,39182L,39182L,
-     39183L,39184L,39185L,39186L,39186L,39187L,39188L,39189L,
-     39190L,39190L,39191L,39192L,39193L,39194L,39194L,39195L,
-     39196L,39197L,39198L,39198L,39199L,39200L,39201L,39202L,
-     39202L,39203L,39204L,39205L,39206L,39206L,39207L,39208L,
-     39209L,39210L,39210L,39211L,39212L,39213L,39214L,39214L,
-     39215L,39216L,39217L,39218L,39218L,39219L,39220L,39221L,
-     39222L,39222L,39223L,39224L,39225L,39226L,39226L,39227L,
-     39228L,39229L,39230L,39230L,39231L,39232L,39233L,39234L,
-     39234L,39235L,39236L,39237L,39238L,39238L,39239L,39240L,
-     39241L,39242L,39242L,39243L,39244L,39245L,39246L,39247L,
-     39247L,39248L,39249L,39250L,39251L,39251L,39252L,39253L,
-     39254L,39255L,39255L,39256L,39257L,39258L,39259L,39259L,
-     39260L,39261L,39262L,39263L,39263L,39264L,39265L,39266L,
-     39267L,39267L,39268L,39269L,39270L,39271L,39271L,39272L,
-     39273L,39274L,39275L,39275L,39276L,39277L,39278L,39279L,
-     39279L,39280L,39281L,39282L,39283L,39283L,39284L,39285L,
-     39286L,39287L,39287L,39288L,39289L,39290L,39291L,39291L,
-     39292L,39293L,39294L,39295L,39295L,39296L,39297L,39298L,
-     39299L,39299L,39300L,39301L,39302L,39303L,39303L,39304L,
-     39305L,39306L,39307L,39307L,39308L,39309L,39310L,39311L,
-     39311L,39312L,39313L,39314L,39315L,39315L,39316L,39317L,
-     39318L,39319L,39319L,39320L,39321L,39322L,39323L,39323L,
-     39324L,39325L,39326L,39327L,39327L,39328L,39329L,39330L,
-     39331L,39331L,39332L,39333L,39334L,39335L,39335L,39336L,
-     39337L,39338L,39339L,39339L,39340L,39341L,39342L,39343L,
-     39343L,39344L,39345L,39346L,39347L,39347L,39348L,39349L,
-     39350L,39351L,39351L,39352L,39353L,39354L,39355L,39355L,
-     39356L,39357L,39358L,39359L,39359L,39360L,39361L,39362L,
-     39363L,39363L,39364L,39365L,39366L,39367L,39367L,39368L,
-     39369L,39370L,39371L,39371L,39372L,39373L,39374L,39375L,
-     39375L,39376L,39377L,39378L,39379L,39379L,39380L,39381L,
-     39382L,39383L,39383L,39384L,39385L,39386L,39387L,39387L,
-     39388L,39389L,39390L,39391L,39391L,39392L,39393L,39394L,
-     39395L,39395L,39396L,39397L,39398L,39398L,39399L,39400L,
-     39401L,39402L,39402L,39403L,39404L,39405L,39406L,39406L,
-     39407L,39408L,39409L,39410L,39410L,39411L,39412L,39413L,
-     39414L,39414L,39415L,39416L,39417L,39418L,39418L,39419L,
-     39420L,39421L,39422L,39422L,39423L,39424L,39425L,39426L,
-     39426L,39427L,39428L,39429L,39430L,39430L,39431L,39432L,
-     39433L,39434L,39434L,39435L,39436L,39437L,39438L,39438L,
-     39439L,39440L,39441L,39442L,39442L,39443L,39444L,39445L,
-     39446L,39446L,39447L,39448L,39449L,39450L,39450L,39451L,
-     39452L,39453L,39454L,39454L,39455L,39456L,39457L,39458L,
-     39458L,39459L,39460L,39461L,39462L,39462L,39463L,39464L,
-     39465L,39466L,39466L,39467L,39468L,39469L,39470L,39470L,
-     39471L,39472L,39473L,39474L,39474L,39475L,39476L,39477L,
-     39478L,39478L,39479L,39480L,39481L,39482L,39482L,39483L,
-     39484L,39485L,39486L,39486L,39487L,39488L,39489L,39490L,
-     39490L,39491L,39492L,39493L,39494L,39494L,39495L,39496L,
-     39497L,39498L,39498L,39499L,39500L,39501L,39502L,39502L,
-     39503L,39504L,39505L,39505L,39506L,39507L,39508L,39509L,
-     39509L,39510L,39511L,39512L,39513L,39513L,39514L,39515L,
-     39516L,39517L,39517L,39518L,39519L,39520L,39521L,39521L,
-     39522L,39523L,39524L,39525L,39525L,39526L,39527L,39528L,
-     39529L,39529L,39530L,39531L,39532L,39533L,39533L,39534L,
-     39535L,39536L,39537L,39537L,39538L,39539L,39540L,39541L,
-     39541L,39542L,39543L,39544L,39545L,39545L,39546L,39547L,
-     39548L,39549L,39549L,39550L,39551L,39552L,39553L,39553L,
-     39554L,39555L,39556L,39557L,39557L,39558L,39559L,39560L,
-     39561L,39561L,39562L,39563L,39564L,39565L,39565L,39566L,
-     39567L,39568L,39569L,39569L,39570L,39571L,39572L,39572L,
-     39573L,39574L,39575L,39576L,39576L,39577L,39578L,39579L,
-     39580L,39580L,39581L,39582L,39583L,39584L,39584L,39585L,
-     39586L,39587L,39588L,39588L,39589L,39590L,39591L,39592L,
-     39592L,39593L,39594L,39595L,39596L,39596L,39597L,39598L,
-     39599L,39600L,39600L,39601L,39602L,39603L,39604L,39604L,
-     39605L,39606L,39607L,39608L,39608L,39609L,39610L,39611L,
-     39612L,39612L,39613L,39614L,39615L,39616L,39616L,39617L,
-     39618L,39619L,39620L,39620L,39621L,39622L,39623L,39623L,
-     39624L,39625L,39626L,39627L,39627L,39628L,39629L,39630L,
-     39631L,39631L,39632L,39633L,39634L,39635L,39635L,39636L,
-     39637L,39638L,39639L,39639L,39640L,39641L,39642L,39643L,
-     39643L,39644L,39645L,39646L,39647L,39647L,39648L,39649L,
-     39650L,39651L,39651L,39652L,39653L,39654L,39655L,39655L,
-     39656L,39657L,39658L,39659L,39659L,39660L,39661L,39662L,
-     39663L,39663L,39664L,39665L,39666L,39666L,39667L,39668L,
-     39669L,39670L,39670L,39671L,39672L,39673L,39674L,39674L,
-     39675L,39676L,39677L,39678L,39678L,39679L,39680L,39681L,
-     39682L,39682L,39683L,39684L,39685L,39686L,39686L,39687L,
-     39688L,39689L,39690L,39690L,39691L,39692L,39693L,39694L,
-     39694L,39695L,39696L,39697L,39698L,39698L,39699L,39700L,
-     39701L,39701L,39702L,39703L,39704L,39705L,39705L,39706L,
-     39707L,39708L,39709L,39709L,39710L,39711L,39712L,39713L,
-     39713L,39714L,39715L,39716L,39717L,39717L,39718L,39719L,
-     39720L,39721L,39721L,39722L,39723L,39724L,39725L,39725L,
-     39726L,39727L,39728L,39729L,39729L,39730L,39731L,39732L,
-     39733L,39733L,39734L,39735L,39736L,39736L,39737L,39738L,
-     39739L,39740L,39740L,39741L,39742L,39743L,39744L,39744L,
-     39745L,39746L,39747L,39748L,39748L,39749L,39750L,39751L,
-     39752L,39752L,39753L,39754L,39755L,39756L,39756L,39757L,
-     39758L,39759L,39760L,39760L,39761L,39762L,39763L,39764L,
-     39764L,39765L,39766L,39767L,39768L,39768L,39769L,39770L,
-     39771L,39771L,39772L,39773L,39774L,39775L,39775L,39776L,
-     39777L,39778L,39779L,39779L,39780L,39781L,39782L,39783L,
-     39783L,39784L,39785L,39786L,39787L,39787L,39788L,39789L,
-     39790L,39791L,39791L,39792L,39793L,39794L,39795L,39795L,
-     39796L,39797L,39798L,39798L,39799L,39800L,39801L,39802L,
-     39802L,39803L,39804L,39805L,39806L,39806L,39807L,39808L,
-     39809L,39810L,39810L,39811L,39812L,39813L,39814L,39814L,
-     39815L,39816L,39817L,39818L,39818L,39819L,39820L,39821L,
-     39822L,39822L,39823L,39824L,39825L,39826L,39826L,39827L,
-     39828L,39829L,39829L,39830L,39831L,39832L,39833L,39833L,
-     39834L,39835L,39836L,39837L,39837L,39838L,39839L,39840L,
-     39841L,39841L,39842L,39843L,39844L,39845L,39845L,39846L,
-     39847L,39848L,39849L,39849L,39850L,39851L,39852L,39853L,
-     39853L,39854L,39855L,39856L,39856L,39857L,39858L,39859L,
-     39860L,39860L,39861L,39862L,39863L,39864L,39864L,39865L,
-     39866L,39867L,39868L,39868L,39869L,39870L,39871L,39872L,
-     39872L,39873L,39874L,39875L,39876L,39876L,39877L,39878L,
-     39879L,39879L,39880L,39881L,39882L,39883L,39883L,39884L,
-     39885L,39886L,39887L,39887L,39888L,39889L,39890L,39891L,
-     39891L,39892L,39893L,39894L,39895L,39895L,39896L,39897L,
-     39898L,39899L,39899L,39900L,39901L,39902L,39902L,39903L,
-     39904L,39905L,39906L,39906L,39907L,39908L,39909L,39910L,
-     39910L,39911L,39912L,39913L,39914L,39914L,39915L,39916L,
-     39917L,39918L,39918L,39919L,39920L,39921L,39922L,39922L,
-     39923L,39924L,39925L,39925L,39926L,39927L,39928L,39929L,
-     39929L,39930L,39931L,39932L,39933L,39933L,39934L,39935L,
-     39936L,39937L,39937L,39938L,39939L,39940L,39941L,39941L,
-     39942L,39943L,39944L,39945L,39945L,39946L,39947L,39948L,
-     39948L,39949L,39950L,39951L,39952L,39952L,39953L,39954L,
-     39955L,39956L,39956L,39957L,39958L,39959L,39960L,39960L,
-     39961L,39962L,39963L,39964L,39964L,39965L,39966L,39967L,
-     39968L,39968L,39969L,39970L,39971L,39971L,39972L,39973L,
-     39974L,39975L,39975L,39976L,39977L,39978L,39979L,39979L,
-     39980L,39981L,39982L,39983L,39983L,39984L,39985L,39986L,
-     39987L,39987L,39988L,39989L,39990L,39990L,39991L,39992L,
-     39993L,39994L,39994L,39995L,39996L,39997L,39998L,39998L,
-     39999L,40000L,40001L,40002L,40002L,40003L,40004L,40005L,
-     40006L,40006L,40007L,40008L,40009L,40010L,40010L,40011L,
-     40012L,40013L,40013L,40014L,40015L,40016L,40017L,40017L,
-     40018L,40019L,40020L,40021L,40021L,40022L,40023L,40024L,
-     40025L,40025L,40026L,40027L,40028L,40029L,40029L,40030L,
-     40031L,40032L,40032L,40033L,40034L,40035L,40036L,40036L,
-     40037L,40038L,40039L,40040L,40040L,40041L,40042L,40043L,
-     40044L,40044L,40045L,40046L,40047L,40048L,40048L,40049L,
-     40050L,40051L,40051L,40052L,40053L,40054L,40055L,40055L,
-     40056L,40057L,40058L,40059L,40059L,40060L,40061L,40062L,
-     40063L,40063L,40064L,40065L,40066L,40067L,40067L,40068L,
-     40069L,40070L,40070L,40071L,40072L,40073L,40074L,40074L,
-     40075L,40076L,40077L,40078L,40078L,40079L,40080L,40081L,
-     40082L,40082L,40083L,40084L,40085L,40085L,40086L,40087L,
-     40088L,40089L,40089L,40090L,40091L,40092L,40093L,40093L,
-     40094L,40095L,40096L,40097L,40097L,40098L,40099L,40100L,
-     40101L,40101L,40102L,40103L,40104L,40104L,40105L,40106L,
-     40107L,40108L,40108L,40109L,40110L,40111L,40112L,40112L,
-     40113L,40114L,40115L,40116L,40116L,40117L,40118L,40119L,
-     40120L,40120L,40121L,40122L,40123L,40123L,40124L,40125L,
-     40126L,40127L,40127L,40128L,40129L,40130L,40131L,40131L,
-     40132L,40133L,40134L,40135L,40135L,40136L,40137L,40138L,
-     40138L,40139L,40140L,40141L,40142L,40142L,40143L,40144L,
-     40145L,40146L,40146L,40147L,40148L,40149L,40150L,40150L,
-     40151L,40152L,40153L,40153L,40154L,40155L,40156L,40157L,
-     40157L,40158L,40159L,40160L,40161L,40161L,40162L,40163L,
-     40164L,40165L,40165L,40166L,40167L,40168L,40169L,40169L,
-     40170L,40171L,40172L,40172L,40173L,40174L,40175L,40176L,
-     40176L,40177L,40178L,40179L,40180L,40180L,40181L,40182L,
-     40183L,40184L,40184L,40185L,40186L,40187L,40187L,40188L,
-     40189L,40190L,40191L,40191L,40192L,40193L,40194L,40195L,
-     40195L,40196L,40197L,40198L,40199L,40199L,40200L,40201L,
-     40202L,40202L,40203L,40204L,40205L,40206L,40206L,40207L,
-     40208L,40209L,40210L,40210L,40211L,40212L,40213L,40214L,
-     40214L,40215L,40216L,40217L,40217L,40218L,40219L,40220L,
-     40221L,40221L,40222L,40223L,40224L,40225L,40225L,40226L,
-     40227L,40228L,40229L,40229L,40230L,40231L,40232L,40232L,
-     40233L,40234L,40235L,40236L,40236L,40237L,40238L,40239L,
-     40240L,40240L,40241L,40242L,40243L,40244L,40244L,40245L,
-     40246L,40247L,40247L,40248L,40249L,40250L,40251L,40251L,
-     40252L,40253L,40254L,40255L,40255L,40256L,40257L,40258L,
-     40259L,40259L,40260L,40261L,40262L,40262L,40263L,40264L,
-     40265L,40266L,40266L,40267L,40268L,40269L,40270L,40270L,
-     40271L,40272L,40273L,40274L,40274L,40275L,40276L,40277L,
-     40277L,40278L,40279L,40280L,40281L,40281L,40282L,40283L,
-     40284L,40285L,40285L,40286L,40287L,40288L,40289L,40289L,
-     40290L,40291L,40292L,40292L,40293L,40294L,40295L,40296L,
-     40296L,40297L,40298L,40299L,40300L,40300L,40301L,40302L,
-     40303L,40303L,40304L,40305L,40306L,40307L,40307L,40308L,
-     40309L,40310L,40311L,40311L,40312L,40313L,40314L,40315L,
-     40315L,40316L,40317L,40318L,40318L,40319L,40320L,40321L,
-     40322L,40322L,40323L,40324L,40325L,40326L,40326L,40327L,
-     40328L,40329L,40330L,40330L,40331L,40332L,40333L,40333L,
-     40334L,40335L,40336L,40337L,40337L,40338L,40339L,40340L,
-     40341L,40341L,40342L,40343L,40344L,40344L,40345L,40346L,
-     40347L,40348L,40348L,40349L,40350L,40351L,40352L,40352L,
-     40353L,40354L,40355L,40356L,40356L,40357L,40358L,40359L,
-     40359L,40360L,40361L,40362L,40363L,40363L,40364L,40365L,
-     40366L,40367L,40367L,40368L,40369L,40370L,40370L,40371L,
-     40372L,40373L,40374L,40374L,40375L,40376L,40377L,40378L,
-     40378L,40379L,40380L,40381L,40382L,40382L,40383L,40384L,
-     40385L,40385L,40386L,40387L,40388L,40389L,40389L,40390L,
-     40391L,40392L,40393L,40393L,40394L,40395L,40396L,40396L,
-     40397L,40398L,40399L,40400L,40400L,40401L,40402L,40403L,
-     40404L,40404L,40405L,40406L,40407L,40407L,40408L,40409L,
-     40410L,40411L,40411L,40412L,40413L,40414L,40415L,40415L,
-     40416L,40417L,40418L,40419L,40419L,40420L,40421L,40422L,
-     40422L,40423L,40424L,40425L,40426L,40426L,40427L,40428L,
-     40429L,40430L,40430L,40431L,40432L,40433L,40433L,40434L,
-     40435L,40436L,40437L,40437L,40438L,40439L,40440L,40441L,
-     40441L,40442L,40443L,40444L,40444L,40445L,40446L,40447L,
-     40448L,40448L,40449L,40450L,40451L,40452L,40452L,40453L,
-     40454L,40455L,40456L,40456L,40457L,40458L,40459L,40459L,
-     40460L,40461L,40462L,40463L,40463L,40464L,40465L,40466L,
-     40467L,40467L,40468L,40469L,40470L,40470L,40471L,40472L,
-     40473L,40474L,40474L,40475L,40476L,40477L,40478L,40478L,
-     40479L,40480L,40481L,40481L,40482L,40483L,40484L,40485L,
-     40485L,40486L,40487L,40488L,40489L,40489L,40490L,40491L,
-     40492L,40492L,40493L,40494L,40495L,40496L,40496L,40497L,
-     40498L,40499L,40500L,40500L,40501L,40502L,40503L,40503L,
-     40504L,40505L,40506L,40507L,40507L,40508L,40509L,40510L,
-     40511L,40511L,40512L,40513L,40514L,40514L,40515L,40516L,
-     40517L,40518L,40518L,40519L,40520L,40521L,40522L,40522L,
-     40523L,40524L,40525L,40525L,40526L,40527L,40528L,40529L,
-     40529L,40530L,40531L,40532L,40533L,40533L,40534L,40535L,
-     40536L,40536L,40537L,40538L,40539L,40540L,40540L,40541L,
-     40542L,40543L,40544L,40544L,40545L,40546L,40547L,40547L,
-     40548L,40549L,40550L,40551L,40551L,40552L,40553L,40554L,
-     40555L,40555L,40556L,40557L,40558L,40558L,40559L,40560L,
-     40561L,40562L,40562L,40563L,40564L,40565L,40566L,40566L,
-     40567L,40568L,40569L,40569L,40570L,40571L,40572L,40573L,
-     40573L,40574L,40575L,40576L,40577L,40577L,40578L,40579L,
-     40580L,40580L,40581L,40582L,40583L,40584L,40584L,40585L,
-     40586L,40587L,40588L,40588L,40589L,40590L,40591L,40591L,
-     40592L,40593L,40594L,40595L,40595L,40596L,40597L,40598L,
-     40599L,40599L,40600L,40601L,40602L,40602L,40603L,40604L,
-     40605L,40606L,40606L,40607L,40608L,40609L,40610L,40610L,
-     40611L,40612L,40613L,40613L,40614L,40615L,40616L,40617L,
-     40617L,40618L,40619L,40620L,40621L,40621L,40622L,40623L,
-     40624L,40624L,40625L,40626L,40627L,40628L,40628L,40629L,
-     40630L,40631L,40631L,40632L,40633L,40634L,40635L,40635L,
-     40636L,40637L,40638L,40639L,40639L,40640L,40641L,40642L,
-     40642L,40643L,40644L,40645L,40646L,40646L,40647L,40648L,
-     40649L,40650L,40650L,40651L,40652L,40653L,40653L,40654L,
-     40655L,40656L,40657L,40657L,40658L,40659L,40660L,40661L,
-     40661L,40662L,40663L,40664L,40664L,40665L,40666L,40667L,
-     40668L,40668L,40669L,40670L,40671L,40671L,40672L,40673L,
-     40674L,40675L,40675L,40676L,40677L,40678L,40679L,40679L,
-     40680L,40681L,40682L,40682L,40683L,40684L,40685L,40686L,
-     40686L,40687L,40688L,40689L,40690L,40690L,40691L,40692L,
-     40693L,40693L,40694L,40695L,40696L,40697L,40697L,40698L,
-     40699L,40700L,40700L,40701L,40702L,40703L,40704L,40704L,
-     40705L,40706L,40707L,40708L,40708L,40709L,40710L,40711L,
-     40711L,40712L,40713L,40714L,40715L,40715L,40716L,40717L,
-     40718L,40719L,40719L,40720L,40721L,40722L,40722L,40723L,
-     40724L,40725L,40726L,40726L,40727L,40728L,40729L,40729L,
-     40730L,40731L,40732L,40733L,40733L,40734L,40735L,40736L,
-     40737L,40737L,40738L,40739L,40740L,40740L,40741L,40742L,
-     40743L,40744L,40744L,40745L,40746L,40747L,40748L,40748L,
-     40749L,40750L,40751L,40751L,40752L,40753L,40754L,40755L,
-     40755L,40756L,40757L,40758L,40758L,40759L,40760L,40761L,
-     40762L,40762L,40763L,40764L,40765L,40766L,40766L,40767L,
-     40768L,40769L,40769L,40770L,40771L,40772L,40773L,40773L,
-     40774L,40775L,40776L,40776L,40777L,40778L,40779L,40780L,
-     40780L,40781L,40782L,40783L,40784L,40784L,40785L,40786L,
-     40787L,40787L,40788L,40789L,40790L,40791L,40791L,40792L,
-     40793L,40794L,40794L,40795L,40796L,40797L,40798L,40798L,
-     40799L,40800L,40801L,40802L,40802L,40803L,40804L,40805L,
-     40805L,40806L,40807L,40808L,40809L,40809L,40810L,40811L,
-     40812L,40812L,40813L,40814L,40815L,40816L,40816L,40817L,
-     40818L,40819L,40820L,40820L,40821L,40822L,40823L,40823L,
-     40824L,40825L,40826L,40827L,40827L,40828L,40829L,40830L,
-     40830L,40831L,40832L,40833L,40834L,40834L,40835L,40836L,
-     40837L,40838L,40838L,40839L,40840L,40841L,40841L,40842L,
-     40843L,40844L,40845L,40845L,40846L,40847L,40848L,40848L,
-     40849L,40850L,40851L,40852L,40852L,40853L,40854L,40855L,
-     40856L,40856L,40857L,40858L,40859L,40859L,40860L,40861L,
-     40862L,40863L,40863L,40864L,40865L,40866L,40866L,40867L,
-     40868L,40869L,40870L,40870L,40871L,40872L,40873L,40873L,
-     40874L,40875L,40876L,40877L,40877L,40878L,40879L,40880L,
-     40881L,40881L,40882L,40883L,40884L,40884L,40885L,40886L,
-     40887L,40888L,40888L,40889L,40890L,40891L,40891L,40892L,
-     40893L,40894L,40895L,40895L,40896L,40897L,40898L,40898L,
-     40899L,40900L,40901L,40902L,40902L,40903L,40904L,40905L,
-     40906L,40906L,40907L,40908L,40909L,40909L,40910L,40911L,
-     40912L,40913L,40913L,40914L,40915L,40916L,40916L,40917L,
-     40918L,40919L,40920L,40920L,40921L,40922L,40923L,40923L,
-     40924L,40925L,40926L,40927L,40927L,40928L,40929L,40930L,
-     40931L,40931L,40932L,40933L,40934L,40934L,40935L,40936L,
-     40937L,40938L,40938L,40939L,40940L,40941L,40941L,40942L,
-     40943L,40944L,40945L,40945L,40946L,40947L,40948L,40948L,
-     40949L,40950L,40951L,40952L,40952L,40953L,40954L,40955L,
-     40956L,40956L,40957L,40958L,40959L,40959L,40960L,40961L,
-     40962L,40963L,40963L,40964L,40965L,40966L,40966L,40967L,
-     40968L,40969L,40970L,40970L,40971L,40972L,40973L,40973L,
-     40974L,40975L,40976L,40977L,40977L,40978L,40979L,40980L,
-     40980L,40981L,40982L,40983L,40984L,40984L,40985L,40986L,
-     40987L,40988L,40988L,40989L,40990L,40991L,40991L,40992L,
-     40993L,40994L,40995L,40995L,40996L,40997L,40998L,40998L,
-     40999L,41000L,41001L,41002L,41002L,41003L,41004L,41005L,
-     41005L,41006L,41007L,41008L,41009L,41009L,41010L,41011L,
-     41012L,41012L,41013L,41014L,41015L,41016L,41016L,41017L,
-     41018L,41019L,41019L,41020L,41021L,41022L,41023L,41023L,
-     41024L,41025L,41026L,41027L,41027L,41028L,41029L,41030L,
-     41030L,41031L,41032L,41033L,41034L,41034L,41035L,41036L,
-     41037L,41037L,41038L,41039L,41040L,41041L,41041L,41042L,
-     41043L,41044L,41044L,41045L,41046L,41047L,41048L,41048L,
-     41049L,41050L,41051L,41051L,41052L,41053L,41054L,41055L,
-     41055L,41056L,41057L,41058L,41058L,41059L,41060L,41061L,
-     41062L,41062L,41063L,41064L,41065L,41065L,41066L,41067L,
-     41068L,41069L,41069L,41070L,41071L,41072L,41073L,41073L,
-     41074L,41075L,41076L,41076L,41077L,41078L,41079L,41080L,
-     41080L,41081L,41082L,41083L,41083L,41084L,41085L,41086L,
-     41087L,41087L,41088L,41089L,41090L,41090L,41091L,41092L,
-     41093L,41094L,41094L,41095L,41096L,41097L,41097L,41098L,
-     41099L,41100L,41101L,41101L,41102L,41103L,41104L,41104L,
-     41105L,41106L,41107L,41108L,41108L,41109L,41110L,41111L,
-     41111L,41112L,41113L,41114L,41115L,41115L,41116L,41117L,
-     41118L,41118L,41119L,41120L,41121L,41122L,41122L,41123L,
-     41124L,41125L,41125L,41126L,41127L,41128L,41129L,41129L,
-     41130L,41131L,41132L,41132L,41133L,41134L,41135L,41136L,
-     41136L,41137L,41138L,41139L,41139L,41140L,41141L,41142L,
-     41143L,41143L,41144L,41145L,41146L,41146L,41147L,41148L,
-     41149L,41150L,41150L,41151L,41152L,41153L,41153L,41154L,
-     41155L,41156L,41157L,41157L,41158L,41159L,41160L,41160L,
-     41161L,41162L,41163L,41164L,41164L,41165L,41166L,41167L,
-     41167L,41168L,41169L,41170L,41171L,41171L,41172L,41173L,
-     41174L,41174L,41175L,41176L,41177L,41178L,41178L,41179L,
-     41180L,41181L,41182L,41182L,41183L,41184L,41185L,41185L,
-     41186L,41187L,41188L,41189L,41189L,41190L,41191L,41192L,
-     41192L,41193L,41194L,41195L,41196L,41196L,41197L,41198L,
-     41199L,41199L,41200L,41201L,41202L,41203L,41203L,41204L,
-     41205L,41206L,41206L,41207L,41208L,41209L,41209L,41210L,
-     41211L,41212L,41213L,41213L,41214L,41215L,41216L,41216L,
-     41217L,41218L,41219L,41220L,41220L,41221L,41222L,41223L,
-     41223L,41224L,41225L,41226L,41227L,41227L,41228L,41229L,
-     41230L,41230L,41231L,41232L,41233L,41234L,41234L,41235L,
-     41236L,41237L,41237L,41238L,41239L,41240L,41241L,41241L,
-     41242L,41243L,41244L,41244L,41245L,41246L,41247L,41248L,
-     41248L,41249L,41250L,41251L,41251L,41252L,41253L,41254L,
-     41255L,41255L,41256L,41257L,41258L,41258L,41259L,41260L,
-     41261L,41262L,41262L,41263L,41264L,41265L,41265L,41266L,
-     41267L,41268L,41269L,41269L,41270L,41271L,41272L,41272L,
-     41273L,41274L,41275L,41276L,41276L,41277L,41278L,41279L,
-     41279L,41280L,41281L,41282L,41283L,41283L,41284L,41285L,
-     41286L,41286L,41287L,41288L,41289L,41290L,41290L,41291L,
-     41292L,41293L,41293L,41294L,41295L,41296L,41297L,41297L,
-     41298L,41299L,41300L,41300L,41301L,41302L,41303L,41304L,
-     41304L,41305L,41306L,41307L,41307L,41308L,41309L,41310L,
-     41311L,41311L,41312L,41313L,41314L,41314L,41315L,41316L,
-     41317L,41317L,41318L,41319L,41320L,41321L,41321L,41322L,
-     41323L,41324L,41324L,41325L,41326L,41327L,41328L,41328L,
-     41329L,41330L,41331L,41331L,41332L,41333L,41334L,41335L,
-     41335L,41336L,41337L,41338L,41338L,41339L,41340L,41341L,
-     41342L,41342L,41343L,41344L,41345L,41345L,41346L,41347L,
-     41348L,41349L,41349L,41350L,41351L,41352L,41352L,41353L,
-     41354L,41355L,41356L,41356L,41357L,41358L,41359L,41359L,
-     41360L,41361L,41362L,41362L,41363L,41364L,41365L,41366L,
-     41366L,41367L,41368L,41369L,41369L,41370L,41371L,41372L,
-     41373L,41373L,41374L,41375L,41376L,41376L,41377L,41378L,
-     41379L,41380L,41380L,41381L,41382L,41383L,41383L,41384L,
-     41385L,41386L,41387L,41387L,41388L,41389L,41390L,41390L,
-     41391L,41392L,41393L,41394L,41394L,41395L,41396L,41397L,
-     41397L,41398L,41399L,41400L,41400L,41401L,41402L,41403L,
-     41404L,41404L,41405L,41406L,41407L,41407L,41408L,41409L,
-     41410L,41411L,41411L,41412L,41413L,41414L,41414L,41415L,
-     41416L,41417L,41418L,41418L,41419L,41420L,41421L,41421L,
-     41422L,41423L,41424L,41425L,41425L,41426L,41427L,41428L,
-     41428L,41429L,41430L,41431L,41431L,41432L,41433L,41434L,
-     41435L,41435L,41436L,41437L,41438L,41438L,41439L,41440L,
-     41441L,41442L,41442L,41443L,41444L,41445L,41445L,41446L,
-     41447L,41448L,41449L,41449L,41450L,41451L,41452L,41452L,
-     41453L,41454L,41455L,41456L,41456L,41457L,41458L,41459L,
-     41459L,41460L,41461L,41462L,41462L,41463L,41464L,41465L,
-     41466L,41466L,41467L,41468L,41469L,41469L,41470L,41471L,
-     41472L,41473L,41473L,41474L,41475L,41476L,41476L,41477L,
-     41478L,41479L,41480L,41480L,41481L,41482L,41483L,41483L,
-     41484L,41485L,41486L,41486L,41487L,41488L,41489L,41490L,
-     41490L,41491L,41492L,41493L,41493L,41494L,41495L,41496L,
-     41497L,41497L,41498L,41499L,41500L,41500L,41501L,41502L,
-     41503L,41504L,41504L,41505L,41506L,41507L,41507L,41508L,
-     41509L,41510L,41510L,41511L,41512L,41513L,41514L,41514L,
-     41515L,41516L,41517L,41517L,41518L,41519L,41520L,41521L,
-     41521L,41522L,41523L,41524L,41524L,41525L,41526L,41527L,
-     41527L,41528L,41529L,41530L,41531L,41531L,41532L,41533L,
-     41534L,41534L,41535L,41536L,41537L,41538L,41538L,41539L,
-     41540L,41541L,41541L,41542L,41543L,41544L,41545L,41545L,
-     41546L,41547L,41548L,41548L,41549L,41550L,41551L,41551L,
-     41552L,41553L,41554L,41555L,41555L,41556L,41557L,41558L,
-     41558L,41559L,41560L,41561L,41562L,41562L,41563L,41564L,
-     41565L,41565L,41566L,41567L,41568L,41568L,41569L,41570L,
-     41571L,41572L,41572L,41573L,41574L,41575L,41575L,41576L,
-     41577L,41578L,41579L,41579L,41580L,41581L,41582L,41582L,
-     41583L,41584L,41585L,41585L,41586L,41587L,41588L,41589L,
-     41589L,41590L,41591L,41592L,41592L,41593L,41594L,41595L,
-     41596L,41596L,41597L,41598L,41599L,41599L,41600L,41601L,
-     41602L,41602L,41603L,41604L,41605L,41606L,41606L,41607L,
-     41608L,41609L,41609L,41610L,41611L,41612L,41613L,41613L,
-     41614L,41615L,41616L,41616L,41617L,41618L,41619L,41619L,
-     41620L,41621L,41622L,41623L,41623L,41624L,41625L,41626L,
-     41626L,41627L,41628L,41629L,41630L,41630L,41631L,41632L,
-     41633L,41633L,41634L,41635L,41636L,41636L,41637L,41638L,
-     41639L,41640L,41640L,41641L,41642L,41643L,41643L,41644L,
-     41645L,41646L,41647L,41647L,41648L,41649L,41650L,41650L,
-     41651L,41652L,41653L,41653L,41654L,41655L,41656L,41657L,
-     41657L,41658L,41659L,41660L,41660L,41661L,41662L,41663L,
-     41663L,41664L,41665L,41666L,41667L,41667L,41668L,41669L,
-     41670L,41670L,41671L,41672L,41673L,41674L,41674L,41675L,
-     41676L,41677L,41677L,41678L,41679L,41680L,41680L,41681L,
-     41682L,41683L,41684L,41684L,41685L,41686L,41687L,41687L,
-     41688L,41689L,41690L,41691L,41691L,41692L,41693L,41694L,
-     41694L,41695L,41696L,41697L,41697L,41698L,41699L,41700L,
-     41701L,41701L,41702L,41703L,41704L,41704L,41705L,41706L,
-     41707L,41707L,41708L,41709L,41710L,41711L,41711L,41712L,
-     41713L,41714L,41714L,41715L,41716L,41717L,41718L,41718L,
-     41719L,41720L,41721L,41721L,41722L,41723L,41724L,41724L,
-     41725L,41726L,41727L,41728L,41728L,41729L,41730L,41731L,
-     41731L,41732L,41733L,41734L,41734L,41735L,41736L,41737L,
-     41738L,41738L,41739L,41740L,41741L,41741L,41742L,41743L,
-     41744L,41744L,41745L,41746L,41747L,41748L,41748L,41749L,
-     41750L,41751L,41751L,41752L,41753L,41754L,41755L,41755L,
-     41756L,41757L,41758L,41758L,41759L,41760L,41761L,41761L,
-     41762L,41763L,41764L,41765L,41765L,41766L,41767L,41768L,
-     41768L,41769L,41770L,41771L,41771L,41772L,41773L,41774L,
-     41775L,41775L,41776L,41777L,41778L,41778L,41779L,41780L,
-     41781L,41781L,41782L,41783L,41784L,41785L,41785L,41786L,
-     41787L,41788L,41788L,41789L,41790L,41791L,41791L,41792L,
-     41793L,41794L,41795L,41795L,41796L,41797L,41798L,41798L,
-     41799L,41800L,41801L,41802L,41802L,41803L,41804L,41805L,
-     41805L,41806L,41807L,41808L,41808L,41809L,41810L,41811L,
-     41812L,41812L,41813L,41814L,41815L,41815L,41816L,41817L,
-     41818L,41818L,41819L,41820L,41821L,41822L,41822L,41823L,
-     41824L,41825L,41825L,41826L,41827L,41828L,41828L,41829L,
-     41830L,41831L,41832L,41832L,41833L,41834L,41835L,41835L,
-     41836L,41837L,41838L,41838L,41839L,41840L,41841L,41842L,
-     41842L,41843L,41844L,41845L,41845L,41846L,41847L,41848L,
-     41848L,41849L,41850L,41851L,41852L,41852L,41853L,41854L,
-     41855L,41855L,41856L,41857L,41858L,41858L,41859L,41860L,
-     41861L,41862L,41862L,41863L,41864L,41865L,41865L,41866L,
-     41867L,41868L,41868L,41869L,41870L,41871L,41872L,41872L,
-     41873L,41874L,41875L,41875L,41876L,41877L,41878L,41878L,
-     41879L,41880L,41881L,41882L,41882L,41883L,41884L,41885L,
-     41885L,41886L,41887L,41888L,41888L,41889L,41890L,41891L,
-     41892L,41892L,41893L,41894L,41895L,41895L,41896L,41897L,
-     41898L,41898L,41899L,41900L,41901L,41902L,41902L,41903L,
-     41904L,41905L,41905L,41906L,41907L,41908L,41908L,41909L,
-     41910L,41911L,41912L,41912L,41913L,41914L,41915L,41915L,
-     41916L,41917L,41918L,41918L,41919L,41920L,41921L,41922L,
-     41922L,41923L,41924L,41925L,41925L,41926L,41927L,41928L,
-     41928L,41929L,41930L,41931L,41932L,41932L,41933L,41934L,
-     41935L,41935L,41936L,41937L,41938L,41938L,41939L,41940L,
-     41941L,41942L,41942L,41943L,41944L,41945L,41945L,41946L,
-     41947L,41948L,41948L,41949L,41950L,41951L,41952L,41952L,
-     41953L,41954L,41955L,41955L,41956L,41957L,41958L,41958L,
-     41959L,41960L,41961L,41961L,41962L,41963L,41964L,41965L,
-     41965L,41966L,41967L,41968L,41968L,41969L,41970L,41971L,
-     41971L,41972L,41973L,41974L,41975L,41975L,41976L,41977L,
-     41978L,41978L,41979L,41980L,41981L,41981L,41982L,41983L,
-     41984L,41985L,41985L,41986L,41987L,41988L,41988L,41989L,
-     41990L,41991L,41991L,41992L,41993L,41994L,41995L,41995L,
-     41996L,41997L,41998L,41998L,41999L,42000L,42001L,42001L,
-     42002L,42003L,42004L,42004L,42005L,42006L,42007L,42008L,
-     42008L,42009L,42010L,42011L,42011L,42012L,42013L,42014L,
-     42014L,42015L,42016L,42017L,42018L,42018L,42019L,42020L,
-     42021L,42021L,42022L,42023L,42024L,42024L,42025L,42026L,
-     42027L,42028L,42028L,42029L,42030L,42031L,42031L,42032L,
-     42033L,42034L,42034L,42035L,42036L,42037L,42037L,42038L,
-     42039L,42040L,42041L,42041L,42042L,42043L,42044L,42044L,
-     42045L,42046L,42047L,42047L,42048L,42049L,42050L,42051L,
-     42051L,42052L,42053L,42054L,42054L,42055L,42056L,42057L,
-     42057L,42058L,42059L,42060L,42061L,42061L,42062L,42063L,
-     42064L,42064L,42065L,42066L,42067L,42067L,42068L,42069L,
-     42070L,42070L,42071L,42072L,42073L,42074L,42074L,42075L,
-     42076L,42077L,42077L,42078L,42079L,42080L,42080L,42081L,
-     42082L,42083L,42084L,42084L,42085L,42086L,42087L,42087L,
-     42088L,42089L,42090L,42090L,42091L,42092L,42093L,42093L,
-     42094L,42095L,42096L,42097L,42097L,42098L,42099L,42100L,
-     42100L,42101L,42102L,42103L,42103L,42104L,42105L,42106L,
-     42107L,42107L,42108L,42109L,42110L,42110L,42111L,42112L,
-     42113L,42113L,42114L,42115L,42116L,42116L,42117L,42118L,
-     42119L,42120L,42120L,42121L,42122L,42123L,42123L,42124L,
-     42125L,42126L,42126L,42127L,42128L,42129L,42129L,42130L,
-     42131L,42132L,42133L,42133L,42134L,42135L,42136L,42136L,
-     42137L,42138L,42139L,42139L,42140L,42141L,42142L,42143L,
-     42143L,42144L,42145L,42146L,42146L,42147L,42148L,42149L,
-     42149L,42150L,42151L,42152L,42152L,42153L,42154L,42155L,
-     42156L,42156L,42157L,42158L,42159L,42159L,42160L,42161L,
-     42162L,42162L,42163L,42164L,42165L,42165L,42166L,42167L,
-     42168L,42169L,42169L,42170L,42171L,42172L,42172L,42173L,
-     42174L,42175L,42175L,42176L,42177L,42178L,42178L,42179L,
-     42180L,42181L,42182L,42182L,42183L,42184L,42185L,42185L,
-     42186L,42187L,42188L,42188L,42189L,42190L,42191L,42191L,
-     42192L,42193L,42194L,42195L,42195L,42196L,42197L,42198L,
-     42198L,42199L,42200L,42201L,42201L,42202L,42203L,42204L,
-     42205L,42205L,42206L,42207L,42208L,42208L,42209L,42210L,
-     42211L,42211L,42212L,42213L,42214L,42214L,42215L,42216L,
-     42217L,42218L,42218L,42219L,42220L,42221L,42221L,42222L,
-     42223L,42224L,42224L,42225L,42226L,42227L,42227L,42228L,
-     42229L,42230L,42231L,42231L,42232L,42233L,42234L,42234L,
-     42235L,42236L,42237L,42237L,42238L,42239L,42240L,42240L,
-     42241L,42242L,42243L,42244L,42244L,42245L,42246L,42247L,
-     42247L,42248L,42249L,42250L,42250L,42251L,42252L,42253L,
-     42253L,42254L,42255L,42256L,42257L,42257L,42258L,42259L,
-     42260L,42260L,42261L,42262L,42263L,42263L,42264L,42265L,
-     42266L,42266L,42267L,42268L,42269L,42269L,42270L,42271L,
-     42272L,42273L,42273L,42274L,42275L,42276L,42276L,42277L,
-     42278L,42279L,42279L,42280L,42281L,42282L,42282L,42283L,
-     42284L,42285L,42286L,42286L,42287L,42288L,42289L,42289L,
-     42290L,42291L,42292L,42292L,42293L,42294L,42295L,42295L,
-     42296L,42297L,42298L,42299L,42299L,42300L,42301L,42302L,
-     42302L,42303L,42304L,42305L,42305L,42306L,42307L,42308L,
-     42308L,42309L,42310L,42311L,42312L,42312L,42313L,42314L,
-     42315L,42315L,42316L,42317L,42318L,42318L,42319L,42320L,
-     42321L,42321L,42322L,42323L,42324L,42324L,42325L,42326L,
-     42327L,42328L,42328L,42329L,42330L,42331L,42331L,42332L,
-     42333L,42334L,42334L,42335L,42336L,42337L,42337L,42338L,
-     42339L,42340L,42341L,42341L,42342L,42343L,42344L,42344L,
-     42345L,42346L,42347L,42347L,42348L,42349L,42350L,42350L,
-     42351L,42352L,42353L,42353L,42354L,42355L,42356L,42357L,
-     42357L,42358L,42359L,42360L,42360L,42361L,42362L,42363L,
-     42363L,42364L,42365L,42366L,42366L,42367L,42368L,42369L,
-     42370L,42370L,42371L,42372L,42373L,42373L,42374L,42375L,
-     42376L,42376L,42377L,42378L,42379L,42379L,42380L,42381L,
-     42382L,42382L,42383L,42384L,42385L,42386L,42386L,42387L,
-     42388L,42389L,42389L,42390L,42391L,42392L,42392L,42393L,
-     42394L,42395L,42395L,42396L,42397L,42398L,42399L,42399L,
-     42400L,42401L,42402L,42402L,42403L,42404L,42405L,42405L,
-     42406L,42407L,42408L,42408L,42409L,42410L,42411L,42411L,
-     42412L,42413L,42414L,42415L,42415L,42416L,42417L,42418L,
-     42418L,42419L,42420L,42421L,42421L,42422L,42423L,42424L,
-     42424L,42425L,42426L,42427L,42427L,42428L,42429L,42430L,
-     42431L,42431L,42432L,42433L,42434L,42434L,42435L,42436L,
-     42437L,42437L,42438L,42439L,42440L,42440L,42441L,42442L,
-     42443L,42443L,42444L,42445L,42446L,42447L,42447L,42448L,
-     42449L,42450L,42450L,42451L,42452L,42453L,42453L,42454L,
-     42455L,42456L,42456L,42457L,42458L,42459L,42459L,42460L,
-     42461L,42462L,42463L,42463L,42464L,42465L,42466L,42466L,
-     42467L,42468L,42469L,42469L,42470L,42471L,42472L,42472L,
-     42473L,42474L,42475L,42475L,42476L,42477L,42478L,42479L,
-     42479L,42480L,42481L,42482L,42482L,42483L,42484L,42485L,
-     42485L,42486L,42487L,42488L,42488L,42489L,42490L,42491L,
-     42491L,42492L,42493L,42494L,42495L,42495L,42496L,42497L,
-     42498L,42498L,42499L,42500L,42501L,42501L,42502L,42503L,
-     42504L,42504L,42505L,42506L,42507L,42507L,42508L,42509L,
-     42510L,42510L,42511L,42512L,42513L,42514L,42514L,42515L,
-     42516L,42517L,42517L,42518L,42519L,42520L,42520L,42521L,
-     42522L,42523L,42523L,42524L,42525L,42526L,42526L,42527L,
-     42528L,42529L,42530L,42530L,42531L,42532L,42533L,42533L,
-     42534L,42535L,42536L,42536L,42537L,42538L,42539L,42539L,
-     42540L,42541L,42542L,42542L,42543L,42544L,42545L,42545L,
-     42546L,42547L,42548L,42549L,42549L,42550L,42551L,42552L,
-     42552L,42553L,42554L,42555L,42555L,42556L,42557L,42558L,
-     42558L,42559L,42560L,42561L,42561L,42562L,42563L,42564L,
-     42565L,42565L,42566L,42567L,42568L,42568L,42569L,42570L,
-     42571L,42571L,42572L,42573L,42574L,42574L,42575L,42576L,
-     42577L,42577L,42578L,42579L,42580L,42580L,42581L,42582L,
-     42583L,42584L,42584L,42585L,42586L,42587L,42587L,42588L,
-     42589L,42590L,42590L,42591L,42592L,42593L,42593L,42594L,
-     42595L,42596L,42596L,42597L,42598L,42599L,42599L,42600L,
-     42601L,42602L,42603L,42603L,42604L,42605L,42606L,42606L,
-     42607L,42608L,42609L,42609L,42610L,42611L,42612L,42612L,
-     42613L,42614L,42615L,42615L,42616L,42617L,42618L,42618L,
-     42619L,42620L,42621L,42622L,42622L,42623L,42624L,42625L,
-     42625L,42626L,42627L,42628L,42628L,42629L,42630L,42631L,
-     42631L,42632L,42633L,42634L,42634L,42635L,42636L,42637L,
-     42637L,42638L,42639L,42640L,42640L,42641L,42642L,42643L,
-     42644L,42644L,42645L,42646L,42647L,42647L,42648L,42649L,
-     42650L,42650L,42651L,42652L,42653L,42653L,42654L,42655L,
-     42656L,42656L,42657L,42658L,42659L,42659L,42660L,42661L,
-     42662L,42663L,42663L,42664L,42665L,42666L,42666L,42667L,
-     42668L,42669L,42669L,42670L,42671L,42672L,42672L,42673L,
-     42674L,42675L,42675L,42676L,42677L,42678L,42678L,42679L,
-     42680L,42681L,42681L,42682L,42683L,42684L,42685L,42685L,
-     42686L,42687L,42688L,42688L,42689L,42690L,42691L,42691L,
-     42692L,42693L,42694L,42694L,42695L,42696L,42697L,42697L,
-     42698L,42699L,42700L,42700L,42701L,42702L,42703L,42703L,
-     42704L,42705L,42706L,42707L,42707L,42708L,42709L,42710L,
-     42710L,42711L,42712L,42713L,42713L,42714L,42715L,42716L,
-     42716L,42717L,42718L,42719L,42719L,42720L,42721L,42722L,
-     42722L,42723L,42724L,42725L,42725L,42726L,42727L,42728L,
-     42729L,42729L,42730L,42731L,42732L,42732L,42733L,42734L,
-     42735L,42735L,42736L,42737L,42738L,42738L,42739L,42740L,
-     42741L,42741L,42742L,42743L,42744L,42744L,42745L,42746L,
-     42747L,42747L,42748L,42749L,42750L,42750L,42751L,42752L,
-     42753L,42754L,42754L,42755L,42756L,42757L,42757L,42758L,
-     42759L,42760L,42760L,42761L,42762L,42763L,42763L,42764L,
-     42765L,42766L,42766L,42767L,42768L,42769L,42769L,42770L,
-     42771L,42772L,42772L,42773L,42774L,42775L,42776L,42776L,
-     42777L,42778L,42779L,42779L,42780L,42781L,42782L,42782L,
-     42783L,42784L,42785L,42785L,42786L,42787L,42788L,42788L,
-     42789L,42790L,42791L,42791L,42792L,42793L,42794L,42794L,
-     42795L,42796L,42797L,42797L,42798L,42799L,42800L,42800L,
-     42801L,42802L,42803L,42804L,42804L,42805L,42806L,42807L,
-     42807L,42808L,42809L,42810L,42810L,42811L,42812L,42813L,
-     42813L,42814L,42815L,42816L,42816L,42817L,42818L,42819L,
-     42819L,42820L,42821L,42822L,42822L,42823L,42824L,42825L,
-     42825L,42826L,42827L,42828L,42829L,42829L,42830L,42831L,
-     42832L,42832L,42833L,42834L,42835L,42835L,42836L,42837L,
-     42838L,42838L,42839L,42840L,42841L,42841L,42842L,42843L,
-     42844L,42844L,42845L,42846L,42847L,42847L,42848L,42849L,
-     42850L,42850L,42851L,42852L,42853L,42853L,42854L,42855L,
-     42856L,42857L,42857L,42858L,42859L,42860L,42860L,42861L,
-     42862L,42863L,42863L,42864L,42865L,42866L,42866L,42867L,
-     42868L,42869L,42869L,42870L,42871L,42872L,42872L,42873L,
-     42874L,42875L,42875L,42876L,42877L,42878L,42878L,42879L,
-     42880L,42881L,42881L,42882L,42883L,42884L,42884L,42885L,
-     42886L,42887L,42888L,42888L,42889L,42890L,42891L,42891L,
-     42892L,42893L,42894L,42894L,42895L,42896L,42897L,42897L,
-     42898L,42899L,42900L,42900L,42901L,42902L,42903L,42903L,
-     42904L,42905L,42906L,42906L,42907L,42908L,42909L,42909L,
-     42910L,42911L,42912L,42912L,42913L,42914L,42915L,42915L,
-     42916L,42917L,42918L,42919L,42919L,42920L,42921L,42922L,
-     42922L,42923L,42924L,42925L,42925L,42926L,42927L,42928L,
-     42928L,42929L,42930L,42931L,42931L,42932L,42933L,42934L,
-     42934L,42935L,42936L,42937L,42937L,42938L,42939L,42940L,
-     42940L,42941L,42942L,42943L,42943L,42944L,42945L,42946L,
-     42946L,42947L,42948L,42949L,42949L,42950L,42951L,42952L,
-     42953L,42953L,42954L,42955L,42956L,42956L,42957L,42958L,
-     42959L,42959L,42960L,42961L,42962L,42962L,42963L,42964L,
-     42965L,42965L,42966L,42967L,42968L,42968L,42969L,42970L,
-     42971L,42971L,42972L,42973L,42974L,42974L,42975L,42976L,
-     42977L,42977L,42978L,42979L,42980L,42980L,42981L,42982L,
-     42983L,42983L,42984L,42985L,42986L,42986L,42987L,42988L,
-     42989L,42990L,42990L,42991L,42992L,42993L,42993L,42994L,
-     42995L,42996L,42996L,42997L,42998L,42999L,42999L,43000L,
-     43001L,43002L,43002L,43003L,43004L,43005L,43005L,43006L,
-     43007L,43008L,43008L,43009L,43010L,43011L,43011L,43012L,
-     43013L,43014L,43014L,43015L,43016L,43017L,43017L,43018L,
-     43019L,43020L,43020L,43021L,43022L,43023L,43023L,43024L,
-     43025L,43026L,43026L,43027L,43028L,43029L,43029L,43030L,
-     43031L,43032L,43033L,43033L,43034L,43035L,43036L,43036L,
-     43037L,43038L,43039L,43039L,43040L,43041L,43042L,43042L,
-     43043L,43044L,43045L,43045L,43046L,43047L,43048L,43048L,
-     43049L,43050L,43051L,43051L,43052L,43053L,43054L,43054L,
-     43055L,43056L,43057L,43057L,43058L,43059L,43060L,43060L,
-     43061L,43062L,43063L,43063L,43064L,43065L,43066L,43066L,
-     43067L,43068L,43069L,43069L,43070L,43071L,43072L,43072L,
-     43073L,43074L,43075L,43075L,43076L,43077L,43078L,43079L,
-     43079L,43080L,43081L,43082L,43082L,43083L,43084L,43085L,
-     43085L,43086L,43087L,43088L,43088L,43089L,43090L,43091L,
-     43091L,43092L,43093L,43094L,43094L,43095L,43096L,43097L,
-     43097L,43098L,43099L,43100L,43100L,43101L,43102L,43103L,
-     43103L,43104L,43105L,43106L,43106L,43107L,43108L,43109L,
-     43109L,43110L,43111L,43112L,43112L,43113L,43114L,43115L,
-     43115L,43116L,43117L,43118L,43118L,43119L,43120L,43121L,
-     43121L,43122L,43123L,43124L,43124L,43125L,43126L,43127L,
-     43127L,43128L,43129L,43130L,43130L,43131L,43132L,43133L,
-     43133L,43134L,43135L,43136L,43137L,43137L,43138L,43139L,
-     43140L,43140L,43141L,43142L,43143L,43143L,43144L,43145L,
-     43146L,43146L,43147L,43148L,43149L,43149L,43150L,43151L,
-     43152L,43152L,43153L,43154L,43155L,43155L,43156L,43157L,
-     43158L,43158L,43159L,43160L,43161L,43161L,43162L,43163L,
-     43164L,43164L,43165L,43166L,43167L,43167L,43168L,43169L,
-     43170L,43170L,43171L,43172L,43173L,43173L,43174L,43175L,
-     43176L,43176L,43177L,43178L,43179L,43179L,43180L,43181L,
-     43182L,43182L,43183L,43184L,43185L,43185L,43186L,43187L,
-     43188L,43188L,43189L,43190L,43191L,43191L,43192L,43193L,
-     43194L,43194L,43195L,43196L,43197L,43197L,43198L,43199L,
-     43200L,43200L,43201L,43202L,43203L,43203L,43204L,43205L,
-     43206L,43206L,43207L,43208L,43209L,43209L,43210L,43211L,
-     43212L,43212L,43213L,43214L,43215L,43215L,43216L,43217L,
-     43218L,43219L,43219L,43220L,43221L,43222L,43222L,43223L,
-     43224L,43225L,43225L,43226L,43227L,43228L,43228L,43229L,
-     43230L,43231L,43231L,43232L,43233L,43234L,43234L,43235L,
-     43236L,43237L,43237L,43238L,43239L,43240L,43240L,43241L,
-     43242L,43243L,43243L,43244L,43245L,43246L,43246L,43247L,
-     43248L,43249L,43249L,43250L,43251L,43252L,43252L,43253L,
-     43254L,43255L,43255L,43256L,43257L,43258L,43258L,43259L,
-     43260L,43261L,43261L,43262L,43263L,43264L,43264L,43265L,
-     43266L,43267L,43267L,43268L,43269L,43270L,43270L,43271L,
-     43272L,43273L,43273L,43274L,43275L,43276L,43276L,43277L,
-     43278L,43279L,43279L,43280L,43281L,43282L,43282L,43283L,
-     43284L,43285L,43285L,43286L,43287L,43288L,43288L,43289L,
-     43290L,43291L,43291L,43292L,43293L,43294L,43294L,43295L,
-     43296L,43297L,43297L,43298L,43299L,43300L,43300L,43301L,
-     43302L,43303L,43303L,43304L,43305L,43306L,43306L,43307L,
-     43308L,43309L,43309L,43310L,43311L,43312L,43312L,43313L,
-     43314L,43315L,43315L,43316L,43317L,43318L,43318L,43319L,
-     43320L,43321L,43321L,43322L,43323L,43324L,43324L,43325L,
-     43326L,43327L,43327L,43328L,43329L,43330L,43330L,43331L,
-     43332L,43333L,43333L,43334L,43335L,43336L,43336L,43337L,
-     43338L,43339L,43339L,43340L,43341L,43342L,43342L,43343L,
-     43344L,43345L,43345L,43346L,43347L,43348L,43348L,43349L,
-     43350L,43351L,43351L,43352L,43353L,43354L,43354L,43355L,
-     43356L,43357L,43357L,43358L,43359L,43360L,43360L,43361L,
-     43362L,43363L,43363L,43364L,43365L,43366L,43366L,43367L,
-     43368L,43369L,43369L,43370L,43371L,43372L,43372L,43373L,
-     43374L,43375L,43375L,43376L,43377L,43378L,43378L,43379L,
-     43380L,43381L,43381L,43382L,43383L,43384L,43384L,43385L,
-     43386L,43387L,43387L,43388L,43389L,43390L,43390L,43391L,
-     43392L,43393L,43393L,43394L,43395L,43396L,43396L,43397L,
-     43398L,43399L,43399L,43400L,43401L,43402L,43402L,43403L,
-     43404L,43405L,43405L,43406L,43407L,43408L,43408L,43409L,
-     43410L,43411L,43411L,43412L,43413L,43414L,43414L,43415L,
-     43416L,43417L,43417L,43418L,43419L,43420L,43420L,43421L,
-     43422L,43423L,43423L,43424L,43425L,43426L,43426L,43427L,
-     43428L,43429L,43429L,43430L,43431L,43432L,43432L,43433L,
-     43434L,43435L,43435L,43436L,43437L,43438L,43438L,43439L,
-     43440L,43441L,43441L,43442L,43443L,43444L,43444L,43445L,
-     43446L,43447L,43447L,43448L,43449L,43450L,43450L,43451L,
-     43452L,43453L,43453L,43454L,43455L,43456L,43456L,43457L,
-     43458L,43459L,43459L,43460L,43461L,43462L,43462L,43463L,
-     43464L,43465L,43465L,43466L,43467L,43468L,43468L,43469L,
-     43470L,43471L,43471L,43472L,43473L,43474L,43474L,43475L,
-     43476L,43477L,43477L,43478L,43479L,43479L,43480L,43481L,
-     43482L,43482L,43483L,43484L,43485L,43485L,43486L,43487L,
-     43488L,43488L,43489L,43490L,43491L,43491L,43492L,43493L,
-     43494L,43494L,43495L,43496L,43497L,43497L,43498L,43499L,
-     43500L,43500L,43501L,43502L,43503L,43503L,43504L,43505L,
-     43506L,43506L,43507L,43508L,43509L,43509L,43510L,43511L,
-     43512L,43512L,43513L,43514L,43515L,43515L,43516L,43517L,
-     43518L,43518L,43519L,43520L,43521L,43521L,43522L,43523L,
-     43524L,43524L,43525L,43526L,43527L,43527L,43528L,43529L,
-     43530L,43530L,43531L,43532L,43533L,43533L,43534L,43535L,
-     43536L,43536L,43537L,43538L,43539L,43539L,43540L,43541L,
-     43542L,43542L,43543L,43544L,43545L,43545L,43546L,43547L,
-     43548L,43548L,43549L,43550L,43551L,43551L,43552L,43553L,
-     43554L,43554L,43555L,43556L,43557L,43557L,43558L,43559L,
-     43559L,43560L,43561L,43562L,43562L,43563L,43564L,43565L,
-     43565L,43566L,43567L,43568L,43568L,43569L,43570L,43571L,
-     43571L,43572L,43573L,43574L,43574L,43575L,43576L,43577L,
-     43577L,43578L,43579L,43580L,43580L,43581L,43582L,43583L,
-     43583L,43584L,43585L,43586L,43586L,43587L,43588L,43589L,
-     43589L,43590L,43591L,43592L,43592L,43593L,43594L,43595L,
-     43595L,43596L,43597L,43598L,43598L,43599L,43600L,43601L,
-     43601L,43602L,43603L,43604L,43604L,43605L,43606L,43607L,
-     43607L,43608L,43609L,43610L,43610L,43611L,43612L,43613L,
-     43613L,43614L,43615L,43616L,43616L,43617L,43618L,43618L,
-     43619L,43620L,43621L,43621L,43622L,43623L,43624L,43624L,
-     43625L,43626L,43627L,43627L,43628L,43629L,43630L,43630L,
-     43631L,43632L,43633L,43633L,43634L,43635L,43636L,43636L,
-     43637L,43638L,43639L,43639L,43640L,43641L,43642L,43642L,
-     43643L,43644L,43645L,43645L,43646L,43647L,43648L,43648L,
-     43649L,43650L,43651L,43651L,43652L,43653L,43654L,43654L,
-     43655L,43656L,43657L,43657L,43658L,43659L,43660L,43660L,
-     43661L,43662L,43663L,43663L,43664L,43665L,43665L,43666L,
-     43667L,43668L,43668L,43669L,43670L,43671L,43671L,43672L,
-     43673L,43674L,43674L,43675L,43676L,43677L,43677L,43678L,
-     43679L,43680L,43680L,43681L,43682L,43683L,43683L,43684L,
-     43685L,43686L,43686L,43687L,43688L,43689L,43689L,43690L,
-     43691L,43692L,43692L,43693L,43694L,43695L,43695L,43696L,
-     43697L,43698L,43698L,43699L,43700L,43701L,43701L,43702L,
-     43703L,43704L,43704L,43705L,43706L,43706L,43707L,43708L,
-     43709L,43709L,43710L,43711L,43712L,43712L,43713L,43714L,
-     43715L,43715L,43716L,43717L,43718L,43718L,43719L,43720L,
-     43721L,43721L,43722L,43723L,43724L,43724L,43725L,43726L,
-     43727L,43727L,43728L,43729L,43730L,43730L,43731L,43732L,
-     43733L,43733L,43734L,43735L,43736L,43736L,43737L,43738L,
-     43739L,43739L,43740L,43741L,43741L,43742L,43743L,43744L,
-     43744L,43745L,43746L,43747L,43747L,43748L,43749L,43750L,
-     43750L,43751L,43752L,43753L,43753L,43754L,43755L,43756L,
-     43756L,43757L,43758L,43759L,43759L,43760L,43761L,43762L,
-     43762L,43763L,43764L,43765L,43765L,43766L,43767L,43768L,
-     43768L,43769L,43770L,43771L,43771L,43772L,43773L,43774L,
-     43774L,43775L,43776L,43776L,43777L,43778L,43779L,43779L,
-     43780L,43781L,43782L,43782L,43783L,43784L,43785L,43785L,
-     43786L,43787L,43788L,43788L,43789L,43790L,43791L,43791L,
-     43792L,43793L,43794L,43794L,43795L,43796L,43797L,43797L,
-     43798L,43799L,43800L,43800L,43801L,43802L,43803L,43803L,
-     43804L,43805L,43805L,43806L,43807L,43808L,43808L,43809L,
-     43810L,43811L,43811L,43812L,43813L,43814L,43814L,43815L,
-     43816L,43817L,43817L,43818L,43819L,43820L,43820L,43821L,
-     43822L,43823L,43823L,43824L,43825L,43826L,43826L,43827L,
-     43828L,43829L,43829L,43830L,43831L,43832L,43832L,43833L,
-     43834L,43834L,43835L,43836L,43837L,43837L,43838L,43839L,
-     43840L,43840L,43841L,43842L,43843L,43843L,43844L,43845L,
-     43846L,43846L,43847L,43848L,43849L,43849L,43850L,43851L,
-     43852L,43852L,43853L,43854L,43855L,43855L,43856L,43857L,
-     43858L,43858L,43859L,43860L,43861L,43861L,43862L,43863L,
-     43863L,43864L,43865L,43866L,43866L,43867L,43868L,43869L,
-     43869L,43870L,43871L,43872L,43872L,43873L,43874L,43875L,
-     43875L,43876L,43877L,43878L,43878L,43879L,43880L,43881L,
-     43881L,43882L,43883L,43884L,43884L,43885L,43886L,43887L,
-     43887L,43888L,43889L,43889L,43890L,43891L,43892L,43892L,
-     43893L,43894L,43895L,43895L,43896L,43897L,43898L,43898L,
-     43899L,43900L,43901L,43901L,43902L,43903L,43904L,43904L,
-     43905L,43906L,43907L,43907L,43908L,43909L,43910L,43910L,
-     43911L,43912L,43912L,43913L,43914L,43915L,43915L,43916L,
-     43917L,43918L,43918L,43919L,43920L,43921L,43921L,43922L,
-     43923L,43924L,43924L,43925L,43926L,43927L,43927L,43928L,
-     43929L,43930L,43930L,43931L,43932L,43933L,43933L,43934L,
-     43935L,43936L,43936L,43937L,43938L,43938L,43939L,43940L,
-     43941L,43941L,43942L,43943L,43944L,43944L,43945L,43946L,
-     43947L,43947L,43948L,43949L,43950L,43950L,43951L,43952L,
-     43953L,43953L,43954L,43955L,43956L,43956L,43957L,43958L,
-     43959L,43959L,43960L,43961L,43961L,43962L,43963L,43964L,
-     43964L,43965L,43966L,43967L,43967L,43968L,43969L,43970L,
-     43970L,43971L,43972L,43973L,43973L,43974L,43975L,43976L,
-     43976L,43977L,43978L,43979L,43979L,43980L,43981L,43981L,
-     43982L,43983L,43984L,43984L,43985L,43986L,43987L,43987L,
-     43988L,43989L,43990L,43990L,43991L,43992L,43993L,43993L,
-     43994L,43995L,43996L,43996L,43997L,43998L,43999L,43999L,
-     44000L,44001L,44002L,44002L,44003L,44004L,44004L,44005L,
-     44006L,44007L,44007L,44008L,44009L,44010L,44010L,44011L,
-     44012L,44013L,44013L,44014L,44015L,44016L,44016L,44017L,
-     44018L,44019L,44019L,44020L,44021L,44022L,44022L,44023L,
-     44024L,44024L,44025L,44026L,44027L,44027L,44028L,44029L,
-     44030L,44030L,44031L,44032L,44033L,44033L,44034L,44035L,
-     44036L,44036L,44037L,44038L,44039L,44039L,44040L,44041L,
-     44042L,44042L,44043L,44044L,44044L,44045L,44046L,44047L,
-     44047L,44048L,44049L,44050L,44050L,44051L,44052L,44053L,
-     44053L,44054L,44055L,44056L,44056L,44057L,44058L,44059L,
-     44059L,44060L,44061L,44061L,44062L,44063L,44064L,44064L,
-     44065L,44066L,44067L,44067L,44068L,44069L,44070L,44070L,
-     44071L,44072L,44073L,44073L,44074L,44075L,44076L,44076L,
-     44077L,44078L,44079L,44079L,44080L,44081L,44081L,44082L,
-     44083L,44084L,44084L,44085L,44086L,44087L,44087L,44088L,
-     44089L,44090L,44090L,44091L,44092L,44093L,44093L,44094L,
-     44095L,44096L,44096L,44097L,44098L,44098L,44099L,44100L,
-     44101L,44101L,44102L,44103L,44104L,44104L,44105L,44106L,
-     44107L,44107L,44108L,44109L,44110L,44110L,44111L,44112L,
-     44113L,44113L,44114L,44115L,44116L,44116L,44117L,44118L,
-     44118L,44119L,44120L,44121L,44121L,44122L,44123L,44124L,
-     44124L,44125L,44126L,44127L,44127L,44128L,44129L,44130L,
-     44130L,44131L,44132L,44133L,44133L,44134L,44135L,44135L,
-     44136L,44137L,44138L,44138L,44139L,44140L,44141L,44141L,
-     44142L,44143L,44144L,44144L,44145L,44146L,44147L,44147L,
-     44148L,44149L,44150L,44150L,44151L,44152L,44152L,44153L,
-     44154L,44155L,44155L,44156L,44157L,44158L,44158L,44159L,
-     44160L,44161L,44161L,44162L,44163L,44164L,44164L,44165L,
-     44166L,44167L,44167L,44168L,44169L,44169L,44170L,44171L,
-     44172L,44172L,44173L,44174L,44175L,44175L,44176L,44177L,
-     44178L,44178L,44179L,44180L,44181L,44181L,44182L,44183L,
-     44183L,44184L,44185L,44186L,44186L,44187L,44188L,44189L,
-     44189L,44190L,44191L,44192L,44192L,44193L,44194L,44195L,
-     44195L,44196L,44197L,44198L,44198L,44199L,44200L,44200L,
-     44201L,44202L,44203L,44203L,44204L,44205L,44206L,44206L,
-     44207L,44208L,44209L,44209L,44210L,44211L,44212L,44212L,
-     44213L,44214L,44215L,44215L,44216L,44217L,44217L,44218L,
-     44219L,44220L,44220L,44221L,44222L,44223L,44223L,44224L,
-     44225L,44226L,44226L,44227L,44228L,44229L,44229L,44230L,
-     44231L,44231L,44232L,44233L,44234L,44234L,44235L,44236L,
-     44237L,44237L,44238L,44239L,44240L,44240L,44241L,44242L,
-     44243L,44243L,44244L,44245L,44246L,44246L,44247L,44248L,
-     44248L,44249L,44250L,44251L,44251L,44252L,44253L,44254L,
-     44254L,44255L,44256L,44257L,44257L,44258L,44259L,44260L,
-     44260L,44261L,44262L,44262L,44263L,44264L,44265L,44265L,
-     44266L,44267L,44268L,44268L,44269L,44270L,44271L,44271L,
-     44272L,44273L,44274L,44274L,44275L,44276L,44276L,44277L,
-     44278L,44279L,44279L,44280L,44281L,44282L,44282L,44283L,
-     44284L,44285L,44285L,44286L,44287L,44288L,44288L,44289L,
-     44290L,44290L,44291L,44292L,44293L,44293L,44294L,44295L,
-     44296L,44296L,44297L,44298L,44299L,44299L,44300L,44301L,
-     44302L,44302L,44303L,44304L,44304L,44305L,44306L,44307L,
-     44307L,44308L,44309L,44310L,44310L,44311L,44312L,44313L,
-     44313L,44314L,44315L,44316L,44316L,44317L,44318L,44318L,
-     44319L,44320L,44321L,44321L,44322L,44323L,44324L,44324L,
-     44325L,44326L,44327L,44327L,44328L,44329L,44330L,44330L,
-     44331L,44332L,44332L,44333L,44334L,44335L,44335L,44336L,
-     44337L,44338L,44338L,44339L,44340L,44341L,44341L,44342L,
-     44343L,44344L,44344L,44345L,44346L,44346L,44347L,44348L,
-     44349L,44349L,44350L,44351L,44352L,44352L,44353L,44354L,
-     44355L,44355L,44356L,44357L,44358L,44358L,44359L,44360L,
-     44360L,44361L,44362L,44363L,44363L,44364L,44365L,44366L,
-     44366L,44367L,44368L,44369L,44369L,44370L,44371L,44371L,
-     44372L,44373L,44374L,44374L,44375L,44376L,44377L,44377L,
-     44378L,44379L,44380L,44380L,44381L,44382L,44383L,44383L,
-     44384L,44385L,44385L,44386L,44387L,44388L,44388L,44389L,
-     44390L,44391L,44391L,44392L,44393L,44394L,44394L,44395L,
-     44396L,44397L,44397L,44398L,44399L,44399L,44400L,44401L,
-     44402L,44402L,44403L,44404L,44405L,44405L,44406L,44407L,
-     44408L,44408L,44409L,44410L,44410L,44411L,44412L,44413L,
-     44413L,44414L,44415L,44416L,44416L,44417L,44418L,44419L,
-     44419L,44420L,44421L,44422L,44422L,44423L,44424L,44424L,
-     44425L,44426L,44427L,44427L,44428L,44429L,44430L,44430L,
-     44431L,44432L,44433L,44433L,44434L,44435L,44435L,44436L,
-     44437L,44438L,44438L,44439L,44440L,44441L,44441L,44442L,
-     44443L,44444L,44444L,44445L,44446L,44447L,44447L,44448L,
-     44449L,44449L,44450L,44451L,44452L,44452L,44453L,44454L,
-     44455L,44455L,44456L,44457L,44458L,44458L,44459L,44460L,
-     44460L,44461L,44462L,44463L,44463L,44464L,44465L,44466L,
-     44466L,44467L,44468L,44469L,44469L,44470L,44471L,44471L,
-     44472L,44473L,44474L,44474L,44475L,44476L,44477L,44477L,
-     44478L,44479L,44480L,44480L,44481L,44482L,44483L,44483L,
-     44484L,44485L,44485L,44486L,44487L,44488L,44488L,44489L,
-     44490L,44491L,44491L,44492L,44493L,44494L,44494L,44495L,
-     44496L,44496L,44497L,44498L,44499L,44499L,44500L,44501L,
-     44502L,44502L,44503L,44504L,44505L,44505L,44506L,44507L,
-     44507L,44508L,44509L,44510L,44510L,44511L,44512L,44513L,
-     44513L,44514L,44515L,44516L,44516L,44517L,44518L,44518L,
-     44519L,44520L,44521L,44521L,44522L,44523L,44524L,44524L,
-     44525L,44526L,44527L,44527L,44528L,44529L,44529L,44530L,
-     44531L,44532L,44532L,44533L,44534L,44535L,44535L,44536L,
-     44537L,44538L,44538L,44539L,44540L,44540L,44541L,44542L,
-     44543L,44543L,44544L,44545L,44546L,44546L,44547L,44548L,
-     44549L,44549L,44550L,44551L,44551L,44552L,44553L,44554L,
-     44554L,44555L,44556L,44557L,44557L,44558L,44559L,44560L,
-     44560L,44561L,44562L,44562L,44563L,44564L,44565L,44565L,
-     44566L,44567L,44568L,44568L,44569L,44570L,44571L,44571L,
-     44572L,44573L,44573L,44574L,44575L,44576L,44576L,44577L,
-     44578L,44579L,44579L,44580L,44581L,44582L,44582L,44583L,
-     44584L,44584L,44585L,44586L,44587L,44587L,44588L,44589L,
-     44590L,44590L,44591L,44592L,44593L,44593L,44594L,44595L,
-     44595L,44596L,44597L,44598L,44598L,44599L,44600L,44601L,
-     44601L,44602L,44603L,44604L,44604L,44605L,44606L,44606L,
-     44607L,44608L,44609L,44609L,44610L,44611L,44612L,44612L,
-     44613L,44614L,44615L,44615L,44616L,44617L,44617L,44618L,
-     44619L,44620L,44620L,44621L,44622L,44623L,44623L,44624L,
-     44625L,44626L,44626L,44627L,44628L,44628L,44629L,44630L,
-     44631L,44631L,44632L,44633L,44634L,44634L,44635L,44636L,
-     44636L,44637L,44638L,44639L,44639L,44640L,44641L,44642L,
-     44642L,44643L,44644L,44645L,44645L,44646L,44647L,44647L,
-     44648L,44649L,44650L,44650L,44651L,44652L,44653L,44653L,
-     44654L,44655L,44656L,44656L,44657L,44658L,44658L,44659L,
-     44660L,44661L,44661L,44662L,44663L,44664L,44664L,44665L,
-     44666L,44667L,44667L,44668L,44669L,44669L,44670L,44671L,
-     44672L,44672L,44673L,44674L,44675L,44675L,44676L,44677L,
-     44677L,44678L,44679L,44680L,44680L,44681L,44682L,44683L,
-     44683L,44684L,44685L,44686L,44686L,44687L,44688L,44688L,
-     44689L,44690L,44691L,44691L,44692L,44693L,44694L,44694L,
-     44695L,44696L,44696L,44697L,44698L,44699L,44699L,44700L,
-     44701L,44702L,44702L,44703L,44704L,44705L,44705L,44706L,
-     44707L,44707L,44708L,44709L,44710L,44710L,44711L,44712L,
-     44713L,44713L,44714L,44715L,44716L,44716L,44717L,44718L,
-     44718L,44719L,44720L,44721L,44721L,44722L,44723L,44724L,
-     44724L,44725L,44726L,44726L,44727L,44728L,44729L,44729L,
-     44730L,44731L,44732L,44732L,44733L,44734L,44735L,44735L,
-     44736L,44737L,44737L,44738L,44739L,44740L,44740L,44741L,
-     44742L,44743L,44743L,44744L,44745L,44745L,44746L,44747L,
-     44748L,44748L,44749L,44750L,44751L,44751L,44752L,44753L,
-     44754L,44754L,44755L,44756L,44756L,44757L,44758L,44759L,
-     44759L,44760L,44761L,44762L,44762L,44763L,44764L,44764L,
-     44765L,44766L,44767L,44767L,44768L,44769L,44770L,44770L,
-     44771L,44772L,44772L,44773L,44774L,44775L,44775L,44776L,
-     44777L,44778L,44778L,44779L,44780L,44781L,44781L,44782L,
-     44783L,44783L,44784L,44785L,44786L,44786L,44787L,44788L,
-     44789L,44789L,44790L,44791L,44791L,44792L,44793L,44794L,
-     44794L,44795L,44796L,44797L,44797L,44798L,44799L,44800L,
-     44800L,44801L,44802L,44802L,44803L,44804L,44805L,44805L,
-     44806L,44807L,44808L,44808L,44809L,44810L,44810L,44811L,
-     44812L,44813L,44813L,44814L,44815L,44816L,44816L,44817L,
-     44818L,44818L,44819L,44820L,44821L,44821L,44822L,44823L,
-     44824L,44824L,44825L,44826L,44827L,44827L,44828L,44829L,
-     44829L,44830L,44831L,44832L,44832L,44833L,44834L,44835L,
-     44835L,44836L,44837L,44837L,44838L,44839L,44840L,44840L,
-     44841L,44842L,44843L,44843L,44844L,44845L,44845L,44846L,
-     44847L,44848L,44848L,44849L,44850L,44851L,44851L,44852L,
-     44853L,44853L,44854L,44855L,44856L,44856L,44857L,44858L,
-     44859L,44859L,44860L,44861L,44862L,44862L,44863L,44864L,
-     44864L,44865L,44866L,44867L,44867L,44868L,44869L,44870L,
-     44870L,44871L,44872L,44872L,44873L,44874L,44875L,44875L,
-     44876L,44877L,44878L,44878L,44879L,44880L,44880L,44881L,
-     44882L,44883L,44883L,44884L,44885L,44886L,44886L,44887L,
-     44888L,44888L,44889L,44890L,44891L,44891L,44892L,44893L,
-     44894L,44894L,44895L,44896L,44896L,44897L,44898L,44899L,
-     44899L,44900L,44901L,44902L,44902L,44903L,44904L,44905L,
-     44905L,44906L,44907L,44907L,44908L,44909L,44910L,44910L,
-     44911L,44912L,44913L,44913L,44914L,44915L,44915L,44916L,
-     44917L,44918L,44918L,44919L,44920L,44921L,44921L,44922L,
-     44923L,44923L,44924L,44925L,44926L,44926L,44927L,44928L,
-     44929L,44929L,44930L,44931L,44931L,44932L,44933L,44934L,
-     44934L,44935L,44936L,44937L,44937L,44938L,44939L,44939L,
-     44940L,44941L,44942L,44942L,44943L,44944L,44945L,44945L,
-     44946L,44947L,44947L,44948L,44949L,44950L,44950L,44951L,
-     44952L,44953L,44953L,44954L,44955L,44955L,44956L,44957L,
-     44958L,44958L,44959L,44960L,44961L,44961L,44962L,44963L,
-     44963L,44964L,44965L,44966L,44966L,44967L,44968L,44969L,
-     44969L,44970L,44971L,44971L,44972L,44973L,44974L,44974L,
-     44975L,44976L,44977L,44977L,44978L,44979L,44979L,44980L,
-     44981L,44982L,44982L,44983L,44984L,44985L,44985L,44986L,
-     44987L,44987L,44988L,44989L,44990L,44990L,44991L,44992L,
-     44993L,44993L,44994L,44995L,44995L,44996L,44997L,44998L,
-     44998L,44999L,45000L,45001L,45001L,45002L,45003L,45003L,
-     45004L,45005L,45006L,45006L,45007L,45008L,45009L,45009L,
-     45010L,45011L,45011L,45012L,45013L,45014L,45014L,45015L,
-     45016L,45017L,45017L,45018L,45019L,45019L,45020L,45021L,
-     45022L,45022L,45023L,45024L,45025L,45025L,45026L,45027L,
-     45027L,45028L,45029L,45030L,45030L,45031L,45032L,45033L,
-     45033L,45034L,45035L,45035L,45036L,45037L,45038L,45038L,
-     45039L,45040L,45041L,45041L,45042L,45043L,45043L,45044L,
-     45045L,45046L,45046L,45047L,45048L,45049L,45049L,45050L,
-     45051L,45051L,45052L,45053L,45054L,45054L,45055L,45056L,
-     45057L,45057L,45058L,45059L,45059L,45060L,45061L,45062L,
-     45062L,45063L,45064L,45064L,45065L,45066L,45067L,45067L,
-     45068L,45069L,45070L,45070L,45071L,45072L,45072L,45073L,
-     45074L,45075L,45075L,45076L,45077L,45078L,45078L,45079L,
-     45080L,45080L,45081L,45082L,45083L,45083L,45084L,45085L,
-     45086L,45086L,45087L,45088L,45088L,45089L,45090L,45091L,
-     45091L,45092L,45093L,45094L,45094L,45095L,45096L,45096L,
-     45097L,45098L,45099L,45099L,45100L,45101L,45102L,45102L,
-     45103L,45104L,45104L,45105L,45106L,45107L,45107L,45108L,
-     45109L,45109L,45110L,45111L,45112L,45112L,45113L,45114L,
-     45115L,45115L,45116L,45117L,45117L,45118L,45119L,45120L,
-     45120L,45121L,45122L,45123L,45123L,45124L,45125L,45125L,
-     45126L,45127L,45128L,45128L,45129L,45130L,45131L,45131L,
-     45132L,45133L,45133L,45134L,45135L,45136L,45136L,45137L,
-     45138L,45138L,45139L,45140L,45141L,45141L,45142L,45143L,
-     45144L,45144L,45145L,45146L,45146L,45147L,45148L,45149L,
-     45149L,45150L,45151L,45152L,45152L,45153L,45154L,45154L,
-     45155L,45156L,45157L,45157L,45158L,45159L,45160L,45160L,
-     45161L,45162L,45162L,45163L,45164L,45165L,45165L,45166L,
-     45167L,45167L,45168L,45169L,45170L,45170L,45171L,45172L,
-     45173L,45173L,45174L,45175L,45175L,45176L,45177L,45178L,
-     45178L,45179L,45180L,45181L,45181L,45182L,45183L,45183L,
-     45184L,45185L,45186L,45186L,45187L,45188L,45188L,45189L,
-     45190L,45191L,45191L,45192L,45193L,45194L,45194L,45195L,
-     45196L,45196L,45197L,45198L,45199L,45199L,45200L,45201L,
-     45202L,45202L,45203L,45204L,45204L,45205L,45206L,45207L,
-     45207L,45208L,45209L,45209L,45210L,45211L,45212L,45212L,
-     45213L,45214L,45215L,45215L,45216L,45217L,45217L,45218L,
-     45219L,45220L,45220L,45221L,45222L,45223L,45223L,45224L,
-     45225L,45225L,45226L,45227L,45228L,45228L,45229L,45230L,
-     45230L,45231L,45232L,45233L,45233L,45234L,45235L,45236L,
-     45236L,45237L,45238L,45238L,45239L,45240L,45241L,45241L,
-     45242L,45243L,45244L,45244L,45245L,45246L,45246L,45247L,
-     45248L,45249L,45249L,45250L,45251L,45251L,45252L,45253L,
-     45254L,45254L,45255L,45256L,45257L,45257L,45258L,45259L,
-     45259L,45260L,45261L,45262L,45262L,45263L,45264L,45264L,
-     45265L,45266L,45267L,45267L,45268L,45269L,45270L,45270L,
-     45271L,45272L,45272L,45273L,45274L,45275L,45275L,45276L,
-     45277L,45277L,45278L,45279L,45280L,45280L,45281L,45282L,
-     45283L,45283L,45284L,45285L,45285L,45286L,45287L,45288L,
-     45288L,45289L,45290L,45291L,45291L,45292L,45293L,45293L,
-     45294L,45295L,45296L,45296L,45297L,45298L,45298L,45299L,
-     45300L,45301L,45301L,45302L,45303L,45304L,45304L,45305L,
-     45306L,45306L,45307L,45308L,45309L,45309L,45310L,45311L,
-     45311L,45312L,45313L,45314L,45314L,45315L,45316L,45317L,
-     45317L,45318L,45319L,45319L,45320L,45321L,45322L,45322L,
-     45323L,45324L,45324L,45325L,45326L,45327L,45327L,45328L,
-     45329L,45330L,45330L,45331L,45332L,45332L,45333L,45334L,
-     45335L,45335L,45336L,45337L,45337L,45338L,45339L,45340L,
-     45340L,45341L,45342L,45343L,45343L,45344L,45345L,45345L,
-     45346L,45347L,45348L,45348L,45349L,45350L,45350L,45351L,
-     45352L,45353L,45353L,45354L,45355L,45356L,45356L,45357L,
-     45358L,45358L,45359L,45360L,45361L,45361L,45362L,45363L,
-     45363L,45364L,45365L,45366L,45366L,45367L,45368L,45369L,
-     45369L,45370L,45371L,45371L,45372L,45373L,45374L,45374L,
-     45375L,45376L,45376L,45377L,45378L,45379L,45379L,45380L,
-     45381L,45381L,45382L,45383L,45384L,45384L,45385L,45386L,
-     45387L,45387L,45388L,45389L,45389L,45390L,45391L,45392L,
-     45392L,45393L,45394L,45394L,45395L,45396L,45397L,45397L,
-     45398L,45399L,45400L,45400L,45401L,45402L,45402L,45403L,
-     45404L,45405L,45405L,45406L,45407L,45407L,45408L,45409L,
-     45410L,45410L,45411L,45412L,45413L,45413L,45414L,45415L,
-     45415L,45416L,45417L,45418L,45418L,45419L,45420L,45420L,
-     45421L,45422L,45423L,45423L,45424L,45425L,45425L,45426L,
-     45427L,45428L,45428L,45429L,45430L,45431L,45431L,45432L,
-     45433L,45433L,45434L,45435L,45436L,45436L,45437L,45438L,
-     45438L,45439L,45440L,45441L,45441L,45442L,45443L,45444L,
-     45444L,45445L,45446L,45446L,45447L,45448L,45449L,45449L,
-     45450L,45451L,45451L,45452L,45453L,45454L,45454L,45455L,
-     45456L,45456L,45457L,45458L,45459L,45459L,45460L,45461L,
-     45462L,45462L,45463L,45464L,45464L,45465L,45466L,45467L,
-     45467L,45468L,45469L,45469L,45470L,45471L,45472L,45472L,
-     45473L,45474L,45474L,45475L,45476L,45477L,45477L,45478L,
-     45479L,45480L,45480L,45481L,45482L,45482L,45483L,45484L,
-     45485L,45485L,45486L,45487L,45487L,45488L,45489L,45490L,
-     45490L,45491L,45492L,45492L,45493L,45494L,45495L,45495L,
-     45496L,45497L,45498L,45498L,45499L,45500L,45500L,45501L,
-     45502L,45503L,45503L,45504L,45505L,45505L,45506L,45507L,
-     45508L,45508L,45509L,45510L,45510L,45511L,45512L,45513L,
-     45513L,45514L,45515L,45516L,45516L,45517L,45518L,45518L,
-     45519L,45520L,45521L,45521L,45522L,45523L,45523L,45524L,
-     45525L,45526L,45526L,45527L,45528L,45528L,45529L,45530L,
-     45531L,45531L,45532L,45533L,45533L,45534L,45535L,45536L,
-     45536L,45537L,45538L,45539L,45539L,45540L,45541L,45541L,
-     45542L,45543L,45544L,45544L,45545L,45546L,45546L,45547L,
-     45548L,45549L,45549L,45550L,45551L,45551L,45552L,45553L,
-     45554L,45554L,45555L,45556L,45556L,45557L,45558L,45559L,
-     45559L,45560L,45561L,45562L,45562L,45563L,45564L,45564L,
-     45565L,45566L,45567L,45567L,45568L,45569L,45569L,45570L,
-     45571L,45572L,45572L,45573L,45574L,45574L,45575L,45576L,
-     45577L,45577L,45578L,45579L,45579L,45580L,45581L,45582L,
-     45582L,45583L,45584L,45585L,45585L,45586L,45587L,45587L,
-     45588L,45589L,45590L,45590L,45591L,45592L,45592L,45593L,
-     45594L,45595L,45595L,45596L,45597L,45597L,45598L,45599L,
-     45600L,45600L,45601L,45602L,45602L,45603L,45604L,45605L,
-     45605L,45606L,45607L,45608L,45608L,45609L,45610L,45610L,
-     45611L,45612L,45613L,45613L,45614L,45615L,45615L,45616L,
-     45617L,45618L,45618L,45619L,45620L,45620L,45621L,45622L,
-     45623L,45623L,45624L,45625L,45625L,45626L,45627L,45628L,
-     45628L,45629L,45630L,45630L,45631L,45632L,45633L,45633L,
-     45634L,45635L,45636L,45636L,45637L,45638L,45638L,45639L,
-     45640L,45641L,45641L,45642L,45643L,45643L,45644L,45645L,
-     45646L,45646L,45647L,45648L,45648L,45649L,45650L,45651L,
-     45651L,45652L,45653L,45653L,45654L,45655L,45656L,45656L,
-     45657L,45658L,45658L,45659L,45660L,45661L,45661L,45662L,
-     45663L,45663L,45664L,45665L,45666L,45666L,45667L,45668L,
-     45669L,45669L,45670L,45671L,45671L,45672L,45673L,45674L,
-     45674L,45675L,45676L,45676L,45677L,45678L,45679L,45679L,
-     45680L,45681L,45681L,45682L,45683L,45684L,45684L,45685L,
-     45686L,45686L,45687L,45688L,45689L,45689L,45690L,45691L,
-     45691L,45692L,45693L,45694L,45694L,45695L,45696L,45696L,
-     45697L,45698L,45699L,45699L,45700L,45701L,45701L,45702L,
-     45703L,45704L,45704L,45705L,45706L,45707L,45707L,45708L,
-     45709L,45709L,45710L,45711L,45712L,45712L,45713L,45714L,
-     45714L,45715L,45716L,45717L,45717L,45718L,45719L,45719L,
-     45720L,45721L,45722L,45722L,45723L,45724L,45724L,45725L,
-     45726L,45727L,45727L,45728L,45729L,45729L,45730L,45731L,
-     45732L,45732L,45733L,45734L,45734L,45735L,45736L,45737L,
-     45737L,45738L,45739L,45739L,45740L,45741L,45742L,45742L,
-     45743L,45744L,45744L,45745L,45746L,45747L,45747L,45748L,
-     45749L,45749L,45750L,45751L,45752L,45752L,45753L,45754L,
-     45755L,45755L,45756L,45757L,45757L,45758L,45759L,45760L,
-     45760L,45761L,45762L,45762L,45763L,45764L,45765L,45765L,
-     45766L,45767L,45767L,45768L,45769L,45770L,45770L,45771L,
-     45772L,45772L,45773L,45774L,45775L,45775L,45776L,45777L,
-     45777L,45778L,45779L,45780L,45780L,45781L,45782L,45782L,
-     45783L,45784L,45785L,45785L,45786L,45787L,45787L,45788L,
-     45789L,45790L,45790L,45791L,45792L,45792L,45793L,45794L,
-     45795L,45795L,45796L,45797L,45797L,45798L,45799L,45800L,
-     45800L,45801L,45802L,45802L,45803L,45804L,45805L,45805L,
-     45806L,45807L,45807L,45808L,45809L,45810L,45810L,45811L,
-     45812L,45812L,45813L,45814L,45815L,45815L,45816L,45817L,
-     45817L,45818L,45819L,45820L,45820L,45821L,45822L,45822L,
-     45823L,45824L,45825L,45825L,45826L,45827L,45827L,45828L,
-     45829L,45830L,45830L,45831L,45832L,45832L,45833L,45834L,
-     45835L,45835L,45836L,45837L,45837L,45838L,45839L,45840L,
-     45840L,45841L,45842L,45842L,45843L,45844L,45845L,45845L,
-     45846L,45847L,45847L,45848L,45849L,45850L,45850L,45851L,
-     45852L,45852L,45853L,45854L,45855L,45855L,45856L,45857L,
-     45857L,45858L,45859L,45860L,45860L,45861L,45862L,45862L,
-     45863L,45864L,45865L,45865L,45866L,45867L,45867L,45868L,
-     45869L,45870L,45870L,45871L,45872L,45872L,45873L,45874L,
-     45875L,45875L,45876L,45877L,45877L,45878L,45879L,45880L,
-     45880L,45881L,45882L,45882L,45883L,45884L,45885L,45885L,
-     45886L,45887L,45887L,45888L,45889L,45890L,45890L,45891L,
-     45892L,45892L,45893L,45894L,45895L,45895L,45896L,45897L,
-     45897L,45898L,45899L,45900L,45900L,45901L,45902L,45902L,
-     45903L,45904L,45905L,45905L,45906L,45907L,45907L,45908L,
-     45909L,45910L,45910L,45911L,45912L,45912L,45913L,45914L,
-     45915L,45915L,45916L,45917L,45917L,45918L,45919L,45920L,
-     45920L,45921L,45922L,45922L,45923L,45924L,45925L,45925L,
-     45926L,45927L,45927L,45928L,45929L,45930L,45930L,45931L,
-     45932L,45932L,45933L,45934L,45935L,45935L,45936L,45937L,
-     45937L,45938L,45939L,45940L,45940L,45941L,45942L,45942L,
-     45943L,45944L,45945L,45945L,45946L,45947L,45947L,45948L,
-     45949L,45950L,45950L,45951L,45952L,45952L,45953L,45954L,
-     45955L,45955L,45956L,45957L,45957L,45958L,45959L,45960L,
-     45960L,45961L,45962L,45962L,45963L,45964L,45965L,45965L,
-     45966L,45967L,45967L,45968L,45969L,45970L,45970L,45971L,
-     45972L,45972L,45973L,45974L,45975L,45975L,45976L,45977L,
-     45977L,45978L,45979L,45979L,45980L,45981L,45982L,45982L,
-     45983L,45984L,45984L,45985L,45986L,45987L,45987L,45988L,
-     45989L,45989L,45990L,45991L,45992L,45992L,45993L,45994L,
-     45994L,45995L,45996L,45997L,45997L,45998L,45999L,45999L,
-     46000L,46001L,46002L,46002L,46003L,46004L,46004L,46005L,
-     46006L,46007L,46007L,46008L,46009L,46009L,46010L,46011L,
-     46012L,46012L,46013L,46014L,46014L,46015L,46016L,46017L,
-     46017L,46018L,46019L,46019L,46020L,46021L,46022L,46022L,
-     46023L,46024L,46024L,46025L,46026L,46026L,46027L,46028L,
-     46029L,46029L,46030L,46031L,46031L,46032L,46033L,46034L,
-     46034L,46035L,46036L,46036L,46037L,46038L,46039L,46039L,
-     46040L,46041L,46041L,46042L,46043L,46044L,46044L,46045L,
-     46046L,46046L,46047L,46048L,46049L,46049L,46050L,46051L,
-     46051L,46052L,46053L,46054L,46054L,46055L,46056L,46056L,
-     46057L,46058L,46059L,46059L,46060L,46061L,46061L,46062L,
-     46063L,46064L,46064L,46065L,46066L,46066L,46067L,46068L,
-     46068L,46069L,46070L,46071L,46071L,46072L,46073L,46073L,
-     46074L,46075L,46076L,46076L,46077L,46078L,46078L,46079L,
-     46080L,46081L,46081L,46082L,46083L,46083L,46084L,46085L,
-     46086L,46086L,46087L,46088L,46088L,46089L,46090L,46091L,
-     46091L,46092L,46093L,46093L,46094L,46095L,46096L,46096L,
-     46097L,46098L,46098L,46099L,46100L,46100L,46101L,46102L,
-     46103L,46103L,46104L,46105L,46105L,46106L,46107L,46108L,
-     46108L,46109L,46110L,46110L,46111L,46112L,46113L,46113L,
-     46114L,46115L,46115L,46116L,46117L,46118L,46118L,46119L,
-     46120L,46120L,46121L,46122L,46123L,46123L,46124L,46125L,
-     46125L,46126L,46127L,46127L,46128L,46129L,46130L,46130L,
-     46131L,46132L,46132L,46133L,46134L,46135L,46135L,46136L,
-     46137L,46137L,46138L,46139L,46140L,46140L,46141L,46142L,
-     46142L,46143L,46144L,46145L,46145L,46146L,46147L,46147L,
-     46148L,46149L,46149L,46150L,46151L,46152L,46152L,46153L,
-     46154L,46154L,46155L,46156L,46157L,46157L,46158L,46159L,
-     46159L,46160L,46161L,46162L,46162L,46163L,46164L,46164L,
-     46165L,46166L,46167L,46167L,46168L,46169L,46169L,46170L,
-     46171L,46171L,46172L,46173L,46174L,46174L,46175L,46176L,
-     46176L,46177L,46178L,46179L,46179L,46180L,46181L,46181L,
-     46182L,46183L,46184L,46184L,46185L,46186L,46186L,46187L,
-     46188L,46189L,46189L,46190L,46191L,46191L,46192L,46193L,
-     46193L,46194L,46195L,46196L,46196L,46197L,46198L,46198L,
-     46199L,46200L,46201L,46201L,46202L,46203L,46203L,46204L,
-     46205L,46206L,46206L,46207L,46208L,46208L,46209L,46210L,
-     46211L,46211L,46212L,46213L,46213L,46214L,46215L,46215L,
-     46216L,46217L,46218L,46218L,46219L,46220L,46220L,46221L,
-     46222L,46223L,46223L,46224L,46225L,46225L,46226L,46227L,
-     46228L,46228L,46229L,46230L,46230L,46231L,46232L,46232L,
-     46233L,46234L,46235L,46235L,46236L,46237L,46237L,46238L,
-     46239L,46240L,46240L,46241L,46242L,46242L,46243L,46244L,
-     46245L,46245L,46246L,46247L,46247L,46248L,46249L,46249L,
-     46250L,46251L,46252L,46252L,46253L,46254L,46254L,46255L,
-     46256L,46257L,46257L,46258L,46259L,46259L,46260L,46261L,
-     46262L,46262L,46263L,46264L,46264L,46265L,46266L,46266L,
-     46267L,46268L,46269L,46269L,46270L,46271L,46271L,46272L,
-     46273L,46274L,46274L,46275L,46276L,46276L,46277L,46278L,
-     46279L,46279L,46280L,46281L,46281L,46282L,46283L,46283L,
-     46284L,46285L,46286L,46286L,46287L,46288L,46288L,46289L,
-     46290L,46291L,46291L,46292L,46293L,46293L,46294L,46295L,
-     46296L,46296L,46297L,46298L,46298L,46299L,46300L,46300L,
-     46301L,46302L,46303L,46303L,46304L,46305L,46305L,46306L,
-     46307L,46308L,46308L,46309L,46310L,46310L,46311L,46312L,
-     46313L,46313L,46314L,46315L,46315L,46316L,46317L,46317L,
-     46318L,46319L,46320L,46320L,46321L,46322L,46322L,46323L,
-     46324L,46325L,46325L,46326L,46327L,46327L,46328L,46329L,
-     46329L,46330L,46331L,46332L,46332L,46333L,46334L,46334L,
-     46335L,46336L,46337L,46337L,46338L,46339L,46339L,46340L,
-     46341L,46342L,46342L,46343L,46344L,46344L,46345L,46346L,
-     46346L,46347L,46348L,46349L,46349L,46350L,46351L,46351L,
-     46352L,46353L,46354L,46354L,46355L,46356L,46356L,46357L,
-     46358L,46358L,46359L,46360L,46361L,46361L,46362L,46363L,
-     46363L,46364L,46365L,46366L,46366L,46367L,46368L,46368L,
-     46369L,46370L,46370L,46371L,46372L,46373L,46373L,46374L,
-     46375L,46375L,46376L,46377L,46378L,46378L,46379L,46380L,
-     46380L,46381L,46382L,46383L,46383L,46384L,46385L,46385L,
-     46386L,46387L,46387L,46388L,46389L,46390L,46390L,46391L,
-     46392L,46392L,46393L,46394L,46395L,46395L,46396L,46397L,
-     46397L,46398L,46399L,46399L,46400L,46401L,46402L,46402L,
-     46403L,46404L,46404L,46405L,46406L,46407L,46407L,46408L,
-     46409L,46409L,46410L,46411L,46411L,46412L,46413L,46414L,
-     46414L,46415L,46416L,46416L,46417L,46418L,46419L,46419L,
-     46420L,46421L,46421L,46422L,46423L,46423L,46424L,46425L,
-     46426L,46426L,46427L,46428L,46428L,46429L,46430L,46431L,
-     46431L,46432L,46433L,46433L,46434L,46435L,46435L,46436L,
-     46437L,46438L,46438L,46439L,46440L,46440L,46441L,46442L,
-     46443L,46443L,46444L,46445L,46445L,46446L,46447L,46447L,
-     46448L,46449L,46450L,46450L,46451L,46452L,46452L,46453L,
-     46454L,46455L,46455L,46456L,46457L,46457L,46458L,46459L,
-     46459L,46460L,46461L,46462L,46462L,46463L,46464L,46464L,
-     46465L,46466L,46466L,46467L,46468L,46469L,46469L,46470L,
-     46471L,46471L,46472L,46473L,46474L,46474L,46475L,46476L,
-     46476L,46477L,46478L,46478L,46479L,46480L,46481L,46481L,
-     46482L,46483L,46483L,46484L,46485L,46486L,46486L,46487L,
-     46488L,46488L,46489L,46490L,46490L,46491L,46492L,46493L,
-     46493L,46494L,46495L,46495L,46496L,46497L,46498L,46498L,
-     46499L,46500L,46500L,46501L,46502L,46502L,46503L,46504L,
-     46505L,46505L,46506L,46507L,46507L,46508L,46509L,46509L,
-     46510L,46511L,46512L,46512L,46513L,46514L,46514L,46515L,
-     46516L,46517L,46517L,46518L,46519L,46519L,46520L,46521L,
-     46521L,46522L,46523L,46524L,46524L,46525L,46526L,46526L,
-     46527L,46528L,46529L,46529L,46530L,46531L,46531L,46532L,
-     46533L,46533L,46534L,46535L,46536L,46536L,46537L,46538L,
-     46538L,46539L,46540L,46540L,46541L,46542L,46543L,46543L,
-     46544L,46545L,46545L,46546L,46547L,46548L,46548L,46549L,
-     46550L,46550L,46551L,46552L,46552L,46553L,46554L,46555L,
-     46555L,46556L,46557L,46557L,46558L,46559L,46559L,46560L,
-     46561L,46562L,46562L,46563L,46564L,46564L,46565L,46566L,
-     46567L,46567L,46568L,46569L,46569L,46570L,46571L,46571L,
-     46572L,46573L,46574L,46574L,46575L,46576L,46576L,46577L,
-     46578L,46578L,46579L,46580L,46581L,46581L,46582L,46583L,
-     46583L,46584L,46585L,46586L,46586L,46587L,46588L,46588L,
-     46589L,46590L,46590L,46591L,46592L,46593L,46593L,46594L,
-     46595L,46595L,46596L,46597L,46597L,46598L,46599L,46600L,
-     46600L,46601L,46602L,46602L,46603L,46604L,46605L,46605L,
-     46606L,46607L,46607L,46608L,46609L,46609L,46610L,46611L,
-     46612L,46612L,46613L,46614L,46614L,46615L,46616L,46616L,
-     46617L,46618L,46619L,46619L,46620L,46621L,46621L,46622L,
-     46623L,46623L,46624L,46625L,46626L,46626L,46627L,46628L,
-     46628L,46629L,46630L,46631L,46631L,46632L,46633L,46633L,
-     46634L,46635L,46635L,46636L,46637L,46638L,46638L,46639L,
-     46640L,46640L,46641L,46642L,46642L,46643L,46644L,46645L,
-     46645L,46646L,46647L,46647L,46648L,46649L,46649L,46650L,
-     46651L,46652L,46652L,46653L,46654L,46654L,46655L,46656L,
-     46657L,46657L,46658L,46659L,46659L,46660L,46661L,46661L,
-     46662L,46663L,46664L,46664L,46665L,46666L,46666L,46667L,
-     46668L,46668L,46669L,46670L,46671L,46671L,46672L,46673L,
-     46673L,46674L,46675L,46675L,46676L,46677L,46678L,46678L,
-     46679L,46680L,46680L,46681L,46682L,46682L,46683L,46684L,
-     46685L,46685L,46686L,46687L,46687L,46688L,46689L,46689L,
-     46690L,46691L,46692L,46692L,46693L,46694L,46694L,46695L,
-     46696L,46697L,46697L,46698L,46699L,46699L,46700L,46701L,
-     46701L,46702L,46703L,46704L,46704L,46705L,46706L,46706L,
-     46707L,46708L,46708L,46709L,46710L,46711L,46711L,46712L,
-     46713L,46713L,46714L,46715L,46715L,46716L,46717L,46718L,
-     46718L,46719L,46720L,46720L,46721L,46722L,46722L,46723L,
-     46724L,46725L,46725L,46726L,46727L,46727L,46728L,46729L,
-     46729L,46730L,46731L,46732L,46732L,46733L,46734L,46734L,
-     46735L,46736L,46736L,46737L,46738L,46739L,46739L,46740L,
-     46741L,46741L,46742L,46743L,46743L,46744L,46745L,46746L,
-     46746L,46747L,46748L,46748L,46749L,46750L,46751L,46751L,
-     46752L,46753L,46753L,46754L,46755L,46755L,46756L,46757L,
-     46758L,46758L,46759L,46760L,46760L,46761L,46762L,46762L,
-     46763L,46764L,46765L,46765L,46766L,46767L,46767L,46768L,
-     46769L,46769L,46770L,46771L,46772L,46772L,46773L,46774L,
-     46774L,46775L,46776L,46776L,46777L,46778L,46779L,46779L,
-     46780L,46781L,46781L,46782L,46783L,46783L,46784L,46785L,
-     46786L,46786L,46787L,46788L,46788L,46789L,46790L,46790L,
-     46791L,46792L,46793L,46793L,46794L,46795L,46795L,46796L,
-     46797L,46797L,46798L,46799L,46800L,46800L,46801L,46802L,
-     46802L,46803L,46804L,46804L,46805L,46806L,46807L,46807L,
-     46808L,46809L,46809L,46810L,46811L,46811L,46812L,46813L,
-     46814L,46814L,46815L,46816L,46816L,46817L,46818L,46818L,
-     46819L,46820L,46821L,46821L,46822L,46823L,46823L,46824L,
-     46825L,46825L,46826L,46827L,46828L,46828L,46829L,46830L,
-     46830L,46831L,46832L,46832L,46833L,46834L,46835L,46835L,
-     46836L,46837L,46837L,46838L,46839L,46839L,46840L,46841L,
-     46842L,46842L,46843L,46844L,46844L,46845L,46846L,46846L,
-     46847L,46848L,46849L,46849L,46850L,46851L,46851L,46852L,
-     46853L,46853L,46854L,46855L,46856L,46856L,46857L,46858L,
-     46858L,46859L,46860L,46860L,46861L,46862L,46862L,46863L,
-     46864L,46865L,46865L,46866L,46867L,46867L,46868L,46869L,
-     46869L,46870L,46871L,46872L,46872L,46873L,46874L,46874L,
-     46875L,46876L,46876L,46877L,46878L,46879L,46879L,46880L,
-     46881L,46881L,46882L,46883L,46883L,46884L,46885L,46886L,
-     46886L,46887L,46888L,46888L,46889L,46890L,46890L,46891L,
-     46892L,46893L,46893L,46894L,46895L,46895L,46896L,46897L,
-     46897L,46898L,46899L,46900L,46900L,46901L,46902L,46902L,
-     46903L,46904L,46904L,46905L,46906L,46907L,46907L,46908L,
-     46909L,46909L,46910L,46911L,46911L,46912L,46913L,46913L,
-     46914L,46915L,46916L,46916L,46917L,46918L,46918L,46919L,
-     46920L,46920L,46921L,46922L,46923L,46923L,46924L,46925L,
-     46925L,46926L,46927L,46927L,46928L,46929L,46930L,46930L,
-     46931L,46932L,46932L,46933L,46934L,46934L,46935L,46936L,
-     46937L,46937L,46938L,46939L,46939L,46940L,46941L,46941L,
-     46942L,46943L,46944L,46944L,46945L,46946L,46946L,46947L,
-     46948L,46948L,46949L,46950L,46950L,46951L,46952L,46953L,
-     46953L,46954L,46955L,46955L,46956L,46957L,46957L,46958L,
-     46959L,46960L,46960L,46961L,46962L,46962L,46963L,46964L,
-     46964L,46965L,46966L,46967L,46967L,46968L,46969L,46969L,
-     46970L,46971L,46971L,46972L,46973L,46974L,46974L,46975L,
-     46976L,46976L,46977L,46978L,46978L,46979L,46980L,46980L,
-     46981L,46982L,46983L,46983L,46984L,46985L,46985L,46986L,
-     46987L,46987L,46988L,46989L,46990L,46990L,46991L,46992L,
-     46992L,46993L,46994L,46994L,46995L,46996L,46997L,46997L,
-     46998L,46999L,46999L,47000L,47001L,47001L,47002L,47003L,
-     47003L,47004L,47005L,47006L,47006L,47007L,47008L,47008L,
-     47009L,47010L,47010L,47011L,47012L,47013L,47013L,47014L,
-     47015L,47015L,47016L,47017L,47017L,47018L,47019L,47020L,
-     47020L,47021L,47022L,47022L,47023L,47024L,47024L,47025L,
-     47026L,47026L,47027L,47028L,47029L,47029L,47030L,47031L,
-     47031L,47032L,47033L,47033L,47034L,47035L,47036L,47036L,
-     47037L,47038L,47038L,47039L,47040L,47040L,47041L,47042L,
-     47042L,47043L,47044L,47045L,47045L,47046L,47047L,47047L,
-     47048L,47049L,47049L,47050L,47051L,47052L,47052L,47053L,
-     47054L,47054L,47055L,47056L,47056L,47057L,47058L,47058L,
-     47059L,47060L,47061L,47061L,47062L,47063L,47063L,47064L,
-     47065L,47065L,47066L,47067L,47068L,47068L,47069L,47070L,
-     47070L,47071L,47072L,47072L,47073L,47074L,47075L,47075L,
-     47076L,47077L,47077L,47078L,47079L,47079L,47080L,47081L,
-     47081L,47082L,47083L,47084L,47084L,47085L,47086L,47086L,
-     47087L,47088L,47088L,47089L,47090L,47091L,47091L,47092L,
-     47093L,47093L,47094L,47095L,47095L,47096L,47097L,47097L,
-     47098L,47099L,47100L,47100L,47101L,47102L,47102L,47103L,
-     47104L,47104L,47105L,47106L,47106L,47107L,47108L,47109L,
-     47109L,47110L,47111L,47111L,47112L,47113L,47113L,47114L,
-     47115L,47116L,47116L,47117L,47118L,47118L,47119L,47120L,
-     47120L,47121L,47122L,47122L,47123L,47124L,47125L,47125L,
-     47126L,47127L,47127L,47128L,47129L,47129L,47130L,47131L,
-     47132L,47132L,47133L,47134L,47134L,47135L,47136L,47136L,
-     47137L,47138L,47138L,47139L,47140L,47141L,47141L,47142L,
-     47143L,47143L,47144L,47145L,47145L,47146L,47147L,47147L,
-     47148L,47149L,47150L,47150L,47151L,47152L,47152L,47153L,
-     47154L,47154L,47155L,47156L,47157L,47157L,47158L,47159L,
-     47159L,47160L,47161L,47161L,47162L,47163L,47163L,47164L,
-     47165L,47166L,47166L,47167L,47168L,47168L,47169L,47170L,
-     47170L,47171L,47172L,47172L,47173L,47174L,47175L,47175L,
-     47176L,47177L,47177L,47178L,47179L,47179L,47180L,47181L,
-     47182L,47182L,47183L,47184L,47184L,47185L,47186L,47186L,
-     47187L,47188L,47188L,47189L,47190L,47191L,47191L,47192L,
-     47193L,47193L,47194L,47195L,47195L,47196L,47197L,47197L,
-     47198L,47199L,47200L,47200L,47201L,47202L,47202L,47203L,
-     47204L,47204L,47205L,47206L,47206L,47207L,47208L,47209L,
-     47209L,47210L,47211L,47211L,47212L,47213L,47213L,47214L,
-     47215L,47216L,47216L,47217L,47218L,47218L,47219L,47220L,
-     47220L,47221L,47222L,47222L,47223L,47224L,47225L,47225L,
-     47226L,47227L,47227L,47228L,47229L,47229L,47230L,47231L,
-     47231L,47232L,47233L,47234L,47234L,47235L,47236L,47236L,
-     47237L,47238L,47238L,47239L,47240L,47240L,47241L,47242L,
-     47243L,47243L,47244L,47245L,47245L,47246L,47247L,47247L,
-     47248L,47249L,47249L,47250L,47251L,47252L,47252L,47253L,
-     47254L,47254L,47255L,47256L,47256L,47257L,47258L,47258L,
-     47259L,47260L,47261L,47261L,47262L,47263L,47263L,47264L,
-     47265L,47265L,47266L,47267L,47267L,47268L,47269L,47270L,
-     47270L,47271L,47272L,47272L,47273L,47274L,47274L,47275L,
-     47276L,47276L,47277L,47278L,47279L,47279L,47280L,47281L,
-     47281L,47282L,47283L,47283L,47284L,47285L,47285L,47286L,
-     47287L,47288L,47288L,47289L,47290L,47290L,47291L,47292L,
-     47292L,47293L,47294L,47294L,47295L,47296L,47297L,47297L,
-     47298L,47299L,47299L,47300L,47301L,47301L,47302L,47303L,
-     47303L,47304L,47305L,47306L,47306L,47307L,47308L,47308L,
-     47309L,47310L,47310L,47311L,47312L,47312L,47313L,47314L,
-     47315L,47315L,47316L,47317L,47317L,47318L,47319L,47319L,
-     47320L,47321L,47321L,47322L,47323L,47324L,47324L,47325L,
-     47326L,47326L,47327L,47328L,47328L,47329L,47330L,47330L,
-     47331L,47332L,47333L,47333L,47334L,47335L,47335L,47336L,
-     47337L,47337L,47338L,47339L,47339L,47340L,47341L,47342L,
-     47342L,47343L,47344L,47344L,47345L,47346L,47346L,47347L,
-     47348L,47348L,47349L,47350L,47351L,47351L,47352L,47353L,
-     47353L,47354L,47355L,47355L,47356L,47357L,47357L,47358L,
-     47359L,47360L,47360L,47361L,47362L,47362L,47363L,47364L,
-     47364L,47365L,47366L,47366L,47367L,47368L,47369L,47369L,
-     47370L,47371L,47371L,47372L,47373L,47373L,47374L,47375L,
-     47375L,47376L,47377L,47377L,47378L,47379L,47380L,47380L,
-     47381L,47382L,47382L,47383L,47384L,47384L,47385L,47386L,
-     47386L,47387L,47388L,47389L,47389L,47390L,47391L,47391L,
-     47392L,47393L,47393L,47394L,47395L,47395L,47396L,47397L,
-     47398L,47398L,47399L,47400L,47400L,47401L,47402L,47402L,
-     47403L,47404L,47404L,47405L,47406L,47406L,47407L,47408L,
-     47409L,47409L,47410L,47411L,47411L,47412L,47413L,47413L,
-     47414L,47415L,47415L,47416L,47417L,47418L,47418L,47419L,
-     47420L,47420L,47421L,47422L,47422L,47423L,47424L,47424L,
-     47425L,47426L,47427L,47427L,47428L,47429L,47429L,47430L,
-     47431L,47431L,47432L,47433L,47433L,47434L,47435L,47435L,
-     47436L,47437L,47438L,47438L,47439L,47440L,47440L,47441L,
-     47442L,47442L,47443L,47444L,47444L,47445L,47446L,47447L,
-     47447L,47448L,47449L,47449L,47450L,47451L,47451L,47452L,
-     47453L,47453L,47454L,47455L,47455L,47456L,47457L,47458L,
-     47458L,47459L,47460L,47460L,47461L,47462L,47462L,47463L,
-     47464L,47464L,47465L,47466L,47467L,47467L,47468L,47469L,
-     47469L,47470L,47471L,47471L,47472L,47473L,47473L,47474L,
-     47475L,47475L,47476L,47477L,47478L,47478L,47479L,47480L,
-     47480L,47481L,47482L,47482L,47483L,47484L,47484L,47485L,
-     47486L,47487L,47487L,47488L,47489L,47489L,47490L,47491L,
-     47491L,47492L,47493L,47493L,47494L,47495L,47495L,47496L,
-     47497L,47498L,47498L,47499L,47500L,47500L,47501L,47502L,
-     47502L,47503L,47504L,47504L,47505L,47506L,47506L,47507L,
-     47508L,47509L,47509L,47510L,47511L,47511L,47512L,47513L,
-     47513L,47514L,47515L,47515L,47516L,47517L,47518L,47518L,
-     47519L,47520L,47520L,47521L,47522L,47522L,47523L,47524L,
-     47524L,47525L,47526L,47526L,47527L,47528L,47529L,47529L,
-     47530L,47531L,47531L,47532L,47533L,47533L,47534L,47535L,
-     47535L,47536L,47537L,47537L,47538L,47539L,47540L,47540L,
-     47541L,47542L,47542L,47543L,47544L,47544L,47545L,47546L,
-     47546L,47547L,47548L,47548L,47549L,47550L,47551L,47551L,
-     47552L,47553L,47553L,47554L,47555L,47555L,47556L,47557L,
-     47557L,47558L,47559L,47560L,47560L,47561L,47562L,47562L,
-     47563L,47564L,47564L,47565L,47566L,47566L,47567L,47568L,
-     47568L,47569L,47570L,47571L,47571L,47572L,47573L,47573L,
-     47574L,47575L,47575L,47576L,47577L,47577L,47578L,47579L,
-     47579L,47580L,47581L,47582L,47582L,47583L,47584L,47584L,
-     47585L,47586L,47586L,47587L,47588L,47588L,47589L,47590L,
-     47590L,47591L,47592L,47593L,47593L,47594L,47595L,47595L,
-     47596L,47597L,47597L,47598L,47599L,47599L,47600L,47601L,
-     47601L,47602L,47603L,47604L,47604L,47605L,47606L,47606L,
-     47607L,47608L,47608L,47609L,47610L,47610L,47611L,47612L,
-     47612L,47613L,47614L,47615L,47615L,47616L,47617L,47617L,
-     47618L,47619L,47619L,47620L,47621L,47621L,47622L,47623L,
-     47623L,47624L,47625L,47626L,47626L,47627L,47628L,47628L,
-     47629L,47630L,47630L,47631L,47632L,47632L,47633L,47634L,
-     47634L,47635L,47636L,47636L,47637L,47638L,47639L,47639L,
-     47640L,47641L,47641L,47642L,47643L,47643L,47644L,47645L,
-     47645L,47646L,47647L,47647L,47648L,47649L,47650L,47650L,
-     47651L,47652L,47652L,47653L,47654L,47654L,47655L,47656L,
-     47656L,47657L,47658L,47658L,47659L,47660L,47661L,47661L,
-     47662L,47663L,47663L,47664L,47665L,47665L,47666L,47667L,
-     47667L,47668L,47669L,47669L,47670L,47671L,47672L,47672L,
-     47673L,47674L,47674L,47675L,47676L,47676L,47677L,47678L,
-     47678L,47679L,47680L,47680L,47681L,47682L,47682L,47683L,
-     47684L,47685L,47685L,47686L,47687L,47687L,47688L,47689L,
-     47689L,47690L,47691L,47691L,47692L,47693L,47693L,47694L,
-     47695L,47696L,47696L,47697L,47698L,47698L,47699L,47700L,
-     47700L,47701L,47702L,47702L,47703L,47704L,47704L,47705L,
-     47706L,47706L,47707L,47708L,47709L,47709L,47710L,47711L,
-     47711L,47712L,47713L,47713L,47714L,47715L,47715L,47716L,
-     47717L,47717L,47718L,47719L,47720L,47720L,47721L,47722L,
-     47722L,47723L,47724L,47724L,47725L,47726L,47726L,47727L,
-     47728L,47728L,47729L,47730L,47730L,47731L,47732L,47733L,
-     47733L,47734L,47735L,47735L,47736L,47737L,47737L,47738L,
-     47739L,47739L,47740L,47741L,47741L,47742L,47743L,47743L,
-     47744L,47745L,47746L,47746L,47747L,47748L,47748L,47749L,
-     47750L,47750L,47751L,47752L,47752L,47753L,47754L,47754L,
-     47755L,47756L,47757L,47757L,47758L,47759L,47759L,47760L,
-     47761L,47761L,47762L,47763L,47763L,47764L,47765L,47765L,
-     47766L,47767L,47767L,47768L,47769L,47770L,47770L,47771L,
-     47772L,47772L,47773L,47774L,47774L,47775L,47776L,47776L,
-     47777L,47778L,47778L,47779L,47780L,47780L,47781L,47782L,
-     47783L,47783L,47784L,47785L,47785L,47786L,47787L,47787L,
-     47788L,47789L,47789L,47790L,47791L,47791L,47792L,47793L,
-     47793L,47794L,47795L,47796L,47796L,47797L,47798L,47798L,
-     47799L,47800L,47800L,47801L,47802L,47802L,47803L,47804L,
-     47804L,47805L,47806L,47806L,47807L,47808L,47809L,47809L,
-     47810L,47811L,47811L,47812L,47813L,47813L,47814L,47815L,
-     47815L,47816L,47817L,47817L,47818L,47819L,47819L,47820L,
-     47821L,47822L,47822L,47823L,47824L,47824L,47825L,47826L,
-     47826L,47827L,47828L,47828L,47829L,47830L,47830L,47831L,
-     47832L,47832L,47833L,47834L,47835L,47835L,47836L,47837L,
-     47837L,47838L,47839L,47839L,47840L,47841L,47841L,47842L,
-     47843L,47843L,47844L,47845L,47845L,47846L,47847L,47847L,
-     47848L,47849L,47850L,47850L,47851L,47852L,47852L,47853L,
-     47854L,47854L,47855L,47856L,47856L,47857L,47858L,47858L,
-     47859L,47860L,47860L,47861L,47862L,47863L,47863L,47864L,
-     47865L,47865L,47866L,47867L,47867L,47868L,47869L,47869L,
-     47870L,47871L,47871L,47872L,47873L,47873L,47874L,47875L,
-     47875L,47876L,47877L,47878L,47878L,47879L,47880L,47880L,
-     47881L,47882L,47882L,47883L,47884L,47884L,47885L,47886L,
-     47886L,47887L,47888L,47888L,47889L,47890L,47891L,47891L,
-     47892L,47893L,47893L,47894L,47895L,47895L,47896L,47897L,
-     47897L,47898L,47899L,47899L,47900L,47901L,47901L,47902L,
-     47903L,47903L,47904L,47905L,47906L,47906L,47907L,47908L,
-     47908L,47909L,47910L,47910L,47911L,47912L,47912L,47913L,
-     47914L,47914L,47915L,47916L,47916L,47917L,47918L,47918L,
-     47919L,47920L,47921L,47921L,47922L,47923L,47923L,47924L,
-     47925L,47925L,47926L,47927L,47927L,47928L,47929L,47929L,
-     47930L,47931L,47931L,47932L,47933L,47934L,47934L,47935L,
-     47936L,47936L,47937L,47938L,47938L,47939L,47940L,47940L,
-     47941L,47942L,47942L,47943L,47944L,47944L,47945L,47946L,
-     47946L,47947L,47948L,47949L,47949L,47950L,47951L,47951L,
-     47952L,47953L,47953L,47954L,47955L,47955L,47956L,47957L,
-     47957L,47958L,47959L,47959L,47960L,47961L,47961L,47962L,
-     47963L,47963L,47964L,47965L,47966L,47966L,47967L,47968L,
-     47968L,47969L,47970L,47970L,47971L,47972L,47972L,47973L,
-     47974L,47974L,47975L,47976L,47976L,47977L,47978L,47978L,
-     47979L,47980L,47981L,47981L,47982L,47983L,47983L,47984L,
-     47985L,47985L,47986L,47987L,47987L,47988L,47989L,47989L,
-     47990L,47991L,47991L,47992L,47993L,47993L,47994L,47995L,
-     47996L,47996L,47997L,47998L,47998L,47999L,48000L,48000L,
-     48001L,48002L,48002L,48003L,48004L,48004L,48005L,48006L,
-     48006L,48007L,48008L,48008L,48009L,48010L,48010L,48011L,
-     48012L,48013L,48013L,48014L,48015L,48015L,48016L,48017L,
-     48017L,48018L,48019L,48019L,48020L,48021L,48021L,48022L,
-     48023L,48023L,48024L,48025L,48025L,48026L,48027L,48028L,
-     48028L,48029L,48030L,48030L,48031L,48032L,48032L,48033L,
-     48034L,48034L,48035L,48036L,48036L,48037L,48038L,48038L,
-     48039L,48040L,48040L,48041L,48042L,48042L,48043L,48044L,
-     48045L,48045L,48046L,48047L,48047L,48048L,48049L,48049L,
-     48050L,48051L,48051L,48052L,48053L,48053L,48054L,48055L,
-     48055L,48056L,48057L,48057L,48058L,48059L,48059L,48060L,
-     48061L,48062L,48062L,48063L,48064L,48064L,48065L,48066L,
-     48066L,48067L,48068L,48068L,48069L,48070L,48070L,48071L,
-     48072L,48072L,48073L,48074L,48074L,48075L,48076L,48076L,
-     48077L,48078L,48079L,48079L,48080L,48081L,48081L,48082L,
-     48083L,48083L,48084L,48085L,48085L,48086L,48087L,48087L,
-     48088L,48089L,48089L,48090L,48091L,48091L,48092L,48093L,
-     48093L,48094L,48095L,48095L,48096L,48097L,48098L,48098L,
-     48099L,48100L,48100L,48101L,48102L,48102L,48103L,48104L,
-     48104L,48105L,48106L,48106L,48107L,48108L,48108L,48109L,
-     48110L,48110L,48111L,48112L,48112L,48113L,48114L,48115L,
-     48115L,48116L,48117L,48117L,48118L,48119L,48119L,48120L,
-     48121L,48121L,48122L,48123L,48123L,48124L,48125L,48125L,
-     48126L,48127L,48127L,48128L,48129L,48129L,48130L,48131L,
-     48131L,48132L,48133L,48134L,48134L,48135L,48136L,48136L,
-     48137L,48138L,48138L,48139L,48140L,48140L,48141L,48142L,
-     48142L,48143L,48144L,48144L,48145L,48146L,48146L,48147L,
-     48148L,48148L,48149L,48150L,48150L,48151L,48152L,48153L,
-     48153L,48154L,48155L,48155L,48156L,48157L,48157L,48158L,
-     48159L,48159L,48160L,48161L,48161L,48162L,48163L,48163L,
-     48164L,48165L,48165L,48166L,48167L,48167L,48168L,48169L,
-     48169L,48170L,48171L,48171L,48172L,48173L,48174L,48174L,
-     48175L,48176L,48176L,48177L,48178L,48178L,48179L,48180L,
-     48180L,48181L,48182L,48182L,48183L,48184L,48184L,48185L,
-     48186L,48186L,48187L,48188L,48188L,48189L,48190L,48190L,
-     48191L,48192L,48193L,48193L,48194L,48195L,48195L,48196L,
-     48197L,48197L,48198L,48199L,48199L,48200L,48201L,48201L,
-     48202L,48203L,48203L,48204L,48205L,48205L,48206L,48207L,
-     48207L,48208L,48209L,48209L,48210L,48211L,48211L,48212L,
-     48213L,48214L,48214L,48215L,48216L,48216L,48217L,48218L,
-     48218L,48219L,48220L,48220L,48221L,48222L,48222L,48223L,
-     48224L,48224L,48225L,48226L,48226L,48227L,48228L,48228L,
-     48229L,48230L,48230L,48231L,48232L,48232L,48233L,48234L,
-     48235L,48235L,48236L,48237L,48237L,48238L,48239L,48239L,
-     48240L,48241L,48241L,48242L,48243L,48243L,48244L,48245L,
-     48245L,48246L,48247L,48247L,48248L,48249L,48249L,48250L,
-     48251L,48251L,48252L,48253L,48253L,48254L,48255L,48255L,
-     48256L,48257L,48258L,48258L,48259L,48260L,48260L,48261L,
-     48262L,48262L,48263L,48264L,48264L,48265L,48266L,48266L,
-     48267L,48268L,48268L,48269L,48270L,48270L,48271L,48272L,
-     48272L,48273L,48274L,48274L,48275L,48276L,48276L,48277L,
-     48278L,48278L,48279L,48280L,48281L,48281L,48282L,48283L,
-     48283L,48284L,48285L,48285L,48286L,48287L,48287L,48288L,
-     48289L,48289L,48290L,48291L,48291L,48292L,48293L,48293L,
-     48294L,48295L,48295L,48296L,48297L,48297L,48298L,48299L,
-     48299L,48300L,48301L,48301L,48302L,48303L,48303L,48304L,
-     48305L,48306L,48306L,48307L,48308L,48308L,48309L,48310L,
-     48310L,48311L,48312L,48312L,48313L,48314L,48314L,48315L,
-     48316L,48316L,48317L,48318L,48318L,48319L,48320L,48320L,
-     48321L,48322L,48322L,48323L,48324L,48324L,48325L,48326L,
-     48326L,48327L,48328L,48328L,48329L,48330L,48331L,48331L,
-     48332L,48333L,48333L,48334L,48335L,48335L,48336L,48337L,
-     48337L,48338L,48339L,48339L,48340L,48341L,48341L,48342L,
-     48343L,48343L,48344L,48345L,48345L,48346L,48347L,48347L,
-     48348L,48349L,48349L,48350L,48351L,48351L,48352L,48353L,
-     48353L,48354L,48355L,48356L,48356L,48357L,48358L,48358L,
-     48359L,48360L,48360L,48361L,48362L,48362L,48363L,48364L,
-     48364L,48365L,48366L,48366L,48367L,48368L,48368L,48369L,
-     48370L,48370L,48371L,48372L,48372L,48373L,48374L,48374L,
-     48375L,48376L,48376L,48377L,48378L,48378L,48379L,48380L,
-     48380L,48381L,48382L,48382L,48383L,48384L,48385L,48385L,
-     48386L,48387L,48387L,48388L,48389L,48389L,48390L,48391L,
-     48391L,48392L,48393L,48393L,48394L,48395L,48395L,48396L,
-     48397L,48397L,48398L,48399L,48399L,48400L,48401L,48401L,
-     48402L,48403L,48403L,48404L,48405L,48405L,48406L,48407L,
-     48407L,48408L,48409L,48409L,48410L,48411L,48411L,48412L,
-     48413L,48414L,48414L,48415L,48416L,48416L,48417L,48418L,
-     48418L,48419L,48420L,48420L,48421L,48422L,48422L,48423L,
-     48424L,48424L,48425L,48426L,48426L,48427L,48428L,48428L,
-     48429L,48430L,48430L,48431L,48432L,48432L,48433L,48434L,
-     48434L,48435L,48436L,48436L,48437L,48438L,48438L,48439L,
-     48440L,48440L,48441L,48442L,48442L,48443L,48444L,48445L,
-     48445L,48446L,48447L,48447L,48448L,48449L,48449L,48450L,
-     48451L,48451L,48452L,48453L,48453L,48454L,48455L,48455L,
-     48456L,48457L,48457L,48458L,48459L,48459L,48460L,48461L,
-     48461L,48462L,48463L,48463L,48464L,48465L,48465L,48466L,
-     48467L,48467L,48468L,48469L,48469L,48470L,48471L,48471L,
-     48472L,48473L,48473L,48474L,48475L,48475L,48476L,48477L,
-     48477L,48478L,48479L,48480L,48480L,48481L,48482L,48482L,
-     48483L,48484L,48484L,48485L,48486L,48486L,48487L,48488L,
-     48488L,48489L,48490L,48490L,48491L,48492L,48492L,48493L,
-     48494L,48494L,48495L,48496L,48496L,48497L,48498L,48498L,
-     48499L,48500L,48500L,48501L,48502L,48502L,48503L,48504L,
-     48504L,48505L,48506L,48506L,48507L,48508L,48508L,48509L,
-     48510L,48510L,48511L,48512L,48512L,48513L,48514L,48514L,
-     48515L,48516L,48516L,48517L,48518L,48519L,48519L,48520L,
-     48521L,48521L,48522L,48523L,48523L,48524L,48525L,48525L,
-     48526L,48527L,48527L,48528L,48529L,48529L,48530L,48531L,
-     48531L,48532L,48533L,48533L,48534L,48535L,48535L,48536L,
-     48537L,48537L,48538L,48539L,48539L,48540L,48541L,48541L,
-     48542L,48543L,48543L,48544L,48545L,48545L,48546L,48547L,
-     48547L,48548L,48549L,48549L,48550L,48551L,48551L,48552L,
-     48553L,48553L,48554L,48555L,48555L,48556L,48557L,48557L,
-     48558L,48559L,48560L,48560L,48561L,48562L,48562L,48563L,
-     48564L,48564L,48565L,48566L,48566L,48567L,48568L,48568L,
-     48569L,48570L,48570L,48571L,48572L,48572L,48573L,48574L,
-     48574L,48575L,48576L,48576L,48577L,48578L,48578L,48579L,
-     48580L,48580L,48581L,48582L,48582L,48583L,48584L,48584L,
-     48585L,48586L,48586L,48587L,48588L,48588L,48589L,48590L,
-     48590L,48591L,48592L,48592L,48593L,48594L,48594L,48595L,
-     48596L,48596L,48597L,48598L,48598L,48599L,48600L,48600L,
-     48601L,48602L,48602L,48603L,48604L,48604L,48605L,48606L,
-     48606L,48607L,48608L,48608L,48609L,48610L,48611L,48611L,
-     48612L,48613L,48613L,48614L,48615L,48615L,48616L,48617L,
-     48617L,48618L,48619L,48619L,48620L,48621L,48621L,48622L,
-     48623L,48623L,48624L,48625L,48625L,48626L,48627L,48627L,
-     48628L,48629L,48629L,48630L,48631L,48631L,48632L,48633L,
-     48633L,48634L,48635L,48635L,48636L,48637L,48637L,48638L,
-     48639L,48639L,48640L,48641L,48641L,48642L,48643L,48643L,
-     48644L,48645L,48645L,48646L,48647L,48647L,48648L,48649L,
-     48649L,48650L,48651L,48651L,48652L,48653L,48653L,48654L,
-     48655L,48655L,48656L,48657L,48657L,48658L,48659L,48659L,
-     48660L,48661L,48661L,48662L,48663L,48663L,48664L,48665L,
-     48665L,48666L,48667L,48667L,48668L,48669L,48669L,48670L,
-     48671L,48671L,48672L,48673L,48674L,48674L,48675L,48676L,
-     48676L,48677L,48678L,48678L,48679L,48680L,48680L,48681L,
-     48682L,48682L,48683L,48684L,48684L,48685L,48686L,48686L,
-     48687L,48688L,48688L,48689L,48690L,48690L,48691L,48692L,
-     48692L,48693L,48694L,48694L,48695L,48696L,48696L,48697L,
-     48698L,48698L,48699L,48700L,48700L,48701L,48702L,48702L,
-     48703L,48704L,48704L,48705L,48706L,48706L,48707L,48708L,
-     48708L,48709L,48710L,48710L,48711L,48712L,48712L,48713L,
-     48714L,48714L,48715L,48716L,48716L,48717L,48718L,48718L,
-     48719L,48720L,48720L,48721L,48722L,48722L,48723L,48724L,
-     48724L,48725L,48726L,48726L,48727L,48728L,48728L,48729L,
-     48730L,48730L,48731L,48732L,48732L,48733L,48734L,48734L,
-     48735L,48736L,48736L,48737L,48738L,48738L,48739L,48740L,
-     48740L,48741L,48742L,48742L,48743L,48744L,48744L,48745L,
-     48746L,48746L,48747L,48748L,48748L,48749L,48750L,48750L,
-     48751L,48752L,48752L,48753L,48754L,48754L,48755L,48756L,
-     48756L,48757L,48758L,48758L,48759L,48760L,48760L,48761L,
-     48762L,48762L,48763L,48764L,48764L,48765L,48766L,48766L,
-     48767L,48768L,48768L,48769L,48770L,48770L,48771L,48772L,
-     48772L,48773L,48774L,48774L,48775L,48776L,48776L,48777L,
-     48778L,48778L,48779L,48780L,48780L,48781L,48782L,48782L,
-     48783L,48784L,48785L,48785L,48786L,48787L,48787L,48788L,
-     48789L,48789L,48790L,48791L,48791L,48792L,48793L,48793L,
-     48794L,48795L,48795L,48796L,48797L,48797L,48798L,48799L,
-     48799L,48800L,48801L,48801L,48802L,48803L,48803L,48804L,
-     48805L,48805L,48806L,48807L,48807L,48808L,48809L,48809L,
-     48810L,48811L,48811L,48812L,48813L,48813L,48814L,48815L,
-     48815L,48816L,48817L,48817L,48818L,48819L,48819L,48820L,
-     48821L,48821L,48822L,48823L,48823L,48824L,48825L,48825L,
-     48826L,48827L,48827L,48828L,48829L,48829L,48830L,48831L,
-     48831L,48832L,48833L,48833L,48834L,48835L,48835L,48836L,
-     48837L,48837L,48838L,48839L,48839L,48840L,48841L,48841L,
-     48842L,48843L,48843L,48844L,48845L,48845L,48846L,48847L,
-     48847L,48848L,48849L,48849L,48850L,48851L,48851L,48852L,
-     48853L,48853L,48854L,48855L,48855L,48856L,48857L,48857L,
-     48858L,48859L,48859L,48860L,48861L,48861L,48862L,48863L,
-     48863L,48864L,48865L,48865L,48866L,48867L,48867L,48868L,
-     48869L,48869L,48870L,48871L,48871L,48872L,48873L,48873L,
-     48874L,48875L,48875L,48876L,48877L,48877L,48878L,48879L,
-     48879L,48880L,48881L,48881L,48882L,48883L,48883L,48884L,
-     48885L,48885L,48886L,48887L,48887L,48888L,48889L,48889L,
-     48890L,48891L,48891L,48892L,48893L,48893L,48894L,48895L,
-     48895L,48896L,48897L,48897L,48898L,48899L,48899L,48900L,
-     48901L,48901L,48902L,48903L,48903L,48904L,48905L,48905L,
-     48906L,48907L,48907L,48908L,48909L,48909L,48910L,48911L,
-     48911L,48912L,48912L,48913L,48914L,48914L,48915L,48916L,
-     48916L,48917L,48918L,48918L,48919L,48920L,48920L,48921L,
-     48922L,48922L,48923L,48924L,48924L,48925L,48926L,48926L,
-     48927L,48928L,48928L,48929L,48930L,48930L,48931L,48932L,
-     48932L,48933L,48934L,48934L,48935L,48936L,48936L,48937L,
-     48938L,48938L,48939L,48940L,48940L,48941L,48942L,48942L,
-     48943L,48944L,48944L,48945L,48946L,48946L,48947L,48948L,
-     48948L,48949L,48950L,48950L,48951L,48952L,48952L,48953L,
-     48954L,48954L,48955L,48956L,48956L,48957L,48958L,48958L,
-     48959L,48960L,48960L,48961L,48962L,48962L,48963L,48964L,
-     48964L,48965L,48966L,48966L,48967L,48968L,48968L,48969L,
-     48970L,48970L,48971L,48972L,48972L,48973L,48974L,48974L,
-     48975L,48976L,48976L,48977L,48978L,48978L,48979L,48980L,
-     48980L,48981L,48982L,48982L,48983L,48984L,48984L,48985L,
-     48986L,48986L,48987L,48988L,48988L,48989L,48990L,48990L,
-     48991L,48992L,48992L,48993L,48994L,48994L,48995L,48996L,
-     48996L,48997L,48998L,48998L,48999L,49000L,49000L,49001L,
-     49002L,49002L,49003L,49004L,49004L,49005L,49006L,49006L,
-     49007L,49008L,49008L,49009L,49010L,49010L,49011L,49012L,
-     49012L,49013L,49014L,49014L,49015L,49016L,49016L,49017L,
-     49018L,49018L,49019L,49020L,49020L,49021L,49021L,49022L,
-     49023L,49023L,49024L,49025L,49025L,49026L,49027L,49027L,
-     49028L,49029L,49029L,49030L,49031L,49031L,49032L,49033L,
-     49033L,49034L,49035L,49035L,49036L,49037L,49037L,49038L,
-     49039L,49039L,49040L,49041L,49041L,49042L,49043L,49043L,
-     49044L,49045L,49045L,49046L,49047L,49047L,49048L,49049L,
-     49049L,49050L,49051L,49051L,49052L,49053L,49053L,49054L,
-     49055L,49055L,49056L,49057L,49057L,49058L,49059L,49059L,
-     49060L,49061L,49061L,49062L,49063L,49063L,49064L,49065L,
-     49065L,49066L,49067L,49067L,49068L,49069L,49069L,49070L,
-     49071L,49071L,49072L,49073L,49073L,49074L,49075L,49075L,
-     49076L,49077L,49077L,49078L,49079L,49079L,49080L,49081L,
-     49081L,49082L,49083L,49083L,49084L,49084L,49085L,49086L,
-     49086L,49087L,49088L,49088L,49089L,49090L,49090L,49091L,
-     49092L,49092L,49093L,49094L,49094L,49095L,49096L,49096L,
-     49097L,49098L,49098L,49099L,49100L,49100L,49101L,49102L,
-     49102L,49103L,49104L,49104L,49105L,49106L,49106L,49107L,
-     49108L,49108L,49109L,49110L,49110L,49111L,49112L,49112L,
-     49113L,49114L,49114L,49115L,49116L,49116L,49117L,49118L,
-     49118L,49119L,49120L,49120L,49121L,49122L,49122L,49123L,
-     49124L,49124L,49125L,49126L,49126L,49127L,49128L,49128L,
-     49129L,49130L,49130L,49131L,49132L,49132L,49133L,49133L,
-     49134L,49135L,49135L,49136L,49137L,49137L,49138L,49139L,
-     49139L,49140L,49141L,49141L,49142L,49143L,49143L,49144L,
-     49145L,49145L,49146L,49147L,49147L,49148L,49149L,49149L,
-     49150L,49151L,49151L,49152L,49153L,49153L,49154L,49155L,
-     49155L,49156L,49157L,49157L,49158L,49159L,49159L,49160L,
-     49161L,49161L,49162L,49163L,49163L,49164L,49165L,49165L,
-     49166L,49167L,49167L,49168L,49169L,49169L,49170L,49171L,
-     49171L,49172L,49173L,49173L,49174L,49175L,49175L,49176L,
-     49176L,49177L,49178L,49178L,49179L,49180L,49180L,49181L,
-     49182L,49182L,49183L,49184L,49184L,49185L,49186L,49186L,
-     49187L,49188L,49188L,49189L,49190L,49190L,49191L,49192L,
-     49192L,49193L,49194L,49194L,49195L,49196L,49196L,49197L,
-     49198L,49198L,49199L,49200L,49200L,49201L,49202L,49202L,
-     49203L,49204L,49204L,49205L,49206L,49206L,49207L,49208L,
-     49208L,49209L,49210L,49210L,49211L,49212L,49212L,49213L,
-     49213L,49214L,49215L,49215L,49216L,49217L,49217L,49218L,
-     49219L,49219L,49220L,49221L,49221L,49222L,49223L,49223L,
-     49224L,49225L,49225L,49226L,49227L,49227L,49228L,49229L,
-     49229L,49230L,49231L,49231L,49232L,49233L,49233L,49234L,
-     49235L,49235L,49236L,49237L,49237L,49238L,49239L,49239L,
-     49240L,49241L,49241L,49242L,49243L,49243L,49244L,49245L,
-     49245L,49246L,49246L,49247L,49248L,49248L,49249L,49250L,
-     49250L,49251L,49252L,49252L,49253L,49254L,49254L,49255L,
-     49256L,49256L,49257L,49258L,49258L,49259L,49260L,49260L,
-     49261L,49262L,49262L,49263L,49264L,49264L,49265L,49266L,
-     49266L,49267L,49268L,49268L,49269L,49270L,49270L,49271L,
-     49272L,49272L,49273L,49274L,49274L,49275L,49276L,49276L,
-     49277L,49277L,49278L,49279L,49279L,49280L,49281L,49281L,
-     49282L,49283L,49283L,49284L,49285L,49285L,49286L,49287L,
-     49287L,49288L,49289L,49289L,49290L,49291L,49291L,49292L,
-     49293L,49293L,49294L,49295L,49295L,49296L,49297L,49297L,
-     49298L,49299L,49299L,49300L,49301L,49301L,49302L,49303L,
-     49303L,49304L,49305L,49305L,49306L,49306L,49307L,49308L,
-     49308L,49309L,49310L,49310L,49311L,49312L,49312L,49313L,
-     49314L,49314L,49315L,49316L,49316L,49317L,49318L,49318L,
-     49319L,49320L,49320L,49321L,49322L,49322L,49323L,49324L,
-     49324L,49325L,49326L,49326L,49327L,49328L,49328L,49329L,
-     49330L,49330L,49331L,49332L,49332L,49333L,49333L,49334L,
-     49335L,49335L,49336L,49337L,49337L,49338L,49339L,49339L,
-     49340L,49341L,49341L,49342L,49343L,49343L,49344L,49345L,
-     49345L,49346L,49347L,49347L,49348L,49349L,49349L,49350L,
-     49351L,49351L,49352L,49353L,49353L,49354L,49355L,49355L,
-     49356L,49357L,49357L,49358L,49358L,49359L,49360L,49360L,
-     49361L,49362L,49362L,49363L,49364L,49364L,49365L,49366L,
-     49366L,49367L,49368L,49368L,49369L,49370L,49370L,49371L,
-     49372L,49372L,49373L,49374L,49374L,49375L,49376L,49376L,
-     49377L,49378L,49378L,49379L,49380L,49380L,49381L,49382L,
-     49382L,49383L,49383L,49384L,49385L,49385L,49386L,49387L,
-     49387L,49388L,49389L,49389L,49390L,49391L,49391L,49392L,
-     49393L,49393L,49394L,49395L,49395L,49396L,49397L,49397L,
-     49398L,49399L,49399L,49400L,49401L,49401L,49402L,49403L,
-     49403L,49404L,49405L,49405L,49406L,49406L,49407L,49408L,
-     49408L,49409L,49410L,49410L,49411L,49412L,49412L,49413L,
-     49414L,49414L,49415L,49416L,49416L,49417L,49418L,49418L,
-     49419L,49420L,49420L,49421L,49422L,49422L,49423L,49424L,
-     49424L,49425L,49426L,49426L,49427L,49427L,49428L,49429L,
-     49429L,49430L,49431L,49431L,49432L,49433L,49433L,49434L,
-     49435L,49435L,49436L,49437L,49437L,49438L,49439L,49439L,
-     49440L,49441L,49441L,49442L,49443L,49443L,49444L,49445L,
-     49445L,49446L,49447L,49447L,49448L,49449L,49449L,49450L,
-     49450L,49451L,49452L,49452L,49453L,49454L,49454L,49455L,
-     49456L,49456L,49457L,49458L,49458L,49459L,49460L,49460L,
-     49461L,49462L,49462L,49463L,49464L,49464L,49465L,49466L,
-     49466L,49467L,49468L,49468L,49469L,49469L,49470L,49471L,
-     49471L,49472L,49473L,49473L,49474L,49475L,49475L,49476L,
-     49477L,49477L,49478L,49479L,49479L,49480L,49481L,49481L,
-     49482L,49483L,49483L,49484L,49485L,49485L,49486L,49487L,
-     49487L,49488L,49489L,49489L,49490L,49490L,49491L,49492L,
-     49492L,49493L,49494L,49494L,49495L,49496L,49496L,49497L,
-     49498L,49498L,49499L,49500L,49500L,49501L,49502L,49502L,
-     49503L,49504L,49504L,49505L,49506L,49506L,49507L,49508L,
-     49508L,49509L,49509L,49510L,49511L,49511L,49512L,49513L,
-     49513L,49514L,49515L,49515L,49516L,49517L,49517L,49518L,
-     49519L,49519L,49520L,49521L,49521L,49522L,49523L,49523L,
-     49524L,49525L,49525L,49526L,49527L,49527L,49528L,49528L,
-     49529L,49530L,49530L,49531L,49532L,49532L,49533L,49534L,
-     49534L,49535L,49536L,49536L,49537L,49538L,49538L,49539L,
-     49540L,49540L,49541L,49542L,49542L,49543L,49544L,49544L,
-     49545L,49546L,49546L,49547L,49547L,49548L,49549L,49549L,
-     49550L,49551L,49551L,49552L,49553L,49553L,49554L,49555L,
-     49555L,49556L,49557L,49557L,49558L,49559L,49559L,49560L,
-     49561L,49561L,49562L,49563L,49563L,49564L,49564L,49565L,
-     49566L,49566L,49567L,49568L,49568L,49569L,49570L,49570L,
-     49571L,49572L,49572L,49573L,49574L,49574L,49575L,49576L,
-     49576L,49577L,49578L,49578L,49579L,49580L,49580L,49581L,
-     49581L,49582L,49583L,49583L,49584L,49585L,49585L,49586L,
-     49587L,49587L,49588L,49589L,49589L,49590L,49591L,49591L,
-     49592L,49593L,49593L,49594L,49595L,49595L,49596L,49597L,
-     49597L,49598L,49598L,49599L,49600L,49600L,49601L,49602L,
-     49602L,49603L,49604L,49604L,49605L,49606L,49606L,49607L,
-     49608L,49608L,49609L,49610L,49610L,49611L,49612L,49612L,
-     49613L,49614L,49614L,49615L,49615L,49616L,49617L,49617L,
-     49618L,49619L,49619L,49620L,49621L,49621L,49622L,49623L,
-     49623L,49624L,49625L,49625L,49626L,49627L,49627L,49628L,
-     49629L,49629L,49630L,49631L,49631L,49632L,49632L,49633L,
-     49634L,49634L,49635L,49636L,49636L,49637L,49638L,49638L,
-     49639L,49640L,49640L,49641L,49642L,49642L,49643L,49644L,
-     49644L,49645L,49646L,49646L,49647L,49647L,49648L,49649L,
-     49649L,49650L,49651L,49651L,49652L,49653L,49653L,49654L,
-     49655L,49655L,49656L,49657L,49657L,49658L,49659L,49659L,
-     49660L,49661L,49661L,49662L,49662L,49663L,49664L,49664L,
-     49665L,49666L,49666L,49667L,49668L,49668L,49669L,49670L,
-     49670L,49671L,49672L,49672L,49673L,49674L,49674L,49675L,
-     49676L,49676L,49677L,49677L,49678L,49679L,49679L,49680L,
-     49681L,49681L,49682L,49683L,49683L,49684L,49685L,49685L,
-     49686L,49687L,49687L,49688L,49689L,49689L,49690L,49691L,
-     49691L,49692L,49692L,49693L,49694L,49694L,49695L,49696L,
-     49696L,49697L,49698L,49698L,49699L,49700L,49700L,49701L,
-     49702L,49702L,49703L,49704L,49704L,49705L,49706L,49706L,
-     49707L,49707L,49708L,49709L,49709L,49710L,49711L,49711L,
-     49712L,49713L,49713L,49714L,49715L,49715L,49716L,49717L,
-     49717L,49718L,49719L,49719L,49720L,49721L,49721L,49722L,
-     49722L,49723L,49724L,49724L,49725L,49726L,49726L,49727L,
-     49728L,49728L,49729L,49730L,49730L,49731L,49732L,49732L,
-     49733L,49734L,49734L,49735L,49735L,49736L,49737L,49737L,
-     49738L,49739L,49739L,49740L,49741L,49741L,49742L,49743L,
-     49743L,49744L,49745L,49745L,49746L,49747L,49747L,49748L,
-     49749L,49749L,49750L,49750L,49751L,49752L,49752L,49753L,
-     49754L,49754L,49755L,49756L,49756L,49757L,49758L,49758L,
-     49759L,49760L,49760L,49761L,49762L,49762L,49763L,49763L,
-     49764L,49765L,49765L,49766L,49767L,49767L,49768L,49769L,
-     49769L,49770L,49771L,49771L,49772L,49773L,49773L,49774L,
-     49775L,49775L,49776L,49776L,49777L,49778L,49778L,49779L,
-     49780L,49780L,49781L,49782L,49782L,49783L,49784L,49784L,
-     49785L,49786L,49786L,49787L,49788L,49788L,49789L,49790L,
-     49790L,49791L,49791L,49792L,49793L,49793L,49794L,49795L,
-     49795L,49796L,49797L,49797L,49798L,49799L,49799L,49800L,
-     49801L,49801L,49802L,49803L,49803L,49804L,49804L,49805L,
-     49806L,49806L,49807L,49808L,49808L,49809L,49810L,49810L,
-     49811L,49812L,49812L,49813L,49814L,49814L,49815L,49816L,
-     49816L,49817L,49817L,49818L,49819L,49819L,49820L,49821L,
-     49821L,49822L,49823L,49823L,49824L,49825L,49825L,49826L,
-     49827L,49827L,49828L,49828L,49829L,49830L,49830L,49831L,
-     49832L,49832L,49833L,49834L,49834L,49835L,49836L,49836L,
-     49837L,49838L,49838L,49839L,49840L,49840L,49841L,49841L,
-     49842L,49843L,49843L,49844L,49845L,49845L,49846L,49847L,
-     49847L,49848L,49849L,49849L,49850L,49851L,49851L,49852L,
-     49853L,49853L,49854L,49854L,49855L,49856L,49856L,49857L,
-     49858L,49858L,49859L,49860L,49860L,49861L,49862L,49862L,
-     49863L,49864L,49864L,49865L,49866L,49866L,49867L,49867L,
-     49868L,49869L,49869L,49870L,49871L,49871L,49872L,49873L,
-     49873L,49874L,49875L,49875L,49876L,49877L,49877L,49878L,
-     49878L,49879L,49880L,49880L,49881L,49882L,49882L,49883L,
-     49884L,49884L,49885L,49886L,49886L,49887L,49888L,49888L,
-     49889L,49890L,49890L,49891L,49891L,49892L,49893L,49893L,
-     49894L,49895L,49895L,49896L,49897L,49897L,49898L,49899L,
-     49899L,49900L,49901L,49901L,49902L,49902L,49903L,49904L,
-     49904L,49905L,49906L,49906L,49907L,49908L,49908L,49909L,
-     49910L,49910L,49911L,49912L,49912L,49913L,49913L,49914L,
-     49915L,49915L,49916L,49917L,49917L,49918L,49919L,49919L,
-     49920L,49921L,49921L,49922L,49923L,49923L,49924L,49925L,
-     49925L,49926L,49926L,49927L,49928L,49928L,49929L,49930L,
-     49930L,49931L,49932L,49932L,49933L,49934L,49934L,49935L,
-     49936L,49936L,49937L,49937L,49938L,49939L,49939L,49940L,
-     49941L,49941L,49942L,49943L,49943L,49944L,49945L,49945L,
-     49946L,49947L,49947L,49948L,49948L,49949L,49950L,49950L,
-     49951L,49952L,49952L,49953L,49954L,49954L,49955L,49956L,
-     49956L,49957L,49958L,49958L,49959L,49959L,49960L,49961L,
-     49961L,49962L,49963L,49963L,49964L,49965L,49965L,49966L,
-     49967L,49967L,49968L,49969L,49969L,49970L,49970L,49971L,
-     49972L,49972L,49973L,49974L,49974L,49975L,49976L,49976L,
-     49977L,49978L,49978L,49979L,49980L,49980L,49981L,49981L,
-     49982L,49983L,49983L,49984L,49985L,49985L,49986L,49987L,
-     49987L,49988L,49989L,49989L,49990L,49991L,49991L,49992L,
-     49992L,49993L,49994L,49994L,49995L,49996L,49996L,49997L,
-     49998L,49998L,49999L,50000L,50000L,50001L,50002L,50002L,
-     50003L,50003L,50004L,50005L,50005L,50006L,50007L,50007L,
-     50008L,50009L,50009L,50010L,50011L,50011L,50012L,50012L,
-     50013L,50014L,50014L,50015L,50016L,50016L,50017L,50018L,
-     50018L,50019L,50020L,50020L,50021L,50022L,50022L,50023L,
-     50023L,50024L,50025L,50025L,50026L,50027L,50027L,50028L,
-     50029L,50029L,50030L,50031L,50031L,50032L,50033L,50033L,
-     50034L,50034L,50035L,50036L,50036L,50037L,50038L,50038L,
-     50039L,50040L,50040L,50041L,50042L,50042L,50043L,50044L,
-     50044L,50045L,50045L,50046L,50047L,50047L,50048L,50049L,
-     50049L,50050L,50051L,50051L,50052L,50053L,50053L,50054L,
-     50054L,50055L,50056L,50056L,50057L,50058L,50058L,50059L,
-     50060L,50060L,50061L,50062L,50062L,50063L,50064L,50064L,
-     50065L,50065L,50066L,50067L,50067L,50068L,50069L,50069L,
-     50070L,50071L,50071L,50072L,50073L,50073L,50074L,50074L,
-     50075L,50076L,50076L,50077L,50078L,50078L,50079L,50080L,
-     50080L,50081L,50082L,50082L,50083L,50084L,50084L,50085L,
-     50085L,50086L,50087L,50087L,50088L,50089L,50089L,50090L,
-     50091L,50091L,50092L,50093L,50093L,50094L,50094L,50095L,
-     50096L,50096L,50097L,50098L,50098L,50099L,50100L,50100L,
-     50101L,50102L,50102L,50103L,50104L,50104L,50105L,50105L,
-     50106L,50107L,50107L,50108L,50109L,50109L,50110L,50111L,
-     50111L,50112L,50113L,50113L,50114L,50114L,50115L,50116L,
-     50116L,50117L,50118L,50118L,50119L,50120L,50120L,50121L,
-     50122L,50122L,50123L,50123L,50124L,50125L,50125L,50126L,
-     50127L,50127L,50128L,50129L,50129L,50130L,50131L,50131L,
-     50132L,50132L,50133L,50134L,50134L,50135L,50136L,50136L,
-     50137L,50138L,50138L,50139L,50140L,50140L,50141L,50142L,
-     50142L,50143L,50143L,50144L,50145L,50145L,50146L,50147L,
-     50147L,50148L,50149L,50149L,50150L,50151L,50151L,50152L,
-     50152L,50153L,50154L,50154L,50155L,50156L,50156L,50157L,
-     50158L,50158L,50159L,50160L,50160L,50161L,50161L,50162L,
-     50163L,50163L,50164L,50165L,50165L,50166L,50167L,50167L,
-     50168L,50169L,50169L,50170L,50170L,50171L,50172L,50172L,
-     50173L,50174L,50174L,50175L,50176L,50176L,50177L,50178L,
-     50178L,50179L,50179L,50180L,50181L,50181L,50182L,50183L,
-     50183L,50184L,50185L,50185L,50186L,50187L,50187L,50188L,
-     50188L,50189L,50190L,50190L,50191L,50192L,50192L,50193L,
-     50194L,50194L,50195L,50196L,50196L,50197L,50197L,50198L,
-     50199L,50199L,50200L,50201L,50201L,50202L,50203L,50203L,
-     50204L,50205L,50205L,50206L,50206L,50207L,50208L,50208L,
-     50209L,50210L,50210L,50211L,50212L,50212L,50213L,50214L,
-     50214L,50215L,50215L,50216L,50217L,50217L,50218L,50219L,
-     50219L,50220L,50221L,50221L,50222L,50223L,50223L,50224L,
-     50224L,50225L,50226L,50226L,50227L,50228L,50228L,50229L,
-     50230L,50230L,50231L,50232L,50232L,50233L,50233L,50234L,
-     50235L,50235L,50236L,50237L,50237L,50238L,50239L,50239L,
-     50240L,50241L,50241L,50242L,50242L,50243L,50244L,50244L,
-     50245L,50246L,50246L,50247L,50248L,50248L,50249L,50250L,
-     50250L,50251L,50251L,50252L,50253L,50253L,50254L,50255L,
-     50255L,50256L,50257L,50257L,50258L,50259L,50259L,50260L,
-     50260L,50261L,50262L,50262L,50263L,50264L,50264L,50265L,
-     50266L,50266L,50267L,50267L,50268L,50269L,50269L,50270L,
-     50271L,50271L,50272L,50273L,50273L,50274L,50275L,50275L,
-     50276L,50276L,50277L,50278L,50278L,50279L,50280L,50280L,
-     50281L,50282L,50282L,50283L,50284L,50284L,50285L,50285L,
-     50286L,50287L,50287L,50288L,50289L,50289L,50290L,50291L,
-     50291L,50292L,50293L,50293L,50294L,50294L,50295L,50296L,
-     50296L,50297L,50298L,50298L,50299L,50300L,50300L,50301L,
-     50301L,50302L,50303L,50303L,50304L,50305L,50305L,50306L,
-     50307L,50307L,50308L,50309L,50309L,50310L,50310L,50311L,
-     50312L,50312L,50313L,50314L,50314L,50315L,50316L,50316L,
-     50317L,50318L,50318L,50319L,50319L,50320L,50321L,50321L,
-     50322L,50323L,50323L,50324L,50325L,50325L,50326L,50326L,
-     50327L,50328L,50328L,50329L,50330L,50330L,50331L,50332L,
-     50332L,50333L,50334L,50334L,50335L,50335L,50336L,50337L,
-     50337L,50338L,50339L,50339L,50340L,50341L,50341L,50342L,
-     50342L,50343L,50344L,50344L,50345L,50346L,50346L,50347L,
-     50348L,50348L,50349L,50350L,50350L,50351L,50351L,50352L,
-     50353L,50353L,50354L,50355L,50355L,50356L,50357L,50357L,
-     50358L,50358L,50359L,50360L,50360L,50361L,50362L,50362L,
-     50363L,50364L,50364L,50365L,50366L,50366L,50367L,50367L,
-     50368L,50369L,50369L,50370L,50371L,50371L,50372L,50373L,
-     50373L,50374L,50374L,50375L,50376L,50376L,50377L,50378L,
-     50378L,50379L,50380L,50380L,50381L,50382L,50382L,50383L,
-     50383L,50384L,50385L,50385L,50386L,50387L,50387L,50388L,
-     50389L,50389L,50390L,50390L,50391L,50392L,50392L,50393L,
-     50394L,50394L,50395L,50396L,50396L,50397L,50398L,50398L,
-     50399L,50399L,50400L,50401L,50401L,50402L,50403L,50403L,
-     50404L,50405L,50405L,50406L,50406L,50407L,50408L,50408L,
-     50409L,50410L,50410L,50411L,50412L,50412L,50413L,50413L,
-     50414L,50415L,50415L,50416L,50417L,50417L,50418L,50419L,
-     50419L,50420L,50421L,50421L,50422L,50422L,50423L,50424L,
-     50424L,50425L,50426L,50426L,50427L,50428L,50428L,50429L,
-     50429L,50430L,50431L,50431L,50432L,50433L,50433L,50434L,
-     50435L,50435L,50436L,50436L,50437L,50438L,50438L,50439L,
-     50440L,50440L,50441L,50442L,50442L,50443L,50443L,50444L,
-     50445L,50445L,50446L,50447L,50447L,50448L,50449L,50449L,
-     50450L,50451L,50451L,50452L,50452L,50453L,50454L,50454L,
-     50455L,50456L,50456L,50457L,50458L,50458L,50459L,50459L,
-     50460L,50461L,50461L,50462L,50463L,50463L,50464L,50465L,
-     50465L,50466L,50466L,50467L,50468L,50468L,50469L,50470L,
-     50470L,50471L,50472L,50472L,50473L,50473L,50474L,50475L,
-     50475L,50476L,50477L,50477L,50478L,50479L,50479L,50480L,
-     50481L,50481L,50482L,50482L,50483L,50484L,50484L,50485L,
-     50486L,50486L,50487L,50488L,50488L,50489L,50489L,50490L,
-     50491L,50491L,50492L,50493L,50493L,50494L,50495L,50495L,
-     50496L,50496L,50497L,50498L,50498L,50499L,50500L,50500L,
-     50501L,50502L,50502L,50503L,50503L,50504L,50505L,50505L,
-     50506L,50507L,50507L,50508L,50509L,50509L,50510L,50510L,
-     50511L,50512L,50512L,50513L,50514L,50514L,50515L,50516L,
-     50516L,50517L,50517L,50518L,50519L,50519L,50520L,50521L,
-     50521L,50522L,50523L,50523L,50524L,50524L,50525L,50526L,
-     50526L,50527L,50528L,50528L,50529L,50530L,50530L,50531L,
-     50531L,50532L,50533L,50533L,50534L,50535L,50535L,50536L,
-     50537L,50537L,50538L,50538L,50539L,50540L,50540L,50541L,
-     50542L,50542L,50543L,50544L,50544L,50545L,50545L,50546L,
-     50547L,50547L,50548L,50549L,50549L,50550L,50551L,50551L,
-     50552L,50552L,50553L,50554L,50554L,50555L,50556L,50556L,
-     50557L,50558L,50558L,50559L,50559L,50560L,50561L,50561L,
-     50562L,50563L,50563L,50564L,50565L,50565L,50566L,50566L,
-     50567L,50568L,50568L,50569L,50570L,50570L,50571L,50572L,
-     50572L,50573L,50573L,50574L,50575L,50575L,50576L,50577L,
-     50577L,50578L,50579L,50579L,50580L,50580L,50581L,50582L,
-     50582L,50583L,50584L,50584L,50585L,50586L,50586L,50587L,
-     50587L,50588L,50589L,50589L,50590L,50591L,50591L,50592L,
-     50593L,50593L,50594L,50594L,50595L,50596L,50596L,50597L,
-     50598L,50598L,50599L,50600L,50600L,50601L,50601L,50602L,
-     50603L,50603L,50604L,50605L,50605L,50606L,50607L,50607L,
-     50608L,50608L,50609L,50610L,50610L,50611L,50612L,50612L,
-     50613L,50614L,50614L,50615L,50615L,50616L,50617L,50617L,
-     50618L,50619L,50619L,50620L,50621L,50621L,50622L,50622L,
-     50623L,50624L,50624L,50625L,50626L,50626L,50627L,50628L,
-     50628L,50629L,50629L,50630L,50631L,50631L,50632L,50633L,
-     50633L,50634L,50634L,50635L,50636L,50636L,50637L,50638L,
-     50638L,50639L,50640L,50640L,50641L,50641L,50642L,50643L,
-     50643L,50644L,50645L,50645L,50646L,50647L,50647L,50648L,
-     50648L,50649L,50650L,50650L,50651L,50652L,50652L,50653L,
-     50654L,50654L,50655L,50655L,50656L,50657L,50657L,50658L,
-     50659L,50659L,50660L,50661L,50661L,50662L,50662L,50663L,
-     50664L,50664L,50665L,50666L,50666L,50667L,50667L,50668L,
-     50669L,50669L,50670L,50671L,50671L,50672L,50673L,50673L,
-     50674L,50674L,50675L,50676L,50676L,50677L,50678L,50678L,
-     50679L,50680L,50680L,50681L,50681L,50682L,50683L,50683L,
-     50684L,50685L,50685L,50686L,50687L,50687L,50688L,50688L,
-     50689L,50690L,50690L,50691L,50692L,50692L,50693L,50693L,
-     50694L,50695L,50695L,50696L,50697L,50697L,50698L,50699L,
-     50699L,50700L,50700L,50701L,50702L,50702L,50703L,50704L,
-     50704L,50705L,50706L,50706L,50707L,50707L,50708L,50709L,
-     50709L,50710L,50711L,50711L,50712L,50712L,50713L,50714L,
-     50714L,50715L,50716L,50716L,50717L,50718L,50718L,50719L,
-     50719L,50720L,50721L,50721L,50722L,50723L,50723L,50724L,
-     50725L,50725L,50726L,50726L,50727L,50728L,50728L,50729L,
-     50730L,50730L,50731L,50731L,50732L,50733L,50733L,50734L,
-     50735L,50735L,50736L,50737L,50737L,50738L,50738L,50739L,
-     50740L,50740L,50741L,50742L,50742L,50743L,50744L,50744L,
-     50745L,50745L,50746L,50747L,50747L,50748L,50749L,50749L,
-     50750L,50750L,50751L,50752L,50752L,50753L,50754L,50754L,
-     50755L,50756L,50756L,50757L,50757L,50758L,50759L,50759L,
-     50760L,50761L,50761L,50762L,50762L,50763L,50764L,50764L,
-     50765L,50766L,50766L,50767L,50768L,50768L,50769L,50769L,
-     50770L,50771L,50771L,50772L,50773L,50773L,50774L,50775L,
-     50775L,50776L,50776L,50777L,50778L,50778L,50779L,50780L,
-     50780L,50781L,50781L,50782L,50783L,50783L,50784L,50785L,
-     50785L,50786L,50787L,50787L,50788L,50788L,50789L,50790L,
-     50790L,50791L,50792L,50792L,50793L,50793L,50794L,50795L,
-     50795L,50796L,50797L,50797L,50798L,50799L,50799L,50800L,
-     50800L,50801L,50802L,50802L,50803L,50804L,50804L,50805L,
-     50805L,50806L,50807L,50807L,50808L,50809L,50809L,50810L,
-     50811L,50811L,50812L,50812L,50813L,50814L,50814L,50815L,
-     50816L,50816L,50817L,50817L,50818L,50819L,50819L,50820L,
-     50821L,50821L,50822L,50823L,50823L,50824L,50824L,50825L,
-     50826L,50826L,50827L,50828L,50828L,50829L,50829L,50830L,
-     50831L,50831L,50832L,50833L,50833L,50834L,50835L,50835L,
-     50836L,50836L,50837L,50838L,50838L,50839L,50840L,50840L,
-     50841L,50841L,50842L,50843L,50843L,50844L,50845L,50845L,
-     50846L,50847L,50847L,50848L,50848L,50849L,50850L,50850L,
-     50851L,50852L,50852L,50853L,50853L,50854L,50855L,50855L,
-     50856L,50857L,50857L,50858L,50858L,50859L,50860L,50860L,
-     50861L,50862L,50862L,50863L,50864L,50864L,50865L,50865L,
-     50866L,50867L,50867L,50868L,50869L,50869L,50870L,50870L,
-     50871L,50872L,50872L,50873L,50874L,50874L,50875L,50876L,
-     50876L,50877L,50877L,50878L,50879L,50879L,50880L,50881L,
-     50881L,50882L,50882L,50883L,50884L,50884L,50885L,50886L,
-     50886L,50887L,50887L,50888L,50889L,50889L,50890L,50891L,
-     50891L,50892L,50893L,50893L,50894L,50894L,50895L,50896L,
-     50896L,50897L,50898L,50898L,50899L,50899L,50900L,50901L,
-     50901L,50902L,50903L,50903L,50904L,50904L,50905L,50906L,
-     50906L,50907L,50908L,50908L,50909L,50910L,50910L,50911L,
-     50911L,50912L,50913L,50913L,50914L,50915L,50915L,50916L,
-     50916L,50917L,50918L,50918L,50919L,50920L,50920L,50921L,
-     50921L,50922L,50923L,50923L,50924L,50925L,50925L,50926L,
-     50927L,50927L,50928L,50928L,50929L,50930L,50930L,50931L,
-     50932L,50932L,50933L,50933L,50934L,50935L,50935L,50936L,
-     50937L,50937L,50938L,50938L,50939L,50940L,50940L,50941L,
-     50942L,50942L,50943L,50944L,50944L,50945L,50945L,50946L,
-     50947L,50947L,50948L,50949L,50949L,50950L,50950L,50951L,
-     50952L,50952L,50953L,50954L,50954L,50955L,50955L,50956L,
-     50957L,50957L,50958L,50959L,50959L,50960L,50961L,50961L,
-     50962L,50962L,50963L,50964L,50964L,50965L,50966L,50966L,
-     50967L,50967L,50968L,50969L,50969L,50970L,50971L,50971L,
-     50972L,50972L,50973L,50974L,50974L,50975L,50976L,50976L,
-     50977L,50977L,50978L,50979L,50979L,50980L,50981L,50981L,
-     50982L,50983L,50983L,50984L,50984L,50985L,50986L,50986L,
-     50987L,50988L,50988L,50989L,50989L,50990L,50991L,50991L,
-     50992L,50993L,50993L,50994L,50994L,50995L,50996L,50996L,
-     50997L,50998L,50998L,50999L,50999L,51000L,51001L,51001L,
-     51002L,51003L,51003L,51004L,51004L,51005L,51006L,51006L,
-     51007L,51008L,51008L,51009L,51010L,51010L,51011L,51011L,
-     51012L,51013L,51013L,51014L,51015L,51015L,51016L,51016L,
-     51017L,51018L,51018L,51019L,51020L,51020L,51021L,51021L,
-     51022L,51023L,51023L,51024L,51025L,51025L,51026L,51026L,
-     51027L,51028L,51028L,51029L,51030L,51030L,51031L,51031L,
-     51032L,51033L,51033L,51034L,51035L,51035L,51036L,51036L,
-     51037L,51038L,51038L,51039L,51040L,51040L,51041L,51042L,
-     51042L,51043L,51043L,51044L,51045L,51045L,51046L,51047L,
-     51047L,51048L,51048L,51049L,51050L,51050L,51051L,51052L,
-     51052L,51053L,51053L,51054L,51055L,51055L,51056L,51057L,
-     51057L,51058L,51058L,51059L,51060L,51060L,51061L,51062L,
-     51062L,51063L,51063L,51064L,51065L,51065L,51066L,51067L,
-     51067L,51068L,51068L,51069L,51070L,51070L,51071L,51072L,
-     51072L,51073L,51073L,51074L,51075L,51075L,51076L,51077L,
-     51077L,51078L,51078L,51079L,51080L,51080L,51081L,51082L,
-     51082L,51083L,51084L,51084L,51085L,51085L,51086L,51087L,
-     51087L,51088L,51089L,51089L,51090L,51090L,51091L,51092L,
-     51092L,51093L,51094L,51094L,51095L,51095L,51096L,51097L,
-     51097L,51098L,51099L,51099L,51100L,51100L,51101L,51102L,
-     51102L,51103L,51104L,51104L,51105L,51105L,51106L,51107L,
-     51107L,51108L,51109L,51109L,51110L,51110L,51111L,51112L,
-     51112L,51113L,51114L,51114L,51115L,51115L,51116L,51117L,
-     51117L,51118L,51119L,51119L,51120L,51120L,51121L,51122L,
-     51122L,51123L,51124L,51124L,51125L,51125L,51126L,51127L,
-     51127L,51128L,51129L,51129L,51130L,51130L,51131L,51132L,
-     51132L,51133L,51134L,51134L,51135L,51135L,51136L,51137L,
-     51137L,51138L,51139L,51139L,51140L,51140L,51141L,51142L,
-     51142L,51143L,51144L,51144L,51145L,51145L,51146L,51147L,
-     51147L,51148L,51149L,51149L,51150L,51150L,51151L,51152L,
-     51152L,51153L,51154L,51154L,51155L,51155L,51156L,51157L,
-     51157L,51158L,51159L,51159L,51160L,51160L,51161L,51162L,
-     51162L,51163L,51164L,51164L,51165L,51165L,51166L,51167L,
-     51167L,51168L,51169L,51169L,51170L,51170L,51171L,51172L,
-     51172L,51173L,51174L,51174L,51175L,51175L,51176L,51177L,
-     51177L,51178L,51179L,51179L,51180L,51180L,51181L,51182L,
-     51182L,51183L,51184L,51184L,51185L,51185L,51186L,51187L,
-     51187L,51188L,51189L,51189L,51190L,51190L,51191L,51192L,
-     51192L,51193L,51194L,51194L,51195L,51195L,51196L,51197L,
-     51197L,51198L,51199L,51199L,51200L,51200L,51201L,51202L,
-     51202L,51203L,51204L,51204L,51205L,51205L,51206L,51207L,
-     51207L,51208L,51209L,51209L,51210L,51210L,51211L,51212L,
-     51212L,51213L,51214L,51214L,51215L,51215L,51216L,51217L,
-     51217L,51218L,51219L,51219L,51220L,51220L,51221L,51222L,
-     51222L,51223L,51224L,51224L,51225L,51225L,51226L,51227L,
-     51227L,51228L,51229L,51229L,51230L,51230L,51231L,51232L,
-     51232L,51233L,51234L,51234L,51235L,51235L,51236L,51237L,
-     51237L,51238L,51238L,51239L,51240L,51240L,51241L,51242L,
-     51242L,51243L,51243L,51244L,51245L,51245L,51246L,51247L,
-     51247L,51248L,51248L,51249L,51250L,51250L,51251L,51252L,
-     51252L,51253L,51253L,51254L,51255L,51255L,51256L,51257L,
-     51257L,51258L,51258L,51259L,51260L,51260L,51261L,51262L,
-     51262L,51263L,51263L,51264L,51265L,51265L,51266L,51267L,
-     51267L,51268L,51268L,51269L,51270L,51270L,51271L,51272L,
-     51272L,51273L,51273L,51274L,51275L,51275L,51276L,51277L,
-     51277L,51278L,51278L,51279L,51280L,51280L,51281L,51281L,
-     51282L,51283L,51283L,51284L,51285L,51285L,51286L,51286L,
-     51287L,51288L,51288L,51289L,51290L,51290L,51291L,51291L,
-     51292L,51293L,51293L,51294L,51295L,51295L,51296L,51296L,
-     51297L,51298L,51298L,51299L,51300L,51300L,51301L,51301L,
-     51302L,51303L,51303L,51304L,51305L,51305L,51306L,51306L,
-     51307L,51308L,51308L,51309L,51309L,51310L,51311L,51311L,
-     51312L,51313L,51313L,51314L,51314L,51315L,51316L,51316L,
-     51317L,51318L,51318L,51319L,51319L,51320L,51321L,51321L,
-     51322L,51323L,51323L,51324L,51324L,51325L,51326L,51326L,
-     51327L,51328L,51328L,51329L,51329L,51330L,51331L,51331L,
-     51332L,51333L,51333L,51334L,51334L,51335L,51336L,51336L,
-     51337L,51337L,51338L,51339L,51339L,51340L,51341L,51341L,
-     51342L,51342L,51343L,51344L,51344L,51345L,51346L,51346L,
-     51347L,51347L,51348L,51349L,51349L,51350L,51351L,51351L,
-     51352L,51352L,51353L,51354L,51354L,51355L,51356L,51356L,
-     51357L,51357L,51358L,51359L,51359L,51360L,51360L,51361L,
-     51362L,51362L,51363L,51364L,51364L,51365L,51365L,51366L,
-     51367L,51367L,51368L,51369L,51369L,51370L,51370L,51371L,
-     51372L,51372L,51373L,51374L,51374L,51375L,51375L,51376L,
-     51377L,51377L,51378L,51378L,51379L,51380L,51380L,51381L,
-     51382L,51382L,51383L,51383L,51384L,51385L,51385L,51386L,
-     51387L,51387L,51388L,51388L,51389L,51390L,51390L,51391L,
-     51392L,51392L,51393L,51393L,51394L,51395L,51395L,51396L,
-     51396L,51397L,51398L,51398L,51399L,51400L,51400L,51401L,
-     51401L,51402L,51403L,51403L,51404L,51405L,51405L,51406L,
-     51406L,51407L,51408L,51408L,51409L,51410L,51410L,51411L,
-     51411L,51412L,51413L,51413L,51414L,51414L,51415L,51416L,
-     51416L,51417L,51418L,51418L,51419L,51419L,51420L,51421L,
-     51421L,51422L,51423L,51423L,51424L,51424L,51425L,51426L,
-     51426L,51427L,51427L,51428L,51429L,51429L,51430L,51431L,
-     51431L,51432L,51432L,51433L,51434L,51434L,51435L,51436L,
-     51436L,51437L,51437L,51438L,51439L,51439L,51440L,51440L,
-     51441L,51442L,51442L,51443L,51444L,51444L,51445L,51445L,
-     51446L,51447L,51447L,51448L,51449L,51449L,51450L,51450L,
-     51451L,51452L,51452L,51453L,51454L,51454L,51455L,51455L,
-     51456L,51457L,51457L,51458L,51458L,51459L,51460L,51460L,
-     51461L,51462L,51462L,51463L,51463L,51464L,51465L,51465L,
-     51466L,51467L,51467L,51468L,51468L,51469L,51470L,51470L,
-     51471L,51471L,51472L,51473L,51473L,51474L,51475L,51475L,
-     51476L,51476L,51477L,51478L,51478L,51479L,51480L,51480L,
-     51481L,51481L,51482L,51483L,51483L,51484L,51484L,51485L,
-     51486L,51486L,51487L,51488L,51488L,51489L,51489L,51490L,
-     51491L,51491L,51492L,51493L,51493L,51494L,51494L,51495L,
-     51496L,51496L,51497L,51497L,51498L,51499L,51499L,51500L,
-     51501L,51501L,51502L,51502L,51503L,51504L,51504L,51505L,
-     51505L,51506L,51507L,51507L,51508L,51509L,51509L,51510L,
-     51510L,51511L,51512L,51512L,51513L,51514L,51514L,51515L,
-     51515L,51516L,51517L,51517L,51518L,51518L,51519L,51520L,
-     51520L,51521L,51522L,51522L,51523L,51523L,51524L,51525L,
-     51525L,51526L,51527L,51527L,51528L,51528L,51529L,51530L,
-     51530L,51531L,51531L,51532L,51533L,51533L,51534L,51535L,
-     51535L,51536L,51536L,51537L,51538L,51538L,51539L,51539L,
-     51540L,51541L,51541L,51542L,51543L,51543L,51544L,51544L,
-     51545L,51546L,51546L,51547L,51548L,51548L,51549L,51549L,
-     51550L,51551L,51551L,51552L,51552L,51553L,51554L,51554L,
-     51555L,51556L,51556L,51557L,51557L,51558L,51559L,51559L,
-     51560L,51560L,51561L,51562L,51562L,51563L,51564L,51564L,
-     51565L,51565L,51566L,51567L,51567L,51568L,51568L,51569L,
-     51570L,51570L,51571L,51572L,51572L,51573L,51573L,51574L,
-     51575L,51575L,51576L,51577L,51577L,51578L,51578L,51579L,
-     51580L,51580L,51581L,51581L,51582L,51583L,51583L,51584L,
-     51585L,51585L,51586L,51586L,51587L,51588L,51588L,51589L,
-     51589L,51590L,51591L,51591L,51592L,51593L,51593L,51594L,
-     51594L,51595L,51596L,51596L,51597L,51597L,51598L,51599L,
-     51599L,51600L,51601L,51601L,51602L,51602L,51603L,51604L,
-     51604L,51605L,51606L,51606L,51607L,51607L,51608L,51609L,
-     51609L,51610L,51610L,51611L,51612L,51612L,51613L,51614L,
-     51614L,51615L,51615L,51616L,51617L,51617L,51618L,51618L,
-     51619L,51620L,51620L,51621L,51622L,51622L,51623L,51623L,
-     51624L,51625L,51625L,51626L,51626L,51627L,51628L,51628L,
-     51629L,51630L,51630L,51631L,51631L,51632L,51633L,51633L,
-     51634L,51634L,51635L,51636L,51636L,51637L,51638L,51638L,
-     51639L,51639L,51640L,51641L,51641L,51642L,51642L,51643L,
-     51644L,51644L,51645L,51646L,51646L,51647L,51647L,51648L,
-     51649L,51649L,51650L,51650L,51651L,51652L,51652L,51653L,
-     51654L,51654L,51655L,51655L,51656L,51657L,51657L,51658L,
-     51658L,51659L,51660L,51660L,51661L,51662L,51662L,51663L,
-     51663L,51664L,51665L,51665L,51666L,51666L,51667L,51668L,
-     51668L,51669L,51670L,51670L,51671L,51671L,51672L,51673L,
-     51673L,51674L,51674L,51675L,51676L,51676L,51677L,51678L,
-     51678L,51679L,51679L,51680L,51681L,51681L,51682L,51682L,
-     51683L,51684L,51684L,51685L,51686L,51686L,51687L,51687L,
-     51688L,51689L,51689L,51690L,51690L,51691L,51692L,51692L,
-     51693L,51694L,51694L,51695L,51695L,51696L,51697L,51697L,
-     51698L,51698L,51699L,51700L,51700L,51701L,51702L,51702L,
-     51703L,51703L,51704L,51705L,51705L,51706L,51706L,51707L,
-     51708L,51708L,51709L,51709L,51710L,51711L,51711L,51712L,
-     51713L,51713L,51714L,51714L,51715L,51716L,51716L,51717L,
-     51717L,51718L,51719L,51719L,51720L,51721L,51721L,51722L,
-     51722L,51723L,51724L,51724L,51725L,51725L,51726L,51727L,
-     51727L,51728L,51729L,51729L,51730L,51730L,51731L,51732L,
-     51732L,51733L,51733L,51734L,51735L,51735L,51736L,51737L,
-     51737L,51738L,51738L,51739L,51740L,51740L,51741L,51741L,
-     51742L,51743L,51743L,51744L,51744L,51745L,51746L,51746L,
-     51747L,51748L,51748L,51749L,51749L,51750L,51751L,51751L,
-     51752L,51752L,51753L,51754L,51754L,51755L,51756L,51756L,
-     51757L,51757L,51758L,51759L,51759L,51760L,51760L,51761L,
-     51762L,51762L,51763L,51764L,51764L,51765L,51765L,51766L,
-     51767L,51767L,51768L,51768L,51769L,51770L,51770L,51771L,
-     51771L,51772L,51773L,51773L,51774L,51775L,51775L,51776L,
-     51776L,51777L,51778L,51778L,51779L,51779L,51780L,51781L,
-     51781L,51782L,51783L,51783L,51784L,51784L,51785L,51786L,
-     51786L,51787L,51787L,51788L,51789L,51789L,51790L,51790L,
-     51791L,51792L,51792L,51793L,51794L,51794L,51795L,51795L,
-     51796L,51797L,51797L,51798L,51798L,51799L,51800L,51800L,
-     51801L,51802L,51802L,51803L,51803L,51804L,51805L,51805L,
-     51806L,51806L,51807L,51808L,51808L,51809L,51809L,51810L,
-     51811L,51811L,51812L,51813L,51813L,51814L,51814L,51815L,
-     51816L,51816L,51817L,51817L,51818L,51819L,51819L,51820L,
-     51821L,51821L,51822L,51822L,51823L,51824L,51824L,51825L,
-     51825L,51826L,51827L,51827L,51828L,51828L,51829L,51830L,
-     51830L,51831L,51832L,51832L,51833L,51833L,51834L,51835L,
-     51835L,51836L,51836L,51837L,51838L,51838L,51839L,51839L,
-     51840L,51841L,51841L,51842L,51843L,51843L,51844L,51844L,
-     51845L,51846L,51846L,51847L,51847L,51848L,51849L,51849L,
-     51850L,51850L,51851L,51852L,51852L,51853L,51854L,51854L,
-     51855L,51855L,51856L,51857L,51857L,51858L,51858L,51859L,
-     51860L,51860L,51861L,51861L,51862L,51863L,51863L,51864L,
-     51865L,51865L,51866L,51866L,51867L,51868L,51868L,51869L,
-     51869L,51870L,51871L,51871L,51872L,51872L,51873L,51874L,
-     51874L,51875L,51876L,51876L,51877L,51877L,51878L,51879L,
-     51879L,51880L,51880L,51881L,51882L,51882L,51883L,51883L,
-     51884L,51885L,51885L,51886L,51887L,51887L,51888L,51888L,
-     51889L,51890L,51890L,51891L,51891L,51892L,51893L,51893L,
-     51894L,51894L,51895L,51896L,51896L,51897L,51898L,51898L,
-     51899L,51899L,51900L,51901L,51901L,51902L,51902L,51903L,
-     51904L,51904L,51905L,51905L,51906L,51907L,51907L,51908L,
-     51909L,51909L,51910L,51910L,51911L,51912L,51912L,51913L,
-     51913L,51914L,51915L,51915L,51916L,51916L,51917L,51918L,
-     51918L,51919L,51920L,51920L,51921L,51921L,51922L,51923L,
-     51923L,51924L,51924L,51925L,51926L,51926L,51927L,51927L,
-     51928L,51929L,51929L,51930L,51930L,51931L,51932L,51932L,
-     51933L,51934L,51934L,51935L,51935L,51936L,51937L,51937L,
-     51938L,51938L,51939L,51940L,51940L,51941L,51941L,51942L,
-     51943L,51943L,51944L,51945L,51945L,51946L,51946L,51947L,
-     51948L,51948L,51949L,51949L,51950L,51951L,51951L,51952L,
-     51952L,51953L,51954L,51954L,51955L,51955L,51956L,51957L,
-     51957L,51958L,51959L,51959L,51960L,51960L,51961L,51962L,
-     51962L,51963L,51963L,51964L,51965L,51965L,51966L,51966L,
-     51967L,51968L,51968L,51969L,51970L,51970L,51971L,51971L,
-     51972L,51973L,51973L,51974L,51974L,51975L,51976L,51976L,
-     51977L,51977L,51978L,51979L,51979L,51980L,51980L,51981L,
-     51982L,51982L,51983L,51984L,51984L,51985L,51985L,51986L,
-     51987L,51987L,51988L,51988L,51989L,51990L,51990L,51991L,
-     51991L,51992L,51993L,51993L,51994L,51994L,51995L,51996L,
-     51996L,51997L,51998L,51998L,51999L,51999L,52000L,52001L,
-     52001L,52002L,52002L,52003L,52004L,52004L,52005L,52005L,
-     52006L,52007L,52007L,52008L,52008L,52009L,52010L,52010L,
-     52011L,52012L,52012L,52013L,52013L,52014L,52015L,52015L,
-     52016L,52016L,52017L,52018L,52018L,52019L,52019L,52020L,
-     52021L,52021L,52022L,52022L,52023L,52024L,52024L,52025L,
-     52026L,52026L,52027L,52027L,52028L,52029L,52029L,52030L,
-     52030L,52031L,52032L,52032L,52033L,52033L,52034L,52035L,
-     52035L,52036L,52036L,52037L,52038L,52038L,52039L,52039L,
-     52040L,52041L,52041L,52042L,52043L,52043L,52044L,52044L,
-     52045L,52046L,52046L,52047L,52047L,52048L,52049L,52049L,
-     52050L,52050L,52051L,52052L,52052L,52053L,52053L,52054L,
-     52055L,52055L,52056L,52057L,52057L,52058L,52058L,52059L,
-     52060L,52060L,52061L,52061L,52062L,52063L,52063L,52064L,
-     52064L,52065L,52066L,52066L,52067L,52067L,52068L,52069L,
-     52069L,52070L,52070L,52071L,52072L,52072L,52073L,52074L,
-     52074L,52075L,52075L,52076L,52077L,52077L,52078L,52078L,
-     52079L,52080L,52080L,52081L,52081L,52082L,52083L,52083L,
-     52084L,52084L,52085L,52086L,52086L,52087L,52087L,52088L,
-     52089L,52089L,52090L,52091L,52091L,52092L,52092L,52093L,
-     52094L,52094L,52095L,52095L,52096L,52097L,52097L,52098L,
-     52098L,52099L,52100L,52100L,52101L,52101L,52102L,52103L,
-     52103L,52104L,52104L,52105L,52106L,52106L,52107L,52107L,
-     52108L,52109L,52109L,52110L,52111L,52111L,52112L,52112L,
-     52113L,52114L,52114L,52115L,52115L,52116L,52117L,52117L,
-     52118L,52118L,52119L,52120L,52120L,52121L,52121L,52122L,
-     52123L,52123L,52124L,52124L,52125L,52126L,52126L,52127L,
-     52128L,52128L,52129L,52129L,52130L,52131L,52131L,52132L,
-     52132L,52133L,52134L,52134L,52135L,52135L,52136L,52137L,
-     52137L,52138L,52138L,52139L,52140L,52140L,52141L,52141L,
-     52142L,52143L,52143L,52144L,52144L,52145L,52146L,52146L,
-     52147L,52147L,52148L,52149L,52149L,52150L,52151L,52151L,
-     52152L,52152L,52153L,52154L,52154L,52155L,52155L,52156L,
-     52157L,52157L,52158L,52158L,52159L,52160L,52160L,52161L,
-     52161L,52162L,52163L,52163L,52164L,52164L,52165L,52166L,
-     52166L,52167L,52167L,52168L,52169L,52169L,52170L,52171L,
-     52171L,52172L,52172L,52173L,52174L,52174L,52175L,52175L,
-     52176L,52177L,52177L,52178L,52178L,52179L,52180L,52180L,
-     52181L,52181L,52182L,52183L,52183L,52184L,52184L,52185L,
-     52186L,52186L,52187L,52187L,52188L,52189L,52189L,52190L,
-     52190L,52191L,52192L,52192L,52193L,52193L,52194L,52195L,
-     52195L,52196L,52197L,52197L,52198L,52198L,52199L,52200L,
-     52200L,52201L,52201L,52202L,52203L,52203L,52204L,52204L,
-     52205L,52206L,52206L,52207L,52207L,52208L,52209L,52209L,
-     52210L,52210L,52211L,52212L,52212L,52213L,52213L,52214L,
-     52215L,52215L,52216L,52216L,52217L,52218L,52218L,52219L,
-     52219L,52220L,52221L,52221L,52222L,52223L,52223L,52224L,
-     52224L,52225L,52226L,52226L,52227L,52227L,52228L,52229L,
-     52229L,52230L,52230L,52231L,52232L,52232L,52233L,52233L,
-     52234L,52235L,52235L,52236L,52236L,52237L,52238L,52238L,
-     52239L,52239L,52240L,52241L,52241L,52242L,52242L,52243L,
-     52244L,52244L,52245L,52245L,52246L,52247L,52247L,52248L,
-     52248L,52249L,52250L,52250L,52251L,52251L,52252L,52253L,
-     52253L,52254L,52255L,52255L,52256L,52256L,52257L,52258L,
-     52258L,52259L,52259L,52260L,52261L,52261L,52262L,52262L,
-     52263L,52264L,52264L,52265L,52265L,52266L,52267L,52267L,
-     52268L,52268L,52269L,52270L,52270L,52271L,52271L,52272L,
-     52273L,52273L,52274L,52274L,52275L,52276L,52276L,52277L,
-     52277L,52278L,52279L,52279L,52280L,52280L,52281L,52282L,
-     52282L,52283L,52283L,52284L,52285L,52285L,52286L,52286L,
-     52287L,52288L,52288L,52289L,52289L,52290L,52291L,52291L,
-     52292L,52293L,52293L,52294L,52294L,52295L,52296L,52296L,
-     52297L,52297L,52298L,52299L,52299L,52300L,52300L,52301L,
-     52302L,52302L,52303L,52303L,52304L,52305L,52305L,52306L,
-     52306L,52307L,52308L,52308L,52309L,52309L,52310L,52311L,
-     52311L,52312L,52312L,52313L,52314L,52314L,52315L,52315L,
-     52316L,52317L,52317L,52318L,52318L,52319L,52320L,52320L,
-     52321L,52321L,52322L,52323L,52323L,52324L,52324L,52325L,
-     52326L,52326L,52327L,52327L,52328L,52329L,52329L,52330L,
-     52330L,52331L,52332L,52332L,52333L,52333L,52334L,52335L,
-     52335L,52336L,52336L,52337L,52338L,52338L,52339L,52339L,
-     52340L,52341L,52341L,52342L,52342L,52343L,52344L,52344L,
-     52345L,52346L,52346L,52347L,52347L,52348L,52349L,52349L,
-     52350L,52350L,52351L,52352L,52352L,52353L,52353L,52354L,
-     52355L,52355L,52356L,52356L,52357L,52358L,52358L,52359L,
-     52359L,52360L,52361L,52361L,52362L,52362L,52363L,52364L,
-     52364L,52365L,52365L,52366L,52367L,52367L,52368L,52368L,
-     52369L,52370L,52370L,52371L,52371L,52372L,52373L,52373L,
-     52374L,52374L,52375L,52376L,52376L,52377L,52377L,52378L,
-     52379L,52379L,52380L,52380L,52381L,52382L,52382L,52383L,
-     52383L,52384L,52385L,52385L,52386L,52386L,52387L,52388L,
-     52388L,52389L,52389L,52390L,52391L,52391L,52392L,52392L,
-     52393L,52394L,52394L,52395L,52395L,52396L,52397L,52397L,
-     52398L,52398L,52399L,52400L,52400L,52401L,52401L,52402L,
-     52403L,52403L,52404L,52404L,52405L,52406L,52406L,52407L,
-     52407L,52408L,52409L,52409L,52410L,52410L,52411L,52412L,
-     52412L,52413L,52413L,52414L,52415L,52415L,52416L,52416L,
-     52417L,52418L,52418L,52419L,52419L,52420L,52421L,52421L,
-     52422L,52422L,52423L,52424L,52424L,52425L,52425L,52426L,
-     52427L,52427L,52428L,52428L,52429L,52430L,52430L,52431L,
-     52431L,52432L,52433L,52433L,52434L,52434L,52435L,52436L,
-     52436L,52437L,52437L,52438L,52439L,52439L,52440L,52440L,
-     52441L,52442L,52442L,52443L,52443L,52444L,52445L,52445L,
-     52446L,52446L,52447L,52448L,52448L,52449L,52449L,52450L,
-     52451L,52451L,52452L,52452L,52453L,52454L,52454L,52455L,
-     52455L,52456L,52457L,52457L,52458L,52458L,52459L,52460L,
-     52460L,52461L,52461L,52462L,52463L,52463L,52464L,52464L,
-     52465L,52466L,52466L,52467L,52467L,52468L,52469L,52469L,
-     52470L,52470L,52471L,52472L,52472L,52473L,52473L,52474L,
-     52475L,52475L,52476L,52476L,52477L,52478L,52478L,52479L,
-     52479L,52480L,52481L,52481L,52482L,52482L,52483L,52484L,
-     52484L,52485L,52485L,52486L,52487L,52487L,52488L,52488L,
-     52489L,52490L,52490L,52491L,52491L,52492L,52493L,52493L,
-     52494L,52494L,52495L,52496L,52496L,52497L,52497L,52498L,
-     52499L,52499L,52500L,52500L,52501L,52502L,52502L,52503L,
-     52503L,52504L,52505L,52505L,52506L,52506L,52507L,52508L,
-     52508L,52509L,52509L,52510L,52511L,52511L,52512L,52512L,
-     52513L,52513L,52514L,52515L,52515L,52516L,52516L,52517L,
-     52518L,52518L,52519L,52519L,52520L,52521L,52521L,52522L,
-     52522L,52523L,52524L,52524L,52525L,52525L,52526L,52527L,
-     52527L,52528L,52528L,52529L,52530L,52530L,52531L,52531L,
-     52532L,52533L,52533L,52534L,52534L,52535L,52536L,52536L,
-     52537L,52537L,52538L,52539L,52539L,52540L,52540L,52541L,
-     52542L,52542L,52543L,52543L,52544L,52545L,52545L,52546L,
-     52546L,52547L,52548L,52548L,52549L,52549L,52550L,52551L,
-     52551L,52552L,52552L,52553L,52554L,52554L,52555L,52555L,
-     52556L,52557L,52557L,52558L,52558L,52559L,52560L,52560L,
-     52561L,52561L,52562L,52563L,52563L,52564L,52564L,52565L,
-     52565L,52566L,52567L,52567L,52568L,52568L,52569L,52570L,
-     52570L,52571L,52571L,52572L,52573L,52573L,52574L,52574L,
-     52575L,52576L,52576L,52577L,52577L,52578L,52579L,52579L,
-     52580L,52580L,52581L,52582L,52582L,52583L,52583L,52584L,
-     52585L,52585L,52586L,52586L,52587L,52588L,52588L,52589L,
-     52589L,52590L,52591L,52591L,52592L,52592L,52593L,52594L,
-     52594L,52595L,52595L,52596L,52597L,52597L,52598L,52598L,
-     52599L,52600L,52600L,52601L,52601L,52602L,52603L,52603L,
-     52604L,52604L,52605L,52605L,52606L,52607L,52607L,52608L,
-     52608L,52609L,52610L,52610L,52611L,52611L,52612L,52613L,
-     52613L,52614L,52614L,52615L,52616L,52616L,52617L,52617L,
-     52618L,52619L,52619L,52620L,52620L,52621L,52622L,52622L,
-     52623L,52623L,52624L,52625L,52625L,52626L,52626L,52627L,
-     52628L,52628L,52629L,52629L,52630L,52631L,52631L,52632L,
-     52632L,52633L,52634L,52634L,52635L,52635L,52636L,52636L,
-     52637L,52638L,52638L,52639L,52639L,52640L,52641L,52641L,
-     52642L,52642L,52643L,52644L,52644L,52645L,52645L,52646L,
-     52647L,52647L,52648L,52648L,52649L,52650L,52650L,52651L,
-     52651L,52652L,52653L,52653L,52654L,52654L,52655L,52656L,
-     52656L,52657L,52657L,52658L,52659L,52659L,52660L,52660L,
-     52661L,52661L,52662L,52663L,52663L,52664L,52664L,52665L,
-     52666L,52666L,52667L,52667L,52668L,52669L,52669L,52670L,
-     52670L,52671L,52672L,52672L,52673L,52673L,52674L,52675L,
-     52675L,52676L,52676L,52677L,52678L,52678L,52679L,52679L,
-     52680L,52681L,52681L,52682L,52682L,52683L,52684L,52684L,
-     52685L,52685L,52686L,52686L,52687L,52688L,52688L,52689L,
-     52689L,52690L,52691L,52691L,52692L,52692L,52693L,52694L,
-     52694L,52695L,52695L,52696L,52697L,52697L,52698L,52698L,
-     52699L,52700L,52700L,52701L,52701L,52702L,52703L,52703L,
-     52704L,52704L,52705L,52706L,52706L,52707L,52707L,52708L,
-     52708L,52709L,52710L,52710L,52711L,52711L,52712L,52713L,
-     52713L,52714L,52714L,52715L,52716L,52716L,52717L,52717L,
-     52718L,52719L,52719L,52720L,52720L,52721L,52722L,52722L,
-     52723L,52723L,52724L,52725L,52725L,52726L,52726L,52727L,
-     52727L,52728L,52729L,52729L,52730L,52730L,52731L,52732L,
-     52732L,52733L,52733L,52734L,52735L,52735L,52736L,52736L,
-     52737L,52738L,52738L,52739L,52739L,52740L,52741L,52741L,
-     52742L,52742L,52743L,52744L,52744L,52745L,52745L,52746L,
-     52746L,52747L,52748L,52748L,52749L,52749L,52750L,52751L,
-     52751L,52752L,52752L,52753L,52754L,52754L,52755L,52755L,
-     52756L,52757L,52757L,52758L,52758L,52759L,52760L,52760L,
-     52761L,52761L,52762L,52763L,52763L,52764L,52764L,52765L,
-     52765L,52766L,52767L,52767L,52768L,52768L,52769L,52770L,
-     52770L,52771L,52771L,52772L,52773L,52773L,52774L,52774L,
-     52775L,52776L,52776L,52777L,52777L,52778L,52779L,52779L,
-     52780L,52780L,52781L,52781L,52782L,52783L,52783L,52784L,
-     52784L,52785L,52786L,52786L,52787L,52787L,52788L,52789L,
-     52789L,52790L,52790L,52791L,52792L,52792L,52793L,52793L,
-     52794L,52795L,52795L,52796L,52796L,52797L,52797L,52798L,
-     52799L,52799L,52800L,52800L,52801L,52802L,52802L,52803L,
-     52803L,52804L,52805L,52805L,52806L,52806L,52807L,52808L,
-     52808L,52809L,52809L,52810L,52811L,52811L,52812L,52812L,
-     52813L,52813L,52814L,52815L,52815L,52816L,52816L,52817L,
-     52818L,52818L,52819L,52819L,52820L,52821L,52821L,52822L,
-     52822L,52823L,52824L,52824L,52825L,52825L,52826L,52826L,
-     52827L,52828L,52828L,52829L,52829L,52830L,52831L,52831L,
-     52832L,52832L,52833L,52834L,52834L,52835L,52835L,52836L,
-     52837L,52837L,52838L,52838L,52839L,52840L,52840L,52841L,
-     52841L,52842L,52842L,52843L,52844L,52844L,52845L,52845L,
-     52846L,52847L,52847L,52848L,52848L,52849L,52850L,52850L,
-     52851L,52851L,52852L,52853L,52853L,52854L,52854L,52855L,
-     52855L,52856L,52857L,52857L,52858L,52858L,52859L,52860L,
-     52860L,52861L,52861L,52862L,52863L,52863L,52864L,52864L,
-     52865L,52866L,52866L,52867L,52867L,52868L,52868L,52869L,
-     52870L,52870L,52871L,52871L,52872L,52873L,52873L,52874L,
-     52874L,52875L,52876L,52876L,52877L,52877L,52878L,52879L,
-     52879L,52880L,52880L,52881L,52881L,52882L,52883L,52883L,
-     52884L,52884L,52885L,52886L,52886L,52887L,52887L,52888L,
-     52889L,52889L,52890L,52890L,52891L,52892L,52892L,52893L,
-     52893L,52894L,52894L,52895L,52896L,52896L,52897L,52897L,
-     52898L,52899L,52899L,52900L,52900L,52901L,52902L,52902L,
-     52903L,52903L,52904L,52905L,52905L,52906L,52906L,52907L,
-     52907L,52908L,52909L,52909L,52910L,52910L,52911L,52912L,
-     52912L,52913L,52913L,52914L,52915L,52915L,52916L,52916L,
-     52917L,52917L,52918L,52919L,52919L,52920L,52920L,52921L,
-     52922L,52922L,52923L,52923L,52924L,52925L,52925L,52926L,
-     52926L,52927L,52928L,52928L,52929L,52929L,52930L,52930L,
-     52931L,52932L,52932L,52933L,52933L,52934L,52935L,52935L,
-     52936L,52936L,52937L,52938L,52938L,52939L,52939L,52940L,
-     52940L,52941L,52942L,52942L,52943L,52943L,52944L,52945L,
-     52945L,52946L,52946L,52947L,52948L,52948L,52949L,52949L,
-     52950L,52950L,52951L,52952L,52952L,52953L,52953L,52954L,
-     52955L,52955L,52956L,52956L,52957L,52958L,52958L,52959L,
-     52959L,52960L,52961L,52961L,52962L,52962L,52963L,52963L,
-     52964L,52965L,52965L,52966L,52966L,52967L,52968L,52968L,
-     52969L,52969L,52970L,52971L,52971L,52972L,52972L,52973L,
-     52973L,52974L,52975L,52975L,52976L,52976L,52977L,52978L,
-     52978L,52979L,52979L,52980L,52981L,52981L,52982L,52982L,
-     52983L,52983L,52984L,52985L,52985L,52986L,52986L,52987L,
-     52988L,52988L,52989L,52989L,52990L,52991L,52991L,52992L,
-     52992L,52993L,52993L,52994L,52995L,52995L,52996L,52996L,
-     52997L,52998L,52998L,52999L,52999L,53000L,53001L,53001L,
-     53002L,53002L,53003L,53003L,53004L,53005L,53005L,53006L,
-     53006L,53007L,53008L,53008L,53009L,53009L,53010L,53011L,
-     53011L,53012L,53012L,53013L,53013L,53014L,53015L,53015L,
-     53016L,53016L,53017L,53018L,53018L,53019L,53019L,53020L,
-     53021L,53021L,53022L,53022L,53023L,53023L,53024L,53025L,
-     53025L,53026L,53026L,53027L,53028L,53028L,53029L,53029L,
-     53030L,53031L,53031L,53032L,53032L,53033L,53033L,53034L,
-     53035L,53035L,53036L,53036L,53037L,53038L,53038L,53039L,
-     53039L,53040L,53041L,53041L,53042L,53042L,53043L,53043L,
-     53044L,53045L,53045L,53046L,53046L,53047L,53048L,53048L,
-     53049L,53049L,53050L,53050L,53051L,53052L,53052L,53053L,
-     53053L,53054L,53055L,53055L,53056L,53056L,53057L,53058L,
-     53058L,53059L,53059L,53060L,53060L,53061L,53062L,53062L,
-     53063L,53063L,53064L,53065L,53065L,53066L,53066L,53067L,
-     53068L,53068L,53069L,53069L,53070L,53070L,53071L,53072L,
-     53072L,53073L,53073L,53074L,53075L,53075L,53076L,53076L,
-     53077L,53077L,53078L,53079L,53079L,53080L,53080L,53081L,
-     53082L,53082L,53083L,53083L,53084L,53085L,53085L,53086L,
-     53086L,53087L,53087L,53088L,53089L,53089L,53090L,53090L,
-     53091L,53092L,53092L,53093L,53093L,53094L,53094L,53095L,
-     53096L,53096L,53097L,53097L,53098L,53099L,53099L,53100L,
-     53100L,53101L,53102L,53102L,53103L,53103L,53104L,53104L,
-     53105L,53106L,53106L,53107L,53107L,53108L,53109L,53109L,
-     53110L,53110L,53111L,53111L,53112L,53113L,53113L,53114L,
-     53114L,53115L,53116L,53116L,53117L,53117L,53118L,53119L,
-     53119L,53120L,53120L,53121L,53121L,53122L,53123L,53123L,
-     53124L,53124L,53125L,53126L,53126L,53127L,53127L,53128L,
-     53128L,53129L,53130L,53130L,53131L,53131L,53132L,53133L,
-     53133L,53134L,53134L,53135L,53135L,53136L,53137L,53137L,
-     53138L,53138L,53139L,53140L,53140L,53141L,53141L,53142L,
-     53143L,53143L,53144L,53144L,53145L,53145L,53146L,53147L,
-     53147L,53148L,53148L,53149L,53150L,53150L,53151L,53151L,
-     53152L,53152L,53153L,53154L,53154L,53155L,53155L,53156L,
-     53157L,53157L,53158L,53158L,53159L,53159L,53160L,53161L,
-     53161L,53162L,53162L,53163L,53164L,53164L,53165L,53165L,
-     53166L,53167L,53167L,53168L,53168L,53169L,53169L,53170L,
-     53171L,53171L,53172L,53172L,53173L,53174L,53174L,53175L,
-     53175L,53176L,53176L,53177L,53178L,53178L,53179L,53179L,
-     53180L,53181L,53181L,53182L,53182L,53183L,53183L,53184L,
-     53185L,53185L,53186L,53186L,53187L,53188L,53188L,53189L,
-     53189L,53190L,53190L,53191L,53192L,53192L,53193L,53193L,
-     53194L,53195L,53195L,53196L,53196L,53197L,53197L,53198L,
-     53199L,53199L,53200L,53200L,53201L,53202L,53202L,53203L,
-     53203L,53204L,53204L,53205L,53206L,53206L,53207L,53207L,
-     53208L,53209L,53209L,53210L,53210L,53211L,53211L,53212L,
-     53213L,53213L,53214L,53214L,53215L,53216L,53216L,53217L,
-     53217L,53218L,53218L,53219L,53220L,53220L,53221L,53221L,
-     53222L,53223L,53223L,53224L,53224L,53225L,53225L,53226L,
-     53227L,53227L,53228L,53228L,53229L,53230L,53230L,53231L,
-     53231L,53232L,53232L,53233L,53234L,53234L,53235L,53235L,
-     53236L,53237L,53237L,53238L,53238L,53239L,53239L,53240L,
-     53241L,53241L,53242L,53242L,53243L,53244L,53244L,53245L,
-     53245L,53246L,53246L,53247L,53248L,53248L,53249L,53249L,
-     53250L,53251L,53251L,53252L,53252L,53253L,53253L,53254L,
-     53255L,53255L,53256L,53256L,53257L,53258L,53258L,53259L,
-     53259L,53260L,53260L,53261L,53262L,53262L,53263L,53263L,
-     53264L,53265L,53265L,53266L,53266L,53267L,53267L,53268L,
-     53269L,53269L,53270L,53270L,53271L,53272L,53272L,53273L,
-     53273L,53274L,53274L,53275L,53276L,53276L,53277L,53277L,
-     53278L,53279L,53279L,53280L,53280L,53281L,53281L,53282L,
-     53283L,53283L,53284L,53284L,53285L,53286L,53286L,53287L,
-     53287L,53288L,53288L,53289L,53290L,53290L,53291L,53291L,
-     53292L,53293L,53293L,53294L,53294L,53295L,53295L,53296L,
-     53297L,53297L,53298L,53298L,53299L,53299L,53300L,53301L,
-     53301L,53302L,53302L,53303L,53304L,53304L,53305L,53305L,
-     53306L,53306L,53307L,53308L,53308L,53309L,53309L,53310L,
-     53311L,53311L,53312L,53312L,53313L,53313L,53314L,53315L,
-     53315L,53316L,53316L,53317L,53318L,53318L,53319L,53319L,
-     53320L,53320L,53321L,53322L,53322L,53323L,53323L,53324L,
-     53324L,53325L,53326L,53326L,53327L,53327L,53328L,53329L,
-     53329L,53330L,53330L,53331L,53331L,53332L,53333L,53333L,
-     53334L,53334L,53335L,53336L,53336L,53337L,53337L,53338L,
-     53338L,53339L,53340L,53340L,53341L,53341L,53342L,53343L,
-     53343L,53344L,53344L,53345L,53345L,53346L,53347L,53347L,
-     53348L,53348L,53349L,53349L,53350L,53351L,53351L,53352L,
-     53352L,53353L,53354L,53354L,53355L,53355L,53356L,53356L,
-     53357L,53358L,53358L,53359L,53359L,53360L,53361L,53361L,
-     53362L,53362L,53363L,53363L,53364L,53365L,53365L,53366L,
-     53366L,53367L,53367L,53368L,53369L,53369L,53370L,53370L,
-     53371L,53372L,53372L,53373L,53373L,53374L,53374L,53375L,
-     53376L,53376L,53377L,53377L,53378L,53379L,53379L,53380L,
-     53380L,53381L,53381L,53382L,53383L,53383L,53384L,53384L,
-     53385L,53385L,53386L,53387L,53387L,53388L,53388L,53389L,
-     53390L,53390L,53391L,53391L,53392L,53392L,53393L,53394L,
-     53394L,53395L,53395L,53396L,53396L,53397L,53398L,53398L,
-     53399L,53399L,53400L,53401L,53401L,53402L,53402L,53403L,
-     53403L,53404L,53405L,53405L,53406L,53406L,53407L,53407L,
-     53408L,53409L,53409L,53410L,53410L,53411L,53412L,53412L,
-     53413L,53413L,53414L,53414L,53415L,53416L,53416L,53417L,
-     53417L,53418L,53419L,53419L,53420L,53420L,53421L,53421L,
-     53422L,53423L,53423L,53424L,53424L,53425L,53425L,53426L,
-     53427L,53427L,53428L,53428L,53429L,53430L,53430L,53431L,
-     53431L,53432L,53432L,53433L,53434L,53434L,53435L,53435L,
-     53436L,53436L,53437L,53438L,53438L,53439L,53439L,53440L,
-     53441L,53441L,53442L,53442L,53443L,53443L,53444L,53445L,
-     53445L,53446L,53446L,53447L,53447L,53448L,53449L,53449L,
-     53450L,53450L,53451L,53452L,53452L,53453L,53453L,53454L,
-     53454L,53455L,53456L,53456L,53457L,53457L,53458L,53458L,
-     53459L,53460L,53460L,53461L,53461L,53462L,53462L,53463L,
-     53464L,53464L,53465L,53465L,53466L,53467L,53467L,53468L,
-     53468L,53469L,53469L,53470L,53471L,53471L,53472L,53472L,
-     53473L,53473L,53474L,53475L,53475L,53476L,53476L,53477L,
-     53478L,53478L,53479L,53479L,53480L,53480L,53481L,53482L,
-     53482L,53483L,53483L,53484L,53484L,53485L,53486L,53486L,
-     53487L,53487L,53488L,53489L,53489L,53490L,53490L,53491L,
-     53491L,53492L,53493L,53493L,53494L,53494L,53495L,53495L,
-     53496L,53497L,53497L,53498L,53498L,53499L,53499L,53500L,
-     53501L,53501L,53502L,53502L,53503L,53504L,53504L,53505L,
-     53505L,53506L,53506L,53507L,53508L,53508L,53509L,53509L,
-     53510L,53510L,53511L,53512L,53512L,53513L,53513L,53514L,
-     53515L,53515L,53516L,53516L,53517L,53517L,53518L,53519L,
-     53519L,53520L,53520L,53521L,53521L,53522L,53523L,53523L,
-     53524L,53524L,53525L,53525L,53526L,53527L,53527L,53528L,
-     53528L,53529L,53530L,53530L,53531L,53531L,53532L,53532L,
-     53533L,53534L,53534L,53535L,53535L,53536L,53536L,53537L,
-     53538L,53538L,53539L,53539L,53540L,53540L,53541L,53542L,
-     53542L,53543L,53543L,53544L,53545L,53545L,53546L,53546L,
-     53547L,53547L,53548L,53549L,53549L,53550L,53550L,53551L,
-     53551L,53552L,53553L,53553L,53554L,53554L,53555L,53555L,
-     53556L,53557L,53557L,53558L,53558L,53559L,53559L,53560L,
-     53561L,53561L,53562L,53562L,53563L,53564L,53564L,53565L,
-     53565L,53566L,53566L,53567L,53568L,53568L,53569L,53569L,
-     53570L,53570L,53571L,53572L,53572L,53573L,53573L,53574L,
-     53574L,53575L,53576L,53576L,53577L,53577L,53578L,53578L,
-     53579L,53580L,53580L,53581L,53581L,53582L,53583L,53583L,
-     53584L,53584L,53585L,53585L,53586L,53587L,53587L,53588L,
-     53588L,53589L,53589L,53590L,53591L,53591L,53592L,53592L,
-     53593L,53593L,53594L,53595L,53595L,53596L,53596L,53597L,
-     53597L,53598L,53599L,53599L,53600L,53600L,53601L,53602L,
-     53602L,53603L,53603L,53604L,53604L,53605L,53606L,53606L,
-     53607L,53607L,53608L,53608L,53609L,53610L,53610L,53611L,
-     53611L,53612L,53612L,53613L,53614L,53614L,53615L,53615L,
-     53616L,53616L,53617L,53618L,53618L,53619L,53619L,53620L,
-     53621L,53621L,53622L,53622L,53623L,53623L,53624L,53625L,
-     53625L,53626L,53626L,53627L,53627L,53628L,53629L,53629L,
-     53630L,53630L,53631L,53631L,53632L,53633L,53633L,53634L,
-     53634L,53635L,53635L,53636L,53637L,53637L,53638L,53638L,
-     53639L,53639L,53640L,53641L,53641L,53642L,53642L,53643L,
-     53643L,53644L,53645L,53645L,53646L,53646L,53647L,53648L,
-     53648L,53649L,53649L,53650L,53650L,53651L,53652L,53652L,
-     53653L,53653L,53654L,53654L,53655L,53656L,53656L,53657L,
-     53657L,53658L,53658L,53659L,53660L,53660L,53661L,53661L,
-     53662L,53662L,53663L,53664L,53664L,53665L,53665L,53666L,
-     53666L,53667L,53668L,53668L,53669L,53669L,53670L,53670L,
-     53671L,53672L,53672L,53673L,53673L,53674L,53674L,53675L,
-     53676L,53676L,53677L,53677L,53678L,53679L,53679L,53680L,
-     53680L,53681L,53681L,53682L,53683L,53683L,53684L,53684L,
-     53685L,53685L,53686L,53687L,53687L,53688L,53688L,53689L,
-     53689L,53690L,53691L,53691L,53692L,53692L,53693L,53693L,
-     53694L,53695L,53695L,53696L,53696L,53697L,53697L,53698L,
-     53699L,53699L,53700L,53700L,53701L,53701L,53702L,53703L,
-     53703L,53704L,53704L,53705L,53705L,53706L,53707L,53707L,
-     53708L,53708L,53709L,53709L,53710L,53711L,53711L,53712L,
-     53712L,53713L,53713L,53714L,53715L,53715L,53716L,53716L,
-     53717L,53717L,53718L,53719L,53719L,53720L,53720L,53721L,
-     53722L,53722L,53723L,53723L,53724L,53724L,53725L,53726L,
-     53726L,53727L,53727L,53728L,53728L,53729L,53730L,53730L,
-     53731L,53731L,53732L,53732L,53733L,53734L,53734L,53735L,
-     53735L,53736L,53736L,53737L,53738L,53738L,53739L,53739L,
-     53740L,53740L,53741L,53742L,53742L,53743L,53743L,53744L,
-     53744L,53745L,53746L,53746L,53747L,53747L,53748L,53748L,
-     53749L,53750L,53750L,53751L,53751L,53752L,53752L,53753L,
-     53754L,53754L,53755L,53755L,53756L,53756L,53757L,53758L,
-     53758L,53759L,53759L,53760L,53760L,53761L,53762L,53762L,
-     53763L,53763L,53764L,53764L,53765L,53766L,53766L,53767L,
-     53767L,53768L,53768L,53769L,53770L,53770L,53771L,53771L,
-     53772L,53772L,53773L,53774L,53774L,53775L,53775L,53776L,
-     53776L,53777L,53778L,53778L,53779L,53779L,53780L,53780L,
-     53781L,53782L,53782L,53783L,53783L,53784L,53784L,53785L,
-     53786L,53786L,53787L,53787L,53788L,53788L,53789L,53790L,
-     53790L,53791L,53791L,53792L,53792L,53793L,53794L,53794L,
-     53795L,53795L,53796L,53796L,53797L,53798L,53798L,53799L,
-     53799L,53800L,53800L,53801L,53802L,53802L,53803L,53803L,
-     53804L,53804L,53805L,53806L,53806L,53807L,53807L,53808L,
-     53808L,53809L,53810L,53810L,53811L,53811L,53812L,53812L,
-     53813L,53814L,53814L,53815L,53815L,53816L,53816L,53817L,
-     53818L,53818L,53819L,53819L,53820L,53820L,53821L,53822L,
-     53822L,53823L,53823L,53824L,53824L,53825L,53826L,53826L,
-     53827L,53827L,53828L,53828L,53829L,53830L,53830L,53831L,
-     53831L,53832L,53832L,53833L,53834L,53834L,53835L,53835L,
-     53836L,53836L,53837L,53838L,53838L,53839L,53839L,53840L,
-     53840L,53841L,53842L,53842L,53843L,53843L,53844L,53844L,
-     53845L,53845L,53846L,53847L,53847L,53848L,53848L,53849L,
-     53849L,53850L,53851L,53851L,53852L,53852L,53853L,53853L,
-     53854L,53855L,53855L,53856L,53856L,53857L,53857L,53858L,
-     53859L,53859L,53860L,53860L,53861L,53861L,53862L,53863L,
-     53863L,53864L,53864L,53865L,53865L,53866L,53867L,53867L,
-     53868L,53868L,53869L,53869L,53870L,53871L,53871L,53872L,
-     53872L,53873L,53873L,53874L,53875L,53875L,53876L,53876L,
-     53877L,53877L,53878L,53879L,53879L,53880L,53880L,53881L,
-     53881L,53882L,53883L,53883L,53884L,53884L,53885L,53885L,
-     53886L,53887L,53887L,53888L,53888L,53889L,53889L,53890L,
-     53890L,53891L,53892L,53892L,53893L,53893L,53894L,53894L,
-     53895L,53896L,53896L,53897L,53897L,53898L,53898L,53899L,
-     53900L,53900L,53901L,53901L,53902L,53902L,53903L,53904L,
-     53904L,53905L,53905L,53906L,53906L,53907L,53908L,53908L,
-     53909L,53909L,53910L,53910L,53911L,53912L,53912L,53913L,
-     53913L,53914L,53914L,53915L,53916L,53916L,53917L,53917L,
-     53918L,53918L,53919L,53919L,53920L,53921L,53921L,53922L,
-     53922L,53923L,53923L,53924L,53925L,53925L,53926L,53926L,
-     53927L,53927L,53928L,53929L,53929L,53930L,53930L,53931L,
-     53931L,53932L,53933L,53933L,53934L,53934L,53935L,53935L,
-     53936L,53937L,53937L,53938L,53938L,53939L,53939L,53940L,
-     53941L,53941L,53942L,53942L,53943L,53943L,53944L,53944L,
-     53945L,53946L,53946L,53947L,53947L,53948L,53948L,53949L,
-     53950L,53950L,53951L,53951L,53952L,53952L,53953L,53954L,
-     53954L,53955L,53955L,53956L,53956L,53957L,53958L,53958L,
-     53959L,53959L,53960L,53960L,53961L,53962L,53962L,53963L,
-     53963L,53964L,53964L,53965L,53965L,53966L,53967L,53967L,
-     53968L,53968L,53969L,53969L,53970L,53971L,53971L,53972L,
-     53972L,53973L,53973L,53974L,53975L,53975L,53976L,53976L,
-     53977L,53977L,53978L,53979L,53979L,53980L,53980L,53981L,
-     53981L,53982L,53983L,53983L,53984L,53984L,53985L,53985L,
-     53986L,53986L,53987L,53988L,53988L,53989L,53989L,53990L,
-     53990L,53991L,53992L,53992L,53993L,53993L,53994L,53994L,
-     53995L,53996L,53996L,53997L,53997L,53998L,53998L,53999L,
-     54000L,54000L,54001L,54001L,54002L,54002L,54003L,54003L,
-     54004L,54005L,54005L,54006L,54006L,54007L,54007L,54008L,
-     54009L,54009L,54010L,54010L,54011L,54011L,54012L,54013L,
-     54013L,54014L,54014L,54015L,54015L,54016L,54017L,54017L,
-     54018L,54018L,54019L,54019L,54020L,54020L,54021L,54022L,
-     54022L,54023L,54023L,54024L,54024L,54025L,54026L,54026L,
-     54027L,54027L,54028L,54028L,54029L,54030L,54030L,54031L,
-     54031L,54032L,54032L,54033L,54033L,54034L,54035L,54035L,
-     54036L,54036L,54037L,54037L,54038L,54039L,54039L,54040L,
-     54040L,54041L,54041L,54042L,54043L,54043L,54044L,54044L,
-     54045L,54045L,54046L,54046L,54047L,54048L,54048L,54049L,
-     54049L,54050L,54050L,54051L,54052L,54052L,54053L,54053L,
-     54054L,54054L,54055L,54056L,54056L,54057L,54057L,54058L,
-     54058L,54059L,54060L,54060L,54061L,54061L,54062L,54062L,
-     54063L,54063L,54064L,54065L,54065L,54066L,54066L,54067L,
-     54067L,54068L,54069L,54069L,54070L,54070L,54071L,54071L,
-     54072L,54073L,54073L,54074L,54074L,54075L,54075L,54076L,
-     54076L,54077L,54078L,54078L,54079L,54079L,54080L,54080L,
-     54081L,54082L,54082L,54083L,54083L,54084L,54084L,54085L,
-     54085L,54086L,54087L,54087L,54088L,54088L,54089L,54089L,
-     54090L,54091L,54091L,54092L,54092L,54093L,54093L,54094L,
-     54095L,54095L,54096L,54096L,54097L,54097L,54098L,54098L,
-     54099L,54100L,54100L,54101L,54101L,54102L,54102L,54103L,
-     54104L,54104L,54105L,54105L,54106L,54106L,54107L,54108L,
-     54108L,54109L,54109L,54110L,54110L,54111L,54111L,54112L,
-     54113L,54113L,54114L,54114L,54115L,54115L,54116L,54117L,
-     54117L,54118L,54118L,54119L,54119L,54120L,54120L,54121L,
-     54122L,54122L,54123L,54123L,54124L,54124L,54125L,54126L,
-     54126L,54127L,54127L,54128L,54128L,54129L,54130L,54130L,
-     54131L,54131L,54132L,54132L,54133L,54133L,54134L,54135L,
-     54135L,54136L,54136L,54137L,54137L,54138L,54139L,54139L,
-     54140L,54140L,54141L,54141L,54142L,54142L,54143L,54144L,
-     54144L,54145L,54145L,54146L,54146L,54147L,54148L,54148L,
-     54149L,54149L,54150L,54150L,54151L,54151L,54152L,54153L,
-     54153L,54154L,54154L,54155L,54155L,54156L,54157L,54157L,
-     54158L,54158L,54159L,54159L,54160L,54160L,54161L,54162L,
-     54162L,54163L,54163L,54164L,54164L,54165L,54166L,54166L,
-     54167L,54167L,54168L,54168L,54169L,54169L,54170L,54171L,
-     54171L,54172L,54172L,54173L,54173L,54174L,54175L,54175L,
-     54176L,54176L,54177L,54177L,54178L,54178L,54179L,54180L,
-     54180L,54181L,54181L,54182L,54182L,54183L,54184L,54184L,
-     54185L,54185L,54186L,54186L,54187L,54188L,54188L,54189L,
-     54189L,54190L,54190L,54191L,54191L,54192L,54193L,54193L,
-     54194L,54194L,54195L,54195L,54196L,54196L,54197L,54198L,
-     54198L,54199L,54199L,54200L,54200L,54201L,54202L,54202L,
-     54203L,54203L,54204L,54204L,54205L,54205L,54206L,54207L,
-     54207L,54208L,54208L,54209L,54209L,54210L,54211L,54211L,
-     54212L,54212L,54213L,54213L,54214L,54214L,54215L,54216L,
-     54216L,54217L,54217L,54218L,54218L,54219L,54220L,54220L,
-     54221L,54221L,54222L,54222L,54223L,54223L,54224L,54225L,
-     54225L,54226L,54226L,54227L,54227L,54228L,54229L,54229L,
-     54230L,54230L,54231L,54231L,54232L,54232L,54233L,54234L,
-     54234L,54235L,54235L,54236L,54236L,54237L,54238L,54238L,
-     54239L,54239L,54240L,54240L,54241L,54241L,54242L,54243L,
-     54243L,54244L,54244L,54245L,54245L,54246L,54246L,54247L,
-     54248L,54248L,54249L,54249L,54250L,54250L,54251L,54252L,
-     54252L,54253L,54253L,54254L,54254L,54255L,54255L,54256L,
-     54257L,54257L,54258L,54258L,54259L,54259L,54260L,54261L,
-     54261L,54262L,54262L,54263L,54263L,54264L,54264L,54265L,
-     54266L,54266L,54267L,54267L,54268L,54268L,54269L,54269L,
-     54270L,54271L,54271L,54272L,54272L,54273L,54273L,54274L,
-     54275L,54275L,54276L,54276L,54277L,54277L,54278L,54278L,
-     54279L,54280L,54280L,54281L,54281L,54282L,54282L,54283L,
-     54283L,54284L,54285L,54285L,54286L,54286L,54287L,54287L,
-     54288L,54289L,54289L,54290L,54290L,54291L,54291L,54292L,
-     54292L,54293L,54294L,54294L,54295L,54295L,54296L,54296L,
-     54297L,54297L,54298L,54299L,54299L,54300L,54300L,54301L,
-     54301L,54302L,54303L,54303L,54304L,54304L,54305L,54305L,
-     54306L,54306L,54307L,54308L,54308L,54309L,54309L,54310L,
-     54310L,54311L,54311L,54312L,54313L,54313L,54314L,54314L,
-     54315L,54315L,54316L,54317L,54317L,54318L,54318L,54319L,
-     54319L,54320L,54320L,54321L,54322L,54322L,54323L,54323L,
-     54324L,54324L,54325L,54325L,54326L,54327L,54327L,54328L,
-     54328L,54329L,54329L,54330L,54331L,54331L,54332L,54332L,
-     54333L,54333L,54334L,54334L,54335L,54336L,54336L,54337L,
-     54337L,54338L,54338L,54339L,54339L,54340L,54341L,54341L,
-     54342L,54342L,54343L,54343L,54344L,54344L,54345L,54346L,
-     54346L,54347L,54347L,54348L,54348L,54349L,54350L,54350L,
-     54351L,54351L,54352L,54352L,54353L,54353L,54354L,54355L,
-     54355L,54356L,54356L,54357L,54357L,54358L,54358L,54359L,
-     54360L,54360L,54361L,54361L,54362L,54362L,54363L,54363L,
-     54364L,54365L,54365L,54366L,54366L,54367L,54367L,54368L,
-     54369L,54369L,54370L,54370L,54371L,54371L,54372L,54372L,
-     54373L,54374L,54374L,54375L,54375L,54376L,54376L,54377L,
-     54377L,54378L,54379L,54379L,54380L,54380L,54381L,54381L,
-     54382L,54382L,54383L,54384L,54384L,54385L,54385L,54386L,
-     54386L,54387L,54387L,54388L,54389L,54389L,54390L,54390L,
-     54391L,54391L,54392L,54393L,54393L,54394L,54394L,54395L,
-     54395L,54396L,54396L,54397L,54398L,54398L,54399L,54399L,
-     54400L,54400L,54401L,54401L,54402L,54403L,54403L,54404L,
-     54404L,54405L,54405L,54406L,54406L,54407L,54408L,54408L,
-     54409L,54409L,54410L,54410L,54411L,54411L,54412L,54413L,
-     54413L,54414L,54414L,54415L,54415L,54416L,54416L,54417L,
-     54418L,54418L,54419L,54419L,54420L,54420L,54421L,54421L,
-     54422L,54423L,54423L,54424L,54424L,54425L,54425L,54426L,
-     54427L,54427L,54428L,54428L,54429L,54429L,54430L,54430L,
-     54431L,54432L,54432L,54433L,54433L,54434L,54434L,54435L,
-     54435L,54436L,54437L,54437L,54438L,54438L,54439L,54439L,
-     54440L,54440L,54441L,54442L,54442L,54443L,54443L,54444L,
-     54444L,54445L,54445L,54446L,54447L,54447L,54448L,54448L,
-     54449L,54449L,54450L,54450L,54451L,54452L,54452L,54453L,
-     54453L,54454L,54454L,54455L,54455L,54456L,54457L,54457L,
-     54458L,54458L,54459L,54459L,54460L,54460L,54461L,54462L,
-     54462L,54463L,54463L,54464L,54464L,54465L,54465L,54466L,
-     54467L,54467L,54468L,54468L,54469L,54469L,54470L,54470L,
-     54471L,54472L,54472L,54473L,54473L,54474L,54474L,54475L,
-     54475L,54476L,54477L,54477L,54478L,54478L,54479L,54479L,
-     54480L,54480L,54481L,54482L,54482L,54483L,54483L,54484L,
-     54484L,54485L,54485L,54486L,54487L,54487L,54488L,54488L,
-     54489L,54489L,54490L,54490L,54491L,54492L,54492L,54493L,
-     54493L,54494L,54494L,54495L,54495L,54496L,54497L,54497L,
-     54498L,54498L,54499L,54499L,54500L,54500L,54501L,54502L,
-     54502L,54503L,54503L,54504L,54504L,54505L,54505L,54506L,
-     54507L,54507L,54508L,54508L,54509L,54509L,54510L,54510L,
-     54511L,54512L,54512L,54513L,54513L,54514L,54514L,54515L,
-     54515L,54516L,54517L,54517L,54518L,54518L,54519L,54519L,
-     54520L,54520L,54521L,54522L,54522L,54523L,54523L,54524L,
-     54524L,54525L,54525L,54526L,54527L,54527L,54528L,54528L,
-     54529L,54529L,54530L,54530L,54531L,54532L,54532L,54533L,
-     54533L,54534L,54534L,54535L,54535L,54536L,54537L,54537L,
-     54538L,54538L,54539L,54539L,54540L,54540L,54541L,54542L,
-     54542L,54543L,54543L,54544L,54544L,54545L,54545L,54546L,
-     54547L,54547L,54548L,54548L,54549L,54549L,54550L,54550L,
-     54551L,54552L,54552L,54553L,54553L,54554L,54554L,54555L,
-     54555L,54556L,54557L,54557L,54558L,54558L,54559L,54559L,
-     54560L,54560L,54561L,54561L,54562L,54563L,54563L,54564L,
-     54564L,54565L,54565L,54566L,54566L,54567L,54568L,54568L,
-     54569L,54569L,54570L,54570L,54571L,54571L,54572L,54573L,
-     54573L,54574L,54574L,54575L,54575L,54576L,54576L,54577L,
-     54578L,54578L,54579L,54579L,54580L,54580L,54581L,54581L,
-     54582L,54583L,54583L,54584L,54584L,54585L,54585L,54586L,
-     54586L,54587L,54588L,54588L,54589L,54589L,54590L,54590L,
-     54591L,54591L,54592L,54592L,54593L,54594L,54594L,54595L,
-     54595L,54596L,54596L,54597L,54597L,54598L,54599L,54599L,
-     54600L,54600L,54601L,54601L,54602L,54602L,54603L,54604L,
-     54604L,54605L,54605L,54606L,54606L,54607L,54607L,54608L,
-     54609L,54609L,54610L,54610L,54611L,54611L,54612L,54612L,
-     54613L,54614L,54614L,54615L,54615L,54616L,54616L,54617L,
-     54617L,54618L,54618L,54619L,54620L,54620L,54621L,54621L,
-     54622L,54622L,54623L,54623L,54624L,54625L,54625L,54626L,
-     54626L,54627L,54627L,54628L,54628L,54629L,54630L,54630L,
-     54631L,54631L,54632L,54632L,54633L,54633L,54634L,54635L,
-     54635L,54636L,54636L,54637L,54637L,54638L,54638L,54639L,
-     54639L,54640L,54641L,54641L,54642L,54642L,54643L,54643L,
-     54644L,54644L,54645L,54646L,54646L,54647L,54647L,54648L,
-     54648L,54649L,54649L,54650L,54651L,54651L,54652L,54652L,
-     54653L,54653L,54654L,54654L,54655L,54655L,54656L,54657L,
-     54657L,54658L,54658L,54659L,54659L,54660L,54660L,54661L,
-     54662L,54662L,54663L,54663L,54664L,54664L,54665L,54665L,
-     54666L,54667L,54667L,54668L,54668L,54669L,54669L,54670L,
-     54670L,54671L,54671L,54672L,54673L,54673L,54674L,54674L,
-     54675L,54675L,54676L,54676L,54677L,54678L,54678L,54679L,
-     54679L,54680L,54680L,54681L,54681L,54682L,54683L,54683L,
-     54684L,54684L,54685L,54685L,54686L,54686L,54687L,54687L,
-     54688L,54689L,54689L,54690L,54690L,54691L,54691L,54692L,
-     54692L,54693L,54694L,54694L,54695L,54695L,54696L,54696L,
-     54697L,54697L,54698L,54698L,54699L,54700L,54700L,54701L,
-     54701L,54702L,54702L,54703L,54703L,54704L,54705L,54705L,
-     54706L,54706L,54707L,54707L,54708L,54708L,54709L,54709L,
-     54710L,54711L,54711L,54712L,54712L,54713L,54713L,54714L,
-     54714L,54715L,54716L,54716L,54717L,54717L,54718L,54718L,
-     54719L,54719L,54720L,54721L,54721L,54722L,54722L,54723L,
-     54723L,54724L,54724L,54725L,54725L,54726L,54727L,54727L,
-     54728L,54728L,54729L,54729L,54730L,54730L,54731L,54732L,
-     54732L,54733L,54733L,54734L,54734L,54735L,54735L,54736L,
-     54736L,54737L,54738L,54738L,54739L,54739L,54740L,54740L,
-     54741L,54741L,54742L,54743L,54743L,54744L,54744L,54745L,
-     54745L,54746L,54746L,54747L,54747L,54748L,54749L,54749L,
-     54750L,54750L,54751L,54751L,54752L,54752L,54753L,54754L,
-     54754L,54755L,54755L,54756L,54756L,54757L,54757L,54758L,
-     54758L,54759L,54760L,54760L,54761L,54761L,54762L,54762L,
-     54763L,54763L,54764L,54764L,54765L,54766L,54766L,54767L,
-     54767L,54768L,54768L,54769L,54769L,54770L,54771L,54771L,
-     54772L,54772L,54773L,54773L,54774L,54774L,54775L,54775L,
-     54776L,54777L,54777L,54778L,54778L,54779L,54779L,54780L,
-     54780L,54781L,54782L,54782L,54783L,54783L,54784L,54784L,
-     54785L,54785L,54786L,54786L,54787L,54788L,54788L,54789L,
-     54789L,54790L,54790L,54791L,54791L,54792L,54792L,54793L,
-     54794L,54794L,54795L,54795L,54796L,54796L,54797L,54797L,
-     54798L,54799L,54799L,54800L,54800L,54801L,54801L,54802L,
-     54802L,54803L,54803L,54804L,54805L,54805L,54806L,54806L,
-     54807L,54807L,54808L,54808L,54809L,54809L,54810L,54811L,
-     54811L,54812L,54812L,54813L,54813L,54814L,54814L,54815L,
-     54816L,54816L,54817L,54817L,54818L,54818L,54819L,54819L,
-     54820L,54820L,54821L,54822L,54822L,54823L,54823L,54824L,
-     54824L,54825L,54825L,54826L,54826L,54827L,54828L,54828L,
-     54829L,54829L,54830L,54830L,54831L,54831L,54832L,54832L,
-     54833L,54834L,54834L,54835L,54835L,54836L,54836L,54837L,
-     54837L,54838L,54839L,54839L,54840L,54840L,54841L,54841L,
-     54842L,54842L,54843L,54843L,54844L,54845L,54845L,54846L,
-     54846L,54847L,54847L,54848L,54848L,54849L,54849L,54850L,
-     54851L,54851L,54852L,54852L,54853L,54853L,54854L,54854L,
-     54855L,54855L,54856L,54857L,54857L,54858L,54858L,54859L,
-     54859L,54860L,54860L,54861L,54862L,54862L,54863L,54863L,
-     54864L,54864L,54865L,54865L,54866L,54866L,54867L,54868L,
-     54868L,54869L,54869L,54870L,54870L,54871L,54871L,54872L,
-     54872L,54873L,54874L,54874L,54875L,54875L,54876L,54876L,
-     54877L,54877L,54878L,54878L,54879L,54880L,54880L,54881L,
-     54881L,54882L,54882L,54883L,54883L,54884L,54884L,54885L,
-     54886L,54886L,54887L,54887L,54888L,54888L,54889L,54889L,
-     54890L,54890L,54891L,54892L,54892L,54893L,54893L,54894L,
-     54894L,54895L,54895L,54896L,54896L,54897L,54898L,54898L,
-     54899L,54899L,54900L,54900L,54901L,54901L,54902L,54902L,
-     54903L,54904L,54904L,54905L,54905L,54906L,54906L,54907L,
-     54907L,54908L,54909L,54909L,54910L,54910L,54911L,54911L,
-     54912L,54912L,54913L,54913L,54914L,54915L,54915L,54916L,
-     54916L,54917L,54917L,54918L,54918L,54919L,54919L,54920L,
-     54921L,54921L,54922L,54922L,54923L,54923L,54924L,54924L,
-     54925L,54925L,54926L,54927L,54927L,54928L,54928L,54929L,
-     54929L,54930L,54930L,54931L,54931L,54932L,54933L,54933L,
-     54934L,54934L,54935L,54935L,54936L,54936L,54937L,54937L,
-     54938L,54939L,54939L,54940L,54940L,54941L,54941L,54942L,
-     54942L,54943L,54943L,54944L,54945L,54945L,54946L,54946L,
-     54947L,54947L,54948L,54948L,54949L,54949L,54950L,54951L,
-     54951L,54952L,54952L,54953L,54953L,54954L,54954L,54955L,
-     54955L,54956L,54956L,54957L,54958L,54958L,54959L,54959L,
-     54960L,54960L,54961L,54961L,54962L,54962L,54963L,54964L,
-     54964L,54965L,54965L,54966L,54966L,54967L,54967L,54968L,
-     54968L,54969L,54970L,54970L,54971L,54971L,54972L,54972L,
-     54973L,54973L,54974L,54974L,54975L,54976L,54976L,54977L,
-     54977L,54978L,54978L,54979L,54979L,54980L,54980L,54981L,
-     54982L,54982L,54983L,54983L,54984L,54984L,54985L,54985L,
-     54986L,54986L,54987L,54988L,54988L,54989L,54989L,54990L,
-     54990L,54991L,54991L,54992L,54992L,54993L,54994L,54994L,
-     54995L,54995L,54996L,54996L,54997L,54997L,54998L,54998L,
-     54999L,54999L,55000L,55001L,55001L,55002L,55002L,55003L,
-     55003L,55004L,55004L,55005L,55005L,55006L,55007L,55007L,
-     55008L,55008L,55009L,55009L,55010L,55010L,55011L,55011L,
-     55012L,55013L,55013L,55014L,55014L,55015L,55015L,55016L,
-     55016L,55017L,55017L,55018L,55019L,55019L,55020L,55020L,
-     55021L,55021L,55022L,55022L,55023L,55023L,55024L,55024L,
-     55025L,55026L,55026L,55027L,55027L,55028L,55028L,55029L,
-     55029L,55030L,55030L,55031L,55032L,55032L,55033L,55033L,
-     55034L,55034L,55035L,55035L,55036L,55036L,55037L,55038L,
-     55038L,55039L,55039L,55040L,55040L,55041L,55041L,55042L,
-     55042L,55043L,55043L,55044L,55045L,55045L,55046L,55046L,
-     55047L,55047L,55048L,55048L,55049L,55049L,55050L,55051L,
-     55051L,55052L,55052L,55053L,55053L,55054L,55054L,55055L,
-     55055L,55056L,55057L,55057L,55058L,55058L,55059L,55059L,
-     55060L,55060L,55061L,55061L,55062L,55062L,55063L,55064L,
-     55064L,55065L,55065L,55066L,55066L,55067L,55067L,55068L,
-     55068L,55069L,55070L,55070L,55071L,55071L,55072L,55072L,
-     55073L,55073L,55074L,55074L,55075L,55075L,55076L,55077L,
-     55077L,55078L,55078L,55079L,55079L,55080L,55080L,55081L,
-     55081L,55082L,55083L,55083L,55084L,55084L,55085L,55085L,
-     55086L,55086L,55087L,55087L,55088L,55089L,55089L,55090L,
-     55090L,55091L,55091L,55092L,55092L,55093L,55093L,55094L,
-     55094L,55095L,55096L,55096L,55097L,55097L,55098L,55098L,
-     55099L,55099L,55100L,55100L,55101L,55101L,55102L,55103L,
-     55103L,55104L,55104L,55105L,55105L,55106L,55106L,55107L,
-     55107L,55108L,55109L,55109L,55110L,55110L,55111L,55111L,
-     55112L,55112L,55113L,55113L,55114L,55114L,55115L,55116L,
-     55116L,55117L,55117L,55118L,55118L,55119L,55119L,55120L,
-     55120L,55121L,55122L,55122L,55123L,55123L,55124L,55124L,
-     55125L,55125L,55126L,55126L,55127L,55127L,55128L,55129L,
-     55129L,55130L,55130L,55131L,55131L,55132L,55132L,55133L,
-     55133L,55134L,55134L,55135L,55136L,55136L,55137L,55137L,
-     55138L,55138L,55139L,55139L,55140L,55140L,55141L,55142L,
-     55142L,55143L,55143L,55144L,55144L,55145L,55145L,55146L,
-     55146L,55147L,55147L,55148L,55149L,55149L,55150L,55150L,
-     55151L,55151L,55152L,55152L,55153L,55153L,55154L,55154L,
-     55155L,55156L,55156L,55157L,55157L,55158L,55158L,55159L,
-     55159L,55160L,55160L,55161L,55162L,55162L,55163L,55163L,
-     55164L,55164L,55165L,55165L,55166L,55166L,55167L,55167L,
-     55168L,55169L,55169L,55170L,55170L,55171L,55171L,55172L,
-     55172L,55173L,55173L,55174L,55174L,55175L,55176L,55176L,
-     55177L,55177L,55178L,55178L,55179L,55179L,55180L,55180L,
-     55181L,55181L,55182L,55183L,55183L,55184L,55184L,55185L,
-     55185L,55186L,55186L,55187L,55187L,55188L,55188L,55189L,
-     55190L,55190L,55191L,55191L,55192L,55192L,55193L,55193L,
-     55194L,55194L,55195L,55196L,55196L,55197L,55197L,55198L,
-     55198L,55199L,55199L,55200L,55200L,55201L,55201L,55202L,
-     55203L,55203L,55204L,55204L,55205L,55205L,55206L,55206L,
-     55207L,55207L,55208L,55208L,55209L,55210L,55210L,55211L,
-     55211L,55212L,55212L,55213L,55213L,55214L,55214L,55215L,
-     55215L,55216L,55217L,55217L,55218L,55218L,55219L,55219L,
-     55220L,55220L,55221L,55221L,55222L,55222L,55223L,55224L,
-     55224L,55225L,55225L,55226L,55226L,55227L,55227L,55228L,
-     55228L,55229L,55229L,55230L,55231L,55231L,55232L,55232L,
-     55233L,55233L,55234L,55234L,55235L,55235L,55236L,55236L,
-     55237L,55238L,55238L,55239L,55239L,55240L,55240L,55241L,
-     55241L,55242L,55242L,55243L,55243L,55244L,55245L,55245L,
-     55246L,55246L,55247L,55247L,55248L,55248L,55249L,55249L,
-     55250L,55250L,55251L,55252L,55252L,55253L,55253L,55254L,
-     55254L,55255L,55255L,55256L,55256L,55257L,55257L,55258L,
-     55258L,55259L,55260L,55260L,55261L,55261L,55262L,55262L,
-     55263L,55263L,55264L,55264L,55265L,55265L,55266L,55267L,
-     55267L,55268L,55268L,55269L,55269L,55270L,55270L,55271L,
-     55271L,55272L,55272L,55273L,55274L,55274L,55275L,55275L,
-     55276L,55276L,55277L,55277L,55278L,55278L,55279L,55279L,
-     55280L,55281L,55281L,55282L,55282L,55283L,55283L,55284L,
-     55284L,55285L,55285L,55286L,55286L,55287L,55288L,55288L,
-     55289L,55289L,55290L,55290L,55291L,55291L,55292L,55292L,
-     55293L,55293L,55294L,55294L,55295L,55296L,55296L,55297L,
-     55297L,55298L,55298L,55299L,55299L,55300L,55300L,55301L,
-     55301L,55302L,55303L,55303L,55304L,55304L,55305L,55305L,
-     55306L,55306L,55307L,55307L,55308L,55308L,55309L,55310L,
-     55310L,55311L,55311L,55312L,55312L,55313L,55313L,55314L,
-     55314L,55315L,55315L,55316L,55316L,55317L,55318L,55318L,
-     55319L,55319L,55320L,55320L,55321L,55321L,55322L,55322L,
-     55323L,55323L,55324L,55325L,55325L,55326L,55326L,55327L,
-     55327L,55328L,55328L,55329L,55329L,55330L,55330L,55331L,
-     55331L,55332L,55333L,55333L,55334L,55334L,55335L,55335L,
-     55336L,55336L,55337L,55337L,55338L,55338L,55339L,55340L,
-     55340L,55341L,55341L,55342L,55342L,55343L,55343L,55344L,
-     55344L,55345L,55345L,55346L,55346L,55347L,55348L,55348L,
-     55349L,55349L,55350L,55350L,55351L,55351L,55352L,55352L,
-     55353L,55353L,55354L,55355L,55355L,55356L,55356L,55357L,
-     55357L,55358L,55358L,55359L,55359L,55360L,55360L,55361L,
-     55361L,55362L,55363L,55363L,55364L,55364L,55365L,55365L,
-     55366L,55366L,55367L,55367L,55368L,55368L,55369L,55370L,
-     55370L,55371L,55371L,55372L,55372L,55373L,55373L,55374L,
-     55374L,55375L,55375L,55376L,55376L,55377L,55378L,55378L,
-     55379L,55379L,55380L,55380L,55381L,55381L,55382L,55382L,
-     55383L,55383L,55384L,55384L,55385L,55386L,55386L,55387L,
-     55387L,55388L,55388L,55389L,55389L,55390L,55390L,55391L,
-     55391L,55392L,55392L,55393L,55394L,55394L,55395L,55395L,
-     55396L,55396L,55397L,55397L,55398L,55398L,55399L,55399L,
-     55400L,55401L,55401L,55402L,55402L,55403L,55403L,55404L,
-     55404L,55405L,55405L,55406L,55406L,55407L,55407L,55408L,
-     55409L,55409L,55410L,55410L,55411L,55411L,55412L,55412L,
-     55413L,55413L,55414L,55414L,55415L,55415L,55416L,55417L,
-     55417L,55418L,55418L,55419L,55419L,55420L,55420L,55421L,
-     55421L,55422L,55422L,55423L,55423L,55424L,55425L,55425L,
-     55426L,55426L,55427L,55427L,55428L,55428L,55429L,55429L,
-     55430L,55430L,55431L,55431L,55432L,55433L,55433L,55434L,
-     55434L,55435L,55435L,55436L,55436L,55437L,55437L,55438L,
-     55438L,55439L,55439L,55440L,55441L,55441L,55442L,55442L,
-     55443L,55443L,55444L,55444L,55445L,55445L,55446L,55446L,
-     55447L,55447L,55448L,55449L,55449L,55450L,55450L,55451L,
-     55451L,55452L,55452L,55453L,55453L,55454L,55454L,55455L,
-     55455L,55456L,55457L,55457L,55458L,55458L,55459L,55459L,
-     55460L,55460L,55461L,55461L,55462L,55462L,55463L,55463L,
-     55464L,55465L,55465L,55466L,55466L,55467L,55467L,55468L,
-     55468L,55469L,55469L,55470L,55470L,55471L,55471L,55472L,
-     55473L,55473L,55474L,55474L,55475L,55475L,55476L,55476L,
-     55477L,55477L,55478L,55478L,55479L,55479L,55480L,55480L,
-     55481L,55482L,55482L,55483L,55483L,55484L,55484L,55485L,
-     55485L,55486L,55486L,55487L,55487L,55488L,55488L,55489L,
-     55490L,55490L,55491L,55491L,55492L,55492L,55493L,55493L,
-     55494L,55494L,55495L,55495L,55496L,55496L,55497L,55498L,
-     55498L,55499L,55499L,55500L,55500L,55501L,55501L,55502L,
-     55502L,55503L,55503L,55504L,55504L,55505L,55505L,55506L,
-     55507L,55507L,55508L,55508L,55509L,55509L,55510L,55510L,
-     55511L,55511L,55512L,55512L,55513L,55513L,55514L,55515L,
-     55515L,55516L,55516L,55517L,55517L,55518L,55518L,55519L,
-     55519L,55520L,55520L,55521L,55521L,55522L,55523L,55523L,
-     55524L,55524L,55525L,55525L,55526L,55526L,55527L,55527L,
-     55528L,55528L,55529L,55529L,55530L,55530L,55531L,55532L,
-     55532L,55533L,55533L,55534L,55534L,55535L,55535L,55536L,
-     55536L,55537L,55537L,55538L,55538L,55539L,55539L,55540L,
-     55541L,55541L,55542L,55542L,55543L,55543L,55544L,55544L,
-     55545L,55545L,55546L,55546L,55547L,55547L,55548L,55549L,
-     55549L,55550L,55550L,55551L,55551L,55552L,55552L,55553L,
-     55553L,55554L,55554L,55555L,55555L,55556L,55556L,55557L,
-     55558L,55558L,55559L,55559L,55560L,55560L,55561L,55561L,
-     55562L,55562L,55563L,55563L,55564L,55564L,55565L,55565L,
-     55566L,55567L,55567L,55568L,55568L,55569L,55569L,55570L,
-     55570L,55571L,55571L,55572L,55572L,55573L,55573L,55574L,
-     55575L,55575L,55576L,55576L,55577L,55577L,55578L,55578L,
-     55579L,55579L,55580L,55580L,55581L,55581L,55582L,55582L,
-     55583L,55584L,55584L,55585L,55585L,55586L,55586L,55587L,
-     55587L,55588L,55588L,55589L,55589L,55590L,55590L,55591L,
-     55591L,55592L,55593L,55593L,55594L,55594L,55595L,55595L,
-     55596L,55596L,55597L,55597L,55598L,55598L,55599L,55599L,
-     55600L,55600L,55601L,55602L,55602L,55603L,55603L,55604L,
-     55604L,55605L,55605L,55606L,55606L,55607L,55607L,55608L,
-     55608L,55609L,55609L,55610L,55611L,55611L,55612L,55612L,
-     55613L,55613L,55614L,55614L,55615L,55615L,55616L,55616L,
-     55617L,55617L,55618L,55618L,55619L,55620L,55620L,55621L,
-     55621L,55622L,55622L,55623L,55623L,55624L,55624L,55625L,
-     55625L,55626L,55626L,55627L,55627L,55628L,55628L,55629L,
-     55630L,55630L,55631L,55631L,55632L,55632L,55633L,55633L,
-     55634L,55634L,55635L,55635L,55636L,55636L,55637L,55637L,
-     55638L,55639L,55639L,55640L,55640L,55641L,55641L,55642L,
-     55642L,55643L,55643L,55644L,55644L,55645L,55645L,55646L,
-     55646L,55647L,55648L,55648L,55649L,55649L,55650L,55650L,
-     55651L,55651L,55652L,55652L,55653L,55653L,55654L,55654L,
-     55655L,55655L,55656L,55656L,55657L,55658L,55658L,55659L,
-     55659L,55660L,55660L,55661L,55661L,55662L,55662L,55663L,
-     55663L,55664L,55664L,55665L,55665L,55666L,55667L,55667L,
-     55668L,55668L,55669L,55669L,55670L,55670L,55671L,55671L,
-     55672L,55672L,55673L,55673L,55674L,55674L,55675L,55675L,
-     55676L,55677L,55677L,55678L,55678L,55679L,55679L,55680L,
-     55680L,55681L,55681L,55682L,55682L,55683L,55683L,55684L,
-     55684L,55685L,55686L,55686L,55687L,55687L,55688L,55688L,
-     55689L,55689L,55690L,55690L,55691L,55691L,55692L,55692L,
-     55693L,55693L,55694L,55694L,55695L,55696L,55696L,55697L,
-     55697L,55698L,55698L,55699L,55699L,55700L,55700L,55701L,
-     55701L,55702L,55702L,55703L,55703L,55704L,55704L,55705L,
-     55706L,55706L,55707L,55707L,55708L,55708L,55709L,55709L,
-     55710L,55710L,55711L,55711L,55712L,55712L,55713L,55713L,
-     55714L,55714L,55715L,55716L,55716L,55717L,55717L,55718L,
-     55718L,55719L,55719L,55720L,55720L,55721L,55721L,55722L,
-     55722L,55723L,55723L,55724L,55725L,55725L,55726L,55726L,
-     55727L,55727L,55728L,55728L,55729L,55729L,55730L,55730L,
-     55731L,55731L,55732L,55732L,55733L,55733L,55734L,55734L,
-     55735L,55736L,55736L,55737L,55737L,55738L,55738L,55739L,
-     55739L,55740L,55740L,55741L,55741L,55742L,55742L,55743L,
-     55743L,55744L,55744L,55745L,55746L,55746L,55747L,55747L,
-     55748L,55748L,55749L,55749L,55750L,55750L,55751L,55751L,
-     55752L,55752L,55753L,55753L,55754L,55754L,55755L,55756L,
-     55756L,55757L,55757L,55758L,55758L,55759L,55759L,55760L,
-     55760L,55761L,55761L,55762L,55762L,55763L,55763L,55764L,
-     55764L,55765L,55766L,55766L,55767L,55767L,55768L,55768L,
-     55769L,55769L,55770L,55770L,55771L,55771L,55772L,55772L,
-     55773L,55773L,55774L,55774L,55775L,55775L,55776L,55777L,
-     55777L,55778L,55778L,55779L,55779L,55780L,55780L,55781L,
-     55781L,55782L,55782L,55783L,55783L,55784L,55784L,55785L,
-     55785L,55786L,55787L,55787L,55788L,55788L,55789L,55789L,
-     55790L,55790L,55791L,55791L,55792L,55792L,55793L,55793L,
-     55794L,55794L,55795L,55795L,55796L,55796L,55797L,55798L,
-     55798L,55799L,55799L,55800L,55800L,55801L,55801L,55802L,
-     55802L,55803L,55803L,55804L,55804L,55805L,55805L,55806L,
-     55806L,55807L,55807L,55808L,55809L,55809L,55810L,55810L,
-     55811L,55811L,55812L,55812L,55813L,55813L,55814L,55814L,
-     55815L,55815L,55816L,55816L,55817L,55817L,55818L,55819L,
-     55819L,55820L,55820L,55821L,55821L,55822L,55822L,55823L,
-     55823L,55824L,55824L,55825L,55825L,55826L,55826L,55827L,
-     55827L,55828L,55828L,55829L,55830L,55830L,55831L,55831L,
-     55832L,55832L,55833L,55833L,55834L,55834L,55835L,55835L,
-     55836L,55836L,55837L,55837L,55838L,55838L,55839L,55839L,
-     55840L,55840L,55841L,55842L,55842L,55843L,55843L,55844L,
-     55844L,55845L,55845L,55846L,55846L,55847L,55847L,55848L,
-     55848L,55849L,55849L,55850L,55850L,55851L,55851L,55852L,
-     55853L,55853L,55854L,55854L,55855L,55855L,55856L,55856L,
-     55857L,55857L,55858L,55858L,55859L,55859L,55860L,55860L,
-     55861L,55861L,55862L,55862L,55863L,55864L,55864L,55865L,
-     55865L,55866L,55866L,55867L,55867L,55868L,55868L,55869L,
-     55869L,55870L,55870L,55871L,55871L,55872L,55872L,55873L,
-     55873L,55874L,55874L,55875L,55876L,55876L,55877L,55877L,
-     55878L,55878L,55879L,55879L,55880L,55880L,55881L,55881L,
-     55882L,55882L,55883L,55883L,55884L,55884L,55885L,55885L,
-     55886L,55887L,55887L,55888L,55888L,55889L,55889L,55890L,
-     55890L,55891L,55891L,55892L,55892L,55893L,55893L,55894L,
-     55894L,55895L,55895L,55896L,55896L,55897L,55897L,55898L,
-     55899L,55899L,55900L,55900L,55901L,55901L,55902L,55902L,
-     55903L,55903L,55904L,55904L,55905L,55905L,55906L,55906L,
-     55907L,55907L,55908L,55908L,55909L,55909L,55910L,55911L,
-     55911L,55912L,55912L,55913L,55913L,55914L,55914L,55915L,
-     55915L,55916L,55916L,55917L,55917L,55918L,55918L,55919L,
-     55919L,55920L,55920L,55921L,55921L,55922L,55923L,55923L,
-     55924L,55924L,55925L,55925L,55926L,55926L,55927L,55927L,
-     55928L,55928L,55929L,55929L,55930L,55930L,55931L,55931L,
-     55932L,55932L,55933L,55933L,55934L,55935L,55935L,55936L,
-     55936L,55937L,55937L,55938L,55938L,55939L,55939L,55940L,
-     55940L,55941L,55941L,55942L,55942L,55943L,55943L,55944L,
-     55944L,55945L,55945L,55946L,55946L,55947L,55948L,55948L,
-     55949L,55949L,55950L,55950L,55951L,55951L,55952L,55952L,
-     55953L,55953L,55954L,55954L,55955L,55955L,55956L,55956L,
-     55957L,55957L,55958L,55958L,55959L,55960L,55960L,55961L,
-     55961L,55962L,55962L,55963L,55963L,55964L,55964L,55965L,
-     55965L,55966L,55966L,55967L,55967L,55968L,55968L,55969L,
-     55969L,55970L,55970L,55971L,55971L,55972L,55973L,55973L,
-     55974L,55974L,55975L,55975L,55976L,55976L,55977L,55977L,
-     55978L,55978L,55979L,55979L,55980L,55980L,55981L,55981L,
-     55982L,55982L,55983L,55983L,55984L,55984L,55985L,55986L,
-     55986L,55987L,55987L,55988L,55988L,55989L,55989L,55990L,
-     55990L,55991L,55991L,55992L,55992L,55993L,55993L,55994L,
-     55994L,55995L,55995L,55996L,55996L,55997L,55997L,55998L,
-     55999L,55999L,56000L,56000L,56001L,56001L,56002L,56002L,
-     56003L,56003L,56004L,56004L,56005L,56005L,56006L,56006L,
-     56007L,56007L,56008L,56008L,56009L,56009L,56010L,56010L,
-     56011L,56011L,56012L,56013L,56013L,56014L,56014L,56015L,
-     56015L,56016L,56016L,56017L,56017L,56018L,56018L,56019L,
-     56019L,56020L,56020L,56021L,56021L,56022L,56022L,56023L,
-     56023L,56024L,56024L,56025L,56025L,56026L,56027L,56027L,
-     56028L,56028L,56029L,56029L,56030L,56030L,56031L,56031L,
-     56032L,56032L,56033L,56033L,56034L,56034L,56035L,56035L,
-     56036L,56036L,56037L,56037L,56038L,56038L,56039L,56040L,
-     56040L,56041L,56041L,56042L,56042L,56043L,56043L,56044L,
-     56044L,56045L,56045L,56046L,56046L,56047L,56047L,56048L,
-     56048L,56049L,56049L,56050L,56050L,56051L,56051L,56052L,
-     56052L,56053L,56053L,56054L,56055L,56055L,56056L,56056L,
-     56057L,56057L,56058L,56058L,56059L,56059L,56060L,56060L,
-     56061L,56061L,56062L,56062L,56063L,56063L,56064L,56064L,
-     56065L,56065L,56066L,56066L,56067L,56067L,56068L,56069L,
-     56069L,56070L,56070L,56071L,56071L,56072L,56072L,56073L,
-     56073L,56074L,56074L,56075L,56075L,56076L,56076L,56077L,
-     56077L,56078L,56078L,56079L,56079L,56080L,56080L,56081L,
-     56081L,56082L,56082L,56083L,56084L,56084L,56085L,56085L,
-     56086L,56086L,56087L,56087L,56088L,56088L,56089L,56089L,
-     56090L,56090L,56091L,56091L,56092L,56092L,56093L,56093L,
-     56094L,56094L,56095L,56095L,56096L,56096L,56097L,56097L,
-     56098L,56099L,56099L,56100L,56100L,56101L,56101L,56102L,
-     56102L,56103L,56103L,56104L,56104L,56105L,56105L,56106L,
-     56106L,56107L,56107L,56108L,56108L,56109L,56109L,56110L,
-     56110L,56111L,56111L,56112L,56112L,56113L,56114L,56114L,
-     56115L,56115L,56116L,56116L,56117L,56117L,56118L,56118L,
-     56119L,56119L,56120L,56120L,56121L,56121L,56122L,56122L,
-     56123L,56123L,56124L,56124L,56125L,56125L,56126L,56126L,
-     56127L,56127L,56128L,56128L,56129L,56130L,56130L,56131L,
-     56131L,56132L,56132L,56133L,56133L,56134L,56134L,56135L,
-     56135L,56136L,56136L,56137L,56137L,56138L,56138L,56139L,
-     56139L,56140L,56140L,56141L,56141L,56142L,56142L,56143L,
-     56143L,56144L,56144L,56145L,56146L,56146L,56147L,56147L,
-     56148L,56148L,56149L,56149L,56150L,56150L,56151L,56151L,
-     56152L,56152L,56153L,56153L,56154L,56154L,56155L,56155L,
-     56156L,56156L,56157L,56157L,56158L,56158L,56159L,56159L,
-     56160L,56160L,56161L,56161L,56162L,56163L,56163L,56164L,
-     56164L,56165L,56165L,56166L,56166L,56167L,56167L,56168L,
-     56168L,56169L,56169L,56170L,56170L,56171L,56171L,56172L,
-     56172L,56173L,56173L,56174L,56174L,56175L,56175L,56176L,
-     56176L,56177L,56177L,56178L,56178L,56179L,56180L,56180L,
-     56181L,56181L,56182L,56182L,56183L,56183L,56184L,56184L,
-     56185L,56185L,56186L,56186L,56187L,56187L,56188L,56188L,
-     56189L,56189L,56190L,56190L,56191L,56191L,56192L,56192L,
-     56193L,56193L,56194L,56194L,56195L,56195L,56196L,56197L,
-     56197L,56198L,56198L,56199L,56199L,56200L,56200L,56201L,
-     56201L,56202L,56202L,56203L,56203L,56204L,56204L,56205L,
-     56205L,56206L,56206L,56207L,56207L,56208L,56208L,56209L,
-     56209L,56210L,56210L,56211L,56211L,56212L,56212L,56213L,
-     56213L,56214L,56215L,56215L,56216L,56216L,56217L,56217L,
-     56218L,56218L,56219L,56219L,56220L,56220L,56221L,56221L,
-     56222L,56222L,56223L,56223L,56224L,56224L,56225L,56225L,
-     56226L,56226L,56227L,56227L,56228L,56228L,56229L,56229L,
-     56230L,56230L,56231L,56231L,56232L,56232L,56233L,56234L,
-     56234L,56235L,56235L,56236L,56236L,56237L,56237L,56238L,
-     56238L,56239L,56239L,56240L,56240L,56241L,56241L,56242L,
-     56242L,56243L,56243L,56244L,56244L,56245L,56245L,56246L,
-     56246L,56247L,56247L,56248L,56248L,56249L,56249L,56250L,
-     56250L,56251L,56251L,56252L,56253L,56253L,56254L,56254L,
-     56255L,56255L,56256L,56256L,56257L,56257L,56258L,56258L,
-     56259L,56259L,56260L,56260L,56261L,56261L,56262L,56262L,
-     56263L,56263L,56264L,56264L,56265L,56265L,56266L,56266L,
-     56267L,56267L,56268L,56268L,56269L,56269L,56270L,56270L,
-     56271L,56271L,56272L,56273L,56273L,56274L,56274L,56275L,
-     56275L,56276L,56276L,56277L,56277L,56278L,56278L,56279L,
-     56279L,56280L,56280L,56281L,56281L,56282L,56282L,56283L,
-     56283L,56284L,56284L,56285L,56285L,56286L,56286L,56287L,
-     56287L,56288L,56288L,56289L,56289L,56290L,56290L,56291L,
-     56291L,56292L,56292L,56293L,56294L,56294L,56295L,56295L,
-     56296L,56296L,56297L,56297L,56298L,56298L,56299L,56299L,
-     56300L,56300L,56301L,56301L,56302L,56302L,56303L,56303L,
-     56304L,56304L,56305L,56305L,56306L,56306L,56307L,56307L,
-     56308L,56308L,56309L,56309L,56310L,56310L,56311L,56311L,
-     56312L,56312L,56313L,56313L,56314L,56314L,56315L,56316L,
-     56316L,56317L,56317L,56318L,56318L,56319L,56319L,56320L,
-     56320L,56321L,56321L,56322L,56322L,56323L,56323L,56324L,
-     56324L,56325L,56325L,56326L,56326L,56327L,56327L,56328L,
-     56328L,56329L,56329L,56330L,56330L,56331L,56331L,56332L,
-     56332L,56333L,56333L,56334L,56334L,56335L,56335L,56336L,
-     56336L,56337L,56338L,56338L,56339L,56339L,56340L,56340L,
-     56341L,56341L,56342L,56342L,56343L,56343L,56344L,56344L,
-     56345L,56345L,56346L,56346L,56347L,56347L,56348L,56348L,
-     56349L,56349L,56350L,56350L,56351L,56351L,56352L,56352L,
-     56353L,56353L,56354L,56354L,56355L,56355L,56356L,56356L,
-     56357L,56357L,56358L,56358L,56359L,56359L,56360L,56360L,
-     56361L,56361L,56362L,56363L,56363L,56364L,56364L,56365L,
-     56365L,56366L,56366L,56367L,56367L,56368L,56368L,56369L,
-     56369L,56370L,56370L,56371L,56371L,56372L,56372L,56373L,
-     56373L,56374L,56374L,56375L,56375L,56376L,56376L,56377L,
-     56377L,56378L,56378L,56379L,56379L,56380L,56380L,56381L,
-     56381L,56382L,56382L,56383L,56383L,56384L,56384L,56385L,
-     56385L,56386L,56386L,56387L,56388L,56388L,56389L,56389L,
-     56390L,56390L,56391L,56391L,56392L,56392L,56393L,56393L,
-     56394L,56394L,56395L,56395L,56396L,56396L,56397L,56397L,
-     56398L,56398L,56399L,56399L,56400L,56400L,56401L,56401L,
-     56402L,56402L,56403L,56403L,56404L,56404L,56405L,56405L,
-     56406L,56406L,56407L,56407L,56408L,56408L,56409L,56409L,
-     56410L,56410L,56411L,56411L,56412L,56412L,56413L,56413L,
-     56414L,56414L,56415L,56416L,56416L,56417L,56417L,56418L,
-     56418L,56419L,56419L,56420L,56420L,56421L,56421L,56422L,
-     56422L,56423L,56423L,56424L,56424L,56425L,56425L,56426L,
-     56426L,56427L,56427L,56428L,56428L,56429L,56429L,56430L,
-     56430L,56431L,56431L,56432L,56432L,56433L,56433L,56434L,
-     56434L,56435L,56435L,56436L,56436L,56437L,56437L,56438L,
-     56438L,56439L,56439L,56440L,56440L,56441L,56441L,56442L,
-     56442L,56443L,56443L,56444L,56444L,56445L,56446L,56446L,
-     56447L,56447L,56448L,56448L,56449L,56449L,56450L,56450L,
-     56451L,56451L,56452L,56452L,56453L,56453L,56454L,56454L,
-     56455L,56455L,56456L,56456L,56457L,56457L,56458L,56458L,
-     56459L,56459L,56460L,56460L,56461L,56461L,56462L,56462L,
-     56463L,56463L,56464L,56464L,56465L,56465L,56466L,56466L,
-     56467L,56467L,56468L,56468L,56469L,56469L,56470L,56470L,
-     56471L,56471L,56472L,56472L,56473L,56473L,56474L,56474L,
-     56475L,56475L,56476L,56476L,56477L,56477L,56478L,56479L,
-     56479L,56480L,56480L,56481L,56481L,56482L,56482L,56483L,
-     56483L,56484L,56484L,56485L,56485L,56486L,56486L,56487L,
-     56487L,56488L,56488L,56489L,56489L,56490L,56490L,56491L,
-     56491L,56492L,56492L,56493L,56493L,56494L,56494L,56495L,
-     56495L,56496L,56496L,56497L,56497L,56498L,56498L,56499L,
-     56499L,56500L,56500L,56501L,56501L,56502L,56502L,56503L,
-     56503L,56504L,56504L,56505L,56505L,56506L,56506L,56507L,
-     56507L,56508L,56508L,56509L,56509L,56510L,56510L,56511L,
-     56511L,56512L,56512L,56513L,56513L,56514L,56514L,56515L,
-     56516L,56516L,56517L,56517L,56518L,56518L,56519L,56519L,
-     56520L,56520L,56521L,56521L,56522L,56522L,56523L,56523L,
-     56524L,56524L,56525L,56525L,56526L,56526L,56527L,56527L,
-     56528L,56528L,56529L,56529L,56530L,56530L,56531L,56531L,
-     56532L,56532L,56533L,56533L,56534L,56534L,56535L,56535L,
-     56536L,56536L,56537L,56537L,56538L,56538L,56539L,56539L,
-     56540L,56540L,56541L,56541L,56542L,56542L,56543L,56543L,
-     56544L,56544L,56545L,56545L,56546L,56546L,56547L,56547L,
-     56548L,56548L,56549L,56549L,56550L,56550L,56551L,56551L,
-     56552L,56552L,56553L,56553L,56554L,56554L,56555L,56555L,
-     56556L,56556L,56557L,56557L,56558L,56558L,56559L,56560L,
-     56560L,56561L,56561L,56562L,56562L,56563L,56563L,56564L,
-     56564L,56565L,56565L,56566L,56566L,56567L,56567L,56568L,
-     56568L,56569L,56569L,56570L,56570L,56571L,56571L,56572L,
-     56572L,56573L,56573L,56574L,56574L,56575L,56575L,56576L,
-     56576L,56577L,56577L,56578L,56578L,56579L,56579L,56580L,
-     56580L,56581L,56581L,56582L,56582L,56583L,56583L,56584L,
-     56584L,56585L,56585L,56586L,56586L,56587L,56587L,56588L,
-     56588L,56589L,56589L,56590L,56590L,56591L,56591L,56592L,
-     56592L,56593L,56593L,56594L,56594L,56595L,56595L,56596L,
-     56596L,56597L,56597L,56598L,56598L,56599L,56599L,56600L,
-     56600L,56601L,56601L,56602L,56602L,56603L,56603L,56604L,
-     56604L,56605L,56605L,56606L,56606L,56607L,56607L,56608L,
-     56608L,56609L,56609L,56610L,56610L,56611L,56611L,56612L,
-     56612L,56613L,56613L,56614L,56614L,56615L,56615L,56616L,
-     56617L,56617L,56618L,56618L,56619L,56619L,56620L,56620L,
-     56621L,56621L,56622L,56622L,56623L,56623L,56624L,56624L,
-     56625L,56625L,56626L,56626L,56627L,56627L,56628L,56628L,
-     56629L,56629L,56630L,56630L,56631L,56631L,56632L,56632L,
-     56633L,56633L,56634L,56634L,56635L,56635L,56636L,56636L,
-     56637L,56637L,56638L,56638L,56639L,56639L,56640L,56640L,
-     56641L,56641L,56642L,56642L,56643L,56643L,56644L,56644L,
-     56645L,56645L,56646L,56646L,56647L,56647L,56648L,56648L,
-     56649L,56649L,56650L,56650L,56651L,56651L,56652L,56652L,
-     56653L,56653L,56654L,56654L,56655L,56655L,56656L,56656L,
-     56657L,56657L,56658L,56658L,56659L,56659L,56660L,56660L,
-     56661L,56661L,56662L,56662L,56663L,56663L,56664L,56664L,
-     56665L,56665L,56666L,56666L,56667L,56667L,56668L,56668L,
-     56669L,56669L,56670L,56670L,56671L,56671L,56672L,56672L,
-     56673L,56673L,56674L,56674L,56675L,56675L,56676L,56676L,
-     56677L,56677L,56678L,56678L,56679L,56679L,56680L,56680L,
-     56681L,56681L,56682L,56682L,56683L,56683L,56684L,56684L,
-     56685L,56685L,56686L,56686L,56687L,56687L,56688L,56688L,
-     56689L,56689L,56690L,56690L,56691L,56691L,56692L,56692L,
-     56693L,56693L,56694L,56694L,56695L,56695L,56696L,56696L,
-     56697L,56697L,56698L,56698L,56699L,56699L,56700L,56700L,
-     56701L,56701L,56702L,56702L,56703L,56703L,56704L,56704L,
-     56705L,56705L,56706L,56706L,56707L,56707L,56708L,56708L,
-     56709L,56709L,56710L,56710L,56711L,56711L,56712L,56712L,
-     56713L,56713L,56714L,56714L,56715L,56715L,56716L,56716L,
-     56717L,56717L,56718L,56718L,56719L,56719L,56720L,56720L,
-     56721L,56721L,56722L,56722L,56723L,56723L,56724L,56724L,
-     56725L,56725L,56726L,56726L,56727L,56727L,56728L,56728L,
-     56729L,56729L,56730L,56730L,56731L,56731L,56732L,56732L,
-     56733L,56733L,56734L,56734L,56735L,56735L,56736L,56736L,
-     56737L,56737L,56738L,56738L,56739L,56740L,56740L,56741L,
-     56741L,56742L,56742L,56743L,56743L,56744L,56744L,56745L,
-     56745L,56746L,56746L,56747L,56747L,56748L,56748L,56749L,
-     56749L,56750L,56750L,56751L,56751L,56752L,56752L,56753L,
-     56753L,56754L,56754L,56755L,56755L,56756L,56756L,56757L,
-     56757L,56758L,56758L,56759L,56759L,56760L,56760L,56761L,
-     56761L,56762L,56762L,56763L,56763L,56764L,56764L,56765L,
-     56765L,56766L,56766L,56767L,56767L,56768L,56768L,56769L,
-     56769L,56770L,56770L,56771L,56771L,56772L,56772L,56772L,
-     56773L,56773L,56774L,56774L,56775L,56775L,56776L,56776L,
-     56777L,56777L,56778L,56778L,56779L,56779L,56780L,56780L,
-     56781L,56781L,56782L,56782L,56783L,56783L,56784L,56784L,
-     56785L,56785L,56786L,56786L,56787L,56787L,56788L,56788L,
-     56789L,56789L,56790L,56790L,56791L,56791L,56792L,56792L,
-     56793L,56793L,56794L,56794L,56795L,56795L,56796L,56796L,
-     56797L,56797L,56798L,56798L,56799L,56799L,56800L,56800L,
-     56801L,56801L,56802L,56802L,56803L,56803L,56804L,56804L,
-     56805L,56805L,56806L,56806L,56807L,56807L,56808L,56808L,
-     56809L,56809L,56810L,56810L,56811L,56811L,56812L,56812L,
-     56813L,56813L,56814L,56814L,56815L,56815L,56816L,56816L,
-     56817L,56817L,56818L,56818L,56819L,56819L,56820L,56820L,
-     56821L,56821L,56822L,56822L,56823L,56823L,56824L,56824L,
-     56825L,56825L,56826L,56826L,56827L,56827L,56828L,56828L,
-     56829L,56829L,56830L,56830L,56831L,56831L,56832L,56832L,
-     56833L,56833L,56834L,56834L,56835L,56835L,56836L,56836L,
-     56837L,56837L,56838L,56838L,56839L,56839L,56840L,56840L,
-     56841L,56841L,56842L,56842L,56843L,56843L,56844L,56844L,
-     56845L,56845L,56846L,56846L,56847L,56847L,56848L,56848L,
-     56849L,56849L,56850L,56850L,56851L,56851L,56852L,56852L,
-     56853L,56853L,56854L,56854L,56855L,56855L,56856L,56856L,
-     56857L,56857L,56858L,56858L,56859L,56859L,56860L,56860L,
-     56861L,56861L,56862L,56862L,56863L,56863L,56864L,56864L,
-     56865L,56865L,56866L,56866L,56867L,56867L,56868L,56868L,
-     56869L,56869L,56870L,56870L,56871L,56871L,56872L,56872L,
-     56873L,56873L,56874L,56874L,56875L,56875L,56876L,56876L,
-     56877L,56877L,56878L,56878L,56879L,56879L,56880L,56880L,
-     56881L,56881L,56882L,56882L,56883L,56883L,56884L,56884L,
-     56885L,56885L,56886L,56886L,56887L,56887L,56888L,56888L,
-     56889L,56889L,56890L,56890L,56891L,56891L,56892L,56892L,
-     56893L,56893L,56893L,56894L,56894L,56895L,56895L,56896L,
-     56896L,56897L,56897L,56898L,56898L,56899L,56899L,56900L,
-     56900L,56901L,56901L,56902L,56902L,56903L,56903L,56904L,
-     56904L,56905L,56905L,56906L,56906L,56907L,56907L,56908L,
-     56908L,56909L,56909L,56910L,56910L,56911L,56911L,56912L,
-     56912L,56913L,56913L,56914L,56914L,56915L,56915L,56916L,
-     56916L,56917L,56917L,56918L,56918L,56919L,56919L,56920L,
-     56920L,56921L,56921L,56922L,56922L,56923L,56923L,56924L,
-     56924L,56925L,56925L,56926L,56926L,56927L,56927L,56928L,
-     56928L,56929L,56929L,56930L,56930L,56931L,56931L,56932L,
-     56932L,56933L,56933L,56934L,56934L,56935L,56935L,56936L,
-     56936L,56937L,56937L,56938L,56938L,56939L,56939L,56940L,
-     56940L,56941L,56941L,56942L,56942L,56943L,56943L,56944L,
-     56944L,56945L,56945L,56946L,56946L,56947L,56947L,56948L,
-     56948L,56949L,56949L,56950L,56950L,56950L,56951L,56951L,
-     56952L,56952L,56953L,56953L,56954L,56954L,56955L,56955L,
-     56956L,56956L,56957L,56957L,56958L,56958L,56959L,56959L,
-     56960L,56960L,56961L,56961L,56962L,56962L,56963L,56963L,
-     56964L,56964L,56965L,56965L,56966L,56966L,56967L,56967L,
-     56968L,56968L,56969L,56969L,56970L,56970L,56971L,56971L,
-     56972L,56972L,56973L,56973L,56974L,56974L,56975L,56975L,
-     56976L,56976L,56977L,56977L,56978L,56978L,56979L,56979L,
-     56980L,56980L,56981L,56981L,56982L,56982L,56983L,56983L,
-     56984L,56984L,56985L,56985L,56986L,56986L,56987L,56987L,
-     56988L,56988L,56989L,56989L,56990L,56990L,56991L,56991L,
-     56992L,56992L,56993L,56993L,56993L,56994L,56994L,56995L,
-     56995L,56996L,56996L,56997L,56997L,56998L,56998L,56999L,
-     56999L,57000L,57000L,57001L,57001L,57002L,57002L,57003L,
-     57003L,57004L,57004L,57005L,57005L,57006L,57006L,57007L,
-     57007L,57008L,57008L,57009L,57009L,57010L,57010L,57011L,
-     57011L,57012L,57012L,57013L,57013L,57014L,57014L,57015L,
-     57015L,57016L,57016L,57017L,57017L,57018L,57018L,57019L,
-     57019L,57020L,57020L,57021L,57021L,57022L,57022L,57023L,
-     57023L,57024L,57024L,57025L,57025L,57026L,57026L,57027L,
-     57027L,57028L,57028L,57029L,57029L,57029L,57030L,57030L,
-     57031L,57031L,57032L,57032L,57033L,57033L,57034L,57034L,
-     57035L,57035L,57036L,57036L,57037L,57037L,57038L,57038L,
-     57039L,57039L,57040L,57040L,57041L,57041L,57042L,57042L,
-     57043L,57043L,57044L,57044L,57045L,57045L,57046L,57046L,
-     57047L,57047L,57048L,57048L,57049L,57049L,57050L,57050L,
-     57051L,57051L,57052L,57052L,57053L,57053L,57054L,57054L,
-     57055L,57055L,57056L,57056L,57057L,57057L,57058L,57058L,
-     57059L,57059L,57060L,57060L,57061L,57061L,57061L,57062L,
-     57062L,57063L,57063L,57064L,57064L,57065L,57065L,57066L,
-     57066L,57067L,57067L,57068L,57068L,57069L,57069L,57070L,
-     57070L,57071L,57071L,57072L,57072L,57073L,57073L,57074L,
-     57074L,57075L,57075L,57076L,57076L,57077L,57077L,57078L,
-     57078L,57079L,57079L,57080L,57080L,57081L,57081L,57082L,
-     57082L,57083L,57083L,57084L,57084L,57085L,57085L,57086L,
-     57086L,57087L,57087L,57088L,57088L,57089L,57089L,57089L,
-     57090L,57090L,57091L,57091L,57092L,57092L,57093L,57093L,
-     57094L,57094L,57095L,57095L,57096L,57096L,57097L,57097L,
-     57098L,57098L,57099L,57099L,57100L,57100L,57101L,57101L,
-     57102L,57102L,57103L,57103L,57104L,57104L,57105L,57105L,
-     57106L,57106L,57107L,57107L,57108L,57108L,57109L,57109L,
-     57110L,57110L,57111L,57111L,57112L,57112L,57113L,57113L,
-     57114L,57114L,57115L,57115L,57116L,57116L,57116L,57117L,
-     57117L,57118L,57118L,57119L,57119L,57120L,57120L,57121L,
-     57121L,57122L,57122L,57123L,57123L,57124L,57124L,57125L,
-     57125L,57126L,57126L,57127L,57127L,57128L,57128L,57129L,
-     57129L,57130L,57130L,57131L,57131L,57132L,57132L,57133L,
-     57133L,57134L,57134L,57135L,57135L,57136L,57136L,57137L,
-     57137L,57138L,57138L,57139L,57139L,57140L,57140L,57140L,
-     57141L,57141L,57142L,57142L,57143L,57143L,57144L,57144L,
-     57145L,57145L,57146L,57146L,57147L,57147L,57148L,57148L,
-     57149L,57149L,57150L,57150L,57151L,57151L,57152L,57152L,
-     57153L,57153L,57154L,57154L,57155L,57155L,57156L,57156L,
-     57157L,57157L,57158L,57158L,57159L,57159L,57160L,57160L,
-     57161L,57161L,57162L,57162L,57163L,57163L,57163L,57164L,
-     57164L,57165L,57165L,57166L,57166L,57167L,57167L,57168L,
-     57168L,57169L,57169L,57170L,57170L,57171L,57171L,57172L,
-     57172L,57173L,57173L,57174L,57174L,57175L,57175L,57176L,
-     57176L,57177L,57177L,57178L,57178L,57179L,57179L,57180L,
-     57180L,57181L,57181L,57182L,57182L,57183L,57183L,57184L,
-     57184L,57185L,57185L,57185L,57186L,57186L,57187L,57187L,
-     57188L,57188L,57189L,57189L,57190L,57190L,57191L,57191L,
-     57192L,57192L,57193L,57193L,57194L,57194L,57195L,57195L,
-     57196L,57196L,57197L,57197L,57198L,57198L,57199L,57199L,
-     57200L,57200L,57201L,57201L,57202L,57202L,57203L,57203L,
-     57204L,57204L,57205L,57205L,57206L,57206L,57206L,57207L,
-     57207L,57208L,57208L,57209L,57209L,57210L,57210L,57211L,
-     57211L,57212L,57212L,57213L,57213L,57214L,57214L,57215L,
-     57215L,57216L,57216L,57217L,57217L,57218L,57218L,57219L,
-     57219L,57220L,57220L,57221L,57221L,57222L,57222L,57223L,
-     57223L,57224L,57224L,57225L,57225L,57226L,57226L,57226L,
-     57227L,57227L,57228L,57228L,57229L,57229L,57230L,57230L,
-     57231L,57231L,57232L,57232L,57233L,57233L,57234L,57234L,
-     57235L,57235L,57236L,57236L,57237L,57237L,57238L,57238L,
-     57239L,57239L,57240L,57240L,57241L,57241L,57242L,57242L,
-     57243L,57243L,57244L,57244L,57244L,57245L,57245L,57246L,
-     57246L,57247L,57247L,57248L,57248L,57249L,57249L,57250L,
-     57250L,57251L,57251L,57252L,57252L,57253L,57253L,57254L,
-     57254L,57255L,57255L,57256L,57256L,57257L,57257L,57258L,
-     57258L,57259L,57259L,57260L,57260L,57261L,57261L,57262L,
-     57262L,57263L,57263L,57263L,57264L,57264L,57265L,57265L,
-     57266L,57266L,57267L,57267L,57268L,57268L,57269L,57269L,
-     57270L,57270L,57271L,57271L,57272L,57272L,57273L,57273L,
-     57274L,57274L,57275L,57275L,57276L,57276L,57277L,57277L,
-     57278L,57278L,57279L,57279L,57280L,57280L,57280L,57281L,
-     57281L,57282L,57282L,57283L,57283L,57284L,57284L,57285L,
-     57285L,57286L,57286L,57287L,57287L,57288L,57288L,57289L,
-     57289L,57290L,57290L,57291L,57291L,57292L,57292L,57293L,
-     57293L,57294L,57294L,57295L,57295L,57296L,57296L,57297L,
-     57297L,57297L,57298L,57298L,57299L,57299L,57300L,57300L,
-     57301L,57301L,57302L,57302L,57303L,57303L,57304L,57304L,
-     57305L,57305L,57306L,57306L,57307L,57307L,57308L,57308L,
-     57309L,57309L,57310L,57310L,57311L,57311L,57312L,57312L,
-     57313L,57313L,57313L,57314L,57314L,57315L,57315L,57316L,
-     57316L,57317L,57317L,57318L,57318L,57319L,57319L,57320L,
-     57320L,57321L,57321L,57322L,57322L,57323L,57323L,57324L,
-     57324L,57325L,57325L,57326L,57326L,57327L,57327L,57328L,
-     57328L,57329L,57329L,57329L,57330L,57330L,57331L,57331L,
-     57332L,57332L,57333L,57333L,57334L,57334L,57335L,57335L,
-     57336L,57336L,57337L,57337L,57338L,57338L,57339L,57339L,
-     57340L,57340L,57341L,57341L,57342L,57342L,57343L,57343L,
-     57344L,57344L,57345L,57345L,57345L,57346L,57346L,57347L,
-     57347L,57348L,57348L,57349L,57349L,57350L,57350L,57351L,
-     57351L,57352L,57352L,57353L,57353L,57354L,57354L,57355L,
-     57355L,57356L,57356L,57357L,57357L,57358L,57358L,57359L,
-     57359L,57360L,57360L,57360L,57361L,57361L,57362L,57362L,
-     57363L,57363L,57364L,57364L,57365L,57365L,57366L,57366L,
-     57367L,57367L,57368L,57368L,57369L,57369L,57370L,57370L,
-     57371L,57371L,57372L,57372L,57373L,57373L,57374L,57374L,
-     57374L,57375L,57375L,57376L,57376L,57377L,57377L,57378L,
-     57378L,57379L,57379L,57380L,57380L,57381L,57381L,57382L,
-     57382L,57383L,57383L,57384L,57384L,57385L,57385L,57386L,
-     57386L,57387L,57387L,57388L,57388L,57389L,57389L,57389L,
-     57390L,57390L,57391L,57391L,57392L,57392L,57393L,57393L,
-     57394L,57394L,57395L,57395L,57396L,57396L,57397L,57397L,
-     57398L,57398L,57399L,57399L,57400L,57400L,57401L,57401L,
-     57402L,57402L,57403L,57403L,57403L,57404L,57404L,57405L,
-     57405L,57406L,57406L,57407L,57407L,57408L,57408L,57409L,
-     57409L,57410L,57410L,57411L,57411L,57412L,57412L,57413L,
-     57413L,57414L,57414L,57415L,57415L,57416L,57416L,57416L,
-     57417L,57417L,57418L,57418L,57419L,57419L,57420L,57420L,
-     57421L,57421L,57422L,57422L,57423L,57423L,57424L,57424L,
-     57425L,57425L,57426L,57426L,57427L,57427L,57428L,57428L,
-     57429L,57429L,57430L,57430L,57430L,57431L,57431L,57432L,
-     57432L,57433L,57433L,57434L,57434L,57435L,57435L,57436L,
-     57436L,57437L,57437L,57438L,57438L,57439L,57439L,57440L,
-     57440L,57441L,57441L,57442L,57442L,57443L,57443L,57443L,
-     57444L,57444L,57445L,57445L,57446L,57446L,57447L,57447L,
-     57448L,57448L,57449L,57449L,57450L,57450L,57451L,57451L,
-     57452L,57452L,57453L,57453L,57454L,57454L,57455L,57455L,
-     57455L,57456L,57456L,57457L,57457L,57458L,57458L,57459L,
-     57459L,57460L,57460L,57461L,57461L,57462L,57462L,57463L,
-     57463L,57464L,57464L,57465L,57465L,57466L,57466L,57467L,
-     57467L,57468L,57468L,57468L,57469L,57469L,57470L,57470L,
-     57471L,57471L,57472L,57472L,57473L,57473L,57474L,57474L,
-     57475L,57475L,57476L,57476L,57477L,57477L,57478L,57478L,
-     57479L,57479L,57480L,57480L,57480L,57481L,57481L,57482L,
-     57482L,57483L,57483L,57484L,57484L,57485L,57485L,57486L,
-     57486L,57487L,57487L,57488L,57488L,57489L,57489L,57490L,
-     57490L,57491L,57491L,57492L,57492L,57492L,57493L,57493L,
-     57494L,57494L,57495L,57495L,57496L,57496L,57497L,57497L,
-     57498L,57498L,57499L,57499L,57500L,57500L,57501L,57501L,
-     57502L,57502L,57503L,57503L,57504L,57504L,57504L,57505L,
-     57505L,57506L,57506L,57507L,57507L,57508L,57508L,57509L,
-     57509L,57510L,57510L,57511L,57511L,57512L,57512L,57513L,
-     57513L,57514L,57514L,57515L,57515L,57516L,57516L,57516L,
-     57517L,57517L,57518L,57518L,57519L,57519L,57520L,57520L,
-     57521L,57521L,57522L,57522L,57523L,57523L,57524L,57524L,
-     57525L,57525L,57526L,57526L,57527L,57527L,57527L,57528L,
-     57528L,57529L,57529L,57530L,57530L,57531L,57531L,57532L,
-     57532L,57533L,57533L,57534L,57534L,57535L,57535L,57536L,
-     57536L,57537L,57537L,57538L,57538L,57539L,57539L,57539L,
-     57540L,57540L,57541L,57541L,57542L,57542L,57543L,57543L,
-     57544L,57544L,57545L,57545L,57546L,57546L,57547L,57547L,
-     57548L,57548L,57549L,57549L,57550L,57550L,57550L,57551L,
-     57551L,57552L,57552L,57553L,57553L,57554L,57554L,57555L,
-     57555L,57556L,57556L,57557L,57557L,57558L,57558L,57559L,
-     57559L,57560L,57560L,57561L,57561L,57561L,57562L,57562L,
-     57563L,57563L,57564L,57564L,57565L,57565L,57566L,57566L,
-     57567L,57567L,57568L,57568L,57569L,57569L,57570L,57570L,
-     57571L,57571L,57572L,57572L,57572L,57573L,57573L,57574L,
-     57574L,57575L,57575L,57576L,57576L,57577L,57577L,57578L,
-     57578L,57579L,57579L,57580L,57580L,57581L,57581L,57582L,
-     57582L,57582L,57583L,57583L,57584L,57584L,57585L,57585L,
-     57586L,57586L,57587L,57587L,57588L,57588L,57589L,57589L,
-     57590L,57590L,57591L,57591L,57592L,57592L,57593L,57593L,
-     57593L,57594L,57594L,57595L,57595L,57596L,57596L,57597L,
-     57597L,57598L,57598L,57599L,57599L,57600L,57600L,57601L,
-     57601L,57602L,57602L,57603L,57603L,57603L,57604L,57604L,
-     57605L,57605L,57606L,57606L,57607L,57607L,57608L,57608L,
-     57609L,57609L,57610L,57610L,57611L,57611L,57612L,57612L,
-     57613L,57613L,57614L,57614L,57614L,57615L,57615L,57616L,
-     57616L,57617L,57617L,57618L,57618L,57619L,57619L,57620L,
-     57620L,57621L,57621L,57622L,57622L,57623L,57623L,57624L,
-     57624L,57624L,57625L,57625L,57626L,57626L,57627L,57627L,
-     57628L,57628L,57629L,57629L,57630L,57630L,57631L,57631L,
-     57632L,57632L,57633L,57633L,57634L,57634L,57634L,57635L,
-     57635L,57636L,57636L,57637L,57637L,57638L,57638L,57639L,
-     57639L,57640L,57640L,57641L,57641L,57642L,57642L,57643L,
-     57643L,57644L,57644L,57644L,57645L,57645L,57646L,57646L,
-     57647L,57647L,57648L,57648L,57649L,57649L,57650L,57650L,
-     57651L,57651L,57652L,57652L,57653L,57653L,57653L,57654L,
-     57654L,57655L,57655L,57656L,57656L,57657L,57657L,57658L,
-     57658L,57659L,57659L,57660L,57660L,57661L,57661L,57662L,
-     57662L,57663L,57663L,57663L,57664L,57664L,57665L,57665L,
-     57666L,57666L,57667L,57667L,57668L,57668L,57669L,57669L,
-     57670L,57670L,57671L,57671L,57672L,57672L,57673L,57673L,
-     57673L,57674L,57674L,57675L,57675L,57676L,57676L,57677L,
-     57677L,57678L,57678L,57679L,57679L,57680L,57680L,57681L,
-     57681L,57682L,57682L,57682L,57683L,57683L,57684L,57684L,
-     57685L,57685L,57686L,57686L,57687L,57687L,57688L,57688L,
-     57689L,57689L,57690L,57690L,57691L,57691L,57691L,57692L,
-     57692L,57693L,57693L,57694L,57694L,57695L,57695L,57696L,
-     57696L,57697L,57697L,57698L,57698L,57699L,57699L,57700L,
-     57700L,57700L,57701L,57701L,57702L,57702L,57703L,57703L,
-     57704L,57704L,57705L,57705L,57706L,57706L,57707L,57707L,
-     57708L,57708L,57709L,57709L,57710L,57710L,57710L,57711L,
-     57711L,57712L,57712L,57713L,57713L,57714L,57714L,57715L,
-     57715L,57716L,57716L,57717L,57717L,57718L,57718L,57719L,
-     57719L,57719L,57720L,57720L,57721L,57721L,57722L,57722L,
-     57723L,57723L,57724L,57724L,57725L,57725L,57726L,57726L,
-     57727L,57727L,57728L,57728L,57728L,57729L,57729L,57730L,
-     57730L,57731L,57731L,57732L,57732L,57733L,57733L,57734L,
-     57734L,57735L,57735L,57736L,57736L,57736L,57737L,57737L,
-     57738L,57738L,57739L,57739L,57740L,57740L,57741L,57741L,
-     57742L,57742L,57743L,57743L,57744L,57744L,57745L,57745L,
-     57745L,57746L,57746L,57747L,57747L,57748L,57748L,57749L,
-     57749L,57750L,57750L,57751L,57751L,57752L,57752L,57753L,
-     57753L,57754L,57754L,57754L,57755L,57755L,57756L,57756L,
-     57757L,57757L,57758L,57758L,57759L,57759L,57760L,57760L,
-     57761L,57761L,57762L,57762L,57762L,57763L,57763L,57764L,
-     57764L,57765L,57765L,57766L,57766L,57767L,57767L,57768L,
-     57768L,57769L,57769L,57770L,57770L,57771L,57771L,57771L,
-     57772L,57772L,57773L,57773L,57774L,57774L,57775L,57775L,
-     57776L,57776L,57777L,57777L,57778L,57778L,57779L,57779L,
-     57779L,57780L,57780L,57781L,57781L,57782L,57782L,57783L,
-     57783L,57784L,57784L,57785L,57785L,57786L,57786L,57787L,
-     57787L,57788L,57788L,57788L,57789L,57789L,57790L,57790L,
-     57791L,57791L,57792L,57792L,57793L,57793L,57794L,57794L,
-     57795L,57795L,57796L,57796L,57796L,57797L,57797L,57798L,
-     57798L,57799L,57799L,57800L,57800L,57801L,57801L,57802L,
-     57802L,57803L,57803L,57804L,57804L,57804L,57805L,57805L,
-     57806L,57806L,57807L,57807L,57808L,57808L,57809L,57809L,
-     57810L,57810L,57811L,57811L,57812L,57812L,57812L,57813L,
-     57813L,57814L,57814L,57815L,57815L,57816L,57816L,57817L,
-     57817L,57818L,57818L,57819L,57819L,57820L,57820L,57820L,
-     57821L,57821L,57822L,57822L,57823L,57823L,57824L,57824L,
-     57825L,57825L,57826L,57826L,57827L,57827L,57828L,57828L,
-     57828L,57829L,57829L,57830L,57830L,57831L,57831L,57832L,
-     57832L,57833L,57833L,57834L,57834L,57835L,57835L,57836L,
-     57836L,57836L,57837L,57837L,57838L,57838L,57839L,57839L,
-     57840L,57840L,57841L,57841L,57842L,57842L,57843L,57843L,
-     57844L,57844L,57844L,57845L,57845L,57846L,57846L,57847L,
-     57847L,57848L,57848L,57849L,57849L,57850L,57850L,57851L,
-     57851L,57852L,57852L,57852L,57853L,57853L,57854L,57854L,
-     57855L,57855L,57856L,57856L,57857L,57857L,57858L,57858L,
-     57859L,57859L,57860L,57860L,57860L,57861L,57861L,57862L,
-     57862L,57863L,57863L,57864L,57864L,57865L,57865L,57866L,
-     57866L,57867L,57867L,57868L,57868L,57868L,57869L,57869L,
-     57870L,57870L,57871L,57871L,57872L,57872L,57873L,57873L,
-     57874L,57874L,57875L,57875L,57875L,57876L,57876L,57877L,
-     57877L,57878L,57878L,57879L,57879L,57880L,57880L,57881L,
-     57881L,57882L,57882L,57883L,57883L,57883L,57884L,57884L,
-     57885L,57885L,57886L,57886L,57887L,57887L,57888L,57888L,
-     57889L,57889L,57890L,57890L,57890L,57891L,57891L,57892L,
-     57892L,57893L,57893L,57894L,57894L,57895L,57895L,57896L,
-     57896L,57897L,57897L,57898L,57898L,57898L,57899L,57899L,
-     57900L,57900L,57901L,57901L,57902L,57902L,57903L,57903L,
-     57904L,57904L,57905L,57905L,57905L,57906L,57906L,57907L,
-     57907L,57908L,57908L,57909L,57909L,57910L,57910L,57911L,
-     57911L,57912L,57912L,57913L,57913L,57913L,57914L,57914L,
-     57915L,57915L,57916L,57916L,57917L,57917L,57918L,57918L,
-     57919L,57919L,57920L,57920L,57920L,57921L,57921L,57922L,
-     57922L,57923L,57923L,57924L,57924L,57925L,57925L,57926L,
-     57926L,57927L,57927L,57927L,57928L,57928L,57929L,57929L,
-     57930L,57930L,57931L,57931L,57932L,57932L,57933L,57933L,
-     57934L,57934L,57934L,57935L,57935L,57936L,57936L,57937L,
-     57937L,57938L,57938L,57939L,57939L,57940L,57940L,57941L,
-     57941L,57941L,57942L,57942L,57943L,57943L,57944L,57944L,
-     57945L,57945L,57946L,57946L,57947L,57947L,57948L,57948L,
-     57949L,57949L,57949L,57950L,57950L,57951L,57951L,57952L,
-     57952L,57953L,57953L,57954L,57954L,57955L,57955L,57956L,
-     57956L,57956L,57957L,57957L,57958L,57958L,57959L,57959L,
-     57960L,57960L,57961L,57961L,57962L,57962L,57963L,57963L,
-     57963L,57964L,57964L,57965L,57965L,57966L,57966L,57967L,
-     57967L,57968L,57968L,57969L,57969L,57970L,57970L,57970L,
-     57971L,57971L,57972L,57972L,57973L,57973L,57974L,57974L,
-     57975L,57975L,57976L,57976L,57977L,57977L,57977L,57978L,
-     57978L,57979L,57979L,57980L,57980L,57981L,57981L,57982L,
-     57982L,57983L,57983L,57983L,57984L,57984L,57985L,57985L,
-     57986L,57986L,57987L,57987L,57988L,57988L,57989L,57989L,
-     57990L,57990L,57990L,57991L,57991L,57992L,57992L,57993L,
-     57993L,57994L,57994L,57995L,57995L,57996L,57996L,57997L,
-     57997L,57997L,57998L,57998L,57999L,57999L,58000L,58000L,
-     58001L,58001L,58002L,58002L,58003L,58003L,58004L,58004L,
-     58004L,58005L,58005L,58006L,58006L,58007L,58007L,58008L,
-     58008L,58009L,58009L,58010L,58010L,58011L,58011L,58011L,
-     58012L,58012L,58013L,58013L,58014L,58014L,58015L,58015L,
-     58016L,58016L,58017L,58017L,58017L,58018L,58018L,58019L,
-     58019L,58020L,58020L,58021L,58021L,58022L,58022L,58023L,
-     58023L,58024L,58024L,58024L,58025L,58025L,58026L,58026L,
-     58027L,58027L,58028L,58028L,58029L,58029L,58030L,58030L,
-     58030L,58031L,58031L,58032L,58032L,58033L,58033L,58034L,
-     58034L,58035L,58035L,58036L,58036L,58037L,58037L,58037L,
-     58038L,58038L,58039L,58039L,58040L,58040L,58041L,58041L,
-     58042L,58042L,58043L,58043L,58044L,58044L,58044L,58045L,
-     58045L,58046L,58046L,58047L,58047L,58048L,58048L,58049L,
-     58049L,58050L,58050L,58050L,58051L,58051L,58052L,58052L,
-     58053L,58053L,58054L,58054L,58055L,58055L,58056L,58056L,
-     58056L,58057L,58057L,58058L,58058L,58059L,58059L,58060L,
-     58060L,58061L,58061L,58062L,58062L,58063L,58063L,58063L,
-     58064L,58064L,58065L,58065L,58066L,58066L,58067L,58067L,
-     58068L,58068L,58069L,58069L,58069L,58070L,58070L,58071L,
-     58071L,58072L,58072L,58073L,58073L,58074L,58074L,58075L,
-     58075L,58076L,58076L,58076L,58077L,58077L,58078L,58078L,
-     58079L,58079L,58080L,58080L,58081L,58081L,58082L,58082L,
-     58082L,58083L,58083L,58084L,58084L,58085L,58085L,58086L,
-     58086L,58087L,58087L,58088L,58088L,58088L,58089L,58089L,
-     58090L,58090L,58091L,58091L,58092L,58092L,58093L,58093L,
-     58094L,58094L,58094L,58095L,58095L,58096L,58096L,58097L,
-     58097L,58098L,58098L,58099L,58099L,58100L,58100L,58101L,
-     58101L,58101L,58102L,58102L,58103L,58103L,58104L,58104L,
-     58105L,58105L,58106L,58106L,58107L,58107L,58107L,58108L,
-     58108L,58109L,58109L,58110L,58110L,58111L,58111L,58112L,
-     58112L,58113L,58113L,58113L,58114L,58114L,58115L,58115L,
-     58116L,58116L,58117L,58117L,58118L,58118L,58119L,58119L,
-     58119L,58120L,58120L,58121L,58121L,58122L,58122L,58123L,
-     58123L,58124L,58124L,58125L,58125L,58125L,58126L,58126L,
-     58127L,58127L,58128L,58128L,58129L,58129L,58130L,58130L,
-     58131L,58131L,58131L,58132L,58132L,58133L,58133L,58134L,
-     58134L,58135L,58135L,58136L,58136L,58137L,58137L,58137L,
-     58138L,58138L,58139L,58139L,58140L,58140L,58141L,58141L,
-     58142L,58142L,58143L,58143L,58143L,58144L,58144L,58145L,
-     58145L,58146L,58146L,58147L,58147L,58148L,58148L,58149L,
-     58149L,58149L,58150L,58150L,58151L,58151L,58152L,58152L,
-     58153L,58153L,58154L,58154L,58155L,58155L,58155L,58156L,
-     58156L,58157L,58157L,58158L,58158L,58159L,58159L,58160L,
-     58160L,58161L,58161L,58161L,58162L,58162L,58163L,58163L,
-     58164L,58164L,58165L,58165L,58166L,58166L,58167L,58167L,
-     58167L,58168L,58168L,58169L,58169L,58170L,58170L,58171L,
-     58171L,58172L,58172L,58173L,58173L,58173L,58174L,58174L,
-     58175L,58175L,58176L,58176L,58177L,58177L,58178L,58178L,
-     58179L,58179L,58179L,58180L,58180L,58181L,58181L,58182L,
-     58182L,58183L,58183L,58184L,58184L,58184L,58185L,58185L,
-     58186L,58186L,58187L,58187L,58188L,58188L,58189L,58189L,
-     58190L,58190L,58190L,58191L,58191L,58192L,58192L,58193L,
-     58193L,58194L,58194L,58195L,58195L,58196L,58196L,58196L,
-     58197L,58197L,58198L,58198L,58199L,58199L,58200L,58200L,
-     58201L,58201L,58202L,58202L,58202L,58203L,58203L,58204L,
-     58204L,58205L,58205L,58206L,58206L,58207L,58207L,58207L,
-     58208L,58208L,58209L,58209L,58210L,58210L,58211L,58211L,
-     58212L,58212L,58213L,58213L,58213L,58214L,58214L,58215L,
-     58215L,58216L,58216L,58217L,58217L,58218L,58218L,58219L,
-     58219L,58219L,58220L,58220L,58221L,58221L,58222L,58222L,
-     58223L,58223L,58224L,58224L,58224L,58225L,58225L,58226L,
-     58226L,58227L,58227L,58228L,58228L,58229L,58229L,58230L,
-     58230L,58230L,58231L,58231L,58232L,58232L,58233L,58233L,
-     58234L,58234L,58235L,58235L,58235L,58236L,58236L,58237L,
-     58237L,58238L,58238L,58239L,58239L,58240L,58240L,58241L,
-     58241L,58241L,58242L,58242L,58243L,58243L,58244L,58244L,
-     58245L,58245L,58246L,58246L,58246L,58247L,58247L,58248L,
-     58248L,58249L,58249L,58250L,58250L,58251L,58251L,58252L,
-     58252L,58252L,58253L,58253L,58254L,58254L,58255L,58255L,
-     58256L,58256L,58257L,58257L,58257L,58258L,58258L,58259L,
-     58259L,58260L,58260L,58261L,58261L,58262L,58262L,58263L,
-     58263L,58263L,58264L,58264L,58265L,58265L,58266L,58266L,
-     58267L,58267L,58268L,58268L,58268L,58269L,58269L,58270L,
-     58270L,58271L,58271L,58272L,58272L,58273L,58273L,58274L,
-     58274L,58274L,58275L,58275L,58276L,58276L,58277L,58277L,
-     58278L,58278L,58279L,58279L,58279L,58280L,58280L,58281L,
-     58281L,58282L,58282L,58283L,58283L,58284L,58284L,58284L,
-     58285L,58285L,58286L,58286L,58287L,58287L,58288L,58288L,
-     58289L,58289L,58290L,58290L,58290L,58291L,58291L,58292L,
-     58292L,58293L,58293L,58294L,58294L,58295L,58295L,58295L,
-     58296L,58296L,58297L,58297L,58298L,58298L,58299L,58299L,
-     58300L,58300L,58300L,58301L,58301L,58302L,58302L,58303L,
-     58303L,58304L,58304L,58305L,58305L,58305L,58306L,58306L,
-     58307L,58307L,58308L,58308L,58309L,58309L,58310L,58310L,
-     58311L,58311L,58311L,58312L,58312L,58313L,58313L,58314L,
-     58314L,58315L,58315L,58316L,58316L,58316L,58317L,58317L,
-     58318L,58318L,58319L,58319L,58320L,58320L,58321L,58321L,
-     58321L,58322L,58322L,58323L,58323L,58324L,58324L,58325L,
-     58325L,58326L,58326L,58326L,58327L,58327L,58328L,58328L,
-     58329L,58329L,58330L,58330L,58331L,58331L,58332L,58332L,
-     58332L,58333L,58333L,58334L,58334L,58335L,58335L,58336L,
-     58336L,58337L,58337L,58337L,58338L,58338L,58339L,58339L,
-     58340L,58340L,58341L,58341L,58342L,58342L,58342L,58343L,
-     58343L,58344L,58344L,58345L,58345L,58346L,58346L,58347L,
-     58347L,58347L,58348L,58348L,58349L,58349L,58350L,58350L,
-     58351L,58351L,58352L,58352L,58352L,58353L,58353L,58354L,
-     58354L,58355L,58355L,58356L,58356L,58357L,58357L,58357L,
-     58358L,58358L,58359L,58359L,58360L,58360L,58361L,58361L,
-     58362L,58362L,58362L,58363L,58363L,58364L,58364L,58365L,
-     58365L,58366L,58366L,58367L,58367L,58367L,58368L,58368L,
-     58369L,58369L,58370L,58370L,58371L,58371L,58372L,58372L,
-     58372L,58373L,58373L,58374L,58374L,58375L,58375L,58376L,
-     58376L,58377L,58377L,58377L,58378L,58378L,58379L,58379L,
-     58380L,58380L,58381L,58381L,58382L,58382L,58382L,58383L,
-     58383L,58384L,58384L,58385L,58385L,58386L,58386L,58387L,
-     58387L,58387L,58388L,58388L,58389L,58389L,58390L,58390L,
-     58391L,58391L,58392L,58392L,58392L,58393L,58393L,58394L,
-     58394L,58395L,58395L,58396L,58396L,58397L,58397L,58397L,
-     58398L,58398L,58399L,58399L,58400L,58400L,58401L,58401L,
-     58402L,58402L,58402L,58403L,58403L,58404L,58404L,58405L,
-     58405L,58406L,58406L,58407L,58407L,58407L,58408L,58408L,
-     58409L,58409L,58410L,58410L,58411L,58411L,58412L,58412L,
-     58412L,58413L,58413L,58414L,58414L,58415L,58415L,58416L,
-     58416L,58417L,58417L,58417L,58418L,58418L,58419L,58419L,
-     58420L,58420L,58421L,58421L,58421L,58422L,58422L,58423L,
-     58423L,58424L,58424L,58425L,58425L,58426L,58426L,58426L,
-     58427L,58427L,58428L,58428L,58429L,58429L,58430L,58430L,
-     58431L,58431L,58431L,58432L,58432L,58433L,58433L,58434L,
-     58434L,58435L,58435L,58436L,58436L,58436L,58437L,58437L,
-     58438L,58438L,58439L,58439L,58440L,58440L,58441L,58441L,
-     58441L,58442L,58442L,58443L,58443L,58444L,58444L,58445L,
-     58445L,58445L,58446L,58446L,58447L,58447L,58448L,58448L,
-     58449L,58449L,58450L,58450L,58450L,58451L,58451L,58452L,
-     58452L,58453L,58453L,58454L,58454L,58455L,58455L,58455L,
-     58456L,58456L,58457L,58457L,58458L,58458L,58459L,58459L,
-     58460L,58460L,58460L,58461L,58461L,58462L,58462L,58463L,
-     58463L,58464L,58464L,58464L,58465L,58465L,58466L,58466L,
-     58467L,58467L,58468L,58468L,58469L,58469L,58469L,58470L,
-     58470L,58471L,58471L,58472L,58472L,58473L,58473L,58474L,
-     58474L,58474L,58475L,58475L,58476L,58476L,58477L,58477L,
-     58478L,58478L,58478L,58479L,58479L,58480L,58480L,58481L,
-     58481L,58482L,58482L,58483L,58483L,58483L,58484L,58484L,
-     58485L,58485L,58486L,58486L,58487L,58487L,58487L,58488L,
-     58488L,58489L,58489L,58490L,58490L,58491L,58491L,58492L,
-     58492L,58492L,58493L,58493L,58494L,58494L,58495L,58495L,
-     58496L,58496L,58497L,58497L,58497L,58498L,58498L,58499L,
-     58499L,58500L,58500L,58501L,58501L,58501L,58502L,58502L,
-     58503L,58503L,58504L,58504L,58505L,58505L,58506L,58506L,
-     58506L,58507L,58507L,58508L,58508L,58509L,58509L,58510L,
-     58510L,58510L,58511L,58511L,58512L,58512L,58513L,58513L,
-     58514L,58514L,58515L,58515L,58515L,58516L,58516L,58517L,
-     58517L,58518L,58518L,58519L,58519L,58519L,58520L,58520L,
-     58521L,58521L,58522L,58522L,58523L,58523L,58524L,58524L,
-     58524L,58525L,58525L,58526L,58526L,58527L,58527L,58528L,
-     58528L,58528L,58529L,58529L,58530L,58530L,58531L,58531L,
-     58532L,58532L,58533L,58533L,58533L,58534L,58534L,58535L,
-     58535L,58536L,58536L,58537L,58537L,58537L,58538L,58538L,
-     58539L,58539L,58540L,58540L,58541L,58541L,58542L,58542L,
-     58542L,58543L,58543L,58544L,58544L,58545L,58545L,58546L,
-     58546L,58546L,58547L,58547L,58548L,58548L,58549L,58549L,
-     58550L,58550L,58551L,58551L,58551L,58552L,58552L,58553L,
-     58553L,58554L,58554L,58555L,58555L,58555L,58556L,58556L,
-     58557L,58557L,58558L,58558L,58559L,58559L,58560L,58560L,
-     58560L,58561L,58561L,58562L,58562L,58563L,58563L,58564L,
-     58564L,58564L,58565L,58565L,58566L,58566L,58567L,58567L,
-     58568L,58568L,58568L,58569L,58569L,58570L,58570L,58571L,
-     58571L,58572L,58572L,58573L,58573L,58573L,58574L,58574L,
-     58575L,58575L,58576L,58576L,58577L,58577L,58577L,58578L,
-     58578L,58579L,58579L,58580L,58580L,58581L,58581L,58581L,
-     58582L,58582L,58583L,58583L,58584L,58584L,58585L,58585L,
-     58586L,58586L,58586L,58587L,58587L,58588L,58588L,58589L,
-     58589L,58590L,58590L,58590L,58591L,58591L,58592L,58592L,
-     58593L,58593L,58594L,58594L,58594L,58595L,58595L,58596L,
-     58596L,58597L,58597L,58598L,58598L,58599L,58599L,58599L,
-     58600L,58600L,58601L,58601L,58602L,58602L,58603L,58603L,
-     58603L,58604L,58604L,58605L,58605L,58606L,58606L,58607L,
-     58607L,58607L,58608L,58608L,58609L,58609L,58610L,58610L,
-     58611L,58611L,58611L,58612L,58612L,58613L,58613L,58614L,
-     58614L,58615L,58615L,58616L,58616L,58616L,58617L,58617L,
-     58618L,58618L,58619L,58619L,58620L,58620L,58620L,58621L,
-     58621L,58622L,58622L,58623L,58623L,58624L,58624L,58624L,
-     58625L,58625L,58626L,58626L,58627L,58627L,58628L,58628L,
-     58628L,58629L,58629L,58630L,58630L,58631L,58631L,58632L,
-     58632L,58633L,58633L,58633L,58634L,58634L,58635L,58635L,
-     58636L,58636L,58637L,58637L,58637L,58638L,58638L,58639L,
-     58639L,58640L,58640L,58641L,58641L,58641L,58642L,58642L,
-     58643L,58643L,58644L,58644L,58645L,58645L,58645L,58646L,
-     58646L,58647L,58647L,58648L,58648L,58649L,58649L,58649L,
-     58650L,58650L,58651L,58651L,58652L,58652L,58653L,58653L,
-     58653L,58654L,58654L,58655L,58655L,58656L,58656L,58657L,
-     58657L,58657L,58658L,58658L,58659L,58659L,58660L,58660L,
-     58661L,58661L,58662L,58662L,58662L,58663L,58663L,58664L,
-     58664L,58665L,58665L,58666L,58666L,58666L,58667L,58667L,
-     58668L,58668L,58669L,58669L,58670L,58670L,58670L,58671L,
-     58671L,58672L,58672L,58673L,58673L,58674L,58674L,58674L,
-     58675L,58675L,58676L,58676L,58677L,58677L,58678L,58678L,
-     58678L,58679L,58679L,58680L,58680L,58681L,58681L,58682L,
-     58682L,58682L,58683L,58683L,58684L,58684L,58685L,58685L,
-     58686L,58686L,58686L,58687L,58687L,58688L,58688L,58689L,
-     58689L,58690L,58690L,58690L,58691L,58691L,58692L,58692L,
-     58693L,58693L,58694L,58694L,58694L,58695L,58695L,58696L,
-     58696L,58697L,58697L,58698L,58698L,58698L,58699L,58699L,
-     58700L,58700L,58701L,58701L,58702L,58702L,58702L,58703L,
-     58703L,58704L,58704L,58705L,58705L,58706L,58706L,58706L,
-     58707L,58707L,58708L,58708L,58709L,58709L,58710L,58710L,
-     58710L,58711L,58711L,58712L,58712L,58713L,58713L,58714L,
-     58714L,58714L,58715L,58715L,58716L,58716L,58717L,58717L,
-     58718L,58718L,58718L,58719L,58719L,58720L,58720L,58721L,
-     58721L,58722L,58722L,58722L,58723L,58723L,58724L,58724L,
-     58725L,58725L,58726L,58726L,58726L,58727L,58727L,58728L,
-     58728L,58729L,58729L,58730L,58730L,58730L,58731L,58731L,
-     58732L,58732L,58733L,58733L,58734L,58734L,58734L,58735L,
-     58735L,58736L,58736L,58737L,58737L,58738L,58738L,58738L,
-     58739L,58739L,58740L,58740L,58741L,58741L,58742L,58742L,
-     58742L,58743L,58743L,58744L,58744L,58745L,58745L,58746L,
-     58746L,58746L,58747L,58747L,58748L,58748L,58749L,58749L,
-     58750L,58750L,58750L,58751L,58751L,58752L,58752L,58753L,
-     58753L,58754L,58754L,58754L,58755L,58755L,58756L,58756L,
-     58757L,58757L,58757L,58758L,58758L,58759L,58759L,58760L,
-     58760L,58761L,58761L,58761L,58762L,58762L,58763L,58763L,
-     58764L,58764L,58765L,58765L,58765L,58766L,58766L,58767L,
-     58767L,58768L,58768L,58769L,58769L,58769L,58770L,58770L,
-     58771L,58771L,58772L,58772L,58773L,58773L,58773L,58774L,
-     58774L,58775L,58775L,58776L,58776L,58777L,58777L,58777L,
-     58778L,58778L,58779L,58779L,58780L,58780L,58781L,58781L,
-     58781L,58782L,58782L,58783L,58783L,58784L,58784L,58784L,
-     58785L,58785L,58786L,58786L,58787L,58787L,58788L,58788L,
-     58788L,58789L,58789L,58790L,58790L,58791L,58791L,58792L,
-     58792L,58792L,58793L,58793L,58794L,58794L,58795L,58795L,
-     58796L,58796L,58796L,58797L,58797L,58798L,58798L,58799L,
-     58799L,58800L,58800L,58800L,58801L,58801L,58802L,58802L,
-     58803L,58803L,58803L,58804L,58804L,58805L,58805L,58806L,
-     58806L,58807L,58807L,58807L,58808L,58808L,58809L,58809L,
-     58810L,58810L,58811L,58811L,58811L,58812L,58812L,58813L,
-     58813L,58814L,58814L,58815L,58815L,58815L,58816L,58816L,
-     58817L,58817L,58818L,58818L,58818L,58819L,58819L,58820L,
-     58820L,58821L,58821L,58822L,58822L,58822L,58823L,58823L,
-     58824L,58824L,58825L,58825L,58826L,58826L,58826L,58827L,
-     58827L,58828L,58828L,58829L,58829L,58830L,58830L,58830L,
-     58831L,58831L,58832L,58832L,58833L,58833L,58833L,58834L,
-     58834L,58835L,58835L,58836L,58836L,58837L,58837L,58837L,
-     58838L,58838L,58839L,58839L,58840L,58840L,58841L,58841L,
-     58841L,58842L,58842L,58843L,58843L,58844L,58844L,58844L,
-     58845L,58845L,58846L,58846L,58847L,58847L,58848L,58848L,
-     58848L,58849L,58849L,58850L,58850L,58851L,58851L,58852L,
-     58852L,58852L,58853L,58853L,58854L,58854L,58855L,58855L,
-     58855L,58856L,58856L,58857L,58857L,58858L,58858L,58859L,
-     58859L,58859L,58860L,58860L,58861L,58861L,58862L,58862L,
-     58863L,58863L,58863L,58864L,58864L,58865L,58865L,58866L,
-     58866L,58866L,58867L,58867L,58868L,58868L,58869L,58869L,
-     58870L,58870L,58870L,58871L,58871L,58872L,58872L,58873L,
-     58873L,58874L,58874L,58874L,58875L,58875L,58876L,58876L,
-     58877L,58877L,58877L,58878L,58878L,58879L,58879L,58880L,
-     58880L,58881L,58881L,58881L,58882L,58882L,58883L,58883L,
-     58884L,58884L,58884L,58885L,58885L,58886L,58886L,58887L,
-     58887L,58888L,58888L,58888L,58889L,58889L,58890L,58890L,
-     58891L,58891L,58892L,58892L,58892L,58893L,58893L,58894L,
-     58894L,58895L,58895L,58895L,58896L,58896L,58897L,58897L,
-     58898L,58898L,58899L,58899L,58899L,58900L,58900L,58901L,
-     58901L,58902L,58902L,58902L,58903L,58903L,58904L,58904L,
-     58905L,58905L,58906L,58906L,58906L,58907L,58907L,58908L,
-     58908L,58909L,58909L,58909L,58910L,58910L,58911L,58911L,
-     58912L,58912L,58913L,58913L,58913L,58914L,58914L,58915L,
-     58915L,58916L,58916L,58916L,58917L,58917L,58918L,58918L,
-     58919L,58919L,58920L,58920L,58920L,58921L,58921L,58922L,
-     58922L,58923L,58923L,58923L,58924L,58924L,58925L,58925L,
-     58926L,58926L,58927L,58927L,58927L,58928L,58928L,58929L,
-     58929L,58930L,58930L,58930L,58931L,58931L,58932L,58932L,
-     58933L,58933L,58934L,58934L,58934L,58935L,58935L,58936L,
-     58936L,58937L,58937L,58937L,58938L,58938L,58939L,58939L,
-     58940L,58940L,58941L,58941L,58941L,58942L,58942L,58943L,
-     58943L,58944L,58944L,58944L,58945L,58945L,58946L,58946L,
-     58947L,58947L,58948L,58948L,58948L,58949L,58949L,58950L,
-     58950L,58951L,58951L,58951L,58952L,58952L,58953L,58953L,
-     58954L,58954L,58955L,58955L,58955L,58956L,58956L,58957L,
-     58957L,58958L,58958L,58958L,58959L,58959L,58960L,58960L,
-     58961L,58961L,58962L,58962L,58962L,58963L,58963L,58964L,
-     58964L,58965L,58965L,58965L,58966L,58966L,58967L,58967L,
-     58968L,58968L,58969L,58969L,58969L,58970L,58970L,58971L,
-     58971L,58972L,58972L,58972L,58973L,58973L,58974L,58974L,
-     58975L,58975L,58975L,58976L,58976L,58977L,58977L,58978L,
-     58978L,58979L,58979L,58979L,58980L,58980L,58981L,58981L,
-     58982L,58982L,58982L,58983L,58983L,58984L,58984L,58985L,
-     58985L,58986L,58986L,58986L,58987L,58987L,58988L,58988L,
-     58989L,58989L,58989L,58990L,58990L,58991L,58991L,58992L,
-     58992L,58992L,58993L,58993L,58994L,58994L,58995L,58995L,
-     58996L,58996L,58996L,58997L,58997L,58998L,58998L,58999L,
-     58999L,58999L,59000L,59000L,59001L,59001L,59002L,59002L,
-     59002L,59003L,59003L,59004L,59004L,59005L,59005L,59006L,
-     59006L,59006L,59007L,59007L,59008L,59008L,59009L,59009L,
-     59009L,59010L,59010L,59011L,59011L,59012L,59012L,59013L,
-     59013L,59013L,59014L,59014L,59015L,59015L,59016L,59016L,
-     59016L,59017L,59017L,59018L,59018L,59019L,59019L,59019L,
-     59020L,59020L,59021L,59021L,59022L,59022L,59023L,59023L,
-     59023L,59024L,59024L,59025L,59025L,59026L,59026L,59026L,
-     59027L,59027L,59028L,59028L,59029L,59029L,59029L,59030L,
-     59030L,59031L,59031L,59032L,59032L,59032L,59033L,59033L,
-     59034L,59034L,59035L,59035L,59036L,59036L,59036L,59037L,
-     59037L,59038L,59038L,59039L,59039L,59039L,59040L,59040L,
-     59041L,59041L,59042L,59042L,59042L,59043L,59043L,59044L,
-     59044L,59045L,59045L,59046L,59046L,59046L,59047L,59047L,
-     59048L,59048L,59049L,59049L,59049L,59050L,59050L,59051L,
-     59051L,59052L,59052L,59052L,59053L,59053L,59054L,59054L,
-     59055L,59055L,59055L,59056L,59056L,59057L,59057L,59058L,
-     59058L,59059L,59059L,59059L,59060L,59060L,59061L,59061L,
-     59062L,59062L,59062L,59063L,59063L,59064L,59064L,59065L,
-     59065L,59065L,59066L,59066L,59067L,59067L,59068L,59068L,
-     59068L,59069L,59069L,59070L,59070L,59071L,59071L,59072L,
-     59072L,59072L,59073L,59073L,59074L,59074L,59075L,59075L,
-     59075L,59076L,59076L,59077L,59077L,59078L,59078L,59078L,
-     59079L,59079L,59080L,59080L,59081L,59081L,59081L,59082L,
-     59082L,59083L,59083L,59084L,59084L,59085L,59085L,59085L,
-     59086L,59086L,59087L,59087L,59088L,59088L,59088L,59089L,
-     59089L,59090L,59090L,59091L,59091L,59091L,59092L,59092L,
-     59093L,59093L,59094L,59094L,59094L,59095L,59095L,59096L,
-     59096L,59097L,59097L,59097L,59098L,59098L,59099L,59099L,
-     59100L,59100L,59101L,59101L,59101L,59102L,59102L,59103L,
-     59103L,59104L,59104L,59104L,59105L,59105L,59106L,59106L,
-     59107L,59107L,59107L,59108L,59108L,59109L,59109L,59110L,
-     59110L,59110L,59111L,59111L,59112L,59112L,59113L,59113L,
-     59113L,59114L,59114L,59115L,59115L,59116L,59116L,59116L,
-     59117L,59117L,59118L,59118L,59119L,59119L,59120L,59120L,
-     59120L,59121L,59121L,59122L,59122L,59123L,59123L,59123L,
-     59124L,59124L,59125L,59125L,59126L,59126L,59126L,59127L,
-     59127L,59128L,59128L,59129L,59129L,59129L,59130L,59130L,
-     59131L,59131L,59132L,59132L,59132L,59133L,59133L,59134L,
-     59134L,59135L,59135L,59135L,59136L,59136L,59137L,59137L,
-     59138L,59138L,59138L,59139L,59139L,59140L,59140L,59141L,
-     59141L,59142L,59142L,59142L,59143L,59143L,59144L,59144L,
-     59145L,59145L,59145L,59146L,59146L,59147L,59147L,59148L,
-     59148L,59148L,59149L,59149L,59150L,59150L,59151L,59151L,
-     59151L,59152L,59152L,59153L,59153L,59154L,59154L,59154L,
-     59155L,59155L,59156L,59156L,59157L,59157L,59157L,59158L,
-     59158L,59159L,59159L,59160L,59160L,59160L,59161L,59161L,
-     59162L,59162L,59163L,59163L,59163L,59164L,59164L,59165L,
-     59165L,59166L,59166L,59166L,59167L,59167L,59168L,59168L,
-     59169L,59169L,59169L,59170L,59170L,59171L,59171L,59172L,
-     59172L,59172L,59173L,59173L,59174L,59174L,59175L,59175L,
-     59175L,59176L,59176L,59177L,59177L,59178L,59178L,59179L,
-     59179L,59179L,59180L,59180L,59181L,59181L,59182L,59182L,
-     59182L,59183L,59183L,59184L,59184L,59185L,59185L,59185L,
-     59186L,59186L,59187L,59187L,59188L,59188L,59188L,59189L,
-     59189L,59190L,59190L,59191L,59191L,59191L,59192L,59192L,
-     59193L,59193L,59194L,59194L,59194L,59195L,59195L,59196L,
-     59196L,59197L,59197L,59197L,59198L,59198L,59199L,59199L,
-     59200L,59200L,59200L,59201L,59201L,59202L,59202L,59203L,
-     59203L,59203L,59204L,59204L,59205L,59205L,59206L,59206L,
-     59206L,59207L,59207L,59208L,59208L,59209L,59209L,59209L,
-     59210L,59210L,59211L,59211L,59212L,59212L,59212L,59213L,
-     59213L,59214L,59214L,59215L,59215L,59215L,59216L,59216L,
-     59217L,59217L,59218L,59218L,59218L,59219L,59219L,59220L,
-     59220L,59221L,59221L,59221L,59222L,59222L,59223L,59223L,
-     59224L,59224L,59224L,59225L,59225L,59226L,59226L,59227L,
-     59227L,59227L,59228L,59228L,59229L,59229L,59230L,59230L,
-     59230L,59231L,59231L,59232L,59232L,59233L,59233L,59233L,
-     59234L,59234L,59235L,59235L,59236L,59236L,59236L,59237L,
-     59237L,59238L,59238L,59239L,59239L,59239L,59240L,59240L,
-     59241L,59241L,59242L,59242L,59242L,59243L,59243L,59244L,
-     59244L,59245L,59245L,59245L,59246L,59246L,59247L,59247L,
-     59247L,59248L,59248L,59249L,59249L,59250L,59250L,59250L,
-     59251L,59251L,59252L,59252L,59253L,59253L,59253L,59254L,
-     59254L,59255L,59255L,59256L,59256L,59256L,59257L,59257L,
-     59258L,59258L,59259L,59259L,59259L,59260L,59260L,59261L,
-     59261L,59262L,59262L,59262L,59263L,59263L,59264L,59264L,
-     59265L,59265L,59265L,59266L,59266L,59267L,59267L,59268L,
-     59268L,59268L,59269L,59269L,59270L,59270L,59271L,59271L,
-     59271L,59272L,59272L,59273L,59273L,59274L,59274L,59274L,
-     59275L,59275L,59276L,59276L,59277L,59277L,59277L,59278L,
-     59278L,59279L,59279L,59280L,59280L,59280L,59281L,59281L,
-     59282L,59282L,59282L,59283L,59283L,59284L,59284L,59285L,
-     59285L,59285L,59286L,59286L,59287L,59287L,59288L,59288L,
-     59288L,59289L,59289L,59290L,59290L,59291L,59291L,59291L,
-     59292L,59292L,59293L,59293L,59294L,59294L,59294L,59295L,
-     59295L,59296L,59296L,59297L,59297L,59297L,59298L,59298L,
-     59299L,59299L,59300L,59300L,59300L,59301L,59301L,59302L,
-     59302L,59303L,59303L,59303L,59304L,59304L,59305L,59305L,
-     59305L,59306L,59306L,59307L,59307L,59308L,59308L,59308L,
-     59309L,59309L,59310L,59310L,59311L,59311L,59311L,59312L,
-     59312L,59313L,59313L,59314L,59314L,59314L,59315L,59315L,
-     59316L,59316L,59317L,59317L,59317L,59318L,59318L,59319L,
-     59319L,59320L,59320L,59320L,59321L,59321L,59322L,59322L,
-     59323L,59323L,59323L,59324L,59324L,59325L,59325L,59325L,
-     59326L,59326L,59327L,59327L,59328L,59328L,59328L,59329L,
-     59329L,59330L,59330L,59331L,59331L,59331L,59332L,59332L,
-     59333L,59333L,59334L,59334L,59334L,59335L,59335L,59336L,
-     59336L,59337L,59337L,59337L,59338L,59338L,59339L,59339L,
-     59339L,59340L,59340L,59341L,59341L,59342L,59342L,59342L,
-     59343L,59343L,59344L,59344L,59345L,59345L,59345L,59346L,
-     59346L,59347L,59347L,59348L,59348L,59348L,59349L,59349L,
-     59350L,59350L,59351L,59351L,59351L,59352L,59352L,59353L,
-     59353L,59353L,59354L,59354L,59355L,59355L,59356L,59356L,
-     59356L,59357L,59357L,59358L,59358L,59359L,59359L,59359L,
-     59360L,59360L,59361L,59361L,59362L,59362L,59362L,59363L,
-     59363L,59364L,59364L,59365L,59365L,59365L,59366L,59366L,
-     59367L,59367L,59367L,59368L,59368L,59369L,59369L,59370L,
-     59370L,59370L,59371L,59371L,59372L,59372L,59373L,59373L,
-     59373L,59374L,59374L,59375L,59375L,59376L,59376L,59376L,
-     59377L,59377L,59378L,59378L,59378L,59379L,59379L,59380L,
-     59380L,59381L,59381L,59381L,59382L,59382L,59383L,59383L,
-     59384L,59384L,59384L,59385L,59385L,59386L,59386L,59387L,
-     59387L,59387L,59388L,59388L,59389L,59389L,59389L,59390L,
-     59390L,59391L,59391L,59392L,59392L,59392L,59393L,59393L,
-     59394L,59394L,59395L,59395L,59395L,59396L,59396L,59397L,
-     59397L,59398L,59398L,59398L,59399L,59399L,59400L,59400L,
-     59400L,59401L,59401L,59402L,59402L,59403L,59403L,59403L,
-     59404L,59404L,59405L,59405L,59406L,59406L,59406L,59407L,
-     59407L,59408L,59408L,59408L,59409L,59409L,59410L,59410L,
-     59411L,59411L,59411L,59412L,59412L,59413L,59413L,59414L,
-     59414L,59414L,59415L,59415L,59416L,59416L,59417L,59417L,
-     59417L,59418L,59418L,59419L,59419L,59419L,59420L,59420L,
-     59421L,59421L,59422L,59422L,59422L,59423L,59423L,59424L,
-     59424L,59425L,59425L,59425L,59426L,59426L,59427L,59427L,
-     59427L,59428L,59428L,59429L,59429L,59430L,59430L,59430L,
-     59431L,59431L,59432L,59432L,59433L,59433L,59433L,59434L,
-     59434L,59435L,59435L,59435L,59436L,59436L,59437L,59437L,
-     59438L,59438L,59438L,59439L,59439L,59440L,59440L,59441L,
-     59441L,59441L,59442L,59442L,59443L,59443L,59443L,59444L,
-     59444L,59445L,59445L,59446L,59446L,59446L,59447L,59447L,
-     59448L,59448L,59449L,59449L,59449L,59450L,59450L,59451L,
-     59451L,59451L,59452L,59452L,59453L,59453L,59454L,59454L,
-     59454L,59455L,59455L,59456L,59456L,59457L,59457L,59457L,
-     59458L,59458L,59459L,59459L,59459L,59460L,59460L,59461L,
-     59461L,59462L,59462L,59462L,59463L,59463L,59464L,59464L,
-     59465L,59465L,59465L,59466L,59466L,59467L,59467L,59467L,
-     59468L,59468L,59469L,59469L,59470L,59470L,59470L,59471L,
-     59471L,59472L,59472L,59473L,59473L,59473L,59474L,59474L,
-     59475L,59475L,59475L,59476L,59476L,59477L,59477L,59478L,
-     59478L,59478L,59479L,59479L,59480L,59480L,59480L,59481L,
-     59481L,59482L,59482L,59483L,59483L,59483L,59484L,59484L,
-     59485L,59485L,59486L,59486L,59486L,59487L,59487L,59488L,
-     59488L,59488L,59489L,59489L,59490L,59490L,59491L,59491L,
-     59491L,59492L,59492L,59493L,59493L,59493L,59494L,59494L,
-     59495L,59495L,59496L,59496L,59496L,59497L,59497L,59498L,
-     59498L,59499L,59499L,59499L,59500L,59500L,59501L,59501L,
-     59501L,59502L,59502L,59503L,59503L,59504L,59504L,59504L,
-     59505L,59505L,59506L,59506L,59506L,59507L,59507L,59508L,
-     59508L,59509L,59509L,59509L,59510L,59510L,59511L,59511L,
-     59512L,59512L,59512L,59513L,59513L,59514L,59514L,59514L,
-     59515L,59515L,59516L,59516L,59517L,59517L,59517L,59518L,
-     59518L,59519L,59519L,59519L,59520L,59520L,59521L,59521L,
-     59522L,59522L,59522L,59523L,59523L,59524L,59524L,59524L,
-     59525L,59525L,59526L,59526L,59527L,59527L,59527L,59528L,
-     59528L,59529L,59529L,59530L,59530L,59530L,59531L,59531L,
-     59532L,59532L,59532L,59533L,59533L,59534L,59534L,59535L,
-     59535L,59535L,59536L,59536L,59537L,59537L,59537L,59538L,
-     59538L,59539L,59539L,59540L,59540L,59540L,59541L,59541L,
-     59542L,59542L,59542L,59543L,59543L,59544L,59544L,59545L,
-     59545L,59545L,59546L,59546L,59547L,59547L,59547L,59548L,
-     59548L,59549L,59549L,59550L,59550L,59550L,59551L,59551L,
-     59552L,59552L,59552L,59553L,59553L,59554L,59554L,59555L,
-     59555L,59555L,59556L,59556L,59557L,59557L,59558L,59558L,
-     59558L,59559L,59559L,59560L,59560L,59560L,59561L,59561L,
-     59562L,59562L,59563L,59563L,59563L,59564L,59564L,59565L,
-     59565L,59565L,59566L,59566L,59567L,59567L,59568L,59568L,
-     59568L,59569L,59569L,59570L,59570L,59570L,59571L,59571L,
-     59572L,59572L,59573L,59573L,59573L,59574L,59574L,59575L,
-     59575L,59575L,59576L,59576L,59577L,59577L,59578L,59578L,
-     59578L,59579L,59579L,59580L,59580L,59580L,59581L,59581L,
-     59582L,59582L,59583L,59583L,59583L,59584L,59584L,59585L,
-     59585L,59585L,59586L,59586L,59587L,59587L,59588L,59588L,
-     59588L,59589L,59589L,59590L,59590L,59590L,59591L,59591L,
-     59592L,59592L,59593L,59593L,59593L,59594L,59594L,59595L,
-     59595L,59595L,59596L,59596L,59597L,59597L,59597L,59598L,
-     59598L,59599L,59599L,59600L,59600L,59600L,59601L,59601L,
-     59602L,59602L,59602L,59603L,59603L,59604L,59604L,59605L,
-     59605L,59605L,59606L,59606L,59607L,59607L,59607L,59608L,
-     59608L,59609L,59609L,59610L,59610L,59610L,59611L,59611L,
-     59612L,59612L,59612L,59613L,59613L,59614L,59614L,59615L,
-     59615L,59615L,59616L,59616L,59617L,59617L,59617L,59618L,
-     59618L,59619L,59619L,59620L,59620L,59620L,59621L,59621L,
-     59622L,59622L,59622L,59623L,59623L,59624L,59624L,59625L,
-     59625L,59625L,59626L,59626L,59627L,59627L,59627L,59628L,
-     59628L,59629L,59629L,59629L,59630L,59630L,59631L,59631L,
-     59632L,59632L,59632L,59633L,59633L,59634L,59634L,59634L,
-     59635L,59635L,59636L,59636L,59637L,59637L,59637L,59638L,
-     59638L,59639L,59639L,59639L,59640L,59640L,59641L,59641L,
-     59642L,59642L,59642L,59643L,59643L,59644L,59644L,59644L,
-     59645L,59645L,59646L,59646L,59646L,59647L,59647L,59648L,
-     59648L,59649L,59649L,59649L,59650L,59650L,59651L,59651L,
-     59651L,59652L,59652L,59653L,59653L,59654L,59654L,59654L,
-     59655L,59655L,59656L,59656L,59656L,59657L,59657L,59658L,
-     59658L,59658L,59659L,59659L,59660L,59660L,59661L,59661L,
-     59661L,59662L,59662L,59663L,59663L,59663L,59664L,59664L,
-     59665L,59665L,59666L,59666L,59666L,59667L,59667L,59668L,
-     59668L,59668L,59669L,59669L,59670L,59670L,59670L,59671L,
-     59671L,59672L,59672L,59673L,59673L,59673L,59674L,59674L,
-     59675L,59675L,59675L,59676L,59676L,59677L,59677L,59678L,
-     59678L,59678L,59679L,59679L,59680L,59680L,59680L,59681L,
-     59681L,59682L,59682L,59682L,59683L,59683L,59684L,59684L,
-     59685L,59685L,59685L,59686L,59686L,59687L,59687L,59687L,
-     59688L,59688L,59689L,59689L,59689L,59690L,59690L,59691L,
-     59691L,59692L,59692L,59692L,59693L,59693L,59694L,59694L,
-     59694L,59695L,59695L,59696L,59696L,59697L,59697L,59697L,
-     59698L,59698L,59699L,59699L,59699L,59700L,59700L,59701L,
-     59701L,59701L,59702L,59702L,59703L,59703L,59704L,59704L,
-     59704L,59705L,59705L,59706L,59706L,59706L,59707L,59707L,
-     59708L,59708L,59708L,59709L,59709L,59710L,59710L,59711L,
-     59711L,59711L,59712L,59712L,59713L,59713L,59713L,59714L,
-     59714L,59715L,59715L,59715L,59716L,59716L,59717L,59717L,
-     59718L,59718L,59718L,59719L,59719L,59720L,59720L,59720L,
-     59721L,59721L,59722L,59722L,59722L,59723L,59723L,59724L,
-     59724L,59725L,59725L,59725L,59726L,59726L,59727L,59727L,
-     59727L,59728L,59728L,59729L,59729L,59729L,59730L,59730L,
-     59731L,59731L,59732L,59732L,59732L,59733L,59733L,59734L,
-     59734L,59734L,59735L,59735L,59736L,59736L,59736L,59737L,
-     59737L,59738L,59738L,59739L,59739L,59739L,59740L,59740L,
-     59741L,59741L,59741L,59742L,59742L,59743L,59743L,59743L,
-     59744L,59744L,59745L,59745L,59746L,59746L,59746L,59747L,
-     59747L,59748L,59748L,59748L,59749L,59749L,59750L,59750L,
-     59750L,59751L,59751L,59752L,59752L,59752L,59753L,59753L,
-     59754L,59754L,59755L,59755L,59755L,59756L,59756L,59757L,
-     59757L,59757L,59758L,59758L,59759L,59759L,59759L,59760L,
-     59760L,59761L,59761L,59762L,59762L,59762L,59763L,59763L,
-     59764L,59764L,59764L,59765L,59765L,59766L,59766L,59766L,
-     59767L,59767L,59768L,59768L,59769L,59769L,59769L,59770L,
-     59770L,59771L,59771L,59771L,59772L,59772L,59773L,59773L,
-     59773L,59774L,59774L,59775L,59775L,59775L,59776L,59776L,
-     59777L,59777L,59778L,59778L,59778L,59779L,59779L,59780L,
-     59780L,59780L,59781L,59781L,59782L,59782L,59782L,59783L,
-     59783L,59784L,59784L,59784L,59785L,59785L,59786L,59786L,
-     59787L,59787L,59787L,59788L,59788L,59789L,59789L,59789L,
-     59790L,59790L,59791L,59791L,59791L,59792L,59792L,59793L,
-     59793L,59794L,59794L,59794L,59795L,59795L,59796L,59796L,
-     59796L,59797L,59797L,59798L,59798L,59798L,59799L,59799L,
-     59800L,59800L,59800L,59801L,59801L,59802L,59802L,59803L,
-     59803L,59803L,59804L,59804L,59805L,59805L,59805L,59806L,
-     59806L,59807L,59807L,59807L,59808L,59808L,59809L,59809L,
-     59809L,59810L,59810L,59811L,59811L,59811L,59812L,59812L,
-     59813L,59813L,59814L,59814L,59814L,59815L,59815L,59816L,
-     59816L,59816L,59817L,59817L,59818L,59818L,59818L,59819L,
-     59819L,59820L,59820L,59820L,59821L,59821L,59822L,59822L,
-     59823L,59823L,59823L,59824L,59824L,59825L,59825L,59825L,
-     59826L,59826L,59827L,59827L,59827L,59828L,59828L,59829L,
-     59829L,59829L,59830L,59830L,59831L,59831L,59832L,59832L,
-     59832L,59833L,59833L,59834L,59834L,59834L,59835L,59835L,
-     59836L,59836L,59836L,59837L,59837L,59838L,59838L,59838L,
-     59839L,59839L,59840L,59840L,59840L,59841L,59841L,59842L,
-     59842L,59843L,59843L,59843L,59844L,59844L,59845L,59845L,
-     59845L,59846L,59846L,59847L,59847L,59847L,59848L,59848L,
-     59849L,59849L,59849L,59850L,59850L,59851L,59851L,59851L,
-     59852L,59852L,59853L,59853L,59854L,59854L,59854L,59855L,
-     59855L,59856L,59856L,59856L,59857L,59857L,59858L,59858L,
-     59858L,59859L,59859L,59860L,59860L,59860L,59861L,59861L,
-     59862L,59862L,59862L,59863L,59863L,59864L,59864L,59865L,
-     59865L,59865L,59866L,59866L,59867L,59867L,59867L,59868L,
-     59868L,59869L,59869L,59869L,59870L,59870L,59871L,59871L,
-     59871L,59872L,59872L,59873L,59873L,59873L,59874L,59874L,
-     59875L,59875L,59875L,59876L,59876L,59877L,59877L,59878L,
-     59878L,59878L,59879L,59879L,59880L,59880L,59880L,59881L,
-     59881L,59882L,59882L,59882L,59883L,59883L,59884L,59884L,
-     59884L,59885L,59885L,59886L,59886L,59886L,59887L,59887L,
-     59888L,59888L,59888L,59889L,59889L,59890L,59890L,59891L,
-     59891L,59891L,59892L,59892L,59893L,59893L,59893L,59894L,
-     59894L,59895L,59895L,59895L,59896L,59896L,59897L,59897L,
-     59897L,59898L,59898L,59899L,59899L,59899L,59900L,59900L,
-     59901L,59901L,59901L,59902L,59902L,59903L,59903L,59904L,
-     59904L,59904L,59905L,59905L,59906L,59906L,59906L,59907L,
-     59907L,59908L,59908L,59908L,59909L,59909L,59910L,59910L,
-     59910L,59911L,59911L,59912L,59912L,59912L,59913L,59913L,
-     59914L,59914L,59914L,59915L,59915L,59916L,59916L,59916L,
-     59917L,59917L,59918L,59918L,59919L,59919L,59919L,59920L,
-     59920L,59921L,59921L,59921L,59922L,59922L,59923L,59923L,
-     59923L,59924L,59924L,59925L,59925L,59925L,59926L,59926L,
-     59927L,59927L,59927L,59928L,59928L,59929L,59929L,59929L,
-     59930L,59930L,59931L,59931L,59931L,59932L,59932L,59933L,
-     59933L,59933L,59934L,59934L,59935L,59935L,59936L,59936L,
-     59936L,59937L,59937L,59938L,59938L,59938L,59939L,59939L,
-     59940L,59940L,59940L,59941L,59941L,59942L,59942L,59942L,
-     59943L,59943L,59944L,59944L,59944L,59945L,59945L,59946L,
-     59946L,59946L,59947L,59947L,59948L,59948L,59948L,59949L,
-     59949L,59950L,59950L,59950L,59951L,59951L,59952L,59952L,
-     59952L,59953L,59953L,59954L,59954L,59955L,59955L,59955L,
-     59956L,59956L,59957L,59957L,59957L,59958L,59958L,59959L,
-     59959L,59959L,59960L,59960L,59961L,59961L,59961L,59962L,
-     59962L,59963L,59963L,59963L,59964L,59964L,59965L,59965L,
-     59965L,59966L,59966L,59967L,59967L,59967L,59968L,59968L,
-     59969L,59969L,59969L,59970L,59970L,59971L,59971L,59971L,
-     59972L,59972L,59973L,59973L,59973L,59974L,59974L,59975L,
-     59975L,59975L,59976L,59976L,59977L,59977L,59978L,59978L,
-     59978L,59979L,59979L,59980L,59980L,59980L,59981L,59981L,
-     59982L,59982L,59982L,59983L,59983L,59984L,59984L,59984L,
-     59985L,59985L,59986L,59986L,59986L,59987L,59987L,59988L,
-     59988L,59988L,59989L,59989L,59990L,59990L,59990L,59991L,
-     59991L,59992L,59992L,59992L,59993L,59993L,59994L,59994L,
-     59994L,59995L,59995L,59996L,59996L,59996L,59997L,59997L,
-     59998L,59998L,59998L,59999L,59999L,60000L,60000L,60000L,
-     60001L,60001L,60002L,60002L,60002L,60003L,60003L,60004L,
-     60004L,60004L,60005L,60005L,60006L,60006L,60006L,60007L,
-     60007L,60008L,60008L,60008L,60009L,60009L,60010L,60010L,
-     60011L,60011L,60011L,60012L,60012L,60013L,60013L,60013L,
-     60014L,60014L,60015L,60015L,60015L,60016L,60016L,60017L,
-     60017L,60017L,60018L,60018L,60019L,60019L,60019L,60020L,
-     60020L,60021L,60021L,60021L,60022L,60022L,60023L,60023L,
-     60023L,60024L,60024L,60025L,60025L,60025L,60026L,60026L,
-     60027L,60027L,60027L,60028L,60028L,60029L,60029L,60029L,
-     60030L,60030L,60031L,60031L,60031L,60032L,60032L,60033L,
-     60033L,60033L,60034L,60034L,60035L,60035L,60035L,60036L,
-     60036L,60037L,60037L,60037L,60038L,60038L,60039L,60039L,
-     60039L,60040L,60040L,60041L,60041L,60041L,60042L,60042L,
-     60043L,60043L,60043L,60044L,60044L,60045L,60045L,60045L,
-     60046L,60046L,60047L,60047L,60047L,60048L,60048L,60049L,
-     60049L,60049L,60050L,60050L,60051L,60051L,60051L,60052L,
-     60052L,60053L,60053L,60053L,60054L,60054L,60055L,60055L,
-     60055L,60056L,60056L,60057L,60057L,60057L,60058L,60058L,
-     60059L,60059L,60059L,60060L,60060L,60061L,60061L,60061L,
-     60062L,60062L,60063L,60063L,60063L,60064L,60064L,60065L,
-     60065L,60065L,60066L,60066L,60067L,60067L,60067L,60068L,
-     60068L,60069L,60069L,60069L,60070L,60070L,60071L,60071L,
-     60071L,60072L,60072L,60073L,60073L,60073L,60074L,60074L,
-     60075L,60075L,60075L,60076L,60076L,60077L,60077L,60077L,
-     60078L,60078L,60079L,60079L,60079L,60080L,60080L,60081L,
-     60081L,60081L,60082L,60082L,60083L,60083L,60083L,60084L,
-     60084L,60085L,60085L,60085L,60086L,60086L,60087L,60087L,
-     60087L,60088L,60088L,60089L,60089L,60089L,60090L,60090L,
-     60091L,60091L,60091L,60092L,60092L,60093L,60093L,60093L,
-     60094L,60094L,60095L,60095L,60095L,60096L,60096L,60097L,
-     60097L,60097L,60098L,60098L,60099L,60099L,60099L,60100L,
-     60100L,60101L,60101L,60101L,60102L,60102L,60103L,60103L,
-     60103L,60104L,60104L,60105L,60105L,60105L,60106L,60106L,
-     60107L,60107L,60107L,60108L,60108L,60109L,60109L,60109L,
-     60110L,60110L,60111L,60111L,60111L,60112L,60112L,60113L,
-     60113L,60113L,60114L,60114L,60115L,60115L,60115L,60116L,
-     60116L,60117L,60117L,60117L,60118L,60118L,60119L,60119L,
-     60119L,60120L,60120L,60120L,60121L,60121L,60122L,60122L,
-     60122L,60123L,60123L,60124L,60124L,60124L,60125L,60125L,
-     60126L,60126L,60126L,60127L,60127L,60128L,60128L,60128L,
-     60129L,60129L,60130L,60130L,60130L,60131L,60131L,60132L,
-     60132L,60132L,60133L,60133L,60134L,60134L,60134L,60135L,
-     60135L,60136L,60136L,60136L,60137L,60137L,60138L,60138L,
-     60138L,60139L,60139L,60140L,60140L,60140L,60141L,60141L,
-     60142L,60142L,60142L,60143L,60143L,60144L,60144L,60144L,
-     60145L,60145L,60146L,60146L,60146L,60147L,60147L,60148L,
-     60148L,60148L,60149L,60149L,60150L,60150L,60150L,60151L,
-     60151L,60151L,60152L,60152L,60153L,60153L,60153L,60154L,
-     60154L,60155L,60155L,60155L,60156L,60156L,60157L,60157L,
-     60157L,60158L,60158L,60159L,60159L,60159L,60160L,60160L,
-     60161L,60161L,60161L,60162L,60162L,60163L,60163L,60163L,
-     60164L,60164L,60165L,60165L,60165L,60166L,60166L,60167L,
-     60167L,60167L,60168L,60168L,60169L,60169L,60169L,60170L,
-     60170L,60171L,60171L,60171L,60172L,60172L,60173L,60173L,
-     60173L,60174L,60174L,60174L,60175L,60175L,60176L,60176L,
-     60176L,60177L,60177L,60178L,60178L,60178L,60179L,60179L,
-     60180L,60180L,60180L,60181L,60181L,60182L,60182L,60182L,
-     60183L,60183L,60184L,60184L,60184L,60185L,60185L,60186L,
-     60186L,60186L,60187L,60187L,60188L,60188L,60188L,60189L,
-     60189L,60190L,60190L,60190L,60191L,60191L,60192L,60192L,
-     60192L,60193L,60193L,60193L,60194L,60194L,60195L,60195L,
-     60195L,60196L,60196L,60197L,60197L,60197L,60198L,60198L,
-     60199L,60199L,60199L,60200L,60200L,60201L,60201L,60201L,
-     60202L,60202L,60203L,60203L,60203L,60204L,60204L,60205L,
-     60205L,60205L,60206L,60206L,60207L,60207L,60207L,60208L,
-     60208L,60209L,60209L,60209L,60210L,60210L,60210L,60211L,
-     60211L,60212L,60212L,60212L,60213L,60213L,60214L,60214L,
-     60214L,60215L,60215L,60216L,60216L,60216L,60217L,60217L,
-     60218L,60218L,60218L,60219L,60219L,60220L,60220L,60220L,
-     60221L,60221L,60222L,60222L,60222L,60223L,60223L,60224L,
-     60224L,60224L,60225L,60225L,60225L,60226L,60226L,60227L,
-     60227L,60227L,60228L,60228L,60229L,60229L,60229L,60230L,
-     60230L,60231L,60231L,60231L,60232L,60232L,60233L,60233L,
-     60233L,60234L,60234L,60235L,60235L,60235L,60236L,60236L,
-     60237L,60237L,60237L,60238L,60238L,60238L,60239L,60239L,
-     60240L,60240L,60240L,60241L,60241L,60242L,60242L,60242L,
-     60243L,60243L,60244L,60244L,60244L,60245L,60245L,60246L,
-     60246L,60246L,60247L,60247L,60248L,60248L,60248L,60249L,
-     60249L,60250L,60250L,60250L,60251L,60251L,60251L,60252L,
-     60252L,60253L,60253L,60253L,60254L,60254L,60255L,60255L,
-     60255L,60256L,60256L,60257L,60257L,60257L,60258L,60258L,
-     60259L,60259L,60259L,60260L,60260L,60261L,60261L,60261L,
-     60262L,60262L,60262L,60263L,60263L,60264L,60264L,60264L,
-     60265L,60265L,60266L,60266L,60266L,60267L,60267L,60268L,
-     60268L,60268L,60269L,60269L,60270L,60270L,60270L,60271L,
-     60271L,60272L,60272L,60272L,60273L,60273L,60273L,60274L,
-     60274L,60275L,60275L,60275L,60276L,60276L,60277L,60277L,
-     60277L,60278L,60278L,60279L,60279L,60279L,60280L,60280L,
-     60281L,60281L,60281L,60282L,60282L,60283L,60283L,60283L,
-     60284L,60284L,60284L,60285L,60285L,60286L,60286L,60286L,
-     60287L,60287L,60288L,60288L,60288L,60289L,60289L,60290L,
-     60290L,60290L,60291L,60291L,60292L,60292L,60292L,60293L,
-     60293L,60293L,60294L,60294L,60295L,60295L,60295L,60296L,
-     60296L,60297L,60297L,60297L,60298L,60298L,60299L,60299L,
-     60299L,60300L,60300L,60301L,60301L,60301L,60302L,60302L,
-     60302L,60303L,60303L,60304L,60304L,60304L,60305L,60305L,
-     60306L,60306L,60306L,60307L,60307L,60308L,60308L,60308L,
-     60309L,60309L,60310L,60310L,60310L,60311L,60311L,60311L,
-     60312L,60312L,60313L,60313L,60313L,60314L,60314L,60315L,
-     60315L,60315L,60316L,60316L,60317L,60317L,60317L,60318L,
-     60318L,60319L,60319L,60319L,60320L,60320L,60320L,60321L,
-     60321L,60322L,60322L,60322L,60323L,60323L,60324L,60324L,
-     60324L,60325L,60325L,60326L,60326L,60326L,60327L,60327L,
-     60328L,60328L,60328L,60329L,60329L,60329L,60330L,60330L,
-     60331L,60331L,60331L,60332L,60332L,60333L,60333L,60333L,
-     60334L,60334L,60335L,60335L,60335L,60336L,60336L,60337L,
-     60337L,60337L,60338L,60338L,60338L,60339L,60339L,60340L,
-     60340L,60340L,60341L,60341L,60342L,60342L,60342L,60343L,
-     60343L,60344L,60344L,60344L,60345L,60345L,60345L,60346L,
-     60346L,60347L,60347L,60347L,60348L,60348L,60349L,60349L,
-     60349L,60350L,60350L,60351L,60351L,60351L,60352L,60352L,
-     60352L,60353L,60353L,60354L,60354L,60354L,60355L,60355L,
-     60356L,60356L,60356L,60357L,60357L,60358L,60358L,60358L,
-     60359L,60359L,60360L,60360L,60360L,60361L,60361L,60361L,
-     60362L,60362L,60363L,60363L,60363L,60364L,60364L,60365L,
-     60365L,60365L,60366L,60366L,60367L,60367L,60367L,60368L,
-     60368L,60368L,60369L,60369L,60370L,60370L,60370L,60371L,
-     60371L,60372L,60372L,60372L,60373L,60373L,60374L,60374L,
-     60374L,60375L,60375L,60375L,60376L,60376L,60377L,60377L,
-     60377L,60378L,60378L,60379L,60379L,60379L,60380L,60380L,
-     60381L,60381L,60381L,60382L,60382L,60382L,60383L,60383L,
-     60384L,60384L,60384L,60385L,60385L,60386L,60386L,60386L,
-     60387L,60387L,60388L,60388L,60388L,60389L,60389L,60389L,
-     60390L,60390L,60391L,60391L,60391L,60392L,60392L,60393L,
-     60393L,60393L,60394L,60394L,60395L,60395L,60395L,60396L,
-     60396L,60396L,60397L,60397L,60398L,60398L,60398L,60399L,
-     60399L,60400L,60400L,60400L,60401L,60401L,60401L,60402L,
-     60402L,60403L,60403L,60403L,60404L,60404L,60405L,60405L,
-     60405L,60406L,60406L,60407L,60407L,60407L,60408L,60408L,
-     60408L,60409L,60409L,60410L,60410L,60410L,60411L,60411L,
-     60412L,60412L,60412L,60413L,60413L,60414L,60414L,60414L,
-     60415L,60415L,60415L,60416L,60416L,60417L,60417L,60417L,
-     60418L,60418L,60419L,60419L,60419L,60420L,60420L,60420L,
-     60421L,60421L,60422L,60422L,60422L,60423L,60423L,60424L,
-     60424L,60424L,60425L,60425L,60426L,60426L,60426L,60427L,
-     60427L,60427L,60428L,60428L,60429L,60429L,60429L,60430L,
-     60430L,60431L,60431L,60431L,60432L,60432L,60432L,60433L,
-     60433L,60434L,60434L,60434L,60435L,60435L,60436L,60436L,
-     60436L,60437L,60437L,60438L,60438L,60438L,60439L,60439L,
-     60439L,60440L,60440L,60441L,60441L,60441L,60442L,60442L,
-     60443L,60443L,60443L,60444L,60444L,60444L,60445L,60445L,
-     60446L,60446L,60446L,60447L,60447L,60448L,60448L,60448L,
-     60449L,60449L,60450L,60450L,60450L,60451L,60451L,60451L,
-     60452L,60452L,60453L,60453L,60453L,60454L,60454L,60455L,
-     60455L,60455L,60456L,60456L,60456L,60457L,60457L,60458L,
-     60458L,60458L,60459L,60459L,60460L,60460L,60460L,60461L,
-     60461L,60461L,60462L,60462L,60463L,60463L,60463L,60464L,
-     60464L,60465L,60465L,60465L,60466L,60466L,60466L,60467L,
-     60467L,60468L,60468L,60468L,60469L,60469L,60470L,60470L,
-     60470L,60471L,60471L,60471L,60472L,60472L,60473L,60473L,
-     60473L,60474L,60474L,60475L,60475L,60475L,60476L,60476L,
-     60477L,60477L,60477L,60478L,60478L,60478L,60479L,60479L,
-     60480L,60480L,60480L,60481L,60481L,60482L,60482L,60482L,
-     60483L,60483L,60483L,60484L,60484L,60485L,60485L,60485L,
-     60486L,60486L,60487L,60487L,60487L,60488L,60488L,60488L,
-     60489L,60489L,60490L,60490L,60490L,60491L,60491L,60492L,
-     60492L,60492L,60493L,60493L,60493L,60494L,60494L,60495L,
-     60495L,60495L,60496L,60496L,60497L,60497L,60497L,60498L,
-     60498L,60498L,60499L,60499L,60500L,60500L,60500L,60501L,
-     60501L,60502L,60502L,60502L,60503L,60503L,60503L,60504L,
-     60504L,60505L,60505L,60505L,60506L,60506L,60507L,60507L,
-     60507L,60508L,60508L,60508L,60509L,60509L,60510L,60510L,
-     60510L,60511L,60511L,60512L,60512L,60512L,60513L,60513L,
-     60513L,60514L,60514L,60515L,60515L,60515L,60516L,60516L,
-     60516L,60517L,60517L,60518L,60518L,60518L,60519L,60519L,
-     60520L,60520L,60520L,60521L,60521L,60521L,60522L,60522L,
-     60523L,60523L,60523L,60524L,60524L,60525L,60525L,60525L,
-     60526L,60526L,60526L,60527L,60527L,60528L,60528L,60528L,
-     60529L,60529L,60530L,60530L,60530L,60531L,60531L,60531L,
-     60532L,60532L,60533L,60533L,60533L,60534L,60534L,60535L,
-     60535L,60535L,60536L,60536L,60536L,60537L,60537L,60538L,
-     60538L,60538L,60539L,60539L,60539L,60540L,60540L,60541L,
-     60541L,60541L,60542L,60542L,60543L,60543L,60543L,60544L,
-     60544L,60544L,60545L,60545L,60546L,60546L,60546L,60547L,
-     60547L,60548L,60548L,60548L,60549L,60549L,60549L,60550L,
-     60550L,60551L,60551L,60551L,60552L,60552L,60553L,60553L,
-     60553L,60554L,60554L,60554L,60555L,60555L,60556L,60556L,
-     60556L,60557L,60557L,60557L,60558L,60558L,60559L,60559L,
-     60559L,60560L,60560L,60561L,60561L,60561L,60562L,60562L,
-     60562L,60563L,60563L,60564L,60564L,60564L,60565L,60565L,
-     60566L,60566L,60566L,60567L,60567L,60567L,60568L,60568L,
-     60569L,60569L,60569L,60570L,60570L,60570L,60571L,60571L,
-     60572L,60572L,60572L,60573L,60573L,60574L,60574L,60574L,
-     60575L,60575L,60575L,60576L,60576L,60577L,60577L,60577L,
-     60578L,60578L,60578L,60579L,60579L,60580L,60580L,60580L,
-     60581L,60581L,60582L,60582L,60582L,60583L,60583L,60583L,
-     60584L,60584L,60585L,60585L,60585L,60586L,60586L,60586L,
-     60587L,60587L,60588L,60588L,60588L,60589L,60589L,60590L,
-     60590L,60590L,60591L,60591L,60591L,60592L,60592L,60593L,
-     60593L,60593L,60594L,60594L,60594L,60595L,60595L,60596L,
-     60596L,60596L,60597L,60597L,60598L,60598L,60598L,60599L,
-     60599L,60599L,60600L,60600L,60601L,60601L,60601L,60602L,
-     60602L,60602L,60603L,60603L,60604L,60604L,60604L,60605L,
-     60605L,60606L,60606L,60606L,60607L,60607L,60607L,60608L,
-     60608L,60609L,60609L,60609L,60610L,60610L,60610L,60611L,
-     60611L,60612L,60612L,60612L,60613L,60613L,60614L,60614L,
-     60614L,60615L,60615L,60615L,60616L,60616L,60617L,60617L,
-     60617L,60618L,60618L,60618L,60619L,60619L,60620L,60620L,
-     60620L,60621L,60621L,60622L,60622L,60622L,60623L,60623L,
-     60623L,60624L,60624L,60625L,60625L,60625L,60626L,60626L,
-     60626L,60627L,60627L,60628L,60628L,60628L,60629L,60629L,
-     60629L,60630L,60630L,60631L,60631L,60631L,60632L,60632L,
-     60633L,60633L,60633L,60634L,60634L,60634L,60635L,60635L,
-     60636L,60636L,60636L,60637L,60637L,60637L,60638L,60638L,
-     60639L,60639L,60639L,60640L,60640L,60640L,60641L,60641L,
-     60642L,60642L,60642L,60643L,60643L,60644L,60644L,60644L,
-     60645L,60645L,60645L,60646L,60646L,60647L,60647L,60647L,
-     60648L,60648L,60648L,60649L,60649L,60650L,60650L,60650L,
-     60651L,60651L,60651L,60652L,60652L,60653L,60653L,60653L,
-     60654L,60654L,60655L,60655L,60655L,60656L,60656L,60656L,
-     60657L,60657L,60658L,60658L,60658L,60659L,60659L,60659L,
-     60660L,60660L,60661L,60661L,60661L,60662L,60662L,60662L,
-     60663L,60663L,60664L,60664L,60664L,60665L,60665L,60665L,
-     60666L,60666L,60667L,60667L,60667L,60668L,60668L,60669L,
-     60669L,60669L,60670L,60670L,60670L,60671L,60671L,60672L,
-     60672L,60672L,60673L,60673L,60673L,60674L,60674L,60675L,
-     60675L,60675L,60676L,60676L,60676L,60677L,60677L,60678L,
-     60678L,60678L,60679L,60679L,60679L,60680L,60680L,60681L,
-     60681L,60681L,60682L,60682L,60682L,60683L,60683L,60684L,
-     60684L,60684L,60685L,60685L,60686L,60686L,60686L,60687L,
-     60687L,60687L,60688L,60688L,60689L,60689L,60689L,60690L,
-     60690L,60690L,60691L,60691L,60692L,60692L,60692L,60693L,
-     60693L,60693L,60694L,60694L,60695L,60695L,60695L,60696L,
-     60696L,60696L,60697L,60697L,60698L,60698L,60698L,60699L,
-     60699L,60699L,60700L,60700L,60701L,60701L,60701L,60702L,
-     60702L,60702L,60703L,60703L,60704L,60704L,60704L,60705L,
-     60705L,60706L,60706L,60706L,60707L,60707L,60707L,60708L,
-     60708L,60709L,60709L,60709L,60710L,60710L,60710L,60711L,
-     60711L,60712L,60712L,60712L,60713L,60713L,60713L,60714L,
-     60714L,60715L,60715L,60715L,60716L,60716L,60716L,60717L,
-     60717L,60718L,60718L,60718L,60719L,60719L,60719L,60720L,
-     60720L,60721L,60721L,60721L,60722L,60722L,60722L,60723L,
-     60723L,60724L,60724L,60724L,60725L,60725L,60725L,60726L,
-     60726L,60727L,60727L,60727L,60728L,60728L,60728L,60729L,
-     60729L,60730L,60730L,60730L,60731L,60731L,60731L,60732L,
-     60732L,60733L,60733L,60733L,60734L,60734L,60734L,60735L,
-     60735L,60736L,60736L,60736L,60737L,60737L,60737L,60738L,
-     60738L,60739L,60739L,60739L,60740L,60740L,60740L,60741L,
-     60741L,60742L,60742L,60742L,60743L,60743L,60743L,60744L,
-     60744L,60745L,60745L,60745L,60746L,60746L,60746L,60747L,
-     60747L,60748L,60748L,60748L,60749L,60749L,60749L,60750L,
-     60750L,60751L,60751L,60751L,60752L,60752L,60752L,60753L,
-     60753L,60754L,60754L,60754L,60755L,60755L,60755L,60756L,
-     60756L,60757L,60757L,60757L,60758L,60758L,60758L,60759L,
-     60759L,60760L,60760L,60760L,60761L,60761L,60761L,60762L,
-     60762L,60763L,60763L,60763L,60764L,60764L,60764L,60765L,
-     60765L,60766L,60766L,60766L,60767L,60767L,60767L,60768L,
-     60768L,60769L,60769L,60769L,60770L,60770L,60770L,60771L,
-     60771L,60772L,60772L,60772L,60773L,60773L,60773L,60774L,
-     60774L,60775L,60775L,60775L,60776L,60776L,60776L,60777L,
-     60777L,60778L,60778L,60778L,60779L,60779L,60779L,60780L,
-     60780L,60781L,60781L,60781L,60782L,60782L,60782L,60783L,
-     60783L,60784L,60784L,60784L,60785L,60785L,60785L,60786L,
-     60786L,60787L,60787L,60787L,60788L,60788L,60788L,60789L,
-     60789L,60790L,60790L,60790L,60791L,60791L,60791L,60792L,
-     60792L,60793L,60793L,60793L,60794L,60794L,60794L,60795L,
-     60795L,60796L,60796L,60796L,60797L,60797L,60797L,60798L,
-     60798L,60799L,60799L,60799L,60800L,60800L,60800L,60801L,
-     60801L,60801L,60802L,60802L,60803L,60803L,60803L,60804L,
-     60804L,60804L,60805L,60805L,60806L,60806L,60806L,60807L,
-     60807L,60807L,60808L,60808L,60809L,60809L,60809L,60810L,
-     60810L,60810L,60811L,60811L,60812L,60812L,60812L,60813L,
-     60813L,60813L,60814L,60814L,60815L,60815L,60815L,60816L,
-     60816L,60816L,60817L,60817L,60818L,60818L,60818L,60819L,
-     60819L,60819L,60820L,60820L,60821L,60821L,60821L,60822L,
-     60822L,60822L,60823L,60823L,60823L,60824L,60824L,60825L,
-     60825L,60825L,60826L,60826L,60826L,60827L,60827L,60828L,
-     60828L,60828L,60829L,60829L,60829L,60830L,60830L,60831L,
-     60831L,60831L,60832L,60832L,60832L,60833L,60833L,60834L,
-     60834L,60834L,60835L,60835L,60835L,60836L,60836L,60837L,
-     60837L,60837L,60838L,60838L,60838L,60839L,60839L,60839L,
-     60840L,60840L,60841L,60841L,60841L,60842L,60842L,60842L,
-     60843L,60843L,60844L,60844L,60844L,60845L,60845L,60845L,
-     60846L,60846L,60847L,60847L,60847L,60848L,60848L,60848L,
-     60849L,60849L,60850L,60850L,60850L,60851L,60851L,60851L,
-     60852L,60852L,60852L,60853L,60853L,60854L,60854L,60854L,
-     60855L,60855L,60855L,60856L,60856L,60857L,60857L,60857L,
-     60858L,60858L,60858L,60859L,60859L,60860L,60860L,60860L,
-     60861L,60861L,60861L,60862L,60862L,60863L,60863L,60863L,
-     60864L,60864L,60864L,60865L,60865L,60865L,60866L,60866L,
-     60867L,60867L,60867L,60868L,60868L,60868L,60869L,60869L,
-     60870L,60870L,60870L,60871L,60871L,60871L,60872L,60872L,
-     60873L,60873L,60873L,60874L,60874L,60874L,60875L,60875L,
-     60875L,60876L,60876L,60877L,60877L,60877L,60878L,60878L,
-     60878L,60879L,60879L,60880L,60880L,60880L,60881L,60881L,
-     60881L,60882L,60882L,60883L,60883L,60883L,60884L,60884L,
-     60884L,60885L,60885L,60885L,60886L,60886L,60887L,60887L,
-     60887L,60888L,60888L,60888L,60889L,60889L,60890L,60890L,
-     60890L,60891L,60891L,60891L,60892L,60892L,60893L,60893L,
-     60893L,60894L,60894L,60894L,60895L,60895L,60895L,60896L,
-     60896L,60897L,60897L,60897L,60898L,60898L,60898L,60899L,
-     60899L,60900L,60900L,60900L,60901L,60901L,60901L,60902L,
-     60902L,60902L,60903L,60903L,60904L,60904L,60904L,60905L,
-     60905L,60905L,60906L,60906L,60907L,60907L,60907L,60908L,
-     60908L,60908L,60909L,60909L,60909L,60910L,60910L,60911L,
-     60911L,60911L,60912L,60912L,60912L,60913L,60913L,60914L,
-     60914L,60914L,60915L,60915L,60915L,60916L,60916L,60917L,
-     60917L,60917L,60918L,60918L,60918L,60919L,60919L,60919L,
-     60920L,60920L,60921L,60921L,60921L,60922L,60922L,60922L,
-     60923L,60923L,60924L,60924L,60924L,60925L,60925L,60925L,
-     60926L,60926L,60926L,60927L,60927L,60928L,60928L,60928L,
-     60929L,60929L,60929L,60930L,60930L,60931L,60931L,60931L,
-     60932L,60932L,60932L,60933L,60933L,60933L,60934L,60934L,
-     60935L,60935L,60935L,60936L,60936L,60936L,60937L,60937L,
-     60937L,60938L,60938L,60939L,60939L,60939L,60940L,60940L,
-     60940L,60941L,60941L,60942L,60942L,60942L,60943L,60943L,
-     60943L,60944L,60944L,60944L,60945L,60945L,60946L,60946L,
-     60946L,60947L,60947L,60947L,60948L,60948L,60949L,60949L,
-     60949L,60950L,60950L,60950L,60951L,60951L,60951L,60952L,
-     60952L,60953L,60953L,60953L,60954L,60954L,60954L,60955L,
-     60955L,60956L,60956L,60956L,60957L,60957L,60957L,60958L,
-     60958L,60958L,60959L,60959L,60960L,60960L,60960L,60961L,
-     60961L,60961L,60962L,60962L,60962L,60963L,60963L,60964L,
-     60964L,60964L,60965L,60965L,60965L,60966L,60966L,60967L,
-     60967L,60967L,60968L,60968L,60968L,60969L,60969L,60969L,
-     60970L,60970L,60971L,60971L,60971L,60972L,60972L,60972L,
-     60973L,60973L,60973L,60974L,60974L,60975L,60975L,60975L,
-     60976L,60976L,60976L,60977L,60977L,60978L,60978L,60978L,
-     60979L,60979L,60979L,60980L,60980L,60980L,60981L,60981L,
-     60982L,60982L,60982L,60983L,60983L,60983L,60984L,60984L,
-     60984L,60985L,60985L,60986L,60986L,60986L,60987L,60987L,
-     60987L,60988L,60988L,60989L,60989L,60989L,60990L,60990L,
-     60990L,60991L,60991L,60991L,60992L,60992L,60993L,60993L,
-     60993L,60994L,60994L,60994L,60995L,60995L,60995L,60996L,
-     60996L,60997L,60997L,60997L,60998L,60998L,60998L,60999L,
-     60999L,60999L,61000L,61000L,61001L,61001L,61001L,61002L,
-     61002L,61002L,61003L,61003L,61004L,61004L,61004L,61005L,
-     61005L,61005L,61006L,61006L,61006L,61007L,61007L,61008L,
-     61008L,61008L,61009L,61009L,61009L,61010L,61010L,61010L,
-     61011L,61011L,61012L,61012L,61012L,61013L,61013L,61013L,
-     61014L,61014L,61014L,61015L,61015L,61016L,61016L,61016L,
-     61017L,61017L,61017L,61018L,61018L,61018L,61019L,61019L,
-     61020L,61020L,61020L,61021L,61021L,61021L,61022L,61022L,
-     61022L,61023L,61023L,61024L,61024L,61024L,61025L,61025L,
-     61025L,61026L,61026L,61026L,61027L,61027L,61028L,61028L,
-     61028L,61029L,61029L,61029L,61030L,61030L,61031L,61031L,
-     61031L,61032L,61032L,61032L,61033L,61033L,61033L,61034L,
-     61034L,61035L,61035L,61035L,61036L,61036L,61036L,61037L,
-     61037L,61037L,61038L,61038L,61039L,61039L,61039L,61040L,
-     61040L,61040L,61041L,61041L,61041L,61042L,61042L,61043L,
-     61043L,61043L,61044L,61044L,61044L,61045L,61045L,61045L,
-     61046L,61046L,61047L,61047L,61047L,61048L,61048L,61048L,
-     61049L,61049L,61049L,61050L,61050L,61051L,61051L,61051L,
-     61052L,61052L,61052L,61053L,61053L,61053L,61054L,61054L,
-     61055L,61055L,61055L,61056L,61056L,61056L,61057L,61057L,
-     61057L,61058L,61058L,61059L,61059L,61059L,61060L,61060L,
-     61060L,61061L,61061L,61061L,61062L,61062L,61063L,61063L,
-     61063L,61064L,61064L,61064L,61065L,61065L,61065L,61066L,
-     61066L,61067L,61067L,61067L,61068L,61068L,61068L,61069L,
-     61069L,61069L,61070L,61070L,61070L,61071L,61071L,61072L,
-     61072L,61072L,61073L,61073L,61073L,61074L,61074L,61074L,
-     61075L,61075L,61076L,61076L,61076L,61077L,61077L,61077L,
-     61078L,61078L,61078L,61079L,61079L,61080L,61080L,61080L,
-     61081L,61081L,61081L,61082L,61082L,61082L,61083L,61083L,
-     61084L,61084L,61084L,61085L,61085L,61085L,61086L,61086L,
-     61086L,61087L,61087L,61088L,61088L,61088L,61089L,61089L,
-     61089L,61090L,61090L,61090L,61091L,61091L,61092L,61092L,
-     61092L,61093L,61093L,61093L,61094L,61094L,61094L,61095L,
-     61095L,61095L,61096L,61096L,61097L,61097L,61097L,61098L,
-     61098L,61098L,61099L,61099L,61099L,61100L,61100L,61101L,
-     61101L,61101L,61102L,61102L,61102L,61103L,61103L,61103L,
-     61104L,61104L,61105L,61105L,61105L,61106L,61106L,61106L,
-     61107L,61107L,61107L,61108L,61108L,61109L,61109L,61109L,
-     61110L,61110L,61110L,61111L,61111L,61111L,61112L,61112L,
-     61112L,61113L,61113L,61114L,61114L,61114L,61115L,61115L,
-     61115L,61116L,61116L,61116L,61117L,61117L,61118L,61118L,
-     61118L,61119L,61119L,61119L,61120L,61120L,61120L,61121L,
-     61121L,61122L,61122L,61122L,61123L,61123L,61123L,61124L,
-     61124L,61124L,61125L,61125L,61125L,61126L,61126L,61127L,
-     61127L,61127L,61128L,61128L,61128L,61129L,61129L,61129L,
-     61130L,61130L,61131L,61131L,61131L,61132L,61132L,61132L,
-     61133L,61133L,61133L,61134L,61134L,61134L,61135L,61135L,
-     61136L,61136L,61136L,61137L,61137L,61137L,61138L,61138L,
-     61138L,61139L,61139L,61140L,61140L,61140L,61141L,61141L,
-     61141L,61142L,61142L,61142L,61143L,61143L,61143L,61144L,
-     61144L,61145L,61145L,61145L,61146L,61146L,61146L,61147L,
-     61147L,61147L,61148L,61148L,61149L,61149L,61149L,61150L,
-     61150L,61150L,61151L,61151L,61151L,61152L,61152L,61152L,
-     61153L,61153L,61154L,61154L,61154L,61155L,61155L,61155L,
-     61156L,61156L,61156L,61157L,61157L,61158L,61158L,61158L,
-     61159L,61159L,61159L,61160L,61160L,61160L,61161L,61161L,
-     61161L,61162L,61162L,61163L,61163L,61163L,61164L,61164L,
-     61164L,61165L,61165L,61165L,61166L,61166L,61166L,61167L,
-     61167L,61168L,61168L,61168L,61169L,61169L,61169L,61170L,
-     61170L,61170L,61171L,61171L,61172L,61172L,61172L,61173L,
-     61173L,61173L,61174L,61174L,61174L,61175L,61175L,61175L,
-     61176L,61176L,61177L,61177L,61177L,61178L,61178L,61178L,
-     61179L,61179L,61179L,61180L,61180L,61180L,61181L,61181L,
-     61182L,61182L,61182L,61183L,61183L,61183L,61184L,61184L,
-     61184L,61185L,61185L,61186L,61186L,61186L,61187L,61187L,
-     61187L,61188L,61188L,61188L,61189L,61189L,61189L,61190L,
-     61190L,61191L,61191L,61191L,61192L,61192L,61192L,61193L,
-     61193L,61193L,61194L,61194L,61194L,61195L,61195L,61196L,
-     61196L,61196L,61197L,61197L,61197L,61198L,61198L,61198L,
-     61199L,61199L,61199L,61200L,61200L,61201L,61201L,61201L,
-     61202L,61202L,61202L,61203L,61203L,61203L,61204L,61204L,
-     61204L,61205L,61205L,61206L,61206L,61206L,61207L,61207L,
-     61207L,61208L,61208L,61208L,61209L,61209L,61209L,61210L,
-     61210L,61211L,61211L,61211L,61212L,61212L,61212L,61213L,
-     61213L,61213L,61214L,61214L,61214L,61215L,61215L,61216L,
-     61216L,61216L,61217L,61217L,61217L,61218L,61218L,61218L,
-     61219L,61219L,61219L,61220L,61220L,61221L,61221L,61221L,
-     61222L,61222L,61222L,61223L,61223L,61223L,61224L,61224L,
-     61224L,61225L,61225L,61226L,61226L,61226L,61227L,61227L,
-     61227L,61228L,61228L,61228L,61229L,61229L,61229L,61230L,
-     61230L,61231L,61231L,61231L,61232L,61232L,61232L,61233L,
-     61233L,61233L,61234L,61234L,61234L,61235L,61235L,61236L,
-     61236L,61236L,61237L,61237L,61237L,61238L,61238L,61238L,
-     61239L,61239L,61239L,61240L,61240L,61241L,61241L,61241L,
-     61242L,61242L,61242L,61243L,61243L,61243L,61244L,61244L,
-     61244L,61245L,61245L,61245L,61246L,61246L,61247L,61247L,
-     61247L,61248L,61248L,61248L,61249L,61249L,61249L,61250L,
-     61250L,61250L,61251L,61251L,61252L,61252L,61252L,61253L,
-     61253L,61253L,61254L,61254L,61254L,61255L,61255L,61255L,
-     61256L,61256L,61257L,61257L,61257L,61258L,61258L,61258L,
-     61259L,61259L,61259L,61260L,61260L,61260L,61261L,61261L,
-     61261L,61262L,61262L,61263L,61263L,61263L,61264L,61264L,
-     61264L,61265L,61265L,61265L,61266L,61266L,61266L,61267L,
-     61267L,61268L,61268L,61268L,61269L,61269L,61269L,61270L,
-     61270L,61270L,61271L,61271L,61271L,61272L,61272L,61272L,
-     61273L,61273L,61274L,61274L,61274L,61275L,61275L,61275L,
-     61276L,61276L,61276L,61277L,61277L,61277L,61278L,61278L,
-     61279L,61279L,61279L,61280L,61280L,61280L,61281L,61281L,
-     61281L,61282L,61282L,61282L,61283L,61283L,61283L,61284L,
-     61284L,61285L,61285L,61285L,61286L,61286L,61286L,61287L,
-     61287L,61287L,61288L,61288L,61288L,61289L,61289L,61290L,
-     61290L,61290L,61291L,61291L,61291L,61292L,61292L,61292L,
-     61293L,61293L,61293L,61294L,61294L,61294L,61295L,61295L,
-     61296L,61296L,61296L,61297L,61297L,61297L,61298L,61298L,
-     61298L,61299L,61299L,61299L,61300L,61300L,61300L,61301L,
-     61301L,61302L,61302L,61302L,61303L,61303L,61303L,61304L,
-     61304L,61304L,61305L,61305L,61305L,61306L,61306L,61306L,
-     61307L,61307L,61308L,61308L,61308L,61309L,61309L,61309L,
-     61310L,61310L,61310L,61311L,61311L,61311L,61312L,61312L,
-     61312L,61313L,61313L,61314L,61314L,61314L,61315L,61315L,
-     61315L,61316L,61316L,61316L,61317L,61317L,61317L,61318L,
-     61318L,61318L,61319L,61319L,61320L,61320L,61320L,61321L,
-     61321L,61321L,61322L,61322L,61322L,61323L,61323L,61323L,
-     61324L,61324L,61324L,61325L,61325L,61326L,61326L,61326L,
-     61327L,61327L,61327L,61328L,61328L,61328L,61329L,61329L,
-     61329L,61330L,61330L,61330L,61331L,61331L,61332L,61332L,
-     61332L,61333L,61333L,61333L,61334L,61334L,61334L,61335L,
-     61335L,61335L,61336L,61336L,61336L,61337L,61337L,61338L,
-     61338L,61338L,61339L,61339L,61339L,61340L,61340L,61340L,
-     61341L,61341L,61341L,61342L,61342L,61342L,61343L,61343L,
-     61344L,61344L,61344L,61345L,61345L,61345L,61346L,61346L,
-     61346L,61347L,61347L,61347L,61348L,61348L,61348L,61349L,
-     61349L,61349L,61350L,61350L,61351L,61351L,61351L,61352L,
-     61352L,61352L,61353L,61353L,61353L,61354L,61354L,61354L,
-     61355L,61355L,61355L,61356L,61356L,61357L,61357L,61357L,
-     61358L,61358L,61358L,61359L,61359L,61359L,61360L,61360L,
-     61360L,61361L,61361L,61361L,61362L,61362L,61362L,61363L,
-     61363L,61364L,61364L,61364L,61365L,61365L,61365L,61366L,
-     61366L,61366L,61367L,61367L,61367L,61368L,61368L,61368L,
-     61369L,61369L,61370L,61370L,61370L,61371L,61371L,61371L,
-     61372L,61372L,61372L,61373L,61373L,61373L,61374L,61374L,
-     61374L,61375L,61375L,61375L,61376L,61376L,61377L,61377L,
-     61377L,61378L,61378L,61378L,61379L,61379L,61379L,61380L,
-     61380L,61380L,61381L,61381L,61381L,61382L,61382L,61382L,
-     61383L,61383L,61384L,61384L,61384L,61385L,61385L,61385L,
-     61386L,61386L,61386L,61387L,61387L,61387L,61388L,61388L,
-     61388L,61389L,61389L,61389L,61390L,61390L,61391L,61391L,
-     61391L,61392L,61392L,61392L,61393L,61393L,61393L,61394L,
-     61394L,61394L,61395L,61395L,61395L,61396L,61396L,61396L,
-     61397L,61397L,61398L,61398L,61398L,61399L,61399L,61399L,
-     61400L,61400L,61400L,61401L,61401L,61401L,61402L,61402L,
-     61402L,61403L,61403L,61403L,61404L,61404L,61405L,61405L,
-     61405L,61406L,61406L,61406L,61407L,61407L,61407L,61408L,
-     61408L,61408L,61409L,61409L,61409L,61410L,61410L,61410L,
-     61411L,61411L,61412L,61412L,61412L,61413L,61413L,61413L,
-     61414L,61414L,61414L,61415L,61415L,61415L,61416L,61416L,
-     61416L,61417L,61417L,61417L,61418L,61418L,61418L,61419L,
-     61419L,61420L,61420L,61420L,61421L,61421L,61421L,61422L,
-     61422L,61422L,61423L,61423L,61423L,61424L,61424L,61424L,
-     61425L,61425L,61425L,61426L,61426L,61427L,61427L,61427L,
-     61428L,61428L,61428L,61429L,61429L,61429L,61430L,61430L,
-     61430L,61431L,61431L,61431L,61432L,61432L,61432L,61433L,
-     61433L,61433L,61434L,61434L,61435L,61435L,61435L,61436L,
-     61436L,61436L,61437L,61437L,61437L,61438L,61438L,61438L,
-     61439L,61439L,61439L,61440L,61440L,61440L,61441L,61441L,
-     61441L,61442L,61442L,61443L,61443L,61443L,61444L,61444L,
-     61444L,61445L,61445L,61445L,61446L,61446L,61446L,61447L,
-     61447L,61447L,61448L,61448L,61448L,61449L,61449L,61449L,
-     61450L,61450L,61451L,61451L,61451L,61452L,61452L,61452L,
-     61453L,61453L,61453L,61454L,61454L,61454L,61455L,61455L,
-     61455L,61456L,61456L,61456L,61457L,61457L,61457L,61458L,
-     61458L,61459L,61459L,61459L,61460L,61460L,61460L,61461L,
-     61461L,61461L,61462L,61462L,61462L,61463L,61463L,61463L,
-     61464L,61464L,61464L,61465L,61465L,61465L,61466L,61466L,
-     61467L,61467L,61467L,61468L,61468L,61468L,61469L,61469L,
-     61469L,61470L,61470L,61470L,61471L,61471L,61471L,61472L,
-     61472L,61472L,61473L,61473L,61473L,61474L,61474L,61474L,
-     61475L,61475L,61476L,61476L,61476L,61477L,61477L,61477L,
-     61478L,61478L,61478L,61479L,61479L,61479L,61480L,61480L,
-     61480L,61481L,61481L,61481L,61482L,61482L,61482L,61483L,
-     61483L,61483L,61484L,61484L,61485L,61485L,61485L,61486L,
-     61486L,61486L,61487L,61487L,61487L,61488L,61488L,61488L,
-     61489L,61489L,61489L,61490L,61490L,61490L,61491L,61491L,
-     61491L,61492L,61492L,61492L,61493L,61493L,61494L,61494L,
-     61494L,61495L,61495L,61495L,61496L,61496L,61496L,61497L,
-     61497L,61497L,61498L,61498L,61498L,61499L,61499L,61499L,
-     61500L,61500L,61500L,61501L,61501L,61501L,61502L,61502L,
-     61503L,61503L,61503L,61504L,61504L,61504L,61505L,61505L,
-     61505L,61506L,61506L,61506L,61507L,61507L,61507L,61508L,
-     61508L,61508L,61509L,61509L,61509L,61510L,61510L,61510L,
-     61511L,61511L,61511L,61512L,61512L,61513L,61513L,61513L,
-     61514L,61514L,61514L,61515L,61515L,61515L,61516L,61516L,
-     61516L,61517L,61517L,61517L,61518L,61518L,61518L,61519L,
-     61519L,61519L,61520L,61520L,61520L,61521L,61521L,61521L,
-     61522L,61522L,61523L,61523L,61523L,61524L,61524L,61524L,
-     61525L,61525L,61525L,61526L,61526L,61526L,61527L,61527L,
-     61527L,61528L,61528L,61528L,61529L,61529L,61529L,61530L,
-     61530L,61530L,61531L,61531L,61531L,61532L,61532L,61532L,
-     61533L,61533L,61534L,61534L,61534L,61535L,61535L,61535L,
-     61536L,61536L,61536L,61537L,61537L,61537L,61538L,61538L,
-     61538L,61539L,61539L,61539L,61540L,61540L,61540L,61541L,
-     61541L,61541L,61542L,61542L,61542L,61543L,61543L,61544L,
-     61544L,61544L,61545L,61545L,61545L,61546L,61546L,61546L,
-     61547L,61547L,61547L,61548L,61548L,61548L,61549L,61549L,
-     61549L,61550L,61550L,61550L,61551L,61551L,61551L,61552L,
-     61552L,61552L,61553L,61553L,61553L,61554L,61554L,61554L,
-     61555L,61555L,61556L,61556L,61556L,61557L,61557L,61557L,
-     61558L,61558L,61558L,61559L,61559L,61559L,61560L,61560L,
-     61560L,61561L,61561L,61561L,61562L,61562L,61562L,61563L,
-     61563L,61563L,61564L,61564L,61564L,61565L,61565L,61565L,
-     61566L,61566L,61566L,61567L,61567L,61568L,61568L,61568L,
-     61569L,61569L,61569L,61570L,61570L,61570L,61571L,61571L,
-     61571L,61572L,61572L,61572L,61573L,61573L,61573L,61574L,
-     61574L,61574L,61575L,61575L,61575L,61576L,61576L,61576L,
-     61577L,61577L,61577L,61578L,61578L,61578L,61579L,61579L,
-     61580L,61580L,61580L,61581L,61581L,61581L,61582L,61582L,
-     61582L,61583L,61583L,61583L,61584L,61584L,61584L,61585L,
-     61585L,61585L,61586L,61586L,61586L,61587L,61587L,61587L,
-     61588L,61588L,61588L,61589L,61589L,61589L,61590L,61590L,
-     61590L,61591L,61591L,61591L,61592L,61592L,61593L,61593L,
-     61593L,61594L,61594L,61594L,61595L,61595L,61595L,61596L,
-     61596L,61596L,61597L,61597L,61597L,61598L,61598L,61598L,
-     61599L,61599L,61599L,61600L,61600L,61600L,61601L,61601L,
-     61601L,61602L,61602L,61602L,61603L,61603L,61603L,61604L,
-     61604L,61604L,61605L,61605L,61605L,61606L,61606L,61606L,
-     61607L,61607L,61608L,61608L,61608L,61609L,61609L,61609L,
-     61610L,61610L,61610L,61611L,61611L,61611L,61612L,61612L,
-     61612L,61613L,61613L,61613L,61614L,61614L,61614L,61615L,
-     61615L,61615L,61616L,61616L,61616L,61617L,61617L,61617L,
-     61618L,61618L,61618L,61619L,61619L,61619L,61620L,61620L,
-     61620L,61621L,61621L,61621L,61622L,61622L,61623L,61623L,
-     61623L,61624L,61624L,61624L,61625L,61625L,61625L,61626L,
-     61626L,61626L,61627L,61627L,61627L,61628L,61628L,61628L,
-     61629L,61629L,61629L,61630L,61630L,61630L,61631L,61631L,
-     61631L,61632L,61632L,61632L,61633L,61633L,61633L,61634L,
-     61634L,61634L,61635L,61635L,61635L,61636L,61636L,61636L,
-     61637L,61637L,61637L,61638L,61638L,61638L,61639L,61639L,
-     61640L,61640L,61640L,61641L,61641L,61641L,61642L,61642L,
-     61642L,61643L,61643L,61643L,61644L,61644L,61644L,61645L,
-     61645L,61645L,61646L,61646L,61646L,61647L,61647L,61647L,
-     61648L,61648L,61648L,61649L,61649L,61649L,61650L,61650L,
-     61650L,61651L,61651L,61651L,61652L,61652L,61652L,61653L,
-     61653L,61653L,61654L,61654L,61654L,61655L,61655L,61655L,
-     61656L,61656L,61656L,61657L,61657L,61657L,61658L,61658L,
-     61659L,61659L,61659L,61660L,61660L,61660L,61661L,61661L,
-     61661L,61662L,61662L,61662L,61663L,61663L,61663L,61664L,
-     61664L,61664L,61665L,61665L,61665L,61666L,61666L,61666L,
-     61667L,61667L,61667L,61668L,61668L,61668L,61669L,61669L,
-     61669L,61670L,61670L,61670L,61671L,61671L,61671L,61672L,
-     61672L,61672L,61673L,61673L,61673L,61674L,61674L,61674L,
-     61675L,61675L,61675L,61676L,61676L,61676L,61677L,61677L,
-     61677L,61678L,61678L,61678L,61679L,61679L,61679L,61680L,
-     61680L,61681L,61681L,61681L,61682L,61682L,61682L,61683L,
-     61683L,61683L,61684L,61684L,61684L,61685L,61685L,61685L,
-     61686L,61686L,61686L,61687L,61687L,61687L,61688L,61688L,
-     61688L,61689L,61689L,61689L,61690L,61690L,61690L,61691L,
-     61691L,61691L,61692L,61692L,61692L,61693L,61693L,61693L,
-     61694L,61694L,61694L,61695L,61695L,61695L,61696L,61696L,
-     61696L,61697L,61697L,61697L,61698L,61698L,61698L,61699L,
-     61699L,61699L,61700L,61700L,61700L,61701L,61701L,61701L,
-     61702L,61702L,61702L,61703L,61703L,61703L,61704L,61704L,
-     61704L,61705L,61705L,61705L,61706L,61706L,61706L,61707L,
-     61707L,61707L,61708L,61708L,61708L,61709L,61709L,61710L,
-     61710L,61710L,61711L,61711L,61711L,61712L,61712L,61712L,
-     61713L,61713L,61713L,61714L,61714L,61714L,61715L,61715L,
-     61715L,61716L,61716L,61716L,61717L,61717L,61717L,61718L,
-     61718L,61718L,61719L,61719L,61719L,61720L,61720L,61720L,
-     61721L,61721L,61721L,61722L,61722L,61722L,61723L,61723L,
-     61723L,61724L,61724L,61724L,61725L,61725L,61725L,61726L,
-     61726L,61726L,61727L,61727L,61727L,61728L,61728L,61728L,
-     61729L,61729L,61729L,61730L,61730L,61730L,61731L,61731L,
-     61731L,61732L,61732L,61732L,61733L,61733L,61733L,61734L,
-     61734L,61734L,61735L,61735L,61735L,61736L,61736L,61736L,
-     61737L,61737L,61737L,61738L,61738L,61738L,61739L,61739L,
-     61739L,61740L,61740L,61740L,61741L,61741L,61741L,61742L,
-     61742L,61742L,61743L,61743L,61743L,61744L,61744L,61744L,
-     61745L,61745L,61745L,61746L,61746L,61746L,61747L,61747L,
-     61747L,61748L,61748L,61748L,61749L,61749L,61749L,61750L,
-     61750L,61750L,61751L,61751L,61751L,61752L,61752L,61752L,
-     61753L,61753L,61753L,61754L,61754L,61754L,61755L,61755L,
-     61756L,61756L,61756L,61757L,61757L,61757L,61758L,61758L,
-     61758L,61759L,61759L,61759L,61760L,61760L,61760L,61761L,
-     61761L,61761L,61762L,61762L,61762L,61763L,61763L,61763L,
-     61764L,61764L,61764L,61765L,61765L,61765L,61766L,61766L,
-     61766L,61767L,61767L,61767L,61768L,61768L,61768L,61769L,
-     61769L,61769L,61770L,61770L,61770L,61771L,61771L,61771L,
-     61772L,61772L,61772L,61773L,61773L,61773L,61774L,61774L,
-     61774L,61775L,61775L,61775L,61776L,61776L,61776L,61777L,
-     61777L,61777L,61778L,61778L,61778L,61779L,61779L,61779L,
-     61780L,61780L,61780L,61781L,61781L,61781L,61782L,61782L,
-     61782L,61783L,61783L,61783L,61784L,61784L,61784L,61785L,
-     61785L,61785L,61786L,61786L,61786L,61787L,61787L,61787L,
-     61788L,61788L,61788L,61789L,61789L,61789L,61790L,61790L,
-     61790L,61791L,61791L,61791L,61792L,61792L,61792L,61793L,
-     61793L,61793L,61794L,61794L,61794L,61795L,61795L,61795L,
-     61796L,61796L,61796L,61797L,61797L,61797L,61798L,61798L,
-     61798L,61799L,61799L,61799L,61800L,61800L,61800L,61801L,
-     61801L,61801L,61802L,61802L,61802L,61803L,61803L,61803L,
-     61804L,61804L,61804L,61805L,61805L,61805L,61806L,61806L,
-     61806L,61807L,61807L,61807L,61808L,61808L,61808L,61809L,
-     61809L,61809L,61810L,61810L,61810L,61811L,61811L,61811L,
-     61812L,61812L,61812L,61813L,61813L,61813L,61814L,61814L,
-     61814L,61815L,61815L,61815L,61816L,61816L,61816L,61817L,
-     61817L,61817L,61818L,61818L,61818L,61819L,61819L,61819L,
-     61819L,61820L,61820L,61820L,61821L,61821L,61821L,61822L,
-     61822L,61822L,61823L,61823L,61823L,61824L,61824L,61824L,
-     61825L,61825L,61825L,61826L,61826L,61826L,61827L,61827L,
-     61827L,61828L,61828L,61828L,61829L,61829L,61829L,61830L,
-     61830L,61830L,61831L,61831L,61831L,61832L,61832L,61832L,
-     61833L,61833L,61833L,61834L,61834L,61834L,61835L,61835L,
-     61835L,61836L,61836L,61836L,61837L,61837L,61837L,61838L,
-     61838L,61838L,61839L,61839L,61839L,61840L,61840L,61840L,
-     61841L,61841L,61841L,61842L,61842L,61842L,61843L,61843L,
-     61843L,61844L,61844L,61844L,61845L,61845L,61845L,61846L,
-     61846L,61846L,61847L,61847L,61847L,61848L,61848L,61848L,
-     61849L,61849L,61849L,61850L,61850L,61850L,61851L,61851L,
-     61851L,61852L,61852L,61852L,61853L,61853L,61853L,61854L,
-     61854L,61854L,61855L,61855L,61855L,61856L,61856L,61856L,
-     61857L,61857L,61857L,61858L,61858L,61858L,61859L,61859L,
-     61859L,61860L,61860L,61860L,61861L,61861L,61861L,61862L,
-     61862L,61862L,61863L,61863L,61863L,61864L,61864L,61864L,
-     61865L,61865L,61865L,61866L,61866L,61866L,61866L,61867L,
-     61867L,61867L,61868L,61868L,61868L,61869L,61869L,61869L,
-     61870L,61870L,61870L,61871L,61871L,61871L,61872L,61872L,
-     61872L,61873L,61873L,61873L,61874L,61874L,61874L,61875L,
-     61875L,61875L,61876L,61876L,61876L,61877L,61877L,61877L,
-     61878L,61878L,61878L,61879L,61879L,61879L,61880L,61880L,
-     61880L,61881L,61881L,61881L,61882L,61882L,61882L,61883L,
-     61883L,61883L,61884L,61884L,61884L,61885L,61885L,61885L,
-     61886L,61886L,61886L,61887L,61887L,61887L,61888L,61888L,
-     61888L,61889L,61889L,61889L,61890L,61890L,61890L,61891L,
-     61891L,61891L,61892L,61892L,61892L,61893L,61893L,61893L,
-     61893L,61894L,61894L,61894L,61895L,61895L,61895L,61896L,
-     61896L,61896L,61897L,61897L,61897L,61898L,61898L,61898L,
-     61899L,61899L,61899L,61900L,61900L,61900L,61901L,61901L,
-     61901L,61902L,61902L,61902L,61903L,61903L,61903L,61904L,
-     61904L,61904L,61905L,61905L,61905L,61906L,61906L,61906L,
-     61907L,61907L,61907L,61908L,61908L,61908L,61909L,61909L,
-     61909L,61910L,61910L,61910L,61911L,61911L,61911L,61912L,
-     61912L,61912L,61913L,61913L,61913L,61914L,61914L,61914L,
-     61915L,61915L,61915L,61915L,61916L,61916L,61916L,61917L,
-     61917L,61917L,61918L,61918L,61918L,61919L,61919L,61919L,
-     61920L,61920L,61920L,61921L,61921L,61921L,61922L,61922L,
-     61922L,61923L,61923L,61923L,61924L,61924L,61924L,61925L,
-     61925L,61925L,61926L,61926L,61926L,61927L,61927L,61927L,
-     61928L,61928L,61928L,61929L,61929L,61929L,61930L,61930L,
-     61930L,61931L,61931L,61931L,61932L,61932L,61932L,61933L,
-     61933L,61933L,61933L,61934L,61934L,61934L,61935L,61935L,
-     61935L,61936L,61936L,61936L,61937L,61937L,61937L,61938L,
-     61938L,61938L,61939L,61939L,61939L,61940L,61940L,61940L,
-     61941L,61941L,61941L,61942L,61942L,61942L,61943L,61943L,
-     61943L,61944L,61944L,61944L,61945L,61945L,61945L,61946L,
-     61946L,61946L,61947L,61947L,61947L,61948L,61948L,61948L,
-     61949L,61949L,61949L,61949L,61950L,61950L,61950L,61951L,
-     61951L,61951L,61952L,61952L,61952L,61953L,61953L,61953L,
-     61954L,61954L,61954L,61955L,61955L,61955L,61956L,61956L,
-     61956L,61957L,61957L,61957L,61958L,61958L,61958L,61959L,
-     61959L,61959L,61960L,61960L,61960L,61961L,61961L,61961L,
-     61962L,61962L,61962L,61963L,61963L,61963L,61964L,61964L,
-     61964L,61964L,61965L,61965L,61965L,61966L,61966L,61966L,
-     61967L,61967L,61967L,61968L,61968L,61968L,61969L,61969L,
-     61969L,61970L,61970L,61970L,61971L,61971L,61971L,61972L,
-     61972L,61972L,61973L,61973L,61973L,61974L,61974L,61974L,
-     61975L,61975L,61975L,61976L,61976L,61976L,61977L,61977L,
-     61977L,61978L,61978L,61978L,61978L,61979L,61979L,61979L,
-     61980L,61980L,61980L,61981L,61981L,61981L,61982L,61982L,
-     61982L,61983L,61983L,61983L,61984L,61984L,61984L,61985L,
-     61985L,61985L,61986L,61986L,61986L,61987L,61987L,61987L,
-     61988L,61988L,61988L,61989L,61989L,61989L,61990L,61990L,
-     61990L,61990L,61991L,61991L,61991L,61992L,61992L,61992L,
-     61993L,61993L,61993L,61994L,61994L,61994L,61995L,61995L,
-     61995L,61996L,61996L,61996L,61997L,61997L,61997L,61998L,
-     61998L,61998L,61999L,61999L,61999L,62000L,62000L,62000L,
-     62001L,62001L,62001L,62002L,62002L,62002L,62002L,62003L,
-     62003L,62003L,62004L,62004L,62004L,62005L,62005L,62005L,
-     62006L,62006L,62006L,62007L,62007L,62007L,62008L,62008L,
-     62008L,62009L,62009L,62009L,62010L,62010L,62010L,62011L,
-     62011L,62011L,62012L,62012L,62012L,62013L,62013L,62013L,
-     62013L,62014L,62014L,62014L,62015L,62015L,62015L,62016L,
-     62016L,62016L,62017L,62017L,62017L,62018L,62018L,62018L,
-     62019L,62019L,62019L,62020L,62020L,62020L,62021L,62021L,
-     62021L,62022L,62022L,62022L,62023L,62023L,62023L,62024L,
-     62024L,62024L,62024L,62025L,62025L,62025L,62026L,62026L,
-     62026L,62027L,62027L,62027L,62028L,62028L,62028L,62029L,
-     62029L,62029L,62030L,62030L,62030L,62031L,62031L,62031L,
-     62032L,62032L,62032L,62033L,62033L,62033L,62034L,62034L,
-     62034L,62034L,62035L,62035L,62035L,62036L,62036L,62036L,
-     62037L,62037L,62037L,62038L,62038L,62038L,62039L,62039L,
-     62039L,62040L,62040L,62040L,62041L,62041L,62041L,62042L,
-     62042L,62042L,62043L,62043L,62043L,62044L,62044L,62044L,
-     62044L,62045L,62045L,62045L,62046L,62046L,62046L,62047L,
-     62047L,62047L,62048L,62048L,62048L,62049L,62049L,62049L,
-     62050L,62050L,62050L,62051L,62051L,62051L,62052L,62052L,
-     62052L,62053L,62053L,62053L,62053L,62054L,62054L,62054L,
-     62055L,62055L,62055L,62056L,62056L,62056L,62057L,62057L,
-     62057L,62058L,62058L,62058L,62059L,62059L,62059L,62060L,
-     62060L,62060L,62061L,62061L,62061L,62062L,62062L,62062L,
-     62062L,62063L,62063L,62063L,62064L,62064L,62064L,62065L,
-     62065L,62065L,62066L,62066L,62066L,62067L,62067L,62067L,
-     62068L,62068L,62068L,62069L,62069L,62069L,62070L,62070L,
-     62070L,62071L,62071L,62071L,62071L,62072L,62072L,62072L,
-     62073L,62073L,62073L,62074L,62074L,62074L,62075L,62075L,
-     62075L,62076L,62076L,62076L,62077L,62077L,62077L,62078L,
-     62078L,62078L,62079L,62079L,62079L,62079L,62080L,62080L,
-     62080L,62081L,62081L,62081L,62082L,62082L,62082L,62083L,
-     62083L,62083L,62084L,62084L,62084L,62085L,62085L,62085L,
-     62086L,62086L,62086L,62087L,62087L,62087L,62087L,62088L,
-     62088L,62088L,62089L,62089L,62089L,62090L,62090L,62090L,
-     62091L,62091L,62091L,62092L,62092L,62092L,62093L,62093L,
-     62093L,62094L,62094L,62094L,62095L,62095L,62095L,62095L,
-     62096L,62096L,62096L,62097L,62097L,62097L,62098L,62098L,
-     62098L,62099L,62099L,62099L,62100L,62100L,62100L,62101L,
-     62101L,62101L,62102L,62102L,62102L,62103L,62103L,62103L,
-     62103L,62104L,62104L,62104L,62105L,62105L,62105L,62106L,
-     62106L,62106L,62107L,62107L,62107L,62108L,62108L,62108L,
-     62109L,62109L,62109L,62110L,62110L,62110L,62111L,62111L,
-     62111L,62111L,62112L,62112L,62112L,62113L,62113L,62113L,
-     62114L,62114L,62114L,62115L,62115L,62115L,62116L,62116L,
-     62116L,62117L,62117L,62117L,62118L,62118L,62118L,62118L,
-     62119L,62119L,62119L,62120L,62120L,62120L,62121L,62121L,
-     62121L,62122L,62122L,62122L,62123L,62123L,62123L,62124L,
-     62124L,62124L,62125L,62125L,62125L,62125L,62126L,62126L,
-     62126L,62127L,62127L,62127L,62128L,62128L,62128L,62129L,
-     62129L,62129L,62130L,62130L,62130L,62131L,62131L,62131L,
-     62132L,62132L,62132L,62132L,62133L,62133L,62133L,62134L,
-     62134L,62134L,62135L,62135L,62135L,62136L,62136L,62136L,
-     62137L,62137L,62137L,62138L,62138L,62138L,62139L,62139L,
-     62139L,62139L,62140L,62140L,62140L,62141L,62141L,62141L,
-     62142L,62142L,62142L,62143L,62143L,62143L,62144L,62144L,
-     62144L,62145L,62145L,62145L,62146L,62146L,62146L,62146L,
-     62147L,62147L,62147L,62148L,62148L,62148L,62149L,62149L,
-     62149L,62150L,62150L,62150L,62151L,62151L,62151L,62152L,
-     62152L,62152L,62152L,62153L,62153L,62153L,62154L,62154L,
-     62154L,62155L,62155L,62155L,62156L,62156L,62156L,62157L,
-     62157L,62157L,62158L,62158L,62158L,62159L,62159L,62159L,
-     62159L,62160L,62160L,62160L,62161L,62161L,62161L,62162L,
-     62162L,62162L,62163L,62163L,62163L,62164L,62164L,62164L,
-     62165L,62165L,62165L,62165L,62166L,62166L,62166L,62167L,
-     62167L,62167L,62168L,62168L,62168L,62169L,62169L,62169L,
-     62170L,62170L,62170L,62171L,62171L,62171L,62171L,62172L,
-     62172L,62172L,62173L,62173L,62173L,62174L,62174L,62174L,
-     62175L,62175L,62175L,62176L,62176L,62176L,62177L,62177L,
-     62177L,62177L,62178L,62178L,62178L,62179L,62179L,62179L,
-     62180L,62180L,62180L,62181L,62181L,62181L,62182L,62182L,
-     62182L,62183L,62183L,62183L,62183L,62184L,62184L,62184L,
-     62185L,62185L,62185L,62186L,62186L,62186L,62187L,62187L,
-     62187L,62188L,62188L,62188L,62189L,62189L,62189L,62189L,
-     62190L,62190L,62190L,62191L,62191L,62191L,62192L,62192L,
-     62192L,62193L,62193L,62193L,62194L,62194L,62194L,62195L,
-     62195L,62195L,62195L,62196L,62196L,62196L,62197L,62197L,
-     62197L,62198L,62198L,62198L,62199L,62199L,62199L,62200L,
-     62200L,62200L,62201L,62201L,62201L,62201L,62202L,62202L,
-     62202L,62203L,62203L,62203L,62204L,62204L,62204L,62205L,
-     62205L,62205L,62206L,62206L,62206L,62207L,62207L,62207L,
-     62207L,62208L,62208L,62208L,62209L,62209L,62209L,62210L,
-     62210L,62210L,62211L,62211L,62211L,62212L,62212L,62212L,
-     62212L,62213L,62213L,62213L,62214L,62214L,62214L,62215L,
-     62215L,62215L,62216L,62216L,62216L,62217L,62217L,62217L,
-     62218L,62218L,62218L,62218L,62219L,62219L,62219L,62220L,
-     62220L,62220L,62221L,62221L,62221L,62222L,62222L,62222L,
-     62223L,62223L,62223L,62223L,62224L,62224L,62224L,62225L,
-     62225L,62225L,62226L,62226L,62226L,62227L,62227L,62227L,
-     62228L,62228L,62228L,62228L,62229L,62229L,62229L,62230L,
-     62230L,62230L,62231L,62231L,62231L,62232L,62232L,62232L,
-     62233L,62233L,62233L,62234L,62234L,62234L,62234L,62235L,
-     62235L,62235L,62236L,62236L,62236L,62237L,62237L,62237L,
-     62238L,62238L,62238L,62239L,62239L,62239L,62239L,62240L,
-     62240L,62240L,62241L,62241L,62241L,62242L,62242L,62242L,
-     62243L,62243L,62243L,62244L,62244L,62244L,62244L,62245L,
-     62245L,62245L,62246L,62246L,62246L,62247L,62247L,62247L,
-     62248L,62248L,62248L,62249L,62249L,62249L,62249L,62250L,
-     62250L,62250L,62251L,62251L,62251L,62252L,62252L,62252L,
-     62253L,62253L,62253L,62254L,62254L,62254L,62254L,62255L,
-     62255L,62255L,62256L,62256L,62256L,62257L,62257L,62257L,
-     62258L,62258L,62258L,62259L,62259L,62259L,62259L,62260L,
-     62260L,62260L,62261L,62261L,62261L,62262L,62262L,62262L,
-     62263L,62263L,62263L,62264L,62264L,62264L,62264L,62265L,
-     62265L,62265L,62266L,62266L,62266L,62267L,62267L,62267L,
-     62268L,62268L,62268L,62269L,62269L,62269L,62269L,62270L,
-     62270L,62270L,62271L,62271L,62271L,62272L,62272L,62272L,
-     62273L,62273L,62273L,62274L,62274L,62274L,62274L,62275L,
-     62275L,62275L,62276L,62276L,62276L,62277L,62277L,62277L,
-     62278L,62278L,62278L,62278L,62279L,62279L,62279L,62280L,
-     62280L,62280L,62281L,62281L,62281L,62282L,62282L,62282L,
-     62283L,62283L,62283L,62283L,62284L,62284L,62284L,62285L,
-     62285L,62285L,62286L,62286L,62286L,62287L,62287L,62287L,
-     62288L,62288L,62288L,62288L,62289L,62289L,62289L,62290L,
-     62290L,62290L,62291L,62291L,62291L,62292L,62292L,62292L,
-     62292L,62293L,62293L,62293L,62294L,62294L,62294L,62295L,
-     62295L,62295L,62296L,62296L,62296L,62297L,62297L,62297L,
-     62297L,62298L,62298L,62298L,62299L,62299L,62299L,62300L,
-     62300L,62300L,62301L,62301L,62301L,62301L,62302L,62302L,
-     62302L,62303L,62303L,62303L,62304L,62304L,62304L,62305L,
-     62305L,62305L,62306L,62306L,62306L,62306L,62307L,62307L,
-     62307L,62308L,62308L,62308L,62309L,62309L,62309L,62310L,
-     62310L,62310L,62310L,62311L,62311L,62311L,62312L,62312L,
-     62312L,62313L,62313L,62313L,62314L,62314L,62314L,62315L,
-     62315L,62315L,62315L,62316L,62316L,62316L,62317L,62317L,
-     62317L,62318L,62318L,62318L,62319L,62319L,62319L,62319L,
-     62320L,62320L,62320L,62321L,62321L,62321L,62322L,62322L,
-     62322L,62323L,62323L,62323L,62323L,62324L,62324L,62324L,
-     62325L,62325L,62325L,62326L,62326L,62326L,62327L,62327L,
-     62327L,62328L,62328L,62328L,62328L,62329L,62329L,62329L,
-     62330L,62330L,62330L,62331L,62331L,62331L,62332L,62332L,
-     62332L,62332L,62333L,62333L,62333L,62334L,62334L,62334L,
-     62335L,62335L,62335L,62336L,62336L,62336L,62336L,62337L,
-     62337L,62337L,62338L,62338L,62338L,62339L,62339L,62339L,
-     62340L,62340L,62340L,62340L,62341L,62341L,62341L,62342L,
-     62342L,62342L,62343L,62343L,62343L,62344L,62344L,62344L,
-     62344L,62345L,62345L,62345L,62346L,62346L,62346L,62347L,
-     62347L,62347L,62348L,62348L,62348L,62348L,62349L,62349L,
-     62349L,62350L,62350L,62350L,62351L,62351L,62351L,62352L,
-     62352L,62352L,62352L,62353L,62353L,62353L,62354L,62354L,
-     62354L,62355L,62355L,62355L,62356L,62356L,62356L,62356L,
-     62357L,62357L,62357L,62358L,62358L,62358L,62359L,62359L,
-     62359L,62360L,62360L,62360L,62360L,62361L,62361L,62361L,
-     62362L,62362L,62362L,62363L,62363L,62363L,62364L,62364L,
-     62364L,62364L,62365L,62365L,62365L,62366L,62366L,62366L,
-     62367L,62367L,62367L,62368L,62368L,62368L,62368L,62369L,
-     62369L,62369L,62370L,62370L,62370L,62371L,62371L,62371L,
-     62372L,62372L,62372L,62372L,62373L,62373L,62373L,62374L,
-     62374L,62374L,62375L,62375L,62375L,62376L,62376L,62376L,
-     62376L,62377L,62377L,62377L,62378L,62378L,62378L,62379L,
-     62379L,62379L,62380L,62380L,62380L,62380L,62381L,62381L,
-     62381L,62382L,62382L,62382L,62383L,62383L,62383L,62384L,
-     62384L,62384L,62384L,62385L,62385L,62385L,62386L,62386L,
-     62386L,62387L,62387L,62387L,62387L,62388L,62388L,62388L,
-     62389L,62389L,62389L,62390L,62390L,62390L,62391L,62391L,
-     62391L,62391L,62392L,62392L,62392L,62393L,62393L,62393L,
-     62394L,62394L,62394L,62395L,62395L,62395L,62395L,62396L,
-     62396L,62396L,62397L,62397L,62397L,62398L,62398L,62398L,
-     62399L,62399L,62399L,62399L,62400L,62400L,62400L,62401L,
-     62401L,62401L,62402L,62402L,62402L,62402L,62403L,62403L,
-     62403L,62404L,62404L,62404L,62405L,62405L,62405L,62406L,
-     62406L,62406L,62406L,62407L,62407L,62407L,62408L,62408L,
-     62408L,62409L,62409L,62409L,62410L,62410L,62410L,62410L,
-     62411L,62411L,62411L,62412L,62412L,62412L,62413L,62413L,
-     62413L,62413L,62414L,62414L,62414L,62415L,62415L,62415L,
-     62416L,62416L,62416L,62417L,62417L,62417L,62417L,62418L,
-     62418L,62418L,62419L,62419L,62419L,62420L,62420L,62420L,
-     62420L,62421L,62421L,62421L,62422L,62422L,62422L,62423L,
-     62423L,62423L,62424L,62424L,62424L,62424L,62425L,62425L,
-     62425L,62426L,62426L,62426L,62427L,62427L,62427L,62427L,
-     62428L,62428L,62428L,62429L,62429L,62429L,62430L,62430L,
-     62430L,62431L,62431L,62431L,62431L,62432L,62432L,62432L,
-     62433L,62433L,62433L,62434L,62434L,62434L,62434L,62435L,
-     62435L,62435L,62436L,62436L,62436L,62437L,62437L,62437L,
-     62438L,62438L,62438L,62438L,62439L,62439L,62439L,62440L,
-     62440L,62440L,62441L,62441L,62441L,62441L,62442L,62442L,
-     62442L,62443L,62443L,62443L,62444L,62444L,62444L,62445L,
-     62445L,62445L,62445L,62446L,62446L,62446L,62447L,62447L,
-     62447L,62448L,62448L,62448L,62448L,62449L,62449L,62449L,
-     62450L,62450L,62450L,62451L,62451L,62451L,62451L,62452L,
-     62452L,62452L,62453L,62453L,62453L,62454L,62454L,62454L,
-     62455L,62455L,62455L,62455L,62456L,62456L,62456L,62457L,
-     62457L,62457L,62458L,62458L,62458L,62458L,62459L,62459L,
-     62459L,62460L,62460L,62460L,62461L,62461L,62461L,62461L,
-     62462L,62462L,62462L,62463L,62463L,62463L,62464L,62464L,
-     62464L,62464L,62465L,62465L,62465L,62466L,62466L,62466L,
-     62467L,62467L,62467L,62468L,62468L,62468L,62468L,62469L,
-     62469L,62469L,62470L,62470L,62470L,62471L,62471L,62471L,
-     62471L,62472L,62472L,62472L,62473L,62473L,62473L,62474L,
-     62474L,62474L,62474L,62475L,62475L,62475L,62476L,62476L,
-     62476L,62477L,62477L,62477L,62477L,62478L,62478L,62478L,
-     62479L,62479L,62479L,62480L,62480L,62480L,62481L,62481L,
-     62481L,62481L,62482L,62482L,62482L,62483L,62483L,62483L,
-     62484L,62484L,62484L,62484L,62485L,62485L,62485L,62486L,
-     62486L,62486L,62487L,62487L,62487L,62487L,62488L,62488L,
-     62488L,62489L,62489L,62489L,62490L,62490L,62490L,62490L,
-     62491L,62491L,62491L,62492L,62492L,62492L,62493L,62493L,
-     62493L,62493L,62494L,62494L,62494L,62495L,62495L,62495L,
-     62496L,62496L,62496L,62496L,62497L,62497L,62497L,62498L,
-     62498L,62498L,62499L,62499L,62499L,62499L,62500L,62500L,
-     62500L,62501L,62501L,62501L,62502L,62502L,62502L,62503L,
-     62503L,62503L,62503L,62504L,62504L,62504L,62505L,62505L,
-     62505L,62506L,62506L,62506L,62506L,62507L,62507L,62507L,
-     62508L,62508L,62508L,62509L,62509L,62509L,62509L,62510L,
-     62510L,62510L,62511L,62511L,62511L,62512L,62512L,62512L,
-     62512L,62513L,62513L,62513L,62514L,62514L,62514L,62515L,
-     62515L,62515L,62515L,62516L,62516L,62516L,62517L,62517L,
-     62517L,62518L,62518L,62518L,62518L,62519L,62519L,62519L,
-     62520L,62520L,62520L,62521L,62521L,62521L,62521L,62522L,
-     62522L,62522L,62523L,62523L,62523L,62524L,62524L,62524L,
-     62524L,62525L,62525L,62525L,62526L,62526L,62526L,62527L,
-     62527L,62527L,62527L,62528L,62528L,62528L,62529L,62529L,
-     62529L,62530L,62530L,62530L,62530L,62531L,62531L,62531L,
-     62532L,62532L,62532L,62532L,62533L,62533L,62533L,62534L,
-     62534L,62534L,62535L,62535L,62535L,62535L,62536L,62536L,
-     62536L,62537L,62537L,62537L,62538L,62538L,62538L,62538L,
-     62539L,62539L,62539L,62540L,62540L,62540L,62541L,62541L,
-     62541L,62541L,62542L,62542L,62542L,62543L,62543L,62543L,
-     62544L,62544L,62544L,62544L,62545L,62545L,62545L,62546L,
-     62546L,62546L,62547L,62547L,62547L,62547L,62548L,62548L,
-     62548L,62549L,62549L,62549L,62550L,62550L,62550L,62550L,
-     62551L,62551L,62551L,62552L,62552L,62552L,62553L,62553L,
-     62553L,62553L,62554L,62554L,62554L,62555L,62555L,62555L,
-     62555L,62556L,62556L,62556L,62557L,62557L,62557L,62558L,
-     62558L,62558L,62558L,62559L,62559L,62559L,62560L,62560L,
-     62560L,62561L,62561L,62561L,62561L,62562L,62562L,62562L,
-     62563L,62563L,62563L,62564L,62564L,62564L,62564L,62565L,
-     62565L,62565L,62566L,62566L,62566L,62567L,62567L,62567L,
-     62567L,62568L,62568L,62568L,62569L,62569L,62569L,62569L,
-     62570L,62570L,62570L,62571L,62571L,62571L,62572L,62572L,
-     62572L,62572L,62573L,62573L,62573L,62574L,62574L,62574L,
-     62575L,62575L,62575L,62575L,62576L,62576L,62576L,62577L,
-     62577L,62577L,62578L,62578L,62578L,62578L,62579L,62579L,
-     62579L,62580L,62580L,62580L,62580L,62581L,62581L,62581L,
-     62582L,62582L,62582L,62583L,62583L,62583L,62583L,62584L,
-     62584L,62584L,62585L,62585L,62585L,62586L,62586L,62586L,
-     62586L,62587L,62587L,62587L,62588L,62588L,62588L,62589L,
-     62589L,62589L,62589L,62590L,62590L,62590L,62591L,62591L,
-     62591L,62591L,62592L,62592L,62592L,62593L,62593L,62593L,
-     62594L,62594L,62594L,62594L,62595L,62595L,62595L,62596L,
-     62596L,62596L,62597L,62597L,62597L,62597L,62598L,62598L,
-     62598L,62599L,62599L,62599L,62599L,62600L,62600L,62600L,
-     62601L,62601L,62601L,62602L,62602L,62602L,62602L,62603L,
-     62603L,62603L,62604L,62604L,62604L,62604L,62605L,62605L,
-     62605L,62606L,62606L,62606L,62607L,62607L,62607L,62607L,
-     62608L,62608L,62608L,62609L,62609L,62609L,62610L,62610L,
-     62610L,62610L,62611L,62611L,62611L,62612L,62612L,62612L,
-     62612L,62613L,62613L,62613L,62614L,62614L,62614L,62615L,
-     62615L,62615L,62615L,62616L,62616L,62616L,62617L,62617L,
-     62617L,62617L,62618L,62618L,62618L,62619L,62619L,62619L,
-     62620L,62620L,62620L,62620L,62621L,62621L,62621L,62622L,
-     62622L,62622L,62623L,62623L,62623L,62623L,62624L,62624L,
-     62624L,62625L,62625L,62625L,62625L,62626L,62626L,62626L,
-     62627L,62627L,62627L,62628L,62628L,62628L,62628L,62629L,
-     62629L,62629L,62630L,62630L,62630L,62630L,62631L,62631L,
-     62631L,62632L,62632L,62632L,62633L,62633L,62633L,62633L,
-     62634L,62634L,62634L,62635L,62635L,62635L,62635L,62636L,
-     62636L,62636L,62637L,62637L,62637L,62638L,62638L,62638L,
-     62638L,62639L,62639L,62639L,62640L,62640L,62640L,62640L,
-     62641L,62641L,62641L,62642L,62642L,62642L,62643L,62643L,
-     62643L,62643L,62644L,62644L,62644L,62645L,62645L,62645L,
-     62645L,62646L,62646L,62646L,62647L,62647L,62647L,62648L,
-     62648L,62648L,62648L,62649L,62649L,62649L,62650L,62650L,
-     62650L,62650L,62651L,62651L,62651L,62652L,62652L,62652L,
-     62652L,62653L,62653L,62653L,62654L,62654L,62654L,62655L,
-     62655L,62655L,62655L,62656L,62656L,62656L,62657L,62657L,
-     62657L,62657L,62658L,62658L,62658L,62659L,62659L,62659L,
-     62660L,62660L,62660L,62660L,62661L,62661L,62661L,62662L,
-     62662L,62662L,62662L,62663L,62663L,62663L,62664L,62664L,
-     62664L,62665L,62665L,62665L,62665L,62666L,62666L,62666L,
-     62667L,62667L,62667L,62667L,62668L,62668L,62668L,62669L,
-     62669L,62669L,62669L,62670L,62670L,62670L,62671L,62671L,
-     62671L,62672L,62672L,62672L,62672L,62673L,62673L,62673L,
-     62674L,62674L,62674L,62674L,62675L,62675L,62675L,62676L,
-     62676L,62676L,62677L,62677L,62677L,62677L,62678L,62678L,
-     62678L,62679L,62679L,62679L,62679L,62680L,62680L,62680L,
-     62681L,62681L,62681L,62681L,62682L,62682L,62682L,62683L,
-     62683L,62683L,62684L,62684L,62684L,62684L,62685L,62685L,
-     62685L,62686L,62686L,62686L,62686L,62687L,62687L,62687L,
-     62688L,62688L,62688L,62688L,62689L,62689L,62689L,62690L,
-     62690L,62690L,62691L,62691L,62691L,62691L,62692L,62692L,
-     62692L,62693L,62693L,62693L,62693L,62694L,62694L,62694L,
-     62695L,62695L,62695L,62695L,62696L,62696L,62696L,62697L,
-     62697L,62697L,62697L,62698L,62698L,62698L,62699L,62699L,
-     62699L,62700L,62700L,62700L,62700L,62701L,62701L,62701L,
-     62702L,62702L,62702L,62702L,62703L,62703L,62703L,62704L,
-     62704L,62704L,62704L,62705L,62705L,62705L,62706L,62706L,
-     62706L,62707L,62707L,62707L,62707L,62708L,62708L,62708L,
-     62709L,62709L,62709L,62709L,62710L,62710L,62710L,62711L,
-     62711L,62711L,62711L,62712L,62712L,62712L,62713L,62713L,
-     62713L,62713L,62714L,62714L,62714L,62715L,62715L,62715L,
-     62716L,62716L,62716L,62716L,62717L,62717L,62717L,62718L,
-     62718L,62718L,62718L,62719L,62719L,62719L,62720L,62720L,
-     62720L,62720L,62721L,62721L,62721L,62722L,62722L,62722L,
-     62722L,62723L,62723L,62723L,62724L,62724L,62724L,62725L,
-     62725L,62725L,62725L,62726L,62726L,62726L,62727L,62727L,
-     62727L,62727L,62728L,62728L,62728L,62729L,62729L,62729L,
-     62729L,62730L,62730L,62730L,62731L,62731L,62731L,62731L,
-     62732L,62732L,62732L,62733L,62733L,62733L,62733L,62734L,
-     62734L,62734L,62735L,62735L,62735L,62736L,62736L,62736L,
-     62736L,62737L,62737L,62737L,62738L,62738L,62738L,62738L,
-     62739L,62739L,62739L,62740L,62740L,62740L,62740L,62741L,
-     62741L,62741L,62742L,62742L,62742L,62742L,62743L,62743L,
-     62743L,62744L,62744L,62744L,62744L,62745L,62745L,62745L,
-     62746L,62746L,62746L,62746L,62747L,62747L,62747L,62748L,
-     62748L,62748L,62749L,62749L,62749L,62749L,62750L,62750L,
-     62750L,62751L,62751L,62751L,62751L,62752L,62752L,62752L,
-     62753L,62753L,62753L,62753L,62754L,62754L,62754L,62755L,
-     62755L,62755L,62755L,62756L,62756L,62756L,62757L,62757L,
-     62757L,62757L,62758L,62758L,62758L,62759L,62759L,62759L,
-     62759L,62760L,62760L,62760L,62761L,62761L,62761L,62761L,
-     62762L,62762L,62762L,62763L,62763L,62763L,62763L,62764L,
-     62764L,62764L,62765L,62765L,62765L,62766L,62766L,62766L,
-     62766L,62767L,62767L,62767L,62768L,62768L,62768L,62768L,
-     62769L,62769L,62769L,62770L,62770L,62770L,62770L,62771L,
-     62771L,62771L,62772L,62772L,62772L,62772L,62773L,62773L,
-     62773L,62774L,62774L,62774L,62774L,62775L,62775L,62775L,
-     62776L,62776L,62776L,62776L,62777L,62777L,62777L,62778L,
-     62778L,62778L,62778L,62779L,62779L,62779L,62780L,62780L,
-     62780L,62780L,62781L,62781L,62781L,62782L,62782L,62782L,
-     62782L,62783L,62783L,62783L,62784L,62784L,62784L,62784L,
-     62785L,62785L,62785L,62786L,62786L,62786L,62786L,62787L,
-     62787L,62787L,62788L,62788L,62788L,62788L,62789L,62789L,
-     62789L,62790L,62790L,62790L,62790L,62791L,62791L,62791L,
-     62792L,62792L,62792L,62792L,62793L,62793L,62793L,62794L,
-     62794L,62794L,62794L,62795L,62795L,62795L,62796L,62796L,
-     62796L,62796L,62797L,62797L,62797L,62798L,62798L,62798L,
-     62798L,62799L,62799L,62799L,62800L,62800L,62800L,62800L,
-     62801L,62801L,62801L,62802L,62802L,62802L,62802L,62803L,
-     62803L,62803L,62804L,62804L,62804L,62804L,62805L,62805L,
-     62805L,62806L,62806L,62806L,62806L,62807L,62807L,62807L,
-     62808L,62808L,62808L,62808L,62809L,62809L,62809L,62810L,
-     62810L,62810L,62810L,62811L,62811L,62811L,62812L,62812L,
-     62812L,62812L,62813L,62813L,62813L,62814L,62814L,62814L,
-     62814L,62815L,62815L,62815L,62816L,62816L,62816L,62816L,
-     62817L,62817L,62817L,62818L,62818L,62818L,62818L,62819L,
-     62819L,62819L,62820L,62820L,62820L,62820L,62821L,62821L,
-     62821L,62822L,62822L,62822L,62822L,62823L,62823L,62823L,
-     62824L,62824L,62824L,62824L,62825L,62825L,62825L,62826L,
-     62826L,62826L,62826L,62827L,62827L,62827L,62828L,62828L,
-     62828L,62828L,62829L,62829L,62829L,62830L,62830L,62830L,
-     62830L,62831L,62831L,62831L,62832L,62832L,62832L,62832L,
-     62833L,62833L,62833L,62834L,62834L,62834L,62834L,62835L,
-     62835L,62835L,62836L,62836L,62836L,62836L,62837L,62837L,
-     62837L,62838L,62838L,62838L,62838L,62839L,62839L,62839L,
-     62840L,62840L,62840L,62840L,62841L,62841L,62841L,62842L,
-     62842L,62842L,62842L,62843L,62843L,62843L,62843L,62844L,
-     62844L,62844L,62845L,62845L,62845L,62845L,62846L,62846L,
-     62846L,62847L,62847L,62847L,62847L,62848L,62848L,62848L,
-     62849L,62849L,62849L,62849L,62850L,62850L,62850L,62851L,
-     62851L,62851L,62851L,62852L,62852L,62852L,62853L,62853L,
-     62853L,62853L,62854L,62854L,62854L,62855L,62855L,62855L,
-     62855L,62856L,62856L,62856L,62857L,62857L,62857L,62857L,
-     62858L,62858L,62858L,62859L,62859L,62859L,62859L,62860L,
-     62860L,62860L,62860L,62861L,62861L,62861L,62862L,62862L,
-     62862L,62862L,62863L,62863L,62863L,62864L,62864L,62864L,
-     62864L,62865L,62865L,62865L,62866L,62866L,62866L,62866L,
-     62867L,62867L,62867L,62868L,62868L,62868L,62868L,62869L,
-     62869L,62869L,62870L,62870L,62870L,62870L,62871L,62871L,
-     62871L,62872L,62872L,62872L,62872L,62873L,62873L,62873L,
-     62873L,62874L,62874L,62874L,62875L,62875L,62875L,62875L,
-     62876L,62876L,62876L,62877L,62877L,62877L,62877L,62878L,
-     62878L,62878L,62879L,62879L,62879L,62879L,62880L,62880L,
-     62880L,62881L,62881L,62881L,62881L,62882L,62882L,62882L,
-     62882L,62883L,62883L,62883L,62884L,62884L,62884L,62884L,
-     62885L,62885L,62885L,62886L,62886L,62886L,62886L,62887L,
-     62887L,62887L,62888L,62888L,62888L,62888L,62889L,62889L,
-     62889L,62890L,62890L,62890L,62890L,62891L,62891L,62891L,
-     62892L,62892L,62892L,62892L,62893L,62893L,62893L,62893L,
-     62894L,62894L,62894L,62895L,62895L,62895L,62895L,62896L,
-     62896L,62896L,62897L,62897L,62897L,62897L,62898L,62898L,
-     62898L,62899L,62899L,62899L,62899L,62900L,62900L,62900L,
-     62900L,62901L,62901L,62901L,62902L,62902L,62902L,62902L,
-     62903L,62903L,62903L,62904L,62904L,62904L,62904L,62905L,
-     62905L,62905L,62906L,62906L,62906L,62906L,62907L,62907L,
-     62907L,62908L,62908L,62908L,62908L,62909L,62909L,62909L,
-     62909L,62910L,62910L,62910L,62911L,62911L,62911L,62911L,
-     62912L,62912L,62912L,62913L,62913L,62913L,62913L,62914L,
-     62914L,62914L,62915L,62915L,62915L,62915L,62916L,62916L,
-     62916L,62916L,62917L,62917L,62917L,62918L,62918L,62918L,
-     62918L,62919L,62919L,62919L,62920L,62920L,62920L,62920L,
-     62921L,62921L,62921L,62922L,62922L,62922L,62922L,62923L,
-     62923L,62923L,62923L,62924L,62924L,62924L,62925L,62925L,
-     62925L,62925L,62926L,62926L,62926L,62927L,62927L,62927L,
-     62927L,62928L,62928L,62928L,62928L,62929L,62929L,62929L,
-     62930L,62930L,62930L,62930L,62931L,62931L,62931L,62932L,
-     62932L,62932L,62932L,62933L,62933L,62933L,62934L,62934L,
-     62934L,62934L,62935L,62935L,62935L,62935L,62936L,62936L,
-     62936L,62937L,62937L,62937L,62937L,62938L,62938L,62938L,
-     62939L,62939L,62939L,62939L,62940L,62940L,62940L,62940L,
-     62941L,62941L,62941L,62942L,62942L,62942L,62942L,62943L,
-     62943L,62943L,62944L,62944L,62944L,62944L,62945L,62945L,
-     62945L,62945L,62946L,62946L,62946L,62947L,62947L,62947L,
-     62947L,62948L,62948L,62948L,62949L,62949L,62949L,62949L,
-     62950L,62950L,62950L,62951L,62951L,62951L,62951L,62952L,
-     62952L,62952L,62952L,62953L,62953L,62953L,62954L,62954L,
-     62954L,62954L,62955L,62955L,62955L,62956L,62956L,62956L,
-     62956L,62957L,62957L,62957L,62957L,62958L,62958L,62958L,
-     62959L,62959L,62959L,62959L,62960L,62960L,62960L,62961L,
-     62961L,62961L,62961L,62962L,62962L,62962L,62962L,62963L,
-     62963L,62963L,62964L,62964L,62964L,62964L,62965L,62965L,
-     62965L,62965L,62966L,62966L,62966L,62967L,62967L,62967L,
-     62967L,62968L,62968L,62968L,62969L,62969L,62969L,62969L,
-     62970L,62970L,62970L,62970L,62971L,62971L,62971L,62972L,
-     62972L,62972L,62972L,62973L,62973L,62973L,62974L,62974L,
-     62974L,62974L,62975L,62975L,62975L,62975L,62976L,62976L,
-     62976L,62977L,62977L,62977L,62977L,62978L,62978L,62978L,
-     62979L,62979L,62979L,62979L,62980L,62980L,62980L,62980L,
-     62981L,62981L,62981L,62982L,62982L,62982L,62982L,62983L,
-     62983L,62983L,62983L,62984L,62984L,62984L,62985L,62985L,
-     62985L,62985L,62986L,62986L,62986L,62987L,62987L,62987L,
-     62987L,62988L,62988L,62988L,62988L,62989L,62989L,62989L,
-     62990L,62990L,62990L,62990L,62991L,62991L,62991L,62992L,
-     62992L,62992L,62992L,62993L,62993L,62993L,62993L,62994L,
-     62994L,62994L,62995L,62995L,62995L,62995L,62996L,62996L,
-     62996L,62996L,62997L,62997L,62997L,62998L,62998L,62998L,
-     62998L,62999L,62999L,62999L,62999L,63000L,63000L,63000L,
-     63001L,63001L,63001L,63001L,63002L,63002L,63002L,63003L,
-     63003L,63003L,63003L,63004L,63004L,63004L,63004L,63005L,
-     63005L,63005L,63006L,63006L,63006L,63006L,63007L,63007L,
-     63007L,63007L,63008L,63008L,63008L,63009L,63009L,63009L,
-     63009L,63010L,63010L,63010L,63011L,63011L,63011L,63011L,
-     63012L,63012L,63012L,63012L,63013L,63013L,63013L,63014L,
-     63014L,63014L,63014L,63015L,63015L,63015L,63015L,63016L,
-     63016L,63016L,63017L,63017L,63017L,63017L,63018L,63018L,
-     63018L,63018L,63019L,63019L,63019L,63020L,63020L,63020L,
-     63020L,63021L,63021L,63021L,63021L,63022L,63022L,63022L,
-     63023L,63023L,63023L,63023L,63024L,63024L,63024L,63025L,
-     63025L,63025L,63025L,63026L,63026L,63026L,63026L,63027L,
-     63027L,63027L,63028L,63028L,63028L,63028L,63029L,63029L,
-     63029L,63029L,63030L,63030L,63030L,63031L,63031L,63031L,
-     63031L,63032L,63032L,63032L,63032L,63033L,63033L,63033L,
-     63034L,63034L,63034L,63034L,63035L,63035L,63035L,63035L,
-     63036L,63036L,63036L,63037L,63037L,63037L,63037L,63038L,
-     63038L,63038L,63038L,63039L,63039L,63039L,63040L,63040L,
-     63040L,63040L,63041L,63041L,63041L,63041L,63042L,63042L,
-     63042L,63043L,63043L,63043L,63043L,63044L,63044L,63044L,
-     63044L,63045L,63045L,63045L,63046L,63046L,63046L,63046L,
-     63047L,63047L,63047L,63047L,63048L,63048L,63048L,63049L,
-     63049L,63049L,63049L,63050L,63050L,63050L,63050L,63051L,
-     63051L,63051L,63052L,63052L,63052L,63052L,63053L,63053L,
-     63053L,63053L,63054L,63054L,63054L,63055L,63055L,63055L,
-     63055L,63056L,63056L,63056L,63056L,63057L,63057L,63057L,
-     63058L,63058L,63058L,63058L,63059L,63059L,63059L,63059L,
-     63060L,63060L,63060L,63061L,63061L,63061L,63061L,63062L,
-     63062L,63062L,63062L,63063L,63063L,63063L,63064L,63064L,
-     63064L,63064L,63065L,63065L,63065L,63065L,63066L,63066L,
-     63066L,63067L,63067L,63067L,63067L,63068L,63068L,63068L,
-     63068L,63069L,63069L,63069L,63070L,63070L,63070L,63070L,
-     63071L,63071L,63071L,63071L,63072L,63072L,63072L,63073L,
-     63073L,63073L,63073L,63074L,63074L,63074L,63074L,63075L,
-     63075L,63075L,63076L,63076L,63076L,63076L,63077L,63077L,
-     63077L,63077L,63078L,63078L,63078L,63079L,63079L,63079L,
-     63079L,63080L,63080L,63080L,63080L,63081L,63081L,63081L,
-     63081L,63082L,63082L,63082L,63083L,63083L,63083L,63083L,
-     63084L,63084L,63084L,63084L,63085L,63085L,63085L,63086L,
-     63086L,63086L,63086L,63087L,63087L,63087L,63087L,63088L,
-     63088L,63088L,63089L,63089L,63089L,63089L,63090L,63090L,
-     63090L,63090L,63091L,63091L,63091L,63092L,63092L,63092L,
-     63092L,63093L,63093L,63093L,63093L,63094L,63094L,63094L,
-     63094L,63095L,63095L,63095L,63096L,63096L,63096L,63096L,
-     63097L,63097L,63097L,63097L,63098L,63098L,63098L,63099L,
-     63099L,63099L,63099L,63100L,63100L,63100L,63100L,63101L,
-     63101L,63101L,63102L,63102L,63102L,63102L,63103L,63103L,
-     63103L,63103L,63104L,63104L,63104L,63104L,63105L,63105L,
-     63105L,63106L,63106L,63106L,63106L,63107L,63107L,63107L,
-     63107L,63108L,63108L,63108L,63109L,63109L,63109L,63109L,
-     63110L,63110L,63110L,63110L,63111L,63111L,63111L,63111L,
-     63112L,63112L,63112L,63113L,63113L,63113L,63113L,63114L,
-     63114L,63114L,63114L,63115L,63115L,63115L,63116L,63116L,
-     63116L,63116L,63117L,63117L,63117L,63117L,63118L,63118L,
-     63118L,63118L,63119L,63119L,63119L,63120L,63120L,63120L,
-     63120L,63121L,63121L,63121L,63121L,63122L,63122L,63122L,
-     63123L,63123L,63123L,63123L,63124L,63124L,63124L,63124L,
-     63125L,63125L,63125L,63125L,63126L,63126L,63126L,63127L,
-     63127L,63127L,63127L,63128L,63128L,63128L,63128L,63129L,
-     63129L,63129L,63130L,63130L,63130L,63130L,63131L,63131L,
-     63131L,63131L,63132L,63132L,63132L,63132L,63133L,63133L,
-     63133L,63134L,63134L,63134L,63134L,63135L,63135L,63135L,
-     63135L,63136L,63136L,63136L,63136L,63137L,63137L,63137L,
-     63138L,63138L,63138L,63138L,63139L,63139L,63139L,63139L,
-     63140L,63140L,63140L,63140L,63141L,63141L,63141L,63142L,
-     63142L,63142L,63142L,63143L,63143L,63143L,63143L,63144L,
-     63144L,63144L,63145L,63145L,63145L,63145L,63146L,63146L,
-     63146L,63146L,63147L,63147L,63147L,63147L,63148L,63148L,
-     63148L,63149L,63149L,63149L,63149L,63150L,63150L,63150L,
-     63150L,63151L,63151L,63151L,63151L,63152L,63152L,63152L,
-     63153L,63153L,63153L,63153L,63154L,63154L,63154L,63154L,
-     63155L,63155L,63155L,63155L,63156L,63156L,63156L,63157L,
-     63157L,63157L,63157L,63158L,63158L,63158L,63158L,63159L,
-     63159L,63159L,63159L,63160L,63160L,63160L,63161L,63161L,
-     63161L,63161L,63162L,63162L,63162L,63162L,63163L,63163L,
-     63163L,63163L,63164L,63164L,63164L,63165L,63165L,63165L,
-     63165L,63166L,63166L,63166L,63166L,63167L,63167L,63167L,
-     63167L,63168L,63168L,63168L,63169L,63169L,63169L,63169L,
-     63170L,63170L,63170L,63170L,63171L,63171L,63171L,63171L,
-     63172L,63172L,63172L,63173L,63173L,63173L,63173L,63174L,
-     63174L,63174L,63174L,63175L,63175L,63175L,63175L,63176L,
-     63176L,63176L,63177L,63177L,63177L,63177L,63178L,63178L,
-     63178L,63178L,63179L,63179L,63179L,63179L,63180L,63180L,
-     63180L,63181L,63181L,63181L,63181L,63182L,63182L,63182L,
-     63182L,63183L,63183L,63183L,63183L,63184L,63184L,63184L,
-     63184L,63185L,63185L,63185L,63186L,63186L,63186L,63186L,
-     63187L,63187L,63187L,63187L,63188L,63188L,63188L,63188L,
-     63189L,63189L,63189L,63190L,63190L,63190L,63190L,63191L,
-     63191L,63191L,63191L,63192L,63192L,63192L,63192L,63193L,
-     63193L,63193L,63194L,63194L,63194L,63194L,63195L,63195L,
-     63195L,63195L,63196L,63196L,63196L,63196L,63197L,63197L,
-     63197L,63197L,63198L,63198L,63198L,63199L,63199L,63199L,
-     63199L,63200L,63200L,63200L,63200L,63201L,63201L,63201L,
-     63201L,63202L,63202L,63202L,63203L,63203L,63203L,63203L,
-     63204L,63204L,63204L,63204L,63205L,63205L,63205L,63205L,
-     63206L,63206L,63206L,63206L,63207L,63207L,63207L,63208L,
-     63208L,63208L,63208L,63209L,63209L,63209L,63209L,63210L,
-     63210L,63210L,63210L,63211L,63211L,63211L,63211L,63212L,
-     63212L,63212L,63213L,63213L,63213L,63213L,63214L,63214L,
-     63214L,63214L,63215L,63215L,63215L,63215L,63216L,63216L,
-     63216L,63217L,63217L,63217L,63217L,63218L,63218L,63218L,
-     63218L,63219L,63219L,63219L,63219L,63220L,63220L,63220L,
-     63220L,63221L,63221L,63221L,63222L,63222L,63222L,63222L,
-     63223L,63223L,63223L,63223L,63224L,63224L,63224L,63224L,
-     63225L,63225L,63225L,63225L,63226L,63226L,63226L,63227L,
-     63227L,63227L,63227L,63228L,63228L,63228L,63228L,63229L,
-     63229L,63229L,63229L,63230L,63230L,63230L,63230L,63231L,
-     63231L,63231L,63232L,63232L,63232L,63232L,63233L,63233L,
-     63233L,63233L,63234L,63234L,63234L,63234L,63235L,63235L,
-     63235L,63235L,63236L,63236L,63236L,63237L,63237L,63237L,
-     63237L,63238L,63238L,63238L,63238L,63239L,63239L,63239L,
-     63239L,63240L,63240L,63240L,63240L,63241L,63241L,63241L,
-     63241L,63242L,63242L,63242L,63243L,63243L,63243L,63243L,
-     63244L,63244L,63244L,63244L,63245L,63245L,63245L,63245L,
-     63246L,63246L,63246L,63246L,63247L,63247L,63247L,63248L,
-     63248L,63248L,63248L,63249L,63249L,63249L,63249L,63250L,
-     63250L,63250L,63250L,63251L,63251L,63251L,63251L,63252L,
-     63252L,63252L,63252L,63253L,63253L,63253L,63254L,63254L,
-     63254L,63254L,63255L,63255L,63255L,63255L,63256L,63256L,
-     63256L,63256L,63257L,63257L,63257L,63257L,63258L,63258L,
-     63258L,63259L,63259L,63259L,63259L,63260L,63260L,63260L,
-     63260L,63261L,63261L,63261L,63261L,63262L,63262L,63262L,
-     63262L,63263L,63263L,63263L,63263L,63264L,63264L,63264L,
-     63265L,63265L,63265L,63265L,63266L,63266L,63266L,63266L,
-     63267L,63267L,63267L,63267L,63268L,63268L,63268L,63268L,
-     63269L,63269L,63269L,63269L,63270L,63270L,63270L,63271L,
-     63271L,63271L,63271L,63272L,63272L,63272L,63272L,63273L,
-     63273L,63273L,63273L,63274L,63274L,63274L,63274L,63275L,
-     63275L,63275L,63275L,63276L,63276L,63276L,63277L,63277L,
-     63277L,63277L,63278L,63278L,63278L,63278L,63279L,63279L,
-     63279L,63279L,63280L,63280L,63280L,63280L,63281L,63281L,
-     63281L,63281L,63282L,63282L,63282L,63282L,63283L,63283L,
-     63283L,63284L,63284L,63284L,63284L,63285L,63285L,63285L,
-     63285L,63286L,63286L,63286L,63286L,63287L,63287L,63287L,
-     63287L,63288L,63288L,63288L,63288L,63289L,63289L,63289L,
-     63289L,63290L,63290L,63290L,63291L,63291L,63291L,63291L,
-     63292L,63292L,63292L,63292L,63293L,63293L,63293L,63293L,
-     63294L,63294L,63294L,63294L,63295L,63295L,63295L,63295L,
-     63296L,63296L,63296L,63297L,63297L,63297L,63297L,63298L,
-     63298L,63298L,63298L,63299L,63299L,63299L,63299L,63300L,
-     63300L,63300L,63300L,63301L,63301L,63301L,63301L,63302L,
-     63302L,63302L,63302L,63303L,63303L,63303L,63303L,63304L,
-     63304L,63304L,63305L,63305L,63305L,63305L,63306L,63306L,
-     63306L,63306L,63307L,63307L,63307L,63307L,63308L,63308L,
-     63308L,63308L,63309L,63309L,63309L,63309L,63310L,63310L,
-     63310L,63310L,63311L,63311L,63311L,63312L,63312L,63312L,
-     63312L,63313L,63313L,63313L,63313L,63314L,63314L,63314L,
-     63314L,63315L,63315L,63315L,63315L,63316L,63316L,63316L,
-     63316L,63317L,63317L,63317L,63317L,63318L,63318L,63318L,
-     63318L,63319L,63319L,63319L,63320L,63320L,63320L,63320L,
-     63321L,63321L,63321L,63321L,63322L,63322L,63322L,63322L,
-     63323L,63323L,63323L,63323L,63324L,63324L,63324L,63324L,
-     63325L,63325L,63325L,63325L,63326L,63326L,63326L,63326L,
-     63327L,63327L,63327L,63327L,63328L,63328L,63328L,63329L,
-     63329L,63329L,63329L,63330L,63330L,63330L,63330L,63331L,
-     63331L,63331L,63331L,63332L,63332L,63332L,63332L,63333L,
-     63333L,63333L,63333L,63334L,63334L,63334L,63334L,63335L,
-     63335L,63335L,63335L,63336L,63336L,63336L,63336L,63337L,
-     63337L,63337L,63338L,63338L,63338L,63338L,63339L,63339L,
-     63339L,63339L,63340L,63340L,63340L,63340L,63341L,63341L,
-     63341L,63341L,63342L,63342L,63342L,63342L,63343L,63343L,
-     63343L,63343L,63344L,63344L,63344L,63344L,63345L,63345L,
-     63345L,63345L,63346L,63346L,63346L,63347L,63347L,63347L,
-     63347L,63348L,63348L,63348L,63348L,63349L,63349L,63349L,
-     63349L,63350L,63350L,63350L,63350L,63351L,63351L,63351L,
-     63351L,63352L,63352L,63352L,63352L,63353L,63353L,63353L,
-     63353L,63354L,63354L,63354L,63354L,63355L,63355L,63355L,
-     63355L,63356L,63356L,63356L,63356L,63357L,63357L,63357L,
-     63358L,63358L,63358L,63358L,63359L,63359L,63359L,63359L,
-     63360L,63360L,63360L,63360L,63361L,63361L,63361L,63361L,
-     63362L,63362L,63362L,63362L,63363L,63363L,63363L,63363L,
-     63364L,63364L,63364L,63364L,63365L,63365L,63365L,63365L,
-     63366L,63366L,63366L,63366L,63367L,63367L,63367L,63367L,
-     63368L,63368L,63368L,63368L,63369L,63369L,63369L,63370L,
-     63370L,63370L,63370L,63371L,63371L,63371L,63371L,63372L,
-     63372L,63372L,63372L,63373L,63373L,63373L,63373L,63374L,
-     63374L,63374L,63374L,63375L,63375L,63375L,63375L,63376L,
-     63376L,63376L,63376L,63377L,63377L,63377L,63377L,63378L,
-     63378L,63378L,63378L,63379L,63379L,63379L,63379L,63380L,
-     63380L,63380L,63380L,63381L,63381L,63381L,63381L,63382L,
-     63382L,63382L,63382L,63383L,63383L,63383L,63384L,63384L,
-     63384L,63384L,63385L,63385L,63385L,63385L,63386L,63386L,
-     63386L,63386L,63387L,63387L,63387L,63387L,63388L,63388L,
-     63388L,63388L,63389L,63389L,63389L,63389L,63390L,63390L,
-     63390L,63390L,63391L,63391L,63391L,63391L,63392L,63392L,
-     63392L,63392L,63393L,63393L,63393L,63393L,63394L,63394L,
-     63394L,63394L,63395L,63395L,63395L,63395L,63396L,63396L,
-     63396L,63396L,63397L,63397L,63397L,63397L,63398L,63398L,
-     63398L,63398L,63399L,63399L,63399L,63399L,63400L,63400L,
-     63400L,63401L,63401L,63401L,63401L,63402L,63402L,63402L,
-     63402L,63403L,63403L,63403L,63403L,63404L,63404L,63404L,
-     63404L,63405L,63405L,63405L,63405L,63406L,63406L,63406L,
-     63406L,63407L,63407L,63407L,63407L,63408L,63408L,63408L,
-     63408L,63409L,63409L,63409L,63409L,63410L,63410L,63410L,
-     63410L,63411L,63411L,63411L,63411L,63412L,63412L,63412L,
-     63412L,63413L,63413L,63413L,63413L,63414L,63414L,63414L,
-     63414L,63415L,63415L,63415L,63415L,63416L,63416L,63416L,
-     63416L,63417L,63417L,63417L,63417L,63418L,63418L,63418L,
-     63418L,63419L,63419L,63419L,63419L,63420L,63420L,63420L,
-     63420L,63421L,63421L,63421L,63421L,63422L,63422L,63422L,
-     63422L,63423L,63423L,63423L,63423L,63424L,63424L,63424L,
-     63424L,63425L,63425L,63425L,63425L,63426L,63426L,63426L,
-     63427L,63427L,63427L,63427L,63428L,63428L,63428L,63428L,
-     63429L,63429L,63429L,63429L,63430L,63430L,63430L,63430L,
-     63431L,63431L,63431L,63431L,63432L,63432L,63432L,63432L,
-     63433L,63433L,63433L,63433L,63434L,63434L,63434L,63434L,
-     63435L,63435L,63435L,63435L,63436L,63436L,63436L,63436L,
-     63437L,63437L,63437L,63437L,63438L,63438L,63438L,63438L,
-     63439L,63439L,63439L,63439L,63440L,63440L,63440L,63440L,
-     63441L,63441L,63441L,63441L,63442L,63442L,63442L,63442L,
-     63443L,63443L,63443L,63443L,63444L,63444L,63444L,63444L,
-     63445L,63445L,63445L,63445L,63446L,63446L,63446L,63446L,
-     63447L,63447L,63447L,63447L,63448L,63448L,63448L,63448L,
-     63449L,63449L,63449L,63449L,63450L,63450L,63450L,63450L,
-     63451L,63451L,63451L,63451L,63452L,63452L,63452L,63452L,
-     63453L,63453L,63453L,63453L,63454L,63454L,63454L,63454L,
-     63455L,63455L,63455L,63455L,63456L,63456L,63456L,63456L,
-     63457L,63457L,63457L,63457L,63458L,63458L,63458L,63458L,
-     63459L,63459L,63459L,63459L,63460L,63460L,63460L,63460L,
-     63461L,63461L,63461L,63461L,63462L,63462L,63462L,63462L,
-     63463L,63463L,63463L,63463L,63464L,63464L,63464L,63464L,
-     63465L,63465L,63465L,63465L,63466L,63466L,63466L,63466L,
-     63467L,63467L,63467L,63467L,63468L,63468L,63468L,63468L,
-     63469L,63469L,63469L,63469L,63470L,63470L,63470L,63470L,
-     63471L,63471L,63471L,63471L,63472L,63472L,63472L,63472L,
-     63473L,63473L,63473L,63473L,63474L,63474L,63474L,63474L,
-     63475L,63475L,63475L,63475L,63476L,63476L,63476L,63476L,
-     63477L,63477L,63477L,63477L,63478L,63478L,63478L,63478L,
-     63479L,63479L,63479L,63479L,63480L,63480L,63480L,63480L,
-     63481L,63481L,63481L,63481L,63482L,63482L,63482L,63482L,
-     63483L,63483L,63483L,63483L,63483L,63484L,63484L,63484L,
-     63484L,63485L,63485L,63485L,63485L,63486L,63486L,63486L,
-     63486L,63487L,63487L,63487L,63487L,63488L,63488L,63488L,
-     63488L,63489L,63489L,63489L,63489L,63490L,63490L,63490L,
-     63490L,63491L,63491L,63491L,63491L,63492L,63492L,63492L,
-     63492L,63493L,63493L,63493L,63493L,63494L,63494L,63494L,
-     63494L,63495L,63495L,63495L,63495L,63496L,63496L,63496L,
-     63496L,63497L,63497L,63497L,63497L,63498L,63498L,63498L,
-     63498L,63499L,63499L,63499L,63499L,63500L,63500L,63500L,
-     63500L,63501L,63501L,63501L,63501L,63502L,63502L,63502L,
-     63502L,63503L,63503L,63503L,63503L,63504L,63504L,63504L,
-     63504L,63505L,63505L,63505L,63505L,63506L,63506L,63506L,
-     63506L,63507L,63507L,63507L,63507L,63508L,63508L,63508L,
-     63508L,63508L,63509L,63509L,63509L,63509L,63510L,63510L,
-     63510L,63510L,63511L,63511L,63511L,63511L,63512L,63512L,
-     63512L,63512L,63513L,63513L,63513L,63513L,63514L,63514L,
-     63514L,63514L,63515L,63515L,63515L,63515L,63516L,63516L,
-     63516L,63516L,63517L,63517L,63517L,63517L,63518L,63518L,
-     63518L,63518L,63519L,63519L,63519L,63519L,63520L,63520L,
-     63520L,63520L,63521L,63521L,63521L,63521L,63522L,63522L,
-     63522L,63522L,63523L,63523L,63523L,63523L,63524L,63524L,
-     63524L,63524L,63525L,63525L,63525L,63525L,63525L,63526L,
-     63526L,63526L,63526L,63527L,63527L,63527L,63527L,63528L,
-     63528L,63528L,63528L,63529L,63529L,63529L,63529L,63530L,
-     63530L,63530L,63530L,63531L,63531L,63531L,63531L,63532L,
-     63532L,63532L,63532L,63533L,63533L,63533L,63533L,63534L,
-     63534L,63534L,63534L,63535L,63535L,63535L,63535L,63536L,
-     63536L,63536L,63536L,63537L,63537L,63537L,63537L,63538L,
-     63538L,63538L,63538L,63538L,63539L,63539L,63539L,63539L,
-     63540L,63540L,63540L,63540L,63541L,63541L,63541L,63541L,
-     63542L,63542L,63542L,63542L,63543L,63543L,63543L,63543L,
-     63544L,63544L,63544L,63544L,63545L,63545L,63545L,63545L,
-     63546L,63546L,63546L,63546L,63547L,63547L,63547L,63547L,
-     63548L,63548L,63548L,63548L,63549L,63549L,63549L,63549L,
-     63550L,63550L,63550L,63550L,63550L,63551L,63551L,63551L,
-     63551L,63552L,63552L,63552L,63552L,63553L,63553L,63553L,
-     63553L,63554L,63554L,63554L,63554L,63555L,63555L,63555L,
-     63555L,63556L,63556L,63556L,63556L,63557L,63557L,63557L,
-     63557L,63558L,63558L,63558L,63558L,63559L,63559L,63559L,
-     63559L,63560L,63560L,63560L,63560L,63560L,63561L,63561L,
-     63561L,63561L,63562L,63562L,63562L,63562L,63563L,63563L,
-     63563L,63563L,63564L,63564L,63564L,63564L,63565L,63565L,
-     63565L,63565L,63566L,63566L,63566L,63566L,63567L,63567L,
-     63567L,63567L,63568L,63568L,63568L,63568L,63569L,63569L,
-     63569L,63569L,63569L,63570L,63570L,63570L,63570L,63571L,
-     63571L,63571L,63571L,63572L,63572L,63572L,63572L,63573L,
-     63573L,63573L,63573L,63574L,63574L,63574L,63574L,63575L,
-     63575L,63575L,63575L,63576L,63576L,63576L,63576L,63577L,
-     63577L,63577L,63577L,63578L,63578L,63578L,63578L,63578L,
-     63579L,63579L,63579L,63579L,63580L,63580L,63580L,63580L,
-     63581L,63581L,63581L,63581L,63582L,63582L,63582L,63582L,
-     63583L,63583L,63583L,63583L,63584L,63584L,63584L,63584L,
-     63585L,63585L,63585L,63585L,63585L,63586L,63586L,63586L,
-     63586L,63587L,63587L,63587L,63587L,63588L,63588L,63588L,
-     63588L,63589L,63589L,63589L,63589L,63590L,63590L,63590L,
-     63590L,63591L,63591L,63591L,63591L,63592L,63592L,63592L,
-     63592L,63593L,63593L,63593L,63593L,63593L,63594L,63594L,
-     63594L,63594L,63595L,63595L,63595L,63595L,63596L,63596L,
-     63596L,63596L,63597L,63597L,63597L,63597L,63598L,63598L,
-     63598L,63598L,63599L,63599L,63599L,63599L,63600L,63600L,
-     63600L,63600L,63600L,63601L,63601L,63601L,63601L,63602L,
-     63602L,63602L,63602L,63603L,63603L,63603L,63603L,63604L,
-     63604L,63604L,63604L,63605L,63605L,63605L,63605L,63606L,
-     63606L,63606L,63606L,63607L,63607L,63607L,63607L,63607L,
-     63608L,63608L,63608L,63608L,63609L,63609L,63609L,63609L,
-     63610L,63610L,63610L,63610L,63611L,63611L,63611L,63611L,
-     63612L,63612L,63612L,63612L,63613L,63613L,63613L,63613L,
-     63613L,63614L,63614L,63614L,63614L,63615L,63615L,63615L,
-     63615L,63616L,63616L,63616L,63616L,63617L,63617L,63617L,
-     63617L,63618L,63618L,63618L,63618L,63619L,63619L,63619L,
-     63619L,63619L,63620L,63620L,63620L,63620L,63621L,63621L,
-     63621L,63621L,63622L,63622L,63622L,63622L,63623L,63623L,
-     63623L,63623L,63624L,63624L,63624L,63624L,63625L,63625L,
-     63625L,63625L,63625L,63626L,63626L,63626L,63626L,63627L,
-     63627L,63627L,63627L,63628L,63628L,63628L,63628L,63629L,
-     63629L,63629L,63629L,63630L,63630L,63630L,63630L,63631L,
-     63631L,63631L,63631L,63631L,63632L,63632L,63632L,63632L,
-     63633L,63633L,63633L,63633L,63634L,63634L,63634L,63634L,
-     63635L,63635L,63635L,63635L,63636L,63636L,63636L,63636L,
-     63636L,63637L,63637L,63637L,63637L,63638L,63638L,63638L,
-     63638L,63639L,63639L,63639L,63639L,63640L,63640L,63640L,
-     63640L,63641L,63641L,63641L,63641L,63642L,63642L,63642L,
-     63642L,63642L,63643L,63643L,63643L,63643L,63644L,63644L,
-     63644L,63644L,63645L,63645L,63645L,63645L,63646L,63646L,
-     63646L,63646L,63647L,63647L,63647L,63647L,63647L,63648L,
-     63648L,63648L,63648L,63649L,63649L,63649L,63649L,63650L,
-     63650L,63650L,63650L,63651L,63651L,63651L,63651L,63652L,
-     63652L,63652L,63652L,63652L,63653L,63653L,63653L,63653L,
-     63654L,63654L,63654L,63654L,63655L,63655L,63655L,63655L,
-     63656L,63656L,63656L,63656L,63657L,63657L,63657L,63657L,
-     63657L,63658L,63658L,63658L,63658L,63659L,63659L,63659L,
-     63659L,63660L,63660L,63660L,63660L,63661L,63661L,63661L,
-     63661L,63662L,63662L,63662L,63662L,63662L,63663L,63663L,
-     63663L,63663L,63664L,63664L,63664L,63664L,63665L,63665L,
-     63665L,63665L,63666L,63666L,63666L,63666L,63666L,63667L,
-     63667L,63667L,63667L,63668L,63668L,63668L,63668L,63669L,
-     63669L,63669L,63669L,63670L,63670L,63670L,63670L,63671L,
-     63671L,63671L,63671L,63671L,63672L,63672L,63672L,63672L,
-     63673L,63673L,63673L,63673L,63674L,63674L,63674L,63674L,
-     63675L,63675L,63675L,63675L,63675L,63676L,63676L,63676L,
-     63676L,63677L,63677L,63677L,63677L,63678L,63678L,63678L,
-     63678L,63679L,63679L,63679L,63679L,63680L,63680L,63680L,
-     63680L,63680L,63681L,63681L,63681L,63681L,63682L,63682L,
-     63682L,63682L,63683L,63683L,63683L,63683L,63684L,63684L,
-     63684L,63684L,63684L,63685L,63685L,63685L,63685L,63686L,
-     63686L,63686L,63686L,63687L,63687L,63687L,63687L,63688L,
-     63688L,63688L,63688L,63688L,63689L,63689L,63689L,63689L,
-     63690L,63690L,63690L,63690L,63691L,63691L,63691L,63691L,
-     63692L,63692L,63692L,63692L,63692L,63693L,63693L,63693L,
-     63693L,63694L,63694L,63694L,63694L,63695L,63695L,63695L,
-     63695L,63696L,63696L,63696L,63696L,63696L,63697L,63697L,
-     63697L,63697L,63698L,63698L,63698L,63698L,63699L,63699L,
-     63699L,63699L,63700L,63700L,63700L,63700L,63700L,63701L,
-     63701L,63701L,63701L,63702L,63702L,63702L,63702L,63703L,
-     63703L,63703L,63703L,63704L,63704L,63704L,63704L,63704L,
-     63705L,63705L,63705L,63705L,63706L,63706L,63706L,63706L,
-     63707L,63707L,63707L,63707L,63708L,63708L,63708L,63708L,
-     63708L,63709L,63709L,63709L,63709L,63710L,63710L,63710L,
-     63710L,63711L,63711L,63711L,63711L,63712L,63712L,63712L,
-     63712L,63712L,63713L,63713L,63713L,63713L,63714L,63714L,
-     63714L,63714L,63715L,63715L,63715L,63715L,63715L,63716L,
-     63716L,63716L,63716L,63717L,63717L,63717L,63717L,63718L,
-     63718L,63718L,63718L,63719L,63719L,63719L,63719L,63719L,
-     63720L,63720L,63720L,63720L,63721L,63721L,63721L,63721L,
-     63722L,63722L,63722L,63722L,63723L,63723L,63723L,63723L,
-     63723L,63724L,63724L,63724L,63724L,63725L,63725L,63725L,
-     63725L,63726L,63726L,63726L,63726L,63726L,63727L,63727L,
-     63727L,63727L,63728L,63728L,63728L,63728L,63729L,63729L,
-     63729L,63729L,63730L,63730L,63730L,63730L,63730L,63731L,
-     63731L,63731L,63731L,63732L,63732L,63732L,63732L,63733L,
-     63733L,63733L,63733L,63733L,63734L,63734L,63734L,63734L,
-     63735L,63735L,63735L,63735L,63736L,63736L,63736L,63736L,
-     63736L,63737L,63737L,63737L,63737L,63738L,63738L,63738L,
-     63738L,63739L,63739L,63739L,63739L,63740L,63740L,63740L,
-     63740L,63740L,63741L,63741L,63741L,63741L,63742L,63742L,
-     63742L,63742L,63743L,63743L,63743L,63743L,63743L,63744L,
-     63744L,63744L,63744L,63745L,63745L,63745L,63745L,63746L,
-     63746L,63746L,63746L,63746L,63747L,63747L,63747L,63747L,
-     63748L,63748L,63748L,63748L,63749L,63749L,63749L,63749L,
-     63750L,63750L,63750L,63750L,63750L,63751L,63751L,63751L,
-     63751L,63752L,63752L,63752L,63752L,63753L,63753L,63753L,
-     63753L,63753L,63754L,63754L,63754L,63754L,63755L,63755L,
-     63755L,63755L,63756L,63756L,63756L,63756L,63756L,63757L,
-     63757L,63757L,63757L,63758L,63758L,63758L,63758L,63759L,
-     63759L,63759L,63759L,63759L,63760L,63760L,63760L,63760L,
-     63761L,63761L,63761L,63761L,63762L,63762L,63762L,63762L,
-     63762L,63763L,63763L,63763L,63763L,63764L,63764L,63764L,
-     63764L,63765L,63765L,63765L,63765L,63765L,63766L,63766L,
-     63766L,63766L,63767L,63767L,63767L,63767L,63768L,63768L,
-     63768L,63768L,63768L,63769L,63769L,63769L,63769L,63770L,
-     63770L,63770L,63770L,63771L,63771L,63771L,63771L,63771L,
-     63772L,63772L,63772L,63772L,63773L,63773L,63773L,63773L,
-     63774L,63774L,63774L,63774L,63774L,63775L,63775L,63775L,
-     63775L,63776L,63776L,63776L,63776L,63777L,63777L,63777L,
-     63777L,63777L,63778L,63778L,63778L,63778L,63779L,63779L,
-     63779L,63779L,63780L,63780L,63780L,63780L,63780L,63781L,
-     63781L,63781L,63781L,63782L,63782L,63782L,63782L,63783L,
-     63783L,63783L,63783L,63783L,63784L,63784L,63784L,63784L,
-     63785L,63785L,63785L,63785L,63785L,63786L,63786L,63786L,
-     63786L,63787L,63787L,63787L,63787L,63788L,63788L,63788L,
-     63788L,63788L,63789L,63789L,63789L,63789L,63790L,63790L,
-     63790L,63790L,63791L,63791L,63791L,63791L,63791L,63792L,
-     63792L,63792L,63792L,63793L,63793L,63793L,63793L,63794L,
-     63794L,63794L,63794L,63794L,63795L,63795L,63795L,63795L,
-     63796L,63796L,63796L,63796L,63796L,63797L,63797L,63797L,
-     63797L,63798L,63798L,63798L,63798L,63799L,63799L,63799L,
-     63799L,63799L,63800L,63800L,63800L,63800L,63801L,63801L,
-     63801L,63801L,63802L,63802L,63802L,63802L,63802L,63803L,
-     63803L,63803L,63803L,63804L,63804L,63804L,63804L,63804L,
-     63805L,63805L,63805L,63805L,63806L,63806L,63806L,63806L,
-     63807L,63807L,63807L,63807L,63807L,63808L,63808L,63808L,
-     63808L,63809L,63809L,63809L,63809L,63810L,63810L,63810L,
-     63810L,63810L,63811L,63811L,63811L,63811L,63812L,63812L,
-     63812L,63812L,63812L,63813L,63813L,63813L,63813L,63814L,
-     63814L,63814L,63814L,63815L,63815L,63815L,63815L,63815L,
-     63816L,63816L,63816L,63816L,63817L,63817L,63817L,63817L,
-     63817L,63818L,63818L,63818L,63818L,63819L,63819L,63819L,
-     63819L,63820L,63820L,63820L,63820L,63820L,63821L,63821L,
-     63821L,63821L,63822L,63822L,63822L,63822L,63822L,63823L,
-     63823L,63823L,63823L,63824L,63824L,63824L,63824L,63825L,
-     63825L,63825L,63825L,63825L,63826L,63826L,63826L,63826L,
-     63827L,63827L,63827L,63827L,63827L,63828L,63828L,63828L,
-     63828L,63829L,63829L,63829L,63829L,63830L,63830L,63830L,
-     63830L,63830L,63831L,63831L,63831L,63831L,63832L,63832L,
-     63832L,63832L,63832L,63833L,63833L,63833L,63833L,63834L,
-     63834L,63834L,63834L,63835L,63835L,63835L,63835L,63835L,
-     63836L,63836L,63836L,63836L,63837L,63837L,63837L,63837L,
-     63837L,63838L,63838L,63838L,63838L,63839L,63839L,63839L,
-     63839L,63839L,63840L,63840L,63840L,63840L,63841L,63841L,
-     63841L,63841L,63842L,63842L,63842L,63842L,63842L,63843L,
-     63843L,63843L,63843L,63844L,63844L,63844L,63844L,63844L,
-     63845L,63845L,63845L,63845L,63846L,63846L,63846L,63846L,
-     63846L,63847L,63847L,63847L,63847L,63848L,63848L,63848L,
-     63848L,63849L,63849L,63849L,63849L,63849L,63850L,63850L,
-     63850L,63850L,63851L,63851L,63851L,63851L,63851L,63852L,
-     63852L,63852L,63852L,63853L,63853L,63853L,63853L,63853L,
-     63854L,63854L,63854L,63854L,63855L,63855L,63855L,63855L,
-     63855L,63856L,63856L,63856L,63856L,63857L,63857L,63857L,
-     63857L,63858L,63858L,63858L,63858L,63858L,63859L,63859L,
-     63859L,63859L,63860L,63860L,63860L,63860L,63860L,63861L,
-     63861L,63861L,63861L,63862L,63862L,63862L,63862L,63862L,
-     63863L,63863L,63863L,63863L,63864L,63864L,63864L,63864L,
-     63864L,63865L,63865L,63865L,63865L,63866L,63866L,63866L,
-     63866L,63866L,63867L,63867L,63867L,63867L,63868L,63868L,
-     63868L,63868L,63869L,63869L,63869L,63869L,63869L,63870L,
-     63870L,63870L,63870L,63871L,63871L,63871L,63871L,63871L,
-     63872L,63872L,63872L,63872L,63873L,63873L,63873L,63873L,
-     63873L,63874L,63874L,63874L,63874L,63875L,63875L,63875L,
-     63875L,63875L,63876L,63876L,63876L,63876L,63877L,63877L,
-     63877L,63877L,63877L,63878L,63878L,63878L,63878L,63879L,
-     63879L,63879L,63879L,63879L,63880L,63880L,63880L,63880L,
-     63881L,63881L,63881L,63881L,63881L,63882L,63882L,63882L,
-     63882L,63883L,63883L,63883L,63883L,63883L,63884L,63884L,
-     63884L,63884L,63885L,63885L,63885L,63885L,63886L,63886L,
-     63886L,63886L,63886L,63887L,63887L,63887L,63887L,63888L,
-     63888L,63888L,63888L,63888L,63889L,63889L,63889L,63889L,
-     63890L,63890L,63890L,63890L,63890L,63891L,63891L,63891L,
-     63891L,63892L,63892L,63892L,63892L,63892L,63893L,63893L,
-     63893L,63893L,63894L,63894L,63894L,63894L,63894L,63895L,
-     63895L,63895L,63895L,63896L,63896L,63896L,63896L,63896L,
-     63897L,63897L,63897L,63897L,63898L,63898L,63898L,63898L,
-     63898L,63899L,63899L,63899L,63899L,63900L,63900L,63900L,
-     63900L,63900L,63901L,63901L,63901L,63901L,63902L,63902L,
-     63902L,63902L,63902L,63903L,63903L,63903L,63903L,63904L,
-     63904L,63904L,63904L,63904L,63905L,63905L,63905L,63905L,
-     63906L,63906L,63906L,63906L,63906L,63907L,63907L,63907L,
-     63907L,63908L,63908L,63908L,63908L,63908L,63909L,63909L,
-     63909L,63909L,63909L,63910L,63910L,63910L,63910L,63911L,
-     63911L,63911L,63911L,63911L,63912L,63912L,63912L,63912L,
-     63913L,63913L,63913L,63913L,63913L,63914L,63914L,63914L,
-     63914L,63915L,63915L,63915L,63915L,63915L,63916L,63916L,
-     63916L,63916L,63917L,63917L,63917L,63917L,63917L,63918L,
-     63918L,63918L,63918L,63919L,63919L,63919L,63919L,63919L,
-     63920L,63920L,63920L,63920L,63921L,63921L,63921L,63921L,
-     63921L,63922L,63922L,63922L,63922L,63923L,63923L,63923L,
-     63923L,63923L,63924L,63924L,63924L,63924L,63925L,63925L,
-     63925L,63925L,63925L,63926L,63926L,63926L,63926L,63926L,
-     63927L,63927L,63927L,63927L,63928L,63928L,63928L,63928L,
-     63928L,63929L,63929L,63929L,63929L,63930L,63930L,63930L,
-     63930L,63930L,63931L,63931L,63931L,63931L,63932L,63932L,
-     63932L,63932L,63932L,63933L,63933L,63933L,63933L,63934L,
-     63934L,63934L,63934L,63934L,63935L,63935L,63935L,63935L,
-     63936L,63936L,63936L,63936L,63936L,63937L,63937L,63937L,
-     63937L,63937L,63938L,63938L,63938L,63938L,63939L,63939L,
-     63939L,63939L,63939L,63940L,63940L,63940L,63940L,63941L,
-     63941L,63941L,63941L,63941L,63942L,63942L,63942L,63942L,
-     63943L,63943L,63943L,63943L,63943L,63944L,63944L,63944L,
-     63944L,63945L,63945L,63945L,63945L,63945L,63946L,63946L,
-     63946L,63946L,63946L,63947L,63947L,63947L,63947L,63948L,
-     63948L,63948L,63948L,63948L,63949L,63949L,63949L,63949L,
-     63950L,63950L,63950L,63950L,63950L,63951L,63951L,63951L,
-     63951L,63952L,63952L,63952L,63952L,63952L,63953L,63953L,
-     63953L,63953L,63953L,63954L,63954L,63954L,63954L,63955L,
-     63955L,63955L,63955L,63955L,63956L,63956L,63956L,63956L,
-     63957L,63957L,63957L,63957L,63957L,63958L,63958L,63958L,
-     63958L,63958L,63959L,63959L,63959L,63959L,63960L,63960L,
-     63960L,63960L,63960L,63961L,63961L,63961L,63961L,63962L,
-     63962L,63962L,63962L,63962L,63963L,63963L,63963L,63963L,
-     63964L,63964L,63964L,63964L,63964L,63965L,63965L,63965L,
-     63965L,63965L,63966L,63966L,63966L,63966L,63967L,63967L,
-     63967L,63967L,63967L,63968L,63968L,63968L,63968L,63969L,
-     63969L,63969L,63969L,63969L,63970L,63970L,63970L,63970L,
-     63970L,63971L,63971L,63971L,63971L,63972L,63972L,63972L,
-     63972L,63972L,63973L,63973L,63973L,63973L,63974L,63974L,
-     63974L,63974L,63974L,63975L,63975L,63975L,63975L,63975L,
-     63976L,63976L,63976L,63976L,63977L,63977L,63977L,63977L,
-     63977L,63978L,63978L,63978L,63978L,63978L,63979L,63979L,
-     63979L,63979L,63980L,63980L,63980L,63980L,63980L,63981L,
-     63981L,63981L,63981L,63982L,63982L,63982L,63982L,63982L,
-     63983L,63983L,63983L,63983L,63983L,63984L,63984L,63984L,
-     63984L,63985L,63985L,63985L,63985L,63985L,63986L,63986L,
-     63986L,63986L,63986L,63987L,63987L,63987L,63987L,63988L,
-     63988L,63988L,63988L,63988L,63989L,63989L,63989L,63989L,
-     63990L,63990L,63990L,63990L,63990L,63991L,63991L,63991L,
-     63991L,63991L,63992L,63992L,63992L,63992L,63993L,63993L,
-     63993L,63993L,63993L,63994L,63994L,63994L,63994L,63994L,
-     63995L,63995L,63995L,63995L,63996L,63996L,63996L,63996L,
-     63996L,63997L,63997L,63997L,63997L,63998L,63998L,63998L,
-     63998L,63998L,63999L,63999L,63999L,63999L,63999L,64000L,
-     64000L,64000L,64000L,64001L,64001L,64001L,64001L,64001L,
-     64002L,64002L,64002L,64002L,64002L,64003L,64003L,64003L,
-     64003L,64004L,64004L,64004L,64004L,64004L,64005L,64005L,
-     64005L,64005L,64005L,64006L,64006L,64006L,64006L,64007L,
-     64007L,64007L,64007L,64007L,64008L,64008L,64008L,64008L,
-     64008L,64009L,64009L,64009L,64009L,64010L,64010L,64010L,
-     64010L,64010L,64011L,64011L,64011L,64011L,64011L,64012L,
-     64012L,64012L,64012L,64013L,64013L,64013L,64013L,64013L,
-     64014L,64014L,64014L,64014L,64014L,64015L,64015L,64015L,
-     64015L,64016L,64016L,64016L,64016L,64016L,64017L,64017L,
-     64017L,64017L,64017L,64018L,64018L,64018L,64018L,64019L,
-     64019L,64019L,64019L,64019L,64020L,64020L,64020L,64020L,
-     64020L,64021L,64021L,64021L,64021L,64022L,64022L,64022L,
-     64022L,64022L,64023L,64023L,64023L,64023L,64023L,64024L,
-     64024L,64024L,64024L,64025L,64025L,64025L,64025L,64025L,
-     64026L,64026L,64026L,64026L,64026L,64027L,64027L,64027L,
-     64027L,64028L,64028L,64028L,64028L,64028L,64029L,64029L,
-     64029L,64029L,64029L,64030L,64030L,64030L,64030L,64030L,
-     64031L,64031L,64031L,64031L,64032L,64032L,64032L,64032L,
-     64032L,64033L,64033L,64033L,64033L,64033L,64034L,64034L,
-     64034L,64034L,64035L,64035L,64035L,64035L,64035L,64036L,
-     64036L,64036L,64036L,64036L,64037L,64037L,64037L,64037L,
-     64038L,64038L,64038L,64038L,64038L,64039L,64039L,64039L,
-     64039L,64039L,64040L,64040L,64040L,64040L,64040L,64041L,
-     64041L,64041L,64041L,64042L,64042L,64042L,64042L,64042L,
-     64043L,64043L,64043L,64043L,64043L,64044L,64044L,64044L,
-     64044L,64045L,64045L,64045L,64045L,64045L,64046L,64046L,
-     64046L,64046L,64046L,64047L,64047L,64047L,64047L,64047L,
-     64048L,64048L,64048L,64048L,64049L,64049L,64049L,64049L,
-     64049L,64050L,64050L,64050L,64050L,64050L,64051L,64051L,
-     64051L,64051L,64052L,64052L,64052L,64052L,64052L,64053L,
-     64053L,64053L,64053L,64053L,64054L,64054L,64054L,64054L,
-     64054L,64055L,64055L,64055L,64055L,64056L,64056L,64056L,
-     64056L,64056L,64057L,64057L,64057L,64057L,64057L,64058L,
-     64058L,64058L,64058L,64058L,64059L,64059L,64059L,64059L,
-     64060L,64060L,64060L,64060L,64060L,64061L,64061L,64061L,
-     64061L,64061L,64062L,64062L,64062L,64062L,64062L,64063L,
-     64063L,64063L,64063L,64064L,64064L,64064L,64064L,64064L,
-     64065L,64065L,64065L,64065L,64065L,64066L,64066L,64066L,
-     64066L,64067L,64067L,64067L,64067L,64067L,64068L,64068L,
-     64068L,64068L,64068L,64069L,64069L,64069L,64069L,64069L,
-     64070L,64070L,64070L,64070L,64070L,64071L,64071L,64071L,
-     64071L,64072L,64072L,64072L,64072L,64072L,64073L,64073L,
-     64073L,64073L,64073L,64074L,64074L,64074L,64074L,64074L,
-     64075L,64075L,64075L,64075L,64076L,64076L,64076L,64076L,
-     64076L,64077L,64077L,64077L,64077L,64077L,64078L,64078L,
-     64078L,64078L,64078L,64079L,64079L,64079L,64079L,64080L,
-     64080L,64080L,64080L,64080L,64081L,64081L,64081L,64081L,
-     64081L,64082L,64082L,64082L,64082L,64082L,64083L,64083L,
-     64083L,64083L,64084L,64084L,64084L,64084L,64084L,64085L,
-     64085L,64085L,64085L,64085L,64086L,64086L,64086L,64086L,
-     64086L,64087L,64087L,64087L,64087L,64087L,64088L,64088L,
-     64088L,64088L,64089L,64089L,64089L,64089L,64089L,64090L,
-     64090L,64090L,64090L,64090L,64091L,64091L,64091L,64091L,
-     64091L,64092L,64092L,64092L,64092L,64092L,64093L,64093L,
-     64093L,64093L,64094L,64094L,64094L,64094L,64094L,64095L,
-     64095L,64095L,64095L,64095L,64096L,64096L,64096L,64096L,
-     64096L,64097L,64097L,64097L,64097L,64097L,64098L,64098L,
-     64098L,64098L,64099L,64099L,64099L,64099L,64099L,64100L,
-     64100L,64100L,64100L,64100L,64101L,64101L,64101L,64101L,
-     64101L,64102L,64102L,64102L,64102L,64102L,64103L,64103L,
-     64103L,64103L,64104L,64104L,64104L,64104L,64104L,64105L,
-     64105L,64105L,64105L,64105L,64106L,64106L,64106L,64106L,
-     64106L,64107L,64107L,64107L,64107L,64107L,64108L,64108L,
-     64108L,64108L,64109L,64109L,64109L,64109L,64109L,64110L,
-     64110L,64110L,64110L,64110L,64111L,64111L,64111L,64111L,
-     64111L,64112L,64112L,64112L,64112L,64112L,64113L,64113L,
-     64113L,64113L,64113L,64114L,64114L,64114L,64114L,64115L,
-     64115L,64115L,64115L,64115L,64116L,64116L,64116L,64116L,
-     64116L,64117L,64117L,64117L,64117L,64117L,64118L,64118L,
-     64118L,64118L,64118L,64119L,64119L,64119L,64119L,64119L,
-     64120L,64120L,64120L,64120L,64121L,64121L,64121L,64121L,
-     64121L,64122L,64122L,64122L,64122L,64122L,64123L,64123L,
-     64123L,64123L,64123L,64124L,64124L,64124L,64124L,64124L,
-     64125L,64125L,64125L,64125L,64125L,64126L,64126L,64126L,
-     64126L,64127L,64127L,64127L,64127L,64127L,64128L,64128L,
-     64128L,64128L,64128L,64129L,64129L,64129L,64129L,64129L,
-     64130L,64130L,64130L,64130L,64130L,64131L,64131L,64131L,
-     64131L,64131L,64132L,64132L,64132L,64132L,64132L,64133L,
-     64133L,64133L,64133L,64134L,64134L,64134L,64134L,64134L,
-     64135L,64135L,64135L,64135L,64135L,64136L,64136L,64136L,
-     64136L,64136L,64137L,64137L,64137L,64137L,64137L,64138L,
-     64138L,64138L,64138L,64138L,64139L,64139L,64139L,64139L,
-     64139L,64140L,64140L,64140L,64140L,64141L,64141L,64141L,
-     64141L,64141L,64142L,64142L,64142L,64142L,64142L,64143L,
-     64143L,64143L,64143L,64143L,64144L,64144L,64144L,64144L,
-     64144L,64145L,64145L,64145L,64145L,64145L,64146L,64146L,
-     64146L,64146L,64146L,64147L,64147L,64147L,64147L,64147L,
-     64148L,64148L,64148L,64148L,64149L,64149L,64149L,64149L,
-     64149L,64150L,64150L,64150L,64150L,64150L,64151L,64151L,
-     64151L,64151L,64151L,64152L,64152L,64152L,64152L,64152L,
-     64153L,64153L,64153L,64153L,64153L,64154L,64154L,64154L,
-     64154L,64154L,64155L,64155L,64155L,64155L,64155L,64156L,
-     64156L,64156L,64156L,64156L,64157L,64157L,64157L,64157L,
-     64157L,64158L,64158L,64158L,64158L,64159L,64159L,64159L,
-     64159L,64159L,64160L,64160L,64160L,64160L,64160L,64161L,
-     64161L,64161L,64161L,64161L,64162L,64162L,64162L,64162L,
-     64162L,64163L,64163L,64163L,64163L,64163L,64164L,64164L,
-     64164L,64164L,64164L,64165L,64165L,64165L,64165L,64165L,
-     64166L,64166L,64166L,64166L,64166L,64167L,64167L,64167L,
-     64167L,64167L,64168L,64168L,64168L,64168L,64168L,64169L,
-     64169L,64169L,64169L,64170L,64170L,64170L,64170L,64170L,
-     64171L,64171L,64171L,64171L,64171L,64172L,64172L,64172L,
-     64172L,64172L,64173L,64173L,64173L,64173L,64173L,64174L,
-     64174L,64174L,64174L,64174L,64175L,64175L,64175L,64175L,
-     64175L,64176L,64176L,64176L,64176L,64176L,64177L,64177L,
-     64177L,64177L,64177L,64178L,64178L,64178L,64178L,64178L,
-     64179L,64179L,64179L,64179L,64179L,64180L,64180L,64180L,
-     64180L,64180L,64181L,64181L,64181L,64181L,64181L,64182L,
-     64182L,64182L,64182L,64182L,64183L,64183L,64183L,64183L,
-     64183L,64184L,64184L,64184L,64184L,64184L,64185L,64185L,
-     64185L,64185L,64185L,64186L,64186L,64186L,64186L,64187L,
-     64187L,64187L,64187L,64187L,64188L,64188L,64188L,64188L,
-     64188L,64189L,64189L,64189L,64189L,64189L,64190L,64190L,
-     64190L,64190L,64190L,64191L,64191L,64191L,64191L,64191L,
-     64192L,64192L,64192L,64192L,64192L,64193L,64193L,64193L,
-     64193L,64193L,64194L,64194L,64194L,64194L,64194L,64195L,
-     64195L,64195L,64195L,64195L,64196L,64196L,64196L,64196L,
-     64196L,64197L,64197L,64197L,64197L,64197L,64198L,64198L,
-     64198L,64198L,64198L,64199L,64199L,64199L,64199L,64199L,
-     64200L,64200L,64200L,64200L,64200L,64201L,64201L,64201L,
-     64201L,64201L,64202L,64202L,64202L,64202L,64202L,64203L,
-     64203L,64203L,64203L,64203L,64204L,64204L,64204L,64204L,
-     64204L,64205L,64205L,64205L,64205L,64205L,64206L,64206L,
-     64206L,64206L,64206L,64207L,64207L,64207L,64207L,64207L,
-     64208L,64208L,64208L,64208L,64208L,64209L,64209L,64209L,
-     64209L,64209L,64210L,64210L,64210L,64210L,64210L,64211L,
-     64211L,64211L,64211L,64211L,64212L,64212L,64212L,64212L,
-     64212L,64213L,64213L,64213L,64213L,64213L,64214L,64214L,
-     64214L,64214L,64214L,64215L,64215L,64215L,64215L,64215L,
-     64216L,64216L,64216L,64216L,64216L,64217L,64217L,64217L,
-     64217L,64217L,64218L,64218L,64218L,64218L,64218L,64219L,
-     64219L,64219L,64219L,64219L,64220L,64220L,64220L,64220L,
-     64220L,64221L,64221L,64221L,64221L,64221L,64222L,64222L,
-     64222L,64222L,64222L,64223L,64223L,64223L,64223L,64223L,
-     64224L,64224L,64224L,64224L,64224L,64225L,64225L,64225L,
-     64225L,64225L,64226L,64226L,64226L,64226L,64226L,64227L,
-     64227L,64227L,64227L,64227L,64228L,64228L,64228L,64228L,
-     64228L,64229L,64229L,64229L,64229L,64229L,64230L,64230L,
-     64230L,64230L,64230L,64231L,64231L,64231L,64231L,64231L,
-     64232L,64232L,64232L,64232L,64232L,64233L,64233L,64233L,
-     64233L,64233L,64234L,64234L,64234L,64234L,64234L,64235L,
-     64235L,64235L,64235L,64235L,64236L,64236L,64236L,64236L,
-     64236L,64237L,64237L,64237L,64237L,64237L,64237L,64238L,
-     64238L,64238L,64238L,64238L,64239L,64239L,64239L,64239L,
-     64239L,64240L,64240L,64240L,64240L,64240L,64241L,64241L,
-     64241L,64241L,64241L,64242L,64242L,64242L,64242L,64242L,
-     64243L,64243L,64243L,64243L,64243L,64244L,64244L,64244L,
-     64244L,64244L,64245L,64245L,64245L,64245L,64245L,64246L,
-     64246L,64246L,64246L,64246L,64247L,64247L,64247L,64247L,
-     64247L,64248L,64248L,64248L,64248L,64248L,64249L,64249L,
-     64249L,64249L,64249L,64250L,64250L,64250L,64250L,64250L,
-     64251L,64251L,64251L,64251L,64251L,64252L,64252L,64252L,
-     64252L,64252L,64253L,64253L,64253L,64253L,64253L,64253L,
-     64254L,64254L,64254L,64254L,64254L,64255L,64255L,64255L,
-     64255L,64255L,64256L,64256L,64256L,64256L,64256L,64257L,
-     64257L,64257L,64257L,64257L,64258L,64258L,64258L,64258L,
-     64258L,64259L,64259L,64259L,64259L,64259L,64260L,64260L,
-     64260L,64260L,64260L,64261L,64261L,64261L,64261L,64261L,
-     64262L,64262L,64262L,64262L,64262L,64263L,64263L,64263L,
-     64263L,64263L,64264L,64264L,64264L,64264L,64264L,64264L,
-     64265L,64265L,64265L,64265L,64265L,64266L,64266L,64266L,
-     64266L,64266L,64267L,64267L,64267L,64267L,64267L,64268L,
-     64268L,64268L,64268L,64268L,64269L,64269L,64269L,64269L,
-     64269L,64270L,64270L,64270L,64270L,64270L,64271L,64271L,
-     64271L,64271L,64271L,64272L,64272L,64272L,64272L,64272L,
-     64273L,64273L,64273L,64273L,64273L,64273L,64274L,64274L,
-     64274L,64274L,64274L,64275L,64275L,64275L,64275L,64275L,
-     64276L,64276L,64276L,64276L,64276L,64277L,64277L,64277L,
-     64277L,64277L,64278L,64278L,64278L,64278L,64278L,64279L,
-     64279L,64279L,64279L,64279L,64280L,64280L,64280L,64280L,
-     64280L,64281L,64281L,64281L,64281L,64281L,64281L,64282L,
-     64282L,64282L,64282L,64282L,64283L,64283L,64283L,64283L,
-     64283L,64284L,64284L,64284L,64284L,64284L,64285L,64285L,
-     64285L,64285L,64285L,64286L,64286L,64286L,64286L,64286L,
-     64287L,64287L,64287L,64287L,64287L,64288L,64288L,64288L,
-     64288L,64288L,64288L,64289L,64289L,64289L,64289L,64289L,
-     64290L,64290L,64290L,64290L,64290L,64291L,64291L,64291L,
-     64291L,64291L,64292L,64292L,64292L,64292L,64292L,64293L,
-     64293L,64293L,64293L,64293L,64294L,64294L,64294L,64294L,
-     64294L,64294L,64295L,64295L,64295L,64295L,64295L,64296L,
-     64296L,64296L,64296L,64296L,64297L,64297L,64297L,64297L,
-     64297L,64298L,64298L,64298L,64298L,64298L,64299L,64299L,
-     64299L,64299L,64299L,64300L,64300L,64300L,64300L,64300L,
-     64300L,64301L,64301L,64301L,64301L,64301L,64302L,64302L,
-     64302L,64302L,64302L,64303L,64303L,64303L,64303L,64303L,
-     64304L,64304L,64304L,64304L,64304L,64305L,64305L,64305L,
-     64305L,64305L,64306L,64306L,64306L,64306L,64306L,64306L,
-     64307L,64307L,64307L,64307L,64307L,64308L,64308L,64308L,
-     64308L,64308L,64309L,64309L,64309L,64309L,64309L,64310L,
-     64310L,64310L,64310L,64310L,64311L,64311L,64311L,64311L,
-     64311L,64311L,64312L,64312L,64312L,64312L,64312L,64313L,
-     64313L,64313L,64313L,64313L,64314L,64314L,64314L,64314L,
-     64314L,64315L,64315L,64315L,64315L,64315L,64316L,64316L,
-     64316L,64316L,64316L,64316L,64317L,64317L,64317L,64317L,
-     64317L,64318L,64318L,64318L,64318L,64318L,64319L,64319L,
-     64319L,64319L,64319L,64320L,64320L,64320L,64320L,64320L,
-     64321L,64321L,64321L,64321L,64321L,64321L,64322L,64322L,
-     64322L,64322L,64322L,64323L,64323L,64323L,64323L,64323L,
-     64324L,64324L,64324L,64324L,64324L,64325L,64325L,64325L,
-     64325L,64325L,64325L,64326L,64326L,64326L,64326L,64326L,
-     64327L,64327L,64327L,64327L,64327L,64328L,64328L,64328L,
-     64328L,64328L,64329L,64329L,64329L,64329L,64329L,64329L,
-     64330L,64330L,64330L,64330L,64330L,64331L,64331L,64331L,
-     64331L,64331L,64332L,64332L,64332L,64332L,64332L,64333L,
-     64333L,64333L,64333L,64333L,64334L,64334L,64334L,64334L,
-     64334L,64334L,64335L,64335L,64335L,64335L,64335L,64336L,
-     64336L,64336L,64336L,64336L,64337L,64337L,64337L,64337L,
-     64337L,64338L,64338L,64338L,64338L,64338L,64338L,64339L,
-     64339L,64339L,64339L,64339L,64340L,64340L,64340L,64340L,
-     64340L,64341L,64341L,64341L,64341L,64341L,64341L,64342L,
-     64342L,64342L,64342L,64342L,64343L,64343L,64343L,64343L,
-     64343L,64344L,64344L,64344L,64344L,64344L,64345L,64345L,
-     64345L,64345L,64345L,64345L,64346L,64346L,64346L,64346L,
-     64346L,64347L,64347L,64347L,64347L,64347L,64348L,64348L,
-     64348L,64348L,64348L,64349L,64349L,64349L,64349L,64349L,
-     64349L,64350L,64350L,64350L,64350L,64350L,64351L,64351L,
-     64351L,64351L,64351L,64352L,64352L,64352L,64352L,64352L,
-     64352L,64353L,64353L,64353L,64353L,64353L,64354L,64354L,
-     64354L,64354L,64354L,64355L,64355L,64355L,64355L,64355L,
-     64356L,64356L,64356L,64356L,64356L,64356L,64357L,64357L,
-     64357L,64357L,64357L,64358L,64358L,64358L,64358L,64358L,
-     64359L,64359L,64359L,64359L,64359L,64359L,64360L,64360L,
-     64360L,64360L,64360L,64361L,64361L,64361L,64361L,64361L,
-     64362L,64362L,64362L,64362L,64362L,64362L,64363L,64363L,
-     64363L,64363L,64363L,64364L,64364L,64364L,64364L,64364L,
-     64365L,64365L,64365L,64365L,64365L,64366L,64366L,64366L,
-     64366L,64366L,64366L,64367L,64367L,64367L,64367L,64367L,
-     64368L,64368L,64368L,64368L,64368L,64369L,64369L,64369L,
-     64369L,64369L,64369L,64370L,64370L,64370L,64370L,64370L,
-     64371L,64371L,64371L,64371L,64371L,64372L,64372L,64372L,
-     64372L,64372L,64372L,64373L,64373L,64373L,64373L,64373L,
-     64374L,64374L,64374L,64374L,64374L,64375L,64375L,64375L,
-     64375L,64375L,64375L,64376L,64376L,64376L,64376L,64376L,
-     64377L,64377L,64377L,64377L,64377L,64378L,64378L,64378L,
-     64378L,64378L,64378L,64379L,64379L,64379L,64379L,64379L,
-     64380L,64380L,64380L,64380L,64380L,64381L,64381L,64381L,
-     64381L,64381L,64381L,64382L,64382L,64382L,64382L,64382L,
-     64383L,64383L,64383L,64383L,64383L,64383L,64384L,64384L,
-     64384L,64384L,64384L,64385L,64385L,64385L,64385L,64385L,
-     64386L,64386L,64386L,64386L,64386L,64386L,64387L,64387L,
-     64387L,64387L,64387L,64388L,64388L,64388L,64388L,64388L,
-     64389L,64389L,64389L,64389L,64389L,64389L,64390L,64390L,
-     64390L,64390L,64390L,64391L,64391L,64391L,64391L,64391L,
-     64392L,64392L,64392L,64392L,64392L,64392L,64393L,64393L,
-     64393L,64393L,64393L,64394L,64394L,64394L,64394L,64394L,
-     64394L,64395L,64395L,64395L,64395L,64395L,64396L,64396L,
-     64396L,64396L,64396L,64397L,64397L,64397L,64397L,64397L,
-     64397L,64398L,64398L,64398L,64398L,64398L,64399L,64399L,
-     64399L,64399L,64399L,64399L,64400L,64400L,64400L,64400L,
-     64400L,64401L,64401L,64401L,64401L,64401L,64402L,64402L,
-     64402L,64402L,64402L,64402L,64403L,64403L,64403L,64403L,
-     64403L,64404L,64404L,64404L,64404L,64404L,64404L,64405L,
-     64405L,64405L,64405L,64405L,64406L,64406L,64406L,64406L,
-     64406L,64407L,64407L,64407L,64407L,64407L,64407L,64408L,
-     64408L,64408L,64408L,64408L,64409L,64409L,64409L,64409L,
-     64409L,64409L,64410L,64410L,64410L,64410L,64410L,64411L,
-     64411L,64411L,64411L,64411L,64412L,64412L,64412L,64412L,
-     64412L,64412L,64413L,64413L,64413L,64413L,64413L,64414L,
-     64414L,64414L,64414L,64414L,64414L,64415L,64415L,64415L,
-     64415L,64415L,64416L,64416L,64416L,64416L,64416L,64416L,
-     64417L,64417L,64417L,64417L,64417L,64418L,64418L,64418L,
-     64418L,64418L,64419L,64419L,64419L,64419L,64419L,64419L,
-     64420L,64420L,64420L,64420L,64420L,64421L,64421L,64421L,
-     64421L,64421L,64421L,64422L,64422L,64422L,64422L,64422L,
-     64423L,64423L,64423L,64423L,64423L,64423L,64424L,64424L,
-     64424L,64424L,64424L,64425L,64425L,64425L,64425L,64425L,
-     64425L,64426L,64426L,64426L,64426L,64426L,64427L,64427L,
-     64427L,64427L,64427L,64428L,64428L,64428L,64428L,64428L,
-     64428L,64429L,64429L,64429L,64429L,64429L,64430L,64430L,
-     64430L,64430L,64430L,64430L,64431L,64431L,64431L,64431L,
-     64431L,64432L,64432L,64432L,64432L,64432L,64432L,64433L,
-     64433L,64433L,64433L,64433L,64434L,64434L,64434L,64434L,
-     64434L,64434L,64435L,64435L,64435L,64435L,64435L,64436L,
-     64436L,64436L,64436L,64436L,64436L,64437L,64437L,64437L,
-     64437L,64437L,64438L,64438L,64438L,64438L,64438L,64438L,
-     64439L,64439L,64439L,64439L,64439L,64440L,64440L,64440L,
-     64440L,64440L,64440L,64441L,64441L,64441L,64441L,64441L,
-     64442L,64442L,64442L,64442L,64442L,64442L,64443L,64443L,
-     64443L,64443L,64443L,64444L,64444L,64444L,64444L,64444L,
-     64444L,64445L,64445L,64445L,64445L,64445L,64446L,64446L,
-     64446L,64446L,64446L,64446L,64447L,64447L,64447L,64447L,
-     64447L,64448L,64448L,64448L,64448L,64448L,64448L,64449L,
-     64449L,64449L,64449L,64449L,64450L,64450L,64450L,64450L,
-     64450L,64450L,64451L,64451L,64451L,64451L,64451L,64452L,
-     64452L,64452L,64452L,64452L,64452L,64453L,64453L,64453L,
-     64453L,64453L,64454L,64454L,64454L,64454L,64454L,64454L,
-     64455L,64455L,64455L,64455L,64455L,64456L,64456L,64456L,
-     64456L,64456L,64456L,64457L,64457L,64457L,64457L,64457L,
-     64458L,64458L,64458L,64458L,64458L,64458L,64459L,64459L,
-     64459L,64459L,64459L,64459L,64460L,64460L,64460L,64460L,
-     64460L,64461L,64461L,64461L,64461L,64461L,64461L,64462L,
-     64462L,64462L,64462L,64462L,64463L,64463L,64463L,64463L,
-     64463L,64463L,64464L,64464L,64464L,64464L,64464L,64465L,
-     64465L,64465L,64465L,64465L,64465L,64466L,64466L,64466L,
-     64466L,64466L,64467L,64467L,64467L,64467L,64467L,64467L,
-     64468L,64468L,64468L,64468L,64468L,64469L,64469L,64469L,
-     64469L,64469L,64469L,64470L,64470L,64470L,64470L,64470L,
-     64470L,64471L,64471L,64471L,64471L,64471L,64472L,64472L,
-     64472L,64472L,64472L,64472L,64473L,64473L,64473L,64473L,
-     64473L,64474L,64474L,64474L,64474L,64474L,64474L,64475L,
-     64475L,64475L,64475L,64475L,64475L,64476L,64476L,64476L,
-     64476L,64476L,64477L,64477L,64477L,64477L,64477L,64477L,
-     64478L,64478L,64478L,64478L,64478L,64479L,64479L,64479L,
-     64479L,64479L,64479L,64480L,64480L,64480L,64480L,64480L,
-     64481L,64481L,64481L,64481L,64481L,64481L,64482L,64482L,
-     64482L,64482L,64482L,64482L,64483L,64483L,64483L,64483L,
-     64483L,64484L,64484L,64484L,64484L,64484L,64484L,64485L,
-     64485L,64485L,64485L,64485L,64486L,64486L,64486L,64486L,
-     64486L,64486L,64487L,64487L,64487L,64487L,64487L,64487L,
-     64488L,64488L,64488L,64488L,64488L,64489L,64489L,64489L,
-     64489L,64489L,64489L,64490L,64490L,64490L,64490L,64490L,
-     64490L,64491L,64491L,64491L,64491L,64491L,64492L,64492L,
-     64492L,64492L,64492L,64492L,64493L,64493L,64493L,64493L,
-     64493L,64494L,64494L,64494L,64494L,64494L,64494L,64495L,
-     64495L,64495L,64495L,64495L,64495L,64496L,64496L,64496L,
-     64496L,64496L,64497L,64497L,64497L,64497L,64497L,64497L,
-     64498L,64498L,64498L,64498L,64498L,64498L,64499L,64499L,
-     64499L,64499L,64499L,64500L,64500L,64500L,64500L,64500L,
-     64500L,64501L,64501L,64501L,64501L,64501L,64501L,64502L,
-     64502L,64502L,64502L,64502L,64503L,64503L,64503L,64503L,
-     64503L,64503L,64504L,64504L,64504L,64504L,64504L,64504L,
-     64505L,64505L,64505L,64505L,64505L,64506L,64506L,64506L,
-     64506L,64506L,64506L,64507L,64507L,64507L,64507L,64507L,
-     64507L,64508L,64508L,64508L,64508L,64508L,64509L,64509L,
-     64509L,64509L,64509L,64509L,64510L,64510L,64510L,64510L,
-     64510L,64510L,64511L,64511L,64511L,64511L,64511L,64512L,
-     64512L,64512L,64512L,64512L,64512L,64513L,64513L,64513L,
-     64513L,64513L,64513L,64514L,64514L,64514L,64514L,64514L,
-     64515L,64515L,64515L,64515L,64515L,64515L,64516L,64516L,
-     64516L,64516L,64516L,64516L,64517L,64517L,64517L,64517L,
-     64517L,64518L,64518L,64518L,64518L,64518L,64518L,64519L,
-     64519L,64519L,64519L,64519L,64519L,64520L,64520L,64520L,
-     64520L,64520L,64521L,64521L,64521L,64521L,64521L,64521L,
-     64522L,64522L,64522L,64522L,64522L,64522L,64523L,64523L,
-     64523L,64523L,64523L,64523L,64524L,64524L,64524L,64524L,
-     64524L,64525L,64525L,64525L,64525L,64525L,64525L,64526L,
-     64526L,64526L,64526L,64526L,64526L,64527L,64527L,64527L,
-     64527L,64527L,64528L,64528L,64528L,64528L,64528L,64528L,
-     64529L,64529L,64529L,64529L,64529L,64529L,64530L,64530L,
-     64530L,64530L,64530L,64530L,64531L,64531L,64531L,64531L,
-     64531L,64532L,64532L,64532L,64532L,64532L,64532L,64533L,
-     64533L,64533L,64533L,64533L,64533L,64534L,64534L,64534L,
-     64534L,64534L,64534L,64535L,64535L,64535L,64535L,64535L,
-     64536L,64536L,64536L,64536L,64536L,64536L,64537L,64537L,
-     64537L,64537L,64537L,64537L,64538L,64538L,64538L,64538L,
-     64538L,64538L,64539L,64539L,64539L,64539L,64539L,64540L,
-     64540L,64540L,64540L,64540L,64540L,64541L,64541L,64541L,
-     64541L,64541L,64541L,64542L,64542L,64542L,64542L,64542L,
-     64542L,64543L,64543L,64543L,64543L,64543L,64544L,64544L,
-     64544L,64544L,64544L,64544L,64545L,64545L,64545L,64545L,
-     64545L,64545L,64546L,64546L,64546L,64546L,64546L,64546L,
-     64547L,64547L,64547L,64547L,64547L,64548L,64548L,64548L,
-     64548L,64548L,64548L,64549L,64549L,64549L,64549L,64549L,
-     64549L,64550L,64550L,64550L,64550L,64550L,64550L,64551L,
-     64551L,64551L,64551L,64551L,64551L,64552L,64552L,64552L,
-     64552L,64552L,64553L,64553L,64553L,64553L,64553L,64553L,
-     64554L,64554L,64554L,64554L,64554L,64554L,64555L,64555L,
-     64555L,64555L,64555L,64555L,64556L,64556L,64556L,64556L,
-     64556L,64556L,64557L,64557L,64557L,64557L,64557L,64558L,
-     64558L,64558L,64558L,64558L,64558L,64559L,64559L,64559L,
-     64559L,64559L,64559L,64560L,64560L,64560L,64560L,64560L,
-     64560L,64561L,64561L,64561L,64561L,64561L,64561L,64562L,
-     64562L,64562L,64562L,64562L,64562L,64563L,64563L,64563L,
-     64563L,64563L,64564L,64564L,64564L,64564L,64564L,64564L,
-     64565L,64565L,64565L,64565L,64565L,64565L,64566L,64566L,
-     64566L,64566L,64566L,64566L,64567L,64567L,64567L,64567L,
-     64567L,64567L,64568L,64568L,64568L,64568L,64568L,64568L,
-     64569L,64569L,64569L,64569L,64569L,64570L,64570L,64570L,
-     64570L,64570L,64570L,64571L,64571L,64571L,64571L,64571L,
-     64571L,64572L,64572L,64572L,64572L,64572L,64572L,64573L,
-     64573L,64573L,64573L,64573L,64573L,64574L,64574L,64574L,
-     64574L,64574L,64574L,64575L,64575L,64575L,64575L,64575L,
-     64576L,64576L,64576L,64576L,64576L,64576L,64577L,64577L,
-     64577L,64577L,64577L,64577L,64578L,64578L,64578L,64578L,
-     64578L,64578L,64579L,64579L,64579L,64579L,64579L,64579L,
-     64580L,64580L,64580L,64580L,64580L,64580L,64581L,64581L,
-     64581L,64581L,64581L,64581L,64582L,64582L,64582L,64582L,
-     64582L,64582L,64583L,64583L,64583L,64583L,64583L,64584L,
-     64584L,64584L,64584L,64584L,64584L,64585L,64585L,64585L,
-     64585L,64585L,64585L,64586L,64586L,64586L,64586L,64586L,
-     64586L,64587L,64587L,64587L,64587L,64587L,64587L,64588L,
-     64588L,64588L,64588L,64588L,64588L,64589L,64589L,64589L,
-     64589L,64589L,64589L,64590L,64590L,64590L,64590L,64590L,
-     64590L,64591L,64591L,64591L,64591L,64591L,64591L,64592L,
-     64592L,64592L,64592L,64592L,64592L,64593L,64593L,64593L,
-     64593L,64593L,64593L,64594L,64594L,64594L,64594L,64594L,
-     64595L,64595L,64595L,64595L,64595L,64595L,64596L,64596L,
-     64596L,64596L,64596L,64596L,64597L,64597L,64597L,64597L,
-     64597L,64597L,64598L,64598L,64598L,64598L,64598L,64598L,
-     64599L,64599L,64599L,64599L,64599L,64599L,64600L,64600L,
-     64600L,64600L,64600L,64600L,64601L,64601L,64601L,64601L,
-     64601L,64601L,64602L,64602L,64602L,64602L,64602L,64602L,
-     64603L,64603L,64603L,64603L,64603L,64603L,64604L,64604L,
-     64604L,64604L,64604L,64604L,64605L,64605L,64605L,64605L,
-     64605L,64605L,64606L,64606L,64606L,64606L,64606L,64606L,
-     64607L,64607L,64607L,64607L,64607L,64607L,64608L,64608L,
-     64608L,64608L,64608L,64608L,64609L,64609L,64609L,64609L,
-     64609L,64609L,64610L,64610L,64610L,64610L,64610L,64610L,
-     64611L,64611L,64611L,64611L,64611L,64611L,64612L,64612L,
-     64612L,64612L,64612L,64612L,64613L,64613L,64613L,64613L,
-     64613L,64613L,64614L,64614L,64614L,64614L,64614L,64614L,
-     64615L,64615L,64615L,64615L,64615L,64615L,64616L,64616L,
-     64616L,64616L,64616L,64616L,64617L,64617L,64617L,64617L,
-     64617L,64618L,64618L,64618L,64618L,64618L,64618L,64619L,
-     64619L,64619L,64619L,64619L,64619L,64620L,64620L,64620L,
-     64620L,64620L,64620L,64621L,64621L,64621L,64621L,64621L,
-     64621L,64621L,64622L,64622L,64622L,64622L,64622L,64622L,
-     64623L,64623L,64623L,64623L,64623L,64623L,64624L,64624L,
-     64624L,64624L,64624L,64624L,64625L,64625L,64625L,64625L,
-     64625L,64625L,64626L,64626L,64626L,64626L,64626L,64626L,
-     64627L,64627L,64627L,64627L,64627L,64627L,64628L,64628L,
-     64628L,64628L,64628L,64628L,64629L,64629L,64629L,64629L,
-     64629L,64629L,64630L,64630L,64630L,64630L,64630L,64630L,
-     64631L,64631L,64631L,64631L,64631L,64631L,64632L,64632L,
-     64632L,64632L,64632L,64632L,64633L,64633L,64633L,64633L,
-     64633L,64633L,64634L,64634L,64634L,64634L,64634L,64634L,
-     64635L,64635L,64635L,64635L,64635L,64635L,64636L,64636L,
-     64636L,64636L,64636L,64636L,64637L,64637L,64637L,64637L,
-     64637L,64637L,64638L,64638L,64638L,64638L,64638L,64638L,
-     64639L,64639L,64639L,64639L,64639L,64639L,64640L,64640L,
-     64640L,64640L,64640L,64640L,64641L,64641L,64641L,64641L,
-     64641L,64641L,64642L,64642L,64642L,64642L,64642L,64642L,
-     64643L,64643L,64643L,64643L,64643L,64643L,64644L,64644L,
-     64644L,64644L,64644L,64644L,64644L,64645L,64645L,64645L,
-     64645L,64645L,64645L,64646L,64646L,64646L,64646L,64646L,
-     64646L,64647L,64647L,64647L,64647L,64647L,64647L,64648L,
-     64648L,64648L,64648L,64648L,64648L,64649L,64649L,64649L,
-     64649L,64649L,64649L,64650L,64650L,64650L,64650L,64650L,
-     64650L,64651L,64651L,64651L,64651L,64651L,64651L,64652L,
-     64652L,64652L,64652L,64652L,64652L,64653L,64653L,64653L,
-     64653L,64653L,64653L,64654L,64654L,64654L,64654L,64654L,
-     64654L,64654L,64655L,64655L,64655L,64655L,64655L,64655L,
-     64656L,64656L,64656L,64656L,64656L,64656L,64657L,64657L,
-     64657L,64657L,64657L,64657L,64658L,64658L,64658L,64658L,
-     64658L,64658L,64659L,64659L,64659L,64659L,64659L,64659L,
-     64660L,64660L,64660L,64660L,64660L,64660L,64661L,64661L,
-     64661L,64661L,64661L,64661L,64661L,64662L,64662L,64662L,
-     64662L,64662L,64662L,64663L,64663L,64663L,64663L,64663L,
-     64663L,64664L,64664L,64664L,64664L,64664L,64664L,64665L,
-     64665L,64665L,64665L,64665L,64665L,64666L,64666L,64666L,
-     64666L,64666L,64666L,64667L,64667L,64667L,64667L,64667L,
-     64667L,64668L,64668L,64668L,64668L,64668L,64668L,64668L,
-     64669L,64669L,64669L,64669L,64669L,64669L,64670L,64670L,
-     64670L,64670L,64670L,64670L,64671L,64671L,64671L,64671L,
-     64671L,64671L,64672L,64672L,64672L,64672L,64672L,64672L,
-     64673L,64673L,64673L,64673L,64673L,64673L,64674L,64674L,
-     64674L,64674L,64674L,64674L,64674L,64675L,64675L,64675L,
-     64675L,64675L,64675L,64676L,64676L,64676L,64676L,64676L,
-     64676L,64677L,64677L,64677L,64677L,64677L,64677L,64678L,
-     64678L,64678L,64678L,64678L,64678L,64679L,64679L,64679L,
-     64679L,64679L,64679L,64679L,64680L,64680L,64680L,64680L,
-     64680L,64680L,64681L,64681L,64681L,64681L,64681L,64681L,
-     64682L,64682L,64682L,64682L,64682L,64682L,64683L,64683L,
-     64683L,64683L,64683L,64683L,64683L,64684L,64684L,64684L,
-     64684L,64684L,64684L,64685L,64685L,64685L,64685L,64685L,
-     64685L,64686L,64686L,64686L,64686L,64686L,64686L,64687L,
-     64687L,64687L,64687L,64687L,64687L,64688L,64688L,64688L,
-     64688L,64688L,64688L,64688L,64689L,64689L,64689L,64689L,
-     64689L,64689L,64690L,64690L,64690L,64690L,64690L,64690L,
-     64691L,64691L,64691L,64691L,64691L,64691L,64692L,64692L,
-     64692L,64692L,64692L,64692L,64692L,64693L,64693L,64693L,
-     64693L,64693L,64693L,64694L,64694L,64694L,64694L,64694L,
-     64694L,64695L,64695L,64695L,64695L,64695L,64695L,64696L,
-     64696L,64696L,64696L,64696L,64696L,64696L,64697L,64697L,
-     64697L,64697L,64697L,64697L,64698L,64698L,64698L,64698L,
-     64698L,64698L,64699L,64699L,64699L,64699L,64699L,64699L,
-     64699L,64700L,64700L,64700L,64700L,64700L,64700L,64701L,
-     64701L,64701L,64701L,64701L,64701L,64702L,64702L,64702L,
-     64702L,64702L,64702L,64703L,64703L,64703L,64703L,64703L,
-     64703L,64703L,64704L,64704L,64704L,64704L,64704L,64704L,
-     64705L,64705L,64705L,64705L,64705L,64705L,64706L,64706L,
-     64706L,64706L,64706L,64706L,64706L,64707L,64707L,64707L,
-     64707L,64707L,64707L,64708L,64708L,64708L,64708L,64708L,
-     64708L,64709L,64709L,64709L,64709L,64709L,64709L,64709L,
-     64710L,64710L,64710L,64710L,64710L,64710L,64711L,64711L,
-     64711L,64711L,64711L,64711L,64712L,64712L,64712L,64712L,
-     64712L,64712L,64712L,64713L,64713L,64713L,64713L,64713L,
-     64713L,64714L,64714L,64714L,64714L,64714L,64714L,64715L,
-     64715L,64715L,64715L,64715L,64715L,64715L,64716L,64716L,
-     64716L,64716L,64716L,64716L,64717L,64717L,64717L,64717L,
-     64717L,64717L,64718L,64718L,64718L,64718L,64718L,64718L,
-     64718L,64719L,64719L,64719L,64719L,64719L,64719L,64720L,
-     64720L,64720L,64720L,64720L,64720L,64721L,64721L,64721L,
-     64721L,64721L,64721L,64721L,64722L,64722L,64722L,64722L,
-     64722L,64722L,64723L,64723L,64723L,64723L,64723L,64723L,
-     64724L,64724L,64724L,64724L,64724L,64724L,64724L,64725L,
-     64725L,64725L,64725L,64725L,64725L,64726L,64726L,64726L,
-     64726L,64726L,64726L,64726L,64727L,64727L,64727L,64727L,
-     64727L,64727L,64728L,64728L,64728L,64728L,64728L,64728L,
-     64729L,64729L,64729L,64729L,64729L,64729L,64729L,64730L,
-     64730L,64730L,64730L,64730L,64730L,64731L,64731L,64731L,
-     64731L,64731L,64731L,64732L,64732L,64732L,64732L,64732L,
-     64732L,64732L,64733L,64733L,64733L,64733L,64733L,64733L,
-     64734L,64734L,64734L,64734L,64734L,64734L,64734L,64735L,
-     64735L,64735L,64735L,64735L,64735L,64736L,64736L,64736L,
-     64736L,64736L,64736L,64736L,64737L,64737L,64737L,64737L,
-     64737L,64737L,64738L,64738L,64738L,64738L,64738L,64738L,
-     64739L,64739L,64739L,64739L,64739L,64739L,64739L,64740L,
-     64740L,64740L,64740L,64740L,64740L,64741L,64741L,64741L,
-     64741L,64741L,64741L,64741L,64742L,64742L,64742L,64742L,
-     64742L,64742L,64743L,64743L,64743L,64743L,64743L,64743L,
-     64743L,64744L,64744L,64744L,64744L,64744L,64744L,64745L,
-     64745L,64745L,64745L,64745L,64745L,64745L,64746L,64746L,
-     64746L,64746L,64746L,64746L,64747L,64747L,64747L,64747L,
-     64747L,64747L,64748L,64748L,64748L,64748L,64748L,64748L,
-     64748L,64749L,64749L,64749L,64749L,64749L,64749L,64750L,
-     64750L,64750L,64750L,64750L,64750L,64750L,64751L,64751L,
-     64751L,64751L,64751L,64751L,64752L,64752L,64752L,64752L,
-     64752L,64752L,64752L,64753L,64753L,64753L,64753L,64753L,
-     64753L,64754L,64754L,64754L,64754L,64754L,64754L,64754L,
-     64755L,64755L,64755L,64755L,64755L,64755L,64756L,64756L,
-     64756L,64756L,64756L,64756L,64756L,64757L,64757L,64757L,
-     64757L,64757L,64757L,64758L,64758L,64758L,64758L,64758L,
-     64758L,64758L,64759L,64759L,64759L,64759L,64759L,64759L,
-     64760L,64760L,64760L,64760L,64760L,64760L,64760L,64761L,
-     64761L,64761L,64761L,64761L,64761L,64762L,64762L,64762L,
-     64762L,64762L,64762L,64762L,64763L,64763L,64763L,64763L,
-     64763L,64763L,64764L,64764L,64764L,64764L,64764L,64764L,
-     64764L,64765L,64765L,64765L,64765L,64765L,64765L,64765L,
-     64766L,64766L,64766L,64766L,64766L,64766L,64767L,64767L,
-     64767L,64767L,64767L,64767L,64767L,64768L,64768L,64768L,
-     64768L,64768L,64768L,64769L,64769L,64769L,64769L,64769L,
-     64769L,64769L,64770L,64770L,64770L,64770L,64770L,64770L,
-     64771L,64771L,64771L,64771L,64771L,64771L,64771L,64772L,
-     64772L,64772L,64772L,64772L,64772L,64773L,64773L,64773L,
-     64773L,64773L,64773L,64773L,64774L,64774L,64774L,64774L,
-     64774L,64774L,64774L,64775L,64775L,64775L,64775L,64775L,
-     64775L,64776L,64776L,64776L,64776L,64776L,64776L,64776L,
-     64777L,64777L,64777L,64777L,64777L,64777L,64778L,64778L,
-     64778L,64778L,64778L,64778L,64778L,64779L,64779L,64779L,
-     64779L,64779L,64779L,64779L,64780L,64780L,64780L,64780L,
-     64780L,64780L,64781L,64781L,64781L,64781L,64781L,64781L,
-     64781L,64782L,64782L,64782L,64782L,64782L,64782L,64783L,
-     64783L,64783L,64783L,64783L,64783L,64783L,64784L,64784L,
-     64784L,64784L,64784L,64784L,64784L,64785L,64785L,64785L,
-     64785L,64785L,64785L,64786L,64786L,64786L,64786L,64786L,
-     64786L,64786L,64787L,64787L,64787L,64787L,64787L,64787L,
-     64787L,64788L,64788L,64788L,64788L,64788L,64788L,64789L,
-     64789L,64789L,64789L,64789L,64789L,64789L,64790L,64790L,
-     64790L,64790L,64790L,64790L,64791L,64791L,64791L,64791L,
-     64791L,64791L,64791L,64792L,64792L,64792L,64792L,64792L,
-     64792L,64792L,64793L,64793L,64793L,64793L,64793L,64793L,
-     64794L,64794L,64794L,64794L,64794L,64794L,64794L,64795L,
-     64795L,64795L,64795L,64795L,64795L,64795L,64796L,64796L,
-     64796L,64796L,64796L,64796L,64797L,64797L,64797L,64797L,
-     64797L,64797L,64797L,64798L,64798L,64798L,64798L,64798L,
-     64798L,64798L,64799L,64799L,64799L,64799L,64799L,64799L,
-     64800L,64800L,64800L,64800L,64800L,64800L,64800L,64801L,
-     64801L,64801L,64801L,64801L,64801L,64801L,64802L,64802L,
-     64802L,64802L,64802L,64802L,64802L,64803L,64803L,64803L,
-     64803L,64803L,64803L,64804L,64804L,64804L,64804L,64804L,
-     64804L,64804L,64805L,64805L,64805L,64805L,64805L,64805L,
-     64805L,64806L,64806L,64806L,64806L,64806L,64806L,64807L,
-     64807L,64807L,64807L,64807L,64807L,64807L,64808L,64808L,
-     64808L,64808L,64808L,64808L,64808L,64809L,64809L,64809L,
-     64809L,64809L,64809L,64809L,64810L,64810L,64810L,64810L,
-     64810L,64810L,64811L,64811L,64811L,64811L,64811L,64811L,
-     64811L,64812L,64812L,64812L,64812L,64812L,64812L,64812L,
-     64813L,64813L,64813L,64813L,64813L,64813L,64813L,64814L,
-     64814L,64814L,64814L,64814L,64814L,64815L,64815L,64815L,
-     64815L,64815L,64815L,64815L,64816L,64816L,64816L,64816L,
-     64816L,64816L,64816L,64817L,64817L,64817L,64817L,64817L,
-     64817L,64817L,64818L,64818L,64818L,64818L,64818L,64818L,
-     64819L,64819L,64819L,64819L,64819L,64819L,64819L,64820L,
-     64820L,64820L,64820L,64820L,64820L,64820L,64821L,64821L,
-     64821L,64821L,64821L,64821L,64821L,64822L,64822L,64822L,
-     64822L,64822L,64822L,64822L,64823L,64823L,64823L,64823L,
-     64823L,64823L,64824L,64824L,64824L,64824L,64824L,64824L,
-     64824L,64825L,64825L,64825L,64825L,64825L,64825L,64825L,
-     64826L,64826L,64826L,64826L,64826L,64826L,64826L,64827L,
-     64827L,64827L,64827L,64827L,64827L,64827L,64828L,64828L,
-     64828L,64828L,64828L,64828L,64829L,64829L,64829L,64829L,
-     64829L,64829L,64829L,64830L,64830L,64830L,64830L,64830L,
-     64830L,64830L,64831L,64831L,64831L,64831L,64831L,64831L,
-     64831L,64832L,64832L,64832L,64832L,64832L,64832L,64832L,
-     64833L,64833L,64833L,64833L,64833L,64833L,64833L,64834L,
-     64834L,64834L,64834L,64834L,64834L,64834L,64835L,64835L,
-     64835L,64835L,64835L,64835L,64836L,64836L,64836L,64836L,
-     64836L,64836L,64836L,64837L,64837L,64837L,64837L,64837L,
-     64837L,64837L,64838L,64838L,64838L,64838L,64838L,64838L,
-     64838L,64839L,64839L,64839L,64839L,64839L,64839L,64839L,
-     64840L,64840L,64840L,64840L,64840L,64840L,64840L,64841L,
-     64841L,64841L,64841L,64841L,64841L,64841L,64842L,64842L,
-     64842L,64842L,64842L,64842L,64842L,64843L,64843L,64843L,
-     64843L,64843L,64843L,64844L,64844L,64844L,64844L,64844L,
-     64844L,64844L,64845L,64845L,64845L,64845L,64845L,64845L,
-     64845L,64846L,64846L,64846L,64846L,64846L,64846L,64846L,
-     64847L,64847L,64847L,64847L,64847L,64847L,64847L,64848L,
-     64848L,64848L,64848L,64848L,64848L,64848L,64849L,64849L,
-     64849L,64849L,64849L,64849L,64849L,64850L,64850L,64850L,
-     64850L,64850L,64850L,64850L,64851L,64851L,64851L,64851L,
-     64851L,64851L,64851L,64852L,64852L,64852L,64852L,64852L,
-     64852L,64852L,64853L,64853L,64853L,64853L,64853L,64853L,
-     64853L,64854L,64854L,64854L,64854L,64854L,64854L,64854L,
-     64855L,64855L,64855L,64855L,64855L,64855L,64855L,64856L,
-     64856L,64856L,64856L,64856L,64856L,64856L,64857L,64857L,
-     64857L,64857L,64857L,64857L,64858L,64858L,64858L,64858L,
-     64858L,64858L,64858L,64859L,64859L,64859L,64859L,64859L,
-     64859L,64859L,64860L,64860L,64860L,64860L,64860L,64860L,
-     64860L,64861L,64861L,64861L,64861L,64861L,64861L,64861L,
-     64862L,64862L,64862L,64862L,64862L,64862L,64862L,64863L,
-     64863L,64863L,64863L,64863L,64863L,64863L,64864L,64864L,
-     64864L,64864L,64864L,64864L,64864L,64865L,64865L,64865L,
-     64865L,64865L,64865L,64865L,64866L,64866L,64866L,64866L,
-     64866L,64866L,64866L,64867L,64867L,64867L,64867L,64867L,
-     64867L,64867L,64868L,64868L,64868L,64868L,64868L,64868L,
-     64868L,64869L,64869L,64869L,64869L,64869L,64869L,64869L,
-     64869L,64870L,64870L,64870L,64870L,64870L,64870L,64870L,
-     64871L,64871L,64871L,64871L,64871L,64871L,64871L,64872L,
-     64872L,64872L,64872L,64872L,64872L,64872L,64873L,64873L,
-     64873L,64873L,64873L,64873L,64873L,64874L,64874L,64874L,
-     64874L,64874L,64874L,64874L,64875L,64875L,64875L,64875L,
-     64875L,64875L,64875L,64876L,64876L,64876L,64876L,64876L,
-     64876L,64876L,64877L,64877L,64877L,64877L,64877L,64877L,
-     64877L,64878L,64878L,64878L,64878L,64878L,64878L,64878L,
-     64879L,64879L,64879L,64879L,64879L,64879L,64879L,64880L,
-     64880L,64880L,64880L,64880L,64880L,64880L,64881L,64881L,
-     64881L,64881L,64881L,64881L,64881L,64882L,64882L,64882L,
-     64882L,64882L,64882L,64882L,64883L,64883L,64883L,64883L,
-     64883L,64883L,64883L,64884L,64884L,64884L,64884L,64884L,
-     64884L,64884L,64884L,64885L,64885L,64885L,64885L,64885L,
-     64885L,64885L,64886L,64886L,64886L,64886L,64886L,64886L,
-     64886L,64887L,64887L,64887L,64887L,64887L,64887L,64887L,
-     64888L,64888L,64888L,64888L,64888L,64888L,64888L,64889L,
-     64889L,64889L,64889L,64889L,64889L,64889L,64890L,64890L,
-     64890L,64890L,64890L,64890L,64890L,64891L,64891L,64891L,
-     64891L,64891L,64891L,64891L,64891L,64892L,64892L,64892L,
-     64892L,64892L,64892L,64892L,64893L,64893L,64893L,64893L,
-     64893L,64893L,64893L,64894L,64894L,64894L,64894L,64894L,
-     64894L,64894L,64895L,64895L,64895L,64895L,64895L,64895L,
-     64895L,64896L,64896L,64896L,64896L,64896L,64896L,64896L,
-     64897L,64897L,64897L,64897L,64897L,64897L,64897L,64897L,
-     64898L,64898L,64898L,64898L,64898L,64898L,64898L,64899L,
-     64899L,64899L,64899L,64899L,64899L,64899L,64900L,64900L,
-     64900L,64900L,64900L,64900L,64900L,64901L,64901L,64901L,
-     64901L,64901L,64901L,64901L,64902L,64902L,64902L,64902L,
-     64902L,64902L,64902L,64902L,64903L,64903L,64903L,64903L,
-     64903L,64903L,64903L,64904L,64904L,64904L,64904L,64904L,
-     64904L,64904L,64905L,64905L,64905L,64905L,64905L,64905L,
-     64905L,64906L,64906L,64906L,64906L,64906L,64906L,64906L,
-     64907L,64907L,64907L,64907L,64907L,64907L,64907L,64907L,
-     64908L,64908L,64908L,64908L,64908L,64908L,64908L,64909L,
-     64909L,64909L,64909L,64909L,64909L,64909L,64910L,64910L,
-     64910L,64910L,64910L,64910L,64910L,64911L,64911L,64911L,
-     64911L,64911L,64911L,64911L,64911L,64912L,64912L,64912L,
-     64912L,64912L,64912L,64912L,64913L,64913L,64913L,64913L,
-     64913L,64913L,64913L,64914L,64914L,64914L,64914L,64914L,
-     64914L,64914L,64915L,64915L,64915L,64915L,64915L,64915L,
-     64915L,64915L,64916L,64916L,64916L,64916L,64916L,64916L,
-     64916L,64917L,64917L,64917L,64917L,64917L,64917L,64917L,
-     64918L,64918L,64918L,64918L,64918L,64918L,64918L,64918L,
-     64919L,64919L,64919L,64919L,64919L,64919L,64919L,64920L,
-     64920L,64920L,64920L,64920L,64920L,64920L,64921L,64921L,
-     64921L,64921L,64921L,64921L,64921L,64921L,64922L,64922L,
-     64922L,64922L,64922L,64922L,64922L,64923L,64923L,64923L,
-     64923L,64923L,64923L,64923L,64924L,64924L,64924L,64924L,
-     64924L,64924L,64924L,64924L,64925L,64925L,64925L,64925L,
-     64925L,64925L,64925L,64926L,64926L,64926L,64926L,64926L,
-     64926L,64926L,64927L,64927L,64927L,64927L,64927L,64927L,
-     64927L,64927L,64928L,64928L,64928L,64928L,64928L,64928L,
-     64928L,64929L,64929L,64929L,64929L,64929L,64929L,64929L,
-     64930L,64930L,64930L,64930L,64930L,64930L,64930L,64930L,
-     64931L,64931L,64931L,64931L,64931L,64931L,64931L,64932L,
-     64932L,64932L,64932L,64932L,64932L,64932L,64933L,64933L,
-     64933L,64933L,64933L,64933L,64933L,64933L,64934L,64934L,
-     64934L,64934L,64934L,64934L,64934L,64935L,64935L,64935L,
-     64935L,64935L,64935L,64935L,64935L,64936L,64936L,64936L,
-     64936L,64936L,64936L,64936L,64937L,64937L,64937L,64937L,
-     64937L,64937L,64937L,64937L,64938L,64938L,64938L,64938L,
-     64938L,64938L,64938L,64939L,64939L,64939L,64939L,64939L,
-     64939L,64939L,64940L,64940L,64940L,64940L,64940L,64940L,
-     64940L,64940L,64941L,64941L,64941L,64941L,64941L,64941L,
-     64941L,64942L,64942L,64942L,64942L,64942L,64942L,64942L,
-     64942L,64943L,64943L,64943L,64943L,64943L,64943L,64943L,
-     64944L,64944L,64944L,64944L,64944L,64944L,64944L,64944L,
-     64945L,64945L,64945L,64945L,64945L,64945L,64945L,64946L,
-     64946L,64946L,64946L,64946L,64946L,64946L,64946L,64947L,
-     64947L,64947L,64947L,64947L,64947L,64947L,64948L,64948L,
-     64948L,64948L,64948L,64948L,64948L,64949L,64949L,64949L,
-     64949L,64949L,64949L,64949L,64949L,64950L,64950L,64950L,
-     64950L,64950L,64950L,64950L,64951L,64951L,64951L,64951L,
-     64951L,64951L,64951L,64951L,64952L,64952L,64952L,64952L,
-     64952L,64952L,64952L,64952L,64953L,64953L,64953L,64953L,
-     64953L,64953L,64953L,64954L,64954L,64954L,64954L,64954L,
-     64954L,64954L,64954L,64955L,64955L,64955L,64955L,64955L,
-     64955L,64955L,64956L,64956L,64956L,64956L,64956L,64956L,
-     64956L,64956L,64957L,64957L,64957L,64957L,64957L,64957L,
-     64957L,64958L,64958L,64958L,64958L,64958L,64958L,64958L,
-     64958L,64959L,64959L,64959L,64959L,64959L,64959L,64959L,
-     64960L,64960L,64960L,64960L,64960L,64960L,64960L,64960L,
-     64961L,64961L,64961L,64961L,64961L,64961L,64961L,64962L,
-     64962L,64962L,64962L,64962L,64962L,64962L,64962L,64963L,
-     64963L,64963L,64963L,64963L,64963L,64963L,64963L,64964L,
-     64964L,64964L,64964L,64964L,64964L,64964L,64965L,64965L,
-     64965L,64965L,64965L,64965L,64965L,64965L,64966L,64966L,
-     64966L,64966L,64966L,64966L,64966L,64967L,64967L,64967L,
-     64967L,64967L,64967L,64967L,64967L,64968L,64968L,64968L,
-     64968L,64968L,64968L,64968L,64968L,64969L,64969L,64969L,
-     64969L,64969L,64969L,64969L,64970L,64970L,64970L,64970L,
-     64970L,64970L,64970L,64970L,64971L,64971L,64971L,64971L,
-     64971L,64971L,64971L,64972L,64972L,64972L,64972L,64972L,
-     64972L,64972L,64972L,64973L,64973L,64973L,64973L,64973L,
-     64973L,64973L,64973L,64974L,64974L,64974L,64974L,64974L,
-     64974L,64974L,64975L,64975L,64975L,64975L,64975L,64975L,
-     64975L,64975L,64976L,64976L,64976L,64976L,64976L,64976L,
-     64976L,64976L,64977L,64977L,64977L,64977L,64977L,64977L,
-     64977L,64978L,64978L,64978L,64978L,64978L,64978L,64978L,
-     64978L,64979L,64979L,64979L,64979L,64979L,64979L,64979L,
-     64979L,64980L,64980L,64980L,64980L,64980L,64980L,64980L,
-     64981L,64981L,64981L,64981L,64981L,64981L,64981L,64981L,
-     64982L,64982L,64982L,64982L,64982L,64982L,64982L,64982L,
-     64983L,64983L,64983L,64983L,64983L,64983L,64983L,64983L,
-     64984L,64984L,64984L,64984L,64984L,64984L,64984L,64985L,
-     64985L,64985L,64985L,64985L,64985L,64985L,64985L,64986L,
-     64986L,64986L,64986L,64986L,64986L,64986L,64986L,64987L,
-     64987L,64987L,64987L,64987L,64987L,64987L,64987L,64988L,
-     64988L,64988L,64988L,64988L,64988L,64988L,64989L,64989L,
-     64989L,64989L,64989L,64989L,64989L,64989L,64990L,64990L,
-     64990L,64990L,64990L,64990L,64990L,64990L,64991L,64991L,
-     64991L,64991L,64991L,64991L,64991L,64991L,64992L,64992L,
-     64992L,64992L,64992L,64992L,64992L,64993L,64993L,64993L,
-     64993L,64993L,64993L,64993L,64993L,64994L,64994L,64994L,
-     64994L,64994L,64994L,64994L,64994L,64995L,64995L,64995L,
-     64995L,64995L,64995L,64995L,64995L,64996L,64996L,64996L,
-     64996L,64996L,64996L,64996L,64996L,64997L,64997L,64997L,
-     64997L,64997L,64997L,64997L,64998L,64998L,64998L,64998L,
-     64998L,64998L,64998L,64998L,64999L,64999L,64999L,64999L,
-     64999L,64999L,64999L,64999L,65000L,65000L,65000L,65000L,
-     65000L,65000L,65000L,65000L,65001L,65001L,65001L,65001L,
-     65001L,65001L,65001L,65001L,65002L,65002L,65002L,65002L,
-     65002L,65002L,65002L,65002L,65003L,65003L,65003L,65003L,
-     65003L,65003L,65003L,65004L,65004L,65004L,65004L,65004L,
-     65004L,65004L,65004L,65005L,65005L,65005L,65005L,65005L,
-     65005L,65005L,65005L,65006L,65006L,65006L,65006L,65006L,
-     65006L,65006L,65006L,65007L,65007L,65007L,65007L,65007L,
-     65007L,65007L,65007L,65008L,65008L,65008L,65008L,65008L,
-     65008L,65008L,65008L,65009L,65009L,65009L,65009L,65009L,
-     65009L,65009L,65009L,65010L,65010L,65010L,65010L,65010L,
-     65010L,65010L,65010L,65011L,65011L,65011L,65011L,65011L,
-     65011L,65011L,65011L,65012L,65012L,65012L,65012L,65012L,
-     65012L,65012L,65012L,65013L,65013L,65013L,65013L,65013L,
-     65013L,65013L,65014L,65014L,65014L,65014L,65014L,65014L,
-     65014L,65014L,65015L,65015L,65015L,65015L,65015L,65015L,
-     65015L,65015L,65016L,65016L,65016L,65016L,65016L,65016L,
-     65016L,65016L,65017L,65017L,65017L,65017L,65017L,65017L,
-     65017L,65017L,65018L,65018L,65018L,65018L,65018L,65018L,
-     65018L,65018L,65019L,65019L,65019L,65019L,65019L,65019L,
-     65019L,65019L,65020L,65020L,65020L,65020L,65020L,65020L,
-     65020L,65020L,65021L,65021L,65021L,65021L,65021L,65021L,
-     65021L,65021L,65022L,65022L,65022L,65022L,65022L,65022L,
-     65022L,65022L,65023L,65023L,65023L,65023L,65023L,65023L,
-     65023L,65023L,65024L,65024L,65024L,65024L,65024L,65024L,
-     65024L,65024L,65025L,65025L,65025L,65025L,65025L,65025L,
-     65025L,65025L,65026L,65026L,65026L,65026L,65026L,65026L,
-     65026L,65026L,65027L,65027L,65027L,65027L,65027L,65027L,
-     65027L,65027L,65028L,65028L,65028L,65028L,65028L,65028L,
-     65028L,65028L,65029L,65029L,65029L,65029L,65029L,65029L,
-     65029L,65029L,65030L,65030L,65030L,65030L,65030L,65030L,
-     65030L,65030L,65030L,65031L,65031L,65031L,65031L,65031L,
-     65031L,65031L,65031L,65032L,65032L,65032L,65032L,65032L,
-     65032L,65032L,65032L,65033L,65033L,65033L,65033L,65033L,
-     65033L,65033L,65033L,65034L,65034L,65034L,65034L,65034L,
-     65034L,65034L,65034L,65035L,65035L,65035L,65035L,65035L,
-     65035L,65035L,65035L,65036L,65036L,65036L,65036L,65036L,
-     65036L,65036L,65036L,65037L,65037L,65037L,65037L,65037L,
-     65037L,65037L,65037L,65038L,65038L,65038L,65038L,65038L,
-     65038L,65038L,65038L,65039L,65039L,65039L,65039L,65039L,
-     65039L,65039L,65039L,65040L,65040L,65040L,65040L,65040L,
-     65040L,65040L,65040L,65040L,65041L,65041L,65041L,65041L,
-     65041L,65041L,65041L,65041L,65042L,65042L,65042L,65042L,
-     65042L,65042L,65042L,65042L,65043L,65043L,65043L,65043L,
-     65043L,65043L,65043L,65043L,65044L,65044L,65044L,65044L,
-     65044L,65044L,65044L,65044L,65045L,65045L,65045L,65045L,
-     65045L,65045L,65045L,65045L,65046L,65046L,65046L,65046L,
-     65046L,65046L,65046L,65046L,65046L,65047L,65047L,65047L,
-     65047L,65047L,65047L,65047L,65047L,65048L,65048L,65048L,
-     65048L,65048L,65048L,65048L,65048L,65049L,65049L,65049L,
-     65049L,65049L,65049L,65049L,65049L,65050L,65050L,65050L,
-     65050L,65050L,65050L,65050L,65050L,65050L,65051L,65051L,
-     65051L,65051L,65051L,65051L,65051L,65051L,65052L,65052L,
-     65052L,65052L,65052L,65052L,65052L,65052L,65053L,65053L,
-     65053L,65053L,65053L,65053L,65053L,65053L,65054L,65054L,
-     65054L,65054L,65054L,65054L,65054L,65054L,65054L,65055L,
-     65055L,65055L,65055L,65055L,65055L,65055L,65055L,65056L,
-     65056L,65056L,65056L,65056L,65056L,65056L,65056L,65057L,
-     65057L,65057L,65057L,65057L,65057L,65057L,65057L,65058L,
-     65058L,65058L,65058L,65058L,65058L,65058L,65058L,65058L,
-     65059L,65059L,65059L,65059L,65059L,65059L,65059L,65059L,
-     65060L,65060L,65060L,65060L,65060L,65060L,65060L,65060L,
-     65061L,65061L,65061L,65061L,65061L,65061L,65061L,65061L,
-     65061L,65062L,65062L,65062L,65062L,65062L,65062L,65062L,
-     65062L,65063L,65063L,65063L,65063L,65063L,65063L,65063L,
-     65063L,65064L,65064L,65064L,65064L,65064L,65064L,65064L,
-     65064L,65064L,65065L,65065L,65065L,65065L,65065L,65065L,
-     65065L,65065L,65066L,65066L,65066L,65066L,65066L,65066L,
-     65066L,65066L,65067L,65067L,65067L,65067L,65067L,65067L,
-     65067L,65067L,65067L,65068L,65068L,65068L,65068L,65068L,
-     65068L,65068L,65068L,65069L,65069L,65069L,65069L,65069L,
-     65069L,65069L,65069L,65069L,65070L,65070L,65070L,65070L,
-     65070L,65070L,65070L,65070L,65071L,65071L,65071L,65071L,
-     65071L,65071L,65071L,65071L,65072L,65072L,65072L,65072L,
-     65072L,65072L,65072L,65072L,65072L,65073L,65073L,65073L,
-     65073L,65073L,65073L,65073L,65073L,65074L,65074L,65074L,
-     65074L,65074L,65074L,65074L,65074L,65074L,65075L,65075L,
-     65075L,65075L,65075L,65075L,65075L,65075L,65076L,65076L,
-     65076L,65076L,65076L,65076L,65076L,65076L,65076L,65077L,
-     65077L,65077L,65077L,65077L,65077L,65077L,65077L,65078L,
-     65078L,65078L,65078L,65078L,65078L,65078L,65078L,65078L,
-     65079L,65079L,65079L,65079L,65079L,65079L,65079L,65079L,
-     65080L,65080L,65080L,65080L,65080L,65080L,65080L,65080L,
-     65080L,65081L,65081L,65081L,65081L,65081L,65081L,65081L,
-     65081L,65082L,65082L,65082L,65082L,65082L,65082L,65082L,
-     65082L,65082L,65083L,65083L,65083L,65083L,65083L,65083L,
-     65083L,65083L,65084L,65084L,65084L,65084L,65084L,65084L,
-     65084L,65084L,65084L,65085L,65085L,65085L,65085L,65085L,
-     65085L,65085L,65085L,65086L,65086L,65086L,65086L,65086L,
-     65086L,65086L,65086L,65086L,65087L,65087L,65087L,65087L,
-     65087L,65087L,65087L,65087L,65088L,65088L,65088L,65088L,
-     65088L,65088L,65088L,65088L,65088L,65089L,65089L,65089L,
-     65089L,65089L,65089L,65089L,65089L,65090L,65090L,65090L,
-     65090L,65090L,65090L,65090L,65090L,65090L,65091L,65091L,
-     65091L,65091L,65091L,65091L,65091L,65091L,65091L,65092L,
-     65092L,65092L,65092L,65092L,65092L,65092L,65092L,65093L,
-     65093L,65093L,65093L,65093L,65093L,65093L,65093L,65093L,
-     65094L,65094L,65094L,65094L,65094L,65094L,65094L,65094L,
-     65095L,65095L,65095L,65095L,65095L,65095L,65095L,65095L,
-     65095L,65096L,65096L,65096L,65096L,65096L,65096L,65096L,
-     65096L,65096L,65097L,65097L,65097L,65097L,65097L,65097L,
-     65097L,65097L,65098L,65098L,65098L,65098L,65098L,65098L,
-     65098L,65098L,65098L,65099L,65099L,65099L,65099L,65099L,
-     65099L,65099L,65099L,65099L,65100L,65100L,65100L,65100L,
-     65100L,65100L,65100L,65100L,65101L,65101L,65101L,65101L,
-     65101L,65101L,65101L,65101L,65101L,65102L,65102L,65102L,
-     65102L,65102L,65102L,65102L,65102L,65102L,65103L,65103L,
-     65103L,65103L,65103L,65103L,65103L,65103L,65103L,65104L,
-     65104L,65104L,65104L,65104L,65104L,65104L,65104L,65105L,
-     65105L,65105L,65105L,65105L,65105L,65105L,65105L,65105L,
-     65106L,65106L,65106L,65106L,65106L,65106L,65106L,65106L,
-     65106L,65107L,65107L,65107L,65107L,65107L,65107L,65107L,
-     65107L,65107L,65108L,65108L,65108L,65108L,65108L,65108L,
-     65108L,65108L,65109L,65109L,65109L,65109L,65109L,65109L,
-     65109L,65109L,65109L,65110L,65110L,65110L,65110L,65110L,
-     65110L,65110L,65110L,65110L,65111L,65111L,65111L,65111L,
-     65111L,65111L,65111L,65111L,65111L,65112L,65112L,65112L,
-     65112L,65112L,65112L,65112L,65112L,65112L,65113L,65113L,
-     65113L,65113L,65113L,65113L,65113L,65113L,65114L,65114L,
-     65114L,65114L,65114L,65114L,65114L,65114L,65114L,65115L,
-     65115L,65115L,65115L,65115L,65115L,65115L,65115L,65115L,
-     65116L,65116L,65116L,65116L,65116L,65116L,65116L,65116L,
-     65116L,65117L,65117L,65117L,65117L,65117L,65117L,65117L,
-     65117L,65117L,65118L,65118L,65118L,65118L,65118L,65118L,
-     65118L,65118L,65118L,65119L,65119L,65119L,65119L,65119L,
-     65119L,65119L,65119L,65120L,65120L,65120L,65120L,65120L,
-     65120L,65120L,65120L,65120L,65121L,65121L,65121L,65121L,
-     65121L,65121L,65121L,65121L,65121L,65122L,65122L,65122L,
-     65122L,65122L,65122L,65122L,65122L,65122L,65123L,65123L,
-     65123L,65123L,65123L,65123L,65123L,65123L,65123L,65124L,
-     65124L,65124L,65124L,65124L,65124L,65124L,65124L,65124L,
-     65125L,65125L,65125L,65125L,65125L,65125L,65125L,65125L,
-     65125L,65126L,65126L,65126L,65126L,65126L,65126L,65126L,
-     65126L,65126L,65127L,65127L,65127L,65127L,65127L,65127L,
-     65127L,65127L,65127L,65128L,65128L,65128L,65128L,65128L,
-     65128L,65128L,65128L,65128L,65129L,65129L,65129L,65129L,
-     65129L,65129L,65129L,65129L,65129L,65130L,65130L,65130L,
-     65130L,65130L,65130L,65130L,65130L,65130L,65131L,65131L,
-     65131L,65131L,65131L,65131L,65131L,65131L,65131L,65132L,
-     65132L,65132L,65132L,65132L,65132L,65132L,65132L,65132L,
-     65133L,65133L,65133L,65133L,65133L,65133L,65133L,65133L,
-     65133L,65134L,65134L,65134L,65134L,65134L,65134L,65134L,
-     65134L,65134L,65135L,65135L,65135L,65135L,65135L,65135L,
-     65135L,65135L,65135L,65136L,65136L,65136L,65136L,65136L,
-     65136L,65136L,65136L,65136L,65137L,65137L,65137L,65137L,
-     65137L,65137L,65137L,65137L,65137L,65138L,65138L,65138L,
-     65138L,65138L,65138L,65138L,65138L,65138L,65139L,65139L,
-     65139L,65139L,65139L,65139L,65139L,65139L,65139L,65140L,
-     65140L,65140L,65140L,65140L,65140L,65140L,65140L,65140L,
-     65140L,65141L,65141L,65141L,65141L,65141L,65141L,65141L,
-     65141L,65141L,65142L,65142L,65142L,65142L,65142L,65142L,
-     65142L,65142L,65142L,65143L,65143L,65143L,65143L,65143L,
-     65143L,65143L,65143L,65143L,65144L,65144L,65144L,65144L,
-     65144L,65144L,65144L,65144L,65144L,65145L,65145L,65145L,
-     65145L,65145L,65145L,65145L,65145L,65145L,65146L,65146L,
-     65146L,65146L,65146L,65146L,65146L,65146L,65146L,65147L,
-     65147L,65147L,65147L,65147L,65147L,65147L,65147L,65147L,
-     65147L,65148L,65148L,65148L,65148L,65148L,65148L,65148L,
-     65148L,65148L,65149L,65149L,65149L,65149L,65149L,65149L,
-     65149L,65149L,65149L,65150L,65150L,65150L,65150L,65150L,
-     65150L,65150L,65150L,65150L,65151L,65151L,65151L,65151L,
-     65151L,65151L,65151L,65151L,65151L,65151L,65152L,65152L,
-     65152L,65152L,65152L,65152L,65152L,65152L,65152L,65153L,
-     65153L,65153L,65153L,65153L,65153L,65153L,65153L,65153L,
-     65154L,65154L,65154L,65154L,65154L,65154L,65154L,65154L,
-     65154L,65155L,65155L,65155L,65155L,65155L,65155L,65155L,
-     65155L,65155L,65155L,65156L,65156L,65156L,65156L,65156L,
-     65156L,65156L,65156L,65156L,65157L,65157L,65157L,65157L,
-     65157L,65157L,65157L,65157L,65157L,65158L,65158L,65158L,
-     65158L,65158L,65158L,65158L,65158L,65158L,65158L,65159L,
-     65159L,65159L,65159L,65159L,65159L,65159L,65159L,65159L,
-     65160L,65160L,65160L,65160L,65160L,65160L,65160L,65160L,
-     65160L,65161L,65161L,65161L,65161L,65161L,65161L,65161L,
-     65161L,65161L,65161L,65162L,65162L,65162L,65162L,65162L,
-     65162L,65162L,65162L,65162L,65163L,65163L,65163L,65163L,
-     65163L,65163L,65163L,65163L,65163L,65164L,65164L,65164L,
-     65164L,65164L,65164L,65164L,65164L,65164L,65164L,65165L,
-     65165L,65165L,65165L,65165L,65165L,65165L,65165L,65165L,
-     65166L,65166L,65166L,65166L,65166L,65166L,65166L,65166L,
-     65166L,65166L,65167L,65167L,65167L,65167L,65167L,65167L,
-     65167L,65167L,65167L,65168L,65168L,65168L,65168L,65168L,
-     65168L,65168L,65168L,65168L,65168L,65169L,65169L,65169L,
-     65169L,65169L,65169L,65169L,65169L,65169L,65170L,65170L,
-     65170L,65170L,65170L,65170L,65170L,65170L,65170L,65170L,
-     65171L,65171L,65171L,65171L,65171L,65171L,65171L,65171L,
-     65171L,65172L,65172L,65172L,65172L,65172L,65172L,65172L,
-     65172L,65172L,65172L,65173L,65173L,65173L,65173L,65173L,
-     65173L,65173L,65173L,65173L,65174L,65174L,65174L,65174L,
-     65174L,65174L,65174L,65174L,65174L,65174L,65175L,65175L,
-     65175L,65175L,65175L,65175L,65175L,65175L,65175L,65176L,
-     65176L,65176L,65176L,65176L,65176L,65176L,65176L,65176L,
-     65176L,65177L,65177L,65177L,65177L,65177L,65177L,65177L,
-     65177L,65177L,65178L,65178L,65178L,65178L,65178L,65178L,
-     65178L,65178L,65178L,65178L,65179L,65179L,65179L,65179L,
-     65179L,65179L,65179L,65179L,65179L,65179L,65180L,65180L,
-     65180L,65180L,65180L,65180L,65180L,65180L,65180L,65181L,
-     65181L,65181L,65181L,65181L,65181L,65181L,65181L,65181L,
-     65181L,65182L,65182L,65182L,65182L,65182L,65182L,65182L,
-     65182L,65182L,65183L,65183L,65183L,65183L,65183L,65183L,
-     65183L,65183L,65183L,65183L,65184L,65184L,65184L,65184L,
-     65184L,65184L,65184L,65184L,65184L,65184L,65185L,65185L,
-     65185L,65185L,65185L,65185L,65185L,65185L,65185L,65186L,
-     65186L,65186L,65186L,65186L,65186L,65186L,65186L,65186L,
-     65186L,65187L,65187L,65187L,65187L,65187L,65187L,65187L,
-     65187L,65187L,65187L,65188L,65188L,65188L,65188L,65188L,
-     65188L,65188L,65188L,65188L,65188L,65189L,65189L,65189L,
-     65189L,65189L,65189L,65189L,65189L,65189L,65190L,65190L,
-     65190L,65190L,65190L,65190L,65190L,65190L,65190L,65190L,
-     65191L,65191L,65191L,65191L,65191L,65191L,65191L,65191L,
-     65191L,65191L,65192L,65192L,65192L,65192L,65192L,65192L,
-     65192L,65192L,65192L,65192L,65193L,65193L,65193L,65193L,
-     65193L,65193L,65193L,65193L,65193L,65194L,65194L,65194L,
-     65194L,65194L,65194L,65194L,65194L,65194L,65194L,65195L,
-     65195L,65195L,65195L,65195L,65195L,65195L,65195L,65195L,
-     65195L,65196L,65196L,65196L,65196L,65196L,65196L,65196L,
-     65196L,65196L,65196L,65197L,65197L,65197L,65197L,65197L,
-     65197L,65197L,65197L,65197L,65197L,65198L,65198L,65198L,
-     65198L,65198L,65198L,65198L,65198L,65198L,65198L,65199L,
-     65199L,65199L,65199L,65199L,65199L,65199L,65199L,65199L,
-     65200L,65200L,65200L,65200L,65200L,65200L,65200L,65200L,
-     65200L,65200L,65201L,65201L,65201L,65201L,65201L,65201L,
-     65201L,65201L,65201L,65201L,65202L,65202L,65202L,65202L,
-     65202L,65202L,65202L,65202L,65202L,65202L,65203L,65203L,
-     65203L,65203L,65203L,65203L,65203L,65203L,65203L,65203L,
-     65204L,65204L,65204L,65204L,65204L,65204L,65204L,65204L,
-     65204L,65204L,65205L,65205L,65205L,65205L,65205L,65205L,
-     65205L,65205L,65205L,65205L,65206L,65206L,65206L,65206L,
-     65206L,65206L,65206L,65206L,65206L,65206L,65207L,65207L,
-     65207L,65207L,65207L,65207L,65207L,65207L,65207L,65207L,
-     65208L,65208L,65208L,65208L,65208L,65208L,65208L,65208L,
-     65208L,65208L,65209L,65209L,65209L,65209L,65209L,65209L,
-     65209L,65209L,65209L,65209L,65210L,65210L,65210L,65210L,
-     65210L,65210L,65210L,65210L,65210L,65210L,65211L,65211L,
-     65211L,65211L,65211L,65211L,65211L,65211L,65211L,65211L,
-     65212L,65212L,65212L,65212L,65212L,65212L,65212L,65212L,
-     65212L,65212L,65213L,65213L,65213L,65213L,65213L,65213L,
-     65213L,65213L,65213L,65213L,65214L,65214L,65214L,65214L,
-     65214L,65214L,65214L,65214L,65214L,65214L,65215L,65215L,
-     65215L,65215L,65215L,65215L,65215L,65215L,65215L,65215L,
-     65215L,65216L,65216L,65216L,65216L,65216L,65216L,65216L,
-     65216L,65216L,65216L,65217L,65217L,65217L,65217L,65217L,
-     65217L,65217L,65217L,65217L,65217L,65218L,65218L,65218L,
-     65218L,65218L,65218L,65218L,65218L,65218L,65218L,65219L,
-     65219L,65219L,65219L,65219L,65219L,65219L,65219L,65219L,
-     65219L,65220L,65220L,65220L,65220L,65220L,65220L,65220L,
-     65220L,65220L,65220L,65221L,65221L,65221L,65221L,65221L,
-     65221L,65221L,65221L,65221L,65221L,65221L,65222L,65222L,
-     65222L,65222L,65222L,65222L,65222L,65222L,65222L,65222L,
-     65223L,65223L,65223L,65223L,65223L,65223L,65223L,65223L,
-     65223L,65223L,65224L,65224L,65224L,65224L,65224L,65224L,
-     65224L,65224L,65224L,65224L,65225L,65225L,65225L,65225L,
-     65225L,65225L,65225L,65225L,65225L,65225L,65225L,65226L,
-     65226L,65226L,65226L,65226L,65226L,65226L,65226L,65226L,
-     65226L,65227L,65227L,65227L,65227L,65227L,65227L,65227L,
-     65227L,65227L,65227L,65228L,65228L,65228L,65228L,65228L,
-     65228L,65228L,65228L,65228L,65228L,65228L,65229L,65229L,
-     65229L,65229L,65229L,65229L,65229L,65229L,65229L,65229L,
-     65230L,65230L,65230L,65230L,65230L,65230L,65230L,65230L,
-     65230L,65230L,65231L,65231L,65231L,65231L,65231L,65231L,
-     65231L,65231L,65231L,65231L,65231L,65232L,65232L,65232L,
-     65232L,65232L,65232L,65232L,65232L,65232L,65232L,65233L,
-     65233L,65233L,65233L,65233L,65233L,65233L,65233L,65233L,
-     65233L,65233L,65234L,65234L,65234L,65234L,65234L,65234L,
-     65234L,65234L,65234L,65234L,65235L,65235L,65235L,65235L,
-     65235L,65235L,65235L,65235L,65235L,65235L,65236L,65236L,
-     65236L,65236L,65236L,65236L,65236L,65236L,65236L,65236L,
-     65236L,65237L,65237L,65237L,65237L,65237L,65237L,65237L,
-     65237L,65237L,65237L,65238L,65238L,65238L,65238L,65238L,
-     65238L,65238L,65238L,65238L,65238L,65238L,65239L,65239L,
-     65239L,65239L,65239L,65239L,65239L,65239L,65239L,65239L,
-     65240L,65240L,65240L,65240L,65240L,65240L,65240L,65240L,
-     65240L,65240L,65240L,65241L,65241L,65241L,65241L,65241L,
-     65241L,65241L,65241L,65241L,65241L,65241L,65242L,65242L,
-     65242L,65242L,65242L,65242L,65242L,65242L,65242L,65242L,
-     65243L,65243L,65243L,65243L,65243L,65243L,65243L,65243L,
-     65243L,65243L,65243L,65244L,65244L,65244L,65244L,65244L,
-     65244L,65244L,65244L,65244L,65244L,65245L,65245L,65245L,
-     65245L,65245L,65245L,65245L,65245L,65245L,65245L,65245L,
-     65246L,65246L,65246L,65246L,65246L,65246L,65246L,65246L,
-     65246L,65246L,65246L,65247L,65247L,65247L,65247L,65247L,
-     65247L,65247L,65247L,65247L,65247L,65248L,65248L,65248L,
-     65248L,65248L,65248L,65248L,65248L,65248L,65248L,65248L,
-     65249L,65249L,65249L,65249L,65249L,65249L,65249L,65249L,
-     65249L,65249L,65249L,65250L,65250L,65250L,65250L,65250L,
-     65250L,65250L,65250L,65250L,65250L,65251L,65251L,65251L,
-     65251L,65251L,65251L,65251L,65251L,65251L,65251L,65251L,
-     65252L,65252L,65252L,65252L,65252L,65252L,65252L,65252L,
-     65252L,65252L,65252L,65253L,65253L,65253L,65253L,65253L,
-     65253L,65253L,65253L,65253L,65253L,65253L,65254L,65254L,
-     65254L,65254L,65254L,65254L,65254L,65254L,65254L,65254L,
-     65255L,65255L,65255L,65255L,65255L,65255L,65255L,65255L,
-     65255L,65255L,65255L,65256L,65256L,65256L,65256L,65256L,
-     65256L,65256L,65256L,65256L,65256L,65256L,65257L,65257L,
-     65257L,65257L,65257L,65257L,65257L,65257L,65257L,65257L,
-     65257L,65258L,65258L,65258L,65258L,65258L,65258L,65258L,
-     65258L,65258L,65258L,65258L,65259L,65259L,65259L,65259L,
-     65259L,65259L,65259L,65259L,65259L,65259L,65259L,65260L,
-     65260L,65260L,65260L,65260L,65260L,65260L,65260L,65260L,
-     65260L,65260L,65261L,65261L,65261L,65261L,65261L,65261L,
-     65261L,65261L,65261L,65261L,65261L,65262L,65262L,65262L,
-     65262L,65262L,65262L,65262L,65262L,65262L,65262L,65262L,
-     65263L,65263L,65263L,65263L,65263L,65263L,65263L,65263L,
-     65263L,65263L,65263L,65264L,65264L,65264L,65264L,65264L,
-     65264L,65264L,65264L,65264L,65264L,65264L,65265L,65265L,
-     65265L,65265L,65265L,65265L,65265L,65265L,65265L,65265L,
-     65265L,65266L,65266L,65266L,65266L,65266L,65266L,65266L,
-     65266L,65266L,65266L,65266L,65267L,65267L,65267L,65267L,
-     65267L,65267L,65267L,65267L,65267L,65267L,65267L,65268L,
-     65268L,65268L,65268L,65268L,65268L,65268L,65268L,65268L,
-     65268L,65268L,65269L,65269L,65269L,65269L,65269L,65269L,
-     65269L,65269L,65269L,65269L,65269L,65270L,65270L,65270L,
-     65270L,65270L,65270L,65270L,65270L,65270L,65270L,65270L,
-     65271L,65271L,65271L,65271L,65271L,65271L,65271L,65271L,
-     65271L,65271L,65271L,65272L,65272L,65272L,65272L,65272L,
-     65272L,65272L,65272L,65272L,65272L,65272L,65273L,65273L,
-     65273L,65273L,65273L,65273L,65273L,65273L,65273L,65273L,
-     65273L,65274L,65274L,65274L,65274L,65274L,65274L,65274L,
-     65274L,65274L,65274L,65274L,65274L,65275L,65275L,65275L,
-     65275L,65275L,65275L,65275L,65275L,65275L,65275L,65275L,
-     65276L,65276L,65276L,65276L,65276L,65276L,65276L,65276L,
-     65276L,65276L,65276L,65277L,65277L,65277L,65277L,65277L,
-     65277L,65277L,65277L,65277L,65277L,65277L,65278L,65278L,
-     65278L,65278L,65278L,65278L,65278L,65278L,65278L,65278L,
-     65278L,65278L,65279L,65279L,65279L,65279L,65279L,65279L,
-     65279L,65279L,65279L,65279L,65279L,65280L,65280L,65280L,
-     65280L,65280L,65280L,65280L,65280L,65280L,65280L,65280L,
-     65281L,65281L,65281L,65281L,65281L,65281L,65281L,65281L,
-     65281L,65281L,65281L,65281L,65282L,65282L,65282L,65282L,
-     65282L,65282L,65282L,65282L,65282L,65282L,65282L,65283L,
-     65283L,65283L,65283L,65283L,65283L,65283L,65283L,65283L,
-     65283L,65283L,65283L,65284L,65284L,65284L,65284L,65284L,
-     65284L,65284L,65284L,65284L,65284L,65284L,65285L,65285L,
-     65285L,65285L,65285L,65285L,65285L,65285L,65285L,65285L,
-     65285L,65286L,65286L,65286L,65286L,65286L,65286L,65286L,
-     65286L,65286L,65286L,65286L,65286L,65287L,65287L,65287L,
-     65287L,65287L,65287L,65287L,65287L,65287L,65287L,65287L,
-     65288L,65288L,65288L,65288L,65288L,65288L,65288L,65288L,
-     65288L,65288L,65288L,65288L,65289L,65289L,65289L,65289L,
-     65289L,65289L,65289L,65289L,65289L,65289L,65289L,65290L,
-     65290L,65290L,65290L,65290L,65290L,65290L,65290L,65290L,
-     65290L,65290L,65290L,65291L,65291L,65291L,65291L,65291L,
-     65291L,65291L,65291L,65291L,65291L,65291L,65291L,65292L,
-     65292L,65292L,65292L,65292L,65292L,65292L,65292L,65292L,
-     65292L,65292L,65293L,65293L,65293L,65293L,65293L,65293L,
-     65293L,65293L,65293L,65293L,65293L,65293L,65294L,65294L,
-     65294L,65294L,65294L,65294L,65294L,65294L,65294L,65294L,
-     65294L,65295L,65295L,65295L,65295L,65295L,65295L,65295L,
-     65295L,65295L,65295L,65295L,65295L,65296L,65296L,65296L,
-     65296L,65296L,65296L,65296L,65296L,65296L,65296L,65296L,
-     65296L,65297L,65297L,65297L,65297L,65297L,65297L,65297L,
-     65297L,65297L,65297L,65297L,65297L,65298L,65298L,65298L,
-     65298L,65298L,65298L,65298L,65298L,65298L,65298L,65298L,
-     65299L,65299L,65299L,65299L,65299L,65299L,65299L,65299L,
-     65299L,65299L,65299L,65299L,65300L,65300L,65300L,65300L,
-     65300L,65300L,65300L,65300L,65300L,65300L,65300L,65300L,
-     65301L,65301L,65301L,65301L,65301L,65301L,65301L,65301L,
-     65301L,65301L,65301L,65301L,65302L,65302L,65302L,65302L,
-     65302L,65302L,65302L,65302L,65302L,65302L,65302L,65302L,
-     65303L,65303L,65303L,65303L,65303L,65303L,65303L,65303L,
-     65303L,65303L,65303L,65303L,65304L,65304L,65304L,65304L,
-     65304L,65304L,65304L,65304L,65304L,65304L,65304L,65305L,
-     65305L,65305L,65305L,65305L,65305L,65305L,65305L,65305L,
-     65305L,65305L,65305L,65306L,65306L,65306L,65306L,65306L,
-     65306L,65306L,65306L,65306L,65306L,65306L,65306L,65307L,
-     65307L,65307L,65307L,65307L,65307L,65307L,65307L,65307L,
-     65307L,65307L,65307L,65308L,65308L,65308L,65308L,65308L,
-     65308L,65308L,65308L,65308L,65308L,65308L,65308L,65309L,
-     65309L,65309L,65309L,65309L,65309L,65309L,65309L,65309L,
-     65309L,65309L,65309L,65310L,65310L,65310L,65310L,65310L,
-     65310L,65310L,65310L,65310L,65310L,65310L,65310L,65311L,
-     65311L,65311L,65311L,65311L,65311L,65311L,65311L,65311L,
-     65311L,65311L,65311L,65312L,65312L,65312L,65312L,65312L,
-     65312L,65312L,65312L,65312L,65312L,65312L,65312L,65312L,
-     65313L,65313L,65313L,65313L,65313L,65313L,65313L,65313L,
-     65313L,65313L,65313L,65313L,65314L,65314L,65314L,65314L,
-     65314L,65314L,65314L,65314L,65314L,65314L,65314L,65314L,
-     65315L,65315L,65315L,65315L,65315L,65315L,65315L,65315L,
-     65315L,65315L,65315L,65315L,65316L,65316L,65316L,65316L,
-     65316L,65316L,65316L,65316L,65316L,65316L,65316L,65316L,
-     65317L,65317L,65317L,65317L,65317L,65317L,65317L,65317L,
-     65317L,65317L,65317L,65317L,65317L,65318L,65318L,65318L,
-     65318L,65318L,65318L,65318L,65318L,65318L,65318L,65318L,
-     65318L,65319L,65319L,65319L,65319L,65319L,65319L,65319L,
-     65319L,65319L,65319L,65319L,65319L,65320L,65320L,65320L,
-     65320L,65320L,65320L,65320L,65320L,65320L,65320L,65320L,
-     65320L,65320L,65321L,65321L,65321L,65321L,65321L,65321L,
-     65321L,65321L,65321L,65321L,65321L,65321L,65322L,65322L,
-     65322L,65322L,65322L,65322L,65322L,65322L,65322L,65322L,
-     65322L,65322L,65323L,65323L,65323L,65323L,65323L,65323L,
-     65323L,65323L,65323L,65323L,65323L,65323L,65323L,65324L,
-     65324L,65324L,65324L,65324L,65324L,65324L,65324L,65324L,
-     65324L,65324L,65324L,65325L,65325L,65325L,65325L,65325L,
-     65325L,65325L,65325L,65325L,65325L,65325L,65325L,65325L,
-     65326L,65326L,65326L,65326L,65326L,65326L,65326L,65326L,
-     65326L,65326L,65326L,65326L,65327L,65327L,65327L,65327L,
-     65327L,65327L,65327L,65327L,65327L,65327L,65327L,65327L,
-     65327L,65328L,65328L,65328L,65328L,65328L,65328L,65328L,
-     65328L,65328L,65328L,65328L,65328L,65329L,65329L,65329L,
-     65329L,65329L,65329L,65329L,65329L,65329L,65329L,65329L,
-     65329L,65329L,65330L,65330L,65330L,65330L,65330L,65330L,
-     65330L,65330L,65330L,65330L,65330L,65330L,65330L,65331L,
-     65331L,65331L,65331L,65331L,65331L,65331L,65331L,65331L,
-     65331L,65331L,65331L,65332L,65332L,65332L,65332L,65332L,
-     65332L,65332L,65332L,65332L,65332L,65332L,65332L,65332L,
-     65333L,65333L,65333L,65333L,65333L,65333L,65333L,65333L,
-     65333L,65333L,65333L,65333L,65333L,65334L,65334L,65334L,
-     65334L,65334L,65334L,65334L,65334L,65334L,65334L,65334L,
-     65334L,65335L,65335L,65335L,65335L,65335L,65335L,65335L,
-     65335L,65335L,65335L,65335L,65335L,65335L,65336L,65336L,
-     65336L,65336L,65336L,65336L,65336L,65336L,65336L,65336L,
-     65336L,65336L,65336L,65337L,65337L,65337L,65337L,65337L,
-     65337L,65337L,65337L,65337L,65337L,65337L,65337L,65337L,
-     65338L,65338L,65338L,65338L,65338L,65338L,65338L,65338L,
-     65338L,65338L,65338L,65338L,65338L,65339L,65339L,65339L,
-     65339L,65339L,65339L,65339L,65339L,65339L,65339L,65339L,
-     65339L,65339L,65340L,65340L,65340L,65340L,65340L,65340L,
-     65340L,65340L,65340L,65340L,65340L,65340L,65340L,65341L,
-     65341L,65341L,65341L,65341L,65341L,65341L,65341L,65341L,
-     65341L,65341L,65341L,65341L,65342L,65342L,65342L,65342L,
-     65342L,65342L,65342L,65342L,65342L,65342L,65342L,65342L,
-     65342L,65343L,65343L,65343L,65343L,65343L,65343L,65343L,
-     65343L,65343L,65343L,65343L,65343L,65343L,65344L,65344L,
-     65344L,65344L,65344L,65344L,65344L,65344L,65344L,65344L,
-     65344L,65344L,65344L,65345L,65345L,65345L,65345L,65345L,
-     65345L,65345L,65345L,65345L,65345L,65345L,65345L,65345L,
-     65346L,65346L,65346L,65346L,65346L,65346L,65346L,65346L,
-     65346L,65346L,65346L,65346L,65346L,65347L,65347L,65347L,
-     65347L,65347L,65347L,65347L,65347L,65347L,65347L,65347L,
-     65347L,65347L,65348L,65348L,65348L,65348L,65348L,65348L,
-     65348L,65348L,65348L,65348L,65348L,65348L,65348L,65348L,
-     65349L,65349L,65349L,65349L,65349L,65349L,65349L,65349L,
-     65349L,65349L,65349L,65349L,65349L,65350L,65350L,65350L,
-     65350L,65350L,65350L,65350L,65350L,65350L,65350L,65350L,
-     65350L,65350L,65351L,65351L,65351L,65351L,65351L,65351L,
-     65351L,65351L,65351L,65351L,65351L,65351L,65351L,65352L,
-     65352L,65352L,65352L,65352L,65352L,65352L,65352L,65352L,
-     65352L,65352L,65352L,65352L,65352L,65353L,65353L,65353L,
-     65353L,65353L,65353L,65353L,65353L,65353L,65353L,65353L,
-     65353L,65353L,65354L,65354L,65354L,65354L,65354L,65354L,
-     65354L,65354L,65354L,65354L,65354L,65354L,65354L,65354L,
-     65355L,65355L,65355L,65355L,65355L,65355L,65355L,65355L,
-     65355L,65355L,65355L,65355L,65355L,65356L,65356L,65356L,
-     65356L,65356L,65356L,65356L,65356L,65356L,65356L,65356L,
-     65356L,65356L,65356L,65357L,65357L,65357L,65357L,65357L,
-     65357L,65357L,65357L,65357L,65357L,65357L,65357L,65357L,
-     65358L,65358L,65358L,65358L,65358L,65358L,65358L,65358L,
-     65358L,65358L,65358L,65358L,65358L,65358L,65359L,65359L,
-     65359L,65359L,65359L,65359L,65359L,65359L,65359L,65359L,
-     65359L,65359L,65359L,65360L,65360L,65360L,65360L,65360L,
-     65360L,65360L,65360L,65360L,65360L,65360L,65360L,65360L,
-     65360L,65361L,65361L,65361L,65361L,65361L,65361L,65361L,
-     65361L,65361L,65361L,65361L,65361L,65361L,65361L,65362L,
-     65362L,65362L,65362L,65362L,65362L,65362L,65362L,65362L,
-     65362L,65362L,65362L,65362L,65362L,65363L,65363L,65363L,
-     65363L,65363L,65363L,65363L,65363L,65363L,65363L,65363L,
-     65363L,65363L,65364L,65364L,65364L,65364L,65364L,65364L,
-     65364L,65364L,65364L,65364L,65364L,65364L,65364L,65364L,
-     65365L,65365L,65365L,65365L,65365L,65365L,65365L,65365L,
-     65365L,65365L,65365L,65365L,65365L,65365L,65366L,65366L,
-     65366L,65366L,65366L,65366L,65366L,65366L,65366L,65366L,
-     65366L,65366L,65366L,65366L,65367L,65367L,65367L,65367L,
-     65367L,65367L,65367L,65367L,65367L,65367L,65367L,65367L,
-     65367L,65367L,65368L,65368L,65368L,65368L,65368L,65368L,
-     65368L,65368L,65368L,65368L,65368L,65368L,65368L,65368L,
-     65369L,65369L,65369L,65369L,65369L,65369L,65369L,65369L,
-     65369L,65369L,65369L,65369L,65369L,65369L,65370L,65370L,
-     65370L,65370L,65370L,65370L,65370L,65370L,65370L,65370L,
-     65370L,65370L,65370L,65370L,65371L,65371L,65371L,65371L,
-     65371L,65371L,65371L,65371L,65371L,65371L,65371L,65371L,
-     65371L,65371L,65372L,65372L,65372L,65372L,65372L,65372L,
-     65372L,65372L,65372L,65372L,65372L,65372L,65372L,65372L,
-     65373L,65373L,65373L,65373L,65373L,65373L,65373L,65373L,
-     65373L,65373L,65373L,65373L,65373L,65373L,65373L,65374L,
-     65374L,65374L,65374L,65374L,65374L,65374L,65374L,65374L,
-     65374L,65374L,65374L,65374L,65374L,65375L,65375L,65375L,
-     65375L,65375L,65375L,65375L,65375L,65375L,65375L,65375L,
-     65375L,65375L,65375L,65376L,65376L,65376L,65376L,65376L,
-     65376L,65376L,65376L,65376L,65376L,65376L,65376L,65376L,
-     65376L,65377L,65377L,65377L,65377L,65377L,65377L,65377L,
-     65377L,65377L,65377L,65377L,65377L,65377L,65377L,65377L,
-     65378L,65378L,65378L,65378L,65378L,65378L,65378L,65378L,
-     65378L,65378L,65378L,65378L,65378L,65378L,65379L,65379L,
-     65379L,65379L,65379L,65379L,65379L,65379L,65379L,65379L,
-     65379L,65379L,65379L,65379L,65379L,65380L,65380L,65380L,
-     65380L,65380L,65380L,65380L,65380L,65380L,65380L,65380L,
-     65380L,65380L,65380L,65381L,65381L,65381L,65381L,65381L,
-     65381L,65381L,65381L,65381L,65381L,65381L,65381L,65381L,
-     65381L,65381L,65382L,65382L,65382L,65382L,65382L,65382L,
-     65382L,65382L,65382L,65382L,65382L,65382L,65382L,65382L,
-     65383L,65383L,65383L,65383L,65383L,65383L,65383L,65383L,
-     65383L,65383L,65383L,65383L,65383L,65383L,65383L,65384L,
-     65384L,65384L,65384L,65384L,65384L,65384L,65384L,65384L,
-     65384L,65384L,65384L,65384L,65384L,65384L,65385L,65385L,
-     65385L,65385L,65385L,65385L,65385L,65385L,65385L,65385L,
-     65385L,65385L,65385L,65385L,65385L,65386L,65386L,65386L,
-     65386L,65386L,65386L,65386L,65386L,65386L,65386L,65386L,
-     65386L,65386L,65386L,65387L,65387L,65387L,65387L,65387L,
-     65387L,65387L,65387L,65387L,65387L,65387L,65387L,65387L,
-     65387L,65387L,65388L,65388L,65388L,65388L,65388L,65388L,
-     65388L,65388L,65388L,65388L,65388L,65388L,65388L,65388L,
-     65388L,65389L,65389L,65389L,65389L,65389L,65389L,65389L,
-     65389L,65389L,65389L,65389L,65389L,65389L,65389L,65389L,
-     65390L,65390L,65390L,65390L,65390L,65390L,65390L,65390L,
-     65390L,65390L,65390L,65390L,65390L,65390L,65390L,65391L,
-     65391L,65391L,65391L,65391L,65391L,65391L,65391L,65391L,
-     65391L,65391L,65391L,65391L,65391L,65391L,65392L,65392L,
-     65392L,65392L,65392L,65392L,65392L,65392L,65392L,65392L,
-     65392L,65392L,65392L,65392L,65392L,65393L,65393L,65393L,
-     65393L,65393L,65393L,65393L,65393L,65393L,65393L,65393L,
-     65393L,65393L,65393L,65393L,65393L,65394L,65394L,65394L,
-     65394L,65394L,65394L,65394L,65394L,65394L,65394L,65394L,
-     65394L,65394L,65394L,65394L,65395L,65395L,65395L,65395L,
-     65395L,65395L,65395L,65395L,65395L,65395L,65395L,65395L,
-     65395L,65395L,65395L,65396L,65396L,65396L,65396L,65396L,
-     65396L,65396L,65396L,65396L,65396L,65396L,65396L,65396L,
-     65396L,65396L,65397L,65397L,65397L,65397L,65397L,65397L,
-     65397L,65397L,65397L,65397L,65397L,65397L,65397L,65397L,
-     65397L,65397L,65398L,65398L,65398L,65398L,65398L,65398L,
-     65398L,65398L,65398L,65398L,65398L,65398L,65398L,65398L,
-     65398L,65399L,65399L,65399L,65399L,65399L,65399L,65399L,
-     65399L,65399L,65399L,65399L,65399L,65399L,65399L,65399L,
-     65399L,65400L,65400L,65400L,65400L,65400L,65400L,65400L,
-     65400L,65400L,65400L,65400L,65400L,65400L,65400L,65400L,
-     65401L,65401L,65401L,65401L,65401L,65401L,65401L,65401L,
-     65401L,65401L,65401L,65401L,65401L,65401L,65401L,65401L,
-     65402L,65402L,65402L,65402L,65402L,65402L,65402L,65402L,
-     65402L,65402L,65402L,65402L,65402L,65402L,65402L,65402L,
-     65403L,65403L,65403L,65403L,65403L,65403L,65403L,65403L,
-     65403L,65403L,65403L,65403L,65403L,65403L,65403L,65404L,
-     65404L,65404L,65404L,65404L,65404L,65404L,65404L,65404L,
-     65404L,65404L,65404L,65404L,65404L,65404L,65404L,65405L,
-     65405L,65405L,65405L,65405L,65405L,65405L,65405L,65405L,
-     65405L,65405L,65405L,65405L,65405L,65405L,65405L,65406L,
-     65406L,65406L,65406L,65406L,65406L,65406L,65406L,65406L,
-     65406L,65406L,65406L,65406L,65406L,65406L,65406L,65407L,
-     65407L,65407L,65407L,65407L,65407L,65407L,65407L,65407L,
-     65407L,65407L,65407L,65407L,65407L,65407L,65407L,65408L,
-     65408L,65408L,65408L,65408L,65408L,65408L,65408L,65408L,
-     65408L,65408L,65408L,65408L,65408L,65408L,65408L,65409L,
-     65409L,65409L,65409L,65409L,65409L,65409L,65409L,65409L,
-     65409L,65409L,65409L,65409L,65409L,65409L,65409L,65410L,
-     65410L,65410L,65410L,65410L,65410L,65410L,65410L,65410L,
-     65410L,65410L,65410L,65410L,65410L,65410L,65410L,65411L,
-     65411L,65411L,65411L,65411L,65411L,65411L,65411L,65411L,
-     65411L,65411L,65411L,65411L,65411L,65411L,65411L,65412L,
-     65412L,65412L,65412L,65412L,65412L,65412L,65412L,65412L,
-     65412L,65412L,65412L,65412L,65412L,65412L,65412L,65412L,
-     65413L,65413L,65413L,65413L,65413L,65413L,65413L,65413L,
-     65413L,65413L,65413L,65413L,65413L,65413L,65413L,65413L,
-     65414L,65414L,65414L,65414L,65414L,65414L,65414L,65414L,
-     65414L,65414L,65414L,65414L,65414L,65414L,65414L,65414L,
-     65415L,65415L,65415L,65415L,65415L,65415L,65415L,65415L,
-     65415L,65415L,65415L,65415L,65415L,65415L,65415L,65415L,
-     65415L,65416L,65416L,65416L,65416L,65416L,65416L,65416L,
-     65416L,65416L,65416L,65416L,65416L,65416L,65416L,65416L,
-     65416L,65416L,65417L,65417L,65417L,65417L,65417L,65417L,
-     65417L,65417L,65417L,65417L,65417L,65417L,65417L,65417L,
-     65417L,65417L,65418L,65418L,65418L,65418L,65418L,65418L,
-     65418L,65418L,65418L,65418L,65418L,65418L,65418L,65418L,
-     65418L,65418L,65418L,65419L,65419L,65419L,65419L,65419L,
-     65419L,65419L,65419L,65419L,65419L,65419L,65419L,65419L,
-     65419L,65419L,65419L,65419L,65420L,65420L,65420L,65420L,
-     65420L,65420L,65420L,65420L,65420L,65420L,65420L,65420L,
-     65420L,65420L,65420L,65420L,65420L,65421L,65421L,65421L,
-     65421L,65421L,65421L,65421L,65421L,65421L,65421L,65421L,
-     65421L,65421L,65421L,65421L,65421L,65422L,65422L,65422L,
-     65422L,65422L,65422L,65422L,65422L,65422L,65422L,65422L,
-     65422L,65422L,65422L,65422L,65422L,65422L,65423L,65423L,
-     65423L,65423L,65423L,65423L,65423L,65423L,65423L,65423L,
-     65423L,65423L,65423L,65423L,65423L,65423L,65423L,65423L,
-     65424L,65424L,65424L,65424L,65424L,65424L,65424L,65424L,
-     65424L,65424L,65424L,65424L,65424L,65424L,65424L,65424L,
-     65424L,65425L,65425L,65425L,65425L,65425L,65425L,65425L,
-     65425L,65425L,65425L,65425L,65425L,65425L,65425L,65425L,
-     65425L,65425L,65426L,65426L,65426L,65426L,65426L,65426L,
-     65426L,65426L,65426L,65426L,65426L,65426L,65426L,65426L,
-     65426L,65426L,65426L,65427L,65427L,65427L,65427L,65427L,
-     65427L,65427L,65427L,65427L,65427L,65427L,65427L,65427L,
-     65427L,65427L,65427L,65427L,65427L,65428L,65428L,65428L,
-     65428L,65428L,65428L,65428L,65428L,65428L,65428L,65428L,
-     65428L,65428L,65428L,65428L,65428L,65428L,65429L,65429L,
-     65429L,65429L,65429L,65429L,65429L,65429L,65429L,65429L,
-     65429L,65429L,65429L,65429L,65429L,65429L,65429L,65429L,
-     65430L,65430L,65430L,65430L,65430L,65430L,65430L,65430L,
-     65430L,65430L,65430L,65430L,65430L,65430L,65430L,65430L,
-     65430L,65431L,65431L,65431L,65431L,65431L,65431L,65431L,
-     65431L,65431L,65431L,65431L,65431L,65431L,65431L,65431L,
-     65431L,65431L,65431L,65432L,65432L,65432L,65432L,65432L,
-     65432L,65432L,65432L,65432L,65432L,65432L,65432L,65432L,
-     65432L,65432L,65432L,65432L,65432L,65433L,65433L,65433L,
-     65433L,65433L,65433L,65433L,65433L,65433L,65433L,65433L,
-     65433L,65433L,65433L,65433L,65433L,65433L,65433L,65434L,
-     65434L,65434L,65434L,65434L,65434L,65434L,65434L,65434L,
-     65434L,65434L,65434L,65434L,65434L,65434L,65434L,65434L,
-     65434L,65435L,65435L,65435L,65435L,65435L,65435L,65435L,
-     65435L,65435L,65435L,65435L,65435L,65435L,65435L,65435L,
-     65435L,65435L,65435L,65436L,65436L,65436L,65436L,65436L,
-     65436L,65436L,65436L,65436L,65436L,65436L,65436L,65436L,
-     65436L,65436L,65436L,65436L,65436L,65437L,65437L,65437L,
-     65437L,65437L,65437L,65437L,65437L,65437L,65437L,65437L,
-     65437L,65437L,65437L,65437L,65437L,65437L,65437L,65438L,
-     65438L,65438L,65438L,65438L,65438L,65438L,65438L,65438L,
-     65438L,65438L,65438L,65438L,65438L,65438L,65438L,65438L,
-     65438L,65439L,65439L,65439L,65439L,65439L,65439L,65439L,
-     65439L,65439L,65439L,65439L,65439L,65439L,65439L,65439L,
-     65439L,65439L,65439L,65439L,65440L,65440L,65440L,65440L,
-     65440L,65440L,65440L,65440L,65440L,65440L,65440L,65440L,
-     65440L,65440L,65440L,65440L,65440L,65440L,65441L,65441L,
-     65441L,65441L,65441L,65441L,65441L,65441L,65441L,65441L,
-     65441L,65441L,65441L,65441L,65441L,65441L,65441L,65441L,
-     65441L,65442L,65442L,65442L,65442L,65442L,65442L,65442L,
-     65442L,65442L,65442L,65442L,65442L,65442L,65442L,65442L,
-     65442L,65442L,65442L,65442L,65443L,65443L,65443L,65443L,
-     65443L,65443L,65443L,65443L,65443L,65443L,65443L,65443L,
-     65443L,65443L,65443L,65443L,65443L,65443L,65443L,65444L,
-     65444L,65444L,65444L,65444L,65444L,65444L,65444L,65444L,
-     65444L,65444L,65444L,65444L,65444L,65444L,65444L,65444L,
-     65444L,65445L,65445L,65445L,65445L,65445L,65445L,65445L,
-     65445L,65445L,65445L,65445L,65445L,65445L,65445L,65445L,
-     65445L,65445L,65445L,65445L,65445L,65446L,65446L,65446L,
-     65446L,65446L,65446L,65446L,65446L,65446L,65446L,65446L,
-     65446L,65446L,65446L,65446L,65446L,65446L,65446L,65446L,
-     65447L,65447L,65447L,65447L,65447L,65447L,65447L,65447L,
-     65447L,65447L,65447L,65447L,65447L,65447L,65447L,65447L,
-     65447L,65447L,65447L,65448L,65448L,65448L,65448L,65448L,
-     65448L,65448L,65448L,65448L,65448L,65448L,65448L,65448L,
-     65448L,65448L,65448L,65448L,65448L,65448L,65449L,65449L,
-     65449L,65449L,65449L,65449L,65449L,65449L,65449L,65449L,
-     65449L,65449L,65449L,65449L,65449L,65449L,65449L,65449L,
-     65449L,65449L,65450L,65450L,65450L,65450L,65450L,65450L,
-     65450L,65450L,65450L,65450L,65450L,65450L,65450L,65450L,
-     65450L,65450L,65450L,65450L,65450L,65451L,65451L,65451L,
-     65451L,65451L,65451L,65451L,65451L,65451L,65451L,65451L,
-     65451L,65451L,65451L,65451L,65451L,65451L,65451L,65451L,
-     65451L,65452L,65452L,65452L,65452L,65452L,65452L,65452L,
-     65452L,65452L,65452L,65452L,65452L,65452L,65452L,65452L,
-     65452L,65452L,65452L,65452L,65452L,65453L,65453L,65453L,
-     65453L,65453L,65453L,65453L,65453L,65453L,65453L,65453L,
-     65453L,65453L,65453L,65453L,65453L,65453L,65453L,65453L,
-     65453L,65454L,65454L,65454L,65454L,65454L,65454L,65454L,
-     65454L,65454L,65454L,65454L,65454L,65454L,65454L,65454L,
-     65454L,65454L,65454L,65454L,65454L,65455L,65455L,65455L,
-     65455L,65455L,65455L,65455L,65455L,65455L,65455L,65455L,
-     65455L,65455L,65455L,65455L,65455L,65455L,65455L,65455L,
-     65455L,65456L,65456L,65456L,65456L,65456L,65456L,65456L,
-     65456L,65456L,65456L,65456L,65456L,65456L,65456L,65456L,
-     65456L,65456L,65456L,65456L,65456L,65457L,65457L,65457L,
-     65457L,65457L,65457L,65457L,65457L,65457L,65457L,65457L,
-     65457L,65457L,65457L,65457L,65457L,65457L,65457L,65457L,
-     65457L,65457L,65458L,65458L,65458L,65458L,65458L,65458L,
-     65458L,65458L,65458L,65458L,65458L,65458L,65458L,65458L,
-     65458L,65458L,65458L,65458L,65458L,65458L,65459L,65459L,
-     65459L,65459L,65459L,65459L,65459L,65459L,65459L,65459L,
-     65459L,65459L,65459L,65459L,65459L,65459L,65459L,65459L,
-     65459L,65459L,65459L,65460L,65460L,65460L,65460L,65460L,
-     65460L,65460L,65460L,65460L,65460L,65460L,65460L,65460L,
-     65460L,65460L,65460L,65460L,65460L,65460L,65460L,65460L,
-     65461L,65461L,65461L,65461L,65461L,65461L,65461L,65461L,
-     65461L,65461L,65461L,65461L,65461L,65461L,65461L,65461L,
-     65461L,65461L,65461L,65461L,65461L,65462L,65462L,65462L,
-     65462L,65462L,65462L,65462L,65462L,65462L,65462L,65462L,
-     65462L,65462L,65462L,65462L,65462L,65462L,65462L,65462L,
-     65462L,65462L,65463L,65463L,65463L,65463L,65463L,65463L,
-     65463L,65463L,65463L,65463L,65463L,65463L,65463L,65463L,
-     65463L,65463L,65463L,65463L,65463L,65463L,65463L,65464L,
-     65464L,65464L,65464L,65464L,65464L,65464L,65464L,65464L,
-     65464L,65464L,65464L,65464L,65464L,65464L,65464L,65464L,
-     65464L,65464L,65464L,65464L,65464L,65465L,65465L,65465L,
-     65465L,65465L,65465L,65465L,65465L,65465L,65465L,65465L,
-     65465L,65465L,65465L,65465L,65465L,65465L,65465L,65465L,
-     65465L,65465L,65466L,65466L,65466L,65466L,65466L,65466L,
-     65466L,65466L,65466L,65466L,65466L,65466L,65466L,65466L,
-     65466L,65466L,65466L,65466L,65466L,65466L,65466L,65466L,
-     65467L,65467L,65467L,65467L,65467L,65467L,65467L,65467L,
-     65467L,65467L,65467L,65467L,65467L,65467L,65467L,65467L,
-     65467L,65467L,65467L,65467L,65467L,65467L,65468L,65468L,
-     65468L,65468L,65468L,65468L,65468L,65468L,65468L,65468L,
-     65468L,65468L,65468L,65468L,65468L,65468L,65468L,65468L,
-     65468L,65468L,65468L,65468L,65469L,65469L,65469L,65469L,
-     65469L,65469L,65469L,65469L,65469L,65469L,65469L,65469L,
-     65469L,65469L,65469L,65469L,65469L,65469L,65469L,65469L,
-     65469L,65469L,65470L,65470L,65470L,65470L,65470L,65470L,
-     65470L,65470L,65470L,65470L,65470L,65470L,65470L,65470L,
-     65470L,65470L,65470L,65470L,65470L,65470L,65470L,65470L,
-     65471L,65471L,65471L,65471L,65471L,65471L,65471L,65471L,
-     65471L,65471L,65471L,65471L,65471L,65471L,65471L,65471L,
-     65471L,65471L,65471L,65471L,65471L,65471L,65471L,65472L,
-     65472L,65472L,65472L,65472L,65472L,65472L,65472L,65472L,
-     65472L,65472L,65472L,65472L,65472L,65472L,65472L,65472L,
-     65472L,65472L,65472L,65472L,65472L,65472L,65473L,65473L,
-     65473L,65473L,65473L,65473L,65473L,65473L,65473L,65473L,
-     65473L,65473L,65473L,65473L,65473L,65473L,65473L,65473L,
-     65473L,65473L,65473L,65473L,65473L,65474L,65474L,65474L,
-     65474L,65474L,65474L,65474L,65474L,65474L,65474L,65474L,
-     65474L,65474L,65474L,65474L,65474L,65474L,65474L,65474L,
-     65474L,65474L,65474L,65474L,65475L,65475L,65475L,65475L,
-     65475L,65475L,65475L,65475L,65475L,65475L,65475L,65475L,
-     65475L,65475L,65475L,65475L,65475L,65475L,65475L,65475L,
-     65475L,65475L,65475L,65476L,65476L,65476L,65476L,65476L,
-     65476L,65476L,65476L,65476L,65476L,65476L,65476L,65476L,
-     65476L,65476L,65476L,65476L,65476L,65476L,65476L,65476L,
-     65476L,65476L,65477L,65477L,65477L,65477L,65477L,65477L,
-     65477L,65477L,65477L,65477L,65477L,65477L,65477L,65477L,
-     65477L,65477L,65477L,65477L,65477L,65477L,65477L,65477L,
-     65477L,65477L,65478L,65478L,65478L,65478L,65478L,65478L,
-     65478L,65478L,65478L,65478L,65478L,65478L,65478L,65478L,
-     65478L,65478L,65478L,65478L,65478L,65478L,65478L,65478L,
-     65478L,65478L,65479L,65479L,65479L,65479L,65479L,65479L,
-     65479L,65479L,65479L,65479L,65479L,65479L,65479L,65479L,
-     65479L,65479L,65479L,65479L,65479L,65479L,65479L,65479L,
-     65479L,65479L,65480L,65480L,65480L,65480L,65480L,65480L,
-     65480L,65480L,65480L,65480L,65480L,65480L,65480L,65480L,
-     65480L,65480L,65480L,65480L,65480L,65480L,65480L,65480L,
-     65480L,65480L,65481L,65481L,65481L,65481L,65481L,65481L,
-     65481L,65481L,65481L,65481L,65481L,65481L,65481L,65481L,
-     65481L,65481L,65481L,65481L,65481L,65481L,65481L,65481L,
-     65481L,65481L,65481L,65482L,65482L,65482L,65482L,65482L,
-     65482L,65482L,65482L,65482L,65482L,65482L,65482L,65482L,
-     65482L,65482L,65482L,65482L,65482L,65482L,65482L,65482L,
-     65482L,65482L,65482L,65482L,65483L,65483L,65483L,65483L,
-     65483L,65483L,65483L,65483L,65483L,65483L,65483L,65483L,
-     65483L,65483L,65483L,65483L,65483L,65483L,65483L,65483L,
-     65483L,65483L,65483L,65483L,65483L,65484L,65484L,65484L,
-     65484L,65484L,65484L,65484L,65484L,65484L,65484L,65484L,
-     65484L,65484L,65484L,65484L,65484L,65484L,65484L,65484L,
-     65484L,65484L,65484L,65484L,65484L,65484L,65485L,65485L,
-     65485L,65485L,65485L,65485L,65485L,65485L,65485L,65485L,
-     65485L,65485L,65485L,65485L,65485L,65485L,65485L,65485L,
-     65485L,65485L,65485L,65485L,65485L,65485L,65485L,65486L,
-     65486L,65486L,65486L,65486L,65486L,65486L,65486L,65486L,
-     65486L,65486L,65486L,65486L,65486L,65486L,65486L,65486L,
-     65486L,65486L,65486L,65486L,65486L,65486L,65486L,65486L,
-     65486L,65487L,65487L,65487L,65487L,65487L,65487L,65487L,
-     65487L,65487L,65487L,65487L,65487L,65487L,65487L,65487L,
-     65487L,65487L,65487L,65487L,65487L,65487L,65487L,65487L,
-     65487L,65487L,65487L,65488L,65488L,65488L,65488L,65488L,
-     65488L,65488L,65488L,65488L,65488L,65488L,65488L,65488L,
-     65488L,65488L,65488L,65488L,65488L,65488L,65488L,65488L,
-     65488L,65488L,65488L,65488L,65488L,65489L,65489L,65489L,
-     65489L,65489L,65489L,65489L,65489L,65489L,65489L,65489L,
-     65489L,65489L,65489L,65489L,65489L,65489L,65489L,65489L,
-     65489L,65489L,65489L,65489L,65489L,65489L,65489L,65489L,
-     65490L,65490L,65490L,65490L,65490L,65490L,65490L,65490L,
-     65490L,65490L,65490L,65490L,65490L,65490L,65490L,65490L,
-     65490L,65490L,65490L,65490L,65490L,65490L,65490L,65490L,
-     65490L,65490L,65490L,65491L,65491L,65491L,65491L,65491L,
-     65491L,65491L,65491L,65491L,65491L,65491L,65491L,65491L,
-     65491L,65491L,65491L,65491L,65491L,65491L,65491L,65491L,
-     65491L,65491L,65491L,65491L,65491L,65491L,65492L,65492L,
-     65492L,65492L,65492L,65492L,65492L,65492L,65492L,65492L,
-     65492L,65492L,65492L,65492L,65492L,65492L,65492L,65492L,
-     65492L,65492L,65492L,65492L,65492L,65492L,65492L,65492L,
-     65492L,65493L,65493L,65493L,65493L,65493L,65493L,65493L,
-     65493L,65493L,65493L,65493L,65493L,65493L,65493L,65493L,
-     65493L,65493L,65493L,65493L,65493L,65493L,65493L,65493L,
-     65493L,65493L,65493L,65493L,65493L,65494L,65494L,65494L,
-     65494L,65494L,65494L,65494L,65494L,65494L,65494L,65494L,
-     65494L,65494L,65494L,65494L,65494L,65494L,65494L,65494L,
-     65494L,65494L,65494L,65494L,65494L,65494L,65494L,65494L,
-     65494L,65495L,65495L,65495L,65495L,65495L,65495L,65495L,
-     65495L,65495L,65495L,65495L,65495L,65495L,65495L,65495L,
-     65495L,65495L,65495L,65495L,65495L,65495L,65495L,65495L,
-     65495L,65495L,65495L,65495L,65495L,65495L,65496L,65496L,
-     65496L,65496L,65496L,65496L,65496L,65496L,65496L,65496L,
-     65496L,65496L,65496L,65496L,65496L,65496L,65496L,65496L,
-     65496L,65496L,65496L,65496L,65496L,65496L,65496L,65496L,
-     65496L,65496L,65497L,65497L,65497L,65497L,65497L,65497L,
-     65497L,65497L,65497L,65497L,65497L,65497L,65497L,65497L,
-     65497L,65497L,65497L,65497L,65497L,65497L,65497L,65497L,
-     65497L,65497L,65497L,65497L,65497L,65497L,65497L,65497L,
-     65498L,65498L,65498L,65498L,65498L,65498L,65498L,65498L,
-     65498L,65498L,65498L,65498L,65498L,65498L,65498L,65498L,
-     65498L,65498L,65498L,65498L,65498L,65498L,65498L,65498L,
-     65498L,65498L,65498L,65498L,65498L,65499L,65499L,65499L,
-     65499L,65499L,65499L,65499L,65499L,65499L,65499L,65499L,
-     65499L,65499L,65499L,65499L,65499L,65499L,65499L,65499L,
-     65499L,65499L,65499L,65499L,65499L,65499L,65499L,65499L,
-     65499L,65499L,65499L,65500L,65500L,65500L,65500L,65500L,
-     65500L,65500L,65500L,65500L,65500L,65500L,65500L,65500L,
-     65500L,65500L,65500L,65500L,65500L,65500L,65500L,65500L,
-     65500L,65500L,65500L,65500L,65500L,65500L,65500L,65500L,
-     65500L,65500L,65501L,65501L,65501L,65501L,65501L,65501L,
-     65501L,65501L,65501L,65501L,65501L,65501L,65501L,65501L,
-     65501L,65501L,65501L,65501L,65501L,65501L,65501L,65501L,
-     65501L,65501L,65501L,65501L,65501L,65501L,65501L,65501L,
-     65502L,65502L,65502L,65502L,65502L,65502L,65502L,65502L,
-     65502L,65502L,65502L,65502L,65502L,65502L,65502L,65502L,
-     65502L,65502L,65502L,65502L,65502L,65502L,65502L,65502L,
-     65502L,65502L,65502L,65502L,65502L,65502L,65502L,65502L,
-     65503L,65503L,65503L,65503L,65503L,65503L,65503L,65503L,
-     65503L,65503L,65503L,65503L,65503L,65503L,65503L,65503L,
-     65503L,65503L,65503L,65503L,65503L,65503L,65503L,65503L,
-     65503L,65503L,65503L,65503L,65503L,65503L,65503L,65504L,
-     65504L,65504L,65504L,65504L,65504L,65504L,65504L,65504L,
-     65504L,65504L,65504L,65504L,65504L,65504L,65504L,65504L,
-     65504L,65504L,65504L,65504L,65504L,65504L,65504L,65504L,
-     65504L,65504L,65504L,65504L,65504L,65504L,65504L,65504L,
-     65505L,65505L,65505L,65505L,65505L,65505L,65505L,65505L,
-     65505L,65505L,65505L,65505L,65505L,65505L,65505L,65505L,
-     65505L,65505L,65505L,65505L,65505L,65505L,65505L,65505L,
-     65505L,65505L,65505L,65505L,65505L,65505L,65505L,65505L,
-     65506L,65506L,65506L,65506L,65506L,65506L,65506L,65506L,
-     65506L,65506L,65506L,65506L,65506L,65506L,65506L,65506L,
-     65506L,65506L,65506L,65506L,65506L,65506L,65506L,65506L,
-     65506L,65506L,65506L,65506L,65506L,65506L,65506L,65506L,
-     65506L,65506L,65507L,65507L,65507L,65507L,65507L,65507L,
-     65507L,65507L,65507L,65507L,65507L,65507L,65507L,65507L,
-     65507L,65507L,65507L,65507L,65507L,65507L,65507L,65507L,
-     65507L,65507L,65507L,65507L,65507L,65507L,65507L,65507L,
-     65507L,65507L,65507L,65507L,65508L,65508L,65508L,65508L,
-     65508L,65508L,65508L,65508L,65508L,65508L,65508L,65508L,
-     65508L,65508L,65508L,65508L,65508L,65508L,65508L,65508L,
-     65508L,65508L,65508L,65508L,65508L,65508L,65508L,65508L,
-     65508L,65508L,65508L,65508L,65508L,65508L,65509L,65509L,
-     65509L,65509L,65509L,65509L,65509L,65509L,65509L,65509L,
-     65509L,65509L,65509L,65509L,65509L,65509L,65509L,65509L,
-     65509L,65509L,65509L,65509L,65509L,65509L,65509L,65509L,
-     65509L,65509L,65509L,65509L,65509L,65509L,65509L,65509L,
-     65509L,65510L,65510L,65510L,65510L,65510L,65510L,65510L,
-     65510L,65510L,65510L,65510L,65510L,65510L,65510L,65510L,
-     65510L,65510L,65510L,65510L,65510L,65510L,65510L,65510L,
-     65510L,65510L,65510L,65510L,65510L,65510L,65510L,65510L,
-     65510L,65510L,65510L,65510L,65510L,65511L,65511L,65511L,
-     65511L,65511L,65511L,65511L,65511L,65511L,65511L,65511L,
-     65511L,65511L,65511L,65511L,65511L,65511L,65511L,65511L,
-     65511L,65511L,65511L,65511L,65511L,65511L,65511L,65511L,
-     65511L,65511L,65511L,65511L,65511L,65511L,65511L,65511L,
-     65511L,65511L,65512L,65512L,65512L,65512L,65512L,65512L,
-     65512L,65512L,65512L,65512L,65512L,65512L,65512L,65512L,
-     65512L,65512L,65512L,65512L,65512L,65512L,65512L,65512L,
-     65512L,65512L,65512L,65512L,65512L,65512L,65512L,65512L,
-     65512L,65512L,65512L,65512L,65512L,65512L,65512L,65513L,
-     65513L,65513L,65513L,65513L,65513L,65513L,65513L,65513L,
-     65513L,65513L,65513L,65513L,65513L,65513L,65513L,65513L,
-     65513L,65513L,65513L,65513L,65513L,65513L,65513L,65513L,
-     65513L,65513L,65513L,65513L,65513L,65513L,65513L,65513L,
-     65513L,65513L,65513L,65513L,65513L,65514L,65514L,65514L,
-     65514L,65514L,65514L,65514L,65514L,65514L,65514L,65514L,
-     65514L,65514L,65514L,65514L,65514L,65514L,65514L,65514L,
-     65514L,65514L,65514L,65514L,65514L,65514L,65514L,65514L,
-     65514L,65514L,65514L,65514L,65514L,65514L,65514L,65514L,
-     65514L,65514L,65514L,65514L,65515L,65515L,65515L,65515L,
-     65515L,65515L,65515L,65515L,65515L,65515L,65515L,65515L,
-     65515L,65515L,65515L,65515L,65515L,65515L,65515L,65515L,
-     65515L,65515L,65515L,65515L,65515L,65515L,65515L,65515L,
-     65515L,65515L,65515L,65515L,65515L,65515L,65515L,65515L,
-     65515L,65515L,65515L,65515L,65516L,65516L,65516L,65516L,
-     65516L,65516L,65516L,65516L,65516L,65516L,65516L,65516L,
-     65516L,65516L,65516L,65516L,65516L,65516L,65516L,65516L,
-     65516L,65516L,65516L,65516L,65516L,65516L,65516L,65516L,
-     65516L,65516L,65516L,65516L,65516L,65516L,65516L,65516L,
-     65516L,65516L,65516L,65516L,65516L,65517L,65517L,65517L,
-     65517L,65517L,65517L,65517L,65517L,65517L,65517L,65517L,
-     65517L,65517L,65517L,65517L,65517L,65517L,65517L,65517L,
-     65517L,65517L,65517L,65517L,65517L,65517L,65517L,65517L,
-     65517L,65517L,65517L,65517L,65517L,65517L,65517L,65517L,
-     65517L,65517L,65517L,65517L,65517L,65517L,65517L,65518L,
-     65518L,65518L,65518L,65518L,65518L,65518L,65518L,65518L,
-     65518L,65518L,65518L,65518L,65518L,65518L,65518L,65518L,
-     65518L,65518L,65518L,65518L,65518L,65518L,65518L,65518L,
-     65518L,65518L,65518L,65518L,65518L,65518L,65518L,65518L,
-     65518L,65518L,65518L,65518L,65518L,65518L,65518L,65518L,
-     65518L,65518L,65518L,65519L,65519L,65519L,65519L,65519L,
-     65519L,65519L,65519L,65519L,65519L,65519L,65519L,65519L,
-     65519L,65519L,65519L,65519L,65519L,65519L,65519L,65519L,
-     65519L,65519L,65519L,65519L,65519L,65519L,65519L,65519L,
-     65519L,65519L,65519L,65519L,65519L,65519L,65519L,65519L,
-     65519L,65519L,65519L,65519L,65519L,65519L,65519L,65520L,
-     65520L,65520L,65520L,65520L,65520L,65520L,65520L,65520L,
-     65520L,65520L,65520L,65520L,65520L,65520L,65520L,65520L,
-     65520L,65520L,65520L,65520L,65520L,65520L,65520L,65520L,
-     65520L,65520L,65520L,65520L,65520L,65520L,65520L,65520L,
-     65520L,65520L,65520L,65520L,65520L,65520L,65520L,65520L,
-     65520L,65520L,65520L,65520L,65520L,65521L,65521L,65521L,
-     65521L,65521L,65521L,65521L,65521L,65521L,65521L,65521L,
-     65521L,65521L,65521L,65521L,65521L,65521L,65521L,65521L,
-     65521L,65521L,65521L,65521L,65521L,65521L,65521L,65521L,
-     65521L,65521L,65521L,65521L,65521L,65521L,65521L,65521L,
-     65521L,65521L,65521L,65521L,65521L,65521L,65521L,65521L,
-     65521L,65521L,65521L,65521L,65521L,65522L,65522L,65522L,
-     65522L,65522L,65522L,65522L,65522L,65522L,65522L,65522L,
-     65522L,65522L,65522L,65522L,65522L,65522L,65522L,65522L,
-     65522L,65522L,65522L,65522L,65522L,65522L,65522L,65522L,
-     65522L,65522L,65522L,65522L,65522L,65522L,65522L,65522L,
-     65522L,65522L,65522L,65522L,65522L,65522L,65522L,65522L,
-     65522L,65522L,65522L,65522L,65522L,65522L,65523L,65523L,
-     65523L,65523L,65523L,65523L,65523L,65523L,65523L,65523L,
-     65523L,65523L,65523L,65523L,65523L,65523L,65523L,65523L,
-     65523L,65523L,65523L,65523L,65523L,65523L,65523L,65523L,
-     65523L,65523L,65523L,65523L,65523L,65523L,65523L,65523L,
-     65523L,65523L,65523L,65523L,65523L,65523L,65523L,65523L,
-     65523L,65523L,65523L,65523L,65523L,65523L,65523L,65523L,
-     65523L,65524L,65524L,65524L,65524L,65524L,65524L,65524L,
-     65524L,65524L,65524L,65524L,65524L,65524L,65524L,65524L,
-     65524L,65524L,65524L,65524L,65524L,65524L,65524L,65524L,
-     65524L,65524L,65524L,65524L,65524L,65524L,65524L,65524L,
-     65524L,65524L,65524L,65524L,65524L,65524L,65524L,65524L,
-     65524L,65524L,65524L,65524L,65524L,65524L,65524L,65524L,
-     65524L,65524L,65524L,65524L,65524L,65524L,65524L,65525L,
-     65525L,65525L,65525L,65525L,65525L,65525L,65525L,65525L,
-     65525L,65525L,65525L,65525L,65525L,65525L,65525L,65525L,
-     65525L,65525L,65525L,65525L,65525L,65525L,65525L,65525L,
-     65525L,65525L,65525L,65525L,65525L,65525L,65525L,65525L,
-     65525L,65525L,65525L,65525L,65525L,65525L,65525L,65525L,
-     65525L,65525L,65525L,65525L,65525L,65525L,65525L,65525L,
-     65525L,65525L,65525L,65525L,65525L,65525L,65525L,65526L,
-     65526L,65526L,65526L,65526L,65526L,65526L,65526L,65526L,
-     65526L,65526L,65526L,65526L,65526L,65526L,65526L,65526L,
-     65526L,65526L,65526L,65526L,65526L,65526L,65526L,65526L,
-     65526L,65526L,65526L,65526L,65526L,65526L,65526L,65526L,
-     65526L,65526L,65526L,65526L,65526L,65526L,65526L,65526L,
-     65526L,65526L,65526L,65526L,65526L,65526L,65526L,65526L,
-     65526L,65526L,65526L,65526L,65526L,65526L,65526L,65526L,
-     65526L,65527L,65527L,65527L,65527L,65527L,65527L,65527L,
-     65527L,65527L,65527L,65527L,65527L,65527L,65527L,65527L,
-     65527L,65527L,65527L,65527L,65527L,65527L,65527L,65527L,
-     65527L,65527L,65527L,65527L,65527L,65527L,65527L,65527L,
-     65527L,65527L,65527L,65527L,65527L,65527L,65527L,65527L,
-     65527L,65527L,65527L,65527L,65527L,65527L,65527L,65527L,
-     65527L,65527L,65527L,65527L,65527L,65527L,65527L,65527L,
-     65527L,65527L,65527L,65527L,65527L,65527L,65527L,65528L,
-     65528L,65528L,65528L,65528L,65528L,65528L,65528L,65528L,
-     65528L,65528L,65528L,65528L,65528L,65528L,65528L,65528L,
-     65528L,65528L,65528L,65528L,65528L,65528L,65528L,65528L,
-     65528L,65528L,65528L,65528L,65528L,65528L,65528L,65528L,
-     65528L,65528L,65528L,65528L,65528L,65528L,65528L,65528L,
-     65528L,65528L,65528L,65528L,65528L,65528L,65528L,65528L,
-     65528L,65528L,65528L,65528L,65528L,65528L,65528L,65528L,
-     65528L,65528L,65528L,65528L,65528L,65528L,65528L,65528L,
-     65528L,65528L,65529L,65529L,65529L,65529L,65529L,65529L,
-     65529L,65529L,65529L,65529L,65529L,65529L,65529L,65529L,
-     65529L,65529L,65529L,65529L,65529L,65529L,65529L,65529L,
-     65529L,65529L,65529L,65529L,65529L,65529L,65529L,65529L,
-     65529L,65529L,65529L,65529L,65529L,65529L,65529L,65529L,
-     65529L,65529L,65529L,65529L,65529L,65529L,65529L,65529L,
-     65529L,65529L,65529L,65529L,65529L,65529L,65529L,65529L,
-     65529L,65529L,65529L,65529L,65529L,65529L,65529L,65529L,
-     65529L,65529L,65529L,65529L,65529L,65529L,65529L,65529L,
-     65529L,65530L,65530L,65530L,65530L,65530L,65530L,65530L,
-     65530L,65530L,65530L,65530L,65530L,65530L,65530L,65530L,
-     65530L,65530L,65530L,65530L,65530L,65530L,65530L,65530L,
-     65530L,65530L,65530L,65530L,65530L,65530L,65530L,65530L,
-     65530L,65530L,65530L,65530L,65530L,65530L,65530L,65530L,
-     65530L,65530L,65530L,65530L,65530L,65530L,65530L,65530L,
-     65530L,65530L,65530L,65530L,65530L,65530L,65530L,65530L,
-     65530L,65530L,65530L,65530L,65530L,65530L,65530L,65530L,
-     65530L,65530L,65530L,65530L,65530L,65530L,65530L,65530L,
-     65530L,65530L,65530L,65530L,65530L,65530L,65531L,65531L,
-     65531L,65531L,65531L,65531L,65531L,65531L,65531L,65531L,
-     65531L,65531L,65531L,65531L,65531L,65531L,65531L,65531L,
-     65531L,65531L,65531L,65531L,65531L,65531L,65531L,65531L,
-     65531L,65531L,65531L,65531L,65531L,65531L,65531L,65531L,
-     65531L,65531L,65531L,65531L,65531L,65531L,65531L,65531L,
-     65531L,65531L,65531L,65531L,65531L,65531L,65531L,65531L,
-     65531L,65531L,65531L,65531L,65531L,65531L,65531L,65531L,
-     65531L,65531L,65531L,65531L,65531L,65531L,65531L,65531L,
-     65531L,65531L,65531L,65531L,65531L,65531L,65531L,65531L,
-     65531L,65531L,65531L,65531L,65531L,65531L,65531L,65531L,
-     65531L,65531L,65531L,65532L,65532L,65532L,65532L,65532L,
-     65532L,65532L,65532L,65532L,65532L,65532L,65532L,65532L,
-     65532L,65532L,65532L,65532L,65532L,65532L,65532L,65532L,
-     65532L,65532L,65532L,65532L,65532L,65532L,65532L,65532L,
-     65532L,65532L,65532L,65532L,65532L,65532L,65532L,65532L,
-     65532L,65532L,65532L,65532L,65532L,65532L,65532L,65532L,
-     65532L,65532L,65532L,65532L,65532L,65532L,65532L,65532L,
-     65532L,65532L,65532L,65532L,65532L,65532L,65532L,65532L,
-     65532L,65532L,65532L,65532L,65532L,65532L,65532L,65532L,
-     65532L,65532L,65532L,65532L,65532L,65532L,65532L,65532L,
-     65532L,65532L,65532L,65532L,65532L,65532L,65532L,65532L,
-     65532L,65532L,65532L,65532L,65532L,65532L,65532L,65532L,
-     65532L,65532L,65532L,65532L,65533L,65533L,65533L,65533L,
-     65533L,65533L,65533L,65533L,65533L,65533L,65533L,65533L,
-     65533L,65533L,65533L,65533L,65533L,65533L,65533L,65533L,
-     65533L,65533L,65533L,65533L,65533L,65533L,65533L,65533L,
-     65533L,65533L,65533L,65533L,65533L,65533L,65533L,65533L,
-     65533L,65533L,65533L,65533L,65533L,65533L,65533L,65533L,
-     65533L,65533L,65533L,65533L,65533L,65533L,65533L,65533L,
-     65533L,65533L,65533L,65533L,65533L,65533L,65533L,65533L,
-     65533L,65533L,65533L,65533L,65533L,65533L,65533L,65533L,
-     65533L,65533L,65533L,65533L,65533L,65533L,65533L,65533L,
-     65533L,65533L,65533L,65533L,65533L,65533L,65533L,65533L,
-     65533L,65533L,65533L,65533L,65533L,65533L,65533L,65533L,
-     65533L,65533L,65533L,65533L,65533L,65533L,65533L,65533L,
-     65533L,65533L,65533L,65533L,65533L,65533L,65533L,65533L,
-     65533L,65533L,65533L,65533L,65533L,65533L,65533L,65533L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65534L,65534L,65534L,
-     65534L,65534L,65534L,65534L,65534L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65535L,
-     65535L,65535L,65535L,65535L,65535L,65535L,65535L,65536L,
-};
-int Fix64::sintableLen = 102944;
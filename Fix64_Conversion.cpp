@@ -0,0 +1,240 @@
+//
+//  Fix64_Conversion.cpp
+//  MathLib
+//
+//  Fix64与float/double的批量转换.
+//
+
+#include "Fix64.h"
+#include "Fix64Simd.h"
+#include "FVector3Array.h"
+using namespace FMath;
+
+namespace
+{
+    /************ scalar ***********/
+
+    // 以下标量实现处理[begin, n)，AVX2实现用它处理不足4项的尾部和超出快速路径范围的4项
+
+    void ToDoubleScalar(const Fix64* in, double* out, size_t begin, size_t n)
+    {
+        for (size_t i = begin; i < n; ++i)
+        {
+            out[i] = in[i].ToDouble();
+        }
+    }
+
+    void ToFloatScalar(const Fix64* in, float* out, size_t begin, size_t n)
+    {
+        for (size_t i = begin; i < n; ++i)
+        {
+            out[i] = in[i].ToSingle();
+        }
+    }
+
+    void FromDoubleScalar(const double* in, Fix64* out, size_t begin, size_t n)
+    {
+        for (size_t i = begin; i < n; ++i)
+        {
+            out[i] = Fix64(in[i]);
+        }
+    }
+
+    void FromFloatScalar(const float* in, Fix64* out, size_t begin, size_t n)
+    {
+        for (size_t i = begin; i < n; ++i)
+        {
+            out[i] = Fix64(in[i]);
+        }
+    }
+
+#if FIX64_SIMD_AVX2
+    /************ avx2 ***********/
+
+    using namespace FMath::Simd;
+
+    /// <summary>
+    /// AVX2没有int64与double的转换指令：1.5*2^52的尾数最低位为1，|v| < 2^51时
+    /// v加到它的位模式上等于double加法magic + v，两个方向都是精确的.
+    /// </summary>
+    const double magic = 6755399441055744.0;
+
+    const int64_t fastLimit = (int64_t)1 << 51;
+
+    FIX64_TARGET_AVX2 inline __m256d RawToDouble4(__m256i raw)
+    {
+        __m256d vm = _mm256_set1_pd(magic);
+        return _mm256_sub_pd(_mm256_castsi256_pd(_mm256_add_epi64(raw, _mm256_castpd_si256(vm))), vm);
+    }
+
+    /// rawValue都在[-2^51, 2^51)内
+    FIX64_TARGET_AVX2 inline bool RawInRange4(__m256i raw)
+    {
+        __m256i biased = _mm256_add_epi64(raw, _mm256_set1_epi64x(fastLimit));
+        __m256i high = _mm256_srli_epi64(biased, 52);
+        return _mm256_testz_si256(high, high) != 0;
+    }
+
+    /// <summary>
+    /// 与Fix64::RoundToRaw<fractionBits>相同：截断后按余数远离0进位.
+    /// |scaled| >= 2^51或NaN时返回false，由标量实现处理.
+    /// </summary>
+    FIX64_TARGET_AVX2 inline bool DoubleToRaw4(__m256d value, __m256i& raw)
+    {
+        __m256d scaled = _mm256_mul_pd(value, _mm256_set1_pd((double)Fix64::fractionFactor));
+        __m256d magnitude = _mm256_andnot_pd(_mm256_set1_pd(-0.0), scaled);
+        if (_mm256_movemask_pd(_mm256_cmp_pd(magnitude, _mm256_set1_pd((double)fastLimit), _CMP_LT_OQ)) != 0xF)
+        {
+            return false;
+        }
+
+        __m256d one = _mm256_set1_pd(1.0);
+        __m256d truncated = _mm256_round_pd(scaled, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        __m256d remainder = _mm256_sub_pd(scaled, truncated);
+        __m256d up = _mm256_and_pd(_mm256_cmp_pd(remainder, _mm256_set1_pd(0.5), _CMP_GE_OQ), one);
+        __m256d down = _mm256_and_pd(_mm256_cmp_pd(remainder, _mm256_set1_pd(-0.5), _CMP_LE_OQ), one);
+        __m256d rounded = _mm256_sub_pd(_mm256_add_pd(truncated, up), down);
+
+        __m256d vm = _mm256_set1_pd(magic);
+        raw = _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(rounded, vm)), _mm256_castpd_si256(vm));
+        return true;
+    }
+
+    FIX64_TARGET_AVX2 void ToDoubleAvx2(const Fix64* in, double* out, size_t n)
+    {
+        const int64_t* rawIn = &in->rawValue;
+        __m256d scale = _mm256_set1_pd(1.0 / Fix64::fractionFactor);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            __m256i raw = Load4(rawIn + i);
+            if (RawInRange4(raw))
+            {
+                _mm256_storeu_pd(out + i, _mm256_mul_pd(RawToDouble4(raw), scale));
+            }
+            else
+            {
+                ToDoubleScalar(in, out, i, i + 4);
+            }
+        }
+        ToDoubleScalar(in, out, i, n);
+    }
+
+    FIX64_TARGET_AVX2 void ToFloatAvx2(const Fix64* in, float* out, size_t n)
+    {
+        const int64_t* rawIn = &in->rawValue;
+        __m256d scale = _mm256_set1_pd(1.0 / Fix64::fractionFactor);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            __m256i raw = Load4(rawIn + i);
+            if (RawInRange4(raw))
+            {
+                // double精确，转float时舍入一次，与(float)rawValue * 2^-16相同
+                _mm_storeu_ps(out + i, _mm256_cvtpd_ps(_mm256_mul_pd(RawToDouble4(raw), scale)));
+            }
+            else
+            {
+                ToFloatScalar(in, out, i, i + 4);
+            }
+        }
+        ToFloatScalar(in, out, i, n);
+    }
+
+    FIX64_TARGET_AVX2 void FromDoubleAvx2(const double* in, Fix64* out, size_t n)
+    {
+        int64_t* rawOut = &out->rawValue;
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            __m256i raw;
+            if (DoubleToRaw4(_mm256_loadu_pd(in + i), raw))
+            {
+                Store4(rawOut + i, raw);
+            }
+            else
+            {
+                FromDoubleScalar(in, out, i, i + 4);
+            }
+        }
+        FromDoubleScalar(in, out, i, n);
+    }
+
+    FIX64_TARGET_AVX2 void FromFloatAvx2(const float* in, Fix64* out, size_t n)
+    {
+        int64_t* rawOut = &out->rawValue;
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            __m256i raw;
+            if (DoubleToRaw4(_mm256_cvtps_pd(_mm_loadu_ps(in + i)), raw))
+            {
+                Store4(rawOut + i, raw);
+            }
+            else
+            {
+                FromFloatScalar(in, out, i, i + 4);
+            }
+        }
+        FromFloatScalar(in, out, i, n);
+    }
+
+#endif
+
+    bool UseAvx2()
+    {
+        return FVector3Array::GetKernel() == FVector3Array::Kernel::Avx2;
+    }
+}
+
+void Fix64::ToDoubleArray(const Fix64* in, double* out, size_t count)
+{
+#if FIX64_SIMD_AVX2
+    if (UseAvx2())
+    {
+        ToDoubleAvx2(in, out, count);
+        return;
+    }
+#endif
+
+    ToDoubleScalar(in, out, 0, count);
+}
+
+void Fix64::ToFloatArray(const Fix64* in, float* out, size_t count)
+{
+#if FIX64_SIMD_AVX2
+    if (UseAvx2())
+    {
+        ToFloatAvx2(in, out, count);
+        return;
+    }
+#endif
+
+    ToFloatScalar(in, out, 0, count);
+}
+
+void Fix64::FromDoubleArray(const double* in, Fix64* out, size_t count)
+{
+#if FIX64_SIMD_AVX2
+    if (UseAvx2())
+    {
+        FromDoubleAvx2(in, out, count);
+        return;
+    }
+#endif
+
+    FromDoubleScalar(in, out, 0, count);
+}
+
+void Fix64::FromFloatArray(const float* in, Fix64* out, size_t count)
+{
+#if FIX64_SIMD_AVX2
+    if (UseAvx2())
+    {
+        FromFloatAvx2(in, out, count);
+        return;
+    }
+#endif
+
+    FromFloatScalar(in, out, 0, count);
+}
@@ -0,0 +1,214 @@
+//
+//  Fix64_Exponential.cpp
+//  MathLib
+//
+//  指数、对数和幂函数.
+//
+
+#include "Fix64.h"
+using namespace FMath;
+
+/// 表格在编译期生成，只在本编译单元中实例化
+constexpr Fix64::ExpLut Fix64::exp2Lut = MakeExp2Lut<int32_t, FIX64_EXP_LUT_BITS, 30>();
+constexpr Fix64::ExpLut Fix64::log2Lut = MakeLog2Lut<int32_t, FIX64_EXP_LUT_BITS, 30>();
+
+namespace
+{
+    /// 表格的值和查表位置都是Q30
+    const int lutBits = 30;
+    const int64_t lutOne = (int64_t)1 << lutBits;
+
+    /// round(log2(e) * 2^30)
+    const int64_t log2eQ30 = 1549082005LL;
+
+    /// round(ln(2) * 2^30)
+    const int64_t ln2Q30 = 744261118LL;
+
+    /// 2^31超出MaxValue，2^-17不到Epsilon的一半
+    const int64_t exp2MaxExponent = 31;
+    const int64_t exp2MinExponent = -17;
+
+    /// <summary>
+    /// 2^t，t为Q(fracBits)，返回rawValue.
+    /// t = n + f，n为整数，f在[0, 1)：2^f查表得到Q30的[1, 2)，再按n移位到Q16并四舍五入.
+    /// </summary>
+    int64_t Exp2Raw(int64_t t, int fracBits)
+    {
+        int64_t n = t >> fracBits;
+        if (n >= exp2MaxExponent)
+        {
+            return Fix64::MaxValue.rawValue;
+        }
+        if (n < exp2MinExponent)
+        {
+            return 0;
+        }
+
+        int64_t f = t & (((int64_t)1 << fracBits) - 1);
+        int64_t position = fracBits >= lutBits ? f >> (fracBits - lutBits) : f << (lutBits - fracBits);
+        int64_t m = lutOne + Fix64::exp2Lut.Lerp(position);
+
+        // m * 2^n，Q30 -> Q16
+        int shift = (int)(lutBits - Fix64::fractionBits - n);
+        if (shift > 0)
+        {
+            return (m + ((int64_t)1 << (shift - 1))) >> shift;
+        }
+
+        int64_t value = m << -shift;
+
+        return value > Fix64::MaxValue.rawValue ? Fix64::MaxValue.rawValue : value;
+    }
+
+    /// <summary>
+    /// log2(rawValue / 2^16)，rawValue > 0，返回Q30.
+    /// 最高位为第msb位时x = 2^(msb - 16) * m，m规格化到Q30的[1, 2)后查log2(m).
+    /// </summary>
+    int64_t Log2Q30(uint64_t rawValue)
+    {
+        int msb = 63 - Fix64::CountLeadingZeros(rawValue);
+        int64_t n = msb - Fix64::fractionBits;
+
+        int64_t m = msb >= lutBits ? (int64_t)(rawValue >> (msb - lutBits)) : (int64_t)(rawValue << (lutBits - msb));
+
+        return n * lutOne + Fix64::log2Lut.Lerp(m - lutOne);
+    }
+
+    /// Q30 -> rawValue，四舍五入，可以为负
+    inline int64_t Q30ToRaw(int64_t value)
+    {
+        return (value + ((int64_t)1 << (lutBits - Fix64::fractionBits - 1))) >> (lutBits - Fix64::fractionBits);
+    }
+}
+
+Fix64 Fix64::Exp2(Fix64 x)
+{
+    return FromRawValue(Exp2Raw(x.rawValue, fractionBits));
+}
+
+Fix64 Fix64::Exp(Fix64 x)
+{
+    // e^22 > 2^31，e^-12 < 2^-17，先截断范围，x * log2(e)的Q46乘积不会溢出
+    if (x.rawValue > ((int64_t)22 << fractionBits))
+    {
+        return MaxValue;
+    }
+    if (x.rawValue < -((int64_t)12 << fractionBits))
+    {
+        return Zero;
+    }
+
+    return FromRawValue(Exp2Raw(x.rawValue * log2eQ30, fractionBits + lutBits));
+}
+
+Fix64 Fix64::Log2(Fix64 x)
+{
+    if (x.rawValue <= 0)
+    {
+        return MinValue;
+    }
+
+    return FromRawValue(Q30ToRaw(Log2Q30((uint64_t)x.rawValue)));
+}
+
+Fix64 Fix64::Log(Fix64 x)
+{
+    if (x.rawValue <= 0)
+    {
+        return MinValue;
+    }
+
+    // Q30 * Q30 >> 16 = Q44，再四舍五入到Q16
+    int64_t product = Mul(Log2Q30((uint64_t)x.rawValue), ln2Q30);
+    const int shift = 2 * lutBits - 2 * fractionBits;
+
+    return FromRawValue((product + ((int64_t)1 << (shift - 1))) >> shift);
+}
+
+Fix64 Fix64::Pow(Fix64 x, Fix64 y)
+{
+    if (y.rawValue == 0)
+    {
+        return One;
+    }
+
+    if (x.rawValue == 0)
+    {
+        return y.rawValue > 0 ? Zero : MaxValue;
+    }
+
+    bool negative = false;
+    if (x.rawValue < 0)
+    {
+        // 负数只有整数次幂
+        if ((y.rawValue & (fractionFactor - 1)) != 0)
+        {
+            return Zero;
+        }
+        negative = ((y.rawValue >> fractionBits) & 1) != 0;
+    }
+
+    uint64_t ax = x.rawValue < 0 ? 0 - (uint64_t)x.rawValue : (uint64_t)x.rawValue;
+    int64_t log2x = Log2Q30(ax);
+    if (log2x == 0)
+    {
+        return negative ? -One : One;
+    }
+
+    // |y * log2(x)| >= 64时结果一定溢出或为0，提前判断，避免Q46的乘积溢出
+    uint64_t absLog = log2x < 0 ? 0 - (uint64_t)log2x : (uint64_t)log2x;
+    uint64_t absY = y.rawValue < 0 ? 0 - (uint64_t)y.rawValue : (uint64_t)y.rawValue;
+    uint64_t limit = ((uint64_t)64 << (fractionBits + lutBits)) / absLog;
+
+    int64_t value;
+    if (absY >= limit)
+    {
+        value = (log2x < 0) == (y.rawValue < 0) ? MaxValue.rawValue : 0;
+    }
+    else
+    {
+        value = Exp2Raw(y.rawValue * log2x, fractionBits + lutBits);
+    }
+
+    return FromRawValue(negative ? -value : value);
+}
+
+void Fix64::Exp(const Fix64* in, Fix64* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = Exp(in[i]);
+    }
+}
+
+void Fix64::Exp2(const Fix64* in, Fix64* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = Exp2(in[i]);
+    }
+}
+
+void Fix64::Log(const Fix64* in, Fix64* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = Log(in[i]);
+    }
+}
+
+void Fix64::Log2(const Fix64* in, Fix64* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = Log2(in[i]);
+    }
+}
+
+void Fix64::Pow(const Fix64* in, Fix64 y, Fix64* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = Pow(in[i], y);
+    }
+}
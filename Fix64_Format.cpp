@@ -0,0 +1,305 @@
+//
+//  Fix64_Format.cpp
+//  MathLib
+//
+//  Fix64的十进制格式化和解析：写入调用方的缓冲区，不分配内存.
+//
+
+#include "Fix64.h"
+using namespace FMath;
+
+namespace
+{
+    const uint64_t powersOf10[] =
+    {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+        1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+        100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+        1000000000000000000ULL,
+    };
+
+    /// 2^-16 = 152587890625 * 10^-16，小数部分的精确十进制有16位
+    const uint64_t fractionUnit = 152587890625ULL;
+    const int exactFractionDigits = 16;
+
+    /// <summary>
+    /// 解析时只保留前18位小数：两个rawValue的中点(2k + 1) / 2^17最多有17位小数，
+    /// 截断到18位不会改变与中点的大小关系，所以舍入结果仍然精确.
+    /// </summary>
+    const int maxFractionDigits = 18;
+
+    /// <summary>
+    /// 整数部分的上限2^47：运算溢出后回绕的值也是合法的rawValue，ToChars写出的任意值都要能读回，
+    /// 所以范围是整个int64_t(正数最大2^63 - 1，负数最小-2^63)，而不是MaxValue.
+    /// 超过它时不再累加，避免溢出.
+    /// </summary>
+    const uint64_t integerLimit = (uint64_t)1 << (63 - Fix64::fractionBits);
+    const uint64_t maxMagnitude = (uint64_t)1 << 63;
+
+    char* WriteUnsigned(uint64_t value, char* first, char* last)
+    {
+        char digits[20];
+        int count = 0;
+        do
+        {
+            digits[count++] = (char)('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+
+        if (last - first < count)
+        {
+            return nullptr;
+        }
+        while (count > 0)
+        {
+            *first++ = digits[--count];
+        }
+        return first;
+    }
+
+    /// digits为count位小数(包括前导0)，去掉末尾的0后写入，全为0时不写小数点
+    char* WriteFraction(uint64_t digits, int count, char* first, char* last)
+    {
+        while (count > 0 && digits % 10 == 0)
+        {
+            digits /= 10;
+            --count;
+        }
+        if (count == 0)
+        {
+            return first;
+        }
+        if (last - first < count + 1)
+        {
+            return nullptr;
+        }
+
+        *first++ = '.';
+        for (int i = count - 1; i >= 0; --i)
+        {
+            first[i] = (char)('0' + digits % 10);
+            digits /= 10;
+        }
+        return first + count;
+    }
+
+    /// <summary>
+    /// digits / 10^count换算为2^-16的个数，四舍五入，0.5时进位.
+    /// digits < 10^count，count <= 18；结果可能等于fractionFactor(进位到整数).
+    /// </summary>
+    uint64_t DecimalToFraction(uint64_t digits, int count)
+    {
+        const uint64_t p = powersOf10[count];
+        if (digits < ((uint64_t)1 << (63 - Fix64::fractionBits)))
+        {
+            return ((digits << Fix64::fractionBits) + p / 2) / p;
+        }
+
+        // digits * 2^16会溢出时逐位做长除法
+        uint64_t remainder = digits;
+        uint64_t quotient = 0;
+        for (int i = 0; i < Fix64::fractionBits; ++i)
+        {
+            remainder <<= 1;
+            quotient <<= 1;
+            if (remainder >= p)
+            {
+                remainder -= p;
+                quotient |= 1;
+            }
+        }
+        return quotient + (2 * remainder >= p ? 1 : 0);
+    }
+
+    char* Format(int64_t rawValue, bool exact, char* first, char* last)
+    {
+        uint64_t magnitude = rawValue < 0 ? 0 - (uint64_t)rawValue : (uint64_t)rawValue;
+        uint64_t integer = magnitude >> Fix64::fractionBits;
+        uint64_t fraction = magnitude & (Fix64::fractionFactor - 1);
+
+        if (rawValue < 0)
+        {
+            if (first == last)
+            {
+                return nullptr;
+            }
+            *first++ = '-';
+        }
+
+        first = WriteUnsigned(integer, first, last);
+        if (first == nullptr || fraction == 0)
+        {
+            return first;
+        }
+
+        if (exact)
+        {
+            return WriteFraction(fraction * fractionUnit, exactFractionDigits, first, last);
+        }
+
+        // 从1位小数开始找能读回fraction的最短表示；10^-5 < 2^-16，5位小数一定可以
+        for (int count = 1; ; ++count)
+        {
+            uint64_t digits = (fraction * powersOf10[count] + Fix64::fractionFactor / 2) >> Fix64::fractionBits;
+            if (digits < powersOf10[count] && DecimalToFraction(digits, count) == fraction)
+            {
+                return WriteFraction(digits, count, first, last);
+            }
+        }
+    }
+
+    bool IsDigit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    const char* SkipBlank(const char* first, const char* last)
+    {
+        while (first != last && (*first == ' ' || *first == '\t'))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    /// 行之间的空白，包括换行
+    const char* SkipSpace(const char* first, const char* last)
+    {
+        while (first != last && (*first == ' ' || *first == '\t' || *first == '\r' || *first == '\n'))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    /// 写出一行的count个分量，第j个为row[order[j]]，order为nullptr时按顺序
+    char* WriteRow(const Fix64* row, size_t count, const int* order, char* first, char* last, char separator)
+    {
+        for (size_t j = 0; j < count && first != nullptr; ++j)
+        {
+            if (j > 0)
+            {
+                if (first == last)
+                {
+                    return nullptr;
+                }
+                *first++ = separator;
+            }
+            first = row[order != nullptr ? order[j] : j].ToChars(first, last);
+        }
+        return first;
+    }
+
+    const char* ParseRow(const char* first, const char* last, Fix64* row, size_t count, const int* order, char separator)
+    {
+        for (size_t j = 0; j < count && first != nullptr; ++j)
+        {
+            if (j > 0)
+            {
+                first = SkipBlank(first, last);
+                if (first == last || *first != separator)
+                {
+                    return nullptr;
+                }
+                first = SkipBlank(first + 1, last);
+            }
+            first = Fix64::FromChars(first, last, row[order != nullptr ? order[j] : j]);
+        }
+        return first;
+    }
+}
+
+char* Fix64::ToChars(char* first, char* last) const
+{
+    return Format(rawValue, false, first, last);
+}
+
+char* Fix64::ToCharsExact(char* first, char* last) const
+{
+    return Format(rawValue, true, first, last);
+}
+
+const char* Fix64::FromChars(const char* first, const char* last, Fix64& value)
+{
+    const char* p = first;
+    bool negative = false;
+    if (p != last && (*p == '-' || *p == '+'))
+    {
+        negative = *p == '-';
+        ++p;
+    }
+
+    bool hasDigit = false;
+    uint64_t integer = 0;
+    for (; p != last && IsDigit(*p); ++p)
+    {
+        hasDigit = true;
+        if (integer <= integerLimit)
+        {
+            integer = integer * 10 + (uint64_t)(*p - '0');
+        }
+    }
+
+    uint64_t digits = 0;
+    int count = 0;
+    if (p != last && *p == '.')
+    {
+        for (++p; p != last && IsDigit(*p); ++p)
+        {
+            hasDigit = true;
+            if (count < maxFractionDigits)
+            {
+                digits = digits * 10 + (uint64_t)(*p - '0');
+                ++count;
+            }
+        }
+    }
+
+    if (!hasDigit || integer > integerLimit)
+    {
+        return nullptr;
+    }
+
+    // integer <= 2^47，magnitude <= 2^63 + 2^16，不会溢出
+    uint64_t magnitude = (integer << fractionBits) + (count > 0 ? DecimalToFraction(digits, count) : 0);
+    if (magnitude > (negative ? maxMagnitude : maxMagnitude - 1))
+    {
+        return nullptr;
+    }
+
+    value.rawValue = (int64_t)(negative ? 0 - magnitude : magnitude);
+    return p;
+}
+
+char* Fix64::ToChars(const Fix64* values, size_t count, char* first, char* last, char separator)
+{
+    return WriteRow(values, count, nullptr, first, last, separator);
+}
+
+const char* Fix64::FromChars(const char* first, const char* last, Fix64* values, size_t count, char separator)
+{
+    return ParseRow(first, last, values, count, nullptr, separator);
+}
+
+char* Fix64::ToCharsLines(const Fix64* values, size_t count, int components, char* first, char* last, const int* order)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        first = WriteRow(values + i * components, components, order, first, last, ',');
+        if (first == nullptr || first == last)
+        {
+            return nullptr;
+        }
+        *first++ = '\n';
+    }
+    return first;
+}
+
+const char* Fix64::FromCharsLines(const char* first, const char* last, Fix64* values, size_t count, int components, const int* order)
+{
+    for (size_t i = 0; i < count && first != nullptr; ++i)
+    {
+        first = ParseRow(SkipSpace(first, last), last, values + i * components, components, order, ',');
+    }
+    return first;
+}
@@ -8,105 +8,296 @@
 
 #include "Fix64.h"
 #include <fstream>
-#include <cmath>
 using namespace FMath;
 
+/// 表格在编译期生成，只在本编译单元中实例化
+constexpr Fix64::TrigLut Fix64::sinLut = MakeSinLut<int32_t, FIX64_TRIG_LUT_BITS, 30>();
+constexpr Fix64::TrigLut Fix64::tanLut = MakeTanLut<int32_t, FIX64_TRIG_LUT_BITS, 30>();
+constexpr Fix64::TrigLut Fix64::asinLut = MakeAsinLut<int32_t, FIX64_TRIG_LUT_BITS, 30>();
+constexpr Fix64::TrigLut Fix64::atanLut = MakeAtanLut<int32_t, FIX64_TRIG_LUT_BITS, 30>();
+
+namespace
+{
+    /// 相位：用uint32_t表示角度，2^32为一整圈(2π)，2^30为四分之一圈(π/2).
+    /// 用相位做象限折叠，避免用截断后的PI.rawValue取模带来的累积误差.
+    const int phaseQuarterBits = 30;
+    const int64_t phaseQuarter = (int64_t)1 << phaseQuarterBits;
+
+    /// round(2^40 / 2π)：rawValue弧度 -> 相位
+    const uint64_t radianToPhase = 174992710548ULL;
+
+    /// 表格的值和查表位置都是Q30
+    const int lutBits = 30;
+
+    /// round(π/2 * 2^30)
+    const int64_t halfPiQ30 = 1686629713LL;
+
+    inline uint32_t RadianToPhase(int64_t radian)
+    {
+        // 只需要乘积的第24-55位，按无符号回绕计算，负数和溢出都能得到正确的模2^32结果
+        return (uint32_t)(((uint64_t)radian * radianToPhase) >> 24);
+    }
+
+    /// Q30 -> rawValue，四舍五入，value不小于0
+    inline int64_t Q30ToRaw(int64_t value)
+    {
+        return (value + ((int64_t)1 << (lutBits - Fix64::fractionBits - 1))) >> (lutBits - Fix64::fractionBits);
+    }
+
+    inline int64_t Signed(int64_t value, bool negative)
+    {
+        return negative ? -value : value;
+    }
+
+    int64_t FoldPhase(uint32_t phase, int64_t& flipHorizontal, bool& flipVertical)
+    {
+        // 第3、4象限：sin(x) = -sin(x - π)
+        flipVertical = (phase >> 31) != 0;
+
+        // 第2、4象限：sin(x) = sin(π - x)，表格下标水平翻转
+        flipHorizontal = (phase >> phaseQuarterBits) & 1;
+
+        int64_t quarter = phase & (phaseQuarter - 1);
+
+        return flipHorizontal ? phaseQuarter - quarter : quarter;
+    }
+
+    inline int64_t SinPhase(uint32_t phase)
+    {
+        int64_t flipHorizontal;
+        bool flipVertical;
+        int64_t value = Fix64::SinQuarter(FoldPhase(phase, flipHorizontal, flipVertical));
+
+        return flipVertical ? -value : value;
+    }
+
+    /// <summary>
+    /// tan按π为周期，折叠到[0, π/2)：
+    /// [0, π/4]直接查表，(π/4, π/2)用tan(x) = 1 / tan(π/2 - x).
+    /// </summary>
+    Fix64 TanPhase(uint32_t phase)
+    {
+        int64_t half = phase & (2 * phaseQuarter - 1);
+
+        // (π/2, π)：tan(x) = -tan(π - x)
+        bool negative = half > phaseQuarter;
+        if (negative)
+        {
+            half = 2 * phaseQuarter - half;
+        }
+
+        if (half <= phaseQuarter / 2)
+        {
+            // [0, π/4]映射到整个表格
+            return Fix64::FromRawValue(Signed(Q30ToRaw(Fix64::tanLut.Lerp(half << 1)), negative));
+        }
+
+        int64_t cot = Fix64::tanLut.Lerp((phaseQuarter - half) << 1);
+        if (cot == 0)
+        {
+            return negative ? Fix64::MinValue : Fix64::MaxValue;
+        }
+
+        // 1 / cot，Q30 -> rawValue
+        int64_t value = (((int64_t)1 << (lutBits + Fix64::fractionBits)) + cot / 2) / cot;
+
+        return Fix64::FromRawValue(Signed(value, negative));
+    }
+
+    /// <summary>
+    /// asin(v)，v取值[0, fractionFactor]，返回Q30弧度.
+    /// 表格只覆盖[0, 1/2]，靠近1时asin过于陡峭，改用asin(v) = π/2 - 2 * asin(sqrt((1 - v) / 2)).
+    /// </summary>
+    int64_t AsinQ30(int64_t v)
+    {
+        if (v > Fix64::fractionFactor)
+        {
+            v = Fix64::fractionFactor;
+        }
+
+        if (v <= Fix64::fractionFactor / 2)
+        {
+            // [0, 1/2]映射到整个表格
+            return Fix64::asinLut.Lerp(v << (lutBits - Fix64::fractionBits + 1));
+        }
+
+        // sqrt((1 - v) / 2)，按Q30计算：sqrt(((1 - v) / 2) << 60) = sqrt((fractionFactor - v) << 43)
+        // Sqrt(x)计算sqrt(x << fractionBits)
+        int64_t w = Fix64::Sqrt((Fix64::fractionFactor - v) << (2 * lutBits - 1 - 2 * Fix64::fractionBits));
+
+        return halfPiQ30 - 2 * Fix64::asinLut.Lerp(w << 1);
+    }
+
+    /// <summary>
+    /// atan(|x|)，返回Q30弧度.
+    /// |x| <= 1直接查表，|x| > 1用atan(x) = π/2 - atan(1 / x).
+    /// </summary>
+    int64_t AtanQ30(int64_t x)
+    {
+        int64_t ax = x < 0 ? -x : x;
+
+        if (ax <= Fix64::fractionFactor)
+        {
+            return Fix64::atanLut.Lerp(ax << (lutBits - Fix64::fractionBits));
+        }
+
+        // 1 / |x|，Q30
+        int64_t inv = (((int64_t)1 << (lutBits + Fix64::fractionBits)) + ax / 2) / ax;
+
+        return halfPiQ30 - Fix64::atanLut.Lerp(inv);
+    }
+}
+
+int64_t Fix64::SinQuarter(int64_t quarter)
+{
+    return Q30ToRaw(sinLut.Lerp(quarter));
+}
+
 Fix64 Fix64::Sin(Fix64 angle)
 {
-//    bool flipHorizontal;
-//    bool flipVertical;
-//    long num = ClampSinValue(angle.rawValue, out flipHorizontal, out flipVertical);
-//    long range_max = pi.rawValue / 2;
-//    if (num >= range_max)
-//    {
-//        num = range_max;
-//    }
-//    long value = SinLut[flipHorizontal ? ((SinLut.Length - 1) - ((int)num)) : ((int)num)];
-//
-//    return FromRawValue(flipVertical ? -value : value);
-    return One;
+    int64_t flipHorizontal;
+    bool flipVertical;
+    int64_t value = SinQuarter(ClampSinValue(angle.rawValue, flipHorizontal, flipVertical));
+
+    return FromRawValue(flipVertical ? -value : value);
 }
 
+/// <summary>
+/// 象限折叠：把任意弧度折叠到[0, π/2]的相位上.
+/// </summary>
+/// <param name="radian">rawValue弧度</param>
+/// <param name="flipHorizontal">1：位于第2、4象限，已按sin(x) = sin(π - x)翻转</param>
+/// <param name="flipVertical">true：位于第3、4象限，结果需要取负</param>
+/// <returns>四分之一圈内的相位，2^30对应π/2</returns>
 int64_t Fix64::ClampSinValue(int64_t radian, int64_t& flipHorizontal, bool& flipVertical)
 {
-    return 0;
+    return FoldPhase(RadianToPhase(radian), flipHorizontal, flipVertical);
 }
 
 Fix64 Fix64::Cos(Fix64 angle)
 {
-    return One;
+    // cos(x) = sin(x + π/2)
+    return FromRawValue(SinPhase(RadianToPhase(angle.rawValue) + (uint32_t)phaseQuarter));
 }
 
 Fix64 Fix64::Tan(Fix64 angle)
 {
-    return One;
+    return TanPhase(RadianToPhase(angle.rawValue));
 }
 
 Fix64 Fix64::Cot(Fix64 val)
 {
-    return One;
+    // cot(x) = tan(π/2 - x)
+    return TanPhase((uint32_t)phaseQuarter - RadianToPhase(val.rawValue));
 }
 
 Fix64 Fix64::Asin(Fix64 val)
 {
-    return One;
+    int64_t radian = Q30ToRaw(AsinQ30(Abs(val.rawValue)));
+
+    return FromRawValue(Signed(radian, val.rawValue < 0));
 }
 
 Fix64 Fix64::Acos(Fix64 val)
 {
-    return One;
+    // acos(x) = π/2 - asin(x)
+    int64_t asin = AsinQ30(Abs(val.rawValue));
+
+    return FromRawValue(Q30ToRaw(val.rawValue < 0 ? halfPiQ30 + asin : halfPiQ30 - asin));
 }
 
 Fix64 Fix64::Atan(Fix64 val)
 {
-    return One;
+    int64_t radian = Q30ToRaw(AtanQ30(val.rawValue));
+
+    return FromRawValue(Signed(radian, val.rawValue < 0));
 }
 
-Fix64 Fix64::Acot(Fix64 val)
+Fix64 Fix64::Atan2(Fix64 y, Fix64 x)
 {
-    return One;
+    uint64_t ax = x.rawValue < 0 ? 0 - (uint64_t)x.rawValue : (uint64_t)x.rawValue;
+    uint64_t ay = y.rawValue < 0 ? 0 - (uint64_t)y.rawValue : (uint64_t)y.rawValue;
+
+    if (ax == 0 && ay == 0)
+    {
+        return Zero;
+    }
+
+    bool swap = ay > ax;
+    uint64_t hi = swap ? ay : ax;
+    uint64_t lo = swap ? ax : ay;
+
+    // hi缩小到2^32以下，lo << 30不溢出；比值只需要30位
+    int shift = NormalizeShift(hi, 32);
+    if (shift < 0)
+    {
+        hi >>= -shift;
+        lo >>= -shift;
+    }
+
+    // min / max，Q30
+    int64_t ratio = (int64_t)(((lo << lutBits) + hi / 2) / hi);
+    int64_t angle = atanLut.Lerp(ratio);
+
+    if (swap)
+    {
+        angle = halfPiQ30 - angle;
+    }
+
+    if (x.rawValue < 0)
+    {
+        angle = 2 * halfPiQ30 - angle;
+    }
+
+    return FromRawValue(Signed(Q30ToRaw(angle), y.rawValue < 0));
 }
 
+Fix64 Fix64::Acot(Fix64 val)
+{
+    // acot(x) = π/2 - atan(x)，值域(0, π)
+    int64_t atan = AtanQ30(val.rawValue);
+
+    return FromRawValue(Q30ToRaw(val.rawValue < 0 ? halfPiQ30 + atan : halfPiQ30 - atan));
+}
 
-#define Pi 3.1415926535897931
 
-void Fix64::__GenerateSinLut()
+namespace
 {
-    std::ofstream fileStream("Fix64SinLut.cpp");
-    fileStream << "int64_t Fix64::sintable[] = {";
-    
-    int64_t range_max = PI.rawValue / 2;
-    for (int64_t i = 0; i <= range_max; i++)
+    void WriteLut(const char* fileName, const char* name, const char* domain, const Fix64::TrigLut& lut)
     {
-        if ((i % 8) == 0)
+        std::ofstream fileStream(fileName);
+        fileStream << "// " << name << ": " << domain << ", " << lut.size << " entries, Q" << lut.precision << std::endl;
+        fileStream << "const int32_t " << name << "[] = {";
+
+        for (int i = 0; i < lut.size; i++)
         {
-            fileStream << std::endl;
-            fileStream << "     ";
+            if ((i % 8) == 0)
+            {
+                fileStream << std::endl;
+                fileStream << "     ";
+            }
+            fileStream << lut.values[i] << ",";
         }
-        double num = (double)i / range_max * Pi / 2;
-        int64_t value = Fix64::FromDouble(sin(num)).rawValue;
-        fileStream << value << "L,";
+        fileStream << "\n};" << std::endl;
     }
-    fileStream << "\n};";
-    
-    fileStream << "int Fix64::sintableLen = " << range_max + 1 << endl;
-    
-//    using (StreamWriter writer = ios("Fix64SinLut.cpp"))
-//    {
-//        writer.Write("namespace GameFramework.FixedMath {\r\n    partial struct Fix64 {\r\n        public static readonly long[] SinLut = new[] {");
-//        long range_max = pi.rawValue / 2;
-//        for (long i = 0; i <= range_max; i++)
-//        {
-//            if ((i % 8) == 0)
-//            {
-//                writer.WriteLine();
-//                writer.Write("            ");
-//            }
-//            double num = (double)i / range_max * System.Math.PI / 2;
-//            long value = Fix64.FromDouble(System.Math.Sin(num)).rawValue;
-//            writer.Write(string.Format("0x{0:X}L, ", value));
-//        }
-//        writer.Write("\r\n        };\r\n    }\r\n}");
-//    }
 }
 
+void Fix64::__GenerateSinLut()
+{
+    WriteLut("Fix64SinLut.txt", "sinLut", "sin(x), x in [0, PI/2]", sinLut);
+}
+
+void Fix64::__GenerateTanLut()
+{
+    WriteLut("Fix64TanLut.txt", "tanLut", "tan(x), x in [0, PI/4]", tanLut);
+}
+
+void Fix64::__GenerateAsinLut()
+{
+    WriteLut("Fix64AsinLut.txt", "asinLut", "asin(x), x in [0, 1/2]", asinLut);
+}
+
+void Fix64::__GenerateAtanLut()
+{
+    WriteLut("Fix64AtanLut.txt", "atanLut", "atan(x), x in [0, 1]", atanLut);
+}
@@ -0,0 +1,387 @@
+//
+//  Fixed.h
+//  MathLib
+//
+//  任意Q格式的定点数模板：Fixed<Storage, FracBits>.
+//
+
+#ifndef Fixed_h
+#define Fixed_h
+
+#include <stdint.h>
+#include <limits>
+#include <type_traits>
+#include "Fix64.h"
+
+namespace FMath
+{
+    /// <summary>
+    /// 定点数的乘除法：按存储类型选择中间结果的宽度.
+    /// int32_t用int64_t做中间结果；int64_t在支持__int128时用128位，否则用32位分段相乘和逐位长除.
+    /// 乘法结果向0截断(与Fix64一致)，除法结果向0截断，中间结果不回绕.
+    /// </summary>
+    template<typename Storage>
+    struct FixedArithmetic;
+
+    template<>
+    struct FixedArithmetic<int32_t>
+    {
+        static constexpr int32_t Mul(int32_t a, int32_t b, int fractionBits)
+        {
+            int64_t product = (int64_t)a * b;
+
+            // 负数加上(2^fractionBits - 1)后再算术右移，等价于向0截断的除法
+            product += (product >> 63) & (((int64_t)1 << fractionBits) - 1);
+            return (int32_t)(product >> fractionBits);
+        }
+
+        static constexpr int32_t Div(int32_t a, int32_t b, int fractionBits)
+        {
+            return (int32_t)(((int64_t)a * ((int64_t)1 << fractionBits)) / b);
+        }
+    };
+
+    template<>
+    struct FixedArithmetic<int64_t>
+    {
+        static constexpr int64_t Mul(int64_t a, int64_t b, int fractionBits)
+        {
+#if FIX64_MUL_INT128
+            __int128 product = (__int128)a * b;
+            product += (int64_t)(product >> 127) & (((int64_t)1 << fractionBits) - 1);
+
+            return (int64_t)(product >> fractionBits);
+#else
+            uint64_t signA = (uint64_t)(a >> 63);
+            uint64_t signB = (uint64_t)(b >> 63);
+            uint64_t ua = ((uint64_t)a ^ signA) - signA;
+            uint64_t ub = ((uint64_t)b ^ signB) - signB;
+            uint64_t sign = signA ^ signB;
+
+            uint64_t aLo = (uint32_t)ua, aHi = ua >> 32;
+            uint64_t bLo = (uint32_t)ub, bHi = ub >> 32;
+
+            uint64_t ll = aLo * bLo;
+            uint64_t lh = aLo * bHi;
+            uint64_t hl = aHi * bLo;
+            uint64_t hh = aHi * bHi;
+
+            uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+            uint64_t lo = (mid << 32) | (uint32_t)ll;
+            uint64_t hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+
+            uint64_t magnitude = (hi << (64 - fractionBits)) | (lo >> fractionBits);
+
+            return (int64_t)((magnitude ^ sign) - sign);
+#endif
+        }
+
+        static constexpr int64_t Div(int64_t a, int64_t b, int fractionBits)
+        {
+#if FIX64_MUL_INT128
+            return (int64_t)(((__int128)a * ((__int128)1 << fractionBits)) / b);
+#else
+            uint64_t signA = (uint64_t)(a >> 63);
+            uint64_t signB = (uint64_t)(b >> 63);
+            uint64_t ua = ((uint64_t)a ^ signA) - signA;
+            uint64_t ub = ((uint64_t)b ^ signB) - signB;
+            uint64_t sign = signA ^ signB;
+
+            // 整数部分直接除，小数部分逐位长除；remainder < ub <= 2^63，左移1位不会溢出
+            uint64_t magnitude = ua / ub;
+            uint64_t remainder = ua % ub;
+            for (int i = 0; i < fractionBits; ++i)
+            {
+                remainder <<= 1;
+                magnitude <<= 1;
+                if (remainder >= ub)
+                {
+                    remainder -= ub;
+                    magnitude |= 1;
+                }
+            }
+
+            return (int64_t)((magnitude ^ sign) - sign);
+#endif
+        }
+    };
+
+    /// <summary>
+    /// Q格式定点数：Storage为存储类型(int32_t或int64_t)，低FracBits位为小数位.
+    /// 1.Fix32(Q16.16)：4字节，精度与Fix64相同，整数部分只有15位，适合数值范围小、需要省内存的数组.
+    /// 2.Fixed<int64_t, 16>：与Fix64的布局、乘法舍入和double/float构造的舍入一致，可以与Fix64零开销互转；
+    ///   但MaxValue/MinValue是±INT64_MAX(Fix64是±(2^47-1))，除法的中间结果不回绕(Fix64在a*2^16超出int64时回绕).
+    /// 3.Fix64Q32(Q32.32)：精度1/2^32，用于对精度要求高的计算.
+    /// 4.不同格式之间只能显式转换；目标格式的小数位和整数位都不少于源格式时转换无损，
+    ///   否则小数部分向0截断、整数部分超出时回绕.
+    /// 乘法向0截断，除数为0时按1个ulp处理；加减和乘整数在Storage内按补码回绕.
+    /// Sqrt、三角函数等依赖查表的函数只在Fix64上提供，其他格式先转换为Fix64.
+    /// </summary>
+    template<typename Storage, int FracBits>
+    struct Fixed
+    {
+        static_assert(std::is_same<Storage, int32_t>::value || std::is_same<Storage, int64_t>::value,
+            "Fixed supports int32_t and int64_t storage");
+        static_assert(FracBits > 0 && FracBits < (int)sizeof(Storage) * 8 - 1, "FracBits out of range");
+
+        typedef Storage StorageType;
+
+        static constexpr int fractionBits = FracBits;
+        static constexpr Storage fractionFactor = (Storage)((Storage)1 << FracBits);
+
+        static const Fixed Zero;
+        static const Fixed One;
+        static const Fixed Half;
+        static const Fixed MaxValue;
+        static const Fixed MinValue;
+        static const Fixed Epsilon;
+
+        Storage rawValue;
+
+        constexpr Fixed() : rawValue(0)
+        {
+        }
+
+        constexpr Fixed(int value) : rawValue((Storage)((Storage)value * fractionFactor))
+        {
+        }
+
+        /// <summary>
+        /// 四舍五入到最近的rawValue，0.5个rawValue时远离0，与Fix64(double)相同.
+        /// </summary>
+        explicit constexpr Fixed(double value) : rawValue((Storage)Fix64::RoundToRaw<FracBits>(value))
+        {
+        }
+
+        explicit constexpr Fixed(float value) : rawValue((Storage)Fix64::RoundToRaw<FracBits>((double)value))
+        {
+        }
+
+        /// <summary>
+        /// 从其他Q格式显式转换.
+        /// </summary>
+        template<typename OtherStorage, int OtherFracBits>
+        explicit constexpr Fixed(const Fixed<OtherStorage, OtherFracBits>& other)
+            : rawValue(Convert<OtherStorage, OtherFracBits>(other.rawValue))
+        {
+        }
+
+        /// <summary>
+        /// 从Fix64(Q16，int64_t)显式转换.
+        /// </summary>
+        explicit constexpr Fixed(const Fix64& value)
+            : rawValue(Convert<int64_t, Fix64::fractionBits>(value.rawValue))
+        {
+        }
+
+        static constexpr Fixed FromRawValue(Storage rawValue)
+        {
+            Fixed ret;
+            ret.rawValue = rawValue;
+            return ret;
+        }
+
+        constexpr Fix64 ToFix64() const
+        {
+            return Fix64::FromRawValue(Fixed<int64_t, Fix64::fractionBits>(*this).rawValue);
+        }
+
+        constexpr double ToDouble() const
+        {
+            // 2的幂的倒数是精确的，一次乘法即可
+            return rawValue * (1.0 / fractionFactor);
+        }
+
+        constexpr float ToSingle() const
+        {
+            return (float)ToDouble();
+        }
+
+        constexpr Fixed operator -() const
+        {
+            return FromRawValue(Wrap(0 - (uint64_t)(int64_t)rawValue));
+        }
+
+        friend constexpr Fixed operator +(const Fixed& a, const Fixed& b)
+        {
+            return FromRawValue(Wrap((uint64_t)(int64_t)a.rawValue + (uint64_t)(int64_t)b.rawValue));
+        }
+
+        friend constexpr Fixed operator -(const Fixed& a, const Fixed& b)
+        {
+            return FromRawValue(Wrap((uint64_t)(int64_t)a.rawValue - (uint64_t)(int64_t)b.rawValue));
+        }
+
+        friend constexpr Fixed operator *(const Fixed& a, const Fixed& b)
+        {
+            return FromRawValue(FixedArithmetic<Storage>::Mul(a.rawValue, b.rawValue, FracBits));
+        }
+
+        friend constexpr Fixed operator *(const Fixed& a, int b)
+        {
+            return FromRawValue(Wrap((uint64_t)(int64_t)a.rawValue * (uint64_t)(int64_t)b));
+        }
+
+        friend constexpr Fixed operator *(int a, const Fixed& b)
+        {
+            return b * a;
+        }
+
+        friend constexpr Fixed operator /(const Fixed& a, const Fixed& b)
+        {
+            return FromRawValue(FixedArithmetic<Storage>::Div(a.rawValue, b.rawValue == 0 ? 1 : b.rawValue, FracBits));
+        }
+
+        friend constexpr Fixed operator /(const Fixed& a, int b)
+        {
+            return FromRawValue(a.rawValue / b);
+        }
+
+        friend constexpr const Fixed& operator +=(Fixed& a, const Fixed& b)
+        {
+            a = a + b;
+            return a;
+        }
+
+        friend constexpr const Fixed& operator -=(Fixed& a, const Fixed& b)
+        {
+            a = a - b;
+            return a;
+        }
+
+        friend constexpr const Fixed& operator *=(Fixed& a, const Fixed& b)
+        {
+            a = a * b;
+            return a;
+        }
+
+        friend constexpr const Fixed& operator /=(Fixed& a, const Fixed& b)
+        {
+            a = a / b;
+            return a;
+        }
+
+        friend constexpr bool operator ==(const Fixed& a, const Fixed& b)
+        {
+            return a.rawValue == b.rawValue;
+        }
+
+        friend constexpr bool operator !=(const Fixed& a, const Fixed& b)
+        {
+            return a.rawValue != b.rawValue;
+        }
+
+        friend constexpr bool operator >(const Fixed& a, const Fixed& b)
+        {
+            return a.rawValue > b.rawValue;
+        }
+
+        friend constexpr bool operator >=(const Fixed& a, const Fixed& b)
+        {
+            return a.rawValue >= b.rawValue;
+        }
+
+        friend constexpr bool operator <(const Fixed& a, const Fixed& b)
+        {
+            return a.rawValue < b.rawValue;
+        }
+
+        friend constexpr bool operator <=(const Fixed& a, const Fixed& b)
+        {
+            return a.rawValue <= b.rawValue;
+        }
+
+        static constexpr Fixed Max(Fixed a, Fixed b)
+        {
+            return a.rawValue > b.rawValue ? a : b;
+        }
+
+        static constexpr Fixed Min(Fixed a, Fixed b)
+        {
+            return a.rawValue <= b.rawValue ? a : b;
+        }
+
+        static constexpr Fixed Lerp(Fixed a, Fixed b, Fixed t)
+        {
+            return a + (b - a) * t;
+        }
+
+        constexpr int32_t Sign() const
+        {
+            return rawValue == 0 ? 0 : (rawValue < 0 ? -1 : 1);
+        }
+
+        constexpr Fixed Abs() const
+        {
+            return rawValue >= 0 ? *this : -*this;
+        }
+
+        /// <summary>
+        /// 向下取整，算术右移即floor.
+        /// </summary>
+        constexpr int Floor() const
+        {
+            return (int)(rawValue >> FracBits);
+        }
+
+    private:
+        /// <summary>
+        /// 把在uint64_t上算出的结果截断为Storage，即按补码回绕，避免有符号溢出的未定义行为.
+        /// </summary>
+        static constexpr Storage Wrap(uint64_t value)
+        {
+            return (Storage)value;
+        }
+
+        template<typename OtherStorage, int OtherFracBits>
+        static constexpr Storage Convert(OtherStorage rawValue)
+        {
+            if constexpr (OtherFracBits >= FracBits)
+            {
+                // 丢弃的小数位向0截断
+                int64_t value = (int64_t)rawValue;
+                const int shift = OtherFracBits - FracBits;
+                value += (value >> 63) & (((int64_t)1 << shift) - 1);
+                return (Storage)(value >> shift);
+            }
+            else
+            {
+                const int shift = FracBits - OtherFracBits;
+                return (Storage)((uint64_t)(int64_t)rawValue << shift);
+            }
+        }
+    };
+
+    template<typename Storage, int FracBits>
+    inline constexpr Fixed<Storage, FracBits> Fixed<Storage, FracBits>::Zero = Fixed::FromRawValue(0);
+
+    template<typename Storage, int FracBits>
+    inline constexpr Fixed<Storage, FracBits> Fixed<Storage, FracBits>::One = Fixed::FromRawValue(Fixed::fractionFactor);
+
+    template<typename Storage, int FracBits>
+    inline constexpr Fixed<Storage, FracBits> Fixed<Storage, FracBits>::Half = Fixed::FromRawValue(Fixed::fractionFactor / 2);
+
+    template<typename Storage, int FracBits>
+    inline constexpr Fixed<Storage, FracBits> Fixed<Storage, FracBits>::MaxValue = Fixed::FromRawValue(std::numeric_limits<Storage>::max());
+
+    template<typename Storage, int FracBits>
+    inline constexpr Fixed<Storage, FracBits> Fixed<Storage, FracBits>::MinValue = Fixed::FromRawValue(-std::numeric_limits<Storage>::max());
+
+    template<typename Storage, int FracBits>
+    inline constexpr Fixed<Storage, FracBits> Fixed<Storage, FracBits>::Epsilon = Fixed::FromRawValue(1);
+
+    /// Q16.16
+    typedef Fixed<int32_t, 16> Fix32;
+
+    /// Q48.16，布局、乘法和构造舍入与Fix64一致；MaxValue/MinValue和除法不同，见Fixed的说明
+    typedef Fixed<int64_t, 16> Fix64Q16;
+
+    /// Q32.32
+    typedef Fixed<int64_t, 32> Fix64Q32;
+
+    static_assert(sizeof(Fix32) == 4, "Fix32 must be 4 bytes");
+    static_assert(std::is_trivially_copyable<Fix32>::value, "Fix32 must be trivially copyable");
+    static_assert(sizeof(Fix64Q16) == sizeof(Fix64), "Fix64Q16 must have the same layout as Fix64");
+}
+
+#endif /* Fixed_h */
@@ -7,6 +7,7 @@
 //
 
 #include <iostream>
+#include <cstring>
 #include "Fix64.h"
 using namespace FMath;
 using namespace std;
@@ -36,6 +37,13 @@ void Case2()
 }
 
 int main(int argc, const char * argv[]) {
+    if (argc > 1 && strcmp(argv[1], "bench") == 0)
+    {
+        // 性能测试在单独的FMathBench中
+        std::cout << "use FMathBench --compare" << endl;
+        return 0;
+    }
+
     // insert code here...
 //    Case1();
     Case2();